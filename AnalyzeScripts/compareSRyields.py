@@ -0,0 +1,45 @@
+#! /usr/bin/python
+# coding: utf-8
+#
+# Compare the yields of the signal/control regions in two looper outputs bin by bin, e.g. from babies
+# made with and without a precision profile (StopBabyMaker/precisionProfile.txt), and report the
+# largest changes. Usage: python compareSRyields.py ref.root new.root [hname=h_metbins] [ntop=10]
+
+import sys
+import ROOT as r
+
+def getYieldHists(f, hname):
+    hists = {}
+    for key in f.GetListOfKeys():
+        d = key.ReadObj()
+        if not d.InheritsFrom('TDirectory'): continue
+        for hkey in d.GetListOfKeys():
+            if hkey.GetName().startswith(hname):
+                hists[d.GetName()+'/'+hkey.GetName()] = hkey.ReadObj()
+    return hists
+
+def compareYields(fref, fnew, hname='h_metbins', ntop=10):
+    href = getYieldHists(fref, hname)
+    hnew = getYieldHists(fnew, hname)
+    for name in sorted(set(href) ^ set(hnew)):
+        print "Only in", ("the reference:" if name in href else "the new output:"), name
+
+    diffs = []
+    for name in sorted(set(href) & set(hnew)):
+        h1, h2 = href[name], hnew[name]
+        for ibin in range(1, h1.GetNcells()):
+            y1, y2 = h1.GetBinContent(ibin), h2.GetBinContent(ibin)
+            if y1 == y2: continue
+            diffs.append((abs(y2-y1)/max(abs(y1), 1e-9), name, ibin, y1, y2))
+
+    print "Compared", len(set(href) & set(hnew)), hname, "histograms,", len(diffs), "bins differ"
+    for d in sorted(diffs, reverse=True)[:ntop]:
+        print "  {1:<40} bin {2:<4} {3:12.4f} -> {4:12.4f}  relative change {0:.3g}".format(*d)
+
+if __name__ == '__main__':
+    if len(sys.argv) < 3:
+        print "Usage: python compareSRyields.py ref.root new.root [hname=h_metbins] [ntop=10]"
+        sys.exit(1)
+    hname = sys.argv[3] if len(sys.argv) > 3 else 'h_metbins'
+    ntop = int(sys.argv[4]) if len(sys.argv) > 4 else 10
+    compareYields(r.TFile(sys.argv[1]), r.TFile(sys.argv[2]), hname, ntop)
@@ -446,6 +446,7 @@ void EventTree::Reset ()
     HLT_Photon250_NoHE = -9999.;
     HLT_Photon300_NoHE = -9999.;
     HLT_CaloJet500_NoJetID = -9999.;
+    HLT_bits               = 0;
 
     EA_fixgridfastjet_all_rho = -9999.;
 
@@ -592,8 +593,9 @@ void EventTree::Reset ()
 
 }
 
-void EventTree::SetBranches (TTree* tree)                                                                                          
+void EventTree::SetBranches (TTree* tree, TTree* jestree)
 {
+    TTree* jtree = (jestree)? jestree : tree;
     tree->Branch("run", &run);
     tree->Branch("ls", &ls);
     tree->Branch("evt", &evt);   
@@ -603,16 +605,16 @@ void EventTree::SetBranches (TTree* tree)
     tree->Branch("pu_nvtxs", &pu_nvtxs);
     tree->Branch("pfmet", &pfmet);
     tree->Branch("pfmet_phi", &pfmet_phi);
-    tree->Branch("pfmet_jup", &pfmet_jup);
-    tree->Branch("pfmet_phi_jup", &pfmet_phi_jup);
-    tree->Branch("pfmet_jdown", &pfmet_jdown);
-    tree->Branch("pfmet_phi_jdown", &pfmet_phi_jdown);
+    jtree->Branch("pfmet_jup", &pfmet_jup);
+    jtree->Branch("pfmet_phi_jup", &pfmet_phi_jup);
+    jtree->Branch("pfmet_jdown", &pfmet_jdown);
+    jtree->Branch("pfmet_phi_jdown", &pfmet_phi_jdown);
     tree->Branch("pfmet_rl", &pfmet_rl);
     tree->Branch("pfmet_phi_rl", &pfmet_phi_rl);
-    tree->Branch("pfmet_rl_jup", &pfmet_rl_jup);
-    tree->Branch("pfmet_phi_rl_jup", &pfmet_phi_rl_jup);
-    tree->Branch("pfmet_rl_jdown", &pfmet_rl_jdown);
-    tree->Branch("pfmet_phi_rl_jdown", &pfmet_phi_rl_jdown);
+    jtree->Branch("pfmet_rl_jup", &pfmet_rl_jup);
+    jtree->Branch("pfmet_phi_rl_jup", &pfmet_phi_rl_jup);
+    jtree->Branch("pfmet_rl_jdown", &pfmet_rl_jdown);
+    jtree->Branch("pfmet_phi_rl_jdown", &pfmet_phi_rl_jdown);
     tree->Branch("pfmet_egclean", &pfmet_egclean);
     tree->Branch("pfmet_egclean_phi", &pfmet_egclean_phi);
     tree->Branch("pfmet_muegclean", &pfmet_muegclean);
@@ -653,20 +655,20 @@ void EventTree::SetBranches (TTree* tree)
     tree->Branch("mindphi_met_j1_j2_rl", &mindphi_met_j1_j2_rl);
     tree->Branch("mt_met_lep", &mt_met_lep);
     tree->Branch("mt_met_lep_rl", &mt_met_lep_rl);
-    tree->Branch("MT2W_jup",&MT2W_jup);
-    tree->Branch("MT2W_rl_jup",&MT2W_rl_jup);
-    tree->Branch("MT2_ll_jup", &MT2_ll_jup);
-    tree->Branch("mindphi_met_j1_j2_jup", &mindphi_met_j1_j2_jup);
-    tree->Branch("mindphi_met_j1_j2_rl_jup", &mindphi_met_j1_j2_rl_jup);
-    tree->Branch("mt_met_lep_jup", &mt_met_lep_jup);
-    tree->Branch("mt_met_lep_rl_jup", &mt_met_lep_rl_jup);
-    tree->Branch("MT2W_jdown",&MT2W_jdown);
-    tree->Branch("MT2W_rl_jdown",&MT2W_rl_jdown);
-    tree->Branch("MT2_ll_jdown", &MT2_ll_jdown);
-    tree->Branch("mindphi_met_j1_j2_jdown", &mindphi_met_j1_j2_jdown);
-    tree->Branch("mindphi_met_j1_j2_rl_jdown", &mindphi_met_j1_j2_rl_jdown);
-    tree->Branch("mt_met_lep_jdown", &mt_met_lep_jdown);
-    tree->Branch("mt_met_lep_rl_jdown", &mt_met_lep_rl_jdown);
+    jtree->Branch("MT2W_jup",&MT2W_jup);
+    jtree->Branch("MT2W_rl_jup",&MT2W_rl_jup);
+    jtree->Branch("MT2_ll_jup", &MT2_ll_jup);
+    jtree->Branch("mindphi_met_j1_j2_jup", &mindphi_met_j1_j2_jup);
+    jtree->Branch("mindphi_met_j1_j2_rl_jup", &mindphi_met_j1_j2_rl_jup);
+    jtree->Branch("mt_met_lep_jup", &mt_met_lep_jup);
+    jtree->Branch("mt_met_lep_rl_jup", &mt_met_lep_rl_jup);
+    jtree->Branch("MT2W_jdown",&MT2W_jdown);
+    jtree->Branch("MT2W_rl_jdown",&MT2W_rl_jdown);
+    jtree->Branch("MT2_ll_jdown", &MT2_ll_jdown);
+    jtree->Branch("mindphi_met_j1_j2_jdown", &mindphi_met_j1_j2_jdown);
+    jtree->Branch("mindphi_met_j1_j2_rl_jdown", &mindphi_met_j1_j2_rl_jdown);
+    jtree->Branch("mt_met_lep_jdown", &mt_met_lep_jdown);
+    jtree->Branch("mt_met_lep_rl_jdown", &mt_met_lep_rl_jdown);
     tree->Branch("hadronic_top_chi2", &hadronic_top_chi2);
     tree->Branch("ak4pfjets_rho", &ak4pfjets_rho);
     tree->Branch("pdf_up_weight", &pdf_up_weight);
@@ -745,16 +747,16 @@ void EventTree::SetBranches (TTree* tree)
     tree->Branch("topness", &topness); 
     tree->Branch("topnessMod", &topnessMod);
     tree->Branch("topnessMod_rl", &topnessMod_rl);  
-    tree->Branch("topnessMod_jup", &topnessMod_jup);
-    tree->Branch("topnessMod_rl_jup", &topnessMod_rl_jup);
-    tree->Branch("topnessMod_jdown", &topnessMod_jdown);
-    tree->Branch("topnessMod_rl_jdown", &topnessMod_rl_jdown);
+    jtree->Branch("topnessMod_jup", &topnessMod_jup);
+    jtree->Branch("topnessMod_rl_jup", &topnessMod_rl_jup);
+    jtree->Branch("topnessMod_jdown", &topnessMod_jdown);
+    jtree->Branch("topnessMod_rl_jdown", &topnessMod_rl_jdown);
     tree->Branch("Mlb_closestb", &Mlb_closestb); 
     tree->Branch("Mlb_lead_bdiscr", &Mlb_lead_bdiscr);
-    tree->Branch("Mlb_closestb_jup", &Mlb_closestb_jup); 
-    tree->Branch("Mlb_lead_bdiscr_jup", &Mlb_lead_bdiscr_jup);
-    tree->Branch("Mlb_closestb_jdown", &Mlb_closestb_jdown); 
-    tree->Branch("Mlb_lead_bdiscr_jdown", &Mlb_lead_bdiscr_jdown);
+    jtree->Branch("Mlb_closestb_jup", &Mlb_closestb_jup); 
+    jtree->Branch("Mlb_lead_bdiscr_jup", &Mlb_lead_bdiscr_jup);
+    jtree->Branch("Mlb_closestb_jdown", &Mlb_closestb_jdown); 
+    jtree->Branch("Mlb_lead_bdiscr_jdown", &Mlb_lead_bdiscr_jdown);
     tree->Branch("HLT_SingleEl", &HLT_SingleEl );
     tree->Branch("HLT_SingleMu", &HLT_SingleMu );
     tree->Branch("HLT_MET", &HLT_MET);
@@ -771,6 +773,7 @@ void EventTree::SetBranches (TTree* tree)
     tree->Branch("HLT_DiEl", &HLT_DiEl );
     tree->Branch("HLT_DiMu", &HLT_DiMu );
     tree->Branch("HLT_MuE", &HLT_MuE);
+    tree->Branch("HLT_bits", &HLT_bits);
     tree->Branch("nPhotons",             &nPhotons);
     tree->Branch("ph_ngoodjets",         &ph_ngoodjets);
     tree->Branch("ph_ngoodbtags",        &ph_ngoodbtags);
@@ -810,8 +813,9 @@ void EventTree::SetExtraVariablesBranches (TTree* tree)
  //   tree->Branch("calomet_phi", &calomet_phi);  
 }
 
-void EventTree::SetMETFilterBranches (TTree* tree)
+void EventTree::SetMETFilterBranches (TTree* tree, TTree* jestree)
 {
+    TTree* jtree = (jestree)? jestree : tree;
     tree->Branch("filt_cscbeamhalo", &filt_cscbeamhalo);
     tree->Branch("filt_cscbeamhalo2015", &filt_cscbeamhalo2015);
     tree->Branch("filt_globaltighthalo2016", &filt_globaltighthalo2016);
@@ -835,11 +839,11 @@ void EventTree::SetMETFilterBranches (TTree* tree)
     tree->Branch("filt_badMuonFilter", &filt_badMuonFilter);
     tree->Branch("filt_met", &filt_met);
     tree->Branch("filt_fastsimjets", &filt_fastsimjets);
-    tree->Branch("filt_fastsimjets_jup", &filt_fastsimjets_jup);
-    tree->Branch("filt_fastsimjets_jdown", &filt_fastsimjets_jdown);
+    jtree->Branch("filt_fastsimjets_jup", &filt_fastsimjets_jup);
+    jtree->Branch("filt_fastsimjets_jdown", &filt_fastsimjets_jdown);
     tree->Branch("filt_jetWithBadMuon", &filt_jetWithBadMuon);
-    tree->Branch("filt_jetWithBadMuon_jup", &filt_jetWithBadMuon_jup);
-    tree->Branch("filt_jetWithBadMuon_jdown", &filt_jetWithBadMuon_jdown);
+    jtree->Branch("filt_jetWithBadMuon_jup", &filt_jetWithBadMuon_jup);
+    jtree->Branch("filt_jetWithBadMuon_jdown", &filt_jetWithBadMuon_jdown);
     tree->Branch("filt_pfovercalomet", &filt_pfovercalomet);
     tree->Branch("filt_badmuons", &filt_badmuons);
     tree->Branch("filt_duplicatemuons", &filt_duplicatemuons);
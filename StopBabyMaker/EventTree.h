@@ -26,10 +26,11 @@ public:
     virtual ~EventTree (){}
  
     void Reset ();
-    void SetBranches (TTree* tree);
+    // The JES varied branches go to jestree if one is given, e.g. the t_jes friend tree of the baby
+    void SetBranches (TTree* tree, TTree* jestree = nullptr);
     void SetZllBranches (TTree* tree);
     void SetPhotonBranches (TTree* tree);
-    void SetMETFilterBranches (TTree* tree);
+    void SetMETFilterBranches (TTree* tree, TTree* jestree = nullptr);
     void SetExtraVariablesBranches (TTree* tree);
     void SetSecondLepBranches (TTree* tree);
     void SetAliases (TTree* tree) const;
@@ -323,6 +324,7 @@ public:
     int HLT_Photon250_NoHE;//from MT2
     int HLT_Photon300_NoHE;
     int HLT_CaloJet500_NoJetID;//from Vince's code
+    unsigned int HLT_bits;  // packed HLT decisions, see ../StopCORE/TriggerWord.h
 
     float EA_fixgridfastjet_all_rho;//to do photon EA on the fly
 
@@ -1,4 +1,5 @@
 #include "GenParticleTree.h"
+#include "../StopCORE/SplitP4.h"
 #include "Math/GenVector/PtEtaPhiE4D.h"
 #include "CMS3.h"
 #include "StopSelections.h"
@@ -204,10 +205,11 @@ void GenParticleTree::Reset()
 
 }
 
-void GenParticleTree::SetBranches(TTree* tree)
+void GenParticleTree::SetBranches(TTree* tree, SplitP4Writer* p4writer)
 {
   tree->Branch(Form("gen%sisfromt" , prefix_.c_str()) , &isfromt);
-  tree->Branch(Form("gen%sp4"      , prefix_.c_str()) , "LorentzVector" , &p4      );
+  if (p4writer && p4writer->IsSplit()) p4writer->Branch(tree, Form("gen%sp4", prefix_.c_str()), &p4);
+  else tree->Branch(Form("gen%sp4"      , prefix_.c_str()) , "LorentzVector" , &p4      );
   tree->Branch(Form("gen%sid"  , prefix_.c_str()) ,           &id          );
   tree->Branch(Form("gen%s_genpsidx"  , prefix_.c_str()) ,           &genpsidx          );
   tree->Branch(Form("gen%sstatus"  , prefix_.c_str()) ,           &status          );
@@ -6,6 +6,7 @@
 #include "Math/LorentzVector.h"
 
 class TTree;
+class SplitP4Writer;
 
 // typedefs
 typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > LorentzVector;
@@ -24,7 +25,7 @@ public:
     virtual ~GenParticleTree () {}
 
     void Reset ();
-    void SetBranches (TTree* tree);
+    void SetBranches (TTree* tree, SplitP4Writer* p4writer = nullptr);
     void SetAliases (TTree* tree) const;
     void FillCommon (int idx);
 
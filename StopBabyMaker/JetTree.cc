@@ -1,4 +1,5 @@
 #include "JetTree.h"
+#include "../StopCORE/SplitP4.h"
 #include "CMS3.h"
 #include "Config.h"
 #include "JetSelections.h"
@@ -979,7 +980,7 @@ void JetTree::Reset ()
     nsoftbtags    = -9999;
 }
  
-void JetTree::SetAK4Branches (TTree* tree)
+void JetTree::SetAK4Branches (TTree* tree, SplitP4Writer* p4writer)
 {
     tree->Branch(Form("%snskimjets", prefix_.c_str()) , &nskimjets);
     tree->Branch(Form("%snskimbtagmed", prefix_.c_str()) , &nskimbtagmed);
@@ -994,7 +995,7 @@ void JetTree::SetAK4Branches (TTree* tree)
     tree->Branch(Form("%sak4_htratiom", prefix_.c_str()) , &ak4_htratiom);
     tree->Branch(Form("%sdphi_ak4pfjet_met", prefix_.c_str()) , &dphi_ak4pfjet_met);
 
-    tree->Branch(Form("%sak4pfjets_p4", prefix_.c_str()) , &ak4pfjets_p4);
+    branchP4s(tree, Form("%sak4pfjets_p4", prefix_.c_str()), &ak4pfjets_p4, p4writer);
 
     tree->Branch(Form("%sak4pfjets_passMEDbtag", prefix_.c_str()) , &ak4pfjets_passMEDbtag);
     tree->Branch(Form("%sak4pfjets_deepCSV", prefix_.c_str()) , &ak4pfjets_deepCSV);
@@ -1007,15 +1008,15 @@ void JetTree::SetAK4Branches (TTree* tree)
 
     tree->Branch(Form("%sak4pfjets_leadMEDbjet_p4", prefix_.c_str()) , &ak4pfjets_leadMEDbjet_p4);
     tree->Branch(Form("%sak4pfjets_leadbtag_p4", prefix_.c_str()) , &ak4pfjets_leadbtag_p4);
-    tree->Branch(Form("%sak4genjets_p4", prefix_.c_str()) , &ak4genjets_p4); 
+    branchP4s(tree, Form("%sak4genjets_p4", prefix_.c_str()), &ak4genjets_p4, p4writer); 
 
-    tree->Branch(Form("%ssofttags_p4", prefix_.c_str()) , &softtags_p4);
+    branchP4s(tree, Form("%ssofttags_p4", prefix_.c_str()), &softtags_p4, p4writer);
     tree->Branch(Form("%snsoftbtags", prefix_.c_str()) , &nsoftbtags);
 }
 
-void JetTree::SetAK8Branches (TTree* tree)
+void JetTree::SetAK8Branches (TTree* tree, SplitP4Writer* p4writer)
 {
-    tree->Branch(Form("%sak8pfjets_p4", prefix_.c_str()) , &ak8pfjets_p4);
+    branchP4s(tree, Form("%sak8pfjets_p4", prefix_.c_str()), &ak8pfjets_p4, p4writer);
     tree->Branch(Form("%sak8pfjets_tau1", prefix_.c_str()) , &ak8pfjets_tau1);
     tree->Branch(Form("%sak8pfjets_tau2", prefix_.c_str()) , &ak8pfjets_tau2);
     tree->Branch(Form("%sak8pfjets_tau3", prefix_.c_str()) , &ak8pfjets_tau3);
@@ -1089,7 +1090,7 @@ void JetTree::SetAK4Branches_EF(TTree* tree)
     tree->Branch(Form("%sak4pfjets_pm",  prefix_.c_str()) , &ak4pfjets_pm);
 }
 
-void JetTree::SetAK4Branches_TopTag(TTree* tree)
+void JetTree::SetAK4Branches_TopTag(TTree* tree, SplitP4Writer* p4writer)
 {
     tree->Branch(Form("%sak4pfjets_cvsl", prefix_.c_str()) , &ak4pfjets_cvsl);
     tree->Branch(Form("%sak4pfjets_ptD", prefix_.c_str()) , &ak4pfjets_ptD);
@@ -1104,10 +1105,10 @@ void JetTree::SetAK4Branches_TopTag(TTree* tree)
 
     tree->Branch(Form("%stopcands_ak4idx", prefix_.c_str()) , &topcands_ak4idx);
     tree->Branch(Form("%stopcands_disc", prefix_.c_str()) , &topcands_disc);
-    tree->Branch(Form("%stopcands_p4", prefix_.c_str()) , &topcands_p4);
-    tree->Branch(Form("%stopcands_Wp4", prefix_.c_str()) , &topcands_Wp4);
+    branchP4s(tree, Form("%stopcands_p4", prefix_.c_str()), &topcands_p4, p4writer);
+    branchP4s(tree, Form("%stopcands_Wp4", prefix_.c_str()), &topcands_Wp4, p4writer);
 
-    tree->Branch(Form("%stftops_p4", prefix_.c_str()) , &tftops_p4);
+    branchP4s(tree, Form("%stftops_p4", prefix_.c_str()), &tftops_p4, p4writer);
     tree->Branch(Form("%stftops_disc", prefix_.c_str()) , &tftops_disc);
     tree->Branch(Form("%stftops_subjet_pt", prefix_.c_str()) , &tftops_subjet_pt);
     tree->Branch(Form("%stftops_subjet_eta", prefix_.c_str()) , &tftops_subjet_eta);
@@ -12,6 +12,7 @@
 #include "TFTopTagger/include/TopTagger.h"
 // forward declarations
 class TTree;
+class SplitP4Writer;
  
 // typedefs
 typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > LorentzVector;
@@ -38,9 +39,9 @@ public:
     void SetAK4Branches_EF(TTree* tree);
     void SetAK4Branches_SynchTools (TTree* tree);
     void SetAK4Branches_Overleps (TTree* tree);
-    void SetAK4Branches_TopTag (TTree* tree);
-    void SetAK8Branches (TTree* tree);
-    void SetAK4Branches (TTree* tree);
+    void SetAK4Branches_TopTag (TTree* tree, SplitP4Writer* p4writer = nullptr);
+    void SetAK8Branches (TTree* tree, SplitP4Writer* p4writer = nullptr);
+    void SetAK4Branches (TTree* tree, SplitP4Writer* p4writer = nullptr);
     void SetAliases (TTree* tree);
     void FillCommon(std::vector<unsigned int> alloverlapjets_idx,  FactorizedJetCorrector* corrector, float& btagprob_data, float &btagprob_mc, float &btagprob_heavy_UP, float& btagprob_heavy_DN, float& btagprob_light_UP, float& btagprob_light_DN, float& btagprob_FS_UP, float& btagprob_FS_DN, float& loosebtagprob_data, float &loosebtagprob_mc, float &loosebtagprob_heavy_UP, float& loosebtagprob_heavy_DN, float& loosebtagprob_light_UP, float& loosebtagprob_light_DN, float& loosebtagprob_FS_UP, float& loosebtagprob_FS_DN, float& tightbtagprob_data, float &tightbtagprob_mc, float &tightbtagprob_heavy_UP, float& tightbtagprob_heavy_DN, float& tightbtagprob_light_UP, float& tightbtagprob_light_DN, float& tightbtagprob_FS_UP, float& tightbtagprob_FS_DN, unsigned int overlep1_idx, unsigned int overlep2_idx, bool applynewcorr, JetCorrectionUncertainty* jetcorr_uncertainty, int JES_type, bool applyBtagSFs, bool isFastsim);
     void FillAK8Jets(bool applynewcorr, FactorizedJetCorrector* ak8corrector, JetCorrectionUncertainty* ak8jetcorr_uncertainty, int JES_type);
@@ -221,8 +221,9 @@ void LeptonTree::Reset()
 
 }
 
-void LeptonTree::SetBranches(TTree* tree)
+void LeptonTree::SetBranches(TTree* tree, TTree* jestree)
 {
+    TTree* jtree = (jestree)? jestree : tree;
     tree->Branch(Form("%spdgid"           , prefix_.c_str()) , &pdgid           ); 
     tree->Branch(Form("%sproduction_type" , prefix_.c_str()) , &production_type );
      tree->Branch(Form("%sMiniIso"       , prefix_.c_str()) , &MiniIso);
@@ -239,11 +240,11 @@ void LeptonTree::SetBranches(TTree* tree)
     tree->Branch(Form("%setaSC"       , prefix_.c_str()) , &etaSC);
 
     tree->Branch(Form("%sdphiMET"   , prefix_.c_str()) , &dphiMET);
-    tree->Branch(Form("%sdphiMET_jup"   , prefix_.c_str()) , &dphiMET_jup);
-    tree->Branch(Form("%sdphiMET_jdown"   , prefix_.c_str()) , &dphiMET_jdown);
+    jtree->Branch(Form("%sdphiMET_jup"   , prefix_.c_str()) , &dphiMET_jup);
+    jtree->Branch(Form("%sdphiMET_jdown"   , prefix_.c_str()) , &dphiMET_jdown);
     tree->Branch(Form("%sdphiMET_rl"   , prefix_.c_str()) , &dphiMET_rl);
-    tree->Branch(Form("%sdphiMET_rl_jup"   , prefix_.c_str()) , &dphiMET_rl_jup);
-    tree->Branch(Form("%sdphiMET_rl_jdown"   , prefix_.c_str()) , &dphiMET_rl_jdown);
+    jtree->Branch(Form("%sdphiMET_rl_jup"   , prefix_.c_str()) , &dphiMET_rl_jup);
+    jtree->Branch(Form("%sdphiMET_rl_jdown"   , prefix_.c_str()) , &dphiMET_rl_jdown);
 
 }
 
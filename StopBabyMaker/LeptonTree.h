@@ -21,7 +21,8 @@ public:
     virtual ~LeptonTree () {}
 
     void Reset ();
-    void SetBranches (TTree* tree);
+    // The JES varied branches go to jestree if one is given
+    void SetBranches (TTree* tree, TTree* jestree = nullptr);
     void SetBranches_electronID(TTree* tree);
     void SetBranches_Iso(TTree* tree);
     void SetBranches_SynchTools (TTree* tree);
@@ -4,6 +4,7 @@
 #include <algorithm>
 
 #include "TopCandTree.h"
+#include "../../StopCORE/KinematicsCache.h"
 #include "TH1.h"
 #include "TFile.h"
 #include "TMath.h"
@@ -232,18 +233,13 @@ int TopCandTree::FillTreeFromGenTop() {
     if (verbose && alljets_p4->size() > 63) cout << __FILE__ << ":" << __LINE__ << ": We have a super large jet vector!! jets_p4->size()= " << jets_p4->size() << endl;
     // Sort genq_fromtop first to put the b quark from top at first
     std::sort(genq_fromtop.begin(), genq_fromtop.end(), [&](int q1, int q2) { return abs(genps_motherid->at(q1)) == 6; });
+    kinem::EtaPhiCache jetcache(*alljets_p4);
     for (int q : genq_fromtop) {
       int genqid = genps_id->at(q);
-      int jetidx = -1;
       float minDR = 0.6;
-      for (size_t j = 0; j < alljets_p4->size(); ++j) {
-        if (alljets_partonid->at(j) != genqid) continue;  // use genjet info to narrow down
-        float dr = 1;
-        if (isCloseObject(alljets_p4->at(j), genps_p4->at(q), 0.6, &dr) && dr < minDR) {
-          minDR = dr;
-          jetidx = j;
-        }
-      }
+      // use genjet info to narrow down
+      int jetidx = jetcache.Closest(genps_p4->at(q).eta(), genps_p4->at(q).phi(), 0.6, &minDR,
+                                    [&](size_t j) { return alljets_partonid->at(j) == genqid; });
       if (minDR < 0.6 && !(matchedjetidx & 1<<jetidx)) {
         matchedjetidx |= 1<<jetidx;
         jets_fromtop.push_back(jetidx);
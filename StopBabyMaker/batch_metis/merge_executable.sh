@@ -75,6 +75,10 @@ for in_file in ${OUTPUTNAME}*.root; do
 done
 # rename skimmed_merged skimmed *.root
 
+# Catalog of the entries and the sample of the outputs, so the looper jobs don't open every file for them
+root -l -n -b -q makeBabyCatalog.C'("'${OUTPUTNAME}'*.root", "catalog_'${OUTPUTNAME}'.txt")'
+root -l -n -b -q makeBabyCatalog.C'("skimmed_*.root", "catalog_skimmed_'${OUTPUTNAME}'.txt", "skimmed_")'
+
 echo ----------------------------------------------
 ls -ltrha
 echo ----------------------------------------------
@@ -120,5 +124,8 @@ for skimout in skimmed_*.root; do
     gfal-copy -p -f -t 4200 --verbose file://`pwd`/$skimout gsiftp://gftp.t2.ucsd.edu${skimout_folder}/${skimout:8} --checksum ADLER32
 done
 
+gfal-copy -p -f -t 4200 --verbose file://`pwd`/catalog_${OUTPUTNAME}.txt gsiftp://gftp.t2.ucsd.edu${mergeout_folder}/catalog_${OUTPUTNAME}.txt
+gfal-copy -p -f -t 4200 --verbose file://`pwd`/catalog_skimmed_${OUTPUTNAME}.txt gsiftp://gftp.t2.ucsd.edu${skimout_folder}/catalog_${OUTPUTNAME}.txt
+
 echo -e "\n--- cleaning up ---\n" #                             <----- section division
-rm -r *.root
+rm -r *.root catalog_*.txt
@@ -29,7 +29,7 @@ tar -czf input.tar.gz input
 
 if [ ! -f merge_scripts.tar.gz ]; then
     echo "[setup] Making tarfile for merge scripts."
-    tar -czf merge_scripts.tar.gz mergeHadoopFiles.C ../skimBaby.C
+    tar -czf merge_scripts.tar.gz mergeHadoopFiles.C ../skimBaby.C makeBabyCatalog.C
 fi
 
 # Flag for successful environment setup
@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+# Summarize the JSON-lines telemetry written by runBabyMaker (telemetry=<file>) or
+# runStopLooper (--telemetry=<file>), and flag the jobs that are falling behind.
+# Usage: python watchTelemetry.py [--follow] [--slow=0.3] [--stale=600] file1.jsonl [file2.jsonl ...]
+
+from __future__ import print_function
+
+import os
+import sys
+import time
+import json
+import argparse
+
+
+def read_last_records(fnames):
+    ''' Return the latest record per job from all given files '''
+    latest = {}
+    for fname in fnames:
+        if not os.path.isfile(fname): continue
+        with open(fname) as f:
+            for line in f:
+                try:
+                    rec = json.loads(line)
+                except ValueError:
+                    continue  # the last line may still be being written
+                latest[(fname, rec['job'])] = rec
+    return latest
+
+
+def print_summary(latest, slow_frac, stale_sec):
+    if not latest:
+        print('No telemetry record found yet.')
+        return
+
+    rates = sorted(r['rate'] for r in latest.values() if not r['final'])
+    median = rates[len(rates)//2] if rates else 0
+    now = time.time()
+
+    print('{:<40} {:>12} {:>10} {:>10} {:>9} {:>9}  {:<30} {}'.format('job', 'events', 'rate', 'avg', 'MB read', 'RSS MB', 'stages', 'status'))
+    for (fname, job), r in sorted(latest.items(), key=lambda x: x[1]['rate']):
+        status = 'done' if r['final'] else 'running'
+        if not r['final']:
+            if now - r['time'] > stale_sec:
+                status = 'STALE ({:.0f}s)'.format(now - r['time'])
+            elif median > 0 and r['rate'] < slow_frac * median:
+                status = 'SLOW'
+        stages = ' '.join('{}:{:.0%}'.format(k, v) for k, v in sorted(r['stages'].items()) if v > 0.01)
+        print('{:<40} {:>12} {:>10.1f} {:>10.1f} {:>9.0f} {:>9.0f}  {:<30} {}'.format(
+            os.path.basename(job)[-40:], r['events'], r['rate'], r['rate_avg'], r['bytes_read']/1e6, r['rss_mb'], stages, status))
+        if status not in ['done', 'running']:
+            print('    current file: {}'.format(r['file']))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('files', nargs='+', help='telemetry files to watch')
+    parser.add_argument('--follow', action='store_true', help='keep refreshing the summary')
+    parser.add_argument('--interval', type=float, default=60, help='refresh interval in seconds with --follow')
+    parser.add_argument('--slow', type=float, default=0.3, help='flag jobs running slower than this fraction of the median rate')
+    parser.add_argument('--stale', type=float, default=600, help='flag jobs without a new record for this many seconds')
+    args = parser.parse_args()
+
+    while True:
+        print_summary(read_last_records(args.files), args.slow, args.stale)
+        if not args.follow: break
+        sys.stdout.flush()
+        time.sleep(args.interval)
+        print()
@@ -0,0 +1,414 @@
+// Compare two babies branch by branch, for the validation of a new baby version against the previous one.
+//
+// The events of the two babies are matched by (run, ls, evt), so the babies don't need to have the same
+// order or the same events. Every branch common to both is then compared column by column over the matched
+// events, the branches being spread over several threads, each with its own copy of the files. Scalars,
+// vectors and LorentzVectors (compared by their px, py, pz and E) of floating point types agree if they
+// are within the tolerances, |a-b| <= atol + rtol*max(|a|,|b|), the integer and boolean ones must be equal.
+// A vector of a different size is a mismatch. The tool prints, for each branch with mismatches, the fraction
+// of the matched events that differ and the largest difference, with the event it is found in, or the first
+// event with a different size. The exit code is 2 if the babies differ in any way, i.e. duplicated events,
+// events or branches only in one of them, branches of a changed type or with mismatches, so that it can be
+// run over a whole campaign by a script, and 1 on errors.
+//
+// Usage: ./compareBabies old.root new.root [--threads=4] [--rtol=1e-6] [--atol=0] [--branches=<p1,p2,...>] [--all]
+//   --branches   only compare the branches matching these wildcard patterns
+//   --all        also list the branches without mismatches
+
+// C++
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <unordered_map>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <fnmatch.h>
+
+// ROOT
+#include "TROOT.h"
+#include "TFile.h"
+#include "TTree.h"
+#include "TBranch.h"
+#include "TClass.h"
+#include "TDataType.h"
+#include "TStopwatch.h"
+#include "Math/Vector4D.h"
+
+using namespace std;
+
+typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > LorentzVector;
+
+struct Options {
+  double rtol = 1e-6;
+  double atol = 0;
+};
+
+struct EventId {
+  unsigned int run;
+  unsigned int ls;
+  unsigned int evt;
+  bool operator==(const EventId& o) const { return run == o.run && ls == o.ls && evt == o.evt; }
+};
+
+struct EventIdHash {
+  size_t operator()(const EventId& id) const { return hash<unsigned long long>()(((unsigned long long) id.run << 32) ^ ((unsigned long long) id.ls << 20) ^ id.evt); }
+};
+
+struct BranchResult {
+  string name;
+  string type;
+  string skipped;          // reason the branch was not compared
+  Long64_t compared = 0;
+  Long64_t mismatched = 0;
+  Long64_t sizeMismatched = 0;
+  double maxDiff = 0;      // largest absolute difference of a value
+  double maxRelDiff = 0;   // relative difference of the same value
+  size_t worstEvent = 0;   // index in the matched events
+  double worstA = 0;
+  double worstB = 0;
+  size_t firstSizeEvent = 0;  // index in the matched events of the first size mismatch
+  size_t firstSizeA = 0;
+  size_t firstSizeB = 0;
+};
+
+// The values of an entry as a flat list of doubles
+template<class T> void flatten(const T& x, vector<double>& out) { out.push_back((double) x); }
+void flatten(const LorentzVector& p4, vector<double>& out) {
+  out.push_back(p4.px());
+  out.push_back(p4.py());
+  out.push_back(p4.pz());
+  out.push_back(p4.E());
+}
+template<class T> void flatten(const vector<T>& v, vector<double>& out) { for (const auto& x : v) flatten((T) x, out); }
+
+template<class T> size_t nitems(const T&) { return 1; }
+template<class T> size_t nitems(const vector<T>& v) { return v.size(); }
+
+template<class T> struct IsExact : is_integral<T> {};
+template<class T> struct IsExact<vector<T>> : IsExact<T> {};
+
+class BranchComparer {
+ public:
+  virtual ~BranchComparer() {}
+  virtual void Connect(TBranch* b1, TBranch* b2) = 0;
+  virtual void Compare(Long64_t e1, Long64_t e2, size_t ievent, const Options& opts, BranchResult& result) = 0;
+};
+
+template<class T> class TypedComparer : public BranchComparer {
+ public:
+  TypedComparer() : v1_(), v2_(), p1_(&v1_), p2_(&v2_), b1_(nullptr), b2_(nullptr) {}
+
+  void Connect(TBranch* b1, TBranch* b2) override {
+    b1_ = b1;
+    b2_ = b2;
+    // The objects are set through a pointer to their pointer
+    if (is_fundamental<T>::value) {
+      b1->SetAddress(p1_);
+      b2->SetAddress(p2_);
+    } else {
+      b1->SetAddress(&p1_);
+      b2->SetAddress(&p2_);
+    }
+  }
+
+  void Compare(Long64_t e1, Long64_t e2, size_t ievent, const Options& opts, BranchResult& result) override {
+    b1_->GetEntry(e1);
+    b2_->GetEntry(e2);
+    values1_.clear();
+    values2_.clear();
+    flatten(*p1_, values1_);
+    flatten(*p2_, values2_);
+
+    ++result.compared;
+    if (values1_.size() != values2_.size()) {
+      ++result.mismatched;
+      if (result.sizeMismatched++ == 0) {
+        result.firstSizeEvent = ievent;
+        result.firstSizeA = nitems(*p1_);
+        result.firstSizeB = nitems(*p2_);
+      }
+      return;
+    }
+    bool mismatch = false;
+    for (size_t i = 0; i < values1_.size(); ++i) {
+      const double a = values1_[i];
+      const double b = values2_[i];
+      if (a == b || (std::isnan(a) && std::isnan(b))) continue;
+      const double diff = fabs(a - b);
+      if (IsExact<T>::value || std::isnan(diff) || diff > opts.atol + opts.rtol * max(fabs(a), fabs(b))) mismatch = true;
+      if (diff > result.maxDiff || (std::isnan(diff) && !std::isnan(result.maxDiff))) {
+        result.maxDiff = diff;
+        result.maxRelDiff = diff / max(fabs(a), fabs(b));
+        result.worstEvent = ievent;
+        result.worstA = a;
+        result.worstB = b;
+      }
+    }
+    if (mismatch) ++result.mismatched;
+  }
+
+ private:
+  T v1_;
+  T v2_;
+  T* p1_;
+  T* p2_;
+  TBranch* b1_;
+  TBranch* b2_;
+  vector<double> values1_;
+  vector<double> values2_;
+};
+
+const string kLorentzVectorName = "ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> >";
+
+string branchType(TBranch* branch) {
+  TClass* cl = nullptr;
+  EDataType type = kOther_t;
+  branch->GetExpectedType(cl, type);
+  if (cl) return cl->GetName();
+  TDataType* dt = TDataType::GetDataType(type);
+  return (dt)? dt->GetTypeName() : "unknown";
+}
+
+// The comparer for the type of the branch, null if the type is not supported
+BranchComparer* makeComparer(const string& type) {
+  if (type == "bool") return new TypedComparer<bool>;
+  if (type == "int") return new TypedComparer<int>;
+  if (type == "unsigned int") return new TypedComparer<unsigned int>;
+  if (type == "Long64_t" || type == "long long") return new TypedComparer<Long64_t>;
+  if (type == "ULong64_t" || type == "unsigned long long") return new TypedComparer<ULong64_t>;
+  if (type == "float") return new TypedComparer<float>;
+  if (type == "double") return new TypedComparer<double>;
+  if (type == kLorentzVectorName) return new TypedComparer<LorentzVector>;
+  if (type == "vector<bool>") return new TypedComparer<vector<bool>>;
+  if (type == "vector<int>") return new TypedComparer<vector<int>>;
+  if (type == "vector<unsigned int>") return new TypedComparer<vector<unsigned int>>;
+  if (type == "vector<float>") return new TypedComparer<vector<float>>;
+  if (type == "vector<double>") return new TypedComparer<vector<double>>;
+  if (type == "vector<" + kLorentzVectorName + " >") return new TypedComparer<vector<LorentzVector>>;
+  return nullptr;
+}
+
+vector<EventId> readEventIds(TTree* tree) {
+  EventId id;
+  TBranch* run = tree->GetBranch("run");
+  TBranch* ls = tree->GetBranch("ls");
+  TBranch* evt = tree->GetBranch("evt");
+  if (!run || !ls || !evt)
+    throw invalid_argument(string("[compareBabies] The tree of ") + tree->GetCurrentFile()->GetName() + " has no run/ls/evt branches!");
+  run->SetAddress(&id.run);
+  ls->SetAddress(&id.ls);
+  evt->SetAddress(&id.evt);
+  vector<EventId> ids(tree->GetEntries());
+  for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+    run->GetEntry(i);
+    ls->GetEntry(i);
+    evt->GetEntry(i);
+    ids[i] = id;
+  }
+  tree->ResetBranchAddresses();
+  return ids;
+}
+
+TTree* openTree(const string& fname, unique_ptr<TFile>& file) {
+  file.reset(TFile::Open(fname.c_str()));
+  if (!file || file->IsZombie()) throw invalid_argument("[compareBabies] Cannot open " + fname + "!");
+  TTree* tree = (TTree*) file->Get("t");
+  if (!tree) throw invalid_argument("[compareBabies] No tree t in " + fname + "!");
+  return tree;
+}
+
+// Index the events by their id, printing the ids found more than once, of which only the first event is
+// compared, and return the number of duplicates
+size_t indexEventIds(const vector<EventId>& ids, const string& fname, unordered_map<EventId,Long64_t,EventIdHash>& index) {
+  const size_t nprint = 10;
+  size_t nduplicates = 0;
+  index.reserve(ids.size());
+  for (size_t i = 0; i < ids.size(); ++i) {
+    auto inserted = index.emplace(ids[i], i);
+    if (inserted.second) continue;
+    if (nduplicates++ < nprint)
+      cout << "[compareBabies] >> Duplicate event " << ids[i].run << ":" << ids[i].ls << ":" << ids[i].evt << " in " << fname
+           << ", entries " << inserted.first->second << " and " << i << endl;
+  }
+  if (nduplicates > nprint) cout << "[compareBabies] >> ... " << nduplicates - nprint << " more duplicate events in " << fname << endl;
+  return nduplicates;
+}
+
+vector<string> splitList(const string& list) {
+  vector<string> items;
+  istringstream iss(list);
+  string item;
+  while (getline(iss, item, ',')) if (!item.empty()) items.push_back(item);
+  return items;
+}
+
+int compareBabies(int argc, char** argv) {
+  if (argc < 3) {
+    cout << "Usage: ./compareBabies old.root new.root [--threads=4] [--rtol=1e-6] [--atol=0] [--branches=<p1,p2,...>] [--all]" << endl;
+    return 1;
+  }
+
+  string fname1 = argv[1];
+  string fname2 = argv[2];
+  unsigned int nthreads = 4;
+  vector<string> patterns;
+  bool printAll = false;
+  Options opts;
+  for (int i = 3; i < argc; ++i) {
+    string arg = argv[i];
+    if (arg.find("--threads=") == 0) nthreads = max(1, stoi(arg.substr(10)));
+    else if (arg.find("--rtol=") == 0) opts.rtol = stod(arg.substr(7));
+    else if (arg.find("--atol=") == 0) opts.atol = stod(arg.substr(7));
+    else if (arg.find("--branches=") == 0) patterns = splitList(arg.substr(11));
+    else if (arg == "--all") printAll = true;
+    else throw invalid_argument("[compareBabies] Unknown option " + arg + "!");
+  }
+
+  ROOT::EnableThreadSafety();
+  TStopwatch timer;
+
+  // Match the events of the two babies
+  unique_ptr<TFile> file1, file2;
+  TTree* tree1 = openTree(fname1, file1);
+  TTree* tree2 = openTree(fname2, file2);
+  vector<EventId> ids1 = readEventIds(tree1);
+  vector<EventId> ids2 = readEventIds(tree2);
+  unordered_map<EventId,Long64_t,EventIdHash> index1, index2;
+  const size_t nduplicates1 = indexEventIds(ids1, fname1, index1);
+  const size_t nduplicates2 = indexEventIds(ids2, fname2, index2);
+  vector<pair<Long64_t,Long64_t>> matched;
+  matched.reserve(index1.size());
+  for (size_t i = 0; i < ids1.size(); ++i) {
+    if (index1[ids1[i]] != (Long64_t) i) continue;  // duplicate
+    auto it = index2.find(ids1[i]);
+    if (it != index2.end()) matched.emplace_back(i, it->second);
+  }
+  // Counted over the distinct ids, each matched at most once
+  const size_t nonlyOldEvents = index1.size() - matched.size();
+  const size_t nonlyNewEvents = index2.size() - matched.size();
+  cout << "[compareBabies] >> " << ids1.size() << " events in " << fname1 << ", " << ids2.size() << " in " << fname2
+       << ", " << matched.size() << " matched" << endl;
+  cout << "[compareBabies] >> Duplicate events in the old baby: " << nduplicates1 << ", in the new baby: " << nduplicates2 << endl;
+  cout << "[compareBabies] >> Events only in the old baby: " << nonlyOldEvents << ", only in the new baby: " << nonlyNewEvents << endl;
+
+  // The branches to compare
+  int nonlyOld = 0, nonlyNew = 0, ntypeChanged = 0;
+  vector<BranchResult> results;
+  TObjArray* branches1 = tree1->GetListOfBranches();
+  for (int i = 0; i < branches1->GetEntriesFast(); ++i) {
+    TBranch* branch1 = (TBranch*) branches1->At(i);
+    string name = branch1->GetName();
+    if (!patterns.empty() && none_of(patterns.begin(), patterns.end(), [&](const string& p) { return fnmatch(p.c_str(), name.c_str(), 0) == 0; })) continue;
+    TBranch* branch2 = tree2->GetBranch(name.c_str());
+    if (!branch2) {
+      cout << "[compareBabies] >> Branch only in the old baby: " << name << endl;
+      ++nonlyOld;
+      continue;
+    }
+    BranchResult result;
+    result.name = name;
+    result.type = branchType(branch1);
+    if (result.type != branchType(branch2)) {
+      result.skipped = "type changed to " + branchType(branch2);
+      ++ntypeChanged;
+    }
+    else if (!unique_ptr<BranchComparer>(makeComparer(result.type))) result.skipped = "type not supported";
+    results.push_back(result);
+  }
+  TObjArray* branches2 = tree2->GetListOfBranches();
+  for (int i = 0; i < branches2->GetEntriesFast(); ++i) {
+    const char* name = branches2->At(i)->GetName();
+    if (!patterns.empty() && none_of(patterns.begin(), patterns.end(), [&](const string& p) { return fnmatch(p.c_str(), name, 0) == 0; })) continue;
+    if (tree1->GetBranch(name)) continue;
+    cout << "[compareBabies] >> Branch only in the new baby: " << name << endl;
+    ++nonlyNew;
+  }
+  file1.reset();
+  file2.reset();
+
+  // Each thread takes the next branch to compare, with its own copy of the files
+  atomic<size_t> next(0);
+  vector<string> errors(nthreads);
+  auto work = [&](unsigned int ithread) {
+    try {
+      unique_ptr<TFile> f1, f2;
+      TTree* t1 = openTree(fname1, f1);
+      TTree* t2 = openTree(fname2, f2);
+      for (size_t ib = next++; ib < results.size(); ib = next++) {
+        BranchResult& result = results[ib];
+        if (!result.skipped.empty()) continue;
+        TBranch* b1 = t1->GetBranch(result.name.c_str());
+        TBranch* b2 = t2->GetBranch(result.name.c_str());
+        unique_ptr<BranchComparer> comparer(makeComparer(result.type));
+        comparer->Connect(b1, b2);
+        for (size_t ie = 0; ie < matched.size(); ++ie)
+          comparer->Compare(matched[ie].first, matched[ie].second, ie, opts, result);
+        t1->ResetBranchAddresses();
+        t2->ResetBranchAddresses();
+        b1->DropBaskets("all");
+        b2->DropBaskets("all");
+      }
+    } catch (exception& e) {
+      errors[ithread] = e.what();
+      next = results.size();
+    }
+  };
+  vector<thread> threads;
+  for (unsigned int i = 0; i < nthreads; ++i) threads.emplace_back(work, i);
+  for (thread& t : threads) t.join();
+  for (const string& error : errors) if (!error.empty()) throw runtime_error(error);
+
+  // Report, the branches with the most mismatches first
+  sort(results.begin(), results.end(), [](const BranchResult& a, const BranchResult& b) {
+      return (a.mismatched != b.mismatched)? a.mismatched > b.mismatched : a.name < b.name; });
+  int nmismatched = 0, nskipped = 0;
+  cout << endl << left << setw(40) << "branch" << right << setw(12) << "mismatch" << setw(10) << "size"
+       << setw(14) << "max diff" << setw(12) << "rel diff" << "   worst event (run:ls:evt) old -> new" << endl;
+  for (const BranchResult& result : results) {
+    if (!result.skipped.empty()) {
+      ++nskipped;
+      cout << left << setw(40) << result.name << right << "   skipped, " << result.skipped << " (" << result.type << ")" << endl;
+      continue;
+    }
+    if (result.mismatched > 0) ++nmismatched;
+    else if (!printAll) continue;
+    const double rate = (result.compared > 0)? (double) result.mismatched / result.compared : 0;
+    cout << left << setw(40) << result.name << right << setw(11) << setprecision(4) << 100*rate << "%"
+         << setw(10) << result.sizeMismatched << setw(14) << setprecision(6) << result.maxDiff << setw(12) << setprecision(3) << result.maxRelDiff;
+    if (result.maxDiff > 0) {
+      const EventId& id = ids1[matched[result.worstEvent].first];
+      cout << "   " << id.run << ":" << id.ls << ":" << id.evt << " " << setprecision(8) << result.worstA << " -> " << result.worstB;
+    } else if (result.sizeMismatched > 0) {
+      const EventId& id = ids1[matched[result.firstSizeEvent].first];
+      cout << "   " << id.run << ":" << id.ls << ":" << id.evt << " size " << result.firstSizeA << " -> " << result.firstSizeB;
+    }
+    cout << endl;
+  }
+  timer.Stop();
+  cout << endl << "[compareBabies] >> " << results.size() - nskipped << " branches compared, " << nmismatched << " with mismatches, "
+       << nskipped << " skipped, in " << timer.RealTime() << " s with " << nthreads << " threads" << endl;
+  const bool differ = nmismatched > 0 || ntypeChanged > 0 || nonlyOld > 0 || nonlyNew > 0 || nonlyOldEvents > 0 || nonlyNewEvents > 0
+      || nduplicates1 > 0 || nduplicates2 > 0;
+  if (differ)
+    cout << "[compareBabies] >> The babies differ: " << nmismatched << " branches with mismatches, " << ntypeChanged << " with a changed type, "
+         << nonlyOld << " only in the old baby, " << nonlyNew << " only in the new baby, "
+         << nonlyOldEvents << " + " << nonlyNewEvents << " events only in the old + new baby, and "
+         << nduplicates1 << " + " << nduplicates2 << " duplicate events in the old + new baby" << endl;
+  return (differ)? 2 : 0;
+}
+
+int main(int argc, char** argv) {
+  try {
+    return compareBabies(argc, argv);
+  } catch (exception& e) {
+    cerr << e.what() << endl;
+    return 1;
+  }
+}
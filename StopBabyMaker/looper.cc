@@ -37,6 +37,8 @@
 
 // StopCORE
 #include "../StopCORE/eventWeight_lepSF.h"
+#include "../StopCORE/TriggerWord.h"
+#include "../StopCORE/KinematicsCache.h"
 
 // CORE/Tools
 #include "goodrun.h"
@@ -132,32 +134,38 @@ void babyMaker::MakeBabyNtuple(const char* output_name){
 
   BabyFile = new TFile(Form("%s/%s", babypath, output_name), "RECREATE");
   BabyTree = new TTree("t", "Stop2017 Baby Ntuple");
+  // The JES varied branches optionally go to a friend tree with the same entries, so that the
+  // jobs not looking at the JES variations don't read them
+  JESTree = (splitJES)? new TTree("t_jes", "Stop2017 Baby Ntuple, JES variations") : BabyTree;
 
-  StopEvt.SetBranches(BabyTree);
-  lep1.SetBranches(BabyTree);
-  lep2.SetBranches(BabyTree);
+  // The four-vector collections registered with p4writer are written as float columns if splitP4
+  p4writer.SetSplit(splitP4);
+
+  StopEvt.SetBranches(BabyTree, JESTree);
+  lep1.SetBranches(BabyTree, JESTree);
+  lep2.SetBranches(BabyTree, JESTree);
   ph.SetBranches(BabyTree);
-  jets.SetAK4Branches(BabyTree);
-  jets_jup.SetAK4Branches(BabyTree);
-  jets_jdown.SetAK4Branches(BabyTree);
+  jets.SetAK4Branches(BabyTree, &p4writer);
+  jets_jup.SetAK4Branches(JESTree, &p4writer);
+  jets_jdown.SetAK4Branches(JESTree, &p4writer);
   // Taus.SetBranches(BabyTree);
   // Tracks.SetBranches(BabyTree);
-  gen_leps.SetBranches(BabyTree);
-  gen_nus.SetBranches(BabyTree);
-  gen_qs.SetBranches(BabyTree);
-  gen_bosons.SetBranches(BabyTree);
-  gen_susy.SetBranches(BabyTree);
+  gen_leps.SetBranches(BabyTree, &p4writer);
+  gen_nus.SetBranches(BabyTree, &p4writer);
+  gen_qs.SetBranches(BabyTree, &p4writer);
+  gen_bosons.SetBranches(BabyTree, &p4writer);
+  gen_susy.SetBranches(BabyTree, &p4writer);
 
   //optional
   if(fillAK8){
-    jets.SetAK8Branches(BabyTree);
-    jets_jup.SetAK8Branches(BabyTree);
-    jets_jdown.SetAK8Branches(BabyTree);
+    jets.SetAK8Branches(BabyTree, &p4writer);
+    jets_jup.SetAK8Branches(JESTree, &p4writer);
+    jets_jdown.SetAK8Branches(JESTree, &p4writer);
   }
   if(fillTopTag){
-    jets.SetAK4Branches_TopTag(BabyTree);
-    jets_jup.SetAK4Branches_TopTag(BabyTree);
-    jets_jdown.SetAK4Branches_TopTag(BabyTree);
+    jets.SetAK4Branches_TopTag(BabyTree, &p4writer);
+    jets_jup.SetAK4Branches_TopTag(JESTree, &p4writer);
+    jets_jdown.SetAK4Branches_TopTag(JESTree, &p4writer);
 
     // Setup MVA Reader TopTagging for 
     // ResolvedTopMVA* resTopMVAptr =  new ResolvedTopMVA("ResTopTagger/resTop_xGBoost_v0.weights.xml", "BDT");
@@ -172,7 +180,7 @@ void babyMaker::MakeBabyNtuple(const char* output_name){
 
   if(fillZll)  StopEvt.SetZllBranches(BabyTree);
   if(fillPhoton) StopEvt.SetPhotonBranches(BabyTree);
-  if(fillMETfilt) StopEvt.SetMETFilterBranches(BabyTree);
+  if(fillMETfilt) StopEvt.SetMETFilterBranches(BabyTree, JESTree);
   if(fill2ndlep) StopEvt.SetSecondLepBranches(BabyTree);
   if(fillExtraEvtVar) StopEvt.SetExtraVariablesBranches(BabyTree);
 
@@ -202,6 +210,13 @@ void babyMaker::MakeBabyNtuple(const char* output_name){
   //gen_zs.SetBranches(BabyTree);
   //gen_phs.SetBranches(BabyTree);
   //gen_hs.SetBranches(BabyTree);
+
+  // Reduced precision of the float branches in the profile, once all the branches are registered
+  if (!precisionProfile.empty()) {
+    precision.Load(precisionProfile);
+    precision.Attach(BabyTree);
+    if (JESTree != BabyTree) precision.Attach(JESTree);
+  }
 }
 
 void babyMaker::InitBabyNtuple(){
@@ -265,6 +280,13 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
   TBenchmark *bmark = new TBenchmark();
   bmark->Start("benchmark");
 
+  if (!telemetryFile.empty()) telemetry.Open(telemetryFile, output_name);
+  const int kStageSetup = telemetry.AddStage("setup");
+  const int kStageProcess = telemetry.AddStage("process");
+  const int kStageFill = telemetry.AddStage("fill");
+  const int kStageWrite = telemetry.AddStage("write");
+  telemetry.SwitchStage(kStageSetup);
+
   //
   //Set up loop over chain
   //
@@ -631,6 +653,8 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
     // Get File Content
     //
     if(nEvents_processed >= nEventsToDo) continue;
+    telemetry.SwitchStage(kStageSetup);
+    telemetry.SetCurrentFile(currentFile->GetTitle());
     TFile* file = TFile::Open( currentFile->GetTitle() );
     TTree *tree = (TTree*)file->Get("Events");
     cms3.Init(tree);
@@ -661,6 +685,8 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
       // Progress
       //
       CMS3::progress(nEvents_processed, nEventsToDo);
+      telemetry.SwitchStage(kStageProcess);
+      telemetry.Update(nEvents_processed);
 
       //
       // Intialize Baby NTuple Branches
@@ -1199,15 +1225,20 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
       sort(VetoLeps.begin(),VetoLeps.end(),sortLepbypt());
 
       if(GoodLeps.size()>0){
-        for(unsigned int lep = 1; lep<GoodLeps.size(); lep++){
-          if(ROOT::Math::VectorUtil::DeltaR(GoodLeps.at(0).p4,GoodLeps.at(lep).p4)<0.01) GoodLeps.erase(GoodLeps.begin()+lep);
-        }
-        for(unsigned int lep = 0; lep<LooseLeps.size(); lep++){
-          if(ROOT::Math::VectorUtil::DeltaR(GoodLeps.at(0).p4,LooseLeps.at(lep).p4)<0.01) LooseLeps.erase(LooseLeps.begin()+lep);
-        }
-        for(unsigned int lep = 0; lep<VetoLeps.size(); lep++){
-          if(ROOT::Math::VectorUtil::DeltaR(GoodLeps.at(0).p4,VetoLeps.at(lep).p4)<0.01) VetoLeps.erase(VetoLeps.begin()+lep);
-        }
+        // Remove the duplicates of the leading lepton, within dR < 0.01 of it
+        const float lead_eta = GoodLeps.at(0).p4.eta();
+        const float lead_phi = GoodLeps.at(0).p4.phi();
+        auto removeDuplicates = [&](vector<Lepton>& leps, size_t first) {
+          size_t nkept = first;
+          for(size_t lep = first; lep<leps.size(); lep++){
+            if(kinem::deltaR2(lead_eta, lead_phi, leps[lep].p4.eta(), leps[lep].p4.phi()) < 0.01*0.01) continue;
+            leps[nkept++] = leps[lep];
+          }
+          leps.resize(nkept);
+        };
+        removeDuplicates(GoodLeps, 1);
+        removeDuplicates(LooseLeps, 0);
+        removeDuplicates(VetoLeps, 0);
       }
       nGoodLeptons = GoodLeps.size();
       int nLooseLeptons = GoodLeps.size() + LooseLeps.size();//use for Zll
@@ -1225,6 +1256,11 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
       if( nVetoLeptons > 0 ) lep1.FillCommon( AllLeps.at(0).id, AllLeps.at(0).idx );
       if( nVetoLeptons > 1 ) lep2.FillCommon( AllLeps.at(1).id, AllLeps.at(1).idx );
 
+      // Eta/phi of the selected leptons, for the overlap removal of the tracks
+      kinem::EtaPhiCache vetolepcache;
+      if( nVetoLeptons > 0 ) vetolepcache.PushBack(lep1.p4);
+      if( nVetoLeptons > 1 ) vetolepcache.PushBack(lep2.p4);
+
       //fill lep-dphi
       if( nVetoLeptons > 0 ) {
         lep1.dphiMET = getdphi(lep1.p4.Phi(),StopEvt.pfmet_phi);
@@ -1620,15 +1656,13 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
       }
 
       // FastSim filter, Nominal Jets
+      kinem::EtaPhiCache genjetcache;
       bool fastsimfilt = false;
+      genjetcache.Fill(jets.ak4genjets_p4);
       for(unsigned int jix = 0; jix<jets.ak4pfjets_p4.size();++jix){
         if(jets.ak4pfjets_p4[jix].Pt()<30) continue;
         if(fabs(jets.ak4pfjets_p4[jix].Eta())>2.4) continue;
-        bool isgenmatch = false;
-        for(unsigned int gix = 0; gix<jets.ak4genjets_p4.size();++gix){
-          if(dRbetweenVectors(jets.ak4genjets_p4[gix],jets.ak4pfjets_p4[jix])<0.3) { isgenmatch = true; break; }
-        }
-        if(isgenmatch) continue;
+        if(genjetcache.AnyWithin(jets.ak4pfjets_p4[jix], 0.3)) continue;
         if(jets.ak4pfjets_chf[jix]>0.1) continue;
         fastsimfilt = true;
         break;
@@ -1637,14 +1671,11 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
 
       // FastSim filter, JESup Jets
       bool fastsimfilt_jup = false;
+      genjetcache.Fill(jets_jup.ak4genjets_p4);
       for(unsigned int jix = 0; jix<jets_jup.ak4pfjets_p4.size();++jix){
         if(jets_jup.ak4pfjets_p4[jix].Pt()<30) continue;
         if(fabs(jets_jup.ak4pfjets_p4[jix].Eta())>2.4) continue;
-        bool isgenmatch = false;
-        for(unsigned int gix = 0; gix<jets_jup.ak4genjets_p4.size();++gix){
-          if(dRbetweenVectors(jets_jup.ak4genjets_p4[gix],jets_jup.ak4pfjets_p4[jix])<0.3) { isgenmatch = true; break; }
-        }
-        if(isgenmatch) continue;
+        if(genjetcache.AnyWithin(jets_jup.ak4pfjets_p4[jix], 0.3)) continue;
         if(jets_jup.ak4pfjets_chf[jix]>0.1) continue;
         fastsimfilt_jup = true;
         break;
@@ -1653,14 +1684,11 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
 
       // FastSim filter, JESdn Jets
       bool fastsimfilt_jdown = false;
+      genjetcache.Fill(jets_jdown.ak4genjets_p4);
       for(unsigned int jix = 0; jix<jets_jdown.ak4pfjets_p4.size();++jix){
         if(jets_jdown.ak4pfjets_p4[jix].Pt()<30) continue;
         if(fabs(jets_jdown.ak4pfjets_p4[jix].Eta())>2.4) continue;
-        bool isgenmatch = false;
-        for(unsigned int gix = 0; gix<jets_jdown.ak4genjets_p4.size();++gix){
-          if(dRbetweenVectors(jets_jdown.ak4genjets_p4[gix],jets_jdown.ak4pfjets_p4[jix])<0.3) { isgenmatch = true; break; }
-        }
-        if(isgenmatch) continue;
+        if(genjetcache.AnyWithin(jets_jdown.ak4pfjets_p4[jix], 0.3)) continue;
         if(jets_jdown.ak4pfjets_chf[jix]>0.1) continue;
         fastsimfilt_jdown = true;
         break;
@@ -1674,12 +1702,14 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
       StopEvt.nPhotons = ph.p4.size();
       if(StopEvt.nPhotons < skim_nPhotons) continue;
       int leadph = -1;//use this in case we have a wide photon selection (like loose id), but want to use specific photon
+      kinem::EtaPhiCache goodlepcache;
+      if(StopEvt.ngoodleps>0) goodlepcache.PushBack(lep1.p4);
+      if(StopEvt.ngoodleps>1) goodlepcache.PushBack(lep2.p4);
       for(unsigned int i = 0; i<ph.p4.size(); ++i){
         int overlapping_jet = getOverlappingJetIndex(ph.p4.at(i), jets.ak4pfjets_p4, 0.4, skim_jet_pt, skim_jet_eta,false,jet_corrector_pfL1FastJetL2L3,applyJECfromFile,jetcorr_uncertainty,JES_type,isFastsim);
         ph.overlapJetId.at(i) = overlapping_jet;
         if(leadph!=-1 && ph.p4.at(i).Pt()<ph.p4.at(leadph).Pt()) continue;
-        if(StopEvt.ngoodleps>0 && ROOT::Math::VectorUtil::DeltaR(ph.p4.at(i), lep1.p4)<0.2) continue;
-        if(StopEvt.ngoodleps>1 && ROOT::Math::VectorUtil::DeltaR(ph.p4.at(i), lep2.p4)<0.2) continue;
+        if(goodlepcache.AnyWithin(ph.p4.at(i), 0.2)) continue;
         leadph = i;
       }
       StopEvt.ph_selectedidx = leadph;
@@ -2123,21 +2153,32 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
         int vetotracks = 0;
         int vetotracks_v2 = 0;
         int vetotracks_v3 = 0;
+
+        // Candidates passing the selections, with their dR^2 to the selected leptons computed in one batch
+        vector<unsigned int> pfsel;
+        kinem::EtaPhiCache pfcache;
         for (unsigned int ipf = 0; ipf < pfcands_p4().size(); ipf++) {
 
           //some selections
           if(pfcands_charge().at(ipf) == 0) continue;
-          if(pfcands_p4().at(ipf).pt() < 5) continue;
-          if(fabs(pfcands_p4().at(ipf).eta()) > 2.4 ) continue;
+          const LorentzVector& pfp4 = pfcands_p4().at(ipf);
+          float pt = pfp4.pt();
+          if(pt < 5) continue;
+          float eta = pfp4.eta();
+          if(fabs(eta) > 2.4 ) continue;
           if(fabs(pfcands_dz().at(ipf)) > 0.1) continue;
+          pfsel.push_back(ipf);
+          pfcache.PushBack(eta, pfp4.phi(), pt);
+        }
+        vector<float> pflepdr2;  // [ilep * pfsel.size() + isel]
+        kinem::deltaR2Matrix(vetolepcache, pfcache, pflepdr2);
+
+        for (size_t isel = 0; isel < pfsel.size(); isel++) {
+          unsigned int ipf = pfsel[isel];
 
           //remove everything that is within 0.1 of selected lead and subleading leptons
-          if(nVetoLeptons>0){
-            if(ROOT::Math::VectorUtil::DeltaR(pfcands_p4().at(ipf), lep1.p4)<0.1) continue;
-          }
-          if(nVetoLeptons>1){
-            if(ROOT::Math::VectorUtil::DeltaR(pfcands_p4().at(ipf), lep2.p4)<0.1) continue;
-          }
+          if(nVetoLeptons>0 && pflepdr2[isel] < 0.1*0.1) continue;
+          if(nVetoLeptons>1 && pflepdr2[pfsel.size() + isel] < 0.1*0.1) continue;
 
           Tracks.FillCommon(ipf);
 
@@ -2192,15 +2233,30 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
       } else {
         // Newer method when isotrack branches are available
         int nIsoTracks = 0;
+
+        // Tracks passing the selections, with their dR^2 to the selected leptons computed in one batch
+        vector<unsigned int> trksel;
+        kinem::EtaPhiCache trkcache;
         for (unsigned int itrk = 0; itrk < isotracks_p4().size(); ++itrk) {
           if (!isotracks_isPFCand().at(itrk)) continue;  // only consider pfcandidates
-          if (isotracks_p4().at(itrk).pt() < 10) continue;
-          if (fabs(isotracks_p4().at(itrk).eta()) > 2.4 ) continue;
+          const LorentzVector& trkp4 = isotracks_p4().at(itrk);
+          float pt = trkp4.pt();
+          if (pt < 10) continue;
+          float eta = trkp4.eta();
+          if (fabs(eta) > 2.4 ) continue;
           if (isotracks_charge().at(itrk) == 0) continue;
           if (fabs(isotracks_dz().at(itrk)) > 0.1) continue;
-          if (isotracks_lepOverlap().at(itrk)) continue;  // should remove all lep overlap, but it didn't, so we need the line below
-          if (nVetoLeptons > 0 && utils::isCloseObject(isotracks_p4().at(itrk), lep1.p4, 0.4)) continue;
-          if (nVetoLeptons > 1 && utils::isCloseObject(isotracks_p4().at(itrk), lep2.p4, 0.4)) continue;
+          if (isotracks_lepOverlap().at(itrk)) continue;  // should remove all lep overlap, but it didn't, so we need the lines below
+          trksel.push_back(itrk);
+          trkcache.PushBack(eta, trkp4.phi(), pt);
+        }
+        vector<float> trklepdr2;  // [ilep * trksel.size() + isel]
+        kinem::deltaR2Matrix(vetolepcache, trkcache, trklepdr2);
+
+        for (size_t isel = 0; isel < trksel.size(); ++isel) {
+          unsigned int itrk = trksel[isel];
+          if (nVetoLeptons > 0 && trklepdr2[isel] < 0.4*0.4) continue;
+          if (nVetoLeptons > 1 && trklepdr2[trksel.size() + isel] < 0.4*0.4) continue;
           if (isotracks_charge().at(itrk) * lep1.charge >= 0) continue; // opposite to lead lepton
 
           Tracks.FillCommon(itrk, 1);
@@ -2596,12 +2652,36 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
         StopEvt.HLT_Photon300_NoHE             = passHLTTriggerPattern("HLT_Photon300_NoHE_v");
       }
 
+      // Pack the HLT decisions into one word, so the looper reads a single branch. The signal samples
+      // have no trigger info and keep -9999 in the HLT branches, which is treated as passing, same as before
+      {
+        using namespace trigword;
+        setBit(StopEvt.HLT_bits, k_MET,                  StopEvt.HLT_MET);
+        setBit(StopEvt.HLT_bits, k_MET_MHT,              StopEvt.HLT_MET_MHT);
+        setBit(StopEvt.HLT_bits, k_MET110_MHT110,        StopEvt.HLT_MET110_MHT110);
+        setBit(StopEvt.HLT_bits, k_MET120_MHT120,        StopEvt.HLT_MET120_MHT120);
+        setBit(StopEvt.HLT_bits, k_SingleEl,             StopEvt.HLT_SingleEl);
+        setBit(StopEvt.HLT_bits, k_SingleMu,             StopEvt.HLT_SingleMu);
+        setBit(StopEvt.HLT_bits, k_DiEl,                 StopEvt.HLT_DiEl);
+        setBit(StopEvt.HLT_bits, k_DiMu,                 StopEvt.HLT_DiMu);
+        setBit(StopEvt.HLT_bits, k_MuE,                  StopEvt.HLT_MuE);
+        setBit(StopEvt.HLT_bits, k_PFHT_unprescaled,     StopEvt.HLT_PFHT_unprescaled);
+        setBit(StopEvt.HLT_bits, k_PFHT_prescaled,       StopEvt.HLT_PFHT_prescaled);
+        setBit(StopEvt.HLT_bits, k_AK8Jet_unprescaled,   StopEvt.HLT_AK8Jet_unprescaled);
+        setBit(StopEvt.HLT_bits, k_AK8Jet_prescaled,     StopEvt.HLT_AK8Jet_prescaled);
+        setBit(StopEvt.HLT_bits, k_CaloJet500_NoJetID,   StopEvt.HLT_CaloJet500_NoJetID);
+      }
+
       ///////////////////////////////////////////////////////////
 
       //
       // Fill Tree
       //
+      telemetry.SwitchStage(kStageFill);
+      p4writer.Fill();
+      if (precision.IsActive()) precision.Apply();
       BabyTree->Fill();
+      if (JESTree != BabyTree) JESTree->Fill();
 
     }//close event loop
     //
@@ -2614,9 +2694,11 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
   //
   // Write and Close baby file
   //
+  telemetry.SwitchStage(kStageWrite);
   BabyFile->cd();
   // save counter histogram
   BabyTree->Write();
+  if (JESTree != BabyTree) JESTree->Write();
   counterhist->Write();
   if(isSignalFromFileName){
     counterhistSig->Write();
@@ -2649,6 +2731,8 @@ int babyMaker::looper(TChain* chain, char* output_name, int nEvents, char* path)
   // Benchmarking
   //
   bmark->Stop("benchmark");
+  telemetry.Close();
+  if (precision.IsActive()) precision.PrintReport();
 
   //
   // Print Skim Cutflow
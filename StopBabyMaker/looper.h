@@ -17,6 +17,9 @@
 #include "TChain.h"
 #include "Math/LorentzVector.h"
 #include "ResTopTagger/TopCandTree.h"
+#include "../StopCORE/JobTelemetry.h"
+#include "../StopCORE/SplitP4.h"
+#include "../StopCORE/PrecisionProfile.h"
 
 // typedefs
 typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > LorentzVector;
@@ -106,15 +109,31 @@ class babyMaker {
 
   bool isFastsim;
 
+  // Write the JES varied branches to the t_jes friend tree instead of the main tree
+  bool splitJES;
+
+  // Write the four-vector collections as px/py/pz/E float columns, see SplitP4.h
+  bool splitP4;
+
   // Flat tree maker for top tagger training
   bool runTopCandTreeMaker;
   TopCandTree* topcandTreeMaker;
 
+  // Optional JSON-lines progress record, written if a file name is given
+  std::string telemetryFile;
+
+  // Optional profile of the float branches to store with reduced precision, see PrecisionProfile.h
+  std::string precisionProfile;
+
  protected:
   TFile* BabyFile;
   TFile* histFile;
   TTree* BabyTree;
+  TTree* JESTree;  // same as BabyTree unless splitJES
   TH1D*  histcounter;
+  JobTelemetry telemetry;
+  SplitP4Writer p4writer;
+  PrecisionProfile precision;
  private:
 
   // Tree Branches
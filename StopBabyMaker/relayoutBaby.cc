@@ -0,0 +1,227 @@
+// Rewrite a baby with the branches the looper reads together next to each other on disk.
+//
+// The babymaker registers the branches in the order of the SetBranches calls, and every cluster is
+// flushed in that order, so the few branches read for every entry end up scattered through the file.
+// Given a branch usage profile (see relayoutProfile.txt) this moves the branches of the profile to the
+// front in its order, sets the cluster size and optionally the compression of each branch, then copies
+// the entries over. The other objects of the file are copied as is. The sizes of both files and the time
+// and read calls to go through the branches of the nominal looper, with a TTreeCache like StopLooper, are
+// reported: the entries after an [order_only] line of the profile are placed but not benchmarked.
+//
+// Usage: ./relayoutBaby input.root output.root [--profile=<file>] [--clusterMB=<MB>|--clusterEntries=<N>]
+//                       [--compress=<setting>] [--compressBranches=<pattern>:<setting>,...] [--noBenchmark]
+
+// C++
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <stdexcept>
+#include <fnmatch.h>
+
+// ROOT
+#include "TFile.h"
+#include "TTree.h"
+#include "TBranch.h"
+#include "TKey.h"
+#include "TObjArray.h"
+#include "TStopwatch.h"
+#include "TTreeCache.h"
+
+using namespace std;
+
+struct ProfileEntry {
+  string pattern;
+  int compression;  // -1 to keep the one of the file
+  bool benchmark;   // read by the nominal looper, false after the [order_only] line
+};
+
+vector<ProfileEntry> readProfile(const string& fname) {
+  vector<ProfileEntry> profile;
+  ifstream fin(fname);
+  if (!fin) throw invalid_argument("[relayoutBaby] Cannot open profile " + fname + "!");
+  string line;
+  bool benchmark = true;
+  while (getline(fin, line)) {
+    if (line.find('#') != string::npos) line.erase(line.find('#'));
+    istringstream iss(line);
+    ProfileEntry entry;
+    if (!(iss >> entry.pattern)) continue;
+    if (entry.pattern[0] == '[') {
+      if (entry.pattern != "[order_only]") throw invalid_argument("[relayoutBaby] Unknown section " + entry.pattern + " in " + fname + "!");
+      benchmark = false;
+      continue;
+    }
+    if (!(iss >> entry.compression)) entry.compression = -1;
+    entry.benchmark = benchmark;
+    profile.push_back(entry);
+  }
+  return profile;
+}
+
+// Rank of a branch in the profile, the branches not in it go last
+size_t profileRank(const vector<ProfileEntry>& profile, const char* name) {
+  for (size_t i = 0; i < profile.size(); ++i)
+    if (fnmatch(profile[i].pattern.c_str(), name, 0) == 0) return i;
+  return profile.size();
+}
+
+void relayoutTree(TTree* intree, TFile* outfile, const vector<ProfileEntry>& profile, const vector<ProfileEntry>& overrides, Long64_t autoflush) {
+  outfile->cd();
+  TTree* outtree = intree->CloneTree(0);
+
+  // The clusters are flushed in the order of the list of branches
+  TObjArray* branches = outtree->GetListOfBranches();
+  vector<pair<size_t,TBranch*>> order;
+  for (int i = 0; i < branches->GetEntriesFast(); ++i) {
+    TBranch* branch = (TBranch*) branches->At(i);
+    order.emplace_back(profileRank(profile, branch->GetName()), branch);
+  }
+  stable_sort(order.begin(), order.end(), [](const pair<size_t,TBranch*>& a, const pair<size_t,TBranch*>& b) { return a.first < b.first; });
+  size_t nprofiled = 0;
+  for (size_t i = 0; i < order.size(); ++i) {
+    TBranch* branch = order[i].second;
+    branches->AddAt(branch, i);
+    int compression = (order[i].first < profile.size())? profile[order[i].first].compression : -1;
+    if (order[i].first < profile.size()) ++nprofiled;
+    size_t iover = profileRank(overrides, branch->GetName());
+    if (iover < overrides.size()) compression = overrides[iover].compression;
+    if (compression >= 0) branch->SetCompressionSettings(compression);
+  }
+
+  outtree->SetAutoFlush(autoflush);
+  outtree->CopyEntries(intree);
+  outtree->Write("", TObject::kOverwrite);
+  // A negative auto flush has been turned into a number of entries by the first flush
+  cout << "[relayoutBaby] >> Tree " << intree->GetName() << ": " << nprofiled << " of " << order.size()
+       << " branches moved to the front, " << outtree->GetAutoFlush() << " entries per cluster" << endl;
+  delete outtree;
+}
+
+struct ReadStats {
+  double seconds;
+  Long64_t bytes;
+  Int_t calls;
+};
+
+// Go through the benchmarked branches of the profile the way StopLooper does
+ReadStats benchmarkRead(const string& fname, const vector<ProfileEntry>& profile) {
+  TFile* file = TFile::Open(fname.c_str());
+  TTree* tree = (TTree*) file->Get("t");
+  tree->SetBranchStatus("*", 0);
+  TObjArray* branches = tree->GetListOfBranches();
+  for (int i = 0; i < branches->GetEntriesFast(); ++i) {
+    TBranch* branch = (TBranch*) branches->At(i);
+    size_t rank = profileRank(profile, branch->GetName());
+    if (rank == profile.size() || !profile[rank].benchmark) continue;
+    tree->SetBranchStatus(branch->GetName(), 1);
+    tree->SetBranchStatus((string(branch->GetName()) + ".*").c_str(), 1);
+  }
+  TTreeCache::SetLearnEntries(10);
+  tree->SetCacheSize(128*1024*1024);
+
+  TStopwatch timer;
+  const Long64_t nentries = tree->GetEntries();
+  for (Long64_t i = 0; i < nentries; ++i)
+    tree->GetEntry(i);
+  timer.Stop();
+
+  ReadStats stats = {timer.RealTime(), file->GetBytesRead(), file->GetReadCalls()};
+  file->Close();
+  delete file;
+  return stats;
+}
+
+Long64_t fileSize(const string& fname) {
+  TFile* file = TFile::Open(fname.c_str());
+  Long64_t size = file->GetSize();
+  file->Close();
+  delete file;
+  return size;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    cout << "Usage: ./relayoutBaby input.root output.root [--profile=<file>] [--clusterMB=<MB>|--clusterEntries=<N>]" << endl;
+    cout << "                      [--compress=<setting>] [--compressBranches=<pattern>:<setting>,...] [--noBenchmark]" << endl;
+    cout << "  --profile=<file>     branch usage profile, relayoutProfile.txt by default" << endl;
+    cout << "  --clusterMB=<MB>     size of the clusters before compression, 64 by default" << endl;
+    cout << "  --clusterEntries=<N> number of entries per cluster instead" << endl;
+    cout << "  --compress=<s>       ROOT compression setting of the output file, e.g. 404 for LZ4, that of the input by default" << endl;
+    cout << "  --compressBranches=<pattern>:<s>,...  compression setting of the matching branches, overrides the profile" << endl;
+    cout << "  --noBenchmark        skip the read speed comparison" << endl;
+    return 1;
+  }
+
+  string infname = argv[1];
+  string outfname = argv[2];
+  string profilename = "relayoutProfile.txt";
+  // Half the cache of the looper, so the profiled branches of a cluster always fit in it
+  Long64_t autoflush = -64*1000*1000;
+  int compression = -1;
+  vector<ProfileEntry> overrides;
+  bool benchmark = true;
+
+  for (int i = 3; i < argc; ++i) {
+    string arg = argv[i];
+    string key = arg.substr(0, arg.find('='));
+    string value = (arg.find('=') == string::npos)? "" : arg.substr(arg.find('=')+1);
+    if (key == "--profile") profilename = value;
+    else if (key == "--clusterMB") autoflush = -stof(value)*1000*1000;
+    else if (key == "--clusterEntries") autoflush = stoll(value);
+    else if (key == "--compress") compression = stoi(value);
+    else if (key == "--compressBranches") {
+      istringstream iss(value);
+      string item;
+      while (getline(iss, item, ',')) {
+        size_t pos = item.rfind(':');
+        if (pos == string::npos) throw invalid_argument("[relayoutBaby] Expect <pattern>:<setting> in --compressBranches, got " + item + "!");
+        overrides.push_back({item.substr(0, pos), stoi(item.substr(pos+1))});
+      }
+    }
+    else if (key == "--noBenchmark") benchmark = false;
+    else throw invalid_argument("[relayoutBaby] Unknown option " + arg + "!");
+  }
+
+  vector<ProfileEntry> profile = readProfile(profilename);
+
+  TFile* infile = TFile::Open(infname.c_str());
+  if (!infile || infile->IsZombie()) throw invalid_argument("[relayoutBaby] Cannot open " + infname + "!");
+  if (compression < 0) compression = infile->GetCompressionSettings();
+  TFile* outfile = new TFile(outfname.c_str(), "RECREATE", "", compression);
+
+  // Only the last cycle of each key
+  set<string> done;
+  TIter next(infile->GetListOfKeys());
+  while (TKey* key = (TKey*) next()) {
+    if (!done.insert(key->GetName()).second) continue;
+    TObject* obj = key->ReadObj();
+    if (obj->InheritsFrom(TTree::Class())) {
+      relayoutTree((TTree*) obj, outfile, profile, overrides, autoflush);
+    } else {
+      outfile->cd();
+      obj->Write(key->GetName());
+    }
+  }
+  outfile->Close();
+  infile->Close();
+  delete outfile;
+  delete infile;
+
+  Long64_t insize = fileSize(infname);
+  Long64_t outsize = fileSize(outfname);
+  cout << "[relayoutBaby] >> Size: " << insize/1e6 << " MB -> " << outsize/1e6 << " MB (" << 100.*(outsize-insize)/insize << "%)" << endl;
+
+  if (benchmark) {
+    // The input gets read first, drop the page cache before the run for cold numbers of both
+    ReadStats before = benchmarkRead(infname, profile);
+    ReadStats after = benchmarkRead(outfname, profile);
+    cout << "[relayoutBaby] >> Reading the branches of the nominal looper: " << before.seconds << " s -> " << after.seconds << " s, "
+         << before.bytes/1e6 << " MB -> " << after.bytes/1e6 << " MB in " << before.calls << " -> " << after.calls << " read calls" << endl;
+  }
+
+  return 0;
+}
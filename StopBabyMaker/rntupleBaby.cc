@@ -0,0 +1,173 @@
+// Convert a baby to RNTuple and compare it with the TTree it came from.
+//
+// The tree t of the baby is imported into an RNTuple of the same name, with the same content and
+// the ROOT compression setting given (LZ4 by default, as for the RNTuple default). The tool reports
+// the file sizes, the conversion time, and the time to read the branches of the yield-only looper
+// configuration from both, through a TTreeCache for the TTree and through views for the RNTuple.
+// Run it on a ttbar and a signal baby to see the gain on representative content.
+//
+// The RNTuple classes need ROOT 6.30 or later, the CMSSW_10 releases of the babymaker only build
+// the usage message.
+//
+// Usage: ./rntupleBaby input.root output.root [--compress=<setting>] [--noBenchmark]
+
+// C++
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+// ROOT
+#include "RVersion.h"
+#include "TFile.h"
+#include "TTree.h"
+#include "TStopwatch.h"
+#include "TTreeCache.h"
+#include "Math/Vector4D.h"
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,30,0)
+#include <ROOT/RNTupleImporter.hxx>
+#include <ROOT/RNTupleReader.hxx>
+#include <ROOT/RNTupleView.hxx>
+#endif
+
+using namespace std;
+
+typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > LorentzVector;
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,30,0)
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,36,0)
+namespace rnt = ROOT;
+#else
+namespace rnt = ROOT::Experimental;
+#endif
+
+// Branches read by StopLooper when only the yields are filled
+const vector<string> kYieldFloats = {"pfmet", "pfmet_phi", "mt_met_lep", "mindphi_met_j1_j2", "topnessMod", "Mlb_closestb", "scale1fb"};
+const vector<string> kYieldInts = {"ngoodjets", "ngoodbtags", "nvetoleps", "ngoodleps", "lep1_pdgid"};
+const vector<string> kYieldUInts = {"run", "ls", "evt"};
+
+struct ReadResult {
+  double seconds;
+  double checksum;  // to compare the content read from both
+};
+
+// Both timers include opening the file and setting up the reading
+ReadResult readTree(const string& fname) {
+  TStopwatch timer;
+  TFile* file = TFile::Open(fname.c_str());
+  TTree* tree = (TTree*) file->Get("t");
+  tree->SetBranchStatus("*", 0);
+  vector<float> floats(kYieldFloats.size());
+  vector<int> ints(kYieldInts.size());
+  vector<unsigned int> uints(kYieldUInts.size());
+  LorentzVector* lep1 = nullptr;
+  vector<LorentzVector>* jets = nullptr;
+  for (size_t i = 0; i < kYieldFloats.size(); ++i) { tree->SetBranchStatus(kYieldFloats[i].c_str(), 1); tree->SetBranchAddress(kYieldFloats[i].c_str(), &floats[i]); }
+  for (size_t i = 0; i < kYieldInts.size(); ++i) { tree->SetBranchStatus(kYieldInts[i].c_str(), 1); tree->SetBranchAddress(kYieldInts[i].c_str(), &ints[i]); }
+  for (size_t i = 0; i < kYieldUInts.size(); ++i) { tree->SetBranchStatus(kYieldUInts[i].c_str(), 1); tree->SetBranchAddress(kYieldUInts[i].c_str(), &uints[i]); }
+  tree->SetBranchStatus("lep1_p4", 1);
+  tree->SetBranchAddress("lep1_p4", &lep1);
+  tree->SetBranchStatus("ak4pfjets_p4", 1);
+  tree->SetBranchAddress("ak4pfjets_p4", &jets);
+  TTreeCache::SetLearnEntries(10);
+  tree->SetCacheSize(128*1024*1024);
+
+  double checksum = 0;
+  const Long64_t nentries = tree->GetEntries();
+  for (Long64_t i = 0; i < nentries; ++i) {
+    tree->GetEntry(i);
+    for (float v : floats) checksum += v;
+    for (int v : ints) checksum += v;
+    for (unsigned int v : uints) checksum += v;
+    checksum += lep1->pt() + jets->size();
+  }
+  timer.Stop();
+  file->Close();
+  delete file;
+  return {timer.RealTime(), checksum};
+}
+
+ReadResult readRNTuple(const string& fname) {
+  TStopwatch timer;
+  auto reader = rnt::RNTupleReader::Open("t", fname);
+  vector<rnt::RNTupleView<float>> floats;
+  vector<rnt::RNTupleView<int>> ints;
+  vector<rnt::RNTupleView<unsigned int>> uints;
+  for (const string& name : kYieldFloats) floats.push_back(reader->GetView<float>(name));
+  for (const string& name : kYieldInts) ints.push_back(reader->GetView<int>(name));
+  for (const string& name : kYieldUInts) uints.push_back(reader->GetView<unsigned int>(name));
+  auto lep1 = reader->GetView<LorentzVector>("lep1_p4");
+  auto jets = reader->GetView<vector<LorentzVector>>("ak4pfjets_p4");
+
+  double checksum = 0;
+  const auto nentries = reader->GetNEntries();
+  for (decltype(reader->GetNEntries()) i = 0; i < nentries; ++i) {
+    for (auto& view : floats) checksum += view(i);
+    for (auto& view : ints) checksum += view(i);
+    for (auto& view : uints) checksum += view(i);
+    checksum += lep1(i).pt() + jets(i).size();
+  }
+  timer.Stop();
+  return {timer.RealTime(), checksum};
+}
+
+Long64_t fileSize(const string& fname) {
+  TFile* file = TFile::Open(fname.c_str());
+  Long64_t size = file->GetSize();
+  file->Close();
+  delete file;
+  return size;
+}
+
+#endif
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    cout << "Usage: ./rntupleBaby input.root output.root [--compress=<setting>] [--noBenchmark]" << endl;
+    cout << "  --compress=<s>   ROOT compression setting of the RNTuple, 404 (LZ4) by default" << endl;
+    cout << "  --noBenchmark    skip the read time comparison" << endl;
+    return 1;
+  }
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,30,0)
+  string infname = argv[1];
+  string outfname = argv[2];
+  int compression = 404;
+  bool benchmark = true;
+  for (int i = 3; i < argc; ++i) {
+    string arg = argv[i];
+    if (arg.find("--compress=") == 0) compression = stoi(arg.substr(11));
+    else if (arg == "--noBenchmark") benchmark = false;
+    else throw invalid_argument("[rntupleBaby] Unknown option " + arg + "!");
+  }
+
+  TStopwatch timer;
+  auto importer = ROOT::Experimental::RNTupleImporter::Create(infname, "t", outfname);
+  rnt::RNTupleWriteOptions options;
+  options.SetCompression(compression);
+  importer->SetWriteOptions(options);
+  importer->SetIsQuiet(true);
+  importer->Import();
+  timer.Stop();
+
+  Long64_t insize = fileSize(infname);
+  Long64_t outsize = fileSize(outfname);
+  cout << "[rntupleBaby] >> Size: " << insize/1e6 << " MB -> " << outsize/1e6 << " MB (" << 100.*(outsize-insize)/insize << "%), "
+       << "converted in " << timer.RealTime() << " s" << endl;
+
+  if (benchmark) {
+    // The TTree gets read first, drop the page cache before the run for cold numbers of both
+    ReadResult fromTree = readTree(infname);
+    ReadResult fromRNTuple = readRNTuple(outfname);
+    cout << "[rntupleBaby] >> Reading the yield branches: TTree " << fromTree.seconds << " s, RNTuple " << fromRNTuple.seconds << " s" << endl;
+    if (fromTree.checksum != fromRNTuple.checksum)
+      cout << "[rntupleBaby] >> WARNING: the content read from the RNTuple differs from the TTree!" << endl;
+  }
+  return 0;
+#else
+  cout << "[rntupleBaby] >> The RNTuple classes need ROOT 6.30 or later, this is ROOT " << ROOT_RELEASE << endl;
+  return 1;
+#endif
+}
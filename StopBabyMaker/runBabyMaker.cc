@@ -137,6 +137,8 @@ int main(int argc, char **argv){
   mylooper->applyVetoLeptonSFs = true;
   mylooper->apply2ndLepVeto    = false;
   mylooper->isFastsim          = isFastsim;
+  mylooper->splitJES           = false; // true to write the JES variations to the t_jes friend tree
+  mylooper->splitP4            = false; // true to write the p4 collections as split float columns
 
   mylooper->skim_jet_ak8_pt    = 200.0;
   mylooper->skim_jet_ak8_eta   = 2.4;
@@ -221,9 +223,25 @@ int main(int argc, char **argv){
   parseAndSet_b("applyMETRecipeV2" , mylooper->applyMETRecipeV2);
   parseAndSet_b("fillPhoton"       , mylooper->fillPhoton);
   parseAndSet_b("fillZll"          , mylooper->fillZll);
+  parseAndSet_b("splitJES"         , mylooper->splitJES);
+  parseAndSet_b("splitP4"          , mylooper->splitP4);
 
   if (ifile != -1) suffix += Form("_%i", ifile);
 
+  // Periodic progress record in JSON-lines format, e.g. telemetry=progress.jsonl
+  TString telemetryFile = parseArg(extrargs, "telemetry");
+  if (!telemetryFile.IsNull()) {
+    mylooper->telemetryFile = telemetryFile.Data();
+    cout << "[runBabyMaker] >> Will write the job telemetry to " << telemetryFile << endl;
+  }
+
+  // Store the float branches of a profile with reduced precision, e.g. precision=precisionProfile.txt
+  TString precisionProfile = parseArg(extrargs, "precision");
+  if (!precisionProfile.IsNull()) {
+    mylooper->precisionProfile = precisionProfile.Data();
+    cout << "[runBabyMaker] >> Will round the float branches in " << precisionProfile << endl;
+  }
+
   // If an output name for the topcand-tree is specified, also produce that with the baby
   TString topCandTreeName = parseArg(extrargs, "topcandTree");
   if (!topCandTreeName.IsNull()) {
@@ -0,0 +1,105 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <glob.h>
+
+#include "BabyCatalog.h"
+
+using namespace std;
+
+namespace {
+
+vector<string> expandGlob(const string& pattern) {
+  vector<string> paths;
+  glob_t globbuf;
+  if (glob(pattern.c_str(), 0, nullptr, &globbuf) == 0) {
+    for (size_t i = 0; i < globbuf.gl_pathc; ++i) paths.push_back(globbuf.gl_pathv[i]);
+  }
+  globfree(&globbuf);
+  return paths;
+}
+
+template<class T> vector<T> parseList(const string& list) {
+  vector<T> items;
+  istringstream iss(list);
+  string item;
+  while (getline(iss, item, ',')) {
+    if (item.empty()) continue;
+    istringstream value(item);
+    T v;
+    value >> v;
+    items.push_back(v);
+  }
+  return items;
+}
+
+void splitPath(const string& path, string& dir, string& name) {
+  size_t slash = path.rfind('/');
+  dir = (slash == string::npos)? "." : path.substr(0, slash);
+  name = (slash == string::npos)? path : path.substr(slash+1);
+  // Directories may be given with a trailing or doubled slash
+  while (dir.size() > 1 && dir.back() == '/') dir.pop_back();
+}
+
+}
+
+const map<string,BabyCatalog::FileEntry>& BabyCatalog::GetDirectory(const string& dir) {
+  auto idir = dirs_.find(dir);
+  if (idir != dirs_.end()) return idir->second;
+
+  map<string,FileEntry>& files = dirs_[dir];
+  for (const string& catalog : expandGlob(dir + "/catalog*.txt")) {
+    ifstream fin(catalog);
+    string line;
+    while (getline(fin, line)) {
+      istringstream iss(line);
+      string name, field;
+      if (!(iss >> name)) continue;
+      FileEntry entry = {-1, 0, "unknown", {}, {}, 0, 0};
+      while (iss >> field) {
+        size_t eq = field.find('=');
+        if (eq == string::npos) continue;
+        string key = field.substr(0, eq);
+        string value = field.substr(eq+1);
+        if (key == "entries") entry.entries = stoll(value);
+        else if (key == "year") entry.year = stoi(value);
+        else if (key == "dataset") entry.dataset = value;
+        else if (key == "clusters") entry.clusters = parseList<long long>(value);
+        else if (key == "counter") entry.counter = parseList<double>(value);
+        else if (key == "counterSMS") entry.counterSMS = stod(value);
+        else if (key == "nEvtsSMS") entry.nEvtsSMS = stod(value);
+      }
+      if (entry.entries < 0)
+        throw invalid_argument("[BabyCatalog::GetDirectory] No number of entries for " + name + " in " + catalog + "!");
+      files[name] = entry;
+    }
+  }
+  if (!files.empty())
+    cout << "[BabyCatalog] >> Found " << files.size() << " babies in the catalogs of " << dir << endl;
+  return files;
+}
+
+const BabyCatalog::FileEntry* BabyCatalog::Find(const string& path) {
+  string dir, name;
+  splitPath(path, dir, name);
+  const map<string,FileEntry>& files = GetDirectory(dir);
+  auto ifile = files.find(name);
+  return (ifile == files.end())? nullptr : &ifile->second;
+}
+
+int BabyCatalog::AddToChain(TChain* chain, const string& pattern) {
+  // Leave the remote files and the patterns glob cannot expand to TChain
+  vector<string> paths;
+  if (pattern.find("://") == string::npos) paths = expandGlob(pattern);
+  if (paths.empty()) return chain->Add(pattern.c_str());
+
+  int nadded = 0;
+  for (const string& path : paths) {
+    const FileEntry* entry = Find(path);
+    if (entry) nadded += chain->Add(path.c_str(), entry->entries);
+    else nadded += chain->Add(path.c_str());
+  }
+  return nadded;
+}
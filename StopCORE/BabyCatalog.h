@@ -0,0 +1,51 @@
+#ifndef BabyCatalog_H
+#define BabyCatalog_H
+
+// C++
+#include <string>
+#include <vector>
+#include <map>
+
+// ROOT
+#include "TChain.h"
+
+//
+// CLASS
+//
+// Metadata catalog of the babies in a directory, written by the merge step with
+// StopBabyMaker/batch_metis/makeBabyCatalog.C into catalog*.txt files next to the babies. It holds
+// the number of entries, the cluster boundaries, the sums of the counter histograms, and the dataset
+// and year of each file, so that the chains can be built and the jobs planned without
+// opening every file. The catalogs of a directory are read on the first lookup of a file in it, and
+// the files without a catalog entry are simply opened as before.
+//
+
+class BabyCatalog {
+ public:
+  struct FileEntry {
+    long long entries;
+    int year;                          // 0 when the baby has no year branch
+    std::string dataset;
+    std::vector<long long> clusters;   // first entry of each cluster
+    std::vector<double> counter;       // bin contents of h_counter
+    double counterSMS;                 // sum of h_counterSMS
+    double nEvtsSMS;                   // sum of histNEvts
+  };
+
+  BabyCatalog() {}
+  ~BabyCatalog() {}
+
+  // The entry of a baby, null if it is not in the catalogs of its directory
+  const FileEntry* Find(const std::string& path);
+
+  // Add the babies matching pattern (a path or a glob) to the chain, with the number of entries from
+  // the catalog for those in it so that the chain does not open them to count the entries
+  int AddToChain(TChain* chain, const std::string& pattern);
+
+ private:
+  const std::map<std::string,FileEntry>& GetDirectory(const std::string& dir);
+
+  std::map<std::string,std::map<std::string,FileEntry>> dirs_;  // directory -> file name -> entry
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include <stdexcept>
+
+#include "RVersion.h"
+#include "TMath.h"
+
+#include "BulkBranch.h"
+
+using namespace std;
+
+bool BulkBranch::IsSupported(TBranch* branch) {
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,16,0)
+  return branch->SupportsBulkRead();
+#else
+  return false;
+#endif
+}
+
+void BulkBranch::LoadBasket(Long64_t entry) {
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,16,0)
+  // The bulk read only starts from the first entry of a basket
+  Int_t ibasket = TMath::BinarySearch(branch_->GetWriteBasket()+1, branch_->GetBasketEntry(), entry);
+  Long64_t first = branch_->GetBasketEntry()[ibasket];
+  Int_t count = branch_->GetBulkRead().GetBulkEntries(first, buffer_);
+  if (count <= 0 || entry >= first + count)
+    throw runtime_error(string("[BulkBranch::LoadBasket] Cannot read entry ") + to_string(entry) + " of branch " + branch_->GetName() + "!");
+  first_ = first;
+  last_ = first + count;
+  data_ = buffer_.GetCurrent();
+#else
+  throw logic_error("[BulkBranch::LoadBasket] The bulk read needs ROOT 6.16 or later!");
+#endif
+}
+
+BulkBranch* BulkBranchSet::Make(TBranch* branch) {
+  if (!branch || names_.empty()) return nullptr;
+  if (!names_.count(branch->GetName())) return nullptr;
+  if (!BulkBranch::IsSupported(branch)) return nullptr;
+  readers_.emplace_back(new BulkBranch(branch));
+  return readers_.back().get();
+}
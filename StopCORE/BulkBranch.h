@@ -0,0 +1,70 @@
+#ifndef BulkBranch_H
+#define BulkBranch_H
+
+// C++
+#include <string>
+#include <vector>
+#include <set>
+#include <memory>
+
+// ROOT
+#include "TBranch.h"
+#include "TBufferFile.h"
+
+//
+// CLASS
+//
+// Reads a flat scalar branch (bool/int/float...) a whole basket at a time through the ROOT bulk I/O,
+// into a contiguous array that Get() then indexes by entry. Replaces the per-entry TBranch::GetEntry
+// of the generated accessors for the branches selected with StopTree::SetBulkRead, which is where most
+// of the time goes for a preselection that only looks at a few scalars. Branches the bulk I/O can't
+// handle, or a ROOT version without it, fall back to the usual per-entry reading.
+//
+class BulkBranch {
+
+ public:
+
+  explicit BulkBranch(TBranch* branch) : branch_(branch), buffer_(TBuffer::kWrite, 32*1024), first_(0), last_(0), data_(nullptr) {}
+
+  static bool IsSupported(TBranch* branch);
+
+  // Entry index is local to the tree of the branch
+  template<class T> T Get(Long64_t entry) {
+    if (entry < first_ || entry >= last_) LoadBasket(entry);
+    return reinterpret_cast<const T*>(data_)[entry - first_];
+  }
+
+ private:
+
+  void LoadBasket(Long64_t entry);
+
+  TBranch* branch_;
+  TBufferFile buffer_;
+  Long64_t first_;  // entries [first_, last_) are in buffer_
+  Long64_t last_;
+  const char* data_;
+};
+
+//
+// The bulk readers for one tree, remade by StopTree::Init for every new tree
+//
+class BulkBranchSet {
+
+ public:
+
+  void SetBranches(const std::vector<std::string>& names) { names_.clear(); names_.insert(names.begin(), names.end()); }
+  bool IsActive() const { return !names_.empty(); }
+
+  // Drop the readers of the previous tree
+  void Clear() { readers_.clear(); }
+
+  // Reader for the branch if it has been selected and supports the bulk read, nullptr otherwise
+  BulkBranch* Make(TBranch* branch);
+
+ private:
+
+  std::set<std::string> names_;
+  std::vector<std::unique_ptr<BulkBranch>> readers_;
+};
+
+#endif
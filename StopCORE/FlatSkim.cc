@@ -0,0 +1,83 @@
+#include <fstream>
+#include <sstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "FlatSkim.h"
+
+using namespace std;
+
+FlatSkim::FlatSkim(const string& dir) : dir_(dir), nentries_(0) {
+  ifstream fin(dir + "/columns.txt");
+  if (!fin) throw invalid_argument("[FlatSkim::FlatSkim] Cannot open " + dir + "/columns.txt!");
+  string key;
+  if (!(fin >> key >> nentries_) || key != "entries")
+    throw invalid_argument("[FlatSkim::FlatSkim] " + dir + "/columns.txt does not start with the number of entries!");
+  string name, type;
+  while (fin >> name >> type) types_[name] = type;
+}
+
+FlatSkim::~FlatSkim() {
+  for (auto& col : columns_) {
+    if (col.second.data) munmap((void*) col.second.data, col.second.datasize);
+    if (col.second.offsets) munmap((void*) col.second.offsets, col.second.offsetsize);
+  }
+}
+
+vector<string> FlatSkim::GetColumnNames() const {
+  vector<string> names;
+  for (const auto& type : types_) names.push_back(type.first);
+  return names;
+}
+
+const void* FlatSkim::MapFile(const string& fname, size_t& size) {
+  int fd = open(fname.c_str(), O_RDONLY);
+  if (fd < 0) throw invalid_argument("[FlatSkim::MapFile] Cannot open " + fname + "!");
+  struct stat st;
+  fstat(fd, &st);
+  size = st.st_size;
+  void* data = nullptr;
+  // A column of empty vectors has no data to map
+  if (size > 0) {
+    data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      throw runtime_error("[FlatSkim::MapFile] Cannot map " + fname + "!");
+    }
+    madvise(data, size, MADV_SEQUENTIAL);
+  }
+  close(fd);
+  return data;
+}
+
+const FlatSkim::Mapped& FlatSkim::GetMapped(const string& name, const string& type, size_t valuesize) {
+  auto itype = types_.find(name);
+  if (itype == types_.end()) throw invalid_argument("[FlatSkim::GetMapped] No column " + name + " in " + dir_ + "!");
+  if (itype->second != type)
+    throw invalid_argument("[FlatSkim::GetMapped] Column " + name + " is of type " + itype->second + ", not " + type + "!");
+
+  auto icol = columns_.find(name);
+  if (icol != columns_.end()) return icol->second;
+
+  Mapped col = {type, nullptr, 0, nullptr, 0};
+  auto fail = [&](const string& msg) {
+    if (col.data) munmap((void*) col.data, col.datasize);
+    if (col.offsets) munmap((void*) col.offsets, col.offsetsize);
+    throw runtime_error("[FlatSkim::GetMapped] " + msg);
+  };
+  col.data = MapFile(dir_ + "/" + name + ".col", col.datasize);
+  uint64_t nvalues = nentries_;
+  if (type[0] == 'v') {
+    col.offsets = (const uint64_t*) MapFile(dir_ + "/" + name + ".off", col.offsetsize);
+    if (col.offsetsize != (nentries_+1) * sizeof(uint64_t))
+      fail("The offsets of column " + name + " do not match the number of entries!");
+    nvalues = col.offsets[nentries_];
+  }
+  // A truncated column would be read past the end of its mapping
+  if (col.datasize != nvalues * valuesize)
+    fail("The size of column " + name + " does not match its " + to_string(nvalues) + " values!");
+  return columns_.emplace(name, col).first->second;
+}
@@ -0,0 +1,154 @@
+#ifndef FlatSkim_H
+#define FlatSkim_H
+
+// C++
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Math/Vector4D.h"
+#include "VecView.h"
+
+//
+// Flat binary copy of a skimmed baby, to loop many times over the same few million events without
+// decompressing and deserializing them every time. The exportFlatSkim tool writes a directory with
+// one raw file per column and an index:
+//   columns.txt          "entries <N>" then one "<name> <type>" line per column
+//   <name>.col           the values of all entries back to back, as in memory
+//   <name>.off           for the jagged columns, N+1 uint64 offsets of each entry in <name>.col
+// The types are b (bool, 1 byte), i (int), u (unsigned int), f (float), d (double) and lv (the
+// PxPyPzE float LorentzVector of the babies, 16 bytes), with a "v" in front for the vector branches.
+// FlatSkim maps the files into memory, so the columns are read without any parsing, and from the
+// page cache at memory speed once a first pass has gone through them. The looper reads the flat skim
+// of a baby through the usual StopTree accessors with the --flatSkims option, see StopTree::SetFlatSkim.
+//
+
+typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > FlatLorentzVector;
+static_assert(sizeof(FlatLorentzVector) == 4*sizeof(float), "The flat skims store LorentzVectors as 4 floats");
+
+template<class T> struct FlatType;
+template<> struct FlatType<bool> { static const char* code() { return "b"; } };
+template<> struct FlatType<int> { static const char* code() { return "i"; } };
+template<> struct FlatType<unsigned int> { static const char* code() { return "u"; } };
+template<> struct FlatType<float> { static const char* code() { return "f"; } };
+template<> struct FlatType<double> { static const char* code() { return "d"; } };
+template<> struct FlatType<FlatLorentzVector> { static const char* code() { return "lv"; } };
+
+template<class T> class FlatColumn {
+ public:
+  FlatColumn() : data_(nullptr) {}
+  FlatColumn(const T* data) : data_(data) {}
+  const T& operator[](uint64_t entry) const { return data_[entry]; }
+ private:
+  const T* data_;
+};
+
+template<class T> class FlatJagged {
+ public:
+  FlatJagged() : offsets_(nullptr), data_(nullptr) {}
+  FlatJagged(const uint64_t* offsets, const T* data) : offsets_(offsets), data_(data) {}
+  VecView<T> operator[](uint64_t entry) const { return VecView<T>(data_ + offsets_[entry], offsets_[entry+1] - offsets_[entry]); }
+ private:
+  const uint64_t* offsets_;
+  const T* data_;
+};
+
+class FlatSkim {
+ public:
+  // Reads the index of the columns, each column gets mapped on its first use
+  explicit FlatSkim(const std::string& dir);
+  ~FlatSkim();
+  FlatSkim(const FlatSkim&) = delete;
+  FlatSkim& operator=(const FlatSkim&) = delete;
+
+  uint64_t GetEntries() const { return nentries_; }
+  bool HasColumn(const std::string& name) const { return types_.count(name); }
+  std::vector<std::string> GetColumnNames() const;
+
+  template<class T> FlatColumn<T> Column(const std::string& name) {
+    const Mapped& col = GetMapped(name, FlatType<T>::code(), sizeof(T));
+    return FlatColumn<T>((const T*) col.data);
+  }
+  template<class T> FlatJagged<T> Jagged(const std::string& name) {
+    const Mapped& col = GetMapped(name, std::string("v") + FlatType<T>::code(), sizeof(T));
+    return FlatJagged<T>(col.offsets, (const T*) col.data);
+  }
+
+ private:
+  struct Mapped {
+    std::string type;
+    const void* data;
+    size_t datasize;
+    const uint64_t* offsets;
+    size_t offsetsize;
+  };
+
+  const void* MapFile(const std::string& fname, size_t& size);
+  // Checks the sizes of the files against the number of entries and the size of the values
+  const Mapped& GetMapped(const std::string& name, const std::string& type, size_t valuesize);
+
+  std::string dir_;
+  uint64_t nentries_;
+  std::map<std::string,std::string> types_;
+  std::map<std::string,Mapped> columns_;  // mapped on first use
+};
+
+//
+// The column of a StopTree branch in a flat skim, see StopTree::SetFlatSkim. Inactive if the skim has
+// no column for the branch, which is then read from the tree as usual. The scalars are returned by
+// value, the four-vectors and vectors are copied into a buffer, as the accessors hand out pointers to
+// non-const objects like the ones ROOT reads into.
+//
+template<class T> class FlatScalar {
+ public:
+  FlatScalar() : active_(false) {}
+  void Init(FlatSkim* skim, const std::string& name) {
+    active_ = (skim && skim->HasColumn(name));
+    if (active_) column_ = skim->Column<T>(name);
+  }
+  bool IsActive() const { return active_; }
+  T Get(uint64_t entry) const { return column_[entry]; }
+ private:
+  bool active_;
+  FlatColumn<T> column_;
+};
+
+template<class T> class FlatObject;
+
+template<> class FlatObject<FlatLorentzVector> {
+ public:
+  FlatObject() : active_(false) {}
+  void Init(FlatSkim* skim, const std::string& name) {
+    active_ = (skim && skim->HasColumn(name));
+    if (active_) column_ = skim->Column<FlatLorentzVector>(name);
+  }
+  bool IsActive() const { return active_; }
+  FlatLorentzVector* Get(uint64_t entry) { buffer_ = column_[entry]; return &buffer_; }
+ private:
+  bool active_;
+  FlatColumn<FlatLorentzVector> column_;
+  FlatLorentzVector buffer_;
+};
+
+template<class T> class FlatObject<std::vector<T> > {
+ public:
+  FlatObject() : active_(false) {}
+  void Init(FlatSkim* skim, const std::string& name) {
+    active_ = (skim && skim->HasColumn(name));
+    if (active_) column_ = skim->Jagged<T>(name);
+  }
+  bool IsActive() const { return active_; }
+  std::vector<T>* Get(uint64_t entry) {
+    VecView<T> values = column_[entry];
+    buffer_.assign(values.begin(), values.end());
+    return &buffer_;
+  }
+ private:
+  bool active_;
+  FlatJagged<T> column_;
+  std::vector<T> buffer_;
+};
+
+#endif
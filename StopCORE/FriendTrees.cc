@@ -0,0 +1,105 @@
+#include <iostream>
+
+#include "FriendTrees.h"
+
+using namespace std;
+
+void FriendBranchBase::Connect(const vector<TTree*>& trees) {
+  branch_ = nullptr;
+  generation_ = 0;
+  for (TTree* tree : trees) {
+    branch_ = tree->GetBranch(name_.c_str());
+    if (branch_) break;
+  }
+  if (!branch_)
+    throw invalid_argument("[FriendBranch::Connect] Cannot find branch " + name_ + " in the friend trees!");
+
+  TClass* cl = nullptr;
+  EDataType type = kOther_t;
+  branch_->GetExpectedType(cl, type);
+  if (!HasType(cl, type))
+    throw invalid_argument("[FriendBranch::Connect] Branch " + name_ + " in the friend trees is not of the registered type!");
+  SetAddress();
+}
+
+namespace {
+
+struct EventId {
+  unsigned int run;
+  unsigned int ls;
+  unsigned int evt;
+  bool operator!=(const EventId& o) const { return run != o.run || ls != o.ls || evt != o.evt; }
+};
+
+EventId readEventId(TTree* tree, Long64_t entry) {
+  EventId id;
+  TBranch* run = tree->GetBranch("run");
+  TBranch* ls = tree->GetBranch("ls");
+  TBranch* evt = tree->GetBranch("evt");
+  if (!run || !ls || !evt)
+    throw invalid_argument(string("[FriendTrees::Attach] Tree ") + tree->GetName() + " has no run/ls/evt branches to check the entries with!");
+  run->SetAddress(&id.run);
+  ls->SetAddress(&id.ls);
+  evt->SetAddress(&id.evt);
+  run->GetEntry(entry);
+  ls->GetEntry(entry);
+  evt->GetEntry(entry);
+  // The baby keeps its addresses from StopTree::Init, done after the friends are attached
+  run->ResetAddress();
+  ls->ResetAddress();
+  evt->ResetAddress();
+  return id;
+}
+
+string baseName(const string& path) {
+  size_t pos = path.rfind('/');
+  return (pos == string::npos)? path : path.substr(pos+1);
+}
+
+} // namespace
+
+void FriendTrees::Attach(TTree* tree, const string& babyfile) {
+  Close();
+
+  const Long64_t nentries = tree->GetEntries();
+  for (const FriendDir& dir : dirs_) {
+    string fname = dir.path + "/" + baseName(babyfile);
+    TFile* file = TFile::Open(fname.c_str());
+    if (!file || file->IsZombie())
+      throw invalid_argument("[FriendTrees::Attach] Cannot open friend file " + fname + "!");
+    files_.push_back(file);
+
+    TTree* ftree = (TTree*) file->Get(dir.treename.c_str());
+    if (!ftree)
+      throw invalid_argument("[FriendTrees::Attach] Cannot find tree " + dir.treename + " in " + fname + "!");
+    if (ftree->GetEntries() != nentries)
+      throw invalid_argument("[FriendTrees::Attach] " + fname + " has " + to_string(ftree->GetEntries()) + " entries, while the baby has " + to_string(nentries) + "!");
+
+    // Spot checks that the entries line up, the counts alone don't catch a different ordering
+    for (Long64_t entry : {Long64_t(0), nentries/2, nentries-1}) {
+      if (entry < 0) continue;
+      if (readEventId(ftree, entry) != readEventId(tree, entry))
+        throw invalid_argument("[FriendTrees::Attach] Entry " + to_string(entry) + " of " + fname + " is not the same event as in the baby!");
+    }
+
+    // The friend sits in its own file, so it needs its own cache
+    ftree->SetCacheSize(16*1024*1024);
+    ftree->AddBranchToCache("*", true);
+    tree->AddFriend(ftree, Form("friend%zu", trees_.size()));
+    trees_.push_back(ftree);
+  }
+
+  for (auto& branch : branches_)
+    branch->Connect(trees_);
+
+  cout << "[FriendTrees::Attach] >> Attached " << trees_.size() << " friend trees to " << babyfile << endl;
+}
+
+void FriendTrees::Close() {
+  for (TFile* file : files_) {
+    file->Close();
+    delete file;
+  }
+  files_.clear();
+  trees_.clear();
+}
@@ -0,0 +1,117 @@
+#ifndef FriendTrees_H
+#define FriendTrees_H
+
+// C++
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+// ROOT
+#include "TFile.h"
+#include "TTree.h"
+#include "TBranch.h"
+#include "TClass.h"
+#include "TDataType.h"
+
+//
+// CLASS
+//
+// Entry-aligned friend trees of the babies, to add new variables (a retrained tagger, another MT2...)
+// without remaking them. A friend directory holds one small "patch" file per baby, with the same file
+// name and a tree with the same entries, including the run/ls/evt of each entry. Attach() opens the
+// friends of a baby and checks their entry counts and the event ids of a few entries against the baby.
+// Branches of the friends are read through registered FriendBranch accessors, which follow the entry
+// given to GetEntry() in the same lazy way as the StopTree accessors.
+//
+
+class FriendTrees;
+
+class FriendBranchBase {
+ public:
+  FriendBranchBase(const FriendTrees& owner, const std::string& name) : owner_(owner), name_(name), branch_(nullptr), generation_(0) {}
+  virtual ~FriendBranchBase() {}
+  const std::string& GetName() const { return name_; }
+
+  // Find the branch in the friends of the current baby
+  void Connect(const std::vector<TTree*>& trees);
+
+ protected:
+  virtual void SetAddress() = 0;
+  virtual bool HasType(TClass* cl, EDataType type) const = 0;
+
+  const FriendTrees& owner_;
+  std::string name_;
+  TBranch* branch_;
+  unsigned long long generation_;
+};
+
+template<class T> class FriendBranch : public FriendBranchBase {
+ public:
+  FriendBranch(const FriendTrees& owner, const std::string& name) : FriendBranchBase(owner, name), value_(), ptr_(&value_) {}
+
+  inline const T& operator()();
+
+ private:
+  void SetAddress() override {
+    if (std::is_fundamental<T>::value) branch_->SetAddress(ptr_);
+    else branch_->SetAddress(&ptr_);
+  }
+  bool HasType(TClass* cl, EDataType type) const override {
+    if (std::is_fundamental<T>::value) return type == TDataType::GetType(typeid(T));
+    return cl == TClass::GetClass(typeid(T));
+  }
+
+  T value_;
+  T* ptr_;  // ROOT may swap in its own object for class types
+};
+
+class FriendTrees {
+ public:
+  FriendTrees() : entry_(-1), generation_(0) {}
+  ~FriendTrees() { Close(); }
+
+  // Directory with a friend file for each baby, named like the baby
+  void AddDirectory(const std::string& dir, const std::string& treename = "t") { dirs_.push_back({dir, treename}); }
+  bool IsActive() const { return !dirs_.empty(); }
+
+  // The accessor of a friend branch, connected at every Attach()
+  template<class T> FriendBranch<T>& Register(const std::string& name) {
+    FriendBranch<T>* branch = new FriendBranch<T>(*this, name);
+    branches_.emplace_back(branch);
+    return *branch;
+  }
+
+  // Open the friends of the baby and check they line up with its tree, throws if they don't
+  void Attach(TTree* tree, const std::string& babyfile);
+  void Close();
+
+  void GetEntry(Long64_t entry) { entry_ = entry; ++generation_; }
+  Long64_t GetEntryIndex() const { return entry_; }
+  unsigned long long GetGeneration() const { return generation_; }
+
+ private:
+  struct FriendDir {
+    std::string path;
+    std::string treename;
+  };
+
+  std::vector<FriendDir> dirs_;
+  std::vector<TFile*> files_;  // of the current baby
+  std::vector<TTree*> trees_;
+  std::vector<std::unique_ptr<FriendBranchBase>> branches_;
+  Long64_t entry_;
+  unsigned long long generation_;
+};
+
+template<class T> const T& FriendBranch<T>::operator()() {
+  if (generation_ != owner_.GetGeneration()) {
+    if (!branch_) throw std::logic_error("[FriendBranch] " + name_ + " is read before any friend tree got attached!");
+    branch_->GetEntry(owner_.GetEntryIndex());
+    generation_ = owner_.GetGeneration();
+  }
+  return *ptr_;
+}
+
+#endif
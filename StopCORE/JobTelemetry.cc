@@ -0,0 +1,148 @@
+#include "JobTelemetry.h"
+
+// C
+#include <ctime>
+#include <iostream>
+
+// ROOT
+#include "TFile.h"
+#include "TSystem.h"
+#include "TString.h"
+
+using namespace std;
+
+namespace {
+
+// Names of jobs and files can have any character, they must not break the JSON record
+string jsonEscape(const string& str) {
+  string out;
+  for (char c : str) {
+    if (c == '"') out += "\\\"";
+    else if (c == '\\') out += "\\\\";
+    else if ((unsigned char) c < 0x20) out += Form("\\u%04x", (unsigned char) c);
+    else out += c;
+  }
+  return out;
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////
+
+bool JobTelemetry::Open(const string& fname, const string& jobname, double interval_sec, double window_sec) {
+  Close();
+  out_.open(fname, ios::out | ios::app);
+  if (!out_.is_open()) {
+    cout << "[JobTelemetry::Open] >> Cannot open telemetry file " << fname << ", telemetry is disabled!" << endl;
+    return false;
+  }
+  active_ = true;
+  jobname_ = jobname;
+  interval_ = interval_sec;
+  window_ = window_sec;
+  nevents_ = 0;
+  curfile_.clear();
+  history_.clear();
+  stagenames_.clear();
+  stagetimes_.clear();
+  curstage_ = -1;
+
+  tstart_ = tlastwrite_ = tstage_ = clock::now();
+  history_.emplace_back(tstart_, 0);
+  cout << "[JobTelemetry::Open] >> Writing telemetry every " << interval_ << "s to " << fname << endl;
+
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void JobTelemetry::Close() {
+  if (!active_) return;
+  SwitchStage(-1);
+  WriteRecord(true);
+  out_.close();
+  active_ = false;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int JobTelemetry::AddStage(const string& name) {
+  for (size_t i = 0; i < stagenames_.size(); ++i)
+    if (stagenames_[i] == name) return i;
+  stagenames_.push_back(name);
+  stagetimes_.push_back(0);
+  return stagenames_.size() - 1;
+}
+
+void JobTelemetry::SwitchStage(int stage) {
+  if (!active_ || stage == curstage_) return;
+  clock::time_point now = clock::now();
+  if (curstage_ >= 0) stagetimes_[curstage_] += chrono::duration<double>(now - tstage_).count();
+  tstage_ = now;
+  curstage_ = stage;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void JobTelemetry::SetCurrentFile(const string& fname) {
+  if (!active_) return;
+  curfile_ = fname;
+  WriteRecord(false);  // always leave a record at file boundaries, useful to spot a bad file
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void JobTelemetry::MaybeWrite() {
+  if (chrono::duration<double>(clock::now() - tlastwrite_).count() >= interval_)
+    WriteRecord(false);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void JobTelemetry::WriteRecord(bool final) {
+  clock::time_point now = clock::now();
+  tlastwrite_ = now;
+
+  // Account the time of the running stage up to now
+  if (curstage_ >= 0) {
+    stagetimes_[curstage_] += chrono::duration<double>(now - tstage_).count();
+    tstage_ = now;
+  }
+
+  // Rate over the moving window, using the oldest record still inside the window
+  history_.emplace_back(now, nevents_);
+  while (history_.size() > 2 && chrono::duration<double>(now - history_[1].first).count() >= window_)
+    history_.pop_front();
+  double dt_window = chrono::duration<double>(now - history_.front().first).count();
+  double rate_window = (dt_window > 0)? (nevents_ - history_.front().second) / dt_window : 0;
+
+  double elapsed = chrono::duration<double>(now - tstart_).count();
+  double rate_avg = (elapsed > 0)? nevents_ / elapsed : 0;
+
+  double stagetotal = 0;
+  for (double t : stagetimes_) stagetotal += t;
+
+  out_ << "{\"job\": \"" << jsonEscape(jobname_) << "\""
+       << ", \"time\": " << time(nullptr)
+       << ", \"elapsed\": " << Form("%.1f", elapsed)
+       << ", \"events\": " << nevents_
+       << ", \"rate\": " << Form("%.1f", rate_window)
+       << ", \"rate_avg\": " << Form("%.1f", rate_avg)
+       << ", \"bytes_read\": " << TFile::GetFileBytesRead()
+       << ", \"rss_mb\": " << Form("%.1f", GetRSSMB())
+       << ", \"file\": \"" << jsonEscape(curfile_) << "\""
+       << ", \"stages\": {";
+  for (size_t i = 0; i < stagenames_.size(); ++i) {
+    if (i > 0) out_ << ", ";
+    out_ << "\"" << stagenames_[i] << "\": " << Form("%.3f", (stagetotal > 0)? stagetimes_[i] / stagetotal : 0.);
+  }
+  out_ << "}, \"final\": " << (final? "true" : "false") << "}" << endl;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+double JobTelemetry::GetRSSMB() {
+  ProcInfo_t procinfo;
+  gSystem->GetProcInfo(&procinfo);
+  return procinfo.fMemResident / 1024.;  // fMemResident is in kB
+}
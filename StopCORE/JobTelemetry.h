@@ -0,0 +1,70 @@
+#ifndef JobTelemetry_H
+#define JobTelemetry_H
+
+// C++
+#include <string>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <chrono>
+
+//
+// CLASS
+//
+// Periodic, append-only JSON-lines progress record for long looper and babymaker jobs.
+// One line is written every `interval` seconds with the number of events processed, the rate
+// over a moving window, the bytes read, the current file, the RSS and the fraction of the time
+// spent in each stage. Everything is a no-op unless Open() has been called.
+//
+class JobTelemetry {
+
+ public:
+
+  typedef std::chrono::steady_clock clock;
+
+  JobTelemetry() : active_(false), interval_(30), window_(120), nevents_(0), curstage_(-1) {}
+  ~JobTelemetry() { Close(); }
+
+  // Open the output in append mode, several jobs or samples can share one file
+  bool Open(const std::string& fname, const std::string& jobname, double interval_sec = 30, double window_sec = 120);
+  void Close();
+  bool IsActive() const { return active_; }
+
+  // Stages are registered once, switching between them only costs a clock reading
+  int AddStage(const std::string& name);
+  void SwitchStage(int stage);
+
+  void SetCurrentFile(const std::string& fname);
+
+  // Called once per event, only looks at the clock every few hundred events
+  void Update(unsigned long long nevents) {
+    if (!active_) return;
+    nevents_ = nevents;
+    if ((nevents & 0xff) == 0) MaybeWrite();
+  }
+
+ private:
+
+  void MaybeWrite();
+  void WriteRecord(bool final);
+  static double GetRSSMB();
+
+  bool active_;
+  double interval_;
+  double window_;
+  std::ofstream out_;
+  std::string jobname_;
+  std::string curfile_;
+
+  unsigned long long nevents_;
+  clock::time_point tstart_;
+  clock::time_point tlastwrite_;
+  std::deque<std::pair<clock::time_point, unsigned long long>> history_;
+
+  int curstage_;
+  clock::time_point tstage_;
+  std::vector<std::string> stagenames_;
+  std::vector<double> stagetimes_;
+};
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef KinematicsCache_H
+#define KinematicsCache_H
+
+#include <cmath>
+#include <vector>
+#include <cstddef>
+
+//
+// Batched deltaR/deltaPhi matching on a struct-of-arrays cache of eta, phi and pt.
+// The babies store Cartesian four-vectors, so every p4.eta()/p4.phi() is a sinh/atan2 away;
+// the cache does that conversion once per object instead of once per pair, and the kernels
+// then run as plain loops over contiguous floats that the compiler vectorizes (-O2 -ftree-vectorize
+// or -O3). The matching cones are strict, an object at exactly dR = cone is not matched.
+//
+namespace kinem {
+
+  const float kPi = 3.14159265358979323846f;
+  const float kTwoPi = 2 * kPi;
+
+  // |phi1 - phi2| folded into [0, pi], for phi in [-pi, pi]
+  inline float deltaPhi(float phi1, float phi2) {
+    float dphi = std::fabs(phi1 - phi2);
+    return (dphi > kPi)? kTwoPi - dphi : dphi;
+  }
+
+  inline float deltaR2(float eta1, float phi1, float eta2, float phi2) {
+    float deta = eta1 - eta2;
+    float dphi = deltaPhi(phi1, phi2);
+    return deta*deta + dphi*dphi;
+  }
+
+  // One against N: dR^2 of (eta0, phi0) with the n entries, written to out
+  inline void deltaR2Kernel(float eta0, float phi0, const float* __restrict eta, const float* __restrict phi,
+                            size_t n, float* __restrict out) {
+    for (size_t i = 0; i < n; ++i) {
+      float deta = eta[i] - eta0;
+      // Branch-free fold of |dphi| from [0, 2pi] into [0, pi], keeps the loop vectorizable
+      float dphi = kPi - std::fabs(std::fabs(phi[i] - phi0) - kPi);
+      out[i] = deta*deta + dphi*dphi;
+    }
+  }
+
+  class EtaPhiCache {
+   public:
+    EtaPhiCache() {}
+    template<class LV> explicit EtaPhiCache(const std::vector<LV>& p4s) { Fill(p4s); }
+
+    template<class LV> void Fill(const std::vector<LV>& p4s) {
+      Clear();
+      Reserve(p4s.size());
+      for (const auto& p4 : p4s) PushBack(p4);
+    }
+    template<class LV> void PushBack(const LV& p4) {
+      eta_.push_back(p4.eta());
+      phi_.push_back(p4.phi());
+      pt_.push_back(p4.pt());
+    }
+    void PushBack(float eta, float phi, float pt) {
+      eta_.push_back(eta);
+      phi_.push_back(phi);
+      pt_.push_back(pt);
+    }
+    void Reserve(size_t n) { eta_.reserve(n); phi_.reserve(n); pt_.reserve(n); }
+    void Clear() { eta_.clear(); phi_.clear(); pt_.clear(); }
+
+    size_t Size() const { return eta_.size(); }
+    float Eta(size_t i) const { return eta_[i]; }
+    float Phi(size_t i) const { return phi_[i]; }
+    float Pt(size_t i) const { return pt_[i]; }
+    const float* Eta() const { return eta_.data(); }
+    const float* Phi() const { return phi_.data(); }
+    const float* Pt() const { return pt_.data(); }
+
+    // dR^2 of (eta0, phi0) to every entry, the buffer is reused by the next call
+    const std::vector<float>& DeltaR2(float eta0, float phi0) const {
+      dr2_.resize(Size());
+      deltaR2Kernel(eta0, phi0, eta_.data(), phi_.data(), Size(), dr2_.data());
+      return dr2_;
+    }
+
+    // Index of the closest entry within the cone and passing sel(i), -1 if none
+    template<class Sel> int Closest(float eta0, float phi0, float conesize, float* deltaR, Sel sel) const {
+      const std::vector<float>& dr2 = DeltaR2(eta0, phi0);
+      int imin = -1;
+      float dr2min = conesize*conesize;
+      for (size_t i = 0; i < dr2.size(); ++i) {
+        if (dr2[i] < dr2min && sel(i)) {
+          dr2min = dr2[i];
+          imin = i;
+        }
+      }
+      if (deltaR && imin >= 0) *deltaR = std::sqrt(dr2min);
+      return imin;
+    }
+    int Closest(float eta0, float phi0, float conesize, float* deltaR = nullptr) const {
+      return Closest(eta0, phi0, conesize, deltaR, [](size_t) { return true; });
+    }
+    template<class LV> int Closest(const LV& p4, float conesize, float* deltaR = nullptr) const {
+      return Closest(p4.eta(), p4.phi(), conesize, deltaR);
+    }
+
+    bool AnyWithin(float eta0, float phi0, float conesize) const {
+      const std::vector<float>& dr2 = DeltaR2(eta0, phi0);
+      const float cone2 = conesize*conesize;
+      bool any = false;
+      for (size_t i = 0; i < dr2.size(); ++i) any |= (dr2[i] < cone2);
+      return any;
+    }
+    template<class LV> bool AnyWithin(const LV& p4, float conesize) const { return AnyWithin(p4.eta(), p4.phi(), conesize); }
+
+   private:
+    std::vector<float> eta_;
+    std::vector<float> phi_;
+    std::vector<float> pt_;
+    mutable std::vector<float> dr2_;
+  };
+
+  // N against M: dR^2 of every pair, row-major in dr2[i * b.Size() + j]
+  inline void deltaR2Matrix(const EtaPhiCache& a, const EtaPhiCache& b, std::vector<float>& dr2) {
+    const size_t m = b.Size();
+    dr2.resize(a.Size() * m);
+    for (size_t i = 0; i < a.Size(); ++i)
+      deltaR2Kernel(a.Eta(i), a.Phi(i), b.Eta(), b.Phi(), m, dr2.data() + i*m);
+  }
+
+}
+
+#endif
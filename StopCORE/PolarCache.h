@@ -0,0 +1,53 @@
+#ifndef PolarCache_H
+#define PolarCache_H
+
+// C++
+#include <vector>
+#include <cstddef>
+
+//
+// Polar coordinates of the four-vectors of the babies. The p4 branches are stored as PxPyPzE, so
+// every pt()/eta()/phi()/M() goes through a sqrt, asinh or atan2; StopTree::<p4 branch>_polar()
+// computes them once per entry on the first call and hands out the cached floats after that.
+// The values are those of the LorentzVector methods, so they can replace the calls one to one.
+//
+
+struct PolarP4 {
+  float pt;
+  float eta;
+  float phi;
+  float mass;
+
+  template<class LV> void Fill(const LV& p4) {
+    pt = p4.pt();
+    eta = p4.eta();
+    phi = p4.phi();
+    mass = p4.M();
+  }
+};
+
+struct PolarArrays {
+  std::vector<float> pt;
+  std::vector<float> eta;
+  std::vector<float> phi;
+  std::vector<float> mass;
+
+  size_t size() const { return pt.size(); }
+
+  // Keeps the storage from one entry to the next
+  template<class LV> void Fill(const std::vector<LV>& p4s) {
+    const size_t n = p4s.size();
+    pt.resize(n);
+    eta.resize(n);
+    phi.resize(n);
+    mass.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+      pt[i] = p4s[i].pt();
+      eta[i] = p4s[i].eta();
+      phi[i] = p4s[i].phi();
+      mass[i] = p4s[i].M();
+    }
+  }
+};
+
+#endif
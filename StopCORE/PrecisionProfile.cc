@@ -0,0 +1,127 @@
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+#include <stdexcept>
+
+#include <fnmatch.h>
+
+#include "TBranch.h"
+#include "TBranchElement.h"
+#include "TClass.h"
+#include "TDataType.h"
+
+#include "PrecisionProfile.h"
+
+using namespace std;
+
+void PrecisionProfile::Load(const string& fname) {
+  ifstream fin(fname);
+  if (!fin) throw invalid_argument("[PrecisionProfile::Load] Cannot open profile " + fname + "!");
+  string line;
+  while (getline(fin, line)) {
+    if (line.find('#') != string::npos) line.erase(line.find('#'));
+    istringstream iss(line);
+    string word;
+    if (!(iss >> word)) continue;
+    if (word.front() == '[') {
+      if (word.back() != ']')
+        throw invalid_argument("[PrecisionProfile::Load] Bad group header " + word + " in " + fname + "!");
+      Group group = {word.substr(1, word.size()-2), 0, {}};
+      if (!(iss >> group.bits) || group.bits < 1)
+        throw invalid_argument("[PrecisionProfile::Load] No number of mantissa bits for group " + group.name + " in " + fname + "!");
+      groups_.push_back(group);
+    } else {
+      if (groups_.empty())
+        throw invalid_argument("[PrecisionProfile::Load] Branch " + word + " before any group in " + fname + "!");
+      groups_.back().patterns.push_back(word);
+    }
+  }
+}
+
+void PrecisionProfile::Attach(TTree* tree) {
+  TObjArray* branches = tree->GetListOfBranches();
+  for (int i = 0; i < branches->GetEntriesFast(); ++i) {
+    TBranch* branch = (TBranch*) branches->At(i);
+    const char* name = branch->GetName();
+
+    // The first group matching the branch is used
+    size_t igroup = groups_.size();
+    for (size_t g = 0; g < groups_.size() && igroup == groups_.size(); ++g) {
+      for (const string& pattern : groups_[g].patterns) {
+        if (fnmatch(pattern.c_str(), name, 0) == 0) {
+          igroup = g;
+          break;
+        }
+      }
+    }
+    if (igroup == groups_.size()) continue;
+
+    TClass* cl = nullptr;
+    EDataType type = kOther_t;
+    branch->GetExpectedType(cl, type);
+    Target target = {name, igroup, kFloat, nullptr, 0, 0};
+    if (!cl && type == kFloat_t) {
+      target.type = kFloat;
+      target.address = branch->GetAddress();
+    } else if (!cl && type == kDouble_t) {
+      target.type = kDouble;
+      target.address = branch->GetAddress();
+    } else if (cl && (string(cl->GetName()) == "vector<float>" || string(cl->GetName()) == "vector<double>")) {
+      target.type = (string(cl->GetName()) == "vector<float>")? kFloatVector : kDoubleVector;
+      target.address = ((TBranchElement*) branch)->GetObject();
+    } else {
+      cout << "[PrecisionProfile::Attach] >> Branch " << name << " is not of a floating point type, keeping it as it is" << endl;
+      continue;
+    }
+    if (!target.address)
+      throw logic_error(string("[PrecisionProfile::Attach] Branch ") + name + " has no address, attach the profile after registering the branches!");
+    targets_.push_back(target);
+  }
+}
+
+template<class T> void PrecisionProfile::RoundValue(T& value, Target& target, int bits) {
+  const T rounded = roundMantissa(value, bits);
+  if (rounded != value && value != 0) {
+    const double change = fabs((rounded - value) / value);
+    if (change > target.maxChange) {
+      target.maxChange = change;
+      target.maxChangeAt = value;
+    }
+  }
+  value = rounded;
+}
+
+void PrecisionProfile::Apply() {
+  for (Target& target : targets_) {
+    const int bits = groups_[target.group].bits;
+    switch (target.type) {
+      case kFloat:
+        RoundValue(*(float*) target.address, target, bits);
+        break;
+      case kDouble:
+        RoundValue(*(double*) target.address, target, bits);
+        break;
+      case kFloatVector:
+        for (float& value : *(vector<float>*) target.address) RoundValue(value, target, bits);
+        break;
+      case kDoubleVector:
+        for (double& value : *(vector<double>*) target.address) RoundValue(value, target, bits);
+        break;
+    }
+  }
+}
+
+void PrecisionProfile::PrintReport(ostream& os) const {
+  for (size_t g = 0; g < groups_.size(); ++g) {
+    os << "[PrecisionProfile] >> Group " << groups_[g].name << ", " << groups_[g].bits << " mantissa bits:" << endl;
+    double groupMax = 0;
+    for (const Target& target : targets_) {
+      if (target.group != g) continue;
+      os << "    " << left << setw(40) << target.name << right << " max relative change " << setw(10) << target.maxChange
+         << " (at " << target.maxChangeAt << ")" << endl;
+      groupMax = max(groupMax, target.maxChange);
+    }
+    os << "    largest in the group: " << groupMax << endl;
+  }
+}
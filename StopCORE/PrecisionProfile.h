@@ -0,0 +1,89 @@
+#ifndef PrecisionProfile_H
+#define PrecisionProfile_H
+
+// C++
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+// ROOT
+#include "TTree.h"
+
+//
+// Reduced precision of the float branches of the babies. Many of them (discriminators, jet energy
+// fractions and shapes, systematic weights, isolations) are stored with 23 bits of mantissa where
+// 10-12 are plenty. The profile groups the branches by wildcard patterns, each group with a number of
+// mantissa bits to keep:
+//   [discriminators] 12
+//   ak4pfjets_deepCSV*
+//   ak8pfjets_deepdisc_*
+// The babymaker attaches the profile to its trees once all the branches are registered, and the
+// matched float/double branches, scalars or vectors, get their values rounded to that many bits just
+// before each fill. The branches keep their type, so the readers need no change, while the zeroed low
+// bits of the mantissa compress to almost nothing. The largest relative change of each branch is
+// reported at the end of the job.
+//
+
+// Round to nearest (ties to even) keeping the given number of mantissa bits
+template<class T> struct FloatBits;
+template<> struct FloatBits<float> { typedef uint32_t type; static const int mantissa = 23; static const int exponent = 8; };
+template<> struct FloatBits<double> { typedef uint64_t type; static const int mantissa = 52; static const int exponent = 11; };
+
+template<class T> inline T roundMantissa(T x, int bits) {
+  typedef typename FloatBits<T>::type U;
+  const int drop = FloatBits<T>::mantissa - bits;
+  if (drop <= 0) return x;
+  U u;
+  std::memcpy(&u, &x, sizeof(T));
+  const U expmask = ((U(1) << FloatBits<T>::exponent) - 1) << FloatBits<T>::mantissa;
+  if ((u & expmask) == expmask) return x;  // inf and nan
+  U rounded = u + ((U(1) << (drop-1)) - 1) + ((u >> drop) & 1);
+  rounded &= ~((U(1) << drop) - 1);
+  if ((rounded & expmask) == expmask) rounded = u & ~((U(1) << drop) - 1);  // truncate rather than overflow
+  T y;
+  std::memcpy(&y, &rounded, sizeof(T));
+  return y;
+}
+
+class PrecisionProfile {
+ public:
+  PrecisionProfile() {}
+  ~PrecisionProfile() {}
+
+  void Load(const std::string& fname);
+  bool IsActive() const { return !groups_.empty(); }
+
+  // Find the branches of the tree in the profile, after all the branches got registered
+  void Attach(TTree* tree);
+
+  // Round the values of the attached branches, before filling the trees
+  void Apply();
+
+  // Largest relative change of each rounded branch, by group
+  void PrintReport(std::ostream& os = std::cout) const;
+
+ private:
+  struct Group {
+    std::string name;
+    int bits;
+    std::vector<std::string> patterns;
+  };
+  enum TargetType { kFloat, kDouble, kFloatVector, kDoubleVector };
+  struct Target {
+    std::string name;
+    size_t group;
+    TargetType type;
+    void* address;
+    double maxChange;     // largest relative change
+    double maxChangeAt;   // value it was seen at
+  };
+
+  template<class T> void RoundValue(T& value, Target& target, int bits);
+
+  std::vector<Group> groups_;
+  std::vector<Target> targets_;
+};
+
+#endif
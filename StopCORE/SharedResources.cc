@@ -0,0 +1,101 @@
+#include "SharedResources.h"
+
+// ROOT
+#include "TDirectory.h"
+#include "TString.h"
+
+// CORE
+#include "goodrun.h"
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////
+
+SharedResources& SharedResources::instance() {
+  static SharedResources resources;
+  return resources;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+TObject* SharedResources::GetObject(const string& fpath, const string& objname) {
+  ++nrequests_;
+  string key = fpath + ":" + objname;
+  auto iobj = objects_.find(key);
+  if (iobj != objects_.end()) return iobj->second;
+
+  // Don't let the opening of the file change the directory the looper is booking histograms in
+  TDirectory::TContext ctx;
+
+  TFile*& file = files_[fpath];
+  if (!file) {
+    file = new TFile(fpath.c_str(), "READ");
+    if (file->IsZombie())
+      cout << "[SharedResources::GetObject] >> Cannot open file " << fpath << "!!" << endl;
+  }
+
+  TObject* obj = (file->IsZombie())? nullptr : file->Get(objname.c_str());
+  if (!obj) cout << "[SharedResources::GetObject] >> Cannot find " << objname << " in " << fpath << "!!" << endl;
+  objects_[key] = obj;  // also remember the missing ones
+  ++nloads_;
+
+  return obj;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+eventWeight_bTagSF* SharedResources::GetBTagSFUtil(bool isFastsim) {
+  ++nrequests_;
+  eventWeight_bTagSF*& util = btagsf_[isFastsim];
+  if (!util) {
+    TDirectory::TContext ctx;
+    util = new eventWeight_bTagSF(isFastsim);
+    ++nloads_;
+  }
+  return util;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+eventWeight_lepSF* SharedResources::GetLepSFUtil(bool isFastsim, int year, const string& path) {
+  ++nrequests_;
+  eventWeight_lepSF*& util = lepsf_[Form("%d_%d_%s", isFastsim, year, path.c_str())];
+  if (!util) {
+    TDirectory::TContext ctx;
+    util = new eventWeight_lepSF();
+    util->setup(isFastsim, year, path.c_str());
+    ++nloads_;
+  }
+  return util;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+ResolvedTopMVA* SharedResources::GetResTopMVA(const string& weightfile, const string& mvaname) {
+  ++nrequests_;
+  ResolvedTopMVA*& mva = topmva_[weightfile + ":" + mvaname];
+  if (!mva) {
+    TDirectory::TContext ctx;
+    mva = new ResolvedTopMVA(weightfile.c_str(), mvaname.c_str());
+    ++nloads_;
+  }
+  return mva;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void SharedResources::LoadGoodRunList(const string& json_file) {
+  ++nrequests_;
+  if (json_file == goodrun_file_) return;
+  cout << "Loading json file: " << json_file << endl;
+  set_goodrun_file(json_file.c_str());
+  goodrun_file_ = json_file;
+  ++nloads_;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void SharedResources::PrintSummary() const {
+  cout << "[SharedResources] >> " << nloads_ << " resources loaded for " << nrequests_ << " requests, from "
+       << files_.size() << " files" << endl;
+}
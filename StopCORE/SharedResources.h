@@ -0,0 +1,65 @@
+#ifndef SharedResources_H
+#define SharedResources_H
+
+// ROOT
+#include "TFile.h"
+#include "TObject.h"
+
+// C
+#include <string>
+#include <map>
+
+#include "eventWeight_bTagSF.h"
+#include "eventWeight_lepSF.h"
+#include "TopTagger/ResolvedTopMVA.h"
+
+//
+// CLASS
+//
+// Process wide registry of the immutable inputs of the looper: SF and xsec histograms,
+// the lepton and btag SF tools, the MVA readers and the good-run json. Everything is
+// loaded on first request and then shared by every looper / evtWgtInfo instance of the
+// process, so running over many samples in one job does not repeat the setup for each.
+// The returned objects are owned by the registry and must be treated as read-only.
+//
+class SharedResources {
+
+ public:
+
+  static SharedResources& instance();
+
+  // Object from a ROOT file, the file is opened only once and kept open. Returns nullptr if not found.
+  template<class T> T* Get(const std::string& fpath, const std::string& objname) {
+    return dynamic_cast<T*>(GetObject(fpath, objname));
+  }
+
+  eventWeight_bTagSF* GetBTagSFUtil(bool isFastsim);
+  eventWeight_lepSF* GetLepSFUtil(bool isFastsim, int year, const std::string& path);
+  ResolvedTopMVA* GetResTopMVA(const std::string& weightfile, const std::string& mvaname);
+
+  // The json is only loaded again if a different file is requested
+  void LoadGoodRunList(const std::string& json_file);
+
+  void PrintSummary() const;
+
+ private:
+
+  SharedResources() : nloads_(0), nrequests_(0) {}
+  ~SharedResources() {}  // files and tools are left for ROOT to clean up at exit
+  SharedResources(const SharedResources&) = delete;
+  SharedResources& operator=(const SharedResources&) = delete;
+
+  TObject* GetObject(const std::string& fpath, const std::string& objname);
+
+  std::map<std::string, TFile*> files_;
+  std::map<std::string, TObject*> objects_;
+  std::map<bool, eventWeight_bTagSF*> btagsf_;
+  std::map<std::string, eventWeight_lepSF*> lepsf_;
+  std::map<std::string, ResolvedTopMVA*> topmva_;
+  std::string goodrun_file_;
+
+  unsigned int nloads_;
+  unsigned int nrequests_;
+};
+
+#endif
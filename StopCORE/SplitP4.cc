@@ -0,0 +1,66 @@
+#include "SplitP4.h"
+
+using namespace std;
+
+void SplitP4Writer::Branch(TTree* tree, const string& name, vector<LorentzVectorF>* p4s) {
+  if (!split_) {
+    tree->Branch(name.c_str(), p4s);
+    return;
+  }
+  columns_.emplace_back();
+  Columns& columns = columns_.back();
+  columns.p4s = p4s;
+  for (int i = 0; i < 4; ++i)
+    tree->Branch((name + kSplitP4Suffixes[i]).c_str(), &columns.values[i]);
+}
+
+void SplitP4Writer::Fill() {
+  for (Columns& columns : columns_) {
+    const size_t n = columns.p4s->size();
+    for (int i = 0; i < 4; ++i) columns.values[i].resize(n);
+    for (size_t j = 0; j < n; ++j) {
+      const LorentzVectorF& p4 = (*columns.p4s)[j];
+      columns.values[0][j] = p4.px();
+      columns.values[1][j] = p4.py();
+      columns.values[2][j] = p4.pz();
+      columns.values[3][j] = p4.E();
+    }
+  }
+}
+
+bool SplitP4Reader::Init(TTree* tree, const string& name) {
+  readEntry_ = -1;
+  builtEntry_ = -1;
+  for (int i = 0; i < 4; ++i) {
+    branches_[i] = tree->GetBranch((name + kSplitP4Suffixes[i]).c_str());
+    if (!branches_[i]) {
+      branches_[0] = nullptr;
+      return false;
+    }
+  }
+  for (int i = 0; i < 4; ++i)
+    branches_[i]->SetAddress(&values_[i]);
+  return true;
+}
+
+void SplitP4Reader::ReadColumns(Long64_t entry) {
+  if (entry == readEntry_) return;
+  for (int i = 0; i < 4; ++i)
+    branches_[i]->GetEntry(entry);
+  readEntry_ = entry;
+}
+
+vector<LorentzVectorF>& SplitP4Reader::GetP4s(Long64_t entry) {
+  if (entry == builtEntry_) return p4s_;
+  ReadColumns(entry);
+  const size_t n = values_[0]->size();
+  p4s_.resize(n);
+  for (size_t j = 0; j < n; ++j)
+    p4s_[j].SetCoordinates((*values_[0])[j], (*values_[1])[j], (*values_[2])[j], (*values_[3])[j]);
+  builtEntry_ = entry;
+  return p4s_;
+}
+
+void SplitP4Reader::GetPolar(Long64_t entry, PolarArrays& polar) {
+  polar.Fill(GetP4s(entry));
+}
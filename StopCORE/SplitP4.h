@@ -0,0 +1,82 @@
+#ifndef SplitP4_H
+#define SplitP4_H
+
+// C++
+#include <string>
+#include <vector>
+#include <deque>
+
+// ROOT
+#include "TTree.h"
+#include "TBranch.h"
+#include "Math/Vector4D.h"
+
+#include "PolarCache.h"
+
+//
+// Four-vector collections of the babies stored as split float columns. A vector<LorentzVector> branch
+// <name> is written as the vector<float> branches <name>_px, <name>_py, <name>_pz and <name>_e, which
+// avoid the streamer of the LorentzVector objects and compress better. These are the coordinates of the
+// PxPyPzE4D<float> vectors themselves, so the collections are rebuilt bit for bit. The babymaker registers
+// the collections with a SplitP4Writer, and StopTree reads them back with a SplitP4Reader when a baby has
+// the columns instead of the <name> branch: the LorentzVectors are only rebuilt when the collection or
+// its <name>_polar() cache is accessed.
+//
+
+typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > LorentzVectorF;
+
+const char* const kSplitP4Suffixes[4] = {"_px", "_py", "_pz", "_e"};
+
+class SplitP4Writer {
+ public:
+  SplitP4Writer() : split_(false) {}
+
+  void SetSplit(bool split) { split_ = split; }
+  bool IsSplit() const { return split_; }
+
+  // The branch of the collection, or its split columns
+  void Branch(TTree* tree, const std::string& name, std::vector<LorentzVectorF>* p4s);
+
+  // Fill the columns of all the registered collections, before filling the trees
+  void Fill();
+
+ private:
+  struct Columns {
+    std::vector<LorentzVectorF>* p4s;
+    std::vector<float> values[4];
+  };
+
+  bool split_;
+  std::deque<Columns> columns_;  // keeps the addresses given to the branches
+};
+
+// Register a collection with the writer if there is one, as a single branch otherwise
+inline void branchP4s(TTree* tree, const std::string& name, std::vector<LorentzVectorF>* p4s, SplitP4Writer* writer) {
+  if (writer) writer->Branch(tree, name, p4s);
+  else tree->Branch(name.c_str(), p4s);
+}
+
+class SplitP4Reader {
+ public:
+  SplitP4Reader() : readEntry_(-1), builtEntry_(-1) {
+    for (int i = 0; i < 4; ++i) { branches_[i] = nullptr; values_[i] = nullptr; }
+  }
+
+  // Connect to the columns of the collection in the tree, false if it doesn't have them
+  bool Init(TTree* tree, const std::string& name);
+  bool IsActive() const { return branches_[0] != nullptr; }
+
+  std::vector<LorentzVectorF>& GetP4s(Long64_t entry);
+  void GetPolar(Long64_t entry, PolarArrays& polar);
+
+ private:
+  void ReadColumns(Long64_t entry);
+
+  TBranch* branches_[4];
+  std::vector<float>* values_[4];
+  std::vector<LorentzVectorF> p4s_;
+  Long64_t readEntry_;
+  Long64_t builtEntry_;
+};
+
+#endif
@@ -2,6 +2,645 @@
 StopTree babyAnalyzer;
 
 void StopTree::Init(TTree *tree) {
+  lep1_p4_polarGen = 0;
+  lep1_mcp4_polarGen = 0;
+  lep2_p4_polarGen = 0;
+  lep2_mcp4_polarGen = 0;
+  ph_p4_polarGen = 0;
+  ph_mcp4_polarGen = 0;
+  ak4pfjets_p4_polarGen = 0;
+  ak4pfjets_leadMEDbjet_p4_polarGen = 0;
+  ak4pfjets_leadbtag_p4_polarGen = 0;
+  ak4genjets_p4_polarGen = 0;
+  softtags_p4_polarGen = 0;
+  jup_ak4pfjets_p4_polarGen = 0;
+  jup_ak4pfjets_leadMEDbjet_p4_polarGen = 0;
+  jup_ak4pfjets_leadbtag_p4_polarGen = 0;
+  jup_ak4genjets_p4_polarGen = 0;
+  jup_softtags_p4_polarGen = 0;
+  jdown_ak4pfjets_p4_polarGen = 0;
+  jdown_ak4pfjets_leadMEDbjet_p4_polarGen = 0;
+  jdown_ak4pfjets_leadbtag_p4_polarGen = 0;
+  jdown_ak4genjets_p4_polarGen = 0;
+  jdown_softtags_p4_polarGen = 0;
+  genleps_p4_polarGen = 0;
+  genleps_motherp4_polarGen = 0;
+  genleps_gmotherp4_polarGen = 0;
+  gennus_p4_polarGen = 0;
+  gennus_motherp4_polarGen = 0;
+  gennus_gmotherp4_polarGen = 0;
+  genqs_p4_polarGen = 0;
+  genqs_motherp4_polarGen = 0;
+  genqs_gmotherp4_polarGen = 0;
+  genbosons_p4_polarGen = 0;
+  genbosons_motherp4_polarGen = 0;
+  genbosons_gmotherp4_polarGen = 0;
+  gensusy_p4_polarGen = 0;
+  gensusy_motherp4_polarGen = 0;
+  gensusy_gmotherp4_polarGen = 0;
+  ak8pfjets_p4_polarGen = 0;
+  jup_ak8pfjets_p4_polarGen = 0;
+  jdown_ak8pfjets_p4_polarGen = 0;
+  topcands_p4_polarGen = 0;
+  topcands_Wp4_polarGen = 0;
+  tftops_p4_polarGen = 0;
+  jup_topcands_p4_polarGen = 0;
+  jup_topcands_Wp4_polarGen = 0;
+  jup_tftops_p4_polarGen = 0;
+  jdown_topcands_p4_polarGen = 0;
+  jdown_topcands_Wp4_polarGen = 0;
+  jdown_tftops_p4_polarGen = 0;
+  tau_p4_polarGen = 0;
+  isoTracks_p4_polarGen = 0;
+  run_loadedGen = 0;
+  ls_loadedGen = 0;
+  evt_loadedGen = 0;
+  nvtxs_loadedGen = 0;
+  year_loadedGen = 0;
+  sampver_loadedGen = 0;
+  pu_nvtxs_loadedGen = 0;
+  pfmet_loadedGen = 0;
+  pfmet_phi_loadedGen = 0;
+  pfmet_jup_loadedGen = 0;
+  pfmet_phi_jup_loadedGen = 0;
+  pfmet_jdown_loadedGen = 0;
+  pfmet_phi_jdown_loadedGen = 0;
+  pfmet_rl_loadedGen = 0;
+  pfmet_phi_rl_loadedGen = 0;
+  pfmet_rl_jup_loadedGen = 0;
+  pfmet_phi_rl_jup_loadedGen = 0;
+  pfmet_rl_jdown_loadedGen = 0;
+  pfmet_phi_rl_jdown_loadedGen = 0;
+  pfmet_egclean_loadedGen = 0;
+  pfmet_egclean_phi_loadedGen = 0;
+  pfmet_muegclean_loadedGen = 0;
+  pfmet_muegclean_phi_loadedGen = 0;
+  pfmet_muegcleanfix_loadedGen = 0;
+  pfmet_muegcleanfix_phi_loadedGen = 0;
+  pfmet_uncorr_loadedGen = 0;
+  pfmet_uncorr_phi_loadedGen = 0;
+  pfmet_original_loadedGen = 0;
+  pfmet_original_phi_loadedGen = 0;
+  scale1fb_loadedGen = 0;
+  xsec_loadedGen = 0;
+  xsec_uncert_loadedGen = 0;
+  kfactor_loadedGen = 0;
+  pu_ntrue_loadedGen = 0;
+  ngoodleps_loadedGen = 0;
+  nlooseleps_loadedGen = 0;
+  nvetoleps_loadedGen = 0;
+  is_data_loadedGen = 0;
+  dataset_loadedGen = 0;
+  filename_loadedGen = 0;
+  cms3tag_loadedGen = 0;
+  nEvents_loadedGen = 0;
+  nEvents_goodvtx_loadedGen = 0;
+  nEvents_MET30_loadedGen = 0;
+  nEvents_1goodlep_loadedGen = 0;
+  nEvents_2goodjets_loadedGen = 0;
+  is0lep_loadedGen = 0;
+  is1lep_loadedGen = 0;
+  is2lep_loadedGen = 0;
+  isZtoNuNu_loadedGen = 0;
+  is1lepFromW_loadedGen = 0;
+  is1lepFromTop_loadedGen = 0;
+  MT2W_loadedGen = 0;
+  MT2W_rl_loadedGen = 0;
+  MT2_ll_loadedGen = 0;
+  mindphi_met_j1_j2_loadedGen = 0;
+  mindphi_met_j1_j2_rl_loadedGen = 0;
+  mt_met_lep_loadedGen = 0;
+  mt_met_lep_rl_loadedGen = 0;
+  MT2W_jup_loadedGen = 0;
+  MT2W_rl_jup_loadedGen = 0;
+  MT2_ll_jup_loadedGen = 0;
+  mindphi_met_j1_j2_jup_loadedGen = 0;
+  mindphi_met_j1_j2_rl_jup_loadedGen = 0;
+  mt_met_lep_jup_loadedGen = 0;
+  mt_met_lep_rl_jup_loadedGen = 0;
+  MT2W_jdown_loadedGen = 0;
+  MT2W_rl_jdown_loadedGen = 0;
+  MT2_ll_jdown_loadedGen = 0;
+  mindphi_met_j1_j2_jdown_loadedGen = 0;
+  mindphi_met_j1_j2_rl_jdown_loadedGen = 0;
+  mt_met_lep_jdown_loadedGen = 0;
+  mt_met_lep_rl_jdown_loadedGen = 0;
+  hadronic_top_chi2_loadedGen = 0;
+  ak4pfjets_rho_loadedGen = 0;
+  pdf_up_weight_loadedGen = 0;
+  pdf_down_weight_loadedGen = 0;
+  genweightsID_loadedGen = 0;
+  ngenweights_loadedGen = 0;
+  genweights_loadedGen = 0;
+  weight_Q2_up_loadedGen = 0;
+  weight_Q2_down_loadedGen = 0;
+  weight_alphas_up_loadedGen = 0;
+  weight_alphas_down_loadedGen = 0;
+  weight_btagsf_loadedGen = 0;
+  weight_btagsf_heavy_UP_loadedGen = 0;
+  weight_btagsf_light_UP_loadedGen = 0;
+  weight_btagsf_heavy_DN_loadedGen = 0;
+  weight_btagsf_light_DN_loadedGen = 0;
+  weight_btagsf_fastsim_UP_loadedGen = 0;
+  weight_btagsf_fastsim_DN_loadedGen = 0;
+  weight_analysisbtagsf_loadedGen = 0;
+  weight_analysisbtagsf_heavy_UP_loadedGen = 0;
+  weight_analysisbtagsf_light_UP_loadedGen = 0;
+  weight_analysisbtagsf_heavy_DN_loadedGen = 0;
+  weight_analysisbtagsf_light_DN_loadedGen = 0;
+  weight_analysisbtagsf_fastsim_UP_loadedGen = 0;
+  weight_analysisbtagsf_fastsim_DN_loadedGen = 0;
+  weight_tightbtagsf_loadedGen = 0;
+  weight_tightbtagsf_heavy_UP_loadedGen = 0;
+  weight_tightbtagsf_light_UP_loadedGen = 0;
+  weight_tightbtagsf_heavy_DN_loadedGen = 0;
+  weight_tightbtagsf_light_DN_loadedGen = 0;
+  weight_tightbtagsf_fastsim_UP_loadedGen = 0;
+  weight_tightbtagsf_fastsim_DN_loadedGen = 0;
+  weight_loosebtagsf_loadedGen = 0;
+  weight_loosebtagsf_heavy_UP_loadedGen = 0;
+  weight_loosebtagsf_light_UP_loadedGen = 0;
+  weight_loosebtagsf_heavy_DN_loadedGen = 0;
+  weight_loosebtagsf_light_DN_loadedGen = 0;
+  weight_loosebtagsf_fastsim_UP_loadedGen = 0;
+  weight_loosebtagsf_fastsim_DN_loadedGen = 0;
+  weight_lepSF_loadedGen = 0;
+  weight_lepSF_up_loadedGen = 0;
+  weight_lepSF_down_loadedGen = 0;
+  weight_vetoLepSF_loadedGen = 0;
+  weight_vetoLepSF_up_loadedGen = 0;
+  weight_vetoLepSF_down_loadedGen = 0;
+  weight_lepSF_fastSim_loadedGen = 0;
+  weight_lepSF_fastSim_up_loadedGen = 0;
+  weight_lepSF_fastSim_down_loadedGen = 0;
+  weight_ISR_loadedGen = 0;
+  weight_ISRup_loadedGen = 0;
+  weight_ISRdown_loadedGen = 0;
+  weight_PU_loadedGen = 0;
+  weight_PUup_loadedGen = 0;
+  weight_PUdown_loadedGen = 0;
+  weight_ISRnjets_loadedGen = 0;
+  weight_ISRnjets_UP_loadedGen = 0;
+  weight_ISRnjets_DN_loadedGen = 0;
+  weight_L1prefire_loadedGen = 0;
+  weight_L1prefire_UP_loadedGen = 0;
+  weight_L1prefire_DN_loadedGen = 0;
+  NISRjets_loadedGen = 0;
+  NnonISRjets_loadedGen = 0;
+  sparms_names_loadedGen = 0;
+  sparms_values_loadedGen = 0;
+  sparms_subProcessId_loadedGen = 0;
+  mass_lsp_loadedGen = 0;
+  mass_chargino_loadedGen = 0;
+  mass_stop_loadedGen = 0;
+  mass_gluino_loadedGen = 0;
+  genmet_loadedGen = 0;
+  genmet_phi_loadedGen = 0;
+  nupt_loadedGen = 0;
+  genht_loadedGen = 0;
+  PassTrackVeto_loadedGen = 0;
+  PassTauVeto_loadedGen = 0;
+  topness_loadedGen = 0;
+  topnessMod_loadedGen = 0;
+  topnessMod_rl_loadedGen = 0;
+  topnessMod_jup_loadedGen = 0;
+  topnessMod_rl_jup_loadedGen = 0;
+  topnessMod_jdown_loadedGen = 0;
+  topnessMod_rl_jdown_loadedGen = 0;
+  Mlb_closestb_loadedGen = 0;
+  Mlb_lead_bdiscr_loadedGen = 0;
+  Mlb_closestb_jup_loadedGen = 0;
+  Mlb_lead_bdiscr_jup_loadedGen = 0;
+  Mlb_closestb_jdown_loadedGen = 0;
+  Mlb_lead_bdiscr_jdown_loadedGen = 0;
+  HLT_SingleEl_loadedGen = 0;
+  HLT_SingleMu_loadedGen = 0;
+  HLT_MET_loadedGen = 0;
+  HLT_MET_MHT_loadedGen = 0;
+  HLT_MET100_MHT100_loadedGen = 0;
+  HLT_MET110_MHT110_loadedGen = 0;
+  HLT_MET120_MHT120_loadedGen = 0;
+  HLT_MET130_MHT130_loadedGen = 0;
+  HLT_PFHT_unprescaled_loadedGen = 0;
+  HLT_PFHT_prescaled_loadedGen = 0;
+  HLT_AK8Jet_unprescaled_loadedGen = 0;
+  HLT_AK8Jet_prescaled_loadedGen = 0;
+  HLT_CaloJet500_NoJetID_loadedGen = 0;
+  HLT_DiEl_loadedGen = 0;
+  HLT_DiMu_loadedGen = 0;
+  HLT_MuE_loadedGen = 0;
+  nPhotons_loadedGen = 0;
+  ph_ngoodjets_loadedGen = 0;
+  ph_ngoodbtags_loadedGen = 0;
+  hardgenpt_loadedGen = 0;
+  calomet_loadedGen = 0;
+  calomet_phi_loadedGen = 0;
+  lep1_pdgid_loadedGen = 0;
+  lep1_production_type_loadedGen = 0;
+  lep1_MiniIso_loadedGen = 0;
+  lep1_relIso_loadedGen = 0;
+  lep1_passLooseID_loadedGen = 0;
+  lep1_passMediumID_loadedGen = 0;
+  lep1_passTightID_loadedGen = 0;
+  lep1_passVeto_loadedGen = 0;
+  lep1_p4_loadedGen = 0;
+  lep1_mcp4_loadedGen = 0;
+  lep1_mc_motherid_loadedGen = 0;
+  lep1_etaSC_loadedGen = 0;
+  lep1_dphiMET_loadedGen = 0;
+  lep1_dphiMET_jup_loadedGen = 0;
+  lep1_dphiMET_jdown_loadedGen = 0;
+  lep1_dphiMET_rl_loadedGen = 0;
+  lep1_dphiMET_rl_jup_loadedGen = 0;
+  lep1_dphiMET_rl_jdown_loadedGen = 0;
+  lep2_pdgid_loadedGen = 0;
+  lep2_production_type_loadedGen = 0;
+  lep2_MiniIso_loadedGen = 0;
+  lep2_relIso_loadedGen = 0;
+  lep2_passLooseID_loadedGen = 0;
+  lep2_passMediumID_loadedGen = 0;
+  lep2_passTightID_loadedGen = 0;
+  lep2_passVeto_loadedGen = 0;
+  lep2_p4_loadedGen = 0;
+  lep2_mcp4_loadedGen = 0;
+  lep2_mc_motherid_loadedGen = 0;
+  lep2_etaSC_loadedGen = 0;
+  lep2_dphiMET_loadedGen = 0;
+  lep2_dphiMET_jup_loadedGen = 0;
+  lep2_dphiMET_jdown_loadedGen = 0;
+  lep2_dphiMET_rl_loadedGen = 0;
+  lep2_dphiMET_rl_jup_loadedGen = 0;
+  lep2_dphiMET_rl_jdown_loadedGen = 0;
+  ph_sigmaIEtaEta_fill5x5_loadedGen = 0;
+  ph_hOverE_loadedGen = 0;
+  ph_r9_loadedGen = 0;
+  ph_chiso_loadedGen = 0;
+  ph_nhiso_loadedGen = 0;
+  ph_phiso_loadedGen = 0;
+  ph_passLooseID_loadedGen = 0;
+  ph_passMediumID_loadedGen = 0;
+  ph_passTightID_loadedGen = 0;
+  ph_overlapJetId_loadedGen = 0;
+  ph_p4_loadedGen = 0;
+  ph_mcp4_loadedGen = 0;
+  ph_mcMatchId_loadedGen = 0;
+  ph_genIso04_loadedGen = 0;
+  ph_drMinParton_loadedGen = 0;
+  nskimjets_loadedGen = 0;
+  nskimbtagmed_loadedGen = 0;
+  nskimbtagloose_loadedGen = 0;
+  nskimbtagtight_loadedGen = 0;
+  ngoodjets_loadedGen = 0;
+  ngoodbtags_loadedGen = 0;
+  nloosebtags_loadedGen = 0;
+  ntightbtags_loadedGen = 0;
+  nanalysisbtags_loadedGen = 0;
+  ak4_HT_loadedGen = 0;
+  ak4_htratiom_loadedGen = 0;
+  dphi_ak4pfjet_met_loadedGen = 0;
+  ak4pfjets_p4_loadedGen = 0;
+  ak4pfjets_passMEDbtag_loadedGen = 0;
+  ak4pfjets_deepCSV_loadedGen = 0;
+  ak4pfjets_CSV_loadedGen = 0;
+  ak4pfjets_mva_loadedGen = 0;
+  ak4pfjets_parton_flavor_loadedGen = 0;
+  ak4pfjets_hadron_flavor_loadedGen = 0;
+  ak4pfjets_loose_puid_loadedGen = 0;
+  ak4pfjets_loose_pfid_loadedGen = 0;
+  ak4pfjets_leadMEDbjet_p4_loadedGen = 0;
+  ak4pfjets_leadbtag_p4_loadedGen = 0;
+  ak4genjets_p4_loadedGen = 0;
+  softtags_p4_loadedGen = 0;
+  nsoftbtags_loadedGen = 0;
+  jup_nskimjets_loadedGen = 0;
+  jup_nskimbtagmed_loadedGen = 0;
+  jup_nskimbtagloose_loadedGen = 0;
+  jup_nskimbtagtight_loadedGen = 0;
+  jup_ngoodjets_loadedGen = 0;
+  jup_ngoodbtags_loadedGen = 0;
+  jup_nloosebtags_loadedGen = 0;
+  jup_ntightbtags_loadedGen = 0;
+  jup_nanalysisbtags_loadedGen = 0;
+  jup_ak4_HT_loadedGen = 0;
+  jup_ak4_htratiom_loadedGen = 0;
+  jup_dphi_ak4pfjet_met_loadedGen = 0;
+  jup_ak4pfjets_p4_loadedGen = 0;
+  jup_ak4pfjets_passMEDbtag_loadedGen = 0;
+  jup_ak4pfjets_deepCSV_loadedGen = 0;
+  jup_ak4pfjets_CSV_loadedGen = 0;
+  jup_ak4pfjets_mva_loadedGen = 0;
+  jup_ak4pfjets_parton_flavor_loadedGen = 0;
+  jup_ak4pfjets_hadron_flavor_loadedGen = 0;
+  jup_ak4pfjets_loose_puid_loadedGen = 0;
+  jup_ak4pfjets_loose_pfid_loadedGen = 0;
+  jup_ak4pfjets_leadMEDbjet_p4_loadedGen = 0;
+  jup_ak4pfjets_leadbtag_p4_loadedGen = 0;
+  jup_ak4genjets_p4_loadedGen = 0;
+  jup_softtags_p4_loadedGen = 0;
+  jup_nsoftbtags_loadedGen = 0;
+  jdown_nskimjets_loadedGen = 0;
+  jdown_nskimbtagmed_loadedGen = 0;
+  jdown_nskimbtagloose_loadedGen = 0;
+  jdown_nskimbtagtight_loadedGen = 0;
+  jdown_ngoodjets_loadedGen = 0;
+  jdown_ngoodbtags_loadedGen = 0;
+  jdown_nloosebtags_loadedGen = 0;
+  jdown_ntightbtags_loadedGen = 0;
+  jdown_nanalysisbtags_loadedGen = 0;
+  jdown_ak4_HT_loadedGen = 0;
+  jdown_ak4_htratiom_loadedGen = 0;
+  jdown_dphi_ak4pfjet_met_loadedGen = 0;
+  jdown_ak4pfjets_p4_loadedGen = 0;
+  jdown_ak4pfjets_passMEDbtag_loadedGen = 0;
+  jdown_ak4pfjets_deepCSV_loadedGen = 0;
+  jdown_ak4pfjets_CSV_loadedGen = 0;
+  jdown_ak4pfjets_mva_loadedGen = 0;
+  jdown_ak4pfjets_parton_flavor_loadedGen = 0;
+  jdown_ak4pfjets_hadron_flavor_loadedGen = 0;
+  jdown_ak4pfjets_loose_puid_loadedGen = 0;
+  jdown_ak4pfjets_loose_pfid_loadedGen = 0;
+  jdown_ak4pfjets_leadMEDbjet_p4_loadedGen = 0;
+  jdown_ak4pfjets_leadbtag_p4_loadedGen = 0;
+  jdown_ak4genjets_p4_loadedGen = 0;
+  jdown_softtags_p4_loadedGen = 0;
+  jdown_nsoftbtags_loadedGen = 0;
+  genleps_isfromt_loadedGen = 0;
+  genleps_p4_loadedGen = 0;
+  genleps_id_loadedGen = 0;
+  genleps__genpsidx_loadedGen = 0;
+  genleps_status_loadedGen = 0;
+  genleps_fromHardProcessDecayed_loadedGen = 0;
+  genleps_fromHardProcessFinalState_loadedGen = 0;
+  genleps_isHardProcess_loadedGen = 0;
+  genleps_isLastCopy_loadedGen = 0;
+  genleps_gentaudecay_loadedGen = 0;
+  gen_nfromtleps__loadedGen = 0;
+  genleps_motherp4_loadedGen = 0;
+  genleps_motherid_loadedGen = 0;
+  genleps_motheridx_loadedGen = 0;
+  genleps_motherstatus_loadedGen = 0;
+  genleps_gmotherp4_loadedGen = 0;
+  genleps_gmotherid_loadedGen = 0;
+  genleps_gmotheridx_loadedGen = 0;
+  genleps_gmotherstatus_loadedGen = 0;
+  gennus_isfromt_loadedGen = 0;
+  gennus_p4_loadedGen = 0;
+  gennus_id_loadedGen = 0;
+  gennus__genpsidx_loadedGen = 0;
+  gennus_status_loadedGen = 0;
+  gennus_fromHardProcessDecayed_loadedGen = 0;
+  gennus_fromHardProcessFinalState_loadedGen = 0;
+  gennus_isHardProcess_loadedGen = 0;
+  gennus_isLastCopy_loadedGen = 0;
+  gennus_gentaudecay_loadedGen = 0;
+  gen_nfromtnus__loadedGen = 0;
+  gennus_motherp4_loadedGen = 0;
+  gennus_motherid_loadedGen = 0;
+  gennus_motheridx_loadedGen = 0;
+  gennus_motherstatus_loadedGen = 0;
+  gennus_gmotherp4_loadedGen = 0;
+  gennus_gmotherid_loadedGen = 0;
+  gennus_gmotheridx_loadedGen = 0;
+  gennus_gmotherstatus_loadedGen = 0;
+  genqs_isfromt_loadedGen = 0;
+  genqs_p4_loadedGen = 0;
+  genqs_id_loadedGen = 0;
+  genqs__genpsidx_loadedGen = 0;
+  genqs_status_loadedGen = 0;
+  genqs_fromHardProcessDecayed_loadedGen = 0;
+  genqs_fromHardProcessFinalState_loadedGen = 0;
+  genqs_isHardProcess_loadedGen = 0;
+  genqs_isLastCopy_loadedGen = 0;
+  genqs_gentaudecay_loadedGen = 0;
+  gen_nfromtqs__loadedGen = 0;
+  genqs_motherp4_loadedGen = 0;
+  genqs_motherid_loadedGen = 0;
+  genqs_motheridx_loadedGen = 0;
+  genqs_motherstatus_loadedGen = 0;
+  genqs_gmotherp4_loadedGen = 0;
+  genqs_gmotherid_loadedGen = 0;
+  genqs_gmotheridx_loadedGen = 0;
+  genqs_gmotherstatus_loadedGen = 0;
+  genbosons_isfromt_loadedGen = 0;
+  genbosons_p4_loadedGen = 0;
+  genbosons_id_loadedGen = 0;
+  genbosons__genpsidx_loadedGen = 0;
+  genbosons_status_loadedGen = 0;
+  genbosons_fromHardProcessDecayed_loadedGen = 0;
+  genbosons_fromHardProcessFinalState_loadedGen = 0;
+  genbosons_isHardProcess_loadedGen = 0;
+  genbosons_isLastCopy_loadedGen = 0;
+  genbosons_gentaudecay_loadedGen = 0;
+  gen_nfromtbosons__loadedGen = 0;
+  genbosons_motherp4_loadedGen = 0;
+  genbosons_motherid_loadedGen = 0;
+  genbosons_motheridx_loadedGen = 0;
+  genbosons_motherstatus_loadedGen = 0;
+  genbosons_gmotherp4_loadedGen = 0;
+  genbosons_gmotherid_loadedGen = 0;
+  genbosons_gmotheridx_loadedGen = 0;
+  genbosons_gmotherstatus_loadedGen = 0;
+  gensusy_isfromt_loadedGen = 0;
+  gensusy_p4_loadedGen = 0;
+  gensusy_id_loadedGen = 0;
+  gensusy__genpsidx_loadedGen = 0;
+  gensusy_status_loadedGen = 0;
+  gensusy_fromHardProcessDecayed_loadedGen = 0;
+  gensusy_fromHardProcessFinalState_loadedGen = 0;
+  gensusy_isHardProcess_loadedGen = 0;
+  gensusy_isLastCopy_loadedGen = 0;
+  gensusy_gentaudecay_loadedGen = 0;
+  gen_nfromtsusy__loadedGen = 0;
+  gensusy_motherp4_loadedGen = 0;
+  gensusy_motherid_loadedGen = 0;
+  gensusy_motheridx_loadedGen = 0;
+  gensusy_motherstatus_loadedGen = 0;
+  gensusy_gmotherp4_loadedGen = 0;
+  gensusy_gmotherid_loadedGen = 0;
+  gensusy_gmotheridx_loadedGen = 0;
+  gensusy_gmotherstatus_loadedGen = 0;
+  ak8pfjets_p4_loadedGen = 0;
+  ak8pfjets_tau1_loadedGen = 0;
+  ak8pfjets_tau2_loadedGen = 0;
+  ak8pfjets_tau3_loadedGen = 0;
+  ak8pfjets_parton_flavor_loadedGen = 0;
+  nGoodAK8PFJets_loadedGen = 0;
+  ak8pfjets_deepdisc_qcd_loadedGen = 0;
+  ak8pfjets_deepdisc_top_loadedGen = 0;
+  ak8pfjets_deepdisc_w_loadedGen = 0;
+  ak8pfjets_deepdisc_z_loadedGen = 0;
+  ak8pfjets_deepdisc_zbb_loadedGen = 0;
+  ak8pfjets_deepdisc_hbb_loadedGen = 0;
+  ak8pfjets_deepdisc_h4q_loadedGen = 0;
+  lead_ak8deepdisc_top_loadedGen = 0;
+  jup_ak8pfjets_p4_loadedGen = 0;
+  jup_ak8pfjets_tau1_loadedGen = 0;
+  jup_ak8pfjets_tau2_loadedGen = 0;
+  jup_ak8pfjets_tau3_loadedGen = 0;
+  jup_ak8pfjets_parton_flavor_loadedGen = 0;
+  jup_nGoodAK8PFJets_loadedGen = 0;
+  jup_ak8pfjets_deepdisc_qcd_loadedGen = 0;
+  jup_ak8pfjets_deepdisc_top_loadedGen = 0;
+  jup_ak8pfjets_deepdisc_w_loadedGen = 0;
+  jup_ak8pfjets_deepdisc_z_loadedGen = 0;
+  jup_ak8pfjets_deepdisc_zbb_loadedGen = 0;
+  jup_ak8pfjets_deepdisc_hbb_loadedGen = 0;
+  jup_ak8pfjets_deepdisc_h4q_loadedGen = 0;
+  jup_lead_ak8deepdisc_top_loadedGen = 0;
+  jdown_ak8pfjets_p4_loadedGen = 0;
+  jdown_ak8pfjets_tau1_loadedGen = 0;
+  jdown_ak8pfjets_tau2_loadedGen = 0;
+  jdown_ak8pfjets_tau3_loadedGen = 0;
+  jdown_ak8pfjets_parton_flavor_loadedGen = 0;
+  jdown_nGoodAK8PFJets_loadedGen = 0;
+  jdown_ak8pfjets_deepdisc_qcd_loadedGen = 0;
+  jdown_ak8pfjets_deepdisc_top_loadedGen = 0;
+  jdown_ak8pfjets_deepdisc_w_loadedGen = 0;
+  jdown_ak8pfjets_deepdisc_z_loadedGen = 0;
+  jdown_ak8pfjets_deepdisc_zbb_loadedGen = 0;
+  jdown_ak8pfjets_deepdisc_hbb_loadedGen = 0;
+  jdown_ak8pfjets_deepdisc_h4q_loadedGen = 0;
+  jdown_lead_ak8deepdisc_top_loadedGen = 0;
+  ak4pfjets_cvsl_loadedGen = 0;
+  ak4pfjets_ptD_loadedGen = 0;
+  ak4pfjets_axis1_loadedGen = 0;
+  ak4pfjets_axis2_loadedGen = 0;
+  ak4pfjets_mult_loadedGen = 0;
+  ak4pfjets_deepCSVb_loadedGen = 0;
+  ak4pfjets_deepCSVbb_loadedGen = 0;
+  ak4pfjets_deepCSVc_loadedGen = 0;
+  ak4pfjets_deepCSVl_loadedGen = 0;
+  topcands_ak4idx_loadedGen = 0;
+  topcands_disc_loadedGen = 0;
+  topcands_p4_loadedGen = 0;
+  topcands_Wp4_loadedGen = 0;
+  tftops_p4_loadedGen = 0;
+  tftops_disc_loadedGen = 0;
+  tftops_subjet_pt_loadedGen = 0;
+  tftops_subjet_eta_loadedGen = 0;
+  tftops_subjet_phi_loadedGen = 0;
+  jup_ak4pfjets_cvsl_loadedGen = 0;
+  jup_ak4pfjets_ptD_loadedGen = 0;
+  jup_ak4pfjets_axis1_loadedGen = 0;
+  jup_ak4pfjets_axis2_loadedGen = 0;
+  jup_ak4pfjets_mult_loadedGen = 0;
+  jup_ak4pfjets_deepCSVb_loadedGen = 0;
+  jup_ak4pfjets_deepCSVbb_loadedGen = 0;
+  jup_ak4pfjets_deepCSVc_loadedGen = 0;
+  jup_ak4pfjets_deepCSVl_loadedGen = 0;
+  jup_topcands_ak4idx_loadedGen = 0;
+  jup_topcands_disc_loadedGen = 0;
+  jup_topcands_p4_loadedGen = 0;
+  jup_topcands_Wp4_loadedGen = 0;
+  jup_tftops_p4_loadedGen = 0;
+  jup_tftops_disc_loadedGen = 0;
+  jup_tftops_subjet_pt_loadedGen = 0;
+  jup_tftops_subjet_eta_loadedGen = 0;
+  jup_tftops_subjet_phi_loadedGen = 0;
+  jdown_ak4pfjets_cvsl_loadedGen = 0;
+  jdown_ak4pfjets_ptD_loadedGen = 0;
+  jdown_ak4pfjets_axis1_loadedGen = 0;
+  jdown_ak4pfjets_axis2_loadedGen = 0;
+  jdown_ak4pfjets_mult_loadedGen = 0;
+  jdown_ak4pfjets_deepCSVb_loadedGen = 0;
+  jdown_ak4pfjets_deepCSVbb_loadedGen = 0;
+  jdown_ak4pfjets_deepCSVc_loadedGen = 0;
+  jdown_ak4pfjets_deepCSVl_loadedGen = 0;
+  jdown_topcands_ak4idx_loadedGen = 0;
+  jdown_topcands_disc_loadedGen = 0;
+  jdown_topcands_p4_loadedGen = 0;
+  jdown_topcands_Wp4_loadedGen = 0;
+  jdown_tftops_p4_loadedGen = 0;
+  jdown_tftops_disc_loadedGen = 0;
+  jdown_tftops_subjet_pt_loadedGen = 0;
+  jdown_tftops_subjet_eta_loadedGen = 0;
+  jdown_tftops_subjet_phi_loadedGen = 0;
+  tau_IDnames_loadedGen = 0;
+  tau_p4_loadedGen = 0;
+  tau_ID_loadedGen = 0;
+  tau_passID_loadedGen = 0;
+  ngoodtaus_loadedGen = 0;
+  tau_isVetoTau_loadedGen = 0;
+  tau_isVetoTau_v2_loadedGen = 0;
+  isoTracks_p4_loadedGen = 0;
+  isoTracks_charge_loadedGen = 0;
+  isoTracks_absIso_loadedGen = 0;
+  isoTracks_dz_loadedGen = 0;
+  isoTracks_pdgId_loadedGen = 0;
+  isoTracks_isVetoTrack_loadedGen = 0;
+  isoTracks_isVetoTrack_v2_loadedGen = 0;
+  isoTracks_isVetoTrack_v3_loadedGen = 0;
+  ph_selectedidx_loadedGen = 0;
+  ph_met_loadedGen = 0;
+  ph_met_phi_loadedGen = 0;
+  ph_HT_loadedGen = 0;
+  ph_htssm_loadedGen = 0;
+  ph_htosm_loadedGen = 0;
+  ph_htratiom_loadedGen = 0;
+  ph_mt_met_lep_loadedGen = 0;
+  ph_dphi_Wlep_loadedGen = 0;
+  ph_MT2W_loadedGen = 0;
+  ph_topness_loadedGen = 0;
+  ph_topnessMod_loadedGen = 0;
+  ph_MT2_ll_loadedGen = 0;
+  ph_MT2_lb_b_mass_loadedGen = 0;
+  ph_MT2_lb_b_loadedGen = 0;
+  ph_MT2_lb_bqq_mass_loadedGen = 0;
+  ph_MT2_lb_bqq_loadedGen = 0;
+  ph_hadronic_top_chi2_loadedGen = 0;
+  ph_mindphi_met_j1_j2_loadedGen = 0;
+  ph_Mlb_lead_bdiscr_loadedGen = 0;
+  ph_dR_lep_leadb_loadedGen = 0;
+  ph_Mlb_closestb_loadedGen = 0;
+  ph_Mjjj_loadedGen = 0;
+  EA_fixgridfastjet_all_rho_loadedGen = 0;
+  HLT_Photon22_R9Id90_HE10_IsoM_loadedGen = 0;
+  HLT_Photon30_R9Id90_HE10_IsoM_loadedGen = 0;
+  HLT_Photon36_R9Id90_HE10_IsoM_loadedGen = 0;
+  HLT_Photon50_R9Id90_HE10_IsoM_loadedGen = 0;
+  HLT_Photon75_R9Id90_HE10_IsoM_loadedGen = 0;
+  HLT_Photon90_R9Id90_HE10_IsoM_loadedGen = 0;
+  HLT_Photon120_R9Id90_HE10_IsoM_loadedGen = 0;
+  HLT_Photon165_R9Id90_HE10_IsoM_loadedGen = 0;
+  HLT_Photon175_loadedGen = 0;
+  HLT_Photon165_HE10_loadedGen = 0;
+  HLT_Photon120_loadedGen = 0;
+  HLT_Photon200_loadedGen = 0;
+  HLT_Photon250_NoHE_loadedGen = 0;
+  HLT_Photon300_NoHE_loadedGen = 0;
+  HLT_bits_loadedGen = 0;
+  filt_cscbeamhalo_loadedGen = 0;
+  filt_cscbeamhalo2015_loadedGen = 0;
+  filt_globaltighthalo2016_loadedGen = 0;
+  filt_globalsupertighthalo2016_loadedGen = 0;
+  filt_ecallaser_loadedGen = 0;
+  filt_ecaltp_loadedGen = 0;
+  filt_ecalbadcalib_loadedGen = 0;
+  filt_eebadsc_loadedGen = 0;
+  filt_goodvtx_loadedGen = 0;
+  filt_badevents_loadedGen = 0;
+  filt_hbhenoise_loadedGen = 0;
+  filt_hbheisonoise_loadedGen = 0;
+  filt_hcallaser_loadedGen = 0;
+  filt_trkfail_loadedGen = 0;
+  filt_trkPOG_loadedGen = 0;
+  filt_trkPOG_logerr_tmc_loadedGen = 0;
+  filt_trkPOG_tmc_loadedGen = 0;
+  filt_trkPOG_tms_loadedGen = 0;
+  firstGoodVtxIdx_loadedGen = 0;
+  filt_badChargedCandidateFilter_loadedGen = 0;
+  filt_badMuonFilter_loadedGen = 0;
+  filt_met_loadedGen = 0;
+  filt_fastsimjets_loadedGen = 0;
+  filt_fastsimjets_jup_loadedGen = 0;
+  filt_fastsimjets_jdown_loadedGen = 0;
+  filt_jetWithBadMuon_loadedGen = 0;
+  filt_jetWithBadMuon_jup_loadedGen = 0;
+  filt_jetWithBadMuon_jdown_loadedGen = 0;
+  filt_pfovercalomet_loadedGen = 0;
+  filt_badmuons_loadedGen = 0;
+  filt_duplicatemuons_loadedGen = 0;
+  filt_nobadmuons_loadedGen = 0;
   lep1_p4_branch = tree->GetBranch("lep1_p4");
   if (lep1_p4_branch) lep1_p4_branch->SetAddress(&lep1_p4_);
   lep1_mcp4_branch = tree->GetBranch("lep1_mcp4");
@@ -12,96 +651,136 @@ void StopTree::Init(TTree *tree) {
   if (lep2_mcp4_branch) lep2_mcp4_branch->SetAddress(&lep2_mcp4_);
   ph_p4_branch = tree->GetBranch("ph_p4");
   if (ph_p4_branch) ph_p4_branch->SetAddress(&ph_p4_);
+  ph_p4_split.Init(tree, "ph_p4");
   ph_mcp4_branch = tree->GetBranch("ph_mcp4");
   if (ph_mcp4_branch) ph_mcp4_branch->SetAddress(&ph_mcp4_);
+  ph_mcp4_split.Init(tree, "ph_mcp4");
   ak4pfjets_p4_branch = tree->GetBranch("ak4pfjets_p4");
   if (ak4pfjets_p4_branch) ak4pfjets_p4_branch->SetAddress(&ak4pfjets_p4_);
+  ak4pfjets_p4_split.Init(tree, "ak4pfjets_p4");
   ak4pfjets_leadMEDbjet_p4_branch = tree->GetBranch("ak4pfjets_leadMEDbjet_p4");
   if (ak4pfjets_leadMEDbjet_p4_branch) ak4pfjets_leadMEDbjet_p4_branch->SetAddress(&ak4pfjets_leadMEDbjet_p4_);
   ak4pfjets_leadbtag_p4_branch = tree->GetBranch("ak4pfjets_leadbtag_p4");
   if (ak4pfjets_leadbtag_p4_branch) ak4pfjets_leadbtag_p4_branch->SetAddress(&ak4pfjets_leadbtag_p4_);
   ak4genjets_p4_branch = tree->GetBranch("ak4genjets_p4");
   if (ak4genjets_p4_branch) ak4genjets_p4_branch->SetAddress(&ak4genjets_p4_);
+  ak4genjets_p4_split.Init(tree, "ak4genjets_p4");
   softtags_p4_branch = tree->GetBranch("softtags_p4");
   if (softtags_p4_branch) softtags_p4_branch->SetAddress(&softtags_p4_);
+  softtags_p4_split.Init(tree, "softtags_p4");
   jup_ak4pfjets_p4_branch = tree->GetBranch("jup_ak4pfjets_p4");
   if (jup_ak4pfjets_p4_branch) jup_ak4pfjets_p4_branch->SetAddress(&jup_ak4pfjets_p4_);
+  jup_ak4pfjets_p4_split.Init(tree, "jup_ak4pfjets_p4");
   jup_ak4pfjets_leadMEDbjet_p4_branch = tree->GetBranch("jup_ak4pfjets_leadMEDbjet_p4");
   if (jup_ak4pfjets_leadMEDbjet_p4_branch) jup_ak4pfjets_leadMEDbjet_p4_branch->SetAddress(&jup_ak4pfjets_leadMEDbjet_p4_);
   jup_ak4pfjets_leadbtag_p4_branch = tree->GetBranch("jup_ak4pfjets_leadbtag_p4");
   if (jup_ak4pfjets_leadbtag_p4_branch) jup_ak4pfjets_leadbtag_p4_branch->SetAddress(&jup_ak4pfjets_leadbtag_p4_);
   jup_ak4genjets_p4_branch = tree->GetBranch("jup_ak4genjets_p4");
   if (jup_ak4genjets_p4_branch) jup_ak4genjets_p4_branch->SetAddress(&jup_ak4genjets_p4_);
+  jup_ak4genjets_p4_split.Init(tree, "jup_ak4genjets_p4");
   jup_softtags_p4_branch = tree->GetBranch("jup_softtags_p4");
   if (jup_softtags_p4_branch) jup_softtags_p4_branch->SetAddress(&jup_softtags_p4_);
+  jup_softtags_p4_split.Init(tree, "jup_softtags_p4");
   jdown_ak4pfjets_p4_branch = tree->GetBranch("jdown_ak4pfjets_p4");
   if (jdown_ak4pfjets_p4_branch) jdown_ak4pfjets_p4_branch->SetAddress(&jdown_ak4pfjets_p4_);
+  jdown_ak4pfjets_p4_split.Init(tree, "jdown_ak4pfjets_p4");
   jdown_ak4pfjets_leadMEDbjet_p4_branch = tree->GetBranch("jdown_ak4pfjets_leadMEDbjet_p4");
   if (jdown_ak4pfjets_leadMEDbjet_p4_branch) jdown_ak4pfjets_leadMEDbjet_p4_branch->SetAddress(&jdown_ak4pfjets_leadMEDbjet_p4_);
   jdown_ak4pfjets_leadbtag_p4_branch = tree->GetBranch("jdown_ak4pfjets_leadbtag_p4");
   if (jdown_ak4pfjets_leadbtag_p4_branch) jdown_ak4pfjets_leadbtag_p4_branch->SetAddress(&jdown_ak4pfjets_leadbtag_p4_);
   jdown_ak4genjets_p4_branch = tree->GetBranch("jdown_ak4genjets_p4");
   if (jdown_ak4genjets_p4_branch) jdown_ak4genjets_p4_branch->SetAddress(&jdown_ak4genjets_p4_);
+  jdown_ak4genjets_p4_split.Init(tree, "jdown_ak4genjets_p4");
   jdown_softtags_p4_branch = tree->GetBranch("jdown_softtags_p4");
   if (jdown_softtags_p4_branch) jdown_softtags_p4_branch->SetAddress(&jdown_softtags_p4_);
+  jdown_softtags_p4_split.Init(tree, "jdown_softtags_p4");
   genleps_p4_branch = tree->GetBranch("genleps_p4");
   if (genleps_p4_branch) genleps_p4_branch->SetAddress(&genleps_p4_);
+  genleps_p4_split.Init(tree, "genleps_p4");
   genleps_motherp4_branch = tree->GetBranch("genleps_motherp4");
   if (genleps_motherp4_branch) genleps_motherp4_branch->SetAddress(&genleps_motherp4_);
+  genleps_motherp4_split.Init(tree, "genleps_motherp4");
   genleps_gmotherp4_branch = tree->GetBranch("genleps_gmotherp4");
   if (genleps_gmotherp4_branch) genleps_gmotherp4_branch->SetAddress(&genleps_gmotherp4_);
+  genleps_gmotherp4_split.Init(tree, "genleps_gmotherp4");
   gennus_p4_branch = tree->GetBranch("gennus_p4");
   if (gennus_p4_branch) gennus_p4_branch->SetAddress(&gennus_p4_);
+  gennus_p4_split.Init(tree, "gennus_p4");
   gennus_motherp4_branch = tree->GetBranch("gennus_motherp4");
   if (gennus_motherp4_branch) gennus_motherp4_branch->SetAddress(&gennus_motherp4_);
+  gennus_motherp4_split.Init(tree, "gennus_motherp4");
   gennus_gmotherp4_branch = tree->GetBranch("gennus_gmotherp4");
   if (gennus_gmotherp4_branch) gennus_gmotherp4_branch->SetAddress(&gennus_gmotherp4_);
+  gennus_gmotherp4_split.Init(tree, "gennus_gmotherp4");
   genqs_p4_branch = tree->GetBranch("genqs_p4");
   if (genqs_p4_branch) genqs_p4_branch->SetAddress(&genqs_p4_);
+  genqs_p4_split.Init(tree, "genqs_p4");
   genqs_motherp4_branch = tree->GetBranch("genqs_motherp4");
   if (genqs_motherp4_branch) genqs_motherp4_branch->SetAddress(&genqs_motherp4_);
+  genqs_motherp4_split.Init(tree, "genqs_motherp4");
   genqs_gmotherp4_branch = tree->GetBranch("genqs_gmotherp4");
   if (genqs_gmotherp4_branch) genqs_gmotherp4_branch->SetAddress(&genqs_gmotherp4_);
+  genqs_gmotherp4_split.Init(tree, "genqs_gmotherp4");
   genbosons_p4_branch = tree->GetBranch("genbosons_p4");
   if (genbosons_p4_branch) genbosons_p4_branch->SetAddress(&genbosons_p4_);
+  genbosons_p4_split.Init(tree, "genbosons_p4");
   genbosons_motherp4_branch = tree->GetBranch("genbosons_motherp4");
   if (genbosons_motherp4_branch) genbosons_motherp4_branch->SetAddress(&genbosons_motherp4_);
+  genbosons_motherp4_split.Init(tree, "genbosons_motherp4");
   genbosons_gmotherp4_branch = tree->GetBranch("genbosons_gmotherp4");
   if (genbosons_gmotherp4_branch) genbosons_gmotherp4_branch->SetAddress(&genbosons_gmotherp4_);
+  genbosons_gmotherp4_split.Init(tree, "genbosons_gmotherp4");
   gensusy_p4_branch = tree->GetBranch("gensusy_p4");
   if (gensusy_p4_branch) gensusy_p4_branch->SetAddress(&gensusy_p4_);
+  gensusy_p4_split.Init(tree, "gensusy_p4");
   gensusy_motherp4_branch = tree->GetBranch("gensusy_motherp4");
   if (gensusy_motherp4_branch) gensusy_motherp4_branch->SetAddress(&gensusy_motherp4_);
+  gensusy_motherp4_split.Init(tree, "gensusy_motherp4");
   gensusy_gmotherp4_branch = tree->GetBranch("gensusy_gmotherp4");
   if (gensusy_gmotherp4_branch) gensusy_gmotherp4_branch->SetAddress(&gensusy_gmotherp4_);
+  gensusy_gmotherp4_split.Init(tree, "gensusy_gmotherp4");
   ak8pfjets_p4_branch = tree->GetBranch("ak8pfjets_p4");
   if (ak8pfjets_p4_branch) ak8pfjets_p4_branch->SetAddress(&ak8pfjets_p4_);
+  ak8pfjets_p4_split.Init(tree, "ak8pfjets_p4");
   jup_ak8pfjets_p4_branch = tree->GetBranch("jup_ak8pfjets_p4");
   if (jup_ak8pfjets_p4_branch) jup_ak8pfjets_p4_branch->SetAddress(&jup_ak8pfjets_p4_);
+  jup_ak8pfjets_p4_split.Init(tree, "jup_ak8pfjets_p4");
   jdown_ak8pfjets_p4_branch = tree->GetBranch("jdown_ak8pfjets_p4");
   if (jdown_ak8pfjets_p4_branch) jdown_ak8pfjets_p4_branch->SetAddress(&jdown_ak8pfjets_p4_);
+  jdown_ak8pfjets_p4_split.Init(tree, "jdown_ak8pfjets_p4");
   topcands_p4_branch = tree->GetBranch("topcands_p4");
   if (topcands_p4_branch) topcands_p4_branch->SetAddress(&topcands_p4_);
+  topcands_p4_split.Init(tree, "topcands_p4");
   topcands_Wp4_branch = tree->GetBranch("topcands_Wp4");
   if (topcands_Wp4_branch) topcands_Wp4_branch->SetAddress(&topcands_Wp4_);
+  topcands_Wp4_split.Init(tree, "topcands_Wp4");
   tftops_p4_branch = tree->GetBranch("tftops_p4");
   if (tftops_p4_branch) tftops_p4_branch->SetAddress(&tftops_p4_);
+  tftops_p4_split.Init(tree, "tftops_p4");
   jup_topcands_p4_branch = tree->GetBranch("jup_topcands_p4");
   if (jup_topcands_p4_branch) jup_topcands_p4_branch->SetAddress(&jup_topcands_p4_);
+  jup_topcands_p4_split.Init(tree, "jup_topcands_p4");
   jup_topcands_Wp4_branch = tree->GetBranch("jup_topcands_Wp4");
   if (jup_topcands_Wp4_branch) jup_topcands_Wp4_branch->SetAddress(&jup_topcands_Wp4_);
+  jup_topcands_Wp4_split.Init(tree, "jup_topcands_Wp4");
   jup_tftops_p4_branch = tree->GetBranch("jup_tftops_p4");
   if (jup_tftops_p4_branch) jup_tftops_p4_branch->SetAddress(&jup_tftops_p4_);
+  jup_tftops_p4_split.Init(tree, "jup_tftops_p4");
   jdown_topcands_p4_branch = tree->GetBranch("jdown_topcands_p4");
   if (jdown_topcands_p4_branch) jdown_topcands_p4_branch->SetAddress(&jdown_topcands_p4_);
+  jdown_topcands_p4_split.Init(tree, "jdown_topcands_p4");
   jdown_topcands_Wp4_branch = tree->GetBranch("jdown_topcands_Wp4");
   if (jdown_topcands_Wp4_branch) jdown_topcands_Wp4_branch->SetAddress(&jdown_topcands_Wp4_);
+  jdown_topcands_Wp4_split.Init(tree, "jdown_topcands_Wp4");
   jdown_tftops_p4_branch = tree->GetBranch("jdown_tftops_p4");
   if (jdown_tftops_p4_branch) jdown_tftops_p4_branch->SetAddress(&jdown_tftops_p4_);
+  jdown_tftops_p4_split.Init(tree, "jdown_tftops_p4");
   tau_p4_branch = tree->GetBranch("tau_p4");
   if (tau_p4_branch) tau_p4_branch->SetAddress(&tau_p4_);
+  tau_p4_split.Init(tree, "tau_p4");
   isoTracks_p4_branch = tree->GetBranch("isoTracks_p4");
   if (isoTracks_p4_branch) isoTracks_p4_branch->SetAddress(&isoTracks_p4_);
+  isoTracks_p4_split.Init(tree, "isoTracks_p4");
 
   tree->SetMakeClass(1);
 
@@ -1117,6 +1796,8 @@ void StopTree::Init(TTree *tree) {
   if (HLT_Photon250_NoHE_branch) HLT_Photon250_NoHE_branch->SetAddress(&HLT_Photon250_NoHE_);
   HLT_Photon300_NoHE_branch = tree->GetBranch("HLT_Photon300_NoHE");
   if (HLT_Photon300_NoHE_branch) HLT_Photon300_NoHE_branch->SetAddress(&HLT_Photon300_NoHE_);
+  HLT_bits_branch = tree->GetBranch("HLT_bits");
+  if (HLT_bits_branch) HLT_bits_branch->SetAddress(&HLT_bits_);
   filt_cscbeamhalo_branch = tree->GetBranch("filt_cscbeamhalo");
   if (filt_cscbeamhalo_branch) filt_cscbeamhalo_branch->SetAddress(&filt_cscbeamhalo_);
   filt_cscbeamhalo2015_branch = tree->GetBranch("filt_cscbeamhalo2015");
@@ -1182,600 +1863,915 @@ void StopTree::Init(TTree *tree) {
   filt_nobadmuons_branch = tree->GetBranch("filt_nobadmuons");
   if (filt_nobadmuons_branch) filt_nobadmuons_branch->SetAddress(&filt_nobadmuons_);
 
+  SetFlatSkim(0);
+  bulkRead.Clear();
+  run_bulk = bulkRead.Make(run_branch);
+  ls_bulk = bulkRead.Make(ls_branch);
+  evt_bulk = bulkRead.Make(evt_branch);
+  nvtxs_bulk = bulkRead.Make(nvtxs_branch);
+  year_bulk = bulkRead.Make(year_branch);
+  sampver_bulk = bulkRead.Make(sampver_branch);
+  pu_nvtxs_bulk = bulkRead.Make(pu_nvtxs_branch);
+  pfmet_bulk = bulkRead.Make(pfmet_branch);
+  pfmet_phi_bulk = bulkRead.Make(pfmet_phi_branch);
+  pfmet_jup_bulk = bulkRead.Make(pfmet_jup_branch);
+  pfmet_phi_jup_bulk = bulkRead.Make(pfmet_phi_jup_branch);
+  pfmet_jdown_bulk = bulkRead.Make(pfmet_jdown_branch);
+  pfmet_phi_jdown_bulk = bulkRead.Make(pfmet_phi_jdown_branch);
+  pfmet_rl_bulk = bulkRead.Make(pfmet_rl_branch);
+  pfmet_phi_rl_bulk = bulkRead.Make(pfmet_phi_rl_branch);
+  pfmet_rl_jup_bulk = bulkRead.Make(pfmet_rl_jup_branch);
+  pfmet_phi_rl_jup_bulk = bulkRead.Make(pfmet_phi_rl_jup_branch);
+  pfmet_rl_jdown_bulk = bulkRead.Make(pfmet_rl_jdown_branch);
+  pfmet_phi_rl_jdown_bulk = bulkRead.Make(pfmet_phi_rl_jdown_branch);
+  pfmet_egclean_bulk = bulkRead.Make(pfmet_egclean_branch);
+  pfmet_egclean_phi_bulk = bulkRead.Make(pfmet_egclean_phi_branch);
+  pfmet_muegclean_bulk = bulkRead.Make(pfmet_muegclean_branch);
+  pfmet_muegclean_phi_bulk = bulkRead.Make(pfmet_muegclean_phi_branch);
+  pfmet_muegcleanfix_bulk = bulkRead.Make(pfmet_muegcleanfix_branch);
+  pfmet_muegcleanfix_phi_bulk = bulkRead.Make(pfmet_muegcleanfix_phi_branch);
+  pfmet_uncorr_bulk = bulkRead.Make(pfmet_uncorr_branch);
+  pfmet_uncorr_phi_bulk = bulkRead.Make(pfmet_uncorr_phi_branch);
+  pfmet_original_bulk = bulkRead.Make(pfmet_original_branch);
+  pfmet_original_phi_bulk = bulkRead.Make(pfmet_original_phi_branch);
+  scale1fb_bulk = bulkRead.Make(scale1fb_branch);
+  xsec_bulk = bulkRead.Make(xsec_branch);
+  xsec_uncert_bulk = bulkRead.Make(xsec_uncert_branch);
+  kfactor_bulk = bulkRead.Make(kfactor_branch);
+  pu_ntrue_bulk = bulkRead.Make(pu_ntrue_branch);
+  ngoodleps_bulk = bulkRead.Make(ngoodleps_branch);
+  nlooseleps_bulk = bulkRead.Make(nlooseleps_branch);
+  nvetoleps_bulk = bulkRead.Make(nvetoleps_branch);
+  is_data_bulk = bulkRead.Make(is_data_branch);
+  nEvents_bulk = bulkRead.Make(nEvents_branch);
+  nEvents_goodvtx_bulk = bulkRead.Make(nEvents_goodvtx_branch);
+  nEvents_MET30_bulk = bulkRead.Make(nEvents_MET30_branch);
+  nEvents_1goodlep_bulk = bulkRead.Make(nEvents_1goodlep_branch);
+  nEvents_2goodjets_bulk = bulkRead.Make(nEvents_2goodjets_branch);
+  is0lep_bulk = bulkRead.Make(is0lep_branch);
+  is1lep_bulk = bulkRead.Make(is1lep_branch);
+  is2lep_bulk = bulkRead.Make(is2lep_branch);
+  isZtoNuNu_bulk = bulkRead.Make(isZtoNuNu_branch);
+  is1lepFromW_bulk = bulkRead.Make(is1lepFromW_branch);
+  is1lepFromTop_bulk = bulkRead.Make(is1lepFromTop_branch);
+  MT2W_bulk = bulkRead.Make(MT2W_branch);
+  MT2W_rl_bulk = bulkRead.Make(MT2W_rl_branch);
+  MT2_ll_bulk = bulkRead.Make(MT2_ll_branch);
+  mindphi_met_j1_j2_bulk = bulkRead.Make(mindphi_met_j1_j2_branch);
+  mindphi_met_j1_j2_rl_bulk = bulkRead.Make(mindphi_met_j1_j2_rl_branch);
+  mt_met_lep_bulk = bulkRead.Make(mt_met_lep_branch);
+  mt_met_lep_rl_bulk = bulkRead.Make(mt_met_lep_rl_branch);
+  MT2W_jup_bulk = bulkRead.Make(MT2W_jup_branch);
+  MT2W_rl_jup_bulk = bulkRead.Make(MT2W_rl_jup_branch);
+  MT2_ll_jup_bulk = bulkRead.Make(MT2_ll_jup_branch);
+  mindphi_met_j1_j2_jup_bulk = bulkRead.Make(mindphi_met_j1_j2_jup_branch);
+  mindphi_met_j1_j2_rl_jup_bulk = bulkRead.Make(mindphi_met_j1_j2_rl_jup_branch);
+  mt_met_lep_jup_bulk = bulkRead.Make(mt_met_lep_jup_branch);
+  mt_met_lep_rl_jup_bulk = bulkRead.Make(mt_met_lep_rl_jup_branch);
+  MT2W_jdown_bulk = bulkRead.Make(MT2W_jdown_branch);
+  MT2W_rl_jdown_bulk = bulkRead.Make(MT2W_rl_jdown_branch);
+  MT2_ll_jdown_bulk = bulkRead.Make(MT2_ll_jdown_branch);
+  mindphi_met_j1_j2_jdown_bulk = bulkRead.Make(mindphi_met_j1_j2_jdown_branch);
+  mindphi_met_j1_j2_rl_jdown_bulk = bulkRead.Make(mindphi_met_j1_j2_rl_jdown_branch);
+  mt_met_lep_jdown_bulk = bulkRead.Make(mt_met_lep_jdown_branch);
+  mt_met_lep_rl_jdown_bulk = bulkRead.Make(mt_met_lep_rl_jdown_branch);
+  hadronic_top_chi2_bulk = bulkRead.Make(hadronic_top_chi2_branch);
+  ak4pfjets_rho_bulk = bulkRead.Make(ak4pfjets_rho_branch);
+  pdf_up_weight_bulk = bulkRead.Make(pdf_up_weight_branch);
+  pdf_down_weight_bulk = bulkRead.Make(pdf_down_weight_branch);
+  ngenweights_bulk = bulkRead.Make(ngenweights_branch);
+  weight_Q2_up_bulk = bulkRead.Make(weight_Q2_up_branch);
+  weight_Q2_down_bulk = bulkRead.Make(weight_Q2_down_branch);
+  weight_alphas_up_bulk = bulkRead.Make(weight_alphas_up_branch);
+  weight_alphas_down_bulk = bulkRead.Make(weight_alphas_down_branch);
+  weight_btagsf_bulk = bulkRead.Make(weight_btagsf_branch);
+  weight_btagsf_heavy_UP_bulk = bulkRead.Make(weight_btagsf_heavy_UP_branch);
+  weight_btagsf_light_UP_bulk = bulkRead.Make(weight_btagsf_light_UP_branch);
+  weight_btagsf_heavy_DN_bulk = bulkRead.Make(weight_btagsf_heavy_DN_branch);
+  weight_btagsf_light_DN_bulk = bulkRead.Make(weight_btagsf_light_DN_branch);
+  weight_btagsf_fastsim_UP_bulk = bulkRead.Make(weight_btagsf_fastsim_UP_branch);
+  weight_btagsf_fastsim_DN_bulk = bulkRead.Make(weight_btagsf_fastsim_DN_branch);
+  weight_analysisbtagsf_bulk = bulkRead.Make(weight_analysisbtagsf_branch);
+  weight_analysisbtagsf_heavy_UP_bulk = bulkRead.Make(weight_analysisbtagsf_heavy_UP_branch);
+  weight_analysisbtagsf_light_UP_bulk = bulkRead.Make(weight_analysisbtagsf_light_UP_branch);
+  weight_analysisbtagsf_heavy_DN_bulk = bulkRead.Make(weight_analysisbtagsf_heavy_DN_branch);
+  weight_analysisbtagsf_light_DN_bulk = bulkRead.Make(weight_analysisbtagsf_light_DN_branch);
+  weight_analysisbtagsf_fastsim_UP_bulk = bulkRead.Make(weight_analysisbtagsf_fastsim_UP_branch);
+  weight_analysisbtagsf_fastsim_DN_bulk = bulkRead.Make(weight_analysisbtagsf_fastsim_DN_branch);
+  weight_tightbtagsf_bulk = bulkRead.Make(weight_tightbtagsf_branch);
+  weight_tightbtagsf_heavy_UP_bulk = bulkRead.Make(weight_tightbtagsf_heavy_UP_branch);
+  weight_tightbtagsf_light_UP_bulk = bulkRead.Make(weight_tightbtagsf_light_UP_branch);
+  weight_tightbtagsf_heavy_DN_bulk = bulkRead.Make(weight_tightbtagsf_heavy_DN_branch);
+  weight_tightbtagsf_light_DN_bulk = bulkRead.Make(weight_tightbtagsf_light_DN_branch);
+  weight_tightbtagsf_fastsim_UP_bulk = bulkRead.Make(weight_tightbtagsf_fastsim_UP_branch);
+  weight_tightbtagsf_fastsim_DN_bulk = bulkRead.Make(weight_tightbtagsf_fastsim_DN_branch);
+  weight_loosebtagsf_bulk = bulkRead.Make(weight_loosebtagsf_branch);
+  weight_loosebtagsf_heavy_UP_bulk = bulkRead.Make(weight_loosebtagsf_heavy_UP_branch);
+  weight_loosebtagsf_light_UP_bulk = bulkRead.Make(weight_loosebtagsf_light_UP_branch);
+  weight_loosebtagsf_heavy_DN_bulk = bulkRead.Make(weight_loosebtagsf_heavy_DN_branch);
+  weight_loosebtagsf_light_DN_bulk = bulkRead.Make(weight_loosebtagsf_light_DN_branch);
+  weight_loosebtagsf_fastsim_UP_bulk = bulkRead.Make(weight_loosebtagsf_fastsim_UP_branch);
+  weight_loosebtagsf_fastsim_DN_bulk = bulkRead.Make(weight_loosebtagsf_fastsim_DN_branch);
+  weight_lepSF_bulk = bulkRead.Make(weight_lepSF_branch);
+  weight_lepSF_up_bulk = bulkRead.Make(weight_lepSF_up_branch);
+  weight_lepSF_down_bulk = bulkRead.Make(weight_lepSF_down_branch);
+  weight_vetoLepSF_bulk = bulkRead.Make(weight_vetoLepSF_branch);
+  weight_vetoLepSF_up_bulk = bulkRead.Make(weight_vetoLepSF_up_branch);
+  weight_vetoLepSF_down_bulk = bulkRead.Make(weight_vetoLepSF_down_branch);
+  weight_lepSF_fastSim_bulk = bulkRead.Make(weight_lepSF_fastSim_branch);
+  weight_lepSF_fastSim_up_bulk = bulkRead.Make(weight_lepSF_fastSim_up_branch);
+  weight_lepSF_fastSim_down_bulk = bulkRead.Make(weight_lepSF_fastSim_down_branch);
+  weight_ISR_bulk = bulkRead.Make(weight_ISR_branch);
+  weight_ISRup_bulk = bulkRead.Make(weight_ISRup_branch);
+  weight_ISRdown_bulk = bulkRead.Make(weight_ISRdown_branch);
+  weight_PU_bulk = bulkRead.Make(weight_PU_branch);
+  weight_PUup_bulk = bulkRead.Make(weight_PUup_branch);
+  weight_PUdown_bulk = bulkRead.Make(weight_PUdown_branch);
+  weight_ISRnjets_bulk = bulkRead.Make(weight_ISRnjets_branch);
+  weight_ISRnjets_UP_bulk = bulkRead.Make(weight_ISRnjets_UP_branch);
+  weight_ISRnjets_DN_bulk = bulkRead.Make(weight_ISRnjets_DN_branch);
+  weight_L1prefire_bulk = bulkRead.Make(weight_L1prefire_branch);
+  weight_L1prefire_UP_bulk = bulkRead.Make(weight_L1prefire_UP_branch);
+  weight_L1prefire_DN_bulk = bulkRead.Make(weight_L1prefire_DN_branch);
+  NISRjets_bulk = bulkRead.Make(NISRjets_branch);
+  NnonISRjets_bulk = bulkRead.Make(NnonISRjets_branch);
+  sparms_subProcessId_bulk = bulkRead.Make(sparms_subProcessId_branch);
+  mass_lsp_bulk = bulkRead.Make(mass_lsp_branch);
+  mass_chargino_bulk = bulkRead.Make(mass_chargino_branch);
+  mass_stop_bulk = bulkRead.Make(mass_stop_branch);
+  mass_gluino_bulk = bulkRead.Make(mass_gluino_branch);
+  genmet_bulk = bulkRead.Make(genmet_branch);
+  genmet_phi_bulk = bulkRead.Make(genmet_phi_branch);
+  nupt_bulk = bulkRead.Make(nupt_branch);
+  genht_bulk = bulkRead.Make(genht_branch);
+  PassTrackVeto_bulk = bulkRead.Make(PassTrackVeto_branch);
+  PassTauVeto_bulk = bulkRead.Make(PassTauVeto_branch);
+  topness_bulk = bulkRead.Make(topness_branch);
+  topnessMod_bulk = bulkRead.Make(topnessMod_branch);
+  topnessMod_rl_bulk = bulkRead.Make(topnessMod_rl_branch);
+  topnessMod_jup_bulk = bulkRead.Make(topnessMod_jup_branch);
+  topnessMod_rl_jup_bulk = bulkRead.Make(topnessMod_rl_jup_branch);
+  topnessMod_jdown_bulk = bulkRead.Make(topnessMod_jdown_branch);
+  topnessMod_rl_jdown_bulk = bulkRead.Make(topnessMod_rl_jdown_branch);
+  Mlb_closestb_bulk = bulkRead.Make(Mlb_closestb_branch);
+  Mlb_lead_bdiscr_bulk = bulkRead.Make(Mlb_lead_bdiscr_branch);
+  Mlb_closestb_jup_bulk = bulkRead.Make(Mlb_closestb_jup_branch);
+  Mlb_lead_bdiscr_jup_bulk = bulkRead.Make(Mlb_lead_bdiscr_jup_branch);
+  Mlb_closestb_jdown_bulk = bulkRead.Make(Mlb_closestb_jdown_branch);
+  Mlb_lead_bdiscr_jdown_bulk = bulkRead.Make(Mlb_lead_bdiscr_jdown_branch);
+  HLT_SingleEl_bulk = bulkRead.Make(HLT_SingleEl_branch);
+  HLT_SingleMu_bulk = bulkRead.Make(HLT_SingleMu_branch);
+  HLT_MET_bulk = bulkRead.Make(HLT_MET_branch);
+  HLT_MET_MHT_bulk = bulkRead.Make(HLT_MET_MHT_branch);
+  HLT_MET100_MHT100_bulk = bulkRead.Make(HLT_MET100_MHT100_branch);
+  HLT_MET110_MHT110_bulk = bulkRead.Make(HLT_MET110_MHT110_branch);
+  HLT_MET120_MHT120_bulk = bulkRead.Make(HLT_MET120_MHT120_branch);
+  HLT_MET130_MHT130_bulk = bulkRead.Make(HLT_MET130_MHT130_branch);
+  HLT_PFHT_unprescaled_bulk = bulkRead.Make(HLT_PFHT_unprescaled_branch);
+  HLT_PFHT_prescaled_bulk = bulkRead.Make(HLT_PFHT_prescaled_branch);
+  HLT_AK8Jet_unprescaled_bulk = bulkRead.Make(HLT_AK8Jet_unprescaled_branch);
+  HLT_AK8Jet_prescaled_bulk = bulkRead.Make(HLT_AK8Jet_prescaled_branch);
+  HLT_CaloJet500_NoJetID_bulk = bulkRead.Make(HLT_CaloJet500_NoJetID_branch);
+  HLT_DiEl_bulk = bulkRead.Make(HLT_DiEl_branch);
+  HLT_DiMu_bulk = bulkRead.Make(HLT_DiMu_branch);
+  HLT_MuE_bulk = bulkRead.Make(HLT_MuE_branch);
+  nPhotons_bulk = bulkRead.Make(nPhotons_branch);
+  ph_ngoodjets_bulk = bulkRead.Make(ph_ngoodjets_branch);
+  ph_ngoodbtags_bulk = bulkRead.Make(ph_ngoodbtags_branch);
+  hardgenpt_bulk = bulkRead.Make(hardgenpt_branch);
+  calomet_bulk = bulkRead.Make(calomet_branch);
+  calomet_phi_bulk = bulkRead.Make(calomet_phi_branch);
+  lep1_pdgid_bulk = bulkRead.Make(lep1_pdgid_branch);
+  lep1_production_type_bulk = bulkRead.Make(lep1_production_type_branch);
+  lep1_MiniIso_bulk = bulkRead.Make(lep1_MiniIso_branch);
+  lep1_relIso_bulk = bulkRead.Make(lep1_relIso_branch);
+  lep1_passLooseID_bulk = bulkRead.Make(lep1_passLooseID_branch);
+  lep1_passMediumID_bulk = bulkRead.Make(lep1_passMediumID_branch);
+  lep1_passTightID_bulk = bulkRead.Make(lep1_passTightID_branch);
+  lep1_passVeto_bulk = bulkRead.Make(lep1_passVeto_branch);
+  lep1_mc_motherid_bulk = bulkRead.Make(lep1_mc_motherid_branch);
+  lep1_etaSC_bulk = bulkRead.Make(lep1_etaSC_branch);
+  lep1_dphiMET_bulk = bulkRead.Make(lep1_dphiMET_branch);
+  lep1_dphiMET_jup_bulk = bulkRead.Make(lep1_dphiMET_jup_branch);
+  lep1_dphiMET_jdown_bulk = bulkRead.Make(lep1_dphiMET_jdown_branch);
+  lep1_dphiMET_rl_bulk = bulkRead.Make(lep1_dphiMET_rl_branch);
+  lep1_dphiMET_rl_jup_bulk = bulkRead.Make(lep1_dphiMET_rl_jup_branch);
+  lep1_dphiMET_rl_jdown_bulk = bulkRead.Make(lep1_dphiMET_rl_jdown_branch);
+  lep2_pdgid_bulk = bulkRead.Make(lep2_pdgid_branch);
+  lep2_production_type_bulk = bulkRead.Make(lep2_production_type_branch);
+  lep2_MiniIso_bulk = bulkRead.Make(lep2_MiniIso_branch);
+  lep2_relIso_bulk = bulkRead.Make(lep2_relIso_branch);
+  lep2_passLooseID_bulk = bulkRead.Make(lep2_passLooseID_branch);
+  lep2_passMediumID_bulk = bulkRead.Make(lep2_passMediumID_branch);
+  lep2_passTightID_bulk = bulkRead.Make(lep2_passTightID_branch);
+  lep2_passVeto_bulk = bulkRead.Make(lep2_passVeto_branch);
+  lep2_mc_motherid_bulk = bulkRead.Make(lep2_mc_motherid_branch);
+  lep2_etaSC_bulk = bulkRead.Make(lep2_etaSC_branch);
+  lep2_dphiMET_bulk = bulkRead.Make(lep2_dphiMET_branch);
+  lep2_dphiMET_jup_bulk = bulkRead.Make(lep2_dphiMET_jup_branch);
+  lep2_dphiMET_jdown_bulk = bulkRead.Make(lep2_dphiMET_jdown_branch);
+  lep2_dphiMET_rl_bulk = bulkRead.Make(lep2_dphiMET_rl_branch);
+  lep2_dphiMET_rl_jup_bulk = bulkRead.Make(lep2_dphiMET_rl_jup_branch);
+  lep2_dphiMET_rl_jdown_bulk = bulkRead.Make(lep2_dphiMET_rl_jdown_branch);
+  nskimjets_bulk = bulkRead.Make(nskimjets_branch);
+  nskimbtagmed_bulk = bulkRead.Make(nskimbtagmed_branch);
+  nskimbtagloose_bulk = bulkRead.Make(nskimbtagloose_branch);
+  nskimbtagtight_bulk = bulkRead.Make(nskimbtagtight_branch);
+  ngoodjets_bulk = bulkRead.Make(ngoodjets_branch);
+  ngoodbtags_bulk = bulkRead.Make(ngoodbtags_branch);
+  nloosebtags_bulk = bulkRead.Make(nloosebtags_branch);
+  ntightbtags_bulk = bulkRead.Make(ntightbtags_branch);
+  nanalysisbtags_bulk = bulkRead.Make(nanalysisbtags_branch);
+  ak4_HT_bulk = bulkRead.Make(ak4_HT_branch);
+  ak4_htratiom_bulk = bulkRead.Make(ak4_htratiom_branch);
+  nsoftbtags_bulk = bulkRead.Make(nsoftbtags_branch);
+  jup_nskimjets_bulk = bulkRead.Make(jup_nskimjets_branch);
+  jup_nskimbtagmed_bulk = bulkRead.Make(jup_nskimbtagmed_branch);
+  jup_nskimbtagloose_bulk = bulkRead.Make(jup_nskimbtagloose_branch);
+  jup_nskimbtagtight_bulk = bulkRead.Make(jup_nskimbtagtight_branch);
+  jup_ngoodjets_bulk = bulkRead.Make(jup_ngoodjets_branch);
+  jup_ngoodbtags_bulk = bulkRead.Make(jup_ngoodbtags_branch);
+  jup_nloosebtags_bulk = bulkRead.Make(jup_nloosebtags_branch);
+  jup_ntightbtags_bulk = bulkRead.Make(jup_ntightbtags_branch);
+  jup_nanalysisbtags_bulk = bulkRead.Make(jup_nanalysisbtags_branch);
+  jup_ak4_HT_bulk = bulkRead.Make(jup_ak4_HT_branch);
+  jup_ak4_htratiom_bulk = bulkRead.Make(jup_ak4_htratiom_branch);
+  jup_nsoftbtags_bulk = bulkRead.Make(jup_nsoftbtags_branch);
+  jdown_nskimjets_bulk = bulkRead.Make(jdown_nskimjets_branch);
+  jdown_nskimbtagmed_bulk = bulkRead.Make(jdown_nskimbtagmed_branch);
+  jdown_nskimbtagloose_bulk = bulkRead.Make(jdown_nskimbtagloose_branch);
+  jdown_nskimbtagtight_bulk = bulkRead.Make(jdown_nskimbtagtight_branch);
+  jdown_ngoodjets_bulk = bulkRead.Make(jdown_ngoodjets_branch);
+  jdown_ngoodbtags_bulk = bulkRead.Make(jdown_ngoodbtags_branch);
+  jdown_nloosebtags_bulk = bulkRead.Make(jdown_nloosebtags_branch);
+  jdown_ntightbtags_bulk = bulkRead.Make(jdown_ntightbtags_branch);
+  jdown_nanalysisbtags_bulk = bulkRead.Make(jdown_nanalysisbtags_branch);
+  jdown_ak4_HT_bulk = bulkRead.Make(jdown_ak4_HT_branch);
+  jdown_ak4_htratiom_bulk = bulkRead.Make(jdown_ak4_htratiom_branch);
+  jdown_nsoftbtags_bulk = bulkRead.Make(jdown_nsoftbtags_branch);
+  gen_nfromtleps__bulk = bulkRead.Make(gen_nfromtleps__branch);
+  gen_nfromtnus__bulk = bulkRead.Make(gen_nfromtnus__branch);
+  gen_nfromtqs__bulk = bulkRead.Make(gen_nfromtqs__branch);
+  gen_nfromtbosons__bulk = bulkRead.Make(gen_nfromtbosons__branch);
+  gen_nfromtsusy__bulk = bulkRead.Make(gen_nfromtsusy__branch);
+  nGoodAK8PFJets_bulk = bulkRead.Make(nGoodAK8PFJets_branch);
+  lead_ak8deepdisc_top_bulk = bulkRead.Make(lead_ak8deepdisc_top_branch);
+  jup_nGoodAK8PFJets_bulk = bulkRead.Make(jup_nGoodAK8PFJets_branch);
+  jup_lead_ak8deepdisc_top_bulk = bulkRead.Make(jup_lead_ak8deepdisc_top_branch);
+  jdown_nGoodAK8PFJets_bulk = bulkRead.Make(jdown_nGoodAK8PFJets_branch);
+  jdown_lead_ak8deepdisc_top_bulk = bulkRead.Make(jdown_lead_ak8deepdisc_top_branch);
+  ngoodtaus_bulk = bulkRead.Make(ngoodtaus_branch);
+  ph_selectedidx_bulk = bulkRead.Make(ph_selectedidx_branch);
+  ph_met_bulk = bulkRead.Make(ph_met_branch);
+  ph_met_phi_bulk = bulkRead.Make(ph_met_phi_branch);
+  ph_HT_bulk = bulkRead.Make(ph_HT_branch);
+  ph_htssm_bulk = bulkRead.Make(ph_htssm_branch);
+  ph_htosm_bulk = bulkRead.Make(ph_htosm_branch);
+  ph_htratiom_bulk = bulkRead.Make(ph_htratiom_branch);
+  ph_mt_met_lep_bulk = bulkRead.Make(ph_mt_met_lep_branch);
+  ph_dphi_Wlep_bulk = bulkRead.Make(ph_dphi_Wlep_branch);
+  ph_MT2W_bulk = bulkRead.Make(ph_MT2W_branch);
+  ph_topness_bulk = bulkRead.Make(ph_topness_branch);
+  ph_topnessMod_bulk = bulkRead.Make(ph_topnessMod_branch);
+  ph_MT2_ll_bulk = bulkRead.Make(ph_MT2_ll_branch);
+  ph_MT2_lb_b_mass_bulk = bulkRead.Make(ph_MT2_lb_b_mass_branch);
+  ph_MT2_lb_b_bulk = bulkRead.Make(ph_MT2_lb_b_branch);
+  ph_MT2_lb_bqq_mass_bulk = bulkRead.Make(ph_MT2_lb_bqq_mass_branch);
+  ph_MT2_lb_bqq_bulk = bulkRead.Make(ph_MT2_lb_bqq_branch);
+  ph_hadronic_top_chi2_bulk = bulkRead.Make(ph_hadronic_top_chi2_branch);
+  ph_mindphi_met_j1_j2_bulk = bulkRead.Make(ph_mindphi_met_j1_j2_branch);
+  ph_Mlb_lead_bdiscr_bulk = bulkRead.Make(ph_Mlb_lead_bdiscr_branch);
+  ph_dR_lep_leadb_bulk = bulkRead.Make(ph_dR_lep_leadb_branch);
+  ph_Mlb_closestb_bulk = bulkRead.Make(ph_Mlb_closestb_branch);
+  ph_Mjjj_bulk = bulkRead.Make(ph_Mjjj_branch);
+  EA_fixgridfastjet_all_rho_bulk = bulkRead.Make(EA_fixgridfastjet_all_rho_branch);
+  HLT_Photon22_R9Id90_HE10_IsoM_bulk = bulkRead.Make(HLT_Photon22_R9Id90_HE10_IsoM_branch);
+  HLT_Photon30_R9Id90_HE10_IsoM_bulk = bulkRead.Make(HLT_Photon30_R9Id90_HE10_IsoM_branch);
+  HLT_Photon36_R9Id90_HE10_IsoM_bulk = bulkRead.Make(HLT_Photon36_R9Id90_HE10_IsoM_branch);
+  HLT_Photon50_R9Id90_HE10_IsoM_bulk = bulkRead.Make(HLT_Photon50_R9Id90_HE10_IsoM_branch);
+  HLT_Photon75_R9Id90_HE10_IsoM_bulk = bulkRead.Make(HLT_Photon75_R9Id90_HE10_IsoM_branch);
+  HLT_Photon90_R9Id90_HE10_IsoM_bulk = bulkRead.Make(HLT_Photon90_R9Id90_HE10_IsoM_branch);
+  HLT_Photon120_R9Id90_HE10_IsoM_bulk = bulkRead.Make(HLT_Photon120_R9Id90_HE10_IsoM_branch);
+  HLT_Photon165_R9Id90_HE10_IsoM_bulk = bulkRead.Make(HLT_Photon165_R9Id90_HE10_IsoM_branch);
+  HLT_Photon175_bulk = bulkRead.Make(HLT_Photon175_branch);
+  HLT_Photon165_HE10_bulk = bulkRead.Make(HLT_Photon165_HE10_branch);
+  HLT_Photon120_bulk = bulkRead.Make(HLT_Photon120_branch);
+  HLT_Photon200_bulk = bulkRead.Make(HLT_Photon200_branch);
+  HLT_Photon250_NoHE_bulk = bulkRead.Make(HLT_Photon250_NoHE_branch);
+  HLT_Photon300_NoHE_bulk = bulkRead.Make(HLT_Photon300_NoHE_branch);
+  HLT_bits_bulk = bulkRead.Make(HLT_bits_branch);
+  filt_cscbeamhalo_bulk = bulkRead.Make(filt_cscbeamhalo_branch);
+  filt_cscbeamhalo2015_bulk = bulkRead.Make(filt_cscbeamhalo2015_branch);
+  filt_globaltighthalo2016_bulk = bulkRead.Make(filt_globaltighthalo2016_branch);
+  filt_globalsupertighthalo2016_bulk = bulkRead.Make(filt_globalsupertighthalo2016_branch);
+  filt_ecallaser_bulk = bulkRead.Make(filt_ecallaser_branch);
+  filt_ecaltp_bulk = bulkRead.Make(filt_ecaltp_branch);
+  filt_ecalbadcalib_bulk = bulkRead.Make(filt_ecalbadcalib_branch);
+  filt_eebadsc_bulk = bulkRead.Make(filt_eebadsc_branch);
+  filt_goodvtx_bulk = bulkRead.Make(filt_goodvtx_branch);
+  filt_badevents_bulk = bulkRead.Make(filt_badevents_branch);
+  filt_hbhenoise_bulk = bulkRead.Make(filt_hbhenoise_branch);
+  filt_hbheisonoise_bulk = bulkRead.Make(filt_hbheisonoise_branch);
+  filt_hcallaser_bulk = bulkRead.Make(filt_hcallaser_branch);
+  filt_trkfail_bulk = bulkRead.Make(filt_trkfail_branch);
+  filt_trkPOG_bulk = bulkRead.Make(filt_trkPOG_branch);
+  filt_trkPOG_logerr_tmc_bulk = bulkRead.Make(filt_trkPOG_logerr_tmc_branch);
+  filt_trkPOG_tmc_bulk = bulkRead.Make(filt_trkPOG_tmc_branch);
+  filt_trkPOG_tms_bulk = bulkRead.Make(filt_trkPOG_tms_branch);
+  firstGoodVtxIdx_bulk = bulkRead.Make(firstGoodVtxIdx_branch);
+  filt_badChargedCandidateFilter_bulk = bulkRead.Make(filt_badChargedCandidateFilter_branch);
+  filt_badMuonFilter_bulk = bulkRead.Make(filt_badMuonFilter_branch);
+  filt_met_bulk = bulkRead.Make(filt_met_branch);
+  filt_fastsimjets_bulk = bulkRead.Make(filt_fastsimjets_branch);
+  filt_fastsimjets_jup_bulk = bulkRead.Make(filt_fastsimjets_jup_branch);
+  filt_fastsimjets_jdown_bulk = bulkRead.Make(filt_fastsimjets_jdown_branch);
+  filt_jetWithBadMuon_bulk = bulkRead.Make(filt_jetWithBadMuon_branch);
+  filt_jetWithBadMuon_jup_bulk = bulkRead.Make(filt_jetWithBadMuon_jup_branch);
+  filt_jetWithBadMuon_jdown_bulk = bulkRead.Make(filt_jetWithBadMuon_jdown_branch);
+  filt_pfovercalomet_bulk = bulkRead.Make(filt_pfovercalomet_branch);
+  filt_badmuons_bulk = bulkRead.Make(filt_badmuons_branch);
+  filt_duplicatemuons_bulk = bulkRead.Make(filt_duplicatemuons_branch);
+  filt_nobadmuons_bulk = bulkRead.Make(filt_nobadmuons_branch);
   tree->SetMakeClass(0);
 }
 
 void StopTree::GetEntry(unsigned int idx) {
-  // this only marks branches as not loaded, saving a lot of time
+  // this only moves on to a new generation, the branches loaded in previous ones get reloaded on access
   index = idx;
-  run_isLoaded = false;
-  ls_isLoaded = false;
-  evt_isLoaded = false;
-  nvtxs_isLoaded = false;
-  year_isLoaded = false;
-  sampver_isLoaded = false;
-  pu_nvtxs_isLoaded = false;
-  pfmet_isLoaded = false;
-  pfmet_phi_isLoaded = false;
-  pfmet_jup_isLoaded = false;
-  pfmet_phi_jup_isLoaded = false;
-  pfmet_jdown_isLoaded = false;
-  pfmet_phi_jdown_isLoaded = false;
-  pfmet_rl_isLoaded = false;
-  pfmet_phi_rl_isLoaded = false;
-  pfmet_rl_jup_isLoaded = false;
-  pfmet_phi_rl_jup_isLoaded = false;
-  pfmet_rl_jdown_isLoaded = false;
-  pfmet_phi_rl_jdown_isLoaded = false;
-  pfmet_egclean_isLoaded = false;
-  pfmet_egclean_phi_isLoaded = false;
-  pfmet_muegclean_isLoaded = false;
-  pfmet_muegclean_phi_isLoaded = false;
-  pfmet_muegcleanfix_isLoaded = false;
-  pfmet_muegcleanfix_phi_isLoaded = false;
-  pfmet_uncorr_isLoaded = false;
-  pfmet_uncorr_phi_isLoaded = false;
-  pfmet_original_isLoaded = false;
-  pfmet_original_phi_isLoaded = false;
-  scale1fb_isLoaded = false;
-  xsec_isLoaded = false;
-  xsec_uncert_isLoaded = false;
-  kfactor_isLoaded = false;
-  pu_ntrue_isLoaded = false;
-  ngoodleps_isLoaded = false;
-  nlooseleps_isLoaded = false;
-  nvetoleps_isLoaded = false;
-  is_data_isLoaded = false;
-  dataset_isLoaded = false;
-  filename_isLoaded = false;
-  cms3tag_isLoaded = false;
-  nEvents_isLoaded = false;
-  nEvents_goodvtx_isLoaded = false;
-  nEvents_MET30_isLoaded = false;
-  nEvents_1goodlep_isLoaded = false;
-  nEvents_2goodjets_isLoaded = false;
-  is0lep_isLoaded = false;
-  is1lep_isLoaded = false;
-  is2lep_isLoaded = false;
-  isZtoNuNu_isLoaded = false;
-  is1lepFromW_isLoaded = false;
-  is1lepFromTop_isLoaded = false;
-  MT2W_isLoaded = false;
-  MT2W_rl_isLoaded = false;
-  MT2_ll_isLoaded = false;
-  mindphi_met_j1_j2_isLoaded = false;
-  mindphi_met_j1_j2_rl_isLoaded = false;
-  mt_met_lep_isLoaded = false;
-  mt_met_lep_rl_isLoaded = false;
-  MT2W_jup_isLoaded = false;
-  MT2W_rl_jup_isLoaded = false;
-  MT2_ll_jup_isLoaded = false;
-  mindphi_met_j1_j2_jup_isLoaded = false;
-  mindphi_met_j1_j2_rl_jup_isLoaded = false;
-  mt_met_lep_jup_isLoaded = false;
-  mt_met_lep_rl_jup_isLoaded = false;
-  MT2W_jdown_isLoaded = false;
-  MT2W_rl_jdown_isLoaded = false;
-  MT2_ll_jdown_isLoaded = false;
-  mindphi_met_j1_j2_jdown_isLoaded = false;
-  mindphi_met_j1_j2_rl_jdown_isLoaded = false;
-  mt_met_lep_jdown_isLoaded = false;
-  mt_met_lep_rl_jdown_isLoaded = false;
-  hadronic_top_chi2_isLoaded = false;
-  ak4pfjets_rho_isLoaded = false;
-  pdf_up_weight_isLoaded = false;
-  pdf_down_weight_isLoaded = false;
-  genweightsID_isLoaded = false;
-  ngenweights_isLoaded = false;
-  genweights_isLoaded = false;
-  weight_Q2_up_isLoaded = false;
-  weight_Q2_down_isLoaded = false;
-  weight_alphas_up_isLoaded = false;
-  weight_alphas_down_isLoaded = false;
-  weight_btagsf_isLoaded = false;
-  weight_btagsf_heavy_UP_isLoaded = false;
-  weight_btagsf_light_UP_isLoaded = false;
-  weight_btagsf_heavy_DN_isLoaded = false;
-  weight_btagsf_light_DN_isLoaded = false;
-  weight_btagsf_fastsim_UP_isLoaded = false;
-  weight_btagsf_fastsim_DN_isLoaded = false;
-  weight_analysisbtagsf_isLoaded = false;
-  weight_analysisbtagsf_heavy_UP_isLoaded = false;
-  weight_analysisbtagsf_light_UP_isLoaded = false;
-  weight_analysisbtagsf_heavy_DN_isLoaded = false;
-  weight_analysisbtagsf_light_DN_isLoaded = false;
-  weight_analysisbtagsf_fastsim_UP_isLoaded = false;
-  weight_analysisbtagsf_fastsim_DN_isLoaded = false;
-  weight_tightbtagsf_isLoaded = false;
-  weight_tightbtagsf_heavy_UP_isLoaded = false;
-  weight_tightbtagsf_light_UP_isLoaded = false;
-  weight_tightbtagsf_heavy_DN_isLoaded = false;
-  weight_tightbtagsf_light_DN_isLoaded = false;
-  weight_tightbtagsf_fastsim_UP_isLoaded = false;
-  weight_tightbtagsf_fastsim_DN_isLoaded = false;
-  weight_loosebtagsf_isLoaded = false;
-  weight_loosebtagsf_heavy_UP_isLoaded = false;
-  weight_loosebtagsf_light_UP_isLoaded = false;
-  weight_loosebtagsf_heavy_DN_isLoaded = false;
-  weight_loosebtagsf_light_DN_isLoaded = false;
-  weight_loosebtagsf_fastsim_UP_isLoaded = false;
-  weight_loosebtagsf_fastsim_DN_isLoaded = false;
-  weight_lepSF_isLoaded = false;
-  weight_lepSF_up_isLoaded = false;
-  weight_lepSF_down_isLoaded = false;
-  weight_vetoLepSF_isLoaded = false;
-  weight_vetoLepSF_up_isLoaded = false;
-  weight_vetoLepSF_down_isLoaded = false;
-  weight_lepSF_fastSim_isLoaded = false;
-  weight_lepSF_fastSim_up_isLoaded = false;
-  weight_lepSF_fastSim_down_isLoaded = false;
-  weight_ISR_isLoaded = false;
-  weight_ISRup_isLoaded = false;
-  weight_ISRdown_isLoaded = false;
-  weight_PU_isLoaded = false;
-  weight_PUup_isLoaded = false;
-  weight_PUdown_isLoaded = false;
-  weight_ISRnjets_isLoaded = false;
-  weight_ISRnjets_UP_isLoaded = false;
-  weight_ISRnjets_DN_isLoaded = false;
-  weight_L1prefire_isLoaded = false;
-  weight_L1prefire_UP_isLoaded = false;
-  weight_L1prefire_DN_isLoaded = false;
-  NISRjets_isLoaded = false;
-  NnonISRjets_isLoaded = false;
-  sparms_names_isLoaded = false;
-  sparms_values_isLoaded = false;
-  sparms_subProcessId_isLoaded = false;
-  mass_lsp_isLoaded = false;
-  mass_chargino_isLoaded = false;
-  mass_stop_isLoaded = false;
-  mass_gluino_isLoaded = false;
-  genmet_isLoaded = false;
-  genmet_phi_isLoaded = false;
-  nupt_isLoaded = false;
-  genht_isLoaded = false;
-  PassTrackVeto_isLoaded = false;
-  PassTauVeto_isLoaded = false;
-  topness_isLoaded = false;
-  topnessMod_isLoaded = false;
-  topnessMod_rl_isLoaded = false;
-  topnessMod_jup_isLoaded = false;
-  topnessMod_rl_jup_isLoaded = false;
-  topnessMod_jdown_isLoaded = false;
-  topnessMod_rl_jdown_isLoaded = false;
-  Mlb_closestb_isLoaded = false;
-  Mlb_lead_bdiscr_isLoaded = false;
-  Mlb_closestb_jup_isLoaded = false;
-  Mlb_lead_bdiscr_jup_isLoaded = false;
-  Mlb_closestb_jdown_isLoaded = false;
-  Mlb_lead_bdiscr_jdown_isLoaded = false;
-  HLT_SingleEl_isLoaded = false;
-  HLT_SingleMu_isLoaded = false;
-  HLT_MET_isLoaded = false;
-  HLT_MET_MHT_isLoaded = false;
-  HLT_MET100_MHT100_isLoaded = false;
-  HLT_MET110_MHT110_isLoaded = false;
-  HLT_MET120_MHT120_isLoaded = false;
-  HLT_MET130_MHT130_isLoaded = false;
-  HLT_PFHT_unprescaled_isLoaded = false;
-  HLT_PFHT_prescaled_isLoaded = false;
-  HLT_AK8Jet_unprescaled_isLoaded = false;
-  HLT_AK8Jet_prescaled_isLoaded = false;
-  HLT_CaloJet500_NoJetID_isLoaded = false;
-  HLT_DiEl_isLoaded = false;
-  HLT_DiMu_isLoaded = false;
-  HLT_MuE_isLoaded = false;
-  nPhotons_isLoaded = false;
-  ph_ngoodjets_isLoaded = false;
-  ph_ngoodbtags_isLoaded = false;
-  hardgenpt_isLoaded = false;
-  calomet_isLoaded = false;
-  calomet_phi_isLoaded = false;
-  lep1_pdgid_isLoaded = false;
-  lep1_production_type_isLoaded = false;
-  lep1_MiniIso_isLoaded = false;
-  lep1_relIso_isLoaded = false;
-  lep1_passLooseID_isLoaded = false;
-  lep1_passMediumID_isLoaded = false;
-  lep1_passTightID_isLoaded = false;
-  lep1_passVeto_isLoaded = false;
-  lep1_p4_isLoaded = false;
-  lep1_mcp4_isLoaded = false;
-  lep1_mc_motherid_isLoaded = false;
-  lep1_etaSC_isLoaded = false;
-  lep1_dphiMET_isLoaded = false;
-  lep1_dphiMET_jup_isLoaded = false;
-  lep1_dphiMET_jdown_isLoaded = false;
-  lep1_dphiMET_rl_isLoaded = false;
-  lep1_dphiMET_rl_jup_isLoaded = false;
-  lep1_dphiMET_rl_jdown_isLoaded = false;
-  lep2_pdgid_isLoaded = false;
-  lep2_production_type_isLoaded = false;
-  lep2_MiniIso_isLoaded = false;
-  lep2_relIso_isLoaded = false;
-  lep2_passLooseID_isLoaded = false;
-  lep2_passMediumID_isLoaded = false;
-  lep2_passTightID_isLoaded = false;
-  lep2_passVeto_isLoaded = false;
-  lep2_p4_isLoaded = false;
-  lep2_mcp4_isLoaded = false;
-  lep2_mc_motherid_isLoaded = false;
-  lep2_etaSC_isLoaded = false;
-  lep2_dphiMET_isLoaded = false;
-  lep2_dphiMET_jup_isLoaded = false;
-  lep2_dphiMET_jdown_isLoaded = false;
-  lep2_dphiMET_rl_isLoaded = false;
-  lep2_dphiMET_rl_jup_isLoaded = false;
-  lep2_dphiMET_rl_jdown_isLoaded = false;
-  ph_sigmaIEtaEta_fill5x5_isLoaded = false;
-  ph_hOverE_isLoaded = false;
-  ph_r9_isLoaded = false;
-  ph_chiso_isLoaded = false;
-  ph_nhiso_isLoaded = false;
-  ph_phiso_isLoaded = false;
-  ph_passLooseID_isLoaded = false;
-  ph_passMediumID_isLoaded = false;
-  ph_passTightID_isLoaded = false;
-  ph_overlapJetId_isLoaded = false;
-  ph_p4_isLoaded = false;
-  ph_mcp4_isLoaded = false;
-  ph_mcMatchId_isLoaded = false;
-  ph_genIso04_isLoaded = false;
-  ph_drMinParton_isLoaded = false;
-  nskimjets_isLoaded = false;
-  nskimbtagmed_isLoaded = false;
-  nskimbtagloose_isLoaded = false;
-  nskimbtagtight_isLoaded = false;
-  ngoodjets_isLoaded = false;
-  ngoodbtags_isLoaded = false;
-  nloosebtags_isLoaded = false;
-  ntightbtags_isLoaded = false;
-  nanalysisbtags_isLoaded = false;
-  ak4_HT_isLoaded = false;
-  ak4_htratiom_isLoaded = false;
-  dphi_ak4pfjet_met_isLoaded = false;
-  ak4pfjets_p4_isLoaded = false;
-  ak4pfjets_passMEDbtag_isLoaded = false;
-  ak4pfjets_deepCSV_isLoaded = false;
-  ak4pfjets_CSV_isLoaded = false;
-  ak4pfjets_mva_isLoaded = false;
-  ak4pfjets_parton_flavor_isLoaded = false;
-  ak4pfjets_hadron_flavor_isLoaded = false;
-  ak4pfjets_loose_puid_isLoaded = false;
-  ak4pfjets_loose_pfid_isLoaded = false;
-  ak4pfjets_leadMEDbjet_p4_isLoaded = false;
-  ak4pfjets_leadbtag_p4_isLoaded = false;
-  ak4genjets_p4_isLoaded = false;
-  softtags_p4_isLoaded = false;
-  nsoftbtags_isLoaded = false;
-  jup_nskimjets_isLoaded = false;
-  jup_nskimbtagmed_isLoaded = false;
-  jup_nskimbtagloose_isLoaded = false;
-  jup_nskimbtagtight_isLoaded = false;
-  jup_ngoodjets_isLoaded = false;
-  jup_ngoodbtags_isLoaded = false;
-  jup_nloosebtags_isLoaded = false;
-  jup_ntightbtags_isLoaded = false;
-  jup_nanalysisbtags_isLoaded = false;
-  jup_ak4_HT_isLoaded = false;
-  jup_ak4_htratiom_isLoaded = false;
-  jup_dphi_ak4pfjet_met_isLoaded = false;
-  jup_ak4pfjets_p4_isLoaded = false;
-  jup_ak4pfjets_passMEDbtag_isLoaded = false;
-  jup_ak4pfjets_deepCSV_isLoaded = false;
-  jup_ak4pfjets_CSV_isLoaded = false;
-  jup_ak4pfjets_mva_isLoaded = false;
-  jup_ak4pfjets_parton_flavor_isLoaded = false;
-  jup_ak4pfjets_hadron_flavor_isLoaded = false;
-  jup_ak4pfjets_loose_puid_isLoaded = false;
-  jup_ak4pfjets_loose_pfid_isLoaded = false;
-  jup_ak4pfjets_leadMEDbjet_p4_isLoaded = false;
-  jup_ak4pfjets_leadbtag_p4_isLoaded = false;
-  jup_ak4genjets_p4_isLoaded = false;
-  jup_softtags_p4_isLoaded = false;
-  jup_nsoftbtags_isLoaded = false;
-  jdown_nskimjets_isLoaded = false;
-  jdown_nskimbtagmed_isLoaded = false;
-  jdown_nskimbtagloose_isLoaded = false;
-  jdown_nskimbtagtight_isLoaded = false;
-  jdown_ngoodjets_isLoaded = false;
-  jdown_ngoodbtags_isLoaded = false;
-  jdown_nloosebtags_isLoaded = false;
-  jdown_ntightbtags_isLoaded = false;
-  jdown_nanalysisbtags_isLoaded = false;
-  jdown_ak4_HT_isLoaded = false;
-  jdown_ak4_htratiom_isLoaded = false;
-  jdown_dphi_ak4pfjet_met_isLoaded = false;
-  jdown_ak4pfjets_p4_isLoaded = false;
-  jdown_ak4pfjets_passMEDbtag_isLoaded = false;
-  jdown_ak4pfjets_deepCSV_isLoaded = false;
-  jdown_ak4pfjets_CSV_isLoaded = false;
-  jdown_ak4pfjets_mva_isLoaded = false;
-  jdown_ak4pfjets_parton_flavor_isLoaded = false;
-  jdown_ak4pfjets_hadron_flavor_isLoaded = false;
-  jdown_ak4pfjets_loose_puid_isLoaded = false;
-  jdown_ak4pfjets_loose_pfid_isLoaded = false;
-  jdown_ak4pfjets_leadMEDbjet_p4_isLoaded = false;
-  jdown_ak4pfjets_leadbtag_p4_isLoaded = false;
-  jdown_ak4genjets_p4_isLoaded = false;
-  jdown_softtags_p4_isLoaded = false;
-  jdown_nsoftbtags_isLoaded = false;
-  genleps_isfromt_isLoaded = false;
-  genleps_p4_isLoaded = false;
-  genleps_id_isLoaded = false;
-  genleps__genpsidx_isLoaded = false;
-  genleps_status_isLoaded = false;
-  genleps_fromHardProcessDecayed_isLoaded = false;
-  genleps_fromHardProcessFinalState_isLoaded = false;
-  genleps_isHardProcess_isLoaded = false;
-  genleps_isLastCopy_isLoaded = false;
-  genleps_gentaudecay_isLoaded = false;
-  gen_nfromtleps__isLoaded = false;
-  genleps_motherp4_isLoaded = false;
-  genleps_motherid_isLoaded = false;
-  genleps_motheridx_isLoaded = false;
-  genleps_motherstatus_isLoaded = false;
-  genleps_gmotherp4_isLoaded = false;
-  genleps_gmotherid_isLoaded = false;
-  genleps_gmotheridx_isLoaded = false;
-  genleps_gmotherstatus_isLoaded = false;
-  gennus_isfromt_isLoaded = false;
-  gennus_p4_isLoaded = false;
-  gennus_id_isLoaded = false;
-  gennus__genpsidx_isLoaded = false;
-  gennus_status_isLoaded = false;
-  gennus_fromHardProcessDecayed_isLoaded = false;
-  gennus_fromHardProcessFinalState_isLoaded = false;
-  gennus_isHardProcess_isLoaded = false;
-  gennus_isLastCopy_isLoaded = false;
-  gennus_gentaudecay_isLoaded = false;
-  gen_nfromtnus__isLoaded = false;
-  gennus_motherp4_isLoaded = false;
-  gennus_motherid_isLoaded = false;
-  gennus_motheridx_isLoaded = false;
-  gennus_motherstatus_isLoaded = false;
-  gennus_gmotherp4_isLoaded = false;
-  gennus_gmotherid_isLoaded = false;
-  gennus_gmotheridx_isLoaded = false;
-  gennus_gmotherstatus_isLoaded = false;
-  genqs_isfromt_isLoaded = false;
-  genqs_p4_isLoaded = false;
-  genqs_id_isLoaded = false;
-  genqs__genpsidx_isLoaded = false;
-  genqs_status_isLoaded = false;
-  genqs_fromHardProcessDecayed_isLoaded = false;
-  genqs_fromHardProcessFinalState_isLoaded = false;
-  genqs_isHardProcess_isLoaded = false;
-  genqs_isLastCopy_isLoaded = false;
-  genqs_gentaudecay_isLoaded = false;
-  gen_nfromtqs__isLoaded = false;
-  genqs_motherp4_isLoaded = false;
-  genqs_motherid_isLoaded = false;
-  genqs_motheridx_isLoaded = false;
-  genqs_motherstatus_isLoaded = false;
-  genqs_gmotherp4_isLoaded = false;
-  genqs_gmotherid_isLoaded = false;
-  genqs_gmotheridx_isLoaded = false;
-  genqs_gmotherstatus_isLoaded = false;
-  genbosons_isfromt_isLoaded = false;
-  genbosons_p4_isLoaded = false;
-  genbosons_id_isLoaded = false;
-  genbosons__genpsidx_isLoaded = false;
-  genbosons_status_isLoaded = false;
-  genbosons_fromHardProcessDecayed_isLoaded = false;
-  genbosons_fromHardProcessFinalState_isLoaded = false;
-  genbosons_isHardProcess_isLoaded = false;
-  genbosons_isLastCopy_isLoaded = false;
-  genbosons_gentaudecay_isLoaded = false;
-  gen_nfromtbosons__isLoaded = false;
-  genbosons_motherp4_isLoaded = false;
-  genbosons_motherid_isLoaded = false;
-  genbosons_motheridx_isLoaded = false;
-  genbosons_motherstatus_isLoaded = false;
-  genbosons_gmotherp4_isLoaded = false;
-  genbosons_gmotherid_isLoaded = false;
-  genbosons_gmotheridx_isLoaded = false;
-  genbosons_gmotherstatus_isLoaded = false;
-  gensusy_isfromt_isLoaded = false;
-  gensusy_p4_isLoaded = false;
-  gensusy_id_isLoaded = false;
-  gensusy__genpsidx_isLoaded = false;
-  gensusy_status_isLoaded = false;
-  gensusy_fromHardProcessDecayed_isLoaded = false;
-  gensusy_fromHardProcessFinalState_isLoaded = false;
-  gensusy_isHardProcess_isLoaded = false;
-  gensusy_isLastCopy_isLoaded = false;
-  gensusy_gentaudecay_isLoaded = false;
-  gen_nfromtsusy__isLoaded = false;
-  gensusy_motherp4_isLoaded = false;
-  gensusy_motherid_isLoaded = false;
-  gensusy_motheridx_isLoaded = false;
-  gensusy_motherstatus_isLoaded = false;
-  gensusy_gmotherp4_isLoaded = false;
-  gensusy_gmotherid_isLoaded = false;
-  gensusy_gmotheridx_isLoaded = false;
-  gensusy_gmotherstatus_isLoaded = false;
-  ak8pfjets_p4_isLoaded = false;
-  ak8pfjets_tau1_isLoaded = false;
-  ak8pfjets_tau2_isLoaded = false;
-  ak8pfjets_tau3_isLoaded = false;
-  ak8pfjets_parton_flavor_isLoaded = false;
-  nGoodAK8PFJets_isLoaded = false;
-  ak8pfjets_deepdisc_qcd_isLoaded = false;
-  ak8pfjets_deepdisc_top_isLoaded = false;
-  ak8pfjets_deepdisc_w_isLoaded = false;
-  ak8pfjets_deepdisc_z_isLoaded = false;
-  ak8pfjets_deepdisc_zbb_isLoaded = false;
-  ak8pfjets_deepdisc_hbb_isLoaded = false;
-  ak8pfjets_deepdisc_h4q_isLoaded = false;
-  lead_ak8deepdisc_top_isLoaded = false;
-  jup_ak8pfjets_p4_isLoaded = false;
-  jup_ak8pfjets_tau1_isLoaded = false;
-  jup_ak8pfjets_tau2_isLoaded = false;
-  jup_ak8pfjets_tau3_isLoaded = false;
-  jup_ak8pfjets_parton_flavor_isLoaded = false;
-  jup_nGoodAK8PFJets_isLoaded = false;
-  jup_ak8pfjets_deepdisc_qcd_isLoaded = false;
-  jup_ak8pfjets_deepdisc_top_isLoaded = false;
-  jup_ak8pfjets_deepdisc_w_isLoaded = false;
-  jup_ak8pfjets_deepdisc_z_isLoaded = false;
-  jup_ak8pfjets_deepdisc_zbb_isLoaded = false;
-  jup_ak8pfjets_deepdisc_hbb_isLoaded = false;
-  jup_ak8pfjets_deepdisc_h4q_isLoaded = false;
-  jup_lead_ak8deepdisc_top_isLoaded = false;
-  jdown_ak8pfjets_p4_isLoaded = false;
-  jdown_ak8pfjets_tau1_isLoaded = false;
-  jdown_ak8pfjets_tau2_isLoaded = false;
-  jdown_ak8pfjets_tau3_isLoaded = false;
-  jdown_ak8pfjets_parton_flavor_isLoaded = false;
-  jdown_nGoodAK8PFJets_isLoaded = false;
-  jdown_ak8pfjets_deepdisc_qcd_isLoaded = false;
-  jdown_ak8pfjets_deepdisc_top_isLoaded = false;
-  jdown_ak8pfjets_deepdisc_w_isLoaded = false;
-  jdown_ak8pfjets_deepdisc_z_isLoaded = false;
-  jdown_ak8pfjets_deepdisc_zbb_isLoaded = false;
-  jdown_ak8pfjets_deepdisc_hbb_isLoaded = false;
-  jdown_ak8pfjets_deepdisc_h4q_isLoaded = false;
-  jdown_lead_ak8deepdisc_top_isLoaded = false;
-  ak4pfjets_cvsl_isLoaded = false;
-  ak4pfjets_ptD_isLoaded = false;
-  ak4pfjets_axis1_isLoaded = false;
-  ak4pfjets_axis2_isLoaded = false;
-  ak4pfjets_mult_isLoaded = false;
-  ak4pfjets_deepCSVb_isLoaded = false;
-  ak4pfjets_deepCSVbb_isLoaded = false;
-  ak4pfjets_deepCSVc_isLoaded = false;
-  ak4pfjets_deepCSVl_isLoaded = false;
-  topcands_ak4idx_isLoaded = false;
-  topcands_disc_isLoaded = false;
-  topcands_p4_isLoaded = false;
-  topcands_Wp4_isLoaded = false;
-  tftops_p4_isLoaded = false;
-  tftops_disc_isLoaded = false;
-  tftops_subjet_pt_isLoaded = false;
-  tftops_subjet_eta_isLoaded = false;
-  tftops_subjet_phi_isLoaded = false;
-  jup_ak4pfjets_cvsl_isLoaded = false;
-  jup_ak4pfjets_ptD_isLoaded = false;
-  jup_ak4pfjets_axis1_isLoaded = false;
-  jup_ak4pfjets_axis2_isLoaded = false;
-  jup_ak4pfjets_mult_isLoaded = false;
-  jup_ak4pfjets_deepCSVb_isLoaded = false;
-  jup_ak4pfjets_deepCSVbb_isLoaded = false;
-  jup_ak4pfjets_deepCSVc_isLoaded = false;
-  jup_ak4pfjets_deepCSVl_isLoaded = false;
-  jup_topcands_ak4idx_isLoaded = false;
-  jup_topcands_disc_isLoaded = false;
-  jup_topcands_p4_isLoaded = false;
-  jup_topcands_Wp4_isLoaded = false;
-  jup_tftops_p4_isLoaded = false;
-  jup_tftops_disc_isLoaded = false;
-  jup_tftops_subjet_pt_isLoaded = false;
-  jup_tftops_subjet_eta_isLoaded = false;
-  jup_tftops_subjet_phi_isLoaded = false;
-  jdown_ak4pfjets_cvsl_isLoaded = false;
-  jdown_ak4pfjets_ptD_isLoaded = false;
-  jdown_ak4pfjets_axis1_isLoaded = false;
-  jdown_ak4pfjets_axis2_isLoaded = false;
-  jdown_ak4pfjets_mult_isLoaded = false;
-  jdown_ak4pfjets_deepCSVb_isLoaded = false;
-  jdown_ak4pfjets_deepCSVbb_isLoaded = false;
-  jdown_ak4pfjets_deepCSVc_isLoaded = false;
-  jdown_ak4pfjets_deepCSVl_isLoaded = false;
-  jdown_topcands_ak4idx_isLoaded = false;
-  jdown_topcands_disc_isLoaded = false;
-  jdown_topcands_p4_isLoaded = false;
-  jdown_topcands_Wp4_isLoaded = false;
-  jdown_tftops_p4_isLoaded = false;
-  jdown_tftops_disc_isLoaded = false;
-  jdown_tftops_subjet_pt_isLoaded = false;
-  jdown_tftops_subjet_eta_isLoaded = false;
-  jdown_tftops_subjet_phi_isLoaded = false;
-  tau_IDnames_isLoaded = false;
-  tau_p4_isLoaded = false;
-  tau_ID_isLoaded = false;
-  tau_passID_isLoaded = false;
-  ngoodtaus_isLoaded = false;
-  tau_isVetoTau_isLoaded = false;
-  tau_isVetoTau_v2_isLoaded = false;
-  isoTracks_p4_isLoaded = false;
-  isoTracks_charge_isLoaded = false;
-  isoTracks_absIso_isLoaded = false;
-  isoTracks_dz_isLoaded = false;
-  isoTracks_pdgId_isLoaded = false;
-  isoTracks_isVetoTrack_isLoaded = false;
-  isoTracks_isVetoTrack_v2_isLoaded = false;
-  isoTracks_isVetoTrack_v3_isLoaded = false;
-  ph_selectedidx_isLoaded = false;
-  ph_met_isLoaded = false;
-  ph_met_phi_isLoaded = false;
-  ph_HT_isLoaded = false;
-  ph_htssm_isLoaded = false;
-  ph_htosm_isLoaded = false;
-  ph_htratiom_isLoaded = false;
-  ph_mt_met_lep_isLoaded = false;
-  ph_dphi_Wlep_isLoaded = false;
-  ph_MT2W_isLoaded = false;
-  ph_topness_isLoaded = false;
-  ph_topnessMod_isLoaded = false;
-  ph_MT2_ll_isLoaded = false;
-  ph_MT2_lb_b_mass_isLoaded = false;
-  ph_MT2_lb_b_isLoaded = false;
-  ph_MT2_lb_bqq_mass_isLoaded = false;
-  ph_MT2_lb_bqq_isLoaded = false;
-  ph_hadronic_top_chi2_isLoaded = false;
-  ph_mindphi_met_j1_j2_isLoaded = false;
-  ph_Mlb_lead_bdiscr_isLoaded = false;
-  ph_dR_lep_leadb_isLoaded = false;
-  ph_Mlb_closestb_isLoaded = false;
-  ph_Mjjj_isLoaded = false;
-  EA_fixgridfastjet_all_rho_isLoaded = false;
-  HLT_Photon22_R9Id90_HE10_IsoM_isLoaded = false;
-  HLT_Photon30_R9Id90_HE10_IsoM_isLoaded = false;
-  HLT_Photon36_R9Id90_HE10_IsoM_isLoaded = false;
-  HLT_Photon50_R9Id90_HE10_IsoM_isLoaded = false;
-  HLT_Photon75_R9Id90_HE10_IsoM_isLoaded = false;
-  HLT_Photon90_R9Id90_HE10_IsoM_isLoaded = false;
-  HLT_Photon120_R9Id90_HE10_IsoM_isLoaded = false;
-  HLT_Photon165_R9Id90_HE10_IsoM_isLoaded = false;
-  HLT_Photon175_isLoaded = false;
-  HLT_Photon165_HE10_isLoaded = false;
-  HLT_Photon120_isLoaded = false;
-  HLT_Photon200_isLoaded = false;
-  HLT_Photon250_NoHE_isLoaded = false;
-  HLT_Photon300_NoHE_isLoaded = false;
-  filt_cscbeamhalo_isLoaded = false;
-  filt_cscbeamhalo2015_isLoaded = false;
-  filt_globaltighthalo2016_isLoaded = false;
-  filt_globalsupertighthalo2016_isLoaded = false;
-  filt_ecallaser_isLoaded = false;
-  filt_ecaltp_isLoaded = false;
-  filt_ecalbadcalib_isLoaded = false;
-  filt_eebadsc_isLoaded = false;
-  filt_goodvtx_isLoaded = false;
-  filt_badevents_isLoaded = false;
-  filt_hbhenoise_isLoaded = false;
-  filt_hbheisonoise_isLoaded = false;
-  filt_hcallaser_isLoaded = false;
-  filt_trkfail_isLoaded = false;
-  filt_trkPOG_isLoaded = false;
-  filt_trkPOG_logerr_tmc_isLoaded = false;
-  filt_trkPOG_tmc_isLoaded = false;
-  filt_trkPOG_tms_isLoaded = false;
-  firstGoodVtxIdx_isLoaded = false;
-  filt_badChargedCandidateFilter_isLoaded = false;
-  filt_badMuonFilter_isLoaded = false;
-  filt_met_isLoaded = false;
-  filt_fastsimjets_isLoaded = false;
-  filt_fastsimjets_jup_isLoaded = false;
-  filt_fastsimjets_jdown_isLoaded = false;
-  filt_jetWithBadMuon_isLoaded = false;
-  filt_jetWithBadMuon_jup_isLoaded = false;
-  filt_jetWithBadMuon_jdown_isLoaded = false;
-  filt_pfovercalomet_isLoaded = false;
-  filt_badmuons_isLoaded = false;
-  filt_duplicatemuons_isLoaded = false;
-  filt_nobadmuons_isLoaded = false;
+  ++entryGeneration;
+}
+
+void StopTree::SetFlatSkim(FlatSkim* skim) {
+  lep1_p4_flat.Init(skim, "lep1_p4");
+  lep1_mcp4_flat.Init(skim, "lep1_mcp4");
+  lep2_p4_flat.Init(skim, "lep2_p4");
+  lep2_mcp4_flat.Init(skim, "lep2_mcp4");
+  ph_p4_flat.Init(skim, "ph_p4");
+  ph_mcp4_flat.Init(skim, "ph_mcp4");
+  ak4pfjets_p4_flat.Init(skim, "ak4pfjets_p4");
+  ak4pfjets_leadMEDbjet_p4_flat.Init(skim, "ak4pfjets_leadMEDbjet_p4");
+  ak4pfjets_leadbtag_p4_flat.Init(skim, "ak4pfjets_leadbtag_p4");
+  ak4genjets_p4_flat.Init(skim, "ak4genjets_p4");
+  softtags_p4_flat.Init(skim, "softtags_p4");
+  jup_ak4pfjets_p4_flat.Init(skim, "jup_ak4pfjets_p4");
+  jup_ak4pfjets_leadMEDbjet_p4_flat.Init(skim, "jup_ak4pfjets_leadMEDbjet_p4");
+  jup_ak4pfjets_leadbtag_p4_flat.Init(skim, "jup_ak4pfjets_leadbtag_p4");
+  jup_ak4genjets_p4_flat.Init(skim, "jup_ak4genjets_p4");
+  jup_softtags_p4_flat.Init(skim, "jup_softtags_p4");
+  jdown_ak4pfjets_p4_flat.Init(skim, "jdown_ak4pfjets_p4");
+  jdown_ak4pfjets_leadMEDbjet_p4_flat.Init(skim, "jdown_ak4pfjets_leadMEDbjet_p4");
+  jdown_ak4pfjets_leadbtag_p4_flat.Init(skim, "jdown_ak4pfjets_leadbtag_p4");
+  jdown_ak4genjets_p4_flat.Init(skim, "jdown_ak4genjets_p4");
+  jdown_softtags_p4_flat.Init(skim, "jdown_softtags_p4");
+  genleps_p4_flat.Init(skim, "genleps_p4");
+  genleps_motherp4_flat.Init(skim, "genleps_motherp4");
+  genleps_gmotherp4_flat.Init(skim, "genleps_gmotherp4");
+  gennus_p4_flat.Init(skim, "gennus_p4");
+  gennus_motherp4_flat.Init(skim, "gennus_motherp4");
+  gennus_gmotherp4_flat.Init(skim, "gennus_gmotherp4");
+  genqs_p4_flat.Init(skim, "genqs_p4");
+  genqs_motherp4_flat.Init(skim, "genqs_motherp4");
+  genqs_gmotherp4_flat.Init(skim, "genqs_gmotherp4");
+  genbosons_p4_flat.Init(skim, "genbosons_p4");
+  genbosons_motherp4_flat.Init(skim, "genbosons_motherp4");
+  genbosons_gmotherp4_flat.Init(skim, "genbosons_gmotherp4");
+  gensusy_p4_flat.Init(skim, "gensusy_p4");
+  gensusy_motherp4_flat.Init(skim, "gensusy_motherp4");
+  gensusy_gmotherp4_flat.Init(skim, "gensusy_gmotherp4");
+  ak8pfjets_p4_flat.Init(skim, "ak8pfjets_p4");
+  jup_ak8pfjets_p4_flat.Init(skim, "jup_ak8pfjets_p4");
+  jdown_ak8pfjets_p4_flat.Init(skim, "jdown_ak8pfjets_p4");
+  topcands_p4_flat.Init(skim, "topcands_p4");
+  topcands_Wp4_flat.Init(skim, "topcands_Wp4");
+  tftops_p4_flat.Init(skim, "tftops_p4");
+  jup_topcands_p4_flat.Init(skim, "jup_topcands_p4");
+  jup_topcands_Wp4_flat.Init(skim, "jup_topcands_Wp4");
+  jup_tftops_p4_flat.Init(skim, "jup_tftops_p4");
+  jdown_topcands_p4_flat.Init(skim, "jdown_topcands_p4");
+  jdown_topcands_Wp4_flat.Init(skim, "jdown_topcands_Wp4");
+  jdown_tftops_p4_flat.Init(skim, "jdown_tftops_p4");
+  tau_p4_flat.Init(skim, "tau_p4");
+  isoTracks_p4_flat.Init(skim, "isoTracks_p4");
+  run_flat.Init(skim, "run");
+  ls_flat.Init(skim, "ls");
+  evt_flat.Init(skim, "evt");
+  nvtxs_flat.Init(skim, "nvtxs");
+  year_flat.Init(skim, "year");
+  sampver_flat.Init(skim, "sampver");
+  pu_nvtxs_flat.Init(skim, "pu_nvtxs");
+  pfmet_flat.Init(skim, "pfmet");
+  pfmet_phi_flat.Init(skim, "pfmet_phi");
+  pfmet_jup_flat.Init(skim, "pfmet_jup");
+  pfmet_phi_jup_flat.Init(skim, "pfmet_phi_jup");
+  pfmet_jdown_flat.Init(skim, "pfmet_jdown");
+  pfmet_phi_jdown_flat.Init(skim, "pfmet_phi_jdown");
+  pfmet_rl_flat.Init(skim, "pfmet_rl");
+  pfmet_phi_rl_flat.Init(skim, "pfmet_phi_rl");
+  pfmet_rl_jup_flat.Init(skim, "pfmet_rl_jup");
+  pfmet_phi_rl_jup_flat.Init(skim, "pfmet_phi_rl_jup");
+  pfmet_rl_jdown_flat.Init(skim, "pfmet_rl_jdown");
+  pfmet_phi_rl_jdown_flat.Init(skim, "pfmet_phi_rl_jdown");
+  pfmet_egclean_flat.Init(skim, "pfmet_egclean");
+  pfmet_egclean_phi_flat.Init(skim, "pfmet_egclean_phi");
+  pfmet_muegclean_flat.Init(skim, "pfmet_muegclean");
+  pfmet_muegclean_phi_flat.Init(skim, "pfmet_muegclean_phi");
+  pfmet_muegcleanfix_flat.Init(skim, "pfmet_muegcleanfix");
+  pfmet_muegcleanfix_phi_flat.Init(skim, "pfmet_muegcleanfix_phi");
+  pfmet_uncorr_flat.Init(skim, "pfmet_uncorr");
+  pfmet_uncorr_phi_flat.Init(skim, "pfmet_uncorr_phi");
+  pfmet_original_flat.Init(skim, "pfmet_original");
+  pfmet_original_phi_flat.Init(skim, "pfmet_original_phi");
+  scale1fb_flat.Init(skim, "scale1fb");
+  xsec_flat.Init(skim, "xsec");
+  xsec_uncert_flat.Init(skim, "xsec_uncert");
+  kfactor_flat.Init(skim, "kfactor");
+  pu_ntrue_flat.Init(skim, "pu_ntrue");
+  ngoodleps_flat.Init(skim, "ngoodleps");
+  nlooseleps_flat.Init(skim, "nlooseleps");
+  nvetoleps_flat.Init(skim, "nvetoleps");
+  is_data_flat.Init(skim, "is_data");
+  nEvents_flat.Init(skim, "nEvents");
+  nEvents_goodvtx_flat.Init(skim, "nEvents_goodvtx");
+  nEvents_MET30_flat.Init(skim, "nEvents_MET30");
+  nEvents_1goodlep_flat.Init(skim, "nEvents_1goodlep");
+  nEvents_2goodjets_flat.Init(skim, "nEvents_2goodjets");
+  is0lep_flat.Init(skim, "is0lep");
+  is1lep_flat.Init(skim, "is1lep");
+  is2lep_flat.Init(skim, "is2lep");
+  isZtoNuNu_flat.Init(skim, "isZtoNuNu");
+  is1lepFromW_flat.Init(skim, "is1lepFromW");
+  is1lepFromTop_flat.Init(skim, "is1lepFromTop");
+  MT2W_flat.Init(skim, "MT2W");
+  MT2W_rl_flat.Init(skim, "MT2W_rl");
+  MT2_ll_flat.Init(skim, "MT2_ll");
+  mindphi_met_j1_j2_flat.Init(skim, "mindphi_met_j1_j2");
+  mindphi_met_j1_j2_rl_flat.Init(skim, "mindphi_met_j1_j2_rl");
+  mt_met_lep_flat.Init(skim, "mt_met_lep");
+  mt_met_lep_rl_flat.Init(skim, "mt_met_lep_rl");
+  MT2W_jup_flat.Init(skim, "MT2W_jup");
+  MT2W_rl_jup_flat.Init(skim, "MT2W_rl_jup");
+  MT2_ll_jup_flat.Init(skim, "MT2_ll_jup");
+  mindphi_met_j1_j2_jup_flat.Init(skim, "mindphi_met_j1_j2_jup");
+  mindphi_met_j1_j2_rl_jup_flat.Init(skim, "mindphi_met_j1_j2_rl_jup");
+  mt_met_lep_jup_flat.Init(skim, "mt_met_lep_jup");
+  mt_met_lep_rl_jup_flat.Init(skim, "mt_met_lep_rl_jup");
+  MT2W_jdown_flat.Init(skim, "MT2W_jdown");
+  MT2W_rl_jdown_flat.Init(skim, "MT2W_rl_jdown");
+  MT2_ll_jdown_flat.Init(skim, "MT2_ll_jdown");
+  mindphi_met_j1_j2_jdown_flat.Init(skim, "mindphi_met_j1_j2_jdown");
+  mindphi_met_j1_j2_rl_jdown_flat.Init(skim, "mindphi_met_j1_j2_rl_jdown");
+  mt_met_lep_jdown_flat.Init(skim, "mt_met_lep_jdown");
+  mt_met_lep_rl_jdown_flat.Init(skim, "mt_met_lep_rl_jdown");
+  hadronic_top_chi2_flat.Init(skim, "hadronic_top_chi2");
+  ak4pfjets_rho_flat.Init(skim, "ak4pfjets_rho");
+  pdf_up_weight_flat.Init(skim, "pdf_up_weight");
+  pdf_down_weight_flat.Init(skim, "pdf_down_weight");
+  ngenweights_flat.Init(skim, "ngenweights");
+  genweights_flat.Init(skim, "genweights");
+  weight_Q2_up_flat.Init(skim, "weight_Q2_up");
+  weight_Q2_down_flat.Init(skim, "weight_Q2_down");
+  weight_alphas_up_flat.Init(skim, "weight_alphas_up");
+  weight_alphas_down_flat.Init(skim, "weight_alphas_down");
+  weight_btagsf_flat.Init(skim, "weight_btagsf");
+  weight_btagsf_heavy_UP_flat.Init(skim, "weight_btagsf_heavy_UP");
+  weight_btagsf_light_UP_flat.Init(skim, "weight_btagsf_light_UP");
+  weight_btagsf_heavy_DN_flat.Init(skim, "weight_btagsf_heavy_DN");
+  weight_btagsf_light_DN_flat.Init(skim, "weight_btagsf_light_DN");
+  weight_btagsf_fastsim_UP_flat.Init(skim, "weight_btagsf_fastsim_UP");
+  weight_btagsf_fastsim_DN_flat.Init(skim, "weight_btagsf_fastsim_DN");
+  weight_analysisbtagsf_flat.Init(skim, "weight_analysisbtagsf");
+  weight_analysisbtagsf_heavy_UP_flat.Init(skim, "weight_analysisbtagsf_heavy_UP");
+  weight_analysisbtagsf_light_UP_flat.Init(skim, "weight_analysisbtagsf_light_UP");
+  weight_analysisbtagsf_heavy_DN_flat.Init(skim, "weight_analysisbtagsf_heavy_DN");
+  weight_analysisbtagsf_light_DN_flat.Init(skim, "weight_analysisbtagsf_light_DN");
+  weight_analysisbtagsf_fastsim_UP_flat.Init(skim, "weight_analysisbtagsf_fastsim_UP");
+  weight_analysisbtagsf_fastsim_DN_flat.Init(skim, "weight_analysisbtagsf_fastsim_DN");
+  weight_tightbtagsf_flat.Init(skim, "weight_tightbtagsf");
+  weight_tightbtagsf_heavy_UP_flat.Init(skim, "weight_tightbtagsf_heavy_UP");
+  weight_tightbtagsf_light_UP_flat.Init(skim, "weight_tightbtagsf_light_UP");
+  weight_tightbtagsf_heavy_DN_flat.Init(skim, "weight_tightbtagsf_heavy_DN");
+  weight_tightbtagsf_light_DN_flat.Init(skim, "weight_tightbtagsf_light_DN");
+  weight_tightbtagsf_fastsim_UP_flat.Init(skim, "weight_tightbtagsf_fastsim_UP");
+  weight_tightbtagsf_fastsim_DN_flat.Init(skim, "weight_tightbtagsf_fastsim_DN");
+  weight_loosebtagsf_flat.Init(skim, "weight_loosebtagsf");
+  weight_loosebtagsf_heavy_UP_flat.Init(skim, "weight_loosebtagsf_heavy_UP");
+  weight_loosebtagsf_light_UP_flat.Init(skim, "weight_loosebtagsf_light_UP");
+  weight_loosebtagsf_heavy_DN_flat.Init(skim, "weight_loosebtagsf_heavy_DN");
+  weight_loosebtagsf_light_DN_flat.Init(skim, "weight_loosebtagsf_light_DN");
+  weight_loosebtagsf_fastsim_UP_flat.Init(skim, "weight_loosebtagsf_fastsim_UP");
+  weight_loosebtagsf_fastsim_DN_flat.Init(skim, "weight_loosebtagsf_fastsim_DN");
+  weight_lepSF_flat.Init(skim, "weight_lepSF");
+  weight_lepSF_up_flat.Init(skim, "weight_lepSF_up");
+  weight_lepSF_down_flat.Init(skim, "weight_lepSF_down");
+  weight_vetoLepSF_flat.Init(skim, "weight_vetoLepSF");
+  weight_vetoLepSF_up_flat.Init(skim, "weight_vetoLepSF_up");
+  weight_vetoLepSF_down_flat.Init(skim, "weight_vetoLepSF_down");
+  weight_lepSF_fastSim_flat.Init(skim, "weight_lepSF_fastSim");
+  weight_lepSF_fastSim_up_flat.Init(skim, "weight_lepSF_fastSim_up");
+  weight_lepSF_fastSim_down_flat.Init(skim, "weight_lepSF_fastSim_down");
+  weight_ISR_flat.Init(skim, "weight_ISR");
+  weight_ISRup_flat.Init(skim, "weight_ISRup");
+  weight_ISRdown_flat.Init(skim, "weight_ISRdown");
+  weight_PU_flat.Init(skim, "weight_PU");
+  weight_PUup_flat.Init(skim, "weight_PUup");
+  weight_PUdown_flat.Init(skim, "weight_PUdown");
+  weight_ISRnjets_flat.Init(skim, "weight_ISRnjets");
+  weight_ISRnjets_UP_flat.Init(skim, "weight_ISRnjets_UP");
+  weight_ISRnjets_DN_flat.Init(skim, "weight_ISRnjets_DN");
+  weight_L1prefire_flat.Init(skim, "weight_L1prefire");
+  weight_L1prefire_UP_flat.Init(skim, "weight_L1prefire_UP");
+  weight_L1prefire_DN_flat.Init(skim, "weight_L1prefire_DN");
+  NISRjets_flat.Init(skim, "NISRjets");
+  NnonISRjets_flat.Init(skim, "NnonISRjets");
+  sparms_values_flat.Init(skim, "sparms_values");
+  sparms_subProcessId_flat.Init(skim, "sparms_subProcessId");
+  mass_lsp_flat.Init(skim, "mass_lsp");
+  mass_chargino_flat.Init(skim, "mass_chargino");
+  mass_stop_flat.Init(skim, "mass_stop");
+  mass_gluino_flat.Init(skim, "mass_gluino");
+  genmet_flat.Init(skim, "genmet");
+  genmet_phi_flat.Init(skim, "genmet_phi");
+  nupt_flat.Init(skim, "nupt");
+  genht_flat.Init(skim, "genht");
+  PassTrackVeto_flat.Init(skim, "PassTrackVeto");
+  PassTauVeto_flat.Init(skim, "PassTauVeto");
+  topness_flat.Init(skim, "topness");
+  topnessMod_flat.Init(skim, "topnessMod");
+  topnessMod_rl_flat.Init(skim, "topnessMod_rl");
+  topnessMod_jup_flat.Init(skim, "topnessMod_jup");
+  topnessMod_rl_jup_flat.Init(skim, "topnessMod_rl_jup");
+  topnessMod_jdown_flat.Init(skim, "topnessMod_jdown");
+  topnessMod_rl_jdown_flat.Init(skim, "topnessMod_rl_jdown");
+  Mlb_closestb_flat.Init(skim, "Mlb_closestb");
+  Mlb_lead_bdiscr_flat.Init(skim, "Mlb_lead_bdiscr");
+  Mlb_closestb_jup_flat.Init(skim, "Mlb_closestb_jup");
+  Mlb_lead_bdiscr_jup_flat.Init(skim, "Mlb_lead_bdiscr_jup");
+  Mlb_closestb_jdown_flat.Init(skim, "Mlb_closestb_jdown");
+  Mlb_lead_bdiscr_jdown_flat.Init(skim, "Mlb_lead_bdiscr_jdown");
+  HLT_SingleEl_flat.Init(skim, "HLT_SingleEl");
+  HLT_SingleMu_flat.Init(skim, "HLT_SingleMu");
+  HLT_MET_flat.Init(skim, "HLT_MET");
+  HLT_MET_MHT_flat.Init(skim, "HLT_MET_MHT");
+  HLT_MET100_MHT100_flat.Init(skim, "HLT_MET100_MHT100");
+  HLT_MET110_MHT110_flat.Init(skim, "HLT_MET110_MHT110");
+  HLT_MET120_MHT120_flat.Init(skim, "HLT_MET120_MHT120");
+  HLT_MET130_MHT130_flat.Init(skim, "HLT_MET130_MHT130");
+  HLT_PFHT_unprescaled_flat.Init(skim, "HLT_PFHT_unprescaled");
+  HLT_PFHT_prescaled_flat.Init(skim, "HLT_PFHT_prescaled");
+  HLT_AK8Jet_unprescaled_flat.Init(skim, "HLT_AK8Jet_unprescaled");
+  HLT_AK8Jet_prescaled_flat.Init(skim, "HLT_AK8Jet_prescaled");
+  HLT_CaloJet500_NoJetID_flat.Init(skim, "HLT_CaloJet500_NoJetID");
+  HLT_DiEl_flat.Init(skim, "HLT_DiEl");
+  HLT_DiMu_flat.Init(skim, "HLT_DiMu");
+  HLT_MuE_flat.Init(skim, "HLT_MuE");
+  nPhotons_flat.Init(skim, "nPhotons");
+  ph_ngoodjets_flat.Init(skim, "ph_ngoodjets");
+  ph_ngoodbtags_flat.Init(skim, "ph_ngoodbtags");
+  hardgenpt_flat.Init(skim, "hardgenpt");
+  calomet_flat.Init(skim, "calomet");
+  calomet_phi_flat.Init(skim, "calomet_phi");
+  lep1_pdgid_flat.Init(skim, "lep1_pdgid");
+  lep1_production_type_flat.Init(skim, "lep1_production_type");
+  lep1_MiniIso_flat.Init(skim, "lep1_MiniIso");
+  lep1_relIso_flat.Init(skim, "lep1_relIso");
+  lep1_passLooseID_flat.Init(skim, "lep1_passLooseID");
+  lep1_passMediumID_flat.Init(skim, "lep1_passMediumID");
+  lep1_passTightID_flat.Init(skim, "lep1_passTightID");
+  lep1_passVeto_flat.Init(skim, "lep1_passVeto");
+  lep1_mc_motherid_flat.Init(skim, "lep1_mc_motherid");
+  lep1_etaSC_flat.Init(skim, "lep1_etaSC");
+  lep1_dphiMET_flat.Init(skim, "lep1_dphiMET");
+  lep1_dphiMET_jup_flat.Init(skim, "lep1_dphiMET_jup");
+  lep1_dphiMET_jdown_flat.Init(skim, "lep1_dphiMET_jdown");
+  lep1_dphiMET_rl_flat.Init(skim, "lep1_dphiMET_rl");
+  lep1_dphiMET_rl_jup_flat.Init(skim, "lep1_dphiMET_rl_jup");
+  lep1_dphiMET_rl_jdown_flat.Init(skim, "lep1_dphiMET_rl_jdown");
+  lep2_pdgid_flat.Init(skim, "lep2_pdgid");
+  lep2_production_type_flat.Init(skim, "lep2_production_type");
+  lep2_MiniIso_flat.Init(skim, "lep2_MiniIso");
+  lep2_relIso_flat.Init(skim, "lep2_relIso");
+  lep2_passLooseID_flat.Init(skim, "lep2_passLooseID");
+  lep2_passMediumID_flat.Init(skim, "lep2_passMediumID");
+  lep2_passTightID_flat.Init(skim, "lep2_passTightID");
+  lep2_passVeto_flat.Init(skim, "lep2_passVeto");
+  lep2_mc_motherid_flat.Init(skim, "lep2_mc_motherid");
+  lep2_etaSC_flat.Init(skim, "lep2_etaSC");
+  lep2_dphiMET_flat.Init(skim, "lep2_dphiMET");
+  lep2_dphiMET_jup_flat.Init(skim, "lep2_dphiMET_jup");
+  lep2_dphiMET_jdown_flat.Init(skim, "lep2_dphiMET_jdown");
+  lep2_dphiMET_rl_flat.Init(skim, "lep2_dphiMET_rl");
+  lep2_dphiMET_rl_jup_flat.Init(skim, "lep2_dphiMET_rl_jup");
+  lep2_dphiMET_rl_jdown_flat.Init(skim, "lep2_dphiMET_rl_jdown");
+  ph_sigmaIEtaEta_fill5x5_flat.Init(skim, "ph_sigmaIEtaEta_fill5x5");
+  ph_hOverE_flat.Init(skim, "ph_hOverE");
+  ph_r9_flat.Init(skim, "ph_r9");
+  ph_chiso_flat.Init(skim, "ph_chiso");
+  ph_nhiso_flat.Init(skim, "ph_nhiso");
+  ph_phiso_flat.Init(skim, "ph_phiso");
+  ph_passLooseID_flat.Init(skim, "ph_passLooseID");
+  ph_passMediumID_flat.Init(skim, "ph_passMediumID");
+  ph_passTightID_flat.Init(skim, "ph_passTightID");
+  ph_overlapJetId_flat.Init(skim, "ph_overlapJetId");
+  ph_mcMatchId_flat.Init(skim, "ph_mcMatchId");
+  ph_genIso04_flat.Init(skim, "ph_genIso04");
+  ph_drMinParton_flat.Init(skim, "ph_drMinParton");
+  nskimjets_flat.Init(skim, "nskimjets");
+  nskimbtagmed_flat.Init(skim, "nskimbtagmed");
+  nskimbtagloose_flat.Init(skim, "nskimbtagloose");
+  nskimbtagtight_flat.Init(skim, "nskimbtagtight");
+  ngoodjets_flat.Init(skim, "ngoodjets");
+  ngoodbtags_flat.Init(skim, "ngoodbtags");
+  nloosebtags_flat.Init(skim, "nloosebtags");
+  ntightbtags_flat.Init(skim, "ntightbtags");
+  nanalysisbtags_flat.Init(skim, "nanalysisbtags");
+  ak4_HT_flat.Init(skim, "ak4_HT");
+  ak4_htratiom_flat.Init(skim, "ak4_htratiom");
+  dphi_ak4pfjet_met_flat.Init(skim, "dphi_ak4pfjet_met");
+  ak4pfjets_passMEDbtag_flat.Init(skim, "ak4pfjets_passMEDbtag");
+  ak4pfjets_deepCSV_flat.Init(skim, "ak4pfjets_deepCSV");
+  ak4pfjets_CSV_flat.Init(skim, "ak4pfjets_CSV");
+  ak4pfjets_mva_flat.Init(skim, "ak4pfjets_mva");
+  ak4pfjets_parton_flavor_flat.Init(skim, "ak4pfjets_parton_flavor");
+  ak4pfjets_hadron_flavor_flat.Init(skim, "ak4pfjets_hadron_flavor");
+  ak4pfjets_loose_puid_flat.Init(skim, "ak4pfjets_loose_puid");
+  ak4pfjets_loose_pfid_flat.Init(skim, "ak4pfjets_loose_pfid");
+  nsoftbtags_flat.Init(skim, "nsoftbtags");
+  jup_nskimjets_flat.Init(skim, "jup_nskimjets");
+  jup_nskimbtagmed_flat.Init(skim, "jup_nskimbtagmed");
+  jup_nskimbtagloose_flat.Init(skim, "jup_nskimbtagloose");
+  jup_nskimbtagtight_flat.Init(skim, "jup_nskimbtagtight");
+  jup_ngoodjets_flat.Init(skim, "jup_ngoodjets");
+  jup_ngoodbtags_flat.Init(skim, "jup_ngoodbtags");
+  jup_nloosebtags_flat.Init(skim, "jup_nloosebtags");
+  jup_ntightbtags_flat.Init(skim, "jup_ntightbtags");
+  jup_nanalysisbtags_flat.Init(skim, "jup_nanalysisbtags");
+  jup_ak4_HT_flat.Init(skim, "jup_ak4_HT");
+  jup_ak4_htratiom_flat.Init(skim, "jup_ak4_htratiom");
+  jup_dphi_ak4pfjet_met_flat.Init(skim, "jup_dphi_ak4pfjet_met");
+  jup_ak4pfjets_passMEDbtag_flat.Init(skim, "jup_ak4pfjets_passMEDbtag");
+  jup_ak4pfjets_deepCSV_flat.Init(skim, "jup_ak4pfjets_deepCSV");
+  jup_ak4pfjets_CSV_flat.Init(skim, "jup_ak4pfjets_CSV");
+  jup_ak4pfjets_mva_flat.Init(skim, "jup_ak4pfjets_mva");
+  jup_ak4pfjets_parton_flavor_flat.Init(skim, "jup_ak4pfjets_parton_flavor");
+  jup_ak4pfjets_hadron_flavor_flat.Init(skim, "jup_ak4pfjets_hadron_flavor");
+  jup_ak4pfjets_loose_puid_flat.Init(skim, "jup_ak4pfjets_loose_puid");
+  jup_ak4pfjets_loose_pfid_flat.Init(skim, "jup_ak4pfjets_loose_pfid");
+  jup_nsoftbtags_flat.Init(skim, "jup_nsoftbtags");
+  jdown_nskimjets_flat.Init(skim, "jdown_nskimjets");
+  jdown_nskimbtagmed_flat.Init(skim, "jdown_nskimbtagmed");
+  jdown_nskimbtagloose_flat.Init(skim, "jdown_nskimbtagloose");
+  jdown_nskimbtagtight_flat.Init(skim, "jdown_nskimbtagtight");
+  jdown_ngoodjets_flat.Init(skim, "jdown_ngoodjets");
+  jdown_ngoodbtags_flat.Init(skim, "jdown_ngoodbtags");
+  jdown_nloosebtags_flat.Init(skim, "jdown_nloosebtags");
+  jdown_ntightbtags_flat.Init(skim, "jdown_ntightbtags");
+  jdown_nanalysisbtags_flat.Init(skim, "jdown_nanalysisbtags");
+  jdown_ak4_HT_flat.Init(skim, "jdown_ak4_HT");
+  jdown_ak4_htratiom_flat.Init(skim, "jdown_ak4_htratiom");
+  jdown_dphi_ak4pfjet_met_flat.Init(skim, "jdown_dphi_ak4pfjet_met");
+  jdown_ak4pfjets_passMEDbtag_flat.Init(skim, "jdown_ak4pfjets_passMEDbtag");
+  jdown_ak4pfjets_deepCSV_flat.Init(skim, "jdown_ak4pfjets_deepCSV");
+  jdown_ak4pfjets_CSV_flat.Init(skim, "jdown_ak4pfjets_CSV");
+  jdown_ak4pfjets_mva_flat.Init(skim, "jdown_ak4pfjets_mva");
+  jdown_ak4pfjets_parton_flavor_flat.Init(skim, "jdown_ak4pfjets_parton_flavor");
+  jdown_ak4pfjets_hadron_flavor_flat.Init(skim, "jdown_ak4pfjets_hadron_flavor");
+  jdown_ak4pfjets_loose_puid_flat.Init(skim, "jdown_ak4pfjets_loose_puid");
+  jdown_ak4pfjets_loose_pfid_flat.Init(skim, "jdown_ak4pfjets_loose_pfid");
+  jdown_nsoftbtags_flat.Init(skim, "jdown_nsoftbtags");
+  genleps_isfromt_flat.Init(skim, "genleps_isfromt");
+  genleps_id_flat.Init(skim, "genleps_id");
+  genleps__genpsidx_flat.Init(skim, "genleps__genpsidx");
+  genleps_status_flat.Init(skim, "genleps_status");
+  genleps_fromHardProcessDecayed_flat.Init(skim, "genleps_fromHardProcessDecayed");
+  genleps_fromHardProcessFinalState_flat.Init(skim, "genleps_fromHardProcessFinalState");
+  genleps_isHardProcess_flat.Init(skim, "genleps_isHardProcess");
+  genleps_isLastCopy_flat.Init(skim, "genleps_isLastCopy");
+  genleps_gentaudecay_flat.Init(skim, "genleps_gentaudecay");
+  gen_nfromtleps__flat.Init(skim, "gen_nfromtleps_");
+  genleps_motherid_flat.Init(skim, "genleps_motherid");
+  genleps_motheridx_flat.Init(skim, "genleps_motheridx");
+  genleps_motherstatus_flat.Init(skim, "genleps_motherstatus");
+  genleps_gmotherid_flat.Init(skim, "genleps_gmotherid");
+  genleps_gmotheridx_flat.Init(skim, "genleps_gmotheridx");
+  genleps_gmotherstatus_flat.Init(skim, "genleps_gmotherstatus");
+  gennus_isfromt_flat.Init(skim, "gennus_isfromt");
+  gennus_id_flat.Init(skim, "gennus_id");
+  gennus__genpsidx_flat.Init(skim, "gennus__genpsidx");
+  gennus_status_flat.Init(skim, "gennus_status");
+  gennus_fromHardProcessDecayed_flat.Init(skim, "gennus_fromHardProcessDecayed");
+  gennus_fromHardProcessFinalState_flat.Init(skim, "gennus_fromHardProcessFinalState");
+  gennus_isHardProcess_flat.Init(skim, "gennus_isHardProcess");
+  gennus_isLastCopy_flat.Init(skim, "gennus_isLastCopy");
+  gennus_gentaudecay_flat.Init(skim, "gennus_gentaudecay");
+  gen_nfromtnus__flat.Init(skim, "gen_nfromtnus_");
+  gennus_motherid_flat.Init(skim, "gennus_motherid");
+  gennus_motheridx_flat.Init(skim, "gennus_motheridx");
+  gennus_motherstatus_flat.Init(skim, "gennus_motherstatus");
+  gennus_gmotherid_flat.Init(skim, "gennus_gmotherid");
+  gennus_gmotheridx_flat.Init(skim, "gennus_gmotheridx");
+  gennus_gmotherstatus_flat.Init(skim, "gennus_gmotherstatus");
+  genqs_isfromt_flat.Init(skim, "genqs_isfromt");
+  genqs_id_flat.Init(skim, "genqs_id");
+  genqs__genpsidx_flat.Init(skim, "genqs__genpsidx");
+  genqs_status_flat.Init(skim, "genqs_status");
+  genqs_fromHardProcessDecayed_flat.Init(skim, "genqs_fromHardProcessDecayed");
+  genqs_fromHardProcessFinalState_flat.Init(skim, "genqs_fromHardProcessFinalState");
+  genqs_isHardProcess_flat.Init(skim, "genqs_isHardProcess");
+  genqs_isLastCopy_flat.Init(skim, "genqs_isLastCopy");
+  genqs_gentaudecay_flat.Init(skim, "genqs_gentaudecay");
+  gen_nfromtqs__flat.Init(skim, "gen_nfromtqs_");
+  genqs_motherid_flat.Init(skim, "genqs_motherid");
+  genqs_motheridx_flat.Init(skim, "genqs_motheridx");
+  genqs_motherstatus_flat.Init(skim, "genqs_motherstatus");
+  genqs_gmotherid_flat.Init(skim, "genqs_gmotherid");
+  genqs_gmotheridx_flat.Init(skim, "genqs_gmotheridx");
+  genqs_gmotherstatus_flat.Init(skim, "genqs_gmotherstatus");
+  genbosons_isfromt_flat.Init(skim, "genbosons_isfromt");
+  genbosons_id_flat.Init(skim, "genbosons_id");
+  genbosons__genpsidx_flat.Init(skim, "genbosons__genpsidx");
+  genbosons_status_flat.Init(skim, "genbosons_status");
+  genbosons_fromHardProcessDecayed_flat.Init(skim, "genbosons_fromHardProcessDecayed");
+  genbosons_fromHardProcessFinalState_flat.Init(skim, "genbosons_fromHardProcessFinalState");
+  genbosons_isHardProcess_flat.Init(skim, "genbosons_isHardProcess");
+  genbosons_isLastCopy_flat.Init(skim, "genbosons_isLastCopy");
+  genbosons_gentaudecay_flat.Init(skim, "genbosons_gentaudecay");
+  gen_nfromtbosons__flat.Init(skim, "gen_nfromtbosons_");
+  genbosons_motherid_flat.Init(skim, "genbosons_motherid");
+  genbosons_motheridx_flat.Init(skim, "genbosons_motheridx");
+  genbosons_motherstatus_flat.Init(skim, "genbosons_motherstatus");
+  genbosons_gmotherid_flat.Init(skim, "genbosons_gmotherid");
+  genbosons_gmotheridx_flat.Init(skim, "genbosons_gmotheridx");
+  genbosons_gmotherstatus_flat.Init(skim, "genbosons_gmotherstatus");
+  gensusy_isfromt_flat.Init(skim, "gensusy_isfromt");
+  gensusy_id_flat.Init(skim, "gensusy_id");
+  gensusy__genpsidx_flat.Init(skim, "gensusy__genpsidx");
+  gensusy_status_flat.Init(skim, "gensusy_status");
+  gensusy_fromHardProcessDecayed_flat.Init(skim, "gensusy_fromHardProcessDecayed");
+  gensusy_fromHardProcessFinalState_flat.Init(skim, "gensusy_fromHardProcessFinalState");
+  gensusy_isHardProcess_flat.Init(skim, "gensusy_isHardProcess");
+  gensusy_isLastCopy_flat.Init(skim, "gensusy_isLastCopy");
+  gensusy_gentaudecay_flat.Init(skim, "gensusy_gentaudecay");
+  gen_nfromtsusy__flat.Init(skim, "gen_nfromtsusy_");
+  gensusy_motherid_flat.Init(skim, "gensusy_motherid");
+  gensusy_motheridx_flat.Init(skim, "gensusy_motheridx");
+  gensusy_motherstatus_flat.Init(skim, "gensusy_motherstatus");
+  gensusy_gmotherid_flat.Init(skim, "gensusy_gmotherid");
+  gensusy_gmotheridx_flat.Init(skim, "gensusy_gmotheridx");
+  gensusy_gmotherstatus_flat.Init(skim, "gensusy_gmotherstatus");
+  ak8pfjets_tau1_flat.Init(skim, "ak8pfjets_tau1");
+  ak8pfjets_tau2_flat.Init(skim, "ak8pfjets_tau2");
+  ak8pfjets_tau3_flat.Init(skim, "ak8pfjets_tau3");
+  ak8pfjets_parton_flavor_flat.Init(skim, "ak8pfjets_parton_flavor");
+  nGoodAK8PFJets_flat.Init(skim, "nGoodAK8PFJets");
+  ak8pfjets_deepdisc_qcd_flat.Init(skim, "ak8pfjets_deepdisc_qcd");
+  ak8pfjets_deepdisc_top_flat.Init(skim, "ak8pfjets_deepdisc_top");
+  ak8pfjets_deepdisc_w_flat.Init(skim, "ak8pfjets_deepdisc_w");
+  ak8pfjets_deepdisc_z_flat.Init(skim, "ak8pfjets_deepdisc_z");
+  ak8pfjets_deepdisc_zbb_flat.Init(skim, "ak8pfjets_deepdisc_zbb");
+  ak8pfjets_deepdisc_hbb_flat.Init(skim, "ak8pfjets_deepdisc_hbb");
+  ak8pfjets_deepdisc_h4q_flat.Init(skim, "ak8pfjets_deepdisc_h4q");
+  lead_ak8deepdisc_top_flat.Init(skim, "lead_ak8deepdisc_top");
+  jup_ak8pfjets_tau1_flat.Init(skim, "jup_ak8pfjets_tau1");
+  jup_ak8pfjets_tau2_flat.Init(skim, "jup_ak8pfjets_tau2");
+  jup_ak8pfjets_tau3_flat.Init(skim, "jup_ak8pfjets_tau3");
+  jup_ak8pfjets_parton_flavor_flat.Init(skim, "jup_ak8pfjets_parton_flavor");
+  jup_nGoodAK8PFJets_flat.Init(skim, "jup_nGoodAK8PFJets");
+  jup_ak8pfjets_deepdisc_qcd_flat.Init(skim, "jup_ak8pfjets_deepdisc_qcd");
+  jup_ak8pfjets_deepdisc_top_flat.Init(skim, "jup_ak8pfjets_deepdisc_top");
+  jup_ak8pfjets_deepdisc_w_flat.Init(skim, "jup_ak8pfjets_deepdisc_w");
+  jup_ak8pfjets_deepdisc_z_flat.Init(skim, "jup_ak8pfjets_deepdisc_z");
+  jup_ak8pfjets_deepdisc_zbb_flat.Init(skim, "jup_ak8pfjets_deepdisc_zbb");
+  jup_ak8pfjets_deepdisc_hbb_flat.Init(skim, "jup_ak8pfjets_deepdisc_hbb");
+  jup_ak8pfjets_deepdisc_h4q_flat.Init(skim, "jup_ak8pfjets_deepdisc_h4q");
+  jup_lead_ak8deepdisc_top_flat.Init(skim, "jup_lead_ak8deepdisc_top");
+  jdown_ak8pfjets_tau1_flat.Init(skim, "jdown_ak8pfjets_tau1");
+  jdown_ak8pfjets_tau2_flat.Init(skim, "jdown_ak8pfjets_tau2");
+  jdown_ak8pfjets_tau3_flat.Init(skim, "jdown_ak8pfjets_tau3");
+  jdown_ak8pfjets_parton_flavor_flat.Init(skim, "jdown_ak8pfjets_parton_flavor");
+  jdown_nGoodAK8PFJets_flat.Init(skim, "jdown_nGoodAK8PFJets");
+  jdown_ak8pfjets_deepdisc_qcd_flat.Init(skim, "jdown_ak8pfjets_deepdisc_qcd");
+  jdown_ak8pfjets_deepdisc_top_flat.Init(skim, "jdown_ak8pfjets_deepdisc_top");
+  jdown_ak8pfjets_deepdisc_w_flat.Init(skim, "jdown_ak8pfjets_deepdisc_w");
+  jdown_ak8pfjets_deepdisc_z_flat.Init(skim, "jdown_ak8pfjets_deepdisc_z");
+  jdown_ak8pfjets_deepdisc_zbb_flat.Init(skim, "jdown_ak8pfjets_deepdisc_zbb");
+  jdown_ak8pfjets_deepdisc_hbb_flat.Init(skim, "jdown_ak8pfjets_deepdisc_hbb");
+  jdown_ak8pfjets_deepdisc_h4q_flat.Init(skim, "jdown_ak8pfjets_deepdisc_h4q");
+  jdown_lead_ak8deepdisc_top_flat.Init(skim, "jdown_lead_ak8deepdisc_top");
+  ak4pfjets_cvsl_flat.Init(skim, "ak4pfjets_cvsl");
+  ak4pfjets_ptD_flat.Init(skim, "ak4pfjets_ptD");
+  ak4pfjets_axis1_flat.Init(skim, "ak4pfjets_axis1");
+  ak4pfjets_axis2_flat.Init(skim, "ak4pfjets_axis2");
+  ak4pfjets_mult_flat.Init(skim, "ak4pfjets_mult");
+  ak4pfjets_deepCSVb_flat.Init(skim, "ak4pfjets_deepCSVb");
+  ak4pfjets_deepCSVbb_flat.Init(skim, "ak4pfjets_deepCSVbb");
+  ak4pfjets_deepCSVc_flat.Init(skim, "ak4pfjets_deepCSVc");
+  ak4pfjets_deepCSVl_flat.Init(skim, "ak4pfjets_deepCSVl");
+  topcands_disc_flat.Init(skim, "topcands_disc");
+  tftops_disc_flat.Init(skim, "tftops_disc");
+  jup_ak4pfjets_cvsl_flat.Init(skim, "jup_ak4pfjets_cvsl");
+  jup_ak4pfjets_ptD_flat.Init(skim, "jup_ak4pfjets_ptD");
+  jup_ak4pfjets_axis1_flat.Init(skim, "jup_ak4pfjets_axis1");
+  jup_ak4pfjets_axis2_flat.Init(skim, "jup_ak4pfjets_axis2");
+  jup_ak4pfjets_mult_flat.Init(skim, "jup_ak4pfjets_mult");
+  jup_ak4pfjets_deepCSVb_flat.Init(skim, "jup_ak4pfjets_deepCSVb");
+  jup_ak4pfjets_deepCSVbb_flat.Init(skim, "jup_ak4pfjets_deepCSVbb");
+  jup_ak4pfjets_deepCSVc_flat.Init(skim, "jup_ak4pfjets_deepCSVc");
+  jup_ak4pfjets_deepCSVl_flat.Init(skim, "jup_ak4pfjets_deepCSVl");
+  jup_topcands_disc_flat.Init(skim, "jup_topcands_disc");
+  jup_tftops_disc_flat.Init(skim, "jup_tftops_disc");
+  jdown_ak4pfjets_cvsl_flat.Init(skim, "jdown_ak4pfjets_cvsl");
+  jdown_ak4pfjets_ptD_flat.Init(skim, "jdown_ak4pfjets_ptD");
+  jdown_ak4pfjets_axis1_flat.Init(skim, "jdown_ak4pfjets_axis1");
+  jdown_ak4pfjets_axis2_flat.Init(skim, "jdown_ak4pfjets_axis2");
+  jdown_ak4pfjets_mult_flat.Init(skim, "jdown_ak4pfjets_mult");
+  jdown_ak4pfjets_deepCSVb_flat.Init(skim, "jdown_ak4pfjets_deepCSVb");
+  jdown_ak4pfjets_deepCSVbb_flat.Init(skim, "jdown_ak4pfjets_deepCSVbb");
+  jdown_ak4pfjets_deepCSVc_flat.Init(skim, "jdown_ak4pfjets_deepCSVc");
+  jdown_ak4pfjets_deepCSVl_flat.Init(skim, "jdown_ak4pfjets_deepCSVl");
+  jdown_topcands_disc_flat.Init(skim, "jdown_topcands_disc");
+  jdown_tftops_disc_flat.Init(skim, "jdown_tftops_disc");
+  tau_passID_flat.Init(skim, "tau_passID");
+  ngoodtaus_flat.Init(skim, "ngoodtaus");
+  tau_isVetoTau_flat.Init(skim, "tau_isVetoTau");
+  tau_isVetoTau_v2_flat.Init(skim, "tau_isVetoTau_v2");
+  isoTracks_charge_flat.Init(skim, "isoTracks_charge");
+  isoTracks_absIso_flat.Init(skim, "isoTracks_absIso");
+  isoTracks_dz_flat.Init(skim, "isoTracks_dz");
+  isoTracks_pdgId_flat.Init(skim, "isoTracks_pdgId");
+  isoTracks_isVetoTrack_flat.Init(skim, "isoTracks_isVetoTrack");
+  isoTracks_isVetoTrack_v2_flat.Init(skim, "isoTracks_isVetoTrack_v2");
+  isoTracks_isVetoTrack_v3_flat.Init(skim, "isoTracks_isVetoTrack_v3");
+  ph_selectedidx_flat.Init(skim, "ph_selectedidx");
+  ph_met_flat.Init(skim, "ph_met");
+  ph_met_phi_flat.Init(skim, "ph_met_phi");
+  ph_HT_flat.Init(skim, "ph_HT");
+  ph_htssm_flat.Init(skim, "ph_htssm");
+  ph_htosm_flat.Init(skim, "ph_htosm");
+  ph_htratiom_flat.Init(skim, "ph_htratiom");
+  ph_mt_met_lep_flat.Init(skim, "ph_mt_met_lep");
+  ph_dphi_Wlep_flat.Init(skim, "ph_dphi_Wlep");
+  ph_MT2W_flat.Init(skim, "ph_MT2W");
+  ph_topness_flat.Init(skim, "ph_topness");
+  ph_topnessMod_flat.Init(skim, "ph_topnessMod");
+  ph_MT2_ll_flat.Init(skim, "ph_MT2_ll");
+  ph_MT2_lb_b_mass_flat.Init(skim, "ph_MT2_lb_b_mass");
+  ph_MT2_lb_b_flat.Init(skim, "ph_MT2_lb_b");
+  ph_MT2_lb_bqq_mass_flat.Init(skim, "ph_MT2_lb_bqq_mass");
+  ph_MT2_lb_bqq_flat.Init(skim, "ph_MT2_lb_bqq");
+  ph_hadronic_top_chi2_flat.Init(skim, "ph_hadronic_top_chi2");
+  ph_mindphi_met_j1_j2_flat.Init(skim, "ph_mindphi_met_j1_j2");
+  ph_Mlb_lead_bdiscr_flat.Init(skim, "ph_Mlb_lead_bdiscr");
+  ph_dR_lep_leadb_flat.Init(skim, "ph_dR_lep_leadb");
+  ph_Mlb_closestb_flat.Init(skim, "ph_Mlb_closestb");
+  ph_Mjjj_flat.Init(skim, "ph_Mjjj");
+  EA_fixgridfastjet_all_rho_flat.Init(skim, "EA_fixgridfastjet_all_rho");
+  HLT_Photon22_R9Id90_HE10_IsoM_flat.Init(skim, "HLT_Photon22_R9Id90_HE10_IsoM");
+  HLT_Photon30_R9Id90_HE10_IsoM_flat.Init(skim, "HLT_Photon30_R9Id90_HE10_IsoM");
+  HLT_Photon36_R9Id90_HE10_IsoM_flat.Init(skim, "HLT_Photon36_R9Id90_HE10_IsoM");
+  HLT_Photon50_R9Id90_HE10_IsoM_flat.Init(skim, "HLT_Photon50_R9Id90_HE10_IsoM");
+  HLT_Photon75_R9Id90_HE10_IsoM_flat.Init(skim, "HLT_Photon75_R9Id90_HE10_IsoM");
+  HLT_Photon90_R9Id90_HE10_IsoM_flat.Init(skim, "HLT_Photon90_R9Id90_HE10_IsoM");
+  HLT_Photon120_R9Id90_HE10_IsoM_flat.Init(skim, "HLT_Photon120_R9Id90_HE10_IsoM");
+  HLT_Photon165_R9Id90_HE10_IsoM_flat.Init(skim, "HLT_Photon165_R9Id90_HE10_IsoM");
+  HLT_Photon175_flat.Init(skim, "HLT_Photon175");
+  HLT_Photon165_HE10_flat.Init(skim, "HLT_Photon165_HE10");
+  HLT_Photon120_flat.Init(skim, "HLT_Photon120");
+  HLT_Photon200_flat.Init(skim, "HLT_Photon200");
+  HLT_Photon250_NoHE_flat.Init(skim, "HLT_Photon250_NoHE");
+  HLT_Photon300_NoHE_flat.Init(skim, "HLT_Photon300_NoHE");
+  HLT_bits_flat.Init(skim, "HLT_bits");
+  filt_cscbeamhalo_flat.Init(skim, "filt_cscbeamhalo");
+  filt_cscbeamhalo2015_flat.Init(skim, "filt_cscbeamhalo2015");
+  filt_globaltighthalo2016_flat.Init(skim, "filt_globaltighthalo2016");
+  filt_globalsupertighthalo2016_flat.Init(skim, "filt_globalsupertighthalo2016");
+  filt_ecallaser_flat.Init(skim, "filt_ecallaser");
+  filt_ecaltp_flat.Init(skim, "filt_ecaltp");
+  filt_ecalbadcalib_flat.Init(skim, "filt_ecalbadcalib");
+  filt_eebadsc_flat.Init(skim, "filt_eebadsc");
+  filt_goodvtx_flat.Init(skim, "filt_goodvtx");
+  filt_badevents_flat.Init(skim, "filt_badevents");
+  filt_hbhenoise_flat.Init(skim, "filt_hbhenoise");
+  filt_hbheisonoise_flat.Init(skim, "filt_hbheisonoise");
+  filt_hcallaser_flat.Init(skim, "filt_hcallaser");
+  filt_trkfail_flat.Init(skim, "filt_trkfail");
+  filt_trkPOG_flat.Init(skim, "filt_trkPOG");
+  filt_trkPOG_logerr_tmc_flat.Init(skim, "filt_trkPOG_logerr_tmc");
+  filt_trkPOG_tmc_flat.Init(skim, "filt_trkPOG_tmc");
+  filt_trkPOG_tms_flat.Init(skim, "filt_trkPOG_tms");
+  firstGoodVtxIdx_flat.Init(skim, "firstGoodVtxIdx");
+  filt_badChargedCandidateFilter_flat.Init(skim, "filt_badChargedCandidateFilter");
+  filt_badMuonFilter_flat.Init(skim, "filt_badMuonFilter");
+  filt_met_flat.Init(skim, "filt_met");
+  filt_fastsimjets_flat.Init(skim, "filt_fastsimjets");
+  filt_fastsimjets_jup_flat.Init(skim, "filt_fastsimjets_jup");
+  filt_fastsimjets_jdown_flat.Init(skim, "filt_fastsimjets_jdown");
+  filt_jetWithBadMuon_flat.Init(skim, "filt_jetWithBadMuon");
+  filt_jetWithBadMuon_jup_flat.Init(skim, "filt_jetWithBadMuon_jup");
+  filt_jetWithBadMuon_jdown_flat.Init(skim, "filt_jetWithBadMuon_jdown");
+  filt_pfovercalomet_flat.Init(skim, "filt_pfovercalomet");
+  filt_badmuons_flat.Init(skim, "filt_badmuons");
+  filt_duplicatemuons_flat.Init(skim, "filt_duplicatemuons");
+  filt_nobadmuons_flat.Init(skim, "filt_nobadmuons");
 }
 
 void StopTree::LoadAllBranches() {
@@ -2009,8 +3005,8 @@ void StopTree::LoadAllBranches() {
   if (ph_passMediumID_branch != 0) ph_passMediumID();
   if (ph_passTightID_branch != 0) ph_passTightID();
   if (ph_overlapJetId_branch != 0) ph_overlapJetId();
-  if (ph_p4_branch != 0) ph_p4();
-  if (ph_mcp4_branch != 0) ph_mcp4();
+  if (ph_p4_branch != 0 || ph_p4_split.IsActive()) ph_p4();
+  if (ph_mcp4_branch != 0 || ph_mcp4_split.IsActive()) ph_mcp4();
   if (ph_mcMatchId_branch != 0) ph_mcMatchId();
   if (ph_genIso04_branch != 0) ph_genIso04();
   if (ph_drMinParton_branch != 0) ph_drMinParton();
@@ -2026,7 +3022,7 @@ void StopTree::LoadAllBranches() {
   if (ak4_HT_branch != 0) ak4_HT();
   if (ak4_htratiom_branch != 0) ak4_htratiom();
   if (dphi_ak4pfjet_met_branch != 0) dphi_ak4pfjet_met();
-  if (ak4pfjets_p4_branch != 0) ak4pfjets_p4();
+  if (ak4pfjets_p4_branch != 0 || ak4pfjets_p4_split.IsActive()) ak4pfjets_p4();
   if (ak4pfjets_passMEDbtag_branch != 0) ak4pfjets_passMEDbtag();
   if (ak4pfjets_deepCSV_branch != 0) ak4pfjets_deepCSV();
   if (ak4pfjets_CSV_branch != 0) ak4pfjets_CSV();
@@ -2037,8 +3033,8 @@ void StopTree::LoadAllBranches() {
   if (ak4pfjets_loose_pfid_branch != 0) ak4pfjets_loose_pfid();
   if (ak4pfjets_leadMEDbjet_p4_branch != 0) ak4pfjets_leadMEDbjet_p4();
   if (ak4pfjets_leadbtag_p4_branch != 0) ak4pfjets_leadbtag_p4();
-  if (ak4genjets_p4_branch != 0) ak4genjets_p4();
-  if (softtags_p4_branch != 0) softtags_p4();
+  if (ak4genjets_p4_branch != 0 || ak4genjets_p4_split.IsActive()) ak4genjets_p4();
+  if (softtags_p4_branch != 0 || softtags_p4_split.IsActive()) softtags_p4();
   if (nsoftbtags_branch != 0) nsoftbtags();
   if (jup_nskimjets_branch != 0) jup_nskimjets();
   if (jup_nskimbtagmed_branch != 0) jup_nskimbtagmed();
@@ -2052,7 +3048,7 @@ void StopTree::LoadAllBranches() {
   if (jup_ak4_HT_branch != 0) jup_ak4_HT();
   if (jup_ak4_htratiom_branch != 0) jup_ak4_htratiom();
   if (jup_dphi_ak4pfjet_met_branch != 0) jup_dphi_ak4pfjet_met();
-  if (jup_ak4pfjets_p4_branch != 0) jup_ak4pfjets_p4();
+  if (jup_ak4pfjets_p4_branch != 0 || jup_ak4pfjets_p4_split.IsActive()) jup_ak4pfjets_p4();
   if (jup_ak4pfjets_passMEDbtag_branch != 0) jup_ak4pfjets_passMEDbtag();
   if (jup_ak4pfjets_deepCSV_branch != 0) jup_ak4pfjets_deepCSV();
   if (jup_ak4pfjets_CSV_branch != 0) jup_ak4pfjets_CSV();
@@ -2063,8 +3059,8 @@ void StopTree::LoadAllBranches() {
   if (jup_ak4pfjets_loose_pfid_branch != 0) jup_ak4pfjets_loose_pfid();
   if (jup_ak4pfjets_leadMEDbjet_p4_branch != 0) jup_ak4pfjets_leadMEDbjet_p4();
   if (jup_ak4pfjets_leadbtag_p4_branch != 0) jup_ak4pfjets_leadbtag_p4();
-  if (jup_ak4genjets_p4_branch != 0) jup_ak4genjets_p4();
-  if (jup_softtags_p4_branch != 0) jup_softtags_p4();
+  if (jup_ak4genjets_p4_branch != 0 || jup_ak4genjets_p4_split.IsActive()) jup_ak4genjets_p4();
+  if (jup_softtags_p4_branch != 0 || jup_softtags_p4_split.IsActive()) jup_softtags_p4();
   if (jup_nsoftbtags_branch != 0) jup_nsoftbtags();
   if (jdown_nskimjets_branch != 0) jdown_nskimjets();
   if (jdown_nskimbtagmed_branch != 0) jdown_nskimbtagmed();
@@ -2078,7 +3074,7 @@ void StopTree::LoadAllBranches() {
   if (jdown_ak4_HT_branch != 0) jdown_ak4_HT();
   if (jdown_ak4_htratiom_branch != 0) jdown_ak4_htratiom();
   if (jdown_dphi_ak4pfjet_met_branch != 0) jdown_dphi_ak4pfjet_met();
-  if (jdown_ak4pfjets_p4_branch != 0) jdown_ak4pfjets_p4();
+  if (jdown_ak4pfjets_p4_branch != 0 || jdown_ak4pfjets_p4_split.IsActive()) jdown_ak4pfjets_p4();
   if (jdown_ak4pfjets_passMEDbtag_branch != 0) jdown_ak4pfjets_passMEDbtag();
   if (jdown_ak4pfjets_deepCSV_branch != 0) jdown_ak4pfjets_deepCSV();
   if (jdown_ak4pfjets_CSV_branch != 0) jdown_ak4pfjets_CSV();
@@ -2089,11 +3085,11 @@ void StopTree::LoadAllBranches() {
   if (jdown_ak4pfjets_loose_pfid_branch != 0) jdown_ak4pfjets_loose_pfid();
   if (jdown_ak4pfjets_leadMEDbjet_p4_branch != 0) jdown_ak4pfjets_leadMEDbjet_p4();
   if (jdown_ak4pfjets_leadbtag_p4_branch != 0) jdown_ak4pfjets_leadbtag_p4();
-  if (jdown_ak4genjets_p4_branch != 0) jdown_ak4genjets_p4();
-  if (jdown_softtags_p4_branch != 0) jdown_softtags_p4();
+  if (jdown_ak4genjets_p4_branch != 0 || jdown_ak4genjets_p4_split.IsActive()) jdown_ak4genjets_p4();
+  if (jdown_softtags_p4_branch != 0 || jdown_softtags_p4_split.IsActive()) jdown_softtags_p4();
   if (jdown_nsoftbtags_branch != 0) jdown_nsoftbtags();
   if (genleps_isfromt_branch != 0) genleps_isfromt();
-  if (genleps_p4_branch != 0) genleps_p4();
+  if (genleps_p4_branch != 0 || genleps_p4_split.IsActive()) genleps_p4();
   if (genleps_id_branch != 0) genleps_id();
   if (genleps__genpsidx_branch != 0) genleps__genpsidx();
   if (genleps_status_branch != 0) genleps_status();
@@ -2103,16 +3099,16 @@ void StopTree::LoadAllBranches() {
   if (genleps_isLastCopy_branch != 0) genleps_isLastCopy();
   if (genleps_gentaudecay_branch != 0) genleps_gentaudecay();
   if (gen_nfromtleps__branch != 0) gen_nfromtleps_();
-  if (genleps_motherp4_branch != 0) genleps_motherp4();
+  if (genleps_motherp4_branch != 0 || genleps_motherp4_split.IsActive()) genleps_motherp4();
   if (genleps_motherid_branch != 0) genleps_motherid();
   if (genleps_motheridx_branch != 0) genleps_motheridx();
   if (genleps_motherstatus_branch != 0) genleps_motherstatus();
-  if (genleps_gmotherp4_branch != 0) genleps_gmotherp4();
+  if (genleps_gmotherp4_branch != 0 || genleps_gmotherp4_split.IsActive()) genleps_gmotherp4();
   if (genleps_gmotherid_branch != 0) genleps_gmotherid();
   if (genleps_gmotheridx_branch != 0) genleps_gmotheridx();
   if (genleps_gmotherstatus_branch != 0) genleps_gmotherstatus();
   if (gennus_isfromt_branch != 0) gennus_isfromt();
-  if (gennus_p4_branch != 0) gennus_p4();
+  if (gennus_p4_branch != 0 || gennus_p4_split.IsActive()) gennus_p4();
   if (gennus_id_branch != 0) gennus_id();
   if (gennus__genpsidx_branch != 0) gennus__genpsidx();
   if (gennus_status_branch != 0) gennus_status();
@@ -2122,16 +3118,16 @@ void StopTree::LoadAllBranches() {
   if (gennus_isLastCopy_branch != 0) gennus_isLastCopy();
   if (gennus_gentaudecay_branch != 0) gennus_gentaudecay();
   if (gen_nfromtnus__branch != 0) gen_nfromtnus_();
-  if (gennus_motherp4_branch != 0) gennus_motherp4();
+  if (gennus_motherp4_branch != 0 || gennus_motherp4_split.IsActive()) gennus_motherp4();
   if (gennus_motherid_branch != 0) gennus_motherid();
   if (gennus_motheridx_branch != 0) gennus_motheridx();
   if (gennus_motherstatus_branch != 0) gennus_motherstatus();
-  if (gennus_gmotherp4_branch != 0) gennus_gmotherp4();
+  if (gennus_gmotherp4_branch != 0 || gennus_gmotherp4_split.IsActive()) gennus_gmotherp4();
   if (gennus_gmotherid_branch != 0) gennus_gmotherid();
   if (gennus_gmotheridx_branch != 0) gennus_gmotheridx();
   if (gennus_gmotherstatus_branch != 0) gennus_gmotherstatus();
   if (genqs_isfromt_branch != 0) genqs_isfromt();
-  if (genqs_p4_branch != 0) genqs_p4();
+  if (genqs_p4_branch != 0 || genqs_p4_split.IsActive()) genqs_p4();
   if (genqs_id_branch != 0) genqs_id();
   if (genqs__genpsidx_branch != 0) genqs__genpsidx();
   if (genqs_status_branch != 0) genqs_status();
@@ -2141,16 +3137,16 @@ void StopTree::LoadAllBranches() {
   if (genqs_isLastCopy_branch != 0) genqs_isLastCopy();
   if (genqs_gentaudecay_branch != 0) genqs_gentaudecay();
   if (gen_nfromtqs__branch != 0) gen_nfromtqs_();
-  if (genqs_motherp4_branch != 0) genqs_motherp4();
+  if (genqs_motherp4_branch != 0 || genqs_motherp4_split.IsActive()) genqs_motherp4();
   if (genqs_motherid_branch != 0) genqs_motherid();
   if (genqs_motheridx_branch != 0) genqs_motheridx();
   if (genqs_motherstatus_branch != 0) genqs_motherstatus();
-  if (genqs_gmotherp4_branch != 0) genqs_gmotherp4();
+  if (genqs_gmotherp4_branch != 0 || genqs_gmotherp4_split.IsActive()) genqs_gmotherp4();
   if (genqs_gmotherid_branch != 0) genqs_gmotherid();
   if (genqs_gmotheridx_branch != 0) genqs_gmotheridx();
   if (genqs_gmotherstatus_branch != 0) genqs_gmotherstatus();
   if (genbosons_isfromt_branch != 0) genbosons_isfromt();
-  if (genbosons_p4_branch != 0) genbosons_p4();
+  if (genbosons_p4_branch != 0 || genbosons_p4_split.IsActive()) genbosons_p4();
   if (genbosons_id_branch != 0) genbosons_id();
   if (genbosons__genpsidx_branch != 0) genbosons__genpsidx();
   if (genbosons_status_branch != 0) genbosons_status();
@@ -2160,16 +3156,16 @@ void StopTree::LoadAllBranches() {
   if (genbosons_isLastCopy_branch != 0) genbosons_isLastCopy();
   if (genbosons_gentaudecay_branch != 0) genbosons_gentaudecay();
   if (gen_nfromtbosons__branch != 0) gen_nfromtbosons_();
-  if (genbosons_motherp4_branch != 0) genbosons_motherp4();
+  if (genbosons_motherp4_branch != 0 || genbosons_motherp4_split.IsActive()) genbosons_motherp4();
   if (genbosons_motherid_branch != 0) genbosons_motherid();
   if (genbosons_motheridx_branch != 0) genbosons_motheridx();
   if (genbosons_motherstatus_branch != 0) genbosons_motherstatus();
-  if (genbosons_gmotherp4_branch != 0) genbosons_gmotherp4();
+  if (genbosons_gmotherp4_branch != 0 || genbosons_gmotherp4_split.IsActive()) genbosons_gmotherp4();
   if (genbosons_gmotherid_branch != 0) genbosons_gmotherid();
   if (genbosons_gmotheridx_branch != 0) genbosons_gmotheridx();
   if (genbosons_gmotherstatus_branch != 0) genbosons_gmotherstatus();
   if (gensusy_isfromt_branch != 0) gensusy_isfromt();
-  if (gensusy_p4_branch != 0) gensusy_p4();
+  if (gensusy_p4_branch != 0 || gensusy_p4_split.IsActive()) gensusy_p4();
   if (gensusy_id_branch != 0) gensusy_id();
   if (gensusy__genpsidx_branch != 0) gensusy__genpsidx();
   if (gensusy_status_branch != 0) gensusy_status();
@@ -2179,15 +3175,15 @@ void StopTree::LoadAllBranches() {
   if (gensusy_isLastCopy_branch != 0) gensusy_isLastCopy();
   if (gensusy_gentaudecay_branch != 0) gensusy_gentaudecay();
   if (gen_nfromtsusy__branch != 0) gen_nfromtsusy_();
-  if (gensusy_motherp4_branch != 0) gensusy_motherp4();
+  if (gensusy_motherp4_branch != 0 || gensusy_motherp4_split.IsActive()) gensusy_motherp4();
   if (gensusy_motherid_branch != 0) gensusy_motherid();
   if (gensusy_motheridx_branch != 0) gensusy_motheridx();
   if (gensusy_motherstatus_branch != 0) gensusy_motherstatus();
-  if (gensusy_gmotherp4_branch != 0) gensusy_gmotherp4();
+  if (gensusy_gmotherp4_branch != 0 || gensusy_gmotherp4_split.IsActive()) gensusy_gmotherp4();
   if (gensusy_gmotherid_branch != 0) gensusy_gmotherid();
   if (gensusy_gmotheridx_branch != 0) gensusy_gmotheridx();
   if (gensusy_gmotherstatus_branch != 0) gensusy_gmotherstatus();
-  if (ak8pfjets_p4_branch != 0) ak8pfjets_p4();
+  if (ak8pfjets_p4_branch != 0 || ak8pfjets_p4_split.IsActive()) ak8pfjets_p4();
   if (ak8pfjets_tau1_branch != 0) ak8pfjets_tau1();
   if (ak8pfjets_tau2_branch != 0) ak8pfjets_tau2();
   if (ak8pfjets_tau3_branch != 0) ak8pfjets_tau3();
@@ -2201,7 +3197,7 @@ void StopTree::LoadAllBranches() {
   if (ak8pfjets_deepdisc_hbb_branch != 0) ak8pfjets_deepdisc_hbb();
   if (ak8pfjets_deepdisc_h4q_branch != 0) ak8pfjets_deepdisc_h4q();
   if (lead_ak8deepdisc_top_branch != 0) lead_ak8deepdisc_top();
-  if (jup_ak8pfjets_p4_branch != 0) jup_ak8pfjets_p4();
+  if (jup_ak8pfjets_p4_branch != 0 || jup_ak8pfjets_p4_split.IsActive()) jup_ak8pfjets_p4();
   if (jup_ak8pfjets_tau1_branch != 0) jup_ak8pfjets_tau1();
   if (jup_ak8pfjets_tau2_branch != 0) jup_ak8pfjets_tau2();
   if (jup_ak8pfjets_tau3_branch != 0) jup_ak8pfjets_tau3();
@@ -2215,7 +3211,7 @@ void StopTree::LoadAllBranches() {
   if (jup_ak8pfjets_deepdisc_hbb_branch != 0) jup_ak8pfjets_deepdisc_hbb();
   if (jup_ak8pfjets_deepdisc_h4q_branch != 0) jup_ak8pfjets_deepdisc_h4q();
   if (jup_lead_ak8deepdisc_top_branch != 0) jup_lead_ak8deepdisc_top();
-  if (jdown_ak8pfjets_p4_branch != 0) jdown_ak8pfjets_p4();
+  if (jdown_ak8pfjets_p4_branch != 0 || jdown_ak8pfjets_p4_split.IsActive()) jdown_ak8pfjets_p4();
   if (jdown_ak8pfjets_tau1_branch != 0) jdown_ak8pfjets_tau1();
   if (jdown_ak8pfjets_tau2_branch != 0) jdown_ak8pfjets_tau2();
   if (jdown_ak8pfjets_tau3_branch != 0) jdown_ak8pfjets_tau3();
@@ -2240,9 +3236,9 @@ void StopTree::LoadAllBranches() {
   if (ak4pfjets_deepCSVl_branch != 0) ak4pfjets_deepCSVl();
   if (topcands_ak4idx_branch != 0) topcands_ak4idx();
   if (topcands_disc_branch != 0) topcands_disc();
-  if (topcands_p4_branch != 0) topcands_p4();
-  if (topcands_Wp4_branch != 0) topcands_Wp4();
-  if (tftops_p4_branch != 0) tftops_p4();
+  if (topcands_p4_branch != 0 || topcands_p4_split.IsActive()) topcands_p4();
+  if (topcands_Wp4_branch != 0 || topcands_Wp4_split.IsActive()) topcands_Wp4();
+  if (tftops_p4_branch != 0 || tftops_p4_split.IsActive()) tftops_p4();
   if (tftops_disc_branch != 0) tftops_disc();
   if (tftops_subjet_pt_branch != 0) tftops_subjet_pt();
   if (tftops_subjet_eta_branch != 0) tftops_subjet_eta();
@@ -2258,9 +3254,9 @@ void StopTree::LoadAllBranches() {
   if (jup_ak4pfjets_deepCSVl_branch != 0) jup_ak4pfjets_deepCSVl();
   if (jup_topcands_ak4idx_branch != 0) jup_topcands_ak4idx();
   if (jup_topcands_disc_branch != 0) jup_topcands_disc();
-  if (jup_topcands_p4_branch != 0) jup_topcands_p4();
-  if (jup_topcands_Wp4_branch != 0) jup_topcands_Wp4();
-  if (jup_tftops_p4_branch != 0) jup_tftops_p4();
+  if (jup_topcands_p4_branch != 0 || jup_topcands_p4_split.IsActive()) jup_topcands_p4();
+  if (jup_topcands_Wp4_branch != 0 || jup_topcands_Wp4_split.IsActive()) jup_topcands_Wp4();
+  if (jup_tftops_p4_branch != 0 || jup_tftops_p4_split.IsActive()) jup_tftops_p4();
   if (jup_tftops_disc_branch != 0) jup_tftops_disc();
   if (jup_tftops_subjet_pt_branch != 0) jup_tftops_subjet_pt();
   if (jup_tftops_subjet_eta_branch != 0) jup_tftops_subjet_eta();
@@ -2276,21 +3272,21 @@ void StopTree::LoadAllBranches() {
   if (jdown_ak4pfjets_deepCSVl_branch != 0) jdown_ak4pfjets_deepCSVl();
   if (jdown_topcands_ak4idx_branch != 0) jdown_topcands_ak4idx();
   if (jdown_topcands_disc_branch != 0) jdown_topcands_disc();
-  if (jdown_topcands_p4_branch != 0) jdown_topcands_p4();
-  if (jdown_topcands_Wp4_branch != 0) jdown_topcands_Wp4();
-  if (jdown_tftops_p4_branch != 0) jdown_tftops_p4();
+  if (jdown_topcands_p4_branch != 0 || jdown_topcands_p4_split.IsActive()) jdown_topcands_p4();
+  if (jdown_topcands_Wp4_branch != 0 || jdown_topcands_Wp4_split.IsActive()) jdown_topcands_Wp4();
+  if (jdown_tftops_p4_branch != 0 || jdown_tftops_p4_split.IsActive()) jdown_tftops_p4();
   if (jdown_tftops_disc_branch != 0) jdown_tftops_disc();
   if (jdown_tftops_subjet_pt_branch != 0) jdown_tftops_subjet_pt();
   if (jdown_tftops_subjet_eta_branch != 0) jdown_tftops_subjet_eta();
   if (jdown_tftops_subjet_phi_branch != 0) jdown_tftops_subjet_phi();
   if (tau_IDnames_branch != 0) tau_IDnames();
-  if (tau_p4_branch != 0) tau_p4();
+  if (tau_p4_branch != 0 || tau_p4_split.IsActive()) tau_p4();
   if (tau_ID_branch != 0) tau_ID();
   if (tau_passID_branch != 0) tau_passID();
   if (ngoodtaus_branch != 0) ngoodtaus();
   if (tau_isVetoTau_branch != 0) tau_isVetoTau();
   if (tau_isVetoTau_v2_branch != 0) tau_isVetoTau_v2();
-  if (isoTracks_p4_branch != 0) isoTracks_p4();
+  if (isoTracks_p4_branch != 0 || isoTracks_p4_split.IsActive()) isoTracks_p4();
   if (isoTracks_charge_branch != 0) isoTracks_charge();
   if (isoTracks_absIso_branch != 0) isoTracks_absIso();
   if (isoTracks_dz_branch != 0) isoTracks_dz();
@@ -2336,6 +3332,7 @@ void StopTree::LoadAllBranches() {
   if (HLT_Photon200_branch != 0) HLT_Photon200();
   if (HLT_Photon250_NoHE_branch != 0) HLT_Photon250_NoHE();
   if (HLT_Photon300_NoHE_branch != 0) HLT_Photon300_NoHE();
+  if (HLT_bits_branch != 0) HLT_bits();
   if (filt_cscbeamhalo_branch != 0) filt_cscbeamhalo();
   if (filt_cscbeamhalo2015_branch != 0) filt_cscbeamhalo2015();
   if (filt_globaltighthalo2016_branch != 0) filt_globaltighthalo2016();
@@ -2371,7645 +3368,9972 @@ void StopTree::LoadAllBranches() {
 }
 
 const unsigned int &StopTree::run() {
-  if (not run_isLoaded) {
-    if (run_branch != 0) {
+  if (run_loadedGen != entryGeneration) {
+    if (run_flat.IsActive()) {
+      run_ = run_flat.Get(index);
+    } else if (run_bulk != 0) {
+      run_ = run_bulk->Get<unsigned int>(index);
+    } else if (run_branch != 0) {
       run_branch->GetEntry(index);
     } else {
       printf("branch run_branch does not exist!\n");
       exit(1);
     }
-    run_isLoaded = true;
+    run_loadedGen = entryGeneration;
   }
   return run_;
 }
 
 const unsigned int &StopTree::ls() {
-  if (not ls_isLoaded) {
-    if (ls_branch != 0) {
+  if (ls_loadedGen != entryGeneration) {
+    if (ls_flat.IsActive()) {
+      ls_ = ls_flat.Get(index);
+    } else if (ls_bulk != 0) {
+      ls_ = ls_bulk->Get<unsigned int>(index);
+    } else if (ls_branch != 0) {
       ls_branch->GetEntry(index);
     } else {
       printf("branch ls_branch does not exist!\n");
       exit(1);
     }
-    ls_isLoaded = true;
+    ls_loadedGen = entryGeneration;
   }
   return ls_;
 }
 
 const unsigned int &StopTree::evt() {
-  if (not evt_isLoaded) {
-    if (evt_branch != 0) {
+  if (evt_loadedGen != entryGeneration) {
+    if (evt_flat.IsActive()) {
+      evt_ = evt_flat.Get(index);
+    } else if (evt_bulk != 0) {
+      evt_ = evt_bulk->Get<unsigned int>(index);
+    } else if (evt_branch != 0) {
       evt_branch->GetEntry(index);
     } else {
       printf("branch evt_branch does not exist!\n");
       exit(1);
     }
-    evt_isLoaded = true;
+    evt_loadedGen = entryGeneration;
   }
   return evt_;
 }
 
 const int &StopTree::nvtxs() {
-  if (not nvtxs_isLoaded) {
-    if (nvtxs_branch != 0) {
+  if (nvtxs_loadedGen != entryGeneration) {
+    if (nvtxs_flat.IsActive()) {
+      nvtxs_ = nvtxs_flat.Get(index);
+    } else if (nvtxs_bulk != 0) {
+      nvtxs_ = nvtxs_bulk->Get<int>(index);
+    } else if (nvtxs_branch != 0) {
       nvtxs_branch->GetEntry(index);
     } else {
       printf("branch nvtxs_branch does not exist!\n");
       exit(1);
     }
-    nvtxs_isLoaded = true;
+    nvtxs_loadedGen = entryGeneration;
   }
   return nvtxs_;
 }
 
 const int &StopTree::year() {
-  if (not year_isLoaded) {
-    if (year_branch != 0) {
+  if (year_loadedGen != entryGeneration) {
+    if (year_flat.IsActive()) {
+      year_ = year_flat.Get(index);
+    } else if (year_bulk != 0) {
+      year_ = year_bulk->Get<int>(index);
+    } else if (year_branch != 0) {
       year_branch->GetEntry(index);
     } else {
       printf("branch year_branch does not exist!\n");
       exit(1);
     }
-    year_isLoaded = true;
+    year_loadedGen = entryGeneration;
   }
   return year_;
 }
 
 const int &StopTree::sampver() {
-  if (not sampver_isLoaded) {
-    if (sampver_branch != 0) {
+  if (sampver_loadedGen != entryGeneration) {
+    if (sampver_flat.IsActive()) {
+      sampver_ = sampver_flat.Get(index);
+    } else if (sampver_bulk != 0) {
+      sampver_ = sampver_bulk->Get<int>(index);
+    } else if (sampver_branch != 0) {
       sampver_branch->GetEntry(index);
     } else {
       printf("branch sampver_branch does not exist!\n");
       exit(1);
     }
-    sampver_isLoaded = true;
+    sampver_loadedGen = entryGeneration;
   }
   return sampver_;
 }
 
 const int &StopTree::pu_nvtxs() {
-  if (not pu_nvtxs_isLoaded) {
-    if (pu_nvtxs_branch != 0) {
+  if (pu_nvtxs_loadedGen != entryGeneration) {
+    if (pu_nvtxs_flat.IsActive()) {
+      pu_nvtxs_ = pu_nvtxs_flat.Get(index);
+    } else if (pu_nvtxs_bulk != 0) {
+      pu_nvtxs_ = pu_nvtxs_bulk->Get<int>(index);
+    } else if (pu_nvtxs_branch != 0) {
       pu_nvtxs_branch->GetEntry(index);
     } else {
       printf("branch pu_nvtxs_branch does not exist!\n");
       exit(1);
     }
-    pu_nvtxs_isLoaded = true;
+    pu_nvtxs_loadedGen = entryGeneration;
   }
   return pu_nvtxs_;
 }
 
 const float &StopTree::pfmet() {
-  if (not pfmet_isLoaded) {
-    if (pfmet_branch != 0) {
+  if (pfmet_loadedGen != entryGeneration) {
+    if (pfmet_flat.IsActive()) {
+      pfmet_ = pfmet_flat.Get(index);
+    } else if (pfmet_bulk != 0) {
+      pfmet_ = pfmet_bulk->Get<float>(index);
+    } else if (pfmet_branch != 0) {
       pfmet_branch->GetEntry(index);
     } else {
       printf("branch pfmet_branch does not exist!\n");
       exit(1);
     }
-    pfmet_isLoaded = true;
+    pfmet_loadedGen = entryGeneration;
   }
   return pfmet_;
 }
 
 const float &StopTree::pfmet_phi() {
-  if (not pfmet_phi_isLoaded) {
-    if (pfmet_phi_branch != 0) {
+  if (pfmet_phi_loadedGen != entryGeneration) {
+    if (pfmet_phi_flat.IsActive()) {
+      pfmet_phi_ = pfmet_phi_flat.Get(index);
+    } else if (pfmet_phi_bulk != 0) {
+      pfmet_phi_ = pfmet_phi_bulk->Get<float>(index);
+    } else if (pfmet_phi_branch != 0) {
       pfmet_phi_branch->GetEntry(index);
     } else {
       printf("branch pfmet_phi_branch does not exist!\n");
       exit(1);
     }
-    pfmet_phi_isLoaded = true;
+    pfmet_phi_loadedGen = entryGeneration;
   }
   return pfmet_phi_;
 }
 
 const float &StopTree::pfmet_jup() {
-  if (not pfmet_jup_isLoaded) {
-    if (pfmet_jup_branch != 0) {
+  if (pfmet_jup_loadedGen != entryGeneration) {
+    if (pfmet_jup_flat.IsActive()) {
+      pfmet_jup_ = pfmet_jup_flat.Get(index);
+    } else if (pfmet_jup_bulk != 0) {
+      pfmet_jup_ = pfmet_jup_bulk->Get<float>(index);
+    } else if (pfmet_jup_branch != 0) {
       pfmet_jup_branch->GetEntry(index);
     } else {
       printf("branch pfmet_jup_branch does not exist!\n");
       exit(1);
     }
-    pfmet_jup_isLoaded = true;
+    pfmet_jup_loadedGen = entryGeneration;
   }
   return pfmet_jup_;
 }
 
 const float &StopTree::pfmet_phi_jup() {
-  if (not pfmet_phi_jup_isLoaded) {
-    if (pfmet_phi_jup_branch != 0) {
+  if (pfmet_phi_jup_loadedGen != entryGeneration) {
+    if (pfmet_phi_jup_flat.IsActive()) {
+      pfmet_phi_jup_ = pfmet_phi_jup_flat.Get(index);
+    } else if (pfmet_phi_jup_bulk != 0) {
+      pfmet_phi_jup_ = pfmet_phi_jup_bulk->Get<float>(index);
+    } else if (pfmet_phi_jup_branch != 0) {
       pfmet_phi_jup_branch->GetEntry(index);
     } else {
       printf("branch pfmet_phi_jup_branch does not exist!\n");
       exit(1);
     }
-    pfmet_phi_jup_isLoaded = true;
+    pfmet_phi_jup_loadedGen = entryGeneration;
   }
   return pfmet_phi_jup_;
 }
 
 const float &StopTree::pfmet_jdown() {
-  if (not pfmet_jdown_isLoaded) {
-    if (pfmet_jdown_branch != 0) {
+  if (pfmet_jdown_loadedGen != entryGeneration) {
+    if (pfmet_jdown_flat.IsActive()) {
+      pfmet_jdown_ = pfmet_jdown_flat.Get(index);
+    } else if (pfmet_jdown_bulk != 0) {
+      pfmet_jdown_ = pfmet_jdown_bulk->Get<float>(index);
+    } else if (pfmet_jdown_branch != 0) {
       pfmet_jdown_branch->GetEntry(index);
     } else {
       printf("branch pfmet_jdown_branch does not exist!\n");
       exit(1);
     }
-    pfmet_jdown_isLoaded = true;
+    pfmet_jdown_loadedGen = entryGeneration;
   }
   return pfmet_jdown_;
 }
 
 const float &StopTree::pfmet_phi_jdown() {
-  if (not pfmet_phi_jdown_isLoaded) {
-    if (pfmet_phi_jdown_branch != 0) {
+  if (pfmet_phi_jdown_loadedGen != entryGeneration) {
+    if (pfmet_phi_jdown_flat.IsActive()) {
+      pfmet_phi_jdown_ = pfmet_phi_jdown_flat.Get(index);
+    } else if (pfmet_phi_jdown_bulk != 0) {
+      pfmet_phi_jdown_ = pfmet_phi_jdown_bulk->Get<float>(index);
+    } else if (pfmet_phi_jdown_branch != 0) {
       pfmet_phi_jdown_branch->GetEntry(index);
     } else {
       printf("branch pfmet_phi_jdown_branch does not exist!\n");
       exit(1);
     }
-    pfmet_phi_jdown_isLoaded = true;
+    pfmet_phi_jdown_loadedGen = entryGeneration;
   }
   return pfmet_phi_jdown_;
 }
 
 const float &StopTree::pfmet_rl() {
-  if (not pfmet_rl_isLoaded) {
-    if (pfmet_rl_branch != 0) {
+  if (pfmet_rl_loadedGen != entryGeneration) {
+    if (pfmet_rl_flat.IsActive()) {
+      pfmet_rl_ = pfmet_rl_flat.Get(index);
+    } else if (pfmet_rl_bulk != 0) {
+      pfmet_rl_ = pfmet_rl_bulk->Get<float>(index);
+    } else if (pfmet_rl_branch != 0) {
       pfmet_rl_branch->GetEntry(index);
     } else {
       printf("branch pfmet_rl_branch does not exist!\n");
       exit(1);
     }
-    pfmet_rl_isLoaded = true;
+    pfmet_rl_loadedGen = entryGeneration;
   }
   return pfmet_rl_;
 }
 
 const float &StopTree::pfmet_phi_rl() {
-  if (not pfmet_phi_rl_isLoaded) {
-    if (pfmet_phi_rl_branch != 0) {
+  if (pfmet_phi_rl_loadedGen != entryGeneration) {
+    if (pfmet_phi_rl_flat.IsActive()) {
+      pfmet_phi_rl_ = pfmet_phi_rl_flat.Get(index);
+    } else if (pfmet_phi_rl_bulk != 0) {
+      pfmet_phi_rl_ = pfmet_phi_rl_bulk->Get<float>(index);
+    } else if (pfmet_phi_rl_branch != 0) {
       pfmet_phi_rl_branch->GetEntry(index);
     } else {
       printf("branch pfmet_phi_rl_branch does not exist!\n");
       exit(1);
     }
-    pfmet_phi_rl_isLoaded = true;
+    pfmet_phi_rl_loadedGen = entryGeneration;
   }
   return pfmet_phi_rl_;
 }
 
 const float &StopTree::pfmet_rl_jup() {
-  if (not pfmet_rl_jup_isLoaded) {
-    if (pfmet_rl_jup_branch != 0) {
+  if (pfmet_rl_jup_loadedGen != entryGeneration) {
+    if (pfmet_rl_jup_flat.IsActive()) {
+      pfmet_rl_jup_ = pfmet_rl_jup_flat.Get(index);
+    } else if (pfmet_rl_jup_bulk != 0) {
+      pfmet_rl_jup_ = pfmet_rl_jup_bulk->Get<float>(index);
+    } else if (pfmet_rl_jup_branch != 0) {
       pfmet_rl_jup_branch->GetEntry(index);
     } else {
       printf("branch pfmet_rl_jup_branch does not exist!\n");
       exit(1);
     }
-    pfmet_rl_jup_isLoaded = true;
+    pfmet_rl_jup_loadedGen = entryGeneration;
   }
   return pfmet_rl_jup_;
 }
 
 const float &StopTree::pfmet_phi_rl_jup() {
-  if (not pfmet_phi_rl_jup_isLoaded) {
-    if (pfmet_phi_rl_jup_branch != 0) {
+  if (pfmet_phi_rl_jup_loadedGen != entryGeneration) {
+    if (pfmet_phi_rl_jup_flat.IsActive()) {
+      pfmet_phi_rl_jup_ = pfmet_phi_rl_jup_flat.Get(index);
+    } else if (pfmet_phi_rl_jup_bulk != 0) {
+      pfmet_phi_rl_jup_ = pfmet_phi_rl_jup_bulk->Get<float>(index);
+    } else if (pfmet_phi_rl_jup_branch != 0) {
       pfmet_phi_rl_jup_branch->GetEntry(index);
     } else {
       printf("branch pfmet_phi_rl_jup_branch does not exist!\n");
       exit(1);
     }
-    pfmet_phi_rl_jup_isLoaded = true;
+    pfmet_phi_rl_jup_loadedGen = entryGeneration;
   }
   return pfmet_phi_rl_jup_;
 }
 
 const float &StopTree::pfmet_rl_jdown() {
-  if (not pfmet_rl_jdown_isLoaded) {
-    if (pfmet_rl_jdown_branch != 0) {
+  if (pfmet_rl_jdown_loadedGen != entryGeneration) {
+    if (pfmet_rl_jdown_flat.IsActive()) {
+      pfmet_rl_jdown_ = pfmet_rl_jdown_flat.Get(index);
+    } else if (pfmet_rl_jdown_bulk != 0) {
+      pfmet_rl_jdown_ = pfmet_rl_jdown_bulk->Get<float>(index);
+    } else if (pfmet_rl_jdown_branch != 0) {
       pfmet_rl_jdown_branch->GetEntry(index);
     } else {
       printf("branch pfmet_rl_jdown_branch does not exist!\n");
       exit(1);
     }
-    pfmet_rl_jdown_isLoaded = true;
+    pfmet_rl_jdown_loadedGen = entryGeneration;
   }
   return pfmet_rl_jdown_;
 }
 
 const float &StopTree::pfmet_phi_rl_jdown() {
-  if (not pfmet_phi_rl_jdown_isLoaded) {
-    if (pfmet_phi_rl_jdown_branch != 0) {
+  if (pfmet_phi_rl_jdown_loadedGen != entryGeneration) {
+    if (pfmet_phi_rl_jdown_flat.IsActive()) {
+      pfmet_phi_rl_jdown_ = pfmet_phi_rl_jdown_flat.Get(index);
+    } else if (pfmet_phi_rl_jdown_bulk != 0) {
+      pfmet_phi_rl_jdown_ = pfmet_phi_rl_jdown_bulk->Get<float>(index);
+    } else if (pfmet_phi_rl_jdown_branch != 0) {
       pfmet_phi_rl_jdown_branch->GetEntry(index);
     } else {
       printf("branch pfmet_phi_rl_jdown_branch does not exist!\n");
       exit(1);
     }
-    pfmet_phi_rl_jdown_isLoaded = true;
+    pfmet_phi_rl_jdown_loadedGen = entryGeneration;
   }
   return pfmet_phi_rl_jdown_;
 }
 
 const float &StopTree::pfmet_egclean() {
-  if (not pfmet_egclean_isLoaded) {
-    if (pfmet_egclean_branch != 0) {
+  if (pfmet_egclean_loadedGen != entryGeneration) {
+    if (pfmet_egclean_flat.IsActive()) {
+      pfmet_egclean_ = pfmet_egclean_flat.Get(index);
+    } else if (pfmet_egclean_bulk != 0) {
+      pfmet_egclean_ = pfmet_egclean_bulk->Get<float>(index);
+    } else if (pfmet_egclean_branch != 0) {
       pfmet_egclean_branch->GetEntry(index);
     } else {
       printf("branch pfmet_egclean_branch does not exist!\n");
       exit(1);
     }
-    pfmet_egclean_isLoaded = true;
+    pfmet_egclean_loadedGen = entryGeneration;
   }
   return pfmet_egclean_;
 }
 
 const float &StopTree::pfmet_egclean_phi() {
-  if (not pfmet_egclean_phi_isLoaded) {
-    if (pfmet_egclean_phi_branch != 0) {
+  if (pfmet_egclean_phi_loadedGen != entryGeneration) {
+    if (pfmet_egclean_phi_flat.IsActive()) {
+      pfmet_egclean_phi_ = pfmet_egclean_phi_flat.Get(index);
+    } else if (pfmet_egclean_phi_bulk != 0) {
+      pfmet_egclean_phi_ = pfmet_egclean_phi_bulk->Get<float>(index);
+    } else if (pfmet_egclean_phi_branch != 0) {
       pfmet_egclean_phi_branch->GetEntry(index);
     } else {
       printf("branch pfmet_egclean_phi_branch does not exist!\n");
       exit(1);
     }
-    pfmet_egclean_phi_isLoaded = true;
+    pfmet_egclean_phi_loadedGen = entryGeneration;
   }
   return pfmet_egclean_phi_;
 }
 
 const float &StopTree::pfmet_muegclean() {
-  if (not pfmet_muegclean_isLoaded) {
-    if (pfmet_muegclean_branch != 0) {
+  if (pfmet_muegclean_loadedGen != entryGeneration) {
+    if (pfmet_muegclean_flat.IsActive()) {
+      pfmet_muegclean_ = pfmet_muegclean_flat.Get(index);
+    } else if (pfmet_muegclean_bulk != 0) {
+      pfmet_muegclean_ = pfmet_muegclean_bulk->Get<float>(index);
+    } else if (pfmet_muegclean_branch != 0) {
       pfmet_muegclean_branch->GetEntry(index);
     } else {
       printf("branch pfmet_muegclean_branch does not exist!\n");
       exit(1);
     }
-    pfmet_muegclean_isLoaded = true;
+    pfmet_muegclean_loadedGen = entryGeneration;
   }
   return pfmet_muegclean_;
 }
 
 const float &StopTree::pfmet_muegclean_phi() {
-  if (not pfmet_muegclean_phi_isLoaded) {
-    if (pfmet_muegclean_phi_branch != 0) {
+  if (pfmet_muegclean_phi_loadedGen != entryGeneration) {
+    if (pfmet_muegclean_phi_flat.IsActive()) {
+      pfmet_muegclean_phi_ = pfmet_muegclean_phi_flat.Get(index);
+    } else if (pfmet_muegclean_phi_bulk != 0) {
+      pfmet_muegclean_phi_ = pfmet_muegclean_phi_bulk->Get<float>(index);
+    } else if (pfmet_muegclean_phi_branch != 0) {
       pfmet_muegclean_phi_branch->GetEntry(index);
     } else {
       printf("branch pfmet_muegclean_phi_branch does not exist!\n");
       exit(1);
     }
-    pfmet_muegclean_phi_isLoaded = true;
+    pfmet_muegclean_phi_loadedGen = entryGeneration;
   }
   return pfmet_muegclean_phi_;
 }
 
 const float &StopTree::pfmet_muegcleanfix() {
-  if (not pfmet_muegcleanfix_isLoaded) {
-    if (pfmet_muegcleanfix_branch != 0) {
+  if (pfmet_muegcleanfix_loadedGen != entryGeneration) {
+    if (pfmet_muegcleanfix_flat.IsActive()) {
+      pfmet_muegcleanfix_ = pfmet_muegcleanfix_flat.Get(index);
+    } else if (pfmet_muegcleanfix_bulk != 0) {
+      pfmet_muegcleanfix_ = pfmet_muegcleanfix_bulk->Get<float>(index);
+    } else if (pfmet_muegcleanfix_branch != 0) {
       pfmet_muegcleanfix_branch->GetEntry(index);
     } else {
       printf("branch pfmet_muegcleanfix_branch does not exist!\n");
       exit(1);
     }
-    pfmet_muegcleanfix_isLoaded = true;
+    pfmet_muegcleanfix_loadedGen = entryGeneration;
   }
   return pfmet_muegcleanfix_;
 }
 
 const float &StopTree::pfmet_muegcleanfix_phi() {
-  if (not pfmet_muegcleanfix_phi_isLoaded) {
-    if (pfmet_muegcleanfix_phi_branch != 0) {
+  if (pfmet_muegcleanfix_phi_loadedGen != entryGeneration) {
+    if (pfmet_muegcleanfix_phi_flat.IsActive()) {
+      pfmet_muegcleanfix_phi_ = pfmet_muegcleanfix_phi_flat.Get(index);
+    } else if (pfmet_muegcleanfix_phi_bulk != 0) {
+      pfmet_muegcleanfix_phi_ = pfmet_muegcleanfix_phi_bulk->Get<float>(index);
+    } else if (pfmet_muegcleanfix_phi_branch != 0) {
       pfmet_muegcleanfix_phi_branch->GetEntry(index);
     } else {
       printf("branch pfmet_muegcleanfix_phi_branch does not exist!\n");
       exit(1);
     }
-    pfmet_muegcleanfix_phi_isLoaded = true;
+    pfmet_muegcleanfix_phi_loadedGen = entryGeneration;
   }
   return pfmet_muegcleanfix_phi_;
 }
 
 const float &StopTree::pfmet_uncorr() {
-  if (not pfmet_uncorr_isLoaded) {
-    if (pfmet_uncorr_branch != 0) {
+  if (pfmet_uncorr_loadedGen != entryGeneration) {
+    if (pfmet_uncorr_flat.IsActive()) {
+      pfmet_uncorr_ = pfmet_uncorr_flat.Get(index);
+    } else if (pfmet_uncorr_bulk != 0) {
+      pfmet_uncorr_ = pfmet_uncorr_bulk->Get<float>(index);
+    } else if (pfmet_uncorr_branch != 0) {
       pfmet_uncorr_branch->GetEntry(index);
     } else {
       printf("branch pfmet_uncorr_branch does not exist!\n");
       exit(1);
     }
-    pfmet_uncorr_isLoaded = true;
+    pfmet_uncorr_loadedGen = entryGeneration;
   }
   return pfmet_uncorr_;
 }
 
 const float &StopTree::pfmet_uncorr_phi() {
-  if (not pfmet_uncorr_phi_isLoaded) {
-    if (pfmet_uncorr_phi_branch != 0) {
+  if (pfmet_uncorr_phi_loadedGen != entryGeneration) {
+    if (pfmet_uncorr_phi_flat.IsActive()) {
+      pfmet_uncorr_phi_ = pfmet_uncorr_phi_flat.Get(index);
+    } else if (pfmet_uncorr_phi_bulk != 0) {
+      pfmet_uncorr_phi_ = pfmet_uncorr_phi_bulk->Get<float>(index);
+    } else if (pfmet_uncorr_phi_branch != 0) {
       pfmet_uncorr_phi_branch->GetEntry(index);
     } else {
       printf("branch pfmet_uncorr_phi_branch does not exist!\n");
       exit(1);
     }
-    pfmet_uncorr_phi_isLoaded = true;
+    pfmet_uncorr_phi_loadedGen = entryGeneration;
   }
   return pfmet_uncorr_phi_;
 }
 
 const float &StopTree::pfmet_original() {
-  if (not pfmet_original_isLoaded) {
-    if (pfmet_original_branch != 0) {
+  if (pfmet_original_loadedGen != entryGeneration) {
+    if (pfmet_original_flat.IsActive()) {
+      pfmet_original_ = pfmet_original_flat.Get(index);
+    } else if (pfmet_original_bulk != 0) {
+      pfmet_original_ = pfmet_original_bulk->Get<float>(index);
+    } else if (pfmet_original_branch != 0) {
       pfmet_original_branch->GetEntry(index);
     } else {
       printf("branch pfmet_original_branch does not exist!\n");
       exit(1);
     }
-    pfmet_original_isLoaded = true;
+    pfmet_original_loadedGen = entryGeneration;
   }
   return pfmet_original_;
 }
 
 const float &StopTree::pfmet_original_phi() {
-  if (not pfmet_original_phi_isLoaded) {
-    if (pfmet_original_phi_branch != 0) {
+  if (pfmet_original_phi_loadedGen != entryGeneration) {
+    if (pfmet_original_phi_flat.IsActive()) {
+      pfmet_original_phi_ = pfmet_original_phi_flat.Get(index);
+    } else if (pfmet_original_phi_bulk != 0) {
+      pfmet_original_phi_ = pfmet_original_phi_bulk->Get<float>(index);
+    } else if (pfmet_original_phi_branch != 0) {
       pfmet_original_phi_branch->GetEntry(index);
     } else {
       printf("branch pfmet_original_phi_branch does not exist!\n");
       exit(1);
     }
-    pfmet_original_phi_isLoaded = true;
+    pfmet_original_phi_loadedGen = entryGeneration;
   }
   return pfmet_original_phi_;
 }
 
 const float &StopTree::scale1fb() {
-  if (not scale1fb_isLoaded) {
-    if (scale1fb_branch != 0) {
+  if (scale1fb_loadedGen != entryGeneration) {
+    if (scale1fb_flat.IsActive()) {
+      scale1fb_ = scale1fb_flat.Get(index);
+    } else if (scale1fb_bulk != 0) {
+      scale1fb_ = scale1fb_bulk->Get<float>(index);
+    } else if (scale1fb_branch != 0) {
       scale1fb_branch->GetEntry(index);
     } else {
       printf("branch scale1fb_branch does not exist!\n");
       exit(1);
     }
-    scale1fb_isLoaded = true;
+    scale1fb_loadedGen = entryGeneration;
   }
   return scale1fb_;
 }
 
 const float &StopTree::xsec() {
-  if (not xsec_isLoaded) {
-    if (xsec_branch != 0) {
+  if (xsec_loadedGen != entryGeneration) {
+    if (xsec_flat.IsActive()) {
+      xsec_ = xsec_flat.Get(index);
+    } else if (xsec_bulk != 0) {
+      xsec_ = xsec_bulk->Get<float>(index);
+    } else if (xsec_branch != 0) {
       xsec_branch->GetEntry(index);
     } else {
       printf("branch xsec_branch does not exist!\n");
       exit(1);
     }
-    xsec_isLoaded = true;
+    xsec_loadedGen = entryGeneration;
   }
   return xsec_;
 }
 
 const float &StopTree::xsec_uncert() {
-  if (not xsec_uncert_isLoaded) {
-    if (xsec_uncert_branch != 0) {
+  if (xsec_uncert_loadedGen != entryGeneration) {
+    if (xsec_uncert_flat.IsActive()) {
+      xsec_uncert_ = xsec_uncert_flat.Get(index);
+    } else if (xsec_uncert_bulk != 0) {
+      xsec_uncert_ = xsec_uncert_bulk->Get<float>(index);
+    } else if (xsec_uncert_branch != 0) {
       xsec_uncert_branch->GetEntry(index);
     } else {
       printf("branch xsec_uncert_branch does not exist!\n");
       exit(1);
     }
-    xsec_uncert_isLoaded = true;
+    xsec_uncert_loadedGen = entryGeneration;
   }
   return xsec_uncert_;
 }
 
 const float &StopTree::kfactor() {
-  if (not kfactor_isLoaded) {
-    if (kfactor_branch != 0) {
+  if (kfactor_loadedGen != entryGeneration) {
+    if (kfactor_flat.IsActive()) {
+      kfactor_ = kfactor_flat.Get(index);
+    } else if (kfactor_bulk != 0) {
+      kfactor_ = kfactor_bulk->Get<float>(index);
+    } else if (kfactor_branch != 0) {
       kfactor_branch->GetEntry(index);
     } else {
       printf("branch kfactor_branch does not exist!\n");
       exit(1);
     }
-    kfactor_isLoaded = true;
+    kfactor_loadedGen = entryGeneration;
   }
   return kfactor_;
 }
 
 const float &StopTree::pu_ntrue() {
-  if (not pu_ntrue_isLoaded) {
-    if (pu_ntrue_branch != 0) {
+  if (pu_ntrue_loadedGen != entryGeneration) {
+    if (pu_ntrue_flat.IsActive()) {
+      pu_ntrue_ = pu_ntrue_flat.Get(index);
+    } else if (pu_ntrue_bulk != 0) {
+      pu_ntrue_ = pu_ntrue_bulk->Get<float>(index);
+    } else if (pu_ntrue_branch != 0) {
       pu_ntrue_branch->GetEntry(index);
     } else {
       printf("branch pu_ntrue_branch does not exist!\n");
       exit(1);
     }
-    pu_ntrue_isLoaded = true;
+    pu_ntrue_loadedGen = entryGeneration;
   }
   return pu_ntrue_;
 }
 
 const int &StopTree::ngoodleps() {
-  if (not ngoodleps_isLoaded) {
-    if (ngoodleps_branch != 0) {
+  if (ngoodleps_loadedGen != entryGeneration) {
+    if (ngoodleps_flat.IsActive()) {
+      ngoodleps_ = ngoodleps_flat.Get(index);
+    } else if (ngoodleps_bulk != 0) {
+      ngoodleps_ = ngoodleps_bulk->Get<int>(index);
+    } else if (ngoodleps_branch != 0) {
       ngoodleps_branch->GetEntry(index);
     } else {
       printf("branch ngoodleps_branch does not exist!\n");
       exit(1);
     }
-    ngoodleps_isLoaded = true;
+    ngoodleps_loadedGen = entryGeneration;
   }
   return ngoodleps_;
 }
 
 const int &StopTree::nlooseleps() {
-  if (not nlooseleps_isLoaded) {
-    if (nlooseleps_branch != 0) {
+  if (nlooseleps_loadedGen != entryGeneration) {
+    if (nlooseleps_flat.IsActive()) {
+      nlooseleps_ = nlooseleps_flat.Get(index);
+    } else if (nlooseleps_bulk != 0) {
+      nlooseleps_ = nlooseleps_bulk->Get<int>(index);
+    } else if (nlooseleps_branch != 0) {
       nlooseleps_branch->GetEntry(index);
     } else {
       printf("branch nlooseleps_branch does not exist!\n");
       exit(1);
     }
-    nlooseleps_isLoaded = true;
+    nlooseleps_loadedGen = entryGeneration;
   }
   return nlooseleps_;
 }
 
 const int &StopTree::nvetoleps() {
-  if (not nvetoleps_isLoaded) {
-    if (nvetoleps_branch != 0) {
+  if (nvetoleps_loadedGen != entryGeneration) {
+    if (nvetoleps_flat.IsActive()) {
+      nvetoleps_ = nvetoleps_flat.Get(index);
+    } else if (nvetoleps_bulk != 0) {
+      nvetoleps_ = nvetoleps_bulk->Get<int>(index);
+    } else if (nvetoleps_branch != 0) {
       nvetoleps_branch->GetEntry(index);
     } else {
       printf("branch nvetoleps_branch does not exist!\n");
       exit(1);
     }
-    nvetoleps_isLoaded = true;
+    nvetoleps_loadedGen = entryGeneration;
   }
   return nvetoleps_;
 }
 
 const bool &StopTree::is_data() {
-  if (not is_data_isLoaded) {
-    if (is_data_branch != 0) {
+  if (is_data_loadedGen != entryGeneration) {
+    if (is_data_flat.IsActive()) {
+      is_data_ = is_data_flat.Get(index);
+    } else if (is_data_bulk != 0) {
+      is_data_ = is_data_bulk->Get<bool>(index);
+    } else if (is_data_branch != 0) {
       is_data_branch->GetEntry(index);
     } else {
       printf("branch is_data_branch does not exist!\n");
       exit(1);
     }
-    is_data_isLoaded = true;
+    is_data_loadedGen = entryGeneration;
   }
   return is_data_;
 }
 
 const string &StopTree::dataset() {
-  if (not dataset_isLoaded) {
+  if (dataset_loadedGen != entryGeneration) {
     if (dataset_branch != 0) {
       dataset_branch->GetEntry(index);
     } else {
       printf("branch dataset_branch does not exist!\n");
       exit(1);
     }
-    dataset_isLoaded = true;
+    dataset_loadedGen = entryGeneration;
   }
   return *dataset_;
 }
 
 const string &StopTree::filename() {
-  if (not filename_isLoaded) {
+  if (filename_loadedGen != entryGeneration) {
     if (filename_branch != 0) {
       filename_branch->GetEntry(index);
     } else {
       printf("branch filename_branch does not exist!\n");
       exit(1);
     }
-    filename_isLoaded = true;
+    filename_loadedGen = entryGeneration;
   }
   return *filename_;
 }
 
 const string &StopTree::cms3tag() {
-  if (not cms3tag_isLoaded) {
+  if (cms3tag_loadedGen != entryGeneration) {
     if (cms3tag_branch != 0) {
       cms3tag_branch->GetEntry(index);
     } else {
       printf("branch cms3tag_branch does not exist!\n");
       exit(1);
     }
-    cms3tag_isLoaded = true;
+    cms3tag_loadedGen = entryGeneration;
   }
   return *cms3tag_;
 }
 
 const unsigned int &StopTree::nEvents() {
-  if (not nEvents_isLoaded) {
-    if (nEvents_branch != 0) {
+  if (nEvents_loadedGen != entryGeneration) {
+    if (nEvents_flat.IsActive()) {
+      nEvents_ = nEvents_flat.Get(index);
+    } else if (nEvents_bulk != 0) {
+      nEvents_ = nEvents_bulk->Get<unsigned int>(index);
+    } else if (nEvents_branch != 0) {
       nEvents_branch->GetEntry(index);
     } else {
       printf("branch nEvents_branch does not exist!\n");
       exit(1);
     }
-    nEvents_isLoaded = true;
+    nEvents_loadedGen = entryGeneration;
   }
   return nEvents_;
 }
 
 const unsigned int &StopTree::nEvents_goodvtx() {
-  if (not nEvents_goodvtx_isLoaded) {
-    if (nEvents_goodvtx_branch != 0) {
+  if (nEvents_goodvtx_loadedGen != entryGeneration) {
+    if (nEvents_goodvtx_flat.IsActive()) {
+      nEvents_goodvtx_ = nEvents_goodvtx_flat.Get(index);
+    } else if (nEvents_goodvtx_bulk != 0) {
+      nEvents_goodvtx_ = nEvents_goodvtx_bulk->Get<unsigned int>(index);
+    } else if (nEvents_goodvtx_branch != 0) {
       nEvents_goodvtx_branch->GetEntry(index);
     } else {
       printf("branch nEvents_goodvtx_branch does not exist!\n");
       exit(1);
     }
-    nEvents_goodvtx_isLoaded = true;
+    nEvents_goodvtx_loadedGen = entryGeneration;
   }
   return nEvents_goodvtx_;
 }
 
 const unsigned int &StopTree::nEvents_MET30() {
-  if (not nEvents_MET30_isLoaded) {
-    if (nEvents_MET30_branch != 0) {
+  if (nEvents_MET30_loadedGen != entryGeneration) {
+    if (nEvents_MET30_flat.IsActive()) {
+      nEvents_MET30_ = nEvents_MET30_flat.Get(index);
+    } else if (nEvents_MET30_bulk != 0) {
+      nEvents_MET30_ = nEvents_MET30_bulk->Get<unsigned int>(index);
+    } else if (nEvents_MET30_branch != 0) {
       nEvents_MET30_branch->GetEntry(index);
     } else {
       printf("branch nEvents_MET30_branch does not exist!\n");
       exit(1);
     }
-    nEvents_MET30_isLoaded = true;
+    nEvents_MET30_loadedGen = entryGeneration;
   }
   return nEvents_MET30_;
 }
 
 const unsigned int &StopTree::nEvents_1goodlep() {
-  if (not nEvents_1goodlep_isLoaded) {
-    if (nEvents_1goodlep_branch != 0) {
+  if (nEvents_1goodlep_loadedGen != entryGeneration) {
+    if (nEvents_1goodlep_flat.IsActive()) {
+      nEvents_1goodlep_ = nEvents_1goodlep_flat.Get(index);
+    } else if (nEvents_1goodlep_bulk != 0) {
+      nEvents_1goodlep_ = nEvents_1goodlep_bulk->Get<unsigned int>(index);
+    } else if (nEvents_1goodlep_branch != 0) {
       nEvents_1goodlep_branch->GetEntry(index);
     } else {
       printf("branch nEvents_1goodlep_branch does not exist!\n");
       exit(1);
     }
-    nEvents_1goodlep_isLoaded = true;
+    nEvents_1goodlep_loadedGen = entryGeneration;
   }
   return nEvents_1goodlep_;
 }
 
 const unsigned int &StopTree::nEvents_2goodjets() {
-  if (not nEvents_2goodjets_isLoaded) {
-    if (nEvents_2goodjets_branch != 0) {
+  if (nEvents_2goodjets_loadedGen != entryGeneration) {
+    if (nEvents_2goodjets_flat.IsActive()) {
+      nEvents_2goodjets_ = nEvents_2goodjets_flat.Get(index);
+    } else if (nEvents_2goodjets_bulk != 0) {
+      nEvents_2goodjets_ = nEvents_2goodjets_bulk->Get<unsigned int>(index);
+    } else if (nEvents_2goodjets_branch != 0) {
       nEvents_2goodjets_branch->GetEntry(index);
     } else {
       printf("branch nEvents_2goodjets_branch does not exist!\n");
       exit(1);
     }
-    nEvents_2goodjets_isLoaded = true;
+    nEvents_2goodjets_loadedGen = entryGeneration;
   }
   return nEvents_2goodjets_;
 }
 
 const int &StopTree::is0lep() {
-  if (not is0lep_isLoaded) {
-    if (is0lep_branch != 0) {
+  if (is0lep_loadedGen != entryGeneration) {
+    if (is0lep_flat.IsActive()) {
+      is0lep_ = is0lep_flat.Get(index);
+    } else if (is0lep_bulk != 0) {
+      is0lep_ = is0lep_bulk->Get<int>(index);
+    } else if (is0lep_branch != 0) {
       is0lep_branch->GetEntry(index);
     } else {
       printf("branch is0lep_branch does not exist!\n");
       exit(1);
     }
-    is0lep_isLoaded = true;
+    is0lep_loadedGen = entryGeneration;
   }
   return is0lep_;
 }
 
 const int &StopTree::is1lep() {
-  if (not is1lep_isLoaded) {
-    if (is1lep_branch != 0) {
+  if (is1lep_loadedGen != entryGeneration) {
+    if (is1lep_flat.IsActive()) {
+      is1lep_ = is1lep_flat.Get(index);
+    } else if (is1lep_bulk != 0) {
+      is1lep_ = is1lep_bulk->Get<int>(index);
+    } else if (is1lep_branch != 0) {
       is1lep_branch->GetEntry(index);
     } else {
       printf("branch is1lep_branch does not exist!\n");
       exit(1);
     }
-    is1lep_isLoaded = true;
+    is1lep_loadedGen = entryGeneration;
   }
   return is1lep_;
 }
 
 const int &StopTree::is2lep() {
-  if (not is2lep_isLoaded) {
-    if (is2lep_branch != 0) {
+  if (is2lep_loadedGen != entryGeneration) {
+    if (is2lep_flat.IsActive()) {
+      is2lep_ = is2lep_flat.Get(index);
+    } else if (is2lep_bulk != 0) {
+      is2lep_ = is2lep_bulk->Get<int>(index);
+    } else if (is2lep_branch != 0) {
       is2lep_branch->GetEntry(index);
     } else {
       printf("branch is2lep_branch does not exist!\n");
       exit(1);
     }
-    is2lep_isLoaded = true;
+    is2lep_loadedGen = entryGeneration;
   }
   return is2lep_;
 }
 
 const int &StopTree::isZtoNuNu() {
-  if (not isZtoNuNu_isLoaded) {
-    if (isZtoNuNu_branch != 0) {
+  if (isZtoNuNu_loadedGen != entryGeneration) {
+    if (isZtoNuNu_flat.IsActive()) {
+      isZtoNuNu_ = isZtoNuNu_flat.Get(index);
+    } else if (isZtoNuNu_bulk != 0) {
+      isZtoNuNu_ = isZtoNuNu_bulk->Get<int>(index);
+    } else if (isZtoNuNu_branch != 0) {
       isZtoNuNu_branch->GetEntry(index);
     } else {
       printf("branch isZtoNuNu_branch does not exist!\n");
       exit(1);
     }
-    isZtoNuNu_isLoaded = true;
+    isZtoNuNu_loadedGen = entryGeneration;
   }
   return isZtoNuNu_;
 }
 
 const int &StopTree::is1lepFromW() {
-  if (not is1lepFromW_isLoaded) {
-    if (is1lepFromW_branch != 0) {
+  if (is1lepFromW_loadedGen != entryGeneration) {
+    if (is1lepFromW_flat.IsActive()) {
+      is1lepFromW_ = is1lepFromW_flat.Get(index);
+    } else if (is1lepFromW_bulk != 0) {
+      is1lepFromW_ = is1lepFromW_bulk->Get<int>(index);
+    } else if (is1lepFromW_branch != 0) {
       is1lepFromW_branch->GetEntry(index);
     } else {
       printf("branch is1lepFromW_branch does not exist!\n");
       exit(1);
     }
-    is1lepFromW_isLoaded = true;
+    is1lepFromW_loadedGen = entryGeneration;
   }
   return is1lepFromW_;
 }
 
 const int &StopTree::is1lepFromTop() {
-  if (not is1lepFromTop_isLoaded) {
-    if (is1lepFromTop_branch != 0) {
+  if (is1lepFromTop_loadedGen != entryGeneration) {
+    if (is1lepFromTop_flat.IsActive()) {
+      is1lepFromTop_ = is1lepFromTop_flat.Get(index);
+    } else if (is1lepFromTop_bulk != 0) {
+      is1lepFromTop_ = is1lepFromTop_bulk->Get<int>(index);
+    } else if (is1lepFromTop_branch != 0) {
       is1lepFromTop_branch->GetEntry(index);
     } else {
       printf("branch is1lepFromTop_branch does not exist!\n");
       exit(1);
     }
-    is1lepFromTop_isLoaded = true;
+    is1lepFromTop_loadedGen = entryGeneration;
   }
   return is1lepFromTop_;
 }
 
 const float &StopTree::MT2W() {
-  if (not MT2W_isLoaded) {
-    if (MT2W_branch != 0) {
+  if (MT2W_loadedGen != entryGeneration) {
+    if (MT2W_flat.IsActive()) {
+      MT2W_ = MT2W_flat.Get(index);
+    } else if (MT2W_bulk != 0) {
+      MT2W_ = MT2W_bulk->Get<float>(index);
+    } else if (MT2W_branch != 0) {
       MT2W_branch->GetEntry(index);
     } else {
       printf("branch MT2W_branch does not exist!\n");
       exit(1);
     }
-    MT2W_isLoaded = true;
+    MT2W_loadedGen = entryGeneration;
   }
   return MT2W_;
 }
 
 const float &StopTree::MT2W_rl() {
-  if (not MT2W_rl_isLoaded) {
-    if (MT2W_rl_branch != 0) {
+  if (MT2W_rl_loadedGen != entryGeneration) {
+    if (MT2W_rl_flat.IsActive()) {
+      MT2W_rl_ = MT2W_rl_flat.Get(index);
+    } else if (MT2W_rl_bulk != 0) {
+      MT2W_rl_ = MT2W_rl_bulk->Get<float>(index);
+    } else if (MT2W_rl_branch != 0) {
       MT2W_rl_branch->GetEntry(index);
     } else {
       printf("branch MT2W_rl_branch does not exist!\n");
       exit(1);
     }
-    MT2W_rl_isLoaded = true;
+    MT2W_rl_loadedGen = entryGeneration;
   }
   return MT2W_rl_;
 }
 
 const float &StopTree::MT2_ll() {
-  if (not MT2_ll_isLoaded) {
-    if (MT2_ll_branch != 0) {
+  if (MT2_ll_loadedGen != entryGeneration) {
+    if (MT2_ll_flat.IsActive()) {
+      MT2_ll_ = MT2_ll_flat.Get(index);
+    } else if (MT2_ll_bulk != 0) {
+      MT2_ll_ = MT2_ll_bulk->Get<float>(index);
+    } else if (MT2_ll_branch != 0) {
       MT2_ll_branch->GetEntry(index);
     } else {
       printf("branch MT2_ll_branch does not exist!\n");
       exit(1);
     }
-    MT2_ll_isLoaded = true;
+    MT2_ll_loadedGen = entryGeneration;
   }
   return MT2_ll_;
 }
 
 const float &StopTree::mindphi_met_j1_j2() {
-  if (not mindphi_met_j1_j2_isLoaded) {
-    if (mindphi_met_j1_j2_branch != 0) {
+  if (mindphi_met_j1_j2_loadedGen != entryGeneration) {
+    if (mindphi_met_j1_j2_flat.IsActive()) {
+      mindphi_met_j1_j2_ = mindphi_met_j1_j2_flat.Get(index);
+    } else if (mindphi_met_j1_j2_bulk != 0) {
+      mindphi_met_j1_j2_ = mindphi_met_j1_j2_bulk->Get<float>(index);
+    } else if (mindphi_met_j1_j2_branch != 0) {
       mindphi_met_j1_j2_branch->GetEntry(index);
     } else {
       printf("branch mindphi_met_j1_j2_branch does not exist!\n");
       exit(1);
     }
-    mindphi_met_j1_j2_isLoaded = true;
+    mindphi_met_j1_j2_loadedGen = entryGeneration;
   }
   return mindphi_met_j1_j2_;
 }
 
 const float &StopTree::mindphi_met_j1_j2_rl() {
-  if (not mindphi_met_j1_j2_rl_isLoaded) {
-    if (mindphi_met_j1_j2_rl_branch != 0) {
+  if (mindphi_met_j1_j2_rl_loadedGen != entryGeneration) {
+    if (mindphi_met_j1_j2_rl_flat.IsActive()) {
+      mindphi_met_j1_j2_rl_ = mindphi_met_j1_j2_rl_flat.Get(index);
+    } else if (mindphi_met_j1_j2_rl_bulk != 0) {
+      mindphi_met_j1_j2_rl_ = mindphi_met_j1_j2_rl_bulk->Get<float>(index);
+    } else if (mindphi_met_j1_j2_rl_branch != 0) {
       mindphi_met_j1_j2_rl_branch->GetEntry(index);
     } else {
       printf("branch mindphi_met_j1_j2_rl_branch does not exist!\n");
       exit(1);
     }
-    mindphi_met_j1_j2_rl_isLoaded = true;
+    mindphi_met_j1_j2_rl_loadedGen = entryGeneration;
   }
   return mindphi_met_j1_j2_rl_;
 }
 
 const float &StopTree::mt_met_lep() {
-  if (not mt_met_lep_isLoaded) {
-    if (mt_met_lep_branch != 0) {
+  if (mt_met_lep_loadedGen != entryGeneration) {
+    if (mt_met_lep_flat.IsActive()) {
+      mt_met_lep_ = mt_met_lep_flat.Get(index);
+    } else if (mt_met_lep_bulk != 0) {
+      mt_met_lep_ = mt_met_lep_bulk->Get<float>(index);
+    } else if (mt_met_lep_branch != 0) {
       mt_met_lep_branch->GetEntry(index);
     } else {
       printf("branch mt_met_lep_branch does not exist!\n");
       exit(1);
     }
-    mt_met_lep_isLoaded = true;
+    mt_met_lep_loadedGen = entryGeneration;
   }
   return mt_met_lep_;
 }
 
 const float &StopTree::mt_met_lep_rl() {
-  if (not mt_met_lep_rl_isLoaded) {
-    if (mt_met_lep_rl_branch != 0) {
+  if (mt_met_lep_rl_loadedGen != entryGeneration) {
+    if (mt_met_lep_rl_flat.IsActive()) {
+      mt_met_lep_rl_ = mt_met_lep_rl_flat.Get(index);
+    } else if (mt_met_lep_rl_bulk != 0) {
+      mt_met_lep_rl_ = mt_met_lep_rl_bulk->Get<float>(index);
+    } else if (mt_met_lep_rl_branch != 0) {
       mt_met_lep_rl_branch->GetEntry(index);
     } else {
       printf("branch mt_met_lep_rl_branch does not exist!\n");
       exit(1);
     }
-    mt_met_lep_rl_isLoaded = true;
+    mt_met_lep_rl_loadedGen = entryGeneration;
   }
   return mt_met_lep_rl_;
 }
 
 const float &StopTree::MT2W_jup() {
-  if (not MT2W_jup_isLoaded) {
-    if (MT2W_jup_branch != 0) {
+  if (MT2W_jup_loadedGen != entryGeneration) {
+    if (MT2W_jup_flat.IsActive()) {
+      MT2W_jup_ = MT2W_jup_flat.Get(index);
+    } else if (MT2W_jup_bulk != 0) {
+      MT2W_jup_ = MT2W_jup_bulk->Get<float>(index);
+    } else if (MT2W_jup_branch != 0) {
       MT2W_jup_branch->GetEntry(index);
     } else {
       printf("branch MT2W_jup_branch does not exist!\n");
       exit(1);
     }
-    MT2W_jup_isLoaded = true;
+    MT2W_jup_loadedGen = entryGeneration;
   }
   return MT2W_jup_;
 }
 
 const float &StopTree::MT2W_rl_jup() {
-  if (not MT2W_rl_jup_isLoaded) {
-    if (MT2W_rl_jup_branch != 0) {
+  if (MT2W_rl_jup_loadedGen != entryGeneration) {
+    if (MT2W_rl_jup_flat.IsActive()) {
+      MT2W_rl_jup_ = MT2W_rl_jup_flat.Get(index);
+    } else if (MT2W_rl_jup_bulk != 0) {
+      MT2W_rl_jup_ = MT2W_rl_jup_bulk->Get<float>(index);
+    } else if (MT2W_rl_jup_branch != 0) {
       MT2W_rl_jup_branch->GetEntry(index);
     } else {
       printf("branch MT2W_rl_jup_branch does not exist!\n");
       exit(1);
     }
-    MT2W_rl_jup_isLoaded = true;
+    MT2W_rl_jup_loadedGen = entryGeneration;
   }
   return MT2W_rl_jup_;
 }
 
 const float &StopTree::MT2_ll_jup() {
-  if (not MT2_ll_jup_isLoaded) {
-    if (MT2_ll_jup_branch != 0) {
+  if (MT2_ll_jup_loadedGen != entryGeneration) {
+    if (MT2_ll_jup_flat.IsActive()) {
+      MT2_ll_jup_ = MT2_ll_jup_flat.Get(index);
+    } else if (MT2_ll_jup_bulk != 0) {
+      MT2_ll_jup_ = MT2_ll_jup_bulk->Get<float>(index);
+    } else if (MT2_ll_jup_branch != 0) {
       MT2_ll_jup_branch->GetEntry(index);
     } else {
       printf("branch MT2_ll_jup_branch does not exist!\n");
       exit(1);
     }
-    MT2_ll_jup_isLoaded = true;
+    MT2_ll_jup_loadedGen = entryGeneration;
   }
   return MT2_ll_jup_;
 }
 
 const float &StopTree::mindphi_met_j1_j2_jup() {
-  if (not mindphi_met_j1_j2_jup_isLoaded) {
-    if (mindphi_met_j1_j2_jup_branch != 0) {
+  if (mindphi_met_j1_j2_jup_loadedGen != entryGeneration) {
+    if (mindphi_met_j1_j2_jup_flat.IsActive()) {
+      mindphi_met_j1_j2_jup_ = mindphi_met_j1_j2_jup_flat.Get(index);
+    } else if (mindphi_met_j1_j2_jup_bulk != 0) {
+      mindphi_met_j1_j2_jup_ = mindphi_met_j1_j2_jup_bulk->Get<float>(index);
+    } else if (mindphi_met_j1_j2_jup_branch != 0) {
       mindphi_met_j1_j2_jup_branch->GetEntry(index);
     } else {
       printf("branch mindphi_met_j1_j2_jup_branch does not exist!\n");
       exit(1);
     }
-    mindphi_met_j1_j2_jup_isLoaded = true;
+    mindphi_met_j1_j2_jup_loadedGen = entryGeneration;
   }
   return mindphi_met_j1_j2_jup_;
 }
 
 const float &StopTree::mindphi_met_j1_j2_rl_jup() {
-  if (not mindphi_met_j1_j2_rl_jup_isLoaded) {
-    if (mindphi_met_j1_j2_rl_jup_branch != 0) {
+  if (mindphi_met_j1_j2_rl_jup_loadedGen != entryGeneration) {
+    if (mindphi_met_j1_j2_rl_jup_flat.IsActive()) {
+      mindphi_met_j1_j2_rl_jup_ = mindphi_met_j1_j2_rl_jup_flat.Get(index);
+    } else if (mindphi_met_j1_j2_rl_jup_bulk != 0) {
+      mindphi_met_j1_j2_rl_jup_ = mindphi_met_j1_j2_rl_jup_bulk->Get<float>(index);
+    } else if (mindphi_met_j1_j2_rl_jup_branch != 0) {
       mindphi_met_j1_j2_rl_jup_branch->GetEntry(index);
     } else {
       printf("branch mindphi_met_j1_j2_rl_jup_branch does not exist!\n");
       exit(1);
     }
-    mindphi_met_j1_j2_rl_jup_isLoaded = true;
+    mindphi_met_j1_j2_rl_jup_loadedGen = entryGeneration;
   }
   return mindphi_met_j1_j2_rl_jup_;
 }
 
 const float &StopTree::mt_met_lep_jup() {
-  if (not mt_met_lep_jup_isLoaded) {
-    if (mt_met_lep_jup_branch != 0) {
+  if (mt_met_lep_jup_loadedGen != entryGeneration) {
+    if (mt_met_lep_jup_flat.IsActive()) {
+      mt_met_lep_jup_ = mt_met_lep_jup_flat.Get(index);
+    } else if (mt_met_lep_jup_bulk != 0) {
+      mt_met_lep_jup_ = mt_met_lep_jup_bulk->Get<float>(index);
+    } else if (mt_met_lep_jup_branch != 0) {
       mt_met_lep_jup_branch->GetEntry(index);
     } else {
       printf("branch mt_met_lep_jup_branch does not exist!\n");
       exit(1);
     }
-    mt_met_lep_jup_isLoaded = true;
+    mt_met_lep_jup_loadedGen = entryGeneration;
   }
   return mt_met_lep_jup_;
 }
 
 const float &StopTree::mt_met_lep_rl_jup() {
-  if (not mt_met_lep_rl_jup_isLoaded) {
-    if (mt_met_lep_rl_jup_branch != 0) {
+  if (mt_met_lep_rl_jup_loadedGen != entryGeneration) {
+    if (mt_met_lep_rl_jup_flat.IsActive()) {
+      mt_met_lep_rl_jup_ = mt_met_lep_rl_jup_flat.Get(index);
+    } else if (mt_met_lep_rl_jup_bulk != 0) {
+      mt_met_lep_rl_jup_ = mt_met_lep_rl_jup_bulk->Get<float>(index);
+    } else if (mt_met_lep_rl_jup_branch != 0) {
       mt_met_lep_rl_jup_branch->GetEntry(index);
     } else {
       printf("branch mt_met_lep_rl_jup_branch does not exist!\n");
       exit(1);
     }
-    mt_met_lep_rl_jup_isLoaded = true;
+    mt_met_lep_rl_jup_loadedGen = entryGeneration;
   }
   return mt_met_lep_rl_jup_;
 }
 
 const float &StopTree::MT2W_jdown() {
-  if (not MT2W_jdown_isLoaded) {
-    if (MT2W_jdown_branch != 0) {
+  if (MT2W_jdown_loadedGen != entryGeneration) {
+    if (MT2W_jdown_flat.IsActive()) {
+      MT2W_jdown_ = MT2W_jdown_flat.Get(index);
+    } else if (MT2W_jdown_bulk != 0) {
+      MT2W_jdown_ = MT2W_jdown_bulk->Get<float>(index);
+    } else if (MT2W_jdown_branch != 0) {
       MT2W_jdown_branch->GetEntry(index);
     } else {
       printf("branch MT2W_jdown_branch does not exist!\n");
       exit(1);
     }
-    MT2W_jdown_isLoaded = true;
+    MT2W_jdown_loadedGen = entryGeneration;
   }
   return MT2W_jdown_;
 }
 
 const float &StopTree::MT2W_rl_jdown() {
-  if (not MT2W_rl_jdown_isLoaded) {
-    if (MT2W_rl_jdown_branch != 0) {
+  if (MT2W_rl_jdown_loadedGen != entryGeneration) {
+    if (MT2W_rl_jdown_flat.IsActive()) {
+      MT2W_rl_jdown_ = MT2W_rl_jdown_flat.Get(index);
+    } else if (MT2W_rl_jdown_bulk != 0) {
+      MT2W_rl_jdown_ = MT2W_rl_jdown_bulk->Get<float>(index);
+    } else if (MT2W_rl_jdown_branch != 0) {
       MT2W_rl_jdown_branch->GetEntry(index);
     } else {
       printf("branch MT2W_rl_jdown_branch does not exist!\n");
       exit(1);
     }
-    MT2W_rl_jdown_isLoaded = true;
+    MT2W_rl_jdown_loadedGen = entryGeneration;
   }
   return MT2W_rl_jdown_;
 }
 
 const float &StopTree::MT2_ll_jdown() {
-  if (not MT2_ll_jdown_isLoaded) {
-    if (MT2_ll_jdown_branch != 0) {
+  if (MT2_ll_jdown_loadedGen != entryGeneration) {
+    if (MT2_ll_jdown_flat.IsActive()) {
+      MT2_ll_jdown_ = MT2_ll_jdown_flat.Get(index);
+    } else if (MT2_ll_jdown_bulk != 0) {
+      MT2_ll_jdown_ = MT2_ll_jdown_bulk->Get<float>(index);
+    } else if (MT2_ll_jdown_branch != 0) {
       MT2_ll_jdown_branch->GetEntry(index);
     } else {
       printf("branch MT2_ll_jdown_branch does not exist!\n");
       exit(1);
     }
-    MT2_ll_jdown_isLoaded = true;
+    MT2_ll_jdown_loadedGen = entryGeneration;
   }
   return MT2_ll_jdown_;
 }
 
 const float &StopTree::mindphi_met_j1_j2_jdown() {
-  if (not mindphi_met_j1_j2_jdown_isLoaded) {
-    if (mindphi_met_j1_j2_jdown_branch != 0) {
+  if (mindphi_met_j1_j2_jdown_loadedGen != entryGeneration) {
+    if (mindphi_met_j1_j2_jdown_flat.IsActive()) {
+      mindphi_met_j1_j2_jdown_ = mindphi_met_j1_j2_jdown_flat.Get(index);
+    } else if (mindphi_met_j1_j2_jdown_bulk != 0) {
+      mindphi_met_j1_j2_jdown_ = mindphi_met_j1_j2_jdown_bulk->Get<float>(index);
+    } else if (mindphi_met_j1_j2_jdown_branch != 0) {
       mindphi_met_j1_j2_jdown_branch->GetEntry(index);
     } else {
       printf("branch mindphi_met_j1_j2_jdown_branch does not exist!\n");
       exit(1);
     }
-    mindphi_met_j1_j2_jdown_isLoaded = true;
+    mindphi_met_j1_j2_jdown_loadedGen = entryGeneration;
   }
   return mindphi_met_j1_j2_jdown_;
 }
 
 const float &StopTree::mindphi_met_j1_j2_rl_jdown() {
-  if (not mindphi_met_j1_j2_rl_jdown_isLoaded) {
-    if (mindphi_met_j1_j2_rl_jdown_branch != 0) {
+  if (mindphi_met_j1_j2_rl_jdown_loadedGen != entryGeneration) {
+    if (mindphi_met_j1_j2_rl_jdown_flat.IsActive()) {
+      mindphi_met_j1_j2_rl_jdown_ = mindphi_met_j1_j2_rl_jdown_flat.Get(index);
+    } else if (mindphi_met_j1_j2_rl_jdown_bulk != 0) {
+      mindphi_met_j1_j2_rl_jdown_ = mindphi_met_j1_j2_rl_jdown_bulk->Get<float>(index);
+    } else if (mindphi_met_j1_j2_rl_jdown_branch != 0) {
       mindphi_met_j1_j2_rl_jdown_branch->GetEntry(index);
     } else {
       printf("branch mindphi_met_j1_j2_rl_jdown_branch does not exist!\n");
       exit(1);
     }
-    mindphi_met_j1_j2_rl_jdown_isLoaded = true;
+    mindphi_met_j1_j2_rl_jdown_loadedGen = entryGeneration;
   }
   return mindphi_met_j1_j2_rl_jdown_;
 }
 
 const float &StopTree::mt_met_lep_jdown() {
-  if (not mt_met_lep_jdown_isLoaded) {
-    if (mt_met_lep_jdown_branch != 0) {
+  if (mt_met_lep_jdown_loadedGen != entryGeneration) {
+    if (mt_met_lep_jdown_flat.IsActive()) {
+      mt_met_lep_jdown_ = mt_met_lep_jdown_flat.Get(index);
+    } else if (mt_met_lep_jdown_bulk != 0) {
+      mt_met_lep_jdown_ = mt_met_lep_jdown_bulk->Get<float>(index);
+    } else if (mt_met_lep_jdown_branch != 0) {
       mt_met_lep_jdown_branch->GetEntry(index);
     } else {
       printf("branch mt_met_lep_jdown_branch does not exist!\n");
       exit(1);
     }
-    mt_met_lep_jdown_isLoaded = true;
+    mt_met_lep_jdown_loadedGen = entryGeneration;
   }
   return mt_met_lep_jdown_;
 }
 
 const float &StopTree::mt_met_lep_rl_jdown() {
-  if (not mt_met_lep_rl_jdown_isLoaded) {
-    if (mt_met_lep_rl_jdown_branch != 0) {
+  if (mt_met_lep_rl_jdown_loadedGen != entryGeneration) {
+    if (mt_met_lep_rl_jdown_flat.IsActive()) {
+      mt_met_lep_rl_jdown_ = mt_met_lep_rl_jdown_flat.Get(index);
+    } else if (mt_met_lep_rl_jdown_bulk != 0) {
+      mt_met_lep_rl_jdown_ = mt_met_lep_rl_jdown_bulk->Get<float>(index);
+    } else if (mt_met_lep_rl_jdown_branch != 0) {
       mt_met_lep_rl_jdown_branch->GetEntry(index);
     } else {
       printf("branch mt_met_lep_rl_jdown_branch does not exist!\n");
       exit(1);
     }
-    mt_met_lep_rl_jdown_isLoaded = true;
+    mt_met_lep_rl_jdown_loadedGen = entryGeneration;
   }
   return mt_met_lep_rl_jdown_;
 }
 
 const float &StopTree::hadronic_top_chi2() {
-  if (not hadronic_top_chi2_isLoaded) {
-    if (hadronic_top_chi2_branch != 0) {
+  if (hadronic_top_chi2_loadedGen != entryGeneration) {
+    if (hadronic_top_chi2_flat.IsActive()) {
+      hadronic_top_chi2_ = hadronic_top_chi2_flat.Get(index);
+    } else if (hadronic_top_chi2_bulk != 0) {
+      hadronic_top_chi2_ = hadronic_top_chi2_bulk->Get<float>(index);
+    } else if (hadronic_top_chi2_branch != 0) {
       hadronic_top_chi2_branch->GetEntry(index);
     } else {
       printf("branch hadronic_top_chi2_branch does not exist!\n");
       exit(1);
     }
-    hadronic_top_chi2_isLoaded = true;
+    hadronic_top_chi2_loadedGen = entryGeneration;
   }
   return hadronic_top_chi2_;
 }
 
 const float &StopTree::ak4pfjets_rho() {
-  if (not ak4pfjets_rho_isLoaded) {
-    if (ak4pfjets_rho_branch != 0) {
+  if (ak4pfjets_rho_loadedGen != entryGeneration) {
+    if (ak4pfjets_rho_flat.IsActive()) {
+      ak4pfjets_rho_ = ak4pfjets_rho_flat.Get(index);
+    } else if (ak4pfjets_rho_bulk != 0) {
+      ak4pfjets_rho_ = ak4pfjets_rho_bulk->Get<float>(index);
+    } else if (ak4pfjets_rho_branch != 0) {
       ak4pfjets_rho_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_rho_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_rho_isLoaded = true;
+    ak4pfjets_rho_loadedGen = entryGeneration;
   }
   return ak4pfjets_rho_;
 }
 
 const float &StopTree::pdf_up_weight() {
-  if (not pdf_up_weight_isLoaded) {
-    if (pdf_up_weight_branch != 0) {
+  if (pdf_up_weight_loadedGen != entryGeneration) {
+    if (pdf_up_weight_flat.IsActive()) {
+      pdf_up_weight_ = pdf_up_weight_flat.Get(index);
+    } else if (pdf_up_weight_bulk != 0) {
+      pdf_up_weight_ = pdf_up_weight_bulk->Get<float>(index);
+    } else if (pdf_up_weight_branch != 0) {
       pdf_up_weight_branch->GetEntry(index);
     } else {
       printf("branch pdf_up_weight_branch does not exist!\n");
       exit(1);
     }
-    pdf_up_weight_isLoaded = true;
+    pdf_up_weight_loadedGen = entryGeneration;
   }
   return pdf_up_weight_;
 }
 
 const float &StopTree::pdf_down_weight() {
-  if (not pdf_down_weight_isLoaded) {
-    if (pdf_down_weight_branch != 0) {
+  if (pdf_down_weight_loadedGen != entryGeneration) {
+    if (pdf_down_weight_flat.IsActive()) {
+      pdf_down_weight_ = pdf_down_weight_flat.Get(index);
+    } else if (pdf_down_weight_bulk != 0) {
+      pdf_down_weight_ = pdf_down_weight_bulk->Get<float>(index);
+    } else if (pdf_down_weight_branch != 0) {
       pdf_down_weight_branch->GetEntry(index);
     } else {
       printf("branch pdf_down_weight_branch does not exist!\n");
       exit(1);
     }
-    pdf_down_weight_isLoaded = true;
+    pdf_down_weight_loadedGen = entryGeneration;
   }
   return pdf_down_weight_;
 }
 
 const vector<string> &StopTree::genweightsID() {
-  if (not genweightsID_isLoaded) {
+  if (genweightsID_loadedGen != entryGeneration) {
     if (genweightsID_branch != 0) {
       genweightsID_branch->GetEntry(index);
     } else {
       printf("branch genweightsID_branch does not exist!\n");
       exit(1);
     }
-    genweightsID_isLoaded = true;
+    genweightsID_loadedGen = entryGeneration;
   }
   return *genweightsID_;
 }
 
 const int &StopTree::ngenweights() {
-  if (not ngenweights_isLoaded) {
-    if (ngenweights_branch != 0) {
+  if (ngenweights_loadedGen != entryGeneration) {
+    if (ngenweights_flat.IsActive()) {
+      ngenweights_ = ngenweights_flat.Get(index);
+    } else if (ngenweights_bulk != 0) {
+      ngenweights_ = ngenweights_bulk->Get<int>(index);
+    } else if (ngenweights_branch != 0) {
       ngenweights_branch->GetEntry(index);
     } else {
       printf("branch ngenweights_branch does not exist!\n");
       exit(1);
     }
-    ngenweights_isLoaded = true;
+    ngenweights_loadedGen = entryGeneration;
   }
   return ngenweights_;
 }
 
 const vector<float> &StopTree::genweights() {
-  if (not genweights_isLoaded) {
-    if (genweights_branch != 0) {
+  if (genweights_loadedGen != entryGeneration) {
+    if (genweights_flat.IsActive()) {
+      genweights_ = genweights_flat.Get(index);
+    } else if (genweights_branch != 0) {
       genweights_branch->GetEntry(index);
     } else {
       printf("branch genweights_branch does not exist!\n");
       exit(1);
     }
-    genweights_isLoaded = true;
+    genweights_loadedGen = entryGeneration;
   }
   return *genweights_;
 }
 
 const float &StopTree::weight_Q2_up() {
-  if (not weight_Q2_up_isLoaded) {
-    if (weight_Q2_up_branch != 0) {
+  if (weight_Q2_up_loadedGen != entryGeneration) {
+    if (weight_Q2_up_flat.IsActive()) {
+      weight_Q2_up_ = weight_Q2_up_flat.Get(index);
+    } else if (weight_Q2_up_bulk != 0) {
+      weight_Q2_up_ = weight_Q2_up_bulk->Get<float>(index);
+    } else if (weight_Q2_up_branch != 0) {
       weight_Q2_up_branch->GetEntry(index);
     } else {
       printf("branch weight_Q2_up_branch does not exist!\n");
       exit(1);
     }
-    weight_Q2_up_isLoaded = true;
+    weight_Q2_up_loadedGen = entryGeneration;
   }
   return weight_Q2_up_;
 }
 
 const float &StopTree::weight_Q2_down() {
-  if (not weight_Q2_down_isLoaded) {
-    if (weight_Q2_down_branch != 0) {
+  if (weight_Q2_down_loadedGen != entryGeneration) {
+    if (weight_Q2_down_flat.IsActive()) {
+      weight_Q2_down_ = weight_Q2_down_flat.Get(index);
+    } else if (weight_Q2_down_bulk != 0) {
+      weight_Q2_down_ = weight_Q2_down_bulk->Get<float>(index);
+    } else if (weight_Q2_down_branch != 0) {
       weight_Q2_down_branch->GetEntry(index);
     } else {
       printf("branch weight_Q2_down_branch does not exist!\n");
       exit(1);
     }
-    weight_Q2_down_isLoaded = true;
+    weight_Q2_down_loadedGen = entryGeneration;
   }
   return weight_Q2_down_;
 }
 
 const float &StopTree::weight_alphas_up() {
-  if (not weight_alphas_up_isLoaded) {
-    if (weight_alphas_up_branch != 0) {
+  if (weight_alphas_up_loadedGen != entryGeneration) {
+    if (weight_alphas_up_flat.IsActive()) {
+      weight_alphas_up_ = weight_alphas_up_flat.Get(index);
+    } else if (weight_alphas_up_bulk != 0) {
+      weight_alphas_up_ = weight_alphas_up_bulk->Get<float>(index);
+    } else if (weight_alphas_up_branch != 0) {
       weight_alphas_up_branch->GetEntry(index);
     } else {
       printf("branch weight_alphas_up_branch does not exist!\n");
       exit(1);
     }
-    weight_alphas_up_isLoaded = true;
+    weight_alphas_up_loadedGen = entryGeneration;
   }
   return weight_alphas_up_;
 }
 
 const float &StopTree::weight_alphas_down() {
-  if (not weight_alphas_down_isLoaded) {
-    if (weight_alphas_down_branch != 0) {
+  if (weight_alphas_down_loadedGen != entryGeneration) {
+    if (weight_alphas_down_flat.IsActive()) {
+      weight_alphas_down_ = weight_alphas_down_flat.Get(index);
+    } else if (weight_alphas_down_bulk != 0) {
+      weight_alphas_down_ = weight_alphas_down_bulk->Get<float>(index);
+    } else if (weight_alphas_down_branch != 0) {
       weight_alphas_down_branch->GetEntry(index);
     } else {
       printf("branch weight_alphas_down_branch does not exist!\n");
       exit(1);
     }
-    weight_alphas_down_isLoaded = true;
+    weight_alphas_down_loadedGen = entryGeneration;
   }
   return weight_alphas_down_;
 }
 
 const float &StopTree::weight_btagsf() {
-  if (not weight_btagsf_isLoaded) {
-    if (weight_btagsf_branch != 0) {
+  if (weight_btagsf_loadedGen != entryGeneration) {
+    if (weight_btagsf_flat.IsActive()) {
+      weight_btagsf_ = weight_btagsf_flat.Get(index);
+    } else if (weight_btagsf_bulk != 0) {
+      weight_btagsf_ = weight_btagsf_bulk->Get<float>(index);
+    } else if (weight_btagsf_branch != 0) {
       weight_btagsf_branch->GetEntry(index);
     } else {
       printf("branch weight_btagsf_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_isLoaded = true;
+    weight_btagsf_loadedGen = entryGeneration;
   }
   return weight_btagsf_;
 }
 
 const float &StopTree::weight_btagsf_heavy_UP() {
-  if (not weight_btagsf_heavy_UP_isLoaded) {
-    if (weight_btagsf_heavy_UP_branch != 0) {
+  if (weight_btagsf_heavy_UP_loadedGen != entryGeneration) {
+    if (weight_btagsf_heavy_UP_flat.IsActive()) {
+      weight_btagsf_heavy_UP_ = weight_btagsf_heavy_UP_flat.Get(index);
+    } else if (weight_btagsf_heavy_UP_bulk != 0) {
+      weight_btagsf_heavy_UP_ = weight_btagsf_heavy_UP_bulk->Get<float>(index);
+    } else if (weight_btagsf_heavy_UP_branch != 0) {
       weight_btagsf_heavy_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_btagsf_heavy_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_heavy_UP_isLoaded = true;
+    weight_btagsf_heavy_UP_loadedGen = entryGeneration;
   }
   return weight_btagsf_heavy_UP_;
 }
 
 const float &StopTree::weight_btagsf_light_UP() {
-  if (not weight_btagsf_light_UP_isLoaded) {
-    if (weight_btagsf_light_UP_branch != 0) {
+  if (weight_btagsf_light_UP_loadedGen != entryGeneration) {
+    if (weight_btagsf_light_UP_flat.IsActive()) {
+      weight_btagsf_light_UP_ = weight_btagsf_light_UP_flat.Get(index);
+    } else if (weight_btagsf_light_UP_bulk != 0) {
+      weight_btagsf_light_UP_ = weight_btagsf_light_UP_bulk->Get<float>(index);
+    } else if (weight_btagsf_light_UP_branch != 0) {
       weight_btagsf_light_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_btagsf_light_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_light_UP_isLoaded = true;
+    weight_btagsf_light_UP_loadedGen = entryGeneration;
   }
   return weight_btagsf_light_UP_;
 }
 
 const float &StopTree::weight_btagsf_heavy_DN() {
-  if (not weight_btagsf_heavy_DN_isLoaded) {
-    if (weight_btagsf_heavy_DN_branch != 0) {
+  if (weight_btagsf_heavy_DN_loadedGen != entryGeneration) {
+    if (weight_btagsf_heavy_DN_flat.IsActive()) {
+      weight_btagsf_heavy_DN_ = weight_btagsf_heavy_DN_flat.Get(index);
+    } else if (weight_btagsf_heavy_DN_bulk != 0) {
+      weight_btagsf_heavy_DN_ = weight_btagsf_heavy_DN_bulk->Get<float>(index);
+    } else if (weight_btagsf_heavy_DN_branch != 0) {
       weight_btagsf_heavy_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_btagsf_heavy_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_heavy_DN_isLoaded = true;
+    weight_btagsf_heavy_DN_loadedGen = entryGeneration;
   }
   return weight_btagsf_heavy_DN_;
 }
 
 const float &StopTree::weight_btagsf_light_DN() {
-  if (not weight_btagsf_light_DN_isLoaded) {
-    if (weight_btagsf_light_DN_branch != 0) {
+  if (weight_btagsf_light_DN_loadedGen != entryGeneration) {
+    if (weight_btagsf_light_DN_flat.IsActive()) {
+      weight_btagsf_light_DN_ = weight_btagsf_light_DN_flat.Get(index);
+    } else if (weight_btagsf_light_DN_bulk != 0) {
+      weight_btagsf_light_DN_ = weight_btagsf_light_DN_bulk->Get<float>(index);
+    } else if (weight_btagsf_light_DN_branch != 0) {
       weight_btagsf_light_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_btagsf_light_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_light_DN_isLoaded = true;
+    weight_btagsf_light_DN_loadedGen = entryGeneration;
   }
   return weight_btagsf_light_DN_;
 }
 
 const float &StopTree::weight_btagsf_fastsim_UP() {
-  if (not weight_btagsf_fastsim_UP_isLoaded) {
-    if (weight_btagsf_fastsim_UP_branch != 0) {
+  if (weight_btagsf_fastsim_UP_loadedGen != entryGeneration) {
+    if (weight_btagsf_fastsim_UP_flat.IsActive()) {
+      weight_btagsf_fastsim_UP_ = weight_btagsf_fastsim_UP_flat.Get(index);
+    } else if (weight_btagsf_fastsim_UP_bulk != 0) {
+      weight_btagsf_fastsim_UP_ = weight_btagsf_fastsim_UP_bulk->Get<float>(index);
+    } else if (weight_btagsf_fastsim_UP_branch != 0) {
       weight_btagsf_fastsim_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_btagsf_fastsim_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_fastsim_UP_isLoaded = true;
+    weight_btagsf_fastsim_UP_loadedGen = entryGeneration;
   }
   return weight_btagsf_fastsim_UP_;
 }
 
 const float &StopTree::weight_btagsf_fastsim_DN() {
-  if (not weight_btagsf_fastsim_DN_isLoaded) {
-    if (weight_btagsf_fastsim_DN_branch != 0) {
+  if (weight_btagsf_fastsim_DN_loadedGen != entryGeneration) {
+    if (weight_btagsf_fastsim_DN_flat.IsActive()) {
+      weight_btagsf_fastsim_DN_ = weight_btagsf_fastsim_DN_flat.Get(index);
+    } else if (weight_btagsf_fastsim_DN_bulk != 0) {
+      weight_btagsf_fastsim_DN_ = weight_btagsf_fastsim_DN_bulk->Get<float>(index);
+    } else if (weight_btagsf_fastsim_DN_branch != 0) {
       weight_btagsf_fastsim_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_btagsf_fastsim_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_btagsf_fastsim_DN_isLoaded = true;
+    weight_btagsf_fastsim_DN_loadedGen = entryGeneration;
   }
   return weight_btagsf_fastsim_DN_;
 }
 
 const float &StopTree::weight_analysisbtagsf() {
-  if (not weight_analysisbtagsf_isLoaded) {
-    if (weight_analysisbtagsf_branch != 0) {
+  if (weight_analysisbtagsf_loadedGen != entryGeneration) {
+    if (weight_analysisbtagsf_flat.IsActive()) {
+      weight_analysisbtagsf_ = weight_analysisbtagsf_flat.Get(index);
+    } else if (weight_analysisbtagsf_bulk != 0) {
+      weight_analysisbtagsf_ = weight_analysisbtagsf_bulk->Get<float>(index);
+    } else if (weight_analysisbtagsf_branch != 0) {
       weight_analysisbtagsf_branch->GetEntry(index);
     } else {
       printf("branch weight_analysisbtagsf_branch does not exist!\n");
       exit(1);
     }
-    weight_analysisbtagsf_isLoaded = true;
+    weight_analysisbtagsf_loadedGen = entryGeneration;
   }
   return weight_analysisbtagsf_;
 }
 
 const float &StopTree::weight_analysisbtagsf_heavy_UP() {
-  if (not weight_analysisbtagsf_heavy_UP_isLoaded) {
-    if (weight_analysisbtagsf_heavy_UP_branch != 0) {
+  if (weight_analysisbtagsf_heavy_UP_loadedGen != entryGeneration) {
+    if (weight_analysisbtagsf_heavy_UP_flat.IsActive()) {
+      weight_analysisbtagsf_heavy_UP_ = weight_analysisbtagsf_heavy_UP_flat.Get(index);
+    } else if (weight_analysisbtagsf_heavy_UP_bulk != 0) {
+      weight_analysisbtagsf_heavy_UP_ = weight_analysisbtagsf_heavy_UP_bulk->Get<float>(index);
+    } else if (weight_analysisbtagsf_heavy_UP_branch != 0) {
       weight_analysisbtagsf_heavy_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_analysisbtagsf_heavy_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_analysisbtagsf_heavy_UP_isLoaded = true;
+    weight_analysisbtagsf_heavy_UP_loadedGen = entryGeneration;
   }
   return weight_analysisbtagsf_heavy_UP_;
 }
 
 const float &StopTree::weight_analysisbtagsf_light_UP() {
-  if (not weight_analysisbtagsf_light_UP_isLoaded) {
-    if (weight_analysisbtagsf_light_UP_branch != 0) {
+  if (weight_analysisbtagsf_light_UP_loadedGen != entryGeneration) {
+    if (weight_analysisbtagsf_light_UP_flat.IsActive()) {
+      weight_analysisbtagsf_light_UP_ = weight_analysisbtagsf_light_UP_flat.Get(index);
+    } else if (weight_analysisbtagsf_light_UP_bulk != 0) {
+      weight_analysisbtagsf_light_UP_ = weight_analysisbtagsf_light_UP_bulk->Get<float>(index);
+    } else if (weight_analysisbtagsf_light_UP_branch != 0) {
       weight_analysisbtagsf_light_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_analysisbtagsf_light_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_analysisbtagsf_light_UP_isLoaded = true;
+    weight_analysisbtagsf_light_UP_loadedGen = entryGeneration;
   }
   return weight_analysisbtagsf_light_UP_;
 }
 
 const float &StopTree::weight_analysisbtagsf_heavy_DN() {
-  if (not weight_analysisbtagsf_heavy_DN_isLoaded) {
-    if (weight_analysisbtagsf_heavy_DN_branch != 0) {
+  if (weight_analysisbtagsf_heavy_DN_loadedGen != entryGeneration) {
+    if (weight_analysisbtagsf_heavy_DN_flat.IsActive()) {
+      weight_analysisbtagsf_heavy_DN_ = weight_analysisbtagsf_heavy_DN_flat.Get(index);
+    } else if (weight_analysisbtagsf_heavy_DN_bulk != 0) {
+      weight_analysisbtagsf_heavy_DN_ = weight_analysisbtagsf_heavy_DN_bulk->Get<float>(index);
+    } else if (weight_analysisbtagsf_heavy_DN_branch != 0) {
       weight_analysisbtagsf_heavy_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_analysisbtagsf_heavy_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_analysisbtagsf_heavy_DN_isLoaded = true;
+    weight_analysisbtagsf_heavy_DN_loadedGen = entryGeneration;
   }
   return weight_analysisbtagsf_heavy_DN_;
 }
 
 const float &StopTree::weight_analysisbtagsf_light_DN() {
-  if (not weight_analysisbtagsf_light_DN_isLoaded) {
-    if (weight_analysisbtagsf_light_DN_branch != 0) {
+  if (weight_analysisbtagsf_light_DN_loadedGen != entryGeneration) {
+    if (weight_analysisbtagsf_light_DN_flat.IsActive()) {
+      weight_analysisbtagsf_light_DN_ = weight_analysisbtagsf_light_DN_flat.Get(index);
+    } else if (weight_analysisbtagsf_light_DN_bulk != 0) {
+      weight_analysisbtagsf_light_DN_ = weight_analysisbtagsf_light_DN_bulk->Get<float>(index);
+    } else if (weight_analysisbtagsf_light_DN_branch != 0) {
       weight_analysisbtagsf_light_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_analysisbtagsf_light_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_analysisbtagsf_light_DN_isLoaded = true;
+    weight_analysisbtagsf_light_DN_loadedGen = entryGeneration;
   }
   return weight_analysisbtagsf_light_DN_;
 }
 
 const float &StopTree::weight_analysisbtagsf_fastsim_UP() {
-  if (not weight_analysisbtagsf_fastsim_UP_isLoaded) {
-    if (weight_analysisbtagsf_fastsim_UP_branch != 0) {
+  if (weight_analysisbtagsf_fastsim_UP_loadedGen != entryGeneration) {
+    if (weight_analysisbtagsf_fastsim_UP_flat.IsActive()) {
+      weight_analysisbtagsf_fastsim_UP_ = weight_analysisbtagsf_fastsim_UP_flat.Get(index);
+    } else if (weight_analysisbtagsf_fastsim_UP_bulk != 0) {
+      weight_analysisbtagsf_fastsim_UP_ = weight_analysisbtagsf_fastsim_UP_bulk->Get<float>(index);
+    } else if (weight_analysisbtagsf_fastsim_UP_branch != 0) {
       weight_analysisbtagsf_fastsim_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_analysisbtagsf_fastsim_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_analysisbtagsf_fastsim_UP_isLoaded = true;
+    weight_analysisbtagsf_fastsim_UP_loadedGen = entryGeneration;
   }
   return weight_analysisbtagsf_fastsim_UP_;
 }
 
 const float &StopTree::weight_analysisbtagsf_fastsim_DN() {
-  if (not weight_analysisbtagsf_fastsim_DN_isLoaded) {
-    if (weight_analysisbtagsf_fastsim_DN_branch != 0) {
+  if (weight_analysisbtagsf_fastsim_DN_loadedGen != entryGeneration) {
+    if (weight_analysisbtagsf_fastsim_DN_flat.IsActive()) {
+      weight_analysisbtagsf_fastsim_DN_ = weight_analysisbtagsf_fastsim_DN_flat.Get(index);
+    } else if (weight_analysisbtagsf_fastsim_DN_bulk != 0) {
+      weight_analysisbtagsf_fastsim_DN_ = weight_analysisbtagsf_fastsim_DN_bulk->Get<float>(index);
+    } else if (weight_analysisbtagsf_fastsim_DN_branch != 0) {
       weight_analysisbtagsf_fastsim_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_analysisbtagsf_fastsim_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_analysisbtagsf_fastsim_DN_isLoaded = true;
+    weight_analysisbtagsf_fastsim_DN_loadedGen = entryGeneration;
   }
   return weight_analysisbtagsf_fastsim_DN_;
 }
 
 const float &StopTree::weight_tightbtagsf() {
-  if (not weight_tightbtagsf_isLoaded) {
-    if (weight_tightbtagsf_branch != 0) {
+  if (weight_tightbtagsf_loadedGen != entryGeneration) {
+    if (weight_tightbtagsf_flat.IsActive()) {
+      weight_tightbtagsf_ = weight_tightbtagsf_flat.Get(index);
+    } else if (weight_tightbtagsf_bulk != 0) {
+      weight_tightbtagsf_ = weight_tightbtagsf_bulk->Get<float>(index);
+    } else if (weight_tightbtagsf_branch != 0) {
       weight_tightbtagsf_branch->GetEntry(index);
     } else {
       printf("branch weight_tightbtagsf_branch does not exist!\n");
       exit(1);
     }
-    weight_tightbtagsf_isLoaded = true;
+    weight_tightbtagsf_loadedGen = entryGeneration;
   }
   return weight_tightbtagsf_;
 }
 
 const float &StopTree::weight_tightbtagsf_heavy_UP() {
-  if (not weight_tightbtagsf_heavy_UP_isLoaded) {
-    if (weight_tightbtagsf_heavy_UP_branch != 0) {
+  if (weight_tightbtagsf_heavy_UP_loadedGen != entryGeneration) {
+    if (weight_tightbtagsf_heavy_UP_flat.IsActive()) {
+      weight_tightbtagsf_heavy_UP_ = weight_tightbtagsf_heavy_UP_flat.Get(index);
+    } else if (weight_tightbtagsf_heavy_UP_bulk != 0) {
+      weight_tightbtagsf_heavy_UP_ = weight_tightbtagsf_heavy_UP_bulk->Get<float>(index);
+    } else if (weight_tightbtagsf_heavy_UP_branch != 0) {
       weight_tightbtagsf_heavy_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_tightbtagsf_heavy_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_tightbtagsf_heavy_UP_isLoaded = true;
+    weight_tightbtagsf_heavy_UP_loadedGen = entryGeneration;
   }
   return weight_tightbtagsf_heavy_UP_;
 }
 
 const float &StopTree::weight_tightbtagsf_light_UP() {
-  if (not weight_tightbtagsf_light_UP_isLoaded) {
-    if (weight_tightbtagsf_light_UP_branch != 0) {
+  if (weight_tightbtagsf_light_UP_loadedGen != entryGeneration) {
+    if (weight_tightbtagsf_light_UP_flat.IsActive()) {
+      weight_tightbtagsf_light_UP_ = weight_tightbtagsf_light_UP_flat.Get(index);
+    } else if (weight_tightbtagsf_light_UP_bulk != 0) {
+      weight_tightbtagsf_light_UP_ = weight_tightbtagsf_light_UP_bulk->Get<float>(index);
+    } else if (weight_tightbtagsf_light_UP_branch != 0) {
       weight_tightbtagsf_light_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_tightbtagsf_light_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_tightbtagsf_light_UP_isLoaded = true;
+    weight_tightbtagsf_light_UP_loadedGen = entryGeneration;
   }
   return weight_tightbtagsf_light_UP_;
 }
 
 const float &StopTree::weight_tightbtagsf_heavy_DN() {
-  if (not weight_tightbtagsf_heavy_DN_isLoaded) {
-    if (weight_tightbtagsf_heavy_DN_branch != 0) {
+  if (weight_tightbtagsf_heavy_DN_loadedGen != entryGeneration) {
+    if (weight_tightbtagsf_heavy_DN_flat.IsActive()) {
+      weight_tightbtagsf_heavy_DN_ = weight_tightbtagsf_heavy_DN_flat.Get(index);
+    } else if (weight_tightbtagsf_heavy_DN_bulk != 0) {
+      weight_tightbtagsf_heavy_DN_ = weight_tightbtagsf_heavy_DN_bulk->Get<float>(index);
+    } else if (weight_tightbtagsf_heavy_DN_branch != 0) {
       weight_tightbtagsf_heavy_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_tightbtagsf_heavy_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_tightbtagsf_heavy_DN_isLoaded = true;
+    weight_tightbtagsf_heavy_DN_loadedGen = entryGeneration;
   }
   return weight_tightbtagsf_heavy_DN_;
 }
 
 const float &StopTree::weight_tightbtagsf_light_DN() {
-  if (not weight_tightbtagsf_light_DN_isLoaded) {
-    if (weight_tightbtagsf_light_DN_branch != 0) {
+  if (weight_tightbtagsf_light_DN_loadedGen != entryGeneration) {
+    if (weight_tightbtagsf_light_DN_flat.IsActive()) {
+      weight_tightbtagsf_light_DN_ = weight_tightbtagsf_light_DN_flat.Get(index);
+    } else if (weight_tightbtagsf_light_DN_bulk != 0) {
+      weight_tightbtagsf_light_DN_ = weight_tightbtagsf_light_DN_bulk->Get<float>(index);
+    } else if (weight_tightbtagsf_light_DN_branch != 0) {
       weight_tightbtagsf_light_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_tightbtagsf_light_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_tightbtagsf_light_DN_isLoaded = true;
+    weight_tightbtagsf_light_DN_loadedGen = entryGeneration;
   }
   return weight_tightbtagsf_light_DN_;
 }
 
 const float &StopTree::weight_tightbtagsf_fastsim_UP() {
-  if (not weight_tightbtagsf_fastsim_UP_isLoaded) {
-    if (weight_tightbtagsf_fastsim_UP_branch != 0) {
+  if (weight_tightbtagsf_fastsim_UP_loadedGen != entryGeneration) {
+    if (weight_tightbtagsf_fastsim_UP_flat.IsActive()) {
+      weight_tightbtagsf_fastsim_UP_ = weight_tightbtagsf_fastsim_UP_flat.Get(index);
+    } else if (weight_tightbtagsf_fastsim_UP_bulk != 0) {
+      weight_tightbtagsf_fastsim_UP_ = weight_tightbtagsf_fastsim_UP_bulk->Get<float>(index);
+    } else if (weight_tightbtagsf_fastsim_UP_branch != 0) {
       weight_tightbtagsf_fastsim_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_tightbtagsf_fastsim_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_tightbtagsf_fastsim_UP_isLoaded = true;
+    weight_tightbtagsf_fastsim_UP_loadedGen = entryGeneration;
   }
   return weight_tightbtagsf_fastsim_UP_;
 }
 
 const float &StopTree::weight_tightbtagsf_fastsim_DN() {
-  if (not weight_tightbtagsf_fastsim_DN_isLoaded) {
-    if (weight_tightbtagsf_fastsim_DN_branch != 0) {
+  if (weight_tightbtagsf_fastsim_DN_loadedGen != entryGeneration) {
+    if (weight_tightbtagsf_fastsim_DN_flat.IsActive()) {
+      weight_tightbtagsf_fastsim_DN_ = weight_tightbtagsf_fastsim_DN_flat.Get(index);
+    } else if (weight_tightbtagsf_fastsim_DN_bulk != 0) {
+      weight_tightbtagsf_fastsim_DN_ = weight_tightbtagsf_fastsim_DN_bulk->Get<float>(index);
+    } else if (weight_tightbtagsf_fastsim_DN_branch != 0) {
       weight_tightbtagsf_fastsim_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_tightbtagsf_fastsim_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_tightbtagsf_fastsim_DN_isLoaded = true;
+    weight_tightbtagsf_fastsim_DN_loadedGen = entryGeneration;
   }
   return weight_tightbtagsf_fastsim_DN_;
 }
 
 const float &StopTree::weight_loosebtagsf() {
-  if (not weight_loosebtagsf_isLoaded) {
-    if (weight_loosebtagsf_branch != 0) {
+  if (weight_loosebtagsf_loadedGen != entryGeneration) {
+    if (weight_loosebtagsf_flat.IsActive()) {
+      weight_loosebtagsf_ = weight_loosebtagsf_flat.Get(index);
+    } else if (weight_loosebtagsf_bulk != 0) {
+      weight_loosebtagsf_ = weight_loosebtagsf_bulk->Get<float>(index);
+    } else if (weight_loosebtagsf_branch != 0) {
       weight_loosebtagsf_branch->GetEntry(index);
     } else {
       printf("branch weight_loosebtagsf_branch does not exist!\n");
       exit(1);
     }
-    weight_loosebtagsf_isLoaded = true;
+    weight_loosebtagsf_loadedGen = entryGeneration;
   }
   return weight_loosebtagsf_;
 }
 
 const float &StopTree::weight_loosebtagsf_heavy_UP() {
-  if (not weight_loosebtagsf_heavy_UP_isLoaded) {
-    if (weight_loosebtagsf_heavy_UP_branch != 0) {
+  if (weight_loosebtagsf_heavy_UP_loadedGen != entryGeneration) {
+    if (weight_loosebtagsf_heavy_UP_flat.IsActive()) {
+      weight_loosebtagsf_heavy_UP_ = weight_loosebtagsf_heavy_UP_flat.Get(index);
+    } else if (weight_loosebtagsf_heavy_UP_bulk != 0) {
+      weight_loosebtagsf_heavy_UP_ = weight_loosebtagsf_heavy_UP_bulk->Get<float>(index);
+    } else if (weight_loosebtagsf_heavy_UP_branch != 0) {
       weight_loosebtagsf_heavy_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_loosebtagsf_heavy_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_loosebtagsf_heavy_UP_isLoaded = true;
+    weight_loosebtagsf_heavy_UP_loadedGen = entryGeneration;
   }
   return weight_loosebtagsf_heavy_UP_;
 }
 
 const float &StopTree::weight_loosebtagsf_light_UP() {
-  if (not weight_loosebtagsf_light_UP_isLoaded) {
-    if (weight_loosebtagsf_light_UP_branch != 0) {
+  if (weight_loosebtagsf_light_UP_loadedGen != entryGeneration) {
+    if (weight_loosebtagsf_light_UP_flat.IsActive()) {
+      weight_loosebtagsf_light_UP_ = weight_loosebtagsf_light_UP_flat.Get(index);
+    } else if (weight_loosebtagsf_light_UP_bulk != 0) {
+      weight_loosebtagsf_light_UP_ = weight_loosebtagsf_light_UP_bulk->Get<float>(index);
+    } else if (weight_loosebtagsf_light_UP_branch != 0) {
       weight_loosebtagsf_light_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_loosebtagsf_light_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_loosebtagsf_light_UP_isLoaded = true;
+    weight_loosebtagsf_light_UP_loadedGen = entryGeneration;
   }
   return weight_loosebtagsf_light_UP_;
 }
 
 const float &StopTree::weight_loosebtagsf_heavy_DN() {
-  if (not weight_loosebtagsf_heavy_DN_isLoaded) {
-    if (weight_loosebtagsf_heavy_DN_branch != 0) {
+  if (weight_loosebtagsf_heavy_DN_loadedGen != entryGeneration) {
+    if (weight_loosebtagsf_heavy_DN_flat.IsActive()) {
+      weight_loosebtagsf_heavy_DN_ = weight_loosebtagsf_heavy_DN_flat.Get(index);
+    } else if (weight_loosebtagsf_heavy_DN_bulk != 0) {
+      weight_loosebtagsf_heavy_DN_ = weight_loosebtagsf_heavy_DN_bulk->Get<float>(index);
+    } else if (weight_loosebtagsf_heavy_DN_branch != 0) {
       weight_loosebtagsf_heavy_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_loosebtagsf_heavy_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_loosebtagsf_heavy_DN_isLoaded = true;
+    weight_loosebtagsf_heavy_DN_loadedGen = entryGeneration;
   }
   return weight_loosebtagsf_heavy_DN_;
 }
 
 const float &StopTree::weight_loosebtagsf_light_DN() {
-  if (not weight_loosebtagsf_light_DN_isLoaded) {
-    if (weight_loosebtagsf_light_DN_branch != 0) {
+  if (weight_loosebtagsf_light_DN_loadedGen != entryGeneration) {
+    if (weight_loosebtagsf_light_DN_flat.IsActive()) {
+      weight_loosebtagsf_light_DN_ = weight_loosebtagsf_light_DN_flat.Get(index);
+    } else if (weight_loosebtagsf_light_DN_bulk != 0) {
+      weight_loosebtagsf_light_DN_ = weight_loosebtagsf_light_DN_bulk->Get<float>(index);
+    } else if (weight_loosebtagsf_light_DN_branch != 0) {
       weight_loosebtagsf_light_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_loosebtagsf_light_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_loosebtagsf_light_DN_isLoaded = true;
+    weight_loosebtagsf_light_DN_loadedGen = entryGeneration;
   }
   return weight_loosebtagsf_light_DN_;
 }
 
 const float &StopTree::weight_loosebtagsf_fastsim_UP() {
-  if (not weight_loosebtagsf_fastsim_UP_isLoaded) {
-    if (weight_loosebtagsf_fastsim_UP_branch != 0) {
+  if (weight_loosebtagsf_fastsim_UP_loadedGen != entryGeneration) {
+    if (weight_loosebtagsf_fastsim_UP_flat.IsActive()) {
+      weight_loosebtagsf_fastsim_UP_ = weight_loosebtagsf_fastsim_UP_flat.Get(index);
+    } else if (weight_loosebtagsf_fastsim_UP_bulk != 0) {
+      weight_loosebtagsf_fastsim_UP_ = weight_loosebtagsf_fastsim_UP_bulk->Get<float>(index);
+    } else if (weight_loosebtagsf_fastsim_UP_branch != 0) {
       weight_loosebtagsf_fastsim_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_loosebtagsf_fastsim_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_loosebtagsf_fastsim_UP_isLoaded = true;
+    weight_loosebtagsf_fastsim_UP_loadedGen = entryGeneration;
   }
   return weight_loosebtagsf_fastsim_UP_;
 }
 
 const float &StopTree::weight_loosebtagsf_fastsim_DN() {
-  if (not weight_loosebtagsf_fastsim_DN_isLoaded) {
-    if (weight_loosebtagsf_fastsim_DN_branch != 0) {
+  if (weight_loosebtagsf_fastsim_DN_loadedGen != entryGeneration) {
+    if (weight_loosebtagsf_fastsim_DN_flat.IsActive()) {
+      weight_loosebtagsf_fastsim_DN_ = weight_loosebtagsf_fastsim_DN_flat.Get(index);
+    } else if (weight_loosebtagsf_fastsim_DN_bulk != 0) {
+      weight_loosebtagsf_fastsim_DN_ = weight_loosebtagsf_fastsim_DN_bulk->Get<float>(index);
+    } else if (weight_loosebtagsf_fastsim_DN_branch != 0) {
       weight_loosebtagsf_fastsim_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_loosebtagsf_fastsim_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_loosebtagsf_fastsim_DN_isLoaded = true;
+    weight_loosebtagsf_fastsim_DN_loadedGen = entryGeneration;
   }
   return weight_loosebtagsf_fastsim_DN_;
 }
 
 const float &StopTree::weight_lepSF() {
-  if (not weight_lepSF_isLoaded) {
-    if (weight_lepSF_branch != 0) {
+  if (weight_lepSF_loadedGen != entryGeneration) {
+    if (weight_lepSF_flat.IsActive()) {
+      weight_lepSF_ = weight_lepSF_flat.Get(index);
+    } else if (weight_lepSF_bulk != 0) {
+      weight_lepSF_ = weight_lepSF_bulk->Get<float>(index);
+    } else if (weight_lepSF_branch != 0) {
       weight_lepSF_branch->GetEntry(index);
     } else {
       printf("branch weight_lepSF_branch does not exist!\n");
       exit(1);
     }
-    weight_lepSF_isLoaded = true;
+    weight_lepSF_loadedGen = entryGeneration;
   }
   return weight_lepSF_;
 }
 
 const float &StopTree::weight_lepSF_up() {
-  if (not weight_lepSF_up_isLoaded) {
-    if (weight_lepSF_up_branch != 0) {
+  if (weight_lepSF_up_loadedGen != entryGeneration) {
+    if (weight_lepSF_up_flat.IsActive()) {
+      weight_lepSF_up_ = weight_lepSF_up_flat.Get(index);
+    } else if (weight_lepSF_up_bulk != 0) {
+      weight_lepSF_up_ = weight_lepSF_up_bulk->Get<float>(index);
+    } else if (weight_lepSF_up_branch != 0) {
       weight_lepSF_up_branch->GetEntry(index);
     } else {
       printf("branch weight_lepSF_up_branch does not exist!\n");
       exit(1);
     }
-    weight_lepSF_up_isLoaded = true;
+    weight_lepSF_up_loadedGen = entryGeneration;
   }
   return weight_lepSF_up_;
 }
 
 const float &StopTree::weight_lepSF_down() {
-  if (not weight_lepSF_down_isLoaded) {
-    if (weight_lepSF_down_branch != 0) {
+  if (weight_lepSF_down_loadedGen != entryGeneration) {
+    if (weight_lepSF_down_flat.IsActive()) {
+      weight_lepSF_down_ = weight_lepSF_down_flat.Get(index);
+    } else if (weight_lepSF_down_bulk != 0) {
+      weight_lepSF_down_ = weight_lepSF_down_bulk->Get<float>(index);
+    } else if (weight_lepSF_down_branch != 0) {
       weight_lepSF_down_branch->GetEntry(index);
     } else {
       printf("branch weight_lepSF_down_branch does not exist!\n");
       exit(1);
     }
-    weight_lepSF_down_isLoaded = true;
+    weight_lepSF_down_loadedGen = entryGeneration;
   }
   return weight_lepSF_down_;
 }
 
 const float &StopTree::weight_vetoLepSF() {
-  if (not weight_vetoLepSF_isLoaded) {
-    if (weight_vetoLepSF_branch != 0) {
+  if (weight_vetoLepSF_loadedGen != entryGeneration) {
+    if (weight_vetoLepSF_flat.IsActive()) {
+      weight_vetoLepSF_ = weight_vetoLepSF_flat.Get(index);
+    } else if (weight_vetoLepSF_bulk != 0) {
+      weight_vetoLepSF_ = weight_vetoLepSF_bulk->Get<float>(index);
+    } else if (weight_vetoLepSF_branch != 0) {
       weight_vetoLepSF_branch->GetEntry(index);
     } else {
       printf("branch weight_vetoLepSF_branch does not exist!\n");
       exit(1);
     }
-    weight_vetoLepSF_isLoaded = true;
+    weight_vetoLepSF_loadedGen = entryGeneration;
   }
   return weight_vetoLepSF_;
 }
 
 const float &StopTree::weight_vetoLepSF_up() {
-  if (not weight_vetoLepSF_up_isLoaded) {
-    if (weight_vetoLepSF_up_branch != 0) {
+  if (weight_vetoLepSF_up_loadedGen != entryGeneration) {
+    if (weight_vetoLepSF_up_flat.IsActive()) {
+      weight_vetoLepSF_up_ = weight_vetoLepSF_up_flat.Get(index);
+    } else if (weight_vetoLepSF_up_bulk != 0) {
+      weight_vetoLepSF_up_ = weight_vetoLepSF_up_bulk->Get<float>(index);
+    } else if (weight_vetoLepSF_up_branch != 0) {
       weight_vetoLepSF_up_branch->GetEntry(index);
     } else {
       printf("branch weight_vetoLepSF_up_branch does not exist!\n");
       exit(1);
     }
-    weight_vetoLepSF_up_isLoaded = true;
+    weight_vetoLepSF_up_loadedGen = entryGeneration;
   }
   return weight_vetoLepSF_up_;
 }
 
 const float &StopTree::weight_vetoLepSF_down() {
-  if (not weight_vetoLepSF_down_isLoaded) {
-    if (weight_vetoLepSF_down_branch != 0) {
+  if (weight_vetoLepSF_down_loadedGen != entryGeneration) {
+    if (weight_vetoLepSF_down_flat.IsActive()) {
+      weight_vetoLepSF_down_ = weight_vetoLepSF_down_flat.Get(index);
+    } else if (weight_vetoLepSF_down_bulk != 0) {
+      weight_vetoLepSF_down_ = weight_vetoLepSF_down_bulk->Get<float>(index);
+    } else if (weight_vetoLepSF_down_branch != 0) {
       weight_vetoLepSF_down_branch->GetEntry(index);
     } else {
       printf("branch weight_vetoLepSF_down_branch does not exist!\n");
       exit(1);
     }
-    weight_vetoLepSF_down_isLoaded = true;
+    weight_vetoLepSF_down_loadedGen = entryGeneration;
   }
   return weight_vetoLepSF_down_;
 }
 
 const float &StopTree::weight_lepSF_fastSim() {
-  if (not weight_lepSF_fastSim_isLoaded) {
-    if (weight_lepSF_fastSim_branch != 0) {
+  if (weight_lepSF_fastSim_loadedGen != entryGeneration) {
+    if (weight_lepSF_fastSim_flat.IsActive()) {
+      weight_lepSF_fastSim_ = weight_lepSF_fastSim_flat.Get(index);
+    } else if (weight_lepSF_fastSim_bulk != 0) {
+      weight_lepSF_fastSim_ = weight_lepSF_fastSim_bulk->Get<float>(index);
+    } else if (weight_lepSF_fastSim_branch != 0) {
       weight_lepSF_fastSim_branch->GetEntry(index);
     } else {
       printf("branch weight_lepSF_fastSim_branch does not exist!\n");
       exit(1);
     }
-    weight_lepSF_fastSim_isLoaded = true;
+    weight_lepSF_fastSim_loadedGen = entryGeneration;
   }
   return weight_lepSF_fastSim_;
 }
 
 const float &StopTree::weight_lepSF_fastSim_up() {
-  if (not weight_lepSF_fastSim_up_isLoaded) {
-    if (weight_lepSF_fastSim_up_branch != 0) {
+  if (weight_lepSF_fastSim_up_loadedGen != entryGeneration) {
+    if (weight_lepSF_fastSim_up_flat.IsActive()) {
+      weight_lepSF_fastSim_up_ = weight_lepSF_fastSim_up_flat.Get(index);
+    } else if (weight_lepSF_fastSim_up_bulk != 0) {
+      weight_lepSF_fastSim_up_ = weight_lepSF_fastSim_up_bulk->Get<float>(index);
+    } else if (weight_lepSF_fastSim_up_branch != 0) {
       weight_lepSF_fastSim_up_branch->GetEntry(index);
     } else {
       printf("branch weight_lepSF_fastSim_up_branch does not exist!\n");
       exit(1);
     }
-    weight_lepSF_fastSim_up_isLoaded = true;
+    weight_lepSF_fastSim_up_loadedGen = entryGeneration;
   }
   return weight_lepSF_fastSim_up_;
 }
 
 const float &StopTree::weight_lepSF_fastSim_down() {
-  if (not weight_lepSF_fastSim_down_isLoaded) {
-    if (weight_lepSF_fastSim_down_branch != 0) {
+  if (weight_lepSF_fastSim_down_loadedGen != entryGeneration) {
+    if (weight_lepSF_fastSim_down_flat.IsActive()) {
+      weight_lepSF_fastSim_down_ = weight_lepSF_fastSim_down_flat.Get(index);
+    } else if (weight_lepSF_fastSim_down_bulk != 0) {
+      weight_lepSF_fastSim_down_ = weight_lepSF_fastSim_down_bulk->Get<float>(index);
+    } else if (weight_lepSF_fastSim_down_branch != 0) {
       weight_lepSF_fastSim_down_branch->GetEntry(index);
     } else {
       printf("branch weight_lepSF_fastSim_down_branch does not exist!\n");
       exit(1);
     }
-    weight_lepSF_fastSim_down_isLoaded = true;
+    weight_lepSF_fastSim_down_loadedGen = entryGeneration;
   }
   return weight_lepSF_fastSim_down_;
 }
 
 const float &StopTree::weight_ISR() {
-  if (not weight_ISR_isLoaded) {
-    if (weight_ISR_branch != 0) {
+  if (weight_ISR_loadedGen != entryGeneration) {
+    if (weight_ISR_flat.IsActive()) {
+      weight_ISR_ = weight_ISR_flat.Get(index);
+    } else if (weight_ISR_bulk != 0) {
+      weight_ISR_ = weight_ISR_bulk->Get<float>(index);
+    } else if (weight_ISR_branch != 0) {
       weight_ISR_branch->GetEntry(index);
     } else {
       printf("branch weight_ISR_branch does not exist!\n");
       exit(1);
     }
-    weight_ISR_isLoaded = true;
+    weight_ISR_loadedGen = entryGeneration;
   }
   return weight_ISR_;
 }
 
 const float &StopTree::weight_ISRup() {
-  if (not weight_ISRup_isLoaded) {
-    if (weight_ISRup_branch != 0) {
+  if (weight_ISRup_loadedGen != entryGeneration) {
+    if (weight_ISRup_flat.IsActive()) {
+      weight_ISRup_ = weight_ISRup_flat.Get(index);
+    } else if (weight_ISRup_bulk != 0) {
+      weight_ISRup_ = weight_ISRup_bulk->Get<float>(index);
+    } else if (weight_ISRup_branch != 0) {
       weight_ISRup_branch->GetEntry(index);
     } else {
       printf("branch weight_ISRup_branch does not exist!\n");
       exit(1);
     }
-    weight_ISRup_isLoaded = true;
+    weight_ISRup_loadedGen = entryGeneration;
   }
   return weight_ISRup_;
 }
 
 const float &StopTree::weight_ISRdown() {
-  if (not weight_ISRdown_isLoaded) {
-    if (weight_ISRdown_branch != 0) {
+  if (weight_ISRdown_loadedGen != entryGeneration) {
+    if (weight_ISRdown_flat.IsActive()) {
+      weight_ISRdown_ = weight_ISRdown_flat.Get(index);
+    } else if (weight_ISRdown_bulk != 0) {
+      weight_ISRdown_ = weight_ISRdown_bulk->Get<float>(index);
+    } else if (weight_ISRdown_branch != 0) {
       weight_ISRdown_branch->GetEntry(index);
     } else {
       printf("branch weight_ISRdown_branch does not exist!\n");
       exit(1);
     }
-    weight_ISRdown_isLoaded = true;
+    weight_ISRdown_loadedGen = entryGeneration;
   }
   return weight_ISRdown_;
 }
 
 const float &StopTree::weight_PU() {
-  if (not weight_PU_isLoaded) {
-    if (weight_PU_branch != 0) {
+  if (weight_PU_loadedGen != entryGeneration) {
+    if (weight_PU_flat.IsActive()) {
+      weight_PU_ = weight_PU_flat.Get(index);
+    } else if (weight_PU_bulk != 0) {
+      weight_PU_ = weight_PU_bulk->Get<float>(index);
+    } else if (weight_PU_branch != 0) {
       weight_PU_branch->GetEntry(index);
     } else {
       printf("branch weight_PU_branch does not exist!\n");
       exit(1);
     }
-    weight_PU_isLoaded = true;
+    weight_PU_loadedGen = entryGeneration;
   }
   return weight_PU_;
 }
 
 const float &StopTree::weight_PUup() {
-  if (not weight_PUup_isLoaded) {
-    if (weight_PUup_branch != 0) {
+  if (weight_PUup_loadedGen != entryGeneration) {
+    if (weight_PUup_flat.IsActive()) {
+      weight_PUup_ = weight_PUup_flat.Get(index);
+    } else if (weight_PUup_bulk != 0) {
+      weight_PUup_ = weight_PUup_bulk->Get<float>(index);
+    } else if (weight_PUup_branch != 0) {
       weight_PUup_branch->GetEntry(index);
     } else {
       printf("branch weight_PUup_branch does not exist!\n");
       exit(1);
     }
-    weight_PUup_isLoaded = true;
+    weight_PUup_loadedGen = entryGeneration;
   }
   return weight_PUup_;
 }
 
 const float &StopTree::weight_PUdown() {
-  if (not weight_PUdown_isLoaded) {
-    if (weight_PUdown_branch != 0) {
+  if (weight_PUdown_loadedGen != entryGeneration) {
+    if (weight_PUdown_flat.IsActive()) {
+      weight_PUdown_ = weight_PUdown_flat.Get(index);
+    } else if (weight_PUdown_bulk != 0) {
+      weight_PUdown_ = weight_PUdown_bulk->Get<float>(index);
+    } else if (weight_PUdown_branch != 0) {
       weight_PUdown_branch->GetEntry(index);
     } else {
       printf("branch weight_PUdown_branch does not exist!\n");
       exit(1);
     }
-    weight_PUdown_isLoaded = true;
+    weight_PUdown_loadedGen = entryGeneration;
   }
   return weight_PUdown_;
 }
 
 const float &StopTree::weight_ISRnjets() {
-  if (not weight_ISRnjets_isLoaded) {
-    if (weight_ISRnjets_branch != 0) {
+  if (weight_ISRnjets_loadedGen != entryGeneration) {
+    if (weight_ISRnjets_flat.IsActive()) {
+      weight_ISRnjets_ = weight_ISRnjets_flat.Get(index);
+    } else if (weight_ISRnjets_bulk != 0) {
+      weight_ISRnjets_ = weight_ISRnjets_bulk->Get<float>(index);
+    } else if (weight_ISRnjets_branch != 0) {
       weight_ISRnjets_branch->GetEntry(index);
     } else {
       printf("branch weight_ISRnjets_branch does not exist!\n");
       exit(1);
     }
-    weight_ISRnjets_isLoaded = true;
+    weight_ISRnjets_loadedGen = entryGeneration;
   }
   return weight_ISRnjets_;
 }
 
 const float &StopTree::weight_ISRnjets_UP() {
-  if (not weight_ISRnjets_UP_isLoaded) {
-    if (weight_ISRnjets_UP_branch != 0) {
+  if (weight_ISRnjets_UP_loadedGen != entryGeneration) {
+    if (weight_ISRnjets_UP_flat.IsActive()) {
+      weight_ISRnjets_UP_ = weight_ISRnjets_UP_flat.Get(index);
+    } else if (weight_ISRnjets_UP_bulk != 0) {
+      weight_ISRnjets_UP_ = weight_ISRnjets_UP_bulk->Get<float>(index);
+    } else if (weight_ISRnjets_UP_branch != 0) {
       weight_ISRnjets_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_ISRnjets_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_ISRnjets_UP_isLoaded = true;
+    weight_ISRnjets_UP_loadedGen = entryGeneration;
   }
   return weight_ISRnjets_UP_;
 }
 
 const float &StopTree::weight_ISRnjets_DN() {
-  if (not weight_ISRnjets_DN_isLoaded) {
-    if (weight_ISRnjets_DN_branch != 0) {
+  if (weight_ISRnjets_DN_loadedGen != entryGeneration) {
+    if (weight_ISRnjets_DN_flat.IsActive()) {
+      weight_ISRnjets_DN_ = weight_ISRnjets_DN_flat.Get(index);
+    } else if (weight_ISRnjets_DN_bulk != 0) {
+      weight_ISRnjets_DN_ = weight_ISRnjets_DN_bulk->Get<float>(index);
+    } else if (weight_ISRnjets_DN_branch != 0) {
       weight_ISRnjets_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_ISRnjets_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_ISRnjets_DN_isLoaded = true;
+    weight_ISRnjets_DN_loadedGen = entryGeneration;
   }
   return weight_ISRnjets_DN_;
 }
 
 const float &StopTree::weight_L1prefire() {
-  if (not weight_L1prefire_isLoaded) {
-    if (weight_L1prefire_branch != 0) {
+  if (weight_L1prefire_loadedGen != entryGeneration) {
+    if (weight_L1prefire_flat.IsActive()) {
+      weight_L1prefire_ = weight_L1prefire_flat.Get(index);
+    } else if (weight_L1prefire_bulk != 0) {
+      weight_L1prefire_ = weight_L1prefire_bulk->Get<float>(index);
+    } else if (weight_L1prefire_branch != 0) {
       weight_L1prefire_branch->GetEntry(index);
     } else {
       printf("branch weight_L1prefire_branch does not exist!\n");
       exit(1);
     }
-    weight_L1prefire_isLoaded = true;
+    weight_L1prefire_loadedGen = entryGeneration;
   }
   return weight_L1prefire_;
 }
 
 const float &StopTree::weight_L1prefire_UP() {
-  if (not weight_L1prefire_UP_isLoaded) {
-    if (weight_L1prefire_UP_branch != 0) {
+  if (weight_L1prefire_UP_loadedGen != entryGeneration) {
+    if (weight_L1prefire_UP_flat.IsActive()) {
+      weight_L1prefire_UP_ = weight_L1prefire_UP_flat.Get(index);
+    } else if (weight_L1prefire_UP_bulk != 0) {
+      weight_L1prefire_UP_ = weight_L1prefire_UP_bulk->Get<float>(index);
+    } else if (weight_L1prefire_UP_branch != 0) {
       weight_L1prefire_UP_branch->GetEntry(index);
     } else {
       printf("branch weight_L1prefire_UP_branch does not exist!\n");
       exit(1);
     }
-    weight_L1prefire_UP_isLoaded = true;
+    weight_L1prefire_UP_loadedGen = entryGeneration;
   }
   return weight_L1prefire_UP_;
 }
 
 const float &StopTree::weight_L1prefire_DN() {
-  if (not weight_L1prefire_DN_isLoaded) {
-    if (weight_L1prefire_DN_branch != 0) {
+  if (weight_L1prefire_DN_loadedGen != entryGeneration) {
+    if (weight_L1prefire_DN_flat.IsActive()) {
+      weight_L1prefire_DN_ = weight_L1prefire_DN_flat.Get(index);
+    } else if (weight_L1prefire_DN_bulk != 0) {
+      weight_L1prefire_DN_ = weight_L1prefire_DN_bulk->Get<float>(index);
+    } else if (weight_L1prefire_DN_branch != 0) {
       weight_L1prefire_DN_branch->GetEntry(index);
     } else {
       printf("branch weight_L1prefire_DN_branch does not exist!\n");
       exit(1);
     }
-    weight_L1prefire_DN_isLoaded = true;
+    weight_L1prefire_DN_loadedGen = entryGeneration;
   }
   return weight_L1prefire_DN_;
 }
 
 const int &StopTree::NISRjets() {
-  if (not NISRjets_isLoaded) {
-    if (NISRjets_branch != 0) {
+  if (NISRjets_loadedGen != entryGeneration) {
+    if (NISRjets_flat.IsActive()) {
+      NISRjets_ = NISRjets_flat.Get(index);
+    } else if (NISRjets_bulk != 0) {
+      NISRjets_ = NISRjets_bulk->Get<int>(index);
+    } else if (NISRjets_branch != 0) {
       NISRjets_branch->GetEntry(index);
     } else {
       printf("branch NISRjets_branch does not exist!\n");
       exit(1);
     }
-    NISRjets_isLoaded = true;
+    NISRjets_loadedGen = entryGeneration;
   }
   return NISRjets_;
 }
 
 const int &StopTree::NnonISRjets() {
-  if (not NnonISRjets_isLoaded) {
-    if (NnonISRjets_branch != 0) {
+  if (NnonISRjets_loadedGen != entryGeneration) {
+    if (NnonISRjets_flat.IsActive()) {
+      NnonISRjets_ = NnonISRjets_flat.Get(index);
+    } else if (NnonISRjets_bulk != 0) {
+      NnonISRjets_ = NnonISRjets_bulk->Get<int>(index);
+    } else if (NnonISRjets_branch != 0) {
       NnonISRjets_branch->GetEntry(index);
     } else {
       printf("branch NnonISRjets_branch does not exist!\n");
       exit(1);
     }
-    NnonISRjets_isLoaded = true;
+    NnonISRjets_loadedGen = entryGeneration;
   }
   return NnonISRjets_;
 }
 
 const vector<string> &StopTree::sparms_names() {
-  if (not sparms_names_isLoaded) {
+  if (sparms_names_loadedGen != entryGeneration) {
     if (sparms_names_branch != 0) {
       sparms_names_branch->GetEntry(index);
     } else {
       printf("branch sparms_names_branch does not exist!\n");
       exit(1);
     }
-    sparms_names_isLoaded = true;
+    sparms_names_loadedGen = entryGeneration;
   }
   return *sparms_names_;
 }
 
 const vector<float> &StopTree::sparms_values() {
-  if (not sparms_values_isLoaded) {
-    if (sparms_values_branch != 0) {
+  if (sparms_values_loadedGen != entryGeneration) {
+    if (sparms_values_flat.IsActive()) {
+      sparms_values_ = sparms_values_flat.Get(index);
+    } else if (sparms_values_branch != 0) {
       sparms_values_branch->GetEntry(index);
     } else {
       printf("branch sparms_values_branch does not exist!\n");
       exit(1);
     }
-    sparms_values_isLoaded = true;
+    sparms_values_loadedGen = entryGeneration;
   }
   return *sparms_values_;
 }
 
 const int &StopTree::sparms_subProcessId() {
-  if (not sparms_subProcessId_isLoaded) {
-    if (sparms_subProcessId_branch != 0) {
+  if (sparms_subProcessId_loadedGen != entryGeneration) {
+    if (sparms_subProcessId_flat.IsActive()) {
+      sparms_subProcessId_ = sparms_subProcessId_flat.Get(index);
+    } else if (sparms_subProcessId_bulk != 0) {
+      sparms_subProcessId_ = sparms_subProcessId_bulk->Get<int>(index);
+    } else if (sparms_subProcessId_branch != 0) {
       sparms_subProcessId_branch->GetEntry(index);
     } else {
       printf("branch sparms_subProcessId_branch does not exist!\n");
       exit(1);
     }
-    sparms_subProcessId_isLoaded = true;
+    sparms_subProcessId_loadedGen = entryGeneration;
   }
   return sparms_subProcessId_;
 }
 
 const float &StopTree::mass_lsp() {
-  if (not mass_lsp_isLoaded) {
-    if (mass_lsp_branch != 0) {
+  if (mass_lsp_loadedGen != entryGeneration) {
+    if (mass_lsp_flat.IsActive()) {
+      mass_lsp_ = mass_lsp_flat.Get(index);
+    } else if (mass_lsp_bulk != 0) {
+      mass_lsp_ = mass_lsp_bulk->Get<float>(index);
+    } else if (mass_lsp_branch != 0) {
       mass_lsp_branch->GetEntry(index);
     } else {
       printf("branch mass_lsp_branch does not exist!\n");
       exit(1);
     }
-    mass_lsp_isLoaded = true;
+    mass_lsp_loadedGen = entryGeneration;
   }
   return mass_lsp_;
 }
 
 const float &StopTree::mass_chargino() {
-  if (not mass_chargino_isLoaded) {
-    if (mass_chargino_branch != 0) {
+  if (mass_chargino_loadedGen != entryGeneration) {
+    if (mass_chargino_flat.IsActive()) {
+      mass_chargino_ = mass_chargino_flat.Get(index);
+    } else if (mass_chargino_bulk != 0) {
+      mass_chargino_ = mass_chargino_bulk->Get<float>(index);
+    } else if (mass_chargino_branch != 0) {
       mass_chargino_branch->GetEntry(index);
     } else {
       printf("branch mass_chargino_branch does not exist!\n");
       exit(1);
     }
-    mass_chargino_isLoaded = true;
+    mass_chargino_loadedGen = entryGeneration;
   }
   return mass_chargino_;
 }
 
 const float &StopTree::mass_stop() {
-  if (not mass_stop_isLoaded) {
-    if (mass_stop_branch != 0) {
+  if (mass_stop_loadedGen != entryGeneration) {
+    if (mass_stop_flat.IsActive()) {
+      mass_stop_ = mass_stop_flat.Get(index);
+    } else if (mass_stop_bulk != 0) {
+      mass_stop_ = mass_stop_bulk->Get<float>(index);
+    } else if (mass_stop_branch != 0) {
       mass_stop_branch->GetEntry(index);
     } else {
       printf("branch mass_stop_branch does not exist!\n");
       exit(1);
     }
-    mass_stop_isLoaded = true;
+    mass_stop_loadedGen = entryGeneration;
   }
   return mass_stop_;
 }
 
 const float &StopTree::mass_gluino() {
-  if (not mass_gluino_isLoaded) {
-    if (mass_gluino_branch != 0) {
+  if (mass_gluino_loadedGen != entryGeneration) {
+    if (mass_gluino_flat.IsActive()) {
+      mass_gluino_ = mass_gluino_flat.Get(index);
+    } else if (mass_gluino_bulk != 0) {
+      mass_gluino_ = mass_gluino_bulk->Get<float>(index);
+    } else if (mass_gluino_branch != 0) {
       mass_gluino_branch->GetEntry(index);
     } else {
       printf("branch mass_gluino_branch does not exist!\n");
       exit(1);
     }
-    mass_gluino_isLoaded = true;
+    mass_gluino_loadedGen = entryGeneration;
   }
   return mass_gluino_;
 }
 
 const float &StopTree::genmet() {
-  if (not genmet_isLoaded) {
-    if (genmet_branch != 0) {
+  if (genmet_loadedGen != entryGeneration) {
+    if (genmet_flat.IsActive()) {
+      genmet_ = genmet_flat.Get(index);
+    } else if (genmet_bulk != 0) {
+      genmet_ = genmet_bulk->Get<float>(index);
+    } else if (genmet_branch != 0) {
       genmet_branch->GetEntry(index);
     } else {
       printf("branch genmet_branch does not exist!\n");
       exit(1);
     }
-    genmet_isLoaded = true;
+    genmet_loadedGen = entryGeneration;
   }
   return genmet_;
 }
 
 const float &StopTree::genmet_phi() {
-  if (not genmet_phi_isLoaded) {
-    if (genmet_phi_branch != 0) {
+  if (genmet_phi_loadedGen != entryGeneration) {
+    if (genmet_phi_flat.IsActive()) {
+      genmet_phi_ = genmet_phi_flat.Get(index);
+    } else if (genmet_phi_bulk != 0) {
+      genmet_phi_ = genmet_phi_bulk->Get<float>(index);
+    } else if (genmet_phi_branch != 0) {
       genmet_phi_branch->GetEntry(index);
     } else {
       printf("branch genmet_phi_branch does not exist!\n");
       exit(1);
     }
-    genmet_phi_isLoaded = true;
+    genmet_phi_loadedGen = entryGeneration;
   }
   return genmet_phi_;
 }
 
 const float &StopTree::nupt() {
-  if (not nupt_isLoaded) {
-    if (nupt_branch != 0) {
+  if (nupt_loadedGen != entryGeneration) {
+    if (nupt_flat.IsActive()) {
+      nupt_ = nupt_flat.Get(index);
+    } else if (nupt_bulk != 0) {
+      nupt_ = nupt_bulk->Get<float>(index);
+    } else if (nupt_branch != 0) {
       nupt_branch->GetEntry(index);
     } else {
       printf("branch nupt_branch does not exist!\n");
       exit(1);
     }
-    nupt_isLoaded = true;
+    nupt_loadedGen = entryGeneration;
   }
   return nupt_;
 }
 
 const float &StopTree::genht() {
-  if (not genht_isLoaded) {
-    if (genht_branch != 0) {
+  if (genht_loadedGen != entryGeneration) {
+    if (genht_flat.IsActive()) {
+      genht_ = genht_flat.Get(index);
+    } else if (genht_bulk != 0) {
+      genht_ = genht_bulk->Get<float>(index);
+    } else if (genht_branch != 0) {
       genht_branch->GetEntry(index);
     } else {
       printf("branch genht_branch does not exist!\n");
       exit(1);
     }
-    genht_isLoaded = true;
+    genht_loadedGen = entryGeneration;
   }
   return genht_;
 }
 
 const bool &StopTree::PassTrackVeto() {
-  if (not PassTrackVeto_isLoaded) {
-    if (PassTrackVeto_branch != 0) {
+  if (PassTrackVeto_loadedGen != entryGeneration) {
+    if (PassTrackVeto_flat.IsActive()) {
+      PassTrackVeto_ = PassTrackVeto_flat.Get(index);
+    } else if (PassTrackVeto_bulk != 0) {
+      PassTrackVeto_ = PassTrackVeto_bulk->Get<bool>(index);
+    } else if (PassTrackVeto_branch != 0) {
       PassTrackVeto_branch->GetEntry(index);
     } else {
       printf("branch PassTrackVeto_branch does not exist!\n");
       exit(1);
     }
-    PassTrackVeto_isLoaded = true;
+    PassTrackVeto_loadedGen = entryGeneration;
   }
   return PassTrackVeto_;
 }
 
 const bool &StopTree::PassTauVeto() {
-  if (not PassTauVeto_isLoaded) {
-    if (PassTauVeto_branch != 0) {
+  if (PassTauVeto_loadedGen != entryGeneration) {
+    if (PassTauVeto_flat.IsActive()) {
+      PassTauVeto_ = PassTauVeto_flat.Get(index);
+    } else if (PassTauVeto_bulk != 0) {
+      PassTauVeto_ = PassTauVeto_bulk->Get<bool>(index);
+    } else if (PassTauVeto_branch != 0) {
       PassTauVeto_branch->GetEntry(index);
     } else {
       printf("branch PassTauVeto_branch does not exist!\n");
       exit(1);
     }
-    PassTauVeto_isLoaded = true;
+    PassTauVeto_loadedGen = entryGeneration;
   }
   return PassTauVeto_;
 }
 
 const float &StopTree::topness() {
-  if (not topness_isLoaded) {
-    if (topness_branch != 0) {
+  if (topness_loadedGen != entryGeneration) {
+    if (topness_flat.IsActive()) {
+      topness_ = topness_flat.Get(index);
+    } else if (topness_bulk != 0) {
+      topness_ = topness_bulk->Get<float>(index);
+    } else if (topness_branch != 0) {
       topness_branch->GetEntry(index);
     } else {
       printf("branch topness_branch does not exist!\n");
       exit(1);
     }
-    topness_isLoaded = true;
+    topness_loadedGen = entryGeneration;
   }
   return topness_;
 }
 
 const float &StopTree::topnessMod() {
-  if (not topnessMod_isLoaded) {
-    if (topnessMod_branch != 0) {
+  if (topnessMod_loadedGen != entryGeneration) {
+    if (topnessMod_flat.IsActive()) {
+      topnessMod_ = topnessMod_flat.Get(index);
+    } else if (topnessMod_bulk != 0) {
+      topnessMod_ = topnessMod_bulk->Get<float>(index);
+    } else if (topnessMod_branch != 0) {
       topnessMod_branch->GetEntry(index);
     } else {
       printf("branch topnessMod_branch does not exist!\n");
       exit(1);
     }
-    topnessMod_isLoaded = true;
+    topnessMod_loadedGen = entryGeneration;
   }
   return topnessMod_;
 }
 
 const float &StopTree::topnessMod_rl() {
-  if (not topnessMod_rl_isLoaded) {
-    if (topnessMod_rl_branch != 0) {
+  if (topnessMod_rl_loadedGen != entryGeneration) {
+    if (topnessMod_rl_flat.IsActive()) {
+      topnessMod_rl_ = topnessMod_rl_flat.Get(index);
+    } else if (topnessMod_rl_bulk != 0) {
+      topnessMod_rl_ = topnessMod_rl_bulk->Get<float>(index);
+    } else if (topnessMod_rl_branch != 0) {
       topnessMod_rl_branch->GetEntry(index);
     } else {
       printf("branch topnessMod_rl_branch does not exist!\n");
       exit(1);
     }
-    topnessMod_rl_isLoaded = true;
+    topnessMod_rl_loadedGen = entryGeneration;
   }
   return topnessMod_rl_;
 }
 
 const float &StopTree::topnessMod_jup() {
-  if (not topnessMod_jup_isLoaded) {
-    if (topnessMod_jup_branch != 0) {
+  if (topnessMod_jup_loadedGen != entryGeneration) {
+    if (topnessMod_jup_flat.IsActive()) {
+      topnessMod_jup_ = topnessMod_jup_flat.Get(index);
+    } else if (topnessMod_jup_bulk != 0) {
+      topnessMod_jup_ = topnessMod_jup_bulk->Get<float>(index);
+    } else if (topnessMod_jup_branch != 0) {
       topnessMod_jup_branch->GetEntry(index);
     } else {
       printf("branch topnessMod_jup_branch does not exist!\n");
       exit(1);
     }
-    topnessMod_jup_isLoaded = true;
+    topnessMod_jup_loadedGen = entryGeneration;
   }
   return topnessMod_jup_;
 }
 
 const float &StopTree::topnessMod_rl_jup() {
-  if (not topnessMod_rl_jup_isLoaded) {
-    if (topnessMod_rl_jup_branch != 0) {
+  if (topnessMod_rl_jup_loadedGen != entryGeneration) {
+    if (topnessMod_rl_jup_flat.IsActive()) {
+      topnessMod_rl_jup_ = topnessMod_rl_jup_flat.Get(index);
+    } else if (topnessMod_rl_jup_bulk != 0) {
+      topnessMod_rl_jup_ = topnessMod_rl_jup_bulk->Get<float>(index);
+    } else if (topnessMod_rl_jup_branch != 0) {
       topnessMod_rl_jup_branch->GetEntry(index);
     } else {
       printf("branch topnessMod_rl_jup_branch does not exist!\n");
       exit(1);
     }
-    topnessMod_rl_jup_isLoaded = true;
+    topnessMod_rl_jup_loadedGen = entryGeneration;
   }
   return topnessMod_rl_jup_;
 }
 
 const float &StopTree::topnessMod_jdown() {
-  if (not topnessMod_jdown_isLoaded) {
-    if (topnessMod_jdown_branch != 0) {
+  if (topnessMod_jdown_loadedGen != entryGeneration) {
+    if (topnessMod_jdown_flat.IsActive()) {
+      topnessMod_jdown_ = topnessMod_jdown_flat.Get(index);
+    } else if (topnessMod_jdown_bulk != 0) {
+      topnessMod_jdown_ = topnessMod_jdown_bulk->Get<float>(index);
+    } else if (topnessMod_jdown_branch != 0) {
       topnessMod_jdown_branch->GetEntry(index);
     } else {
       printf("branch topnessMod_jdown_branch does not exist!\n");
       exit(1);
     }
-    topnessMod_jdown_isLoaded = true;
+    topnessMod_jdown_loadedGen = entryGeneration;
   }
   return topnessMod_jdown_;
 }
 
 const float &StopTree::topnessMod_rl_jdown() {
-  if (not topnessMod_rl_jdown_isLoaded) {
-    if (topnessMod_rl_jdown_branch != 0) {
+  if (topnessMod_rl_jdown_loadedGen != entryGeneration) {
+    if (topnessMod_rl_jdown_flat.IsActive()) {
+      topnessMod_rl_jdown_ = topnessMod_rl_jdown_flat.Get(index);
+    } else if (topnessMod_rl_jdown_bulk != 0) {
+      topnessMod_rl_jdown_ = topnessMod_rl_jdown_bulk->Get<float>(index);
+    } else if (topnessMod_rl_jdown_branch != 0) {
       topnessMod_rl_jdown_branch->GetEntry(index);
     } else {
       printf("branch topnessMod_rl_jdown_branch does not exist!\n");
       exit(1);
     }
-    topnessMod_rl_jdown_isLoaded = true;
+    topnessMod_rl_jdown_loadedGen = entryGeneration;
   }
   return topnessMod_rl_jdown_;
 }
 
 const float &StopTree::Mlb_closestb() {
-  if (not Mlb_closestb_isLoaded) {
-    if (Mlb_closestb_branch != 0) {
+  if (Mlb_closestb_loadedGen != entryGeneration) {
+    if (Mlb_closestb_flat.IsActive()) {
+      Mlb_closestb_ = Mlb_closestb_flat.Get(index);
+    } else if (Mlb_closestb_bulk != 0) {
+      Mlb_closestb_ = Mlb_closestb_bulk->Get<float>(index);
+    } else if (Mlb_closestb_branch != 0) {
       Mlb_closestb_branch->GetEntry(index);
     } else {
       printf("branch Mlb_closestb_branch does not exist!\n");
       exit(1);
     }
-    Mlb_closestb_isLoaded = true;
+    Mlb_closestb_loadedGen = entryGeneration;
   }
   return Mlb_closestb_;
 }
 
 const float &StopTree::Mlb_lead_bdiscr() {
-  if (not Mlb_lead_bdiscr_isLoaded) {
-    if (Mlb_lead_bdiscr_branch != 0) {
+  if (Mlb_lead_bdiscr_loadedGen != entryGeneration) {
+    if (Mlb_lead_bdiscr_flat.IsActive()) {
+      Mlb_lead_bdiscr_ = Mlb_lead_bdiscr_flat.Get(index);
+    } else if (Mlb_lead_bdiscr_bulk != 0) {
+      Mlb_lead_bdiscr_ = Mlb_lead_bdiscr_bulk->Get<float>(index);
+    } else if (Mlb_lead_bdiscr_branch != 0) {
       Mlb_lead_bdiscr_branch->GetEntry(index);
     } else {
       printf("branch Mlb_lead_bdiscr_branch does not exist!\n");
       exit(1);
     }
-    Mlb_lead_bdiscr_isLoaded = true;
+    Mlb_lead_bdiscr_loadedGen = entryGeneration;
   }
   return Mlb_lead_bdiscr_;
 }
 
 const float &StopTree::Mlb_closestb_jup() {
-  if (not Mlb_closestb_jup_isLoaded) {
-    if (Mlb_closestb_jup_branch != 0) {
+  if (Mlb_closestb_jup_loadedGen != entryGeneration) {
+    if (Mlb_closestb_jup_flat.IsActive()) {
+      Mlb_closestb_jup_ = Mlb_closestb_jup_flat.Get(index);
+    } else if (Mlb_closestb_jup_bulk != 0) {
+      Mlb_closestb_jup_ = Mlb_closestb_jup_bulk->Get<float>(index);
+    } else if (Mlb_closestb_jup_branch != 0) {
       Mlb_closestb_jup_branch->GetEntry(index);
     } else {
       printf("branch Mlb_closestb_jup_branch does not exist!\n");
       exit(1);
     }
-    Mlb_closestb_jup_isLoaded = true;
+    Mlb_closestb_jup_loadedGen = entryGeneration;
   }
   return Mlb_closestb_jup_;
 }
 
 const float &StopTree::Mlb_lead_bdiscr_jup() {
-  if (not Mlb_lead_bdiscr_jup_isLoaded) {
-    if (Mlb_lead_bdiscr_jup_branch != 0) {
+  if (Mlb_lead_bdiscr_jup_loadedGen != entryGeneration) {
+    if (Mlb_lead_bdiscr_jup_flat.IsActive()) {
+      Mlb_lead_bdiscr_jup_ = Mlb_lead_bdiscr_jup_flat.Get(index);
+    } else if (Mlb_lead_bdiscr_jup_bulk != 0) {
+      Mlb_lead_bdiscr_jup_ = Mlb_lead_bdiscr_jup_bulk->Get<float>(index);
+    } else if (Mlb_lead_bdiscr_jup_branch != 0) {
       Mlb_lead_bdiscr_jup_branch->GetEntry(index);
     } else {
       printf("branch Mlb_lead_bdiscr_jup_branch does not exist!\n");
       exit(1);
     }
-    Mlb_lead_bdiscr_jup_isLoaded = true;
+    Mlb_lead_bdiscr_jup_loadedGen = entryGeneration;
   }
   return Mlb_lead_bdiscr_jup_;
 }
 
 const float &StopTree::Mlb_closestb_jdown() {
-  if (not Mlb_closestb_jdown_isLoaded) {
-    if (Mlb_closestb_jdown_branch != 0) {
+  if (Mlb_closestb_jdown_loadedGen != entryGeneration) {
+    if (Mlb_closestb_jdown_flat.IsActive()) {
+      Mlb_closestb_jdown_ = Mlb_closestb_jdown_flat.Get(index);
+    } else if (Mlb_closestb_jdown_bulk != 0) {
+      Mlb_closestb_jdown_ = Mlb_closestb_jdown_bulk->Get<float>(index);
+    } else if (Mlb_closestb_jdown_branch != 0) {
       Mlb_closestb_jdown_branch->GetEntry(index);
     } else {
       printf("branch Mlb_closestb_jdown_branch does not exist!\n");
       exit(1);
     }
-    Mlb_closestb_jdown_isLoaded = true;
+    Mlb_closestb_jdown_loadedGen = entryGeneration;
   }
   return Mlb_closestb_jdown_;
 }
 
 const float &StopTree::Mlb_lead_bdiscr_jdown() {
-  if (not Mlb_lead_bdiscr_jdown_isLoaded) {
-    if (Mlb_lead_bdiscr_jdown_branch != 0) {
+  if (Mlb_lead_bdiscr_jdown_loadedGen != entryGeneration) {
+    if (Mlb_lead_bdiscr_jdown_flat.IsActive()) {
+      Mlb_lead_bdiscr_jdown_ = Mlb_lead_bdiscr_jdown_flat.Get(index);
+    } else if (Mlb_lead_bdiscr_jdown_bulk != 0) {
+      Mlb_lead_bdiscr_jdown_ = Mlb_lead_bdiscr_jdown_bulk->Get<float>(index);
+    } else if (Mlb_lead_bdiscr_jdown_branch != 0) {
       Mlb_lead_bdiscr_jdown_branch->GetEntry(index);
     } else {
       printf("branch Mlb_lead_bdiscr_jdown_branch does not exist!\n");
       exit(1);
     }
-    Mlb_lead_bdiscr_jdown_isLoaded = true;
+    Mlb_lead_bdiscr_jdown_loadedGen = entryGeneration;
   }
   return Mlb_lead_bdiscr_jdown_;
 }
 
 const int &StopTree::HLT_SingleEl() {
-  if (not HLT_SingleEl_isLoaded) {
-    if (HLT_SingleEl_branch != 0) {
+  if (HLT_SingleEl_loadedGen != entryGeneration) {
+    if (HLT_SingleEl_flat.IsActive()) {
+      HLT_SingleEl_ = HLT_SingleEl_flat.Get(index);
+    } else if (HLT_SingleEl_bulk != 0) {
+      HLT_SingleEl_ = HLT_SingleEl_bulk->Get<int>(index);
+    } else if (HLT_SingleEl_branch != 0) {
       HLT_SingleEl_branch->GetEntry(index);
     } else {
       printf("branch HLT_SingleEl_branch does not exist!\n");
       exit(1);
     }
-    HLT_SingleEl_isLoaded = true;
+    HLT_SingleEl_loadedGen = entryGeneration;
   }
   return HLT_SingleEl_;
 }
 
 const int &StopTree::HLT_SingleMu() {
-  if (not HLT_SingleMu_isLoaded) {
-    if (HLT_SingleMu_branch != 0) {
+  if (HLT_SingleMu_loadedGen != entryGeneration) {
+    if (HLT_SingleMu_flat.IsActive()) {
+      HLT_SingleMu_ = HLT_SingleMu_flat.Get(index);
+    } else if (HLT_SingleMu_bulk != 0) {
+      HLT_SingleMu_ = HLT_SingleMu_bulk->Get<int>(index);
+    } else if (HLT_SingleMu_branch != 0) {
       HLT_SingleMu_branch->GetEntry(index);
     } else {
       printf("branch HLT_SingleMu_branch does not exist!\n");
       exit(1);
     }
-    HLT_SingleMu_isLoaded = true;
+    HLT_SingleMu_loadedGen = entryGeneration;
   }
   return HLT_SingleMu_;
 }
 
 const int &StopTree::HLT_MET() {
-  if (not HLT_MET_isLoaded) {
-    if (HLT_MET_branch != 0) {
+  if (HLT_MET_loadedGen != entryGeneration) {
+    if (HLT_MET_flat.IsActive()) {
+      HLT_MET_ = HLT_MET_flat.Get(index);
+    } else if (HLT_MET_bulk != 0) {
+      HLT_MET_ = HLT_MET_bulk->Get<int>(index);
+    } else if (HLT_MET_branch != 0) {
       HLT_MET_branch->GetEntry(index);
     } else {
       printf("branch HLT_MET_branch does not exist!\n");
       exit(1);
     }
-    HLT_MET_isLoaded = true;
+    HLT_MET_loadedGen = entryGeneration;
   }
   return HLT_MET_;
 }
 
 const int &StopTree::HLT_MET_MHT() {
-  if (not HLT_MET_MHT_isLoaded) {
-    if (HLT_MET_MHT_branch != 0) {
+  if (HLT_MET_MHT_loadedGen != entryGeneration) {
+    if (HLT_MET_MHT_flat.IsActive()) {
+      HLT_MET_MHT_ = HLT_MET_MHT_flat.Get(index);
+    } else if (HLT_MET_MHT_bulk != 0) {
+      HLT_MET_MHT_ = HLT_MET_MHT_bulk->Get<int>(index);
+    } else if (HLT_MET_MHT_branch != 0) {
       HLT_MET_MHT_branch->GetEntry(index);
     } else {
       printf("branch HLT_MET_MHT_branch does not exist!\n");
       exit(1);
     }
-    HLT_MET_MHT_isLoaded = true;
+    HLT_MET_MHT_loadedGen = entryGeneration;
   }
   return HLT_MET_MHT_;
 }
 
 const int &StopTree::HLT_MET100_MHT100() {
-  if (not HLT_MET100_MHT100_isLoaded) {
-    if (HLT_MET100_MHT100_branch != 0) {
+  if (HLT_MET100_MHT100_loadedGen != entryGeneration) {
+    if (HLT_MET100_MHT100_flat.IsActive()) {
+      HLT_MET100_MHT100_ = HLT_MET100_MHT100_flat.Get(index);
+    } else if (HLT_MET100_MHT100_bulk != 0) {
+      HLT_MET100_MHT100_ = HLT_MET100_MHT100_bulk->Get<int>(index);
+    } else if (HLT_MET100_MHT100_branch != 0) {
       HLT_MET100_MHT100_branch->GetEntry(index);
     } else {
       printf("branch HLT_MET100_MHT100_branch does not exist!\n");
       exit(1);
     }
-    HLT_MET100_MHT100_isLoaded = true;
+    HLT_MET100_MHT100_loadedGen = entryGeneration;
   }
   return HLT_MET100_MHT100_;
 }
 
 const int &StopTree::HLT_MET110_MHT110() {
-  if (not HLT_MET110_MHT110_isLoaded) {
-    if (HLT_MET110_MHT110_branch != 0) {
+  if (HLT_MET110_MHT110_loadedGen != entryGeneration) {
+    if (HLT_MET110_MHT110_flat.IsActive()) {
+      HLT_MET110_MHT110_ = HLT_MET110_MHT110_flat.Get(index);
+    } else if (HLT_MET110_MHT110_bulk != 0) {
+      HLT_MET110_MHT110_ = HLT_MET110_MHT110_bulk->Get<int>(index);
+    } else if (HLT_MET110_MHT110_branch != 0) {
       HLT_MET110_MHT110_branch->GetEntry(index);
     } else {
       printf("branch HLT_MET110_MHT110_branch does not exist!\n");
       exit(1);
     }
-    HLT_MET110_MHT110_isLoaded = true;
+    HLT_MET110_MHT110_loadedGen = entryGeneration;
   }
   return HLT_MET110_MHT110_;
 }
 
 const int &StopTree::HLT_MET120_MHT120() {
-  if (not HLT_MET120_MHT120_isLoaded) {
-    if (HLT_MET120_MHT120_branch != 0) {
+  if (HLT_MET120_MHT120_loadedGen != entryGeneration) {
+    if (HLT_MET120_MHT120_flat.IsActive()) {
+      HLT_MET120_MHT120_ = HLT_MET120_MHT120_flat.Get(index);
+    } else if (HLT_MET120_MHT120_bulk != 0) {
+      HLT_MET120_MHT120_ = HLT_MET120_MHT120_bulk->Get<int>(index);
+    } else if (HLT_MET120_MHT120_branch != 0) {
       HLT_MET120_MHT120_branch->GetEntry(index);
     } else {
       printf("branch HLT_MET120_MHT120_branch does not exist!\n");
       exit(1);
     }
-    HLT_MET120_MHT120_isLoaded = true;
+    HLT_MET120_MHT120_loadedGen = entryGeneration;
   }
   return HLT_MET120_MHT120_;
 }
 
 const int &StopTree::HLT_MET130_MHT130() {
-  if (not HLT_MET130_MHT130_isLoaded) {
-    if (HLT_MET130_MHT130_branch != 0) {
+  if (HLT_MET130_MHT130_loadedGen != entryGeneration) {
+    if (HLT_MET130_MHT130_flat.IsActive()) {
+      HLT_MET130_MHT130_ = HLT_MET130_MHT130_flat.Get(index);
+    } else if (HLT_MET130_MHT130_bulk != 0) {
+      HLT_MET130_MHT130_ = HLT_MET130_MHT130_bulk->Get<int>(index);
+    } else if (HLT_MET130_MHT130_branch != 0) {
       HLT_MET130_MHT130_branch->GetEntry(index);
     } else {
       printf("branch HLT_MET130_MHT130_branch does not exist!\n");
       exit(1);
     }
-    HLT_MET130_MHT130_isLoaded = true;
+    HLT_MET130_MHT130_loadedGen = entryGeneration;
   }
   return HLT_MET130_MHT130_;
 }
 
 const int &StopTree::HLT_PFHT_unprescaled() {
-  if (not HLT_PFHT_unprescaled_isLoaded) {
-    if (HLT_PFHT_unprescaled_branch != 0) {
+  if (HLT_PFHT_unprescaled_loadedGen != entryGeneration) {
+    if (HLT_PFHT_unprescaled_flat.IsActive()) {
+      HLT_PFHT_unprescaled_ = HLT_PFHT_unprescaled_flat.Get(index);
+    } else if (HLT_PFHT_unprescaled_bulk != 0) {
+      HLT_PFHT_unprescaled_ = HLT_PFHT_unprescaled_bulk->Get<int>(index);
+    } else if (HLT_PFHT_unprescaled_branch != 0) {
       HLT_PFHT_unprescaled_branch->GetEntry(index);
     } else {
       printf("branch HLT_PFHT_unprescaled_branch does not exist!\n");
       exit(1);
     }
-    HLT_PFHT_unprescaled_isLoaded = true;
+    HLT_PFHT_unprescaled_loadedGen = entryGeneration;
   }
   return HLT_PFHT_unprescaled_;
 }
 
 const int &StopTree::HLT_PFHT_prescaled() {
-  if (not HLT_PFHT_prescaled_isLoaded) {
-    if (HLT_PFHT_prescaled_branch != 0) {
+  if (HLT_PFHT_prescaled_loadedGen != entryGeneration) {
+    if (HLT_PFHT_prescaled_flat.IsActive()) {
+      HLT_PFHT_prescaled_ = HLT_PFHT_prescaled_flat.Get(index);
+    } else if (HLT_PFHT_prescaled_bulk != 0) {
+      HLT_PFHT_prescaled_ = HLT_PFHT_prescaled_bulk->Get<int>(index);
+    } else if (HLT_PFHT_prescaled_branch != 0) {
       HLT_PFHT_prescaled_branch->GetEntry(index);
     } else {
       printf("branch HLT_PFHT_prescaled_branch does not exist!\n");
       exit(1);
     }
-    HLT_PFHT_prescaled_isLoaded = true;
+    HLT_PFHT_prescaled_loadedGen = entryGeneration;
   }
   return HLT_PFHT_prescaled_;
 }
 
 const int &StopTree::HLT_AK8Jet_unprescaled() {
-  if (not HLT_AK8Jet_unprescaled_isLoaded) {
-    if (HLT_AK8Jet_unprescaled_branch != 0) {
+  if (HLT_AK8Jet_unprescaled_loadedGen != entryGeneration) {
+    if (HLT_AK8Jet_unprescaled_flat.IsActive()) {
+      HLT_AK8Jet_unprescaled_ = HLT_AK8Jet_unprescaled_flat.Get(index);
+    } else if (HLT_AK8Jet_unprescaled_bulk != 0) {
+      HLT_AK8Jet_unprescaled_ = HLT_AK8Jet_unprescaled_bulk->Get<int>(index);
+    } else if (HLT_AK8Jet_unprescaled_branch != 0) {
       HLT_AK8Jet_unprescaled_branch->GetEntry(index);
     } else {
       printf("branch HLT_AK8Jet_unprescaled_branch does not exist!\n");
       exit(1);
     }
-    HLT_AK8Jet_unprescaled_isLoaded = true;
+    HLT_AK8Jet_unprescaled_loadedGen = entryGeneration;
   }
   return HLT_AK8Jet_unprescaled_;
 }
 
 const int &StopTree::HLT_AK8Jet_prescaled() {
-  if (not HLT_AK8Jet_prescaled_isLoaded) {
-    if (HLT_AK8Jet_prescaled_branch != 0) {
+  if (HLT_AK8Jet_prescaled_loadedGen != entryGeneration) {
+    if (HLT_AK8Jet_prescaled_flat.IsActive()) {
+      HLT_AK8Jet_prescaled_ = HLT_AK8Jet_prescaled_flat.Get(index);
+    } else if (HLT_AK8Jet_prescaled_bulk != 0) {
+      HLT_AK8Jet_prescaled_ = HLT_AK8Jet_prescaled_bulk->Get<int>(index);
+    } else if (HLT_AK8Jet_prescaled_branch != 0) {
       HLT_AK8Jet_prescaled_branch->GetEntry(index);
     } else {
       printf("branch HLT_AK8Jet_prescaled_branch does not exist!\n");
       exit(1);
     }
-    HLT_AK8Jet_prescaled_isLoaded = true;
+    HLT_AK8Jet_prescaled_loadedGen = entryGeneration;
   }
   return HLT_AK8Jet_prescaled_;
 }
 
 const int &StopTree::HLT_CaloJet500_NoJetID() {
-  if (not HLT_CaloJet500_NoJetID_isLoaded) {
-    if (HLT_CaloJet500_NoJetID_branch != 0) {
+  if (HLT_CaloJet500_NoJetID_loadedGen != entryGeneration) {
+    if (HLT_CaloJet500_NoJetID_flat.IsActive()) {
+      HLT_CaloJet500_NoJetID_ = HLT_CaloJet500_NoJetID_flat.Get(index);
+    } else if (HLT_CaloJet500_NoJetID_bulk != 0) {
+      HLT_CaloJet500_NoJetID_ = HLT_CaloJet500_NoJetID_bulk->Get<int>(index);
+    } else if (HLT_CaloJet500_NoJetID_branch != 0) {
       HLT_CaloJet500_NoJetID_branch->GetEntry(index);
     } else {
       printf("branch HLT_CaloJet500_NoJetID_branch does not exist!\n");
       exit(1);
     }
-    HLT_CaloJet500_NoJetID_isLoaded = true;
+    HLT_CaloJet500_NoJetID_loadedGen = entryGeneration;
   }
   return HLT_CaloJet500_NoJetID_;
 }
 
 const int &StopTree::HLT_DiEl() {
-  if (not HLT_DiEl_isLoaded) {
-    if (HLT_DiEl_branch != 0) {
+  if (HLT_DiEl_loadedGen != entryGeneration) {
+    if (HLT_DiEl_flat.IsActive()) {
+      HLT_DiEl_ = HLT_DiEl_flat.Get(index);
+    } else if (HLT_DiEl_bulk != 0) {
+      HLT_DiEl_ = HLT_DiEl_bulk->Get<int>(index);
+    } else if (HLT_DiEl_branch != 0) {
       HLT_DiEl_branch->GetEntry(index);
     } else {
       printf("branch HLT_DiEl_branch does not exist!\n");
       exit(1);
     }
-    HLT_DiEl_isLoaded = true;
+    HLT_DiEl_loadedGen = entryGeneration;
   }
   return HLT_DiEl_;
 }
 
 const int &StopTree::HLT_DiMu() {
-  if (not HLT_DiMu_isLoaded) {
-    if (HLT_DiMu_branch != 0) {
+  if (HLT_DiMu_loadedGen != entryGeneration) {
+    if (HLT_DiMu_flat.IsActive()) {
+      HLT_DiMu_ = HLT_DiMu_flat.Get(index);
+    } else if (HLT_DiMu_bulk != 0) {
+      HLT_DiMu_ = HLT_DiMu_bulk->Get<int>(index);
+    } else if (HLT_DiMu_branch != 0) {
       HLT_DiMu_branch->GetEntry(index);
     } else {
       printf("branch HLT_DiMu_branch does not exist!\n");
       exit(1);
     }
-    HLT_DiMu_isLoaded = true;
+    HLT_DiMu_loadedGen = entryGeneration;
   }
   return HLT_DiMu_;
 }
 
 const int &StopTree::HLT_MuE() {
-  if (not HLT_MuE_isLoaded) {
-    if (HLT_MuE_branch != 0) {
+  if (HLT_MuE_loadedGen != entryGeneration) {
+    if (HLT_MuE_flat.IsActive()) {
+      HLT_MuE_ = HLT_MuE_flat.Get(index);
+    } else if (HLT_MuE_bulk != 0) {
+      HLT_MuE_ = HLT_MuE_bulk->Get<int>(index);
+    } else if (HLT_MuE_branch != 0) {
       HLT_MuE_branch->GetEntry(index);
     } else {
       printf("branch HLT_MuE_branch does not exist!\n");
       exit(1);
     }
-    HLT_MuE_isLoaded = true;
+    HLT_MuE_loadedGen = entryGeneration;
   }
   return HLT_MuE_;
 }
 
 const int &StopTree::nPhotons() {
-  if (not nPhotons_isLoaded) {
-    if (nPhotons_branch != 0) {
+  if (nPhotons_loadedGen != entryGeneration) {
+    if (nPhotons_flat.IsActive()) {
+      nPhotons_ = nPhotons_flat.Get(index);
+    } else if (nPhotons_bulk != 0) {
+      nPhotons_ = nPhotons_bulk->Get<int>(index);
+    } else if (nPhotons_branch != 0) {
       nPhotons_branch->GetEntry(index);
     } else {
       printf("branch nPhotons_branch does not exist!\n");
       exit(1);
     }
-    nPhotons_isLoaded = true;
+    nPhotons_loadedGen = entryGeneration;
   }
   return nPhotons_;
 }
 
 const int &StopTree::ph_ngoodjets() {
-  if (not ph_ngoodjets_isLoaded) {
-    if (ph_ngoodjets_branch != 0) {
+  if (ph_ngoodjets_loadedGen != entryGeneration) {
+    if (ph_ngoodjets_flat.IsActive()) {
+      ph_ngoodjets_ = ph_ngoodjets_flat.Get(index);
+    } else if (ph_ngoodjets_bulk != 0) {
+      ph_ngoodjets_ = ph_ngoodjets_bulk->Get<int>(index);
+    } else if (ph_ngoodjets_branch != 0) {
       ph_ngoodjets_branch->GetEntry(index);
     } else {
       printf("branch ph_ngoodjets_branch does not exist!\n");
       exit(1);
     }
-    ph_ngoodjets_isLoaded = true;
+    ph_ngoodjets_loadedGen = entryGeneration;
   }
   return ph_ngoodjets_;
 }
 
 const int &StopTree::ph_ngoodbtags() {
-  if (not ph_ngoodbtags_isLoaded) {
-    if (ph_ngoodbtags_branch != 0) {
+  if (ph_ngoodbtags_loadedGen != entryGeneration) {
+    if (ph_ngoodbtags_flat.IsActive()) {
+      ph_ngoodbtags_ = ph_ngoodbtags_flat.Get(index);
+    } else if (ph_ngoodbtags_bulk != 0) {
+      ph_ngoodbtags_ = ph_ngoodbtags_bulk->Get<int>(index);
+    } else if (ph_ngoodbtags_branch != 0) {
       ph_ngoodbtags_branch->GetEntry(index);
     } else {
       printf("branch ph_ngoodbtags_branch does not exist!\n");
       exit(1);
     }
-    ph_ngoodbtags_isLoaded = true;
+    ph_ngoodbtags_loadedGen = entryGeneration;
   }
   return ph_ngoodbtags_;
 }
 
 const float &StopTree::hardgenpt() {
-  if (not hardgenpt_isLoaded) {
-    if (hardgenpt_branch != 0) {
+  if (hardgenpt_loadedGen != entryGeneration) {
+    if (hardgenpt_flat.IsActive()) {
+      hardgenpt_ = hardgenpt_flat.Get(index);
+    } else if (hardgenpt_bulk != 0) {
+      hardgenpt_ = hardgenpt_bulk->Get<float>(index);
+    } else if (hardgenpt_branch != 0) {
       hardgenpt_branch->GetEntry(index);
     } else {
       printf("branch hardgenpt_branch does not exist!\n");
       exit(1);
     }
-    hardgenpt_isLoaded = true;
+    hardgenpt_loadedGen = entryGeneration;
   }
   return hardgenpt_;
 }
 
 const float &StopTree::calomet() {
-  if (not calomet_isLoaded) {
-    if (calomet_branch != 0) {
+  if (calomet_loadedGen != entryGeneration) {
+    if (calomet_flat.IsActive()) {
+      calomet_ = calomet_flat.Get(index);
+    } else if (calomet_bulk != 0) {
+      calomet_ = calomet_bulk->Get<float>(index);
+    } else if (calomet_branch != 0) {
       calomet_branch->GetEntry(index);
     } else {
       printf("branch calomet_branch does not exist!\n");
       exit(1);
     }
-    calomet_isLoaded = true;
+    calomet_loadedGen = entryGeneration;
   }
   return calomet_;
 }
 
 const float &StopTree::calomet_phi() {
-  if (not calomet_phi_isLoaded) {
-    if (calomet_phi_branch != 0) {
+  if (calomet_phi_loadedGen != entryGeneration) {
+    if (calomet_phi_flat.IsActive()) {
+      calomet_phi_ = calomet_phi_flat.Get(index);
+    } else if (calomet_phi_bulk != 0) {
+      calomet_phi_ = calomet_phi_bulk->Get<float>(index);
+    } else if (calomet_phi_branch != 0) {
       calomet_phi_branch->GetEntry(index);
     } else {
       printf("branch calomet_phi_branch does not exist!\n");
       exit(1);
     }
-    calomet_phi_isLoaded = true;
+    calomet_phi_loadedGen = entryGeneration;
   }
   return calomet_phi_;
 }
 
 const int &StopTree::lep1_pdgid() {
-  if (not lep1_pdgid_isLoaded) {
-    if (lep1_pdgid_branch != 0) {
+  if (lep1_pdgid_loadedGen != entryGeneration) {
+    if (lep1_pdgid_flat.IsActive()) {
+      lep1_pdgid_ = lep1_pdgid_flat.Get(index);
+    } else if (lep1_pdgid_bulk != 0) {
+      lep1_pdgid_ = lep1_pdgid_bulk->Get<int>(index);
+    } else if (lep1_pdgid_branch != 0) {
       lep1_pdgid_branch->GetEntry(index);
     } else {
       printf("branch lep1_pdgid_branch does not exist!\n");
       exit(1);
     }
-    lep1_pdgid_isLoaded = true;
+    lep1_pdgid_loadedGen = entryGeneration;
   }
   return lep1_pdgid_;
 }
 
 const int &StopTree::lep1_production_type() {
-  if (not lep1_production_type_isLoaded) {
-    if (lep1_production_type_branch != 0) {
+  if (lep1_production_type_loadedGen != entryGeneration) {
+    if (lep1_production_type_flat.IsActive()) {
+      lep1_production_type_ = lep1_production_type_flat.Get(index);
+    } else if (lep1_production_type_bulk != 0) {
+      lep1_production_type_ = lep1_production_type_bulk->Get<int>(index);
+    } else if (lep1_production_type_branch != 0) {
       lep1_production_type_branch->GetEntry(index);
     } else {
       printf("branch lep1_production_type_branch does not exist!\n");
       exit(1);
     }
-    lep1_production_type_isLoaded = true;
+    lep1_production_type_loadedGen = entryGeneration;
   }
   return lep1_production_type_;
 }
 
 const float &StopTree::lep1_MiniIso() {
-  if (not lep1_MiniIso_isLoaded) {
-    if (lep1_MiniIso_branch != 0) {
+  if (lep1_MiniIso_loadedGen != entryGeneration) {
+    if (lep1_MiniIso_flat.IsActive()) {
+      lep1_MiniIso_ = lep1_MiniIso_flat.Get(index);
+    } else if (lep1_MiniIso_bulk != 0) {
+      lep1_MiniIso_ = lep1_MiniIso_bulk->Get<float>(index);
+    } else if (lep1_MiniIso_branch != 0) {
       lep1_MiniIso_branch->GetEntry(index);
     } else {
       printf("branch lep1_MiniIso_branch does not exist!\n");
       exit(1);
     }
-    lep1_MiniIso_isLoaded = true;
+    lep1_MiniIso_loadedGen = entryGeneration;
   }
   return lep1_MiniIso_;
 }
 
 const float &StopTree::lep1_relIso() {
-  if (not lep1_relIso_isLoaded) {
-    if (lep1_relIso_branch != 0) {
+  if (lep1_relIso_loadedGen != entryGeneration) {
+    if (lep1_relIso_flat.IsActive()) {
+      lep1_relIso_ = lep1_relIso_flat.Get(index);
+    } else if (lep1_relIso_bulk != 0) {
+      lep1_relIso_ = lep1_relIso_bulk->Get<float>(index);
+    } else if (lep1_relIso_branch != 0) {
       lep1_relIso_branch->GetEntry(index);
     } else {
       printf("branch lep1_relIso_branch does not exist!\n");
       exit(1);
     }
-    lep1_relIso_isLoaded = true;
+    lep1_relIso_loadedGen = entryGeneration;
   }
   return lep1_relIso_;
 }
 
 const bool &StopTree::lep1_passLooseID() {
-  if (not lep1_passLooseID_isLoaded) {
-    if (lep1_passLooseID_branch != 0) {
+  if (lep1_passLooseID_loadedGen != entryGeneration) {
+    if (lep1_passLooseID_flat.IsActive()) {
+      lep1_passLooseID_ = lep1_passLooseID_flat.Get(index);
+    } else if (lep1_passLooseID_bulk != 0) {
+      lep1_passLooseID_ = lep1_passLooseID_bulk->Get<bool>(index);
+    } else if (lep1_passLooseID_branch != 0) {
       lep1_passLooseID_branch->GetEntry(index);
     } else {
       printf("branch lep1_passLooseID_branch does not exist!\n");
       exit(1);
     }
-    lep1_passLooseID_isLoaded = true;
+    lep1_passLooseID_loadedGen = entryGeneration;
   }
   return lep1_passLooseID_;
 }
 
 const bool &StopTree::lep1_passMediumID() {
-  if (not lep1_passMediumID_isLoaded) {
-    if (lep1_passMediumID_branch != 0) {
+  if (lep1_passMediumID_loadedGen != entryGeneration) {
+    if (lep1_passMediumID_flat.IsActive()) {
+      lep1_passMediumID_ = lep1_passMediumID_flat.Get(index);
+    } else if (lep1_passMediumID_bulk != 0) {
+      lep1_passMediumID_ = lep1_passMediumID_bulk->Get<bool>(index);
+    } else if (lep1_passMediumID_branch != 0) {
       lep1_passMediumID_branch->GetEntry(index);
     } else {
       printf("branch lep1_passMediumID_branch does not exist!\n");
       exit(1);
     }
-    lep1_passMediumID_isLoaded = true;
+    lep1_passMediumID_loadedGen = entryGeneration;
   }
   return lep1_passMediumID_;
 }
 
 const bool &StopTree::lep1_passTightID() {
-  if (not lep1_passTightID_isLoaded) {
-    if (lep1_passTightID_branch != 0) {
+  if (lep1_passTightID_loadedGen != entryGeneration) {
+    if (lep1_passTightID_flat.IsActive()) {
+      lep1_passTightID_ = lep1_passTightID_flat.Get(index);
+    } else if (lep1_passTightID_bulk != 0) {
+      lep1_passTightID_ = lep1_passTightID_bulk->Get<bool>(index);
+    } else if (lep1_passTightID_branch != 0) {
       lep1_passTightID_branch->GetEntry(index);
     } else {
       printf("branch lep1_passTightID_branch does not exist!\n");
       exit(1);
     }
-    lep1_passTightID_isLoaded = true;
+    lep1_passTightID_loadedGen = entryGeneration;
   }
   return lep1_passTightID_;
 }
 
 const bool &StopTree::lep1_passVeto() {
-  if (not lep1_passVeto_isLoaded) {
-    if (lep1_passVeto_branch != 0) {
+  if (lep1_passVeto_loadedGen != entryGeneration) {
+    if (lep1_passVeto_flat.IsActive()) {
+      lep1_passVeto_ = lep1_passVeto_flat.Get(index);
+    } else if (lep1_passVeto_bulk != 0) {
+      lep1_passVeto_ = lep1_passVeto_bulk->Get<bool>(index);
+    } else if (lep1_passVeto_branch != 0) {
       lep1_passVeto_branch->GetEntry(index);
     } else {
       printf("branch lep1_passVeto_branch does not exist!\n");
       exit(1);
     }
-    lep1_passVeto_isLoaded = true;
+    lep1_passVeto_loadedGen = entryGeneration;
   }
   return lep1_passVeto_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &StopTree::lep1_p4() {
-  if (not lep1_p4_isLoaded) {
-    if (lep1_p4_branch != 0) {
+  if (lep1_p4_loadedGen != entryGeneration) {
+    if (lep1_p4_flat.IsActive()) {
+      lep1_p4_ = lep1_p4_flat.Get(index);
+    } else if (lep1_p4_branch != 0) {
       lep1_p4_branch->GetEntry(index);
     } else {
       printf("branch lep1_p4_branch does not exist!\n");
       exit(1);
     }
-    lep1_p4_isLoaded = true;
+    lep1_p4_loadedGen = entryGeneration;
   }
   return *lep1_p4_;
 }
 
+const PolarP4 &StopTree::lep1_p4_polar() {
+  if (lep1_p4_polarGen != entryGeneration) {
+    lep1_p4_polar_.Fill(lep1_p4());
+    lep1_p4_polarGen = entryGeneration;
+  }
+  return lep1_p4_polar_;
+}
+
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &StopTree::lep1_mcp4() {
-  if (not lep1_mcp4_isLoaded) {
-    if (lep1_mcp4_branch != 0) {
+  if (lep1_mcp4_loadedGen != entryGeneration) {
+    if (lep1_mcp4_flat.IsActive()) {
+      lep1_mcp4_ = lep1_mcp4_flat.Get(index);
+    } else if (lep1_mcp4_branch != 0) {
       lep1_mcp4_branch->GetEntry(index);
     } else {
       printf("branch lep1_mcp4_branch does not exist!\n");
       exit(1);
     }
-    lep1_mcp4_isLoaded = true;
+    lep1_mcp4_loadedGen = entryGeneration;
   }
   return *lep1_mcp4_;
 }
 
+const PolarP4 &StopTree::lep1_mcp4_polar() {
+  if (lep1_mcp4_polarGen != entryGeneration) {
+    lep1_mcp4_polar_.Fill(lep1_mcp4());
+    lep1_mcp4_polarGen = entryGeneration;
+  }
+  return lep1_mcp4_polar_;
+}
+
 const int &StopTree::lep1_mc_motherid() {
-  if (not lep1_mc_motherid_isLoaded) {
-    if (lep1_mc_motherid_branch != 0) {
+  if (lep1_mc_motherid_loadedGen != entryGeneration) {
+    if (lep1_mc_motherid_flat.IsActive()) {
+      lep1_mc_motherid_ = lep1_mc_motherid_flat.Get(index);
+    } else if (lep1_mc_motherid_bulk != 0) {
+      lep1_mc_motherid_ = lep1_mc_motherid_bulk->Get<int>(index);
+    } else if (lep1_mc_motherid_branch != 0) {
       lep1_mc_motherid_branch->GetEntry(index);
     } else {
       printf("branch lep1_mc_motherid_branch does not exist!\n");
       exit(1);
     }
-    lep1_mc_motherid_isLoaded = true;
+    lep1_mc_motherid_loadedGen = entryGeneration;
   }
   return lep1_mc_motherid_;
 }
 
 const float &StopTree::lep1_etaSC() {
-  if (not lep1_etaSC_isLoaded) {
-    if (lep1_etaSC_branch != 0) {
+  if (lep1_etaSC_loadedGen != entryGeneration) {
+    if (lep1_etaSC_flat.IsActive()) {
+      lep1_etaSC_ = lep1_etaSC_flat.Get(index);
+    } else if (lep1_etaSC_bulk != 0) {
+      lep1_etaSC_ = lep1_etaSC_bulk->Get<float>(index);
+    } else if (lep1_etaSC_branch != 0) {
       lep1_etaSC_branch->GetEntry(index);
     } else {
       printf("branch lep1_etaSC_branch does not exist!\n");
       exit(1);
     }
-    lep1_etaSC_isLoaded = true;
+    lep1_etaSC_loadedGen = entryGeneration;
   }
   return lep1_etaSC_;
 }
 
 const float &StopTree::lep1_dphiMET() {
-  if (not lep1_dphiMET_isLoaded) {
-    if (lep1_dphiMET_branch != 0) {
+  if (lep1_dphiMET_loadedGen != entryGeneration) {
+    if (lep1_dphiMET_flat.IsActive()) {
+      lep1_dphiMET_ = lep1_dphiMET_flat.Get(index);
+    } else if (lep1_dphiMET_bulk != 0) {
+      lep1_dphiMET_ = lep1_dphiMET_bulk->Get<float>(index);
+    } else if (lep1_dphiMET_branch != 0) {
       lep1_dphiMET_branch->GetEntry(index);
     } else {
       printf("branch lep1_dphiMET_branch does not exist!\n");
       exit(1);
     }
-    lep1_dphiMET_isLoaded = true;
+    lep1_dphiMET_loadedGen = entryGeneration;
   }
   return lep1_dphiMET_;
 }
 
 const float &StopTree::lep1_dphiMET_jup() {
-  if (not lep1_dphiMET_jup_isLoaded) {
-    if (lep1_dphiMET_jup_branch != 0) {
+  if (lep1_dphiMET_jup_loadedGen != entryGeneration) {
+    if (lep1_dphiMET_jup_flat.IsActive()) {
+      lep1_dphiMET_jup_ = lep1_dphiMET_jup_flat.Get(index);
+    } else if (lep1_dphiMET_jup_bulk != 0) {
+      lep1_dphiMET_jup_ = lep1_dphiMET_jup_bulk->Get<float>(index);
+    } else if (lep1_dphiMET_jup_branch != 0) {
       lep1_dphiMET_jup_branch->GetEntry(index);
     } else {
       printf("branch lep1_dphiMET_jup_branch does not exist!\n");
       exit(1);
     }
-    lep1_dphiMET_jup_isLoaded = true;
+    lep1_dphiMET_jup_loadedGen = entryGeneration;
   }
   return lep1_dphiMET_jup_;
 }
 
 const float &StopTree::lep1_dphiMET_jdown() {
-  if (not lep1_dphiMET_jdown_isLoaded) {
-    if (lep1_dphiMET_jdown_branch != 0) {
+  if (lep1_dphiMET_jdown_loadedGen != entryGeneration) {
+    if (lep1_dphiMET_jdown_flat.IsActive()) {
+      lep1_dphiMET_jdown_ = lep1_dphiMET_jdown_flat.Get(index);
+    } else if (lep1_dphiMET_jdown_bulk != 0) {
+      lep1_dphiMET_jdown_ = lep1_dphiMET_jdown_bulk->Get<float>(index);
+    } else if (lep1_dphiMET_jdown_branch != 0) {
       lep1_dphiMET_jdown_branch->GetEntry(index);
     } else {
       printf("branch lep1_dphiMET_jdown_branch does not exist!\n");
       exit(1);
     }
-    lep1_dphiMET_jdown_isLoaded = true;
+    lep1_dphiMET_jdown_loadedGen = entryGeneration;
   }
   return lep1_dphiMET_jdown_;
 }
 
 const float &StopTree::lep1_dphiMET_rl() {
-  if (not lep1_dphiMET_rl_isLoaded) {
-    if (lep1_dphiMET_rl_branch != 0) {
+  if (lep1_dphiMET_rl_loadedGen != entryGeneration) {
+    if (lep1_dphiMET_rl_flat.IsActive()) {
+      lep1_dphiMET_rl_ = lep1_dphiMET_rl_flat.Get(index);
+    } else if (lep1_dphiMET_rl_bulk != 0) {
+      lep1_dphiMET_rl_ = lep1_dphiMET_rl_bulk->Get<float>(index);
+    } else if (lep1_dphiMET_rl_branch != 0) {
       lep1_dphiMET_rl_branch->GetEntry(index);
     } else {
       printf("branch lep1_dphiMET_rl_branch does not exist!\n");
       exit(1);
     }
-    lep1_dphiMET_rl_isLoaded = true;
+    lep1_dphiMET_rl_loadedGen = entryGeneration;
   }
   return lep1_dphiMET_rl_;
 }
 
 const float &StopTree::lep1_dphiMET_rl_jup() {
-  if (not lep1_dphiMET_rl_jup_isLoaded) {
-    if (lep1_dphiMET_rl_jup_branch != 0) {
+  if (lep1_dphiMET_rl_jup_loadedGen != entryGeneration) {
+    if (lep1_dphiMET_rl_jup_flat.IsActive()) {
+      lep1_dphiMET_rl_jup_ = lep1_dphiMET_rl_jup_flat.Get(index);
+    } else if (lep1_dphiMET_rl_jup_bulk != 0) {
+      lep1_dphiMET_rl_jup_ = lep1_dphiMET_rl_jup_bulk->Get<float>(index);
+    } else if (lep1_dphiMET_rl_jup_branch != 0) {
       lep1_dphiMET_rl_jup_branch->GetEntry(index);
     } else {
       printf("branch lep1_dphiMET_rl_jup_branch does not exist!\n");
       exit(1);
     }
-    lep1_dphiMET_rl_jup_isLoaded = true;
+    lep1_dphiMET_rl_jup_loadedGen = entryGeneration;
   }
   return lep1_dphiMET_rl_jup_;
 }
 
 const float &StopTree::lep1_dphiMET_rl_jdown() {
-  if (not lep1_dphiMET_rl_jdown_isLoaded) {
-    if (lep1_dphiMET_rl_jdown_branch != 0) {
+  if (lep1_dphiMET_rl_jdown_loadedGen != entryGeneration) {
+    if (lep1_dphiMET_rl_jdown_flat.IsActive()) {
+      lep1_dphiMET_rl_jdown_ = lep1_dphiMET_rl_jdown_flat.Get(index);
+    } else if (lep1_dphiMET_rl_jdown_bulk != 0) {
+      lep1_dphiMET_rl_jdown_ = lep1_dphiMET_rl_jdown_bulk->Get<float>(index);
+    } else if (lep1_dphiMET_rl_jdown_branch != 0) {
       lep1_dphiMET_rl_jdown_branch->GetEntry(index);
     } else {
       printf("branch lep1_dphiMET_rl_jdown_branch does not exist!\n");
       exit(1);
     }
-    lep1_dphiMET_rl_jdown_isLoaded = true;
+    lep1_dphiMET_rl_jdown_loadedGen = entryGeneration;
   }
   return lep1_dphiMET_rl_jdown_;
 }
 
 const int &StopTree::lep2_pdgid() {
-  if (not lep2_pdgid_isLoaded) {
-    if (lep2_pdgid_branch != 0) {
+  if (lep2_pdgid_loadedGen != entryGeneration) {
+    if (lep2_pdgid_flat.IsActive()) {
+      lep2_pdgid_ = lep2_pdgid_flat.Get(index);
+    } else if (lep2_pdgid_bulk != 0) {
+      lep2_pdgid_ = lep2_pdgid_bulk->Get<int>(index);
+    } else if (lep2_pdgid_branch != 0) {
       lep2_pdgid_branch->GetEntry(index);
     } else {
       printf("branch lep2_pdgid_branch does not exist!\n");
       exit(1);
     }
-    lep2_pdgid_isLoaded = true;
+    lep2_pdgid_loadedGen = entryGeneration;
   }
   return lep2_pdgid_;
 }
 
 const int &StopTree::lep2_production_type() {
-  if (not lep2_production_type_isLoaded) {
-    if (lep2_production_type_branch != 0) {
+  if (lep2_production_type_loadedGen != entryGeneration) {
+    if (lep2_production_type_flat.IsActive()) {
+      lep2_production_type_ = lep2_production_type_flat.Get(index);
+    } else if (lep2_production_type_bulk != 0) {
+      lep2_production_type_ = lep2_production_type_bulk->Get<int>(index);
+    } else if (lep2_production_type_branch != 0) {
       lep2_production_type_branch->GetEntry(index);
     } else {
       printf("branch lep2_production_type_branch does not exist!\n");
       exit(1);
     }
-    lep2_production_type_isLoaded = true;
+    lep2_production_type_loadedGen = entryGeneration;
   }
   return lep2_production_type_;
 }
 
 const float &StopTree::lep2_MiniIso() {
-  if (not lep2_MiniIso_isLoaded) {
-    if (lep2_MiniIso_branch != 0) {
+  if (lep2_MiniIso_loadedGen != entryGeneration) {
+    if (lep2_MiniIso_flat.IsActive()) {
+      lep2_MiniIso_ = lep2_MiniIso_flat.Get(index);
+    } else if (lep2_MiniIso_bulk != 0) {
+      lep2_MiniIso_ = lep2_MiniIso_bulk->Get<float>(index);
+    } else if (lep2_MiniIso_branch != 0) {
       lep2_MiniIso_branch->GetEntry(index);
     } else {
       printf("branch lep2_MiniIso_branch does not exist!\n");
       exit(1);
     }
-    lep2_MiniIso_isLoaded = true;
+    lep2_MiniIso_loadedGen = entryGeneration;
   }
   return lep2_MiniIso_;
 }
 
 const float &StopTree::lep2_relIso() {
-  if (not lep2_relIso_isLoaded) {
-    if (lep2_relIso_branch != 0) {
+  if (lep2_relIso_loadedGen != entryGeneration) {
+    if (lep2_relIso_flat.IsActive()) {
+      lep2_relIso_ = lep2_relIso_flat.Get(index);
+    } else if (lep2_relIso_bulk != 0) {
+      lep2_relIso_ = lep2_relIso_bulk->Get<float>(index);
+    } else if (lep2_relIso_branch != 0) {
       lep2_relIso_branch->GetEntry(index);
     } else {
       printf("branch lep2_relIso_branch does not exist!\n");
       exit(1);
     }
-    lep2_relIso_isLoaded = true;
+    lep2_relIso_loadedGen = entryGeneration;
   }
   return lep2_relIso_;
 }
 
 const bool &StopTree::lep2_passLooseID() {
-  if (not lep2_passLooseID_isLoaded) {
-    if (lep2_passLooseID_branch != 0) {
+  if (lep2_passLooseID_loadedGen != entryGeneration) {
+    if (lep2_passLooseID_flat.IsActive()) {
+      lep2_passLooseID_ = lep2_passLooseID_flat.Get(index);
+    } else if (lep2_passLooseID_bulk != 0) {
+      lep2_passLooseID_ = lep2_passLooseID_bulk->Get<bool>(index);
+    } else if (lep2_passLooseID_branch != 0) {
       lep2_passLooseID_branch->GetEntry(index);
     } else {
       printf("branch lep2_passLooseID_branch does not exist!\n");
       exit(1);
     }
-    lep2_passLooseID_isLoaded = true;
+    lep2_passLooseID_loadedGen = entryGeneration;
   }
   return lep2_passLooseID_;
 }
 
 const bool &StopTree::lep2_passMediumID() {
-  if (not lep2_passMediumID_isLoaded) {
-    if (lep2_passMediumID_branch != 0) {
+  if (lep2_passMediumID_loadedGen != entryGeneration) {
+    if (lep2_passMediumID_flat.IsActive()) {
+      lep2_passMediumID_ = lep2_passMediumID_flat.Get(index);
+    } else if (lep2_passMediumID_bulk != 0) {
+      lep2_passMediumID_ = lep2_passMediumID_bulk->Get<bool>(index);
+    } else if (lep2_passMediumID_branch != 0) {
       lep2_passMediumID_branch->GetEntry(index);
     } else {
       printf("branch lep2_passMediumID_branch does not exist!\n");
       exit(1);
     }
-    lep2_passMediumID_isLoaded = true;
+    lep2_passMediumID_loadedGen = entryGeneration;
   }
   return lep2_passMediumID_;
 }
 
 const bool &StopTree::lep2_passTightID() {
-  if (not lep2_passTightID_isLoaded) {
-    if (lep2_passTightID_branch != 0) {
+  if (lep2_passTightID_loadedGen != entryGeneration) {
+    if (lep2_passTightID_flat.IsActive()) {
+      lep2_passTightID_ = lep2_passTightID_flat.Get(index);
+    } else if (lep2_passTightID_bulk != 0) {
+      lep2_passTightID_ = lep2_passTightID_bulk->Get<bool>(index);
+    } else if (lep2_passTightID_branch != 0) {
       lep2_passTightID_branch->GetEntry(index);
     } else {
       printf("branch lep2_passTightID_branch does not exist!\n");
       exit(1);
     }
-    lep2_passTightID_isLoaded = true;
+    lep2_passTightID_loadedGen = entryGeneration;
   }
   return lep2_passTightID_;
 }
 
 const bool &StopTree::lep2_passVeto() {
-  if (not lep2_passVeto_isLoaded) {
-    if (lep2_passVeto_branch != 0) {
+  if (lep2_passVeto_loadedGen != entryGeneration) {
+    if (lep2_passVeto_flat.IsActive()) {
+      lep2_passVeto_ = lep2_passVeto_flat.Get(index);
+    } else if (lep2_passVeto_bulk != 0) {
+      lep2_passVeto_ = lep2_passVeto_bulk->Get<bool>(index);
+    } else if (lep2_passVeto_branch != 0) {
       lep2_passVeto_branch->GetEntry(index);
     } else {
       printf("branch lep2_passVeto_branch does not exist!\n");
       exit(1);
     }
-    lep2_passVeto_isLoaded = true;
+    lep2_passVeto_loadedGen = entryGeneration;
   }
   return lep2_passVeto_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &StopTree::lep2_p4() {
-  if (not lep2_p4_isLoaded) {
-    if (lep2_p4_branch != 0) {
+  if (lep2_p4_loadedGen != entryGeneration) {
+    if (lep2_p4_flat.IsActive()) {
+      lep2_p4_ = lep2_p4_flat.Get(index);
+    } else if (lep2_p4_branch != 0) {
       lep2_p4_branch->GetEntry(index);
     } else {
       printf("branch lep2_p4_branch does not exist!\n");
       exit(1);
     }
-    lep2_p4_isLoaded = true;
+    lep2_p4_loadedGen = entryGeneration;
   }
   return *lep2_p4_;
 }
 
+const PolarP4 &StopTree::lep2_p4_polar() {
+  if (lep2_p4_polarGen != entryGeneration) {
+    lep2_p4_polar_.Fill(lep2_p4());
+    lep2_p4_polarGen = entryGeneration;
+  }
+  return lep2_p4_polar_;
+}
+
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &StopTree::lep2_mcp4() {
-  if (not lep2_mcp4_isLoaded) {
-    if (lep2_mcp4_branch != 0) {
+  if (lep2_mcp4_loadedGen != entryGeneration) {
+    if (lep2_mcp4_flat.IsActive()) {
+      lep2_mcp4_ = lep2_mcp4_flat.Get(index);
+    } else if (lep2_mcp4_branch != 0) {
       lep2_mcp4_branch->GetEntry(index);
     } else {
       printf("branch lep2_mcp4_branch does not exist!\n");
       exit(1);
     }
-    lep2_mcp4_isLoaded = true;
+    lep2_mcp4_loadedGen = entryGeneration;
   }
   return *lep2_mcp4_;
 }
 
+const PolarP4 &StopTree::lep2_mcp4_polar() {
+  if (lep2_mcp4_polarGen != entryGeneration) {
+    lep2_mcp4_polar_.Fill(lep2_mcp4());
+    lep2_mcp4_polarGen = entryGeneration;
+  }
+  return lep2_mcp4_polar_;
+}
+
 const int &StopTree::lep2_mc_motherid() {
-  if (not lep2_mc_motherid_isLoaded) {
-    if (lep2_mc_motherid_branch != 0) {
+  if (lep2_mc_motherid_loadedGen != entryGeneration) {
+    if (lep2_mc_motherid_flat.IsActive()) {
+      lep2_mc_motherid_ = lep2_mc_motherid_flat.Get(index);
+    } else if (lep2_mc_motherid_bulk != 0) {
+      lep2_mc_motherid_ = lep2_mc_motherid_bulk->Get<int>(index);
+    } else if (lep2_mc_motherid_branch != 0) {
       lep2_mc_motherid_branch->GetEntry(index);
     } else {
       printf("branch lep2_mc_motherid_branch does not exist!\n");
       exit(1);
     }
-    lep2_mc_motherid_isLoaded = true;
+    lep2_mc_motherid_loadedGen = entryGeneration;
   }
   return lep2_mc_motherid_;
 }
 
 const float &StopTree::lep2_etaSC() {
-  if (not lep2_etaSC_isLoaded) {
-    if (lep2_etaSC_branch != 0) {
+  if (lep2_etaSC_loadedGen != entryGeneration) {
+    if (lep2_etaSC_flat.IsActive()) {
+      lep2_etaSC_ = lep2_etaSC_flat.Get(index);
+    } else if (lep2_etaSC_bulk != 0) {
+      lep2_etaSC_ = lep2_etaSC_bulk->Get<float>(index);
+    } else if (lep2_etaSC_branch != 0) {
       lep2_etaSC_branch->GetEntry(index);
     } else {
       printf("branch lep2_etaSC_branch does not exist!\n");
       exit(1);
     }
-    lep2_etaSC_isLoaded = true;
+    lep2_etaSC_loadedGen = entryGeneration;
   }
   return lep2_etaSC_;
 }
 
 const float &StopTree::lep2_dphiMET() {
-  if (not lep2_dphiMET_isLoaded) {
-    if (lep2_dphiMET_branch != 0) {
+  if (lep2_dphiMET_loadedGen != entryGeneration) {
+    if (lep2_dphiMET_flat.IsActive()) {
+      lep2_dphiMET_ = lep2_dphiMET_flat.Get(index);
+    } else if (lep2_dphiMET_bulk != 0) {
+      lep2_dphiMET_ = lep2_dphiMET_bulk->Get<float>(index);
+    } else if (lep2_dphiMET_branch != 0) {
       lep2_dphiMET_branch->GetEntry(index);
     } else {
       printf("branch lep2_dphiMET_branch does not exist!\n");
       exit(1);
     }
-    lep2_dphiMET_isLoaded = true;
+    lep2_dphiMET_loadedGen = entryGeneration;
   }
   return lep2_dphiMET_;
 }
 
 const float &StopTree::lep2_dphiMET_jup() {
-  if (not lep2_dphiMET_jup_isLoaded) {
-    if (lep2_dphiMET_jup_branch != 0) {
+  if (lep2_dphiMET_jup_loadedGen != entryGeneration) {
+    if (lep2_dphiMET_jup_flat.IsActive()) {
+      lep2_dphiMET_jup_ = lep2_dphiMET_jup_flat.Get(index);
+    } else if (lep2_dphiMET_jup_bulk != 0) {
+      lep2_dphiMET_jup_ = lep2_dphiMET_jup_bulk->Get<float>(index);
+    } else if (lep2_dphiMET_jup_branch != 0) {
       lep2_dphiMET_jup_branch->GetEntry(index);
     } else {
       printf("branch lep2_dphiMET_jup_branch does not exist!\n");
       exit(1);
     }
-    lep2_dphiMET_jup_isLoaded = true;
+    lep2_dphiMET_jup_loadedGen = entryGeneration;
   }
   return lep2_dphiMET_jup_;
 }
 
 const float &StopTree::lep2_dphiMET_jdown() {
-  if (not lep2_dphiMET_jdown_isLoaded) {
-    if (lep2_dphiMET_jdown_branch != 0) {
+  if (lep2_dphiMET_jdown_loadedGen != entryGeneration) {
+    if (lep2_dphiMET_jdown_flat.IsActive()) {
+      lep2_dphiMET_jdown_ = lep2_dphiMET_jdown_flat.Get(index);
+    } else if (lep2_dphiMET_jdown_bulk != 0) {
+      lep2_dphiMET_jdown_ = lep2_dphiMET_jdown_bulk->Get<float>(index);
+    } else if (lep2_dphiMET_jdown_branch != 0) {
       lep2_dphiMET_jdown_branch->GetEntry(index);
     } else {
       printf("branch lep2_dphiMET_jdown_branch does not exist!\n");
       exit(1);
     }
-    lep2_dphiMET_jdown_isLoaded = true;
+    lep2_dphiMET_jdown_loadedGen = entryGeneration;
   }
   return lep2_dphiMET_jdown_;
 }
 
 const float &StopTree::lep2_dphiMET_rl() {
-  if (not lep2_dphiMET_rl_isLoaded) {
-    if (lep2_dphiMET_rl_branch != 0) {
+  if (lep2_dphiMET_rl_loadedGen != entryGeneration) {
+    if (lep2_dphiMET_rl_flat.IsActive()) {
+      lep2_dphiMET_rl_ = lep2_dphiMET_rl_flat.Get(index);
+    } else if (lep2_dphiMET_rl_bulk != 0) {
+      lep2_dphiMET_rl_ = lep2_dphiMET_rl_bulk->Get<float>(index);
+    } else if (lep2_dphiMET_rl_branch != 0) {
       lep2_dphiMET_rl_branch->GetEntry(index);
     } else {
       printf("branch lep2_dphiMET_rl_branch does not exist!\n");
       exit(1);
     }
-    lep2_dphiMET_rl_isLoaded = true;
+    lep2_dphiMET_rl_loadedGen = entryGeneration;
   }
   return lep2_dphiMET_rl_;
 }
 
 const float &StopTree::lep2_dphiMET_rl_jup() {
-  if (not lep2_dphiMET_rl_jup_isLoaded) {
-    if (lep2_dphiMET_rl_jup_branch != 0) {
+  if (lep2_dphiMET_rl_jup_loadedGen != entryGeneration) {
+    if (lep2_dphiMET_rl_jup_flat.IsActive()) {
+      lep2_dphiMET_rl_jup_ = lep2_dphiMET_rl_jup_flat.Get(index);
+    } else if (lep2_dphiMET_rl_jup_bulk != 0) {
+      lep2_dphiMET_rl_jup_ = lep2_dphiMET_rl_jup_bulk->Get<float>(index);
+    } else if (lep2_dphiMET_rl_jup_branch != 0) {
       lep2_dphiMET_rl_jup_branch->GetEntry(index);
     } else {
       printf("branch lep2_dphiMET_rl_jup_branch does not exist!\n");
       exit(1);
     }
-    lep2_dphiMET_rl_jup_isLoaded = true;
+    lep2_dphiMET_rl_jup_loadedGen = entryGeneration;
   }
   return lep2_dphiMET_rl_jup_;
 }
 
 const float &StopTree::lep2_dphiMET_rl_jdown() {
-  if (not lep2_dphiMET_rl_jdown_isLoaded) {
-    if (lep2_dphiMET_rl_jdown_branch != 0) {
+  if (lep2_dphiMET_rl_jdown_loadedGen != entryGeneration) {
+    if (lep2_dphiMET_rl_jdown_flat.IsActive()) {
+      lep2_dphiMET_rl_jdown_ = lep2_dphiMET_rl_jdown_flat.Get(index);
+    } else if (lep2_dphiMET_rl_jdown_bulk != 0) {
+      lep2_dphiMET_rl_jdown_ = lep2_dphiMET_rl_jdown_bulk->Get<float>(index);
+    } else if (lep2_dphiMET_rl_jdown_branch != 0) {
       lep2_dphiMET_rl_jdown_branch->GetEntry(index);
     } else {
       printf("branch lep2_dphiMET_rl_jdown_branch does not exist!\n");
       exit(1);
     }
-    lep2_dphiMET_rl_jdown_isLoaded = true;
+    lep2_dphiMET_rl_jdown_loadedGen = entryGeneration;
   }
   return lep2_dphiMET_rl_jdown_;
 }
 
 const vector<float> &StopTree::ph_sigmaIEtaEta_fill5x5() {
-  if (not ph_sigmaIEtaEta_fill5x5_isLoaded) {
-    if (ph_sigmaIEtaEta_fill5x5_branch != 0) {
+  if (ph_sigmaIEtaEta_fill5x5_loadedGen != entryGeneration) {
+    if (ph_sigmaIEtaEta_fill5x5_flat.IsActive()) {
+      ph_sigmaIEtaEta_fill5x5_ = ph_sigmaIEtaEta_fill5x5_flat.Get(index);
+    } else if (ph_sigmaIEtaEta_fill5x5_branch != 0) {
       ph_sigmaIEtaEta_fill5x5_branch->GetEntry(index);
     } else {
       printf("branch ph_sigmaIEtaEta_fill5x5_branch does not exist!\n");
       exit(1);
     }
-    ph_sigmaIEtaEta_fill5x5_isLoaded = true;
+    ph_sigmaIEtaEta_fill5x5_loadedGen = entryGeneration;
   }
   return *ph_sigmaIEtaEta_fill5x5_;
 }
 
 const vector<float> &StopTree::ph_hOverE() {
-  if (not ph_hOverE_isLoaded) {
-    if (ph_hOverE_branch != 0) {
+  if (ph_hOverE_loadedGen != entryGeneration) {
+    if (ph_hOverE_flat.IsActive()) {
+      ph_hOverE_ = ph_hOverE_flat.Get(index);
+    } else if (ph_hOverE_branch != 0) {
       ph_hOverE_branch->GetEntry(index);
     } else {
       printf("branch ph_hOverE_branch does not exist!\n");
       exit(1);
     }
-    ph_hOverE_isLoaded = true;
+    ph_hOverE_loadedGen = entryGeneration;
   }
   return *ph_hOverE_;
 }
 
 const vector<float> &StopTree::ph_r9() {
-  if (not ph_r9_isLoaded) {
-    if (ph_r9_branch != 0) {
+  if (ph_r9_loadedGen != entryGeneration) {
+    if (ph_r9_flat.IsActive()) {
+      ph_r9_ = ph_r9_flat.Get(index);
+    } else if (ph_r9_branch != 0) {
       ph_r9_branch->GetEntry(index);
     } else {
       printf("branch ph_r9_branch does not exist!\n");
       exit(1);
     }
-    ph_r9_isLoaded = true;
+    ph_r9_loadedGen = entryGeneration;
   }
   return *ph_r9_;
 }
 
 const vector<float> &StopTree::ph_chiso() {
-  if (not ph_chiso_isLoaded) {
-    if (ph_chiso_branch != 0) {
+  if (ph_chiso_loadedGen != entryGeneration) {
+    if (ph_chiso_flat.IsActive()) {
+      ph_chiso_ = ph_chiso_flat.Get(index);
+    } else if (ph_chiso_branch != 0) {
       ph_chiso_branch->GetEntry(index);
     } else {
       printf("branch ph_chiso_branch does not exist!\n");
       exit(1);
     }
-    ph_chiso_isLoaded = true;
+    ph_chiso_loadedGen = entryGeneration;
   }
   return *ph_chiso_;
 }
 
 const vector<float> &StopTree::ph_nhiso() {
-  if (not ph_nhiso_isLoaded) {
-    if (ph_nhiso_branch != 0) {
+  if (ph_nhiso_loadedGen != entryGeneration) {
+    if (ph_nhiso_flat.IsActive()) {
+      ph_nhiso_ = ph_nhiso_flat.Get(index);
+    } else if (ph_nhiso_branch != 0) {
       ph_nhiso_branch->GetEntry(index);
     } else {
       printf("branch ph_nhiso_branch does not exist!\n");
       exit(1);
     }
-    ph_nhiso_isLoaded = true;
+    ph_nhiso_loadedGen = entryGeneration;
   }
   return *ph_nhiso_;
 }
 
 const vector<float> &StopTree::ph_phiso() {
-  if (not ph_phiso_isLoaded) {
-    if (ph_phiso_branch != 0) {
+  if (ph_phiso_loadedGen != entryGeneration) {
+    if (ph_phiso_flat.IsActive()) {
+      ph_phiso_ = ph_phiso_flat.Get(index);
+    } else if (ph_phiso_branch != 0) {
       ph_phiso_branch->GetEntry(index);
     } else {
       printf("branch ph_phiso_branch does not exist!\n");
       exit(1);
     }
-    ph_phiso_isLoaded = true;
+    ph_phiso_loadedGen = entryGeneration;
   }
   return *ph_phiso_;
 }
 
 const vector<bool> &StopTree::ph_passLooseID() {
-  if (not ph_passLooseID_isLoaded) {
-    if (ph_passLooseID_branch != 0) {
+  if (ph_passLooseID_loadedGen != entryGeneration) {
+    if (ph_passLooseID_flat.IsActive()) {
+      ph_passLooseID_ = ph_passLooseID_flat.Get(index);
+    } else if (ph_passLooseID_branch != 0) {
       ph_passLooseID_branch->GetEntry(index);
     } else {
       printf("branch ph_passLooseID_branch does not exist!\n");
       exit(1);
     }
-    ph_passLooseID_isLoaded = true;
+    ph_passLooseID_loadedGen = entryGeneration;
   }
   return *ph_passLooseID_;
 }
 
 const vector<bool> &StopTree::ph_passMediumID() {
-  if (not ph_passMediumID_isLoaded) {
-    if (ph_passMediumID_branch != 0) {
+  if (ph_passMediumID_loadedGen != entryGeneration) {
+    if (ph_passMediumID_flat.IsActive()) {
+      ph_passMediumID_ = ph_passMediumID_flat.Get(index);
+    } else if (ph_passMediumID_branch != 0) {
       ph_passMediumID_branch->GetEntry(index);
     } else {
       printf("branch ph_passMediumID_branch does not exist!\n");
       exit(1);
     }
-    ph_passMediumID_isLoaded = true;
+    ph_passMediumID_loadedGen = entryGeneration;
   }
   return *ph_passMediumID_;
 }
 
 const vector<bool> &StopTree::ph_passTightID() {
-  if (not ph_passTightID_isLoaded) {
-    if (ph_passTightID_branch != 0) {
+  if (ph_passTightID_loadedGen != entryGeneration) {
+    if (ph_passTightID_flat.IsActive()) {
+      ph_passTightID_ = ph_passTightID_flat.Get(index);
+    } else if (ph_passTightID_branch != 0) {
       ph_passTightID_branch->GetEntry(index);
     } else {
       printf("branch ph_passTightID_branch does not exist!\n");
       exit(1);
     }
-    ph_passTightID_isLoaded = true;
+    ph_passTightID_loadedGen = entryGeneration;
   }
   return *ph_passTightID_;
 }
 
 const vector<int> &StopTree::ph_overlapJetId() {
-  if (not ph_overlapJetId_isLoaded) {
-    if (ph_overlapJetId_branch != 0) {
+  if (ph_overlapJetId_loadedGen != entryGeneration) {
+    if (ph_overlapJetId_flat.IsActive()) {
+      ph_overlapJetId_ = ph_overlapJetId_flat.Get(index);
+    } else if (ph_overlapJetId_branch != 0) {
       ph_overlapJetId_branch->GetEntry(index);
     } else {
       printf("branch ph_overlapJetId_branch does not exist!\n");
       exit(1);
     }
-    ph_overlapJetId_isLoaded = true;
+    ph_overlapJetId_loadedGen = entryGeneration;
   }
   return *ph_overlapJetId_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::ph_p4() {
-  if (not ph_p4_isLoaded) {
-    if (ph_p4_branch != 0) {
+  if (ph_p4_loadedGen != entryGeneration) {
+    if (ph_p4_flat.IsActive()) {
+      ph_p4_ = ph_p4_flat.Get(index);
+    } else if (ph_p4_branch != 0) {
       ph_p4_branch->GetEntry(index);
+    } else if (ph_p4_split.IsActive()) {
+      ph_p4_ = &ph_p4_split.GetP4s(index);
     } else {
       printf("branch ph_p4_branch does not exist!\n");
       exit(1);
     }
-    ph_p4_isLoaded = true;
+    ph_p4_loadedGen = entryGeneration;
   }
   return *ph_p4_;
 }
 
+const PolarArrays &StopTree::ph_p4_polar() {
+  if (ph_p4_polarGen != entryGeneration) {
+    if (ph_p4_branch == 0 && ph_p4_split.IsActive()) ph_p4_split.GetPolar(index, ph_p4_polar_);
+    else ph_p4_polar_.Fill(ph_p4());
+    ph_p4_polarGen = entryGeneration;
+  }
+  return ph_p4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::ph_mcp4() {
-  if (not ph_mcp4_isLoaded) {
-    if (ph_mcp4_branch != 0) {
+  if (ph_mcp4_loadedGen != entryGeneration) {
+    if (ph_mcp4_flat.IsActive()) {
+      ph_mcp4_ = ph_mcp4_flat.Get(index);
+    } else if (ph_mcp4_branch != 0) {
       ph_mcp4_branch->GetEntry(index);
+    } else if (ph_mcp4_split.IsActive()) {
+      ph_mcp4_ = &ph_mcp4_split.GetP4s(index);
     } else {
       printf("branch ph_mcp4_branch does not exist!\n");
       exit(1);
     }
-    ph_mcp4_isLoaded = true;
+    ph_mcp4_loadedGen = entryGeneration;
   }
   return *ph_mcp4_;
 }
 
+const PolarArrays &StopTree::ph_mcp4_polar() {
+  if (ph_mcp4_polarGen != entryGeneration) {
+    if (ph_mcp4_branch == 0 && ph_mcp4_split.IsActive()) ph_mcp4_split.GetPolar(index, ph_mcp4_polar_);
+    else ph_mcp4_polar_.Fill(ph_mcp4());
+    ph_mcp4_polarGen = entryGeneration;
+  }
+  return ph_mcp4_polar_;
+}
+
 const vector<int> &StopTree::ph_mcMatchId() {
-  if (not ph_mcMatchId_isLoaded) {
-    if (ph_mcMatchId_branch != 0) {
+  if (ph_mcMatchId_loadedGen != entryGeneration) {
+    if (ph_mcMatchId_flat.IsActive()) {
+      ph_mcMatchId_ = ph_mcMatchId_flat.Get(index);
+    } else if (ph_mcMatchId_branch != 0) {
       ph_mcMatchId_branch->GetEntry(index);
     } else {
       printf("branch ph_mcMatchId_branch does not exist!\n");
       exit(1);
     }
-    ph_mcMatchId_isLoaded = true;
+    ph_mcMatchId_loadedGen = entryGeneration;
   }
   return *ph_mcMatchId_;
 }
 
 const vector<float> &StopTree::ph_genIso04() {
-  if (not ph_genIso04_isLoaded) {
-    if (ph_genIso04_branch != 0) {
+  if (ph_genIso04_loadedGen != entryGeneration) {
+    if (ph_genIso04_flat.IsActive()) {
+      ph_genIso04_ = ph_genIso04_flat.Get(index);
+    } else if (ph_genIso04_branch != 0) {
       ph_genIso04_branch->GetEntry(index);
     } else {
       printf("branch ph_genIso04_branch does not exist!\n");
       exit(1);
     }
-    ph_genIso04_isLoaded = true;
+    ph_genIso04_loadedGen = entryGeneration;
   }
   return *ph_genIso04_;
 }
 
 const vector<float> &StopTree::ph_drMinParton() {
-  if (not ph_drMinParton_isLoaded) {
-    if (ph_drMinParton_branch != 0) {
+  if (ph_drMinParton_loadedGen != entryGeneration) {
+    if (ph_drMinParton_flat.IsActive()) {
+      ph_drMinParton_ = ph_drMinParton_flat.Get(index);
+    } else if (ph_drMinParton_branch != 0) {
       ph_drMinParton_branch->GetEntry(index);
     } else {
       printf("branch ph_drMinParton_branch does not exist!\n");
       exit(1);
     }
-    ph_drMinParton_isLoaded = true;
+    ph_drMinParton_loadedGen = entryGeneration;
   }
   return *ph_drMinParton_;
 }
 
 const int &StopTree::nskimjets() {
-  if (not nskimjets_isLoaded) {
-    if (nskimjets_branch != 0) {
+  if (nskimjets_loadedGen != entryGeneration) {
+    if (nskimjets_flat.IsActive()) {
+      nskimjets_ = nskimjets_flat.Get(index);
+    } else if (nskimjets_bulk != 0) {
+      nskimjets_ = nskimjets_bulk->Get<int>(index);
+    } else if (nskimjets_branch != 0) {
       nskimjets_branch->GetEntry(index);
     } else {
       printf("branch nskimjets_branch does not exist!\n");
       exit(1);
     }
-    nskimjets_isLoaded = true;
+    nskimjets_loadedGen = entryGeneration;
   }
   return nskimjets_;
 }
 
 const int &StopTree::nskimbtagmed() {
-  if (not nskimbtagmed_isLoaded) {
-    if (nskimbtagmed_branch != 0) {
+  if (nskimbtagmed_loadedGen != entryGeneration) {
+    if (nskimbtagmed_flat.IsActive()) {
+      nskimbtagmed_ = nskimbtagmed_flat.Get(index);
+    } else if (nskimbtagmed_bulk != 0) {
+      nskimbtagmed_ = nskimbtagmed_bulk->Get<int>(index);
+    } else if (nskimbtagmed_branch != 0) {
       nskimbtagmed_branch->GetEntry(index);
     } else {
       printf("branch nskimbtagmed_branch does not exist!\n");
       exit(1);
     }
-    nskimbtagmed_isLoaded = true;
+    nskimbtagmed_loadedGen = entryGeneration;
   }
   return nskimbtagmed_;
 }
 
 const int &StopTree::nskimbtagloose() {
-  if (not nskimbtagloose_isLoaded) {
-    if (nskimbtagloose_branch != 0) {
+  if (nskimbtagloose_loadedGen != entryGeneration) {
+    if (nskimbtagloose_flat.IsActive()) {
+      nskimbtagloose_ = nskimbtagloose_flat.Get(index);
+    } else if (nskimbtagloose_bulk != 0) {
+      nskimbtagloose_ = nskimbtagloose_bulk->Get<int>(index);
+    } else if (nskimbtagloose_branch != 0) {
       nskimbtagloose_branch->GetEntry(index);
     } else {
       printf("branch nskimbtagloose_branch does not exist!\n");
       exit(1);
     }
-    nskimbtagloose_isLoaded = true;
+    nskimbtagloose_loadedGen = entryGeneration;
   }
   return nskimbtagloose_;
 }
 
 const int &StopTree::nskimbtagtight() {
-  if (not nskimbtagtight_isLoaded) {
-    if (nskimbtagtight_branch != 0) {
+  if (nskimbtagtight_loadedGen != entryGeneration) {
+    if (nskimbtagtight_flat.IsActive()) {
+      nskimbtagtight_ = nskimbtagtight_flat.Get(index);
+    } else if (nskimbtagtight_bulk != 0) {
+      nskimbtagtight_ = nskimbtagtight_bulk->Get<int>(index);
+    } else if (nskimbtagtight_branch != 0) {
       nskimbtagtight_branch->GetEntry(index);
     } else {
       printf("branch nskimbtagtight_branch does not exist!\n");
       exit(1);
     }
-    nskimbtagtight_isLoaded = true;
+    nskimbtagtight_loadedGen = entryGeneration;
   }
   return nskimbtagtight_;
 }
 
 const int &StopTree::ngoodjets() {
-  if (not ngoodjets_isLoaded) {
-    if (ngoodjets_branch != 0) {
+  if (ngoodjets_loadedGen != entryGeneration) {
+    if (ngoodjets_flat.IsActive()) {
+      ngoodjets_ = ngoodjets_flat.Get(index);
+    } else if (ngoodjets_bulk != 0) {
+      ngoodjets_ = ngoodjets_bulk->Get<int>(index);
+    } else if (ngoodjets_branch != 0) {
       ngoodjets_branch->GetEntry(index);
     } else {
       printf("branch ngoodjets_branch does not exist!\n");
       exit(1);
     }
-    ngoodjets_isLoaded = true;
+    ngoodjets_loadedGen = entryGeneration;
   }
   return ngoodjets_;
 }
 
 const int &StopTree::ngoodbtags() {
-  if (not ngoodbtags_isLoaded) {
-    if (ngoodbtags_branch != 0) {
+  if (ngoodbtags_loadedGen != entryGeneration) {
+    if (ngoodbtags_flat.IsActive()) {
+      ngoodbtags_ = ngoodbtags_flat.Get(index);
+    } else if (ngoodbtags_bulk != 0) {
+      ngoodbtags_ = ngoodbtags_bulk->Get<int>(index);
+    } else if (ngoodbtags_branch != 0) {
       ngoodbtags_branch->GetEntry(index);
     } else {
       printf("branch ngoodbtags_branch does not exist!\n");
       exit(1);
     }
-    ngoodbtags_isLoaded = true;
+    ngoodbtags_loadedGen = entryGeneration;
   }
   return ngoodbtags_;
 }
 
 const int &StopTree::nloosebtags() {
-  if (not nloosebtags_isLoaded) {
-    if (nloosebtags_branch != 0) {
+  if (nloosebtags_loadedGen != entryGeneration) {
+    if (nloosebtags_flat.IsActive()) {
+      nloosebtags_ = nloosebtags_flat.Get(index);
+    } else if (nloosebtags_bulk != 0) {
+      nloosebtags_ = nloosebtags_bulk->Get<int>(index);
+    } else if (nloosebtags_branch != 0) {
       nloosebtags_branch->GetEntry(index);
     } else {
       printf("branch nloosebtags_branch does not exist!\n");
       exit(1);
     }
-    nloosebtags_isLoaded = true;
+    nloosebtags_loadedGen = entryGeneration;
   }
   return nloosebtags_;
 }
 
 const int &StopTree::ntightbtags() {
-  if (not ntightbtags_isLoaded) {
-    if (ntightbtags_branch != 0) {
+  if (ntightbtags_loadedGen != entryGeneration) {
+    if (ntightbtags_flat.IsActive()) {
+      ntightbtags_ = ntightbtags_flat.Get(index);
+    } else if (ntightbtags_bulk != 0) {
+      ntightbtags_ = ntightbtags_bulk->Get<int>(index);
+    } else if (ntightbtags_branch != 0) {
       ntightbtags_branch->GetEntry(index);
     } else {
       printf("branch ntightbtags_branch does not exist!\n");
       exit(1);
     }
-    ntightbtags_isLoaded = true;
+    ntightbtags_loadedGen = entryGeneration;
   }
   return ntightbtags_;
 }
 
 const int &StopTree::nanalysisbtags() {
-  if (not nanalysisbtags_isLoaded) {
-    if (nanalysisbtags_branch != 0) {
+  if (nanalysisbtags_loadedGen != entryGeneration) {
+    if (nanalysisbtags_flat.IsActive()) {
+      nanalysisbtags_ = nanalysisbtags_flat.Get(index);
+    } else if (nanalysisbtags_bulk != 0) {
+      nanalysisbtags_ = nanalysisbtags_bulk->Get<int>(index);
+    } else if (nanalysisbtags_branch != 0) {
       nanalysisbtags_branch->GetEntry(index);
     } else {
       printf("branch nanalysisbtags_branch does not exist!\n");
       exit(1);
     }
-    nanalysisbtags_isLoaded = true;
+    nanalysisbtags_loadedGen = entryGeneration;
   }
   return nanalysisbtags_;
 }
 
 const float &StopTree::ak4_HT() {
-  if (not ak4_HT_isLoaded) {
-    if (ak4_HT_branch != 0) {
+  if (ak4_HT_loadedGen != entryGeneration) {
+    if (ak4_HT_flat.IsActive()) {
+      ak4_HT_ = ak4_HT_flat.Get(index);
+    } else if (ak4_HT_bulk != 0) {
+      ak4_HT_ = ak4_HT_bulk->Get<float>(index);
+    } else if (ak4_HT_branch != 0) {
       ak4_HT_branch->GetEntry(index);
     } else {
       printf("branch ak4_HT_branch does not exist!\n");
       exit(1);
     }
-    ak4_HT_isLoaded = true;
+    ak4_HT_loadedGen = entryGeneration;
   }
   return ak4_HT_;
 }
 
 const float &StopTree::ak4_htratiom() {
-  if (not ak4_htratiom_isLoaded) {
-    if (ak4_htratiom_branch != 0) {
+  if (ak4_htratiom_loadedGen != entryGeneration) {
+    if (ak4_htratiom_flat.IsActive()) {
+      ak4_htratiom_ = ak4_htratiom_flat.Get(index);
+    } else if (ak4_htratiom_bulk != 0) {
+      ak4_htratiom_ = ak4_htratiom_bulk->Get<float>(index);
+    } else if (ak4_htratiom_branch != 0) {
       ak4_htratiom_branch->GetEntry(index);
     } else {
       printf("branch ak4_htratiom_branch does not exist!\n");
       exit(1);
     }
-    ak4_htratiom_isLoaded = true;
+    ak4_htratiom_loadedGen = entryGeneration;
   }
   return ak4_htratiom_;
 }
 
 const vector<float> &StopTree::dphi_ak4pfjet_met() {
-  if (not dphi_ak4pfjet_met_isLoaded) {
-    if (dphi_ak4pfjet_met_branch != 0) {
+  if (dphi_ak4pfjet_met_loadedGen != entryGeneration) {
+    if (dphi_ak4pfjet_met_flat.IsActive()) {
+      dphi_ak4pfjet_met_ = dphi_ak4pfjet_met_flat.Get(index);
+    } else if (dphi_ak4pfjet_met_branch != 0) {
       dphi_ak4pfjet_met_branch->GetEntry(index);
     } else {
       printf("branch dphi_ak4pfjet_met_branch does not exist!\n");
       exit(1);
     }
-    dphi_ak4pfjet_met_isLoaded = true;
+    dphi_ak4pfjet_met_loadedGen = entryGeneration;
   }
   return *dphi_ak4pfjet_met_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::ak4pfjets_p4() {
-  if (not ak4pfjets_p4_isLoaded) {
-    if (ak4pfjets_p4_branch != 0) {
+  if (ak4pfjets_p4_loadedGen != entryGeneration) {
+    if (ak4pfjets_p4_flat.IsActive()) {
+      ak4pfjets_p4_ = ak4pfjets_p4_flat.Get(index);
+    } else if (ak4pfjets_p4_branch != 0) {
       ak4pfjets_p4_branch->GetEntry(index);
+    } else if (ak4pfjets_p4_split.IsActive()) {
+      ak4pfjets_p4_ = &ak4pfjets_p4_split.GetP4s(index);
     } else {
       printf("branch ak4pfjets_p4_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_p4_isLoaded = true;
+    ak4pfjets_p4_loadedGen = entryGeneration;
   }
   return *ak4pfjets_p4_;
 }
 
+const PolarArrays &StopTree::ak4pfjets_p4_polar() {
+  if (ak4pfjets_p4_polarGen != entryGeneration) {
+    if (ak4pfjets_p4_branch == 0 && ak4pfjets_p4_split.IsActive()) ak4pfjets_p4_split.GetPolar(index, ak4pfjets_p4_polar_);
+    else ak4pfjets_p4_polar_.Fill(ak4pfjets_p4());
+    ak4pfjets_p4_polarGen = entryGeneration;
+  }
+  return ak4pfjets_p4_polar_;
+}
+
 const vector<bool> &StopTree::ak4pfjets_passMEDbtag() {
-  if (not ak4pfjets_passMEDbtag_isLoaded) {
-    if (ak4pfjets_passMEDbtag_branch != 0) {
+  if (ak4pfjets_passMEDbtag_loadedGen != entryGeneration) {
+    if (ak4pfjets_passMEDbtag_flat.IsActive()) {
+      ak4pfjets_passMEDbtag_ = ak4pfjets_passMEDbtag_flat.Get(index);
+    } else if (ak4pfjets_passMEDbtag_branch != 0) {
       ak4pfjets_passMEDbtag_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_passMEDbtag_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_passMEDbtag_isLoaded = true;
+    ak4pfjets_passMEDbtag_loadedGen = entryGeneration;
   }
   return *ak4pfjets_passMEDbtag_;
 }
 
 const vector<float> &StopTree::ak4pfjets_deepCSV() {
-  if (not ak4pfjets_deepCSV_isLoaded) {
-    if (ak4pfjets_deepCSV_branch != 0) {
+  if (ak4pfjets_deepCSV_loadedGen != entryGeneration) {
+    if (ak4pfjets_deepCSV_flat.IsActive()) {
+      ak4pfjets_deepCSV_ = ak4pfjets_deepCSV_flat.Get(index);
+    } else if (ak4pfjets_deepCSV_branch != 0) {
       ak4pfjets_deepCSV_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_deepCSV_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_deepCSV_isLoaded = true;
+    ak4pfjets_deepCSV_loadedGen = entryGeneration;
   }
   return *ak4pfjets_deepCSV_;
 }
 
 const vector<float> &StopTree::ak4pfjets_CSV() {
-  if (not ak4pfjets_CSV_isLoaded) {
-    if (ak4pfjets_CSV_branch != 0) {
+  if (ak4pfjets_CSV_loadedGen != entryGeneration) {
+    if (ak4pfjets_CSV_flat.IsActive()) {
+      ak4pfjets_CSV_ = ak4pfjets_CSV_flat.Get(index);
+    } else if (ak4pfjets_CSV_branch != 0) {
       ak4pfjets_CSV_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_CSV_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_CSV_isLoaded = true;
+    ak4pfjets_CSV_loadedGen = entryGeneration;
   }
   return *ak4pfjets_CSV_;
 }
 
 const vector<float> &StopTree::ak4pfjets_mva() {
-  if (not ak4pfjets_mva_isLoaded) {
-    if (ak4pfjets_mva_branch != 0) {
+  if (ak4pfjets_mva_loadedGen != entryGeneration) {
+    if (ak4pfjets_mva_flat.IsActive()) {
+      ak4pfjets_mva_ = ak4pfjets_mva_flat.Get(index);
+    } else if (ak4pfjets_mva_branch != 0) {
       ak4pfjets_mva_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_mva_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_mva_isLoaded = true;
+    ak4pfjets_mva_loadedGen = entryGeneration;
   }
   return *ak4pfjets_mva_;
 }
 
 const vector<int> &StopTree::ak4pfjets_parton_flavor() {
-  if (not ak4pfjets_parton_flavor_isLoaded) {
-    if (ak4pfjets_parton_flavor_branch != 0) {
+  if (ak4pfjets_parton_flavor_loadedGen != entryGeneration) {
+    if (ak4pfjets_parton_flavor_flat.IsActive()) {
+      ak4pfjets_parton_flavor_ = ak4pfjets_parton_flavor_flat.Get(index);
+    } else if (ak4pfjets_parton_flavor_branch != 0) {
       ak4pfjets_parton_flavor_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_parton_flavor_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_parton_flavor_isLoaded = true;
+    ak4pfjets_parton_flavor_loadedGen = entryGeneration;
   }
   return *ak4pfjets_parton_flavor_;
 }
 
 const vector<int> &StopTree::ak4pfjets_hadron_flavor() {
-  if (not ak4pfjets_hadron_flavor_isLoaded) {
-    if (ak4pfjets_hadron_flavor_branch != 0) {
+  if (ak4pfjets_hadron_flavor_loadedGen != entryGeneration) {
+    if (ak4pfjets_hadron_flavor_flat.IsActive()) {
+      ak4pfjets_hadron_flavor_ = ak4pfjets_hadron_flavor_flat.Get(index);
+    } else if (ak4pfjets_hadron_flavor_branch != 0) {
       ak4pfjets_hadron_flavor_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_hadron_flavor_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_hadron_flavor_isLoaded = true;
+    ak4pfjets_hadron_flavor_loadedGen = entryGeneration;
   }
   return *ak4pfjets_hadron_flavor_;
 }
 
 const vector<bool> &StopTree::ak4pfjets_loose_puid() {
-  if (not ak4pfjets_loose_puid_isLoaded) {
-    if (ak4pfjets_loose_puid_branch != 0) {
+  if (ak4pfjets_loose_puid_loadedGen != entryGeneration) {
+    if (ak4pfjets_loose_puid_flat.IsActive()) {
+      ak4pfjets_loose_puid_ = ak4pfjets_loose_puid_flat.Get(index);
+    } else if (ak4pfjets_loose_puid_branch != 0) {
       ak4pfjets_loose_puid_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_loose_puid_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_loose_puid_isLoaded = true;
+    ak4pfjets_loose_puid_loadedGen = entryGeneration;
   }
   return *ak4pfjets_loose_puid_;
 }
 
 const vector<bool> &StopTree::ak4pfjets_loose_pfid() {
-  if (not ak4pfjets_loose_pfid_isLoaded) {
-    if (ak4pfjets_loose_pfid_branch != 0) {
+  if (ak4pfjets_loose_pfid_loadedGen != entryGeneration) {
+    if (ak4pfjets_loose_pfid_flat.IsActive()) {
+      ak4pfjets_loose_pfid_ = ak4pfjets_loose_pfid_flat.Get(index);
+    } else if (ak4pfjets_loose_pfid_branch != 0) {
       ak4pfjets_loose_pfid_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_loose_pfid_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_loose_pfid_isLoaded = true;
+    ak4pfjets_loose_pfid_loadedGen = entryGeneration;
   }
   return *ak4pfjets_loose_pfid_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &StopTree::ak4pfjets_leadMEDbjet_p4() {
-  if (not ak4pfjets_leadMEDbjet_p4_isLoaded) {
-    if (ak4pfjets_leadMEDbjet_p4_branch != 0) {
+  if (ak4pfjets_leadMEDbjet_p4_loadedGen != entryGeneration) {
+    if (ak4pfjets_leadMEDbjet_p4_flat.IsActive()) {
+      ak4pfjets_leadMEDbjet_p4_ = ak4pfjets_leadMEDbjet_p4_flat.Get(index);
+    } else if (ak4pfjets_leadMEDbjet_p4_branch != 0) {
       ak4pfjets_leadMEDbjet_p4_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_leadMEDbjet_p4_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_leadMEDbjet_p4_isLoaded = true;
+    ak4pfjets_leadMEDbjet_p4_loadedGen = entryGeneration;
   }
   return *ak4pfjets_leadMEDbjet_p4_;
 }
 
+const PolarP4 &StopTree::ak4pfjets_leadMEDbjet_p4_polar() {
+  if (ak4pfjets_leadMEDbjet_p4_polarGen != entryGeneration) {
+    ak4pfjets_leadMEDbjet_p4_polar_.Fill(ak4pfjets_leadMEDbjet_p4());
+    ak4pfjets_leadMEDbjet_p4_polarGen = entryGeneration;
+  }
+  return ak4pfjets_leadMEDbjet_p4_polar_;
+}
+
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &StopTree::ak4pfjets_leadbtag_p4() {
-  if (not ak4pfjets_leadbtag_p4_isLoaded) {
-    if (ak4pfjets_leadbtag_p4_branch != 0) {
+  if (ak4pfjets_leadbtag_p4_loadedGen != entryGeneration) {
+    if (ak4pfjets_leadbtag_p4_flat.IsActive()) {
+      ak4pfjets_leadbtag_p4_ = ak4pfjets_leadbtag_p4_flat.Get(index);
+    } else if (ak4pfjets_leadbtag_p4_branch != 0) {
       ak4pfjets_leadbtag_p4_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_leadbtag_p4_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_leadbtag_p4_isLoaded = true;
+    ak4pfjets_leadbtag_p4_loadedGen = entryGeneration;
   }
   return *ak4pfjets_leadbtag_p4_;
 }
 
+const PolarP4 &StopTree::ak4pfjets_leadbtag_p4_polar() {
+  if (ak4pfjets_leadbtag_p4_polarGen != entryGeneration) {
+    ak4pfjets_leadbtag_p4_polar_.Fill(ak4pfjets_leadbtag_p4());
+    ak4pfjets_leadbtag_p4_polarGen = entryGeneration;
+  }
+  return ak4pfjets_leadbtag_p4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::ak4genjets_p4() {
-  if (not ak4genjets_p4_isLoaded) {
-    if (ak4genjets_p4_branch != 0) {
+  if (ak4genjets_p4_loadedGen != entryGeneration) {
+    if (ak4genjets_p4_flat.IsActive()) {
+      ak4genjets_p4_ = ak4genjets_p4_flat.Get(index);
+    } else if (ak4genjets_p4_branch != 0) {
       ak4genjets_p4_branch->GetEntry(index);
+    } else if (ak4genjets_p4_split.IsActive()) {
+      ak4genjets_p4_ = &ak4genjets_p4_split.GetP4s(index);
     } else {
       printf("branch ak4genjets_p4_branch does not exist!\n");
       exit(1);
     }
-    ak4genjets_p4_isLoaded = true;
+    ak4genjets_p4_loadedGen = entryGeneration;
   }
   return *ak4genjets_p4_;
 }
 
+const PolarArrays &StopTree::ak4genjets_p4_polar() {
+  if (ak4genjets_p4_polarGen != entryGeneration) {
+    if (ak4genjets_p4_branch == 0 && ak4genjets_p4_split.IsActive()) ak4genjets_p4_split.GetPolar(index, ak4genjets_p4_polar_);
+    else ak4genjets_p4_polar_.Fill(ak4genjets_p4());
+    ak4genjets_p4_polarGen = entryGeneration;
+  }
+  return ak4genjets_p4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::softtags_p4() {
-  if (not softtags_p4_isLoaded) {
-    if (softtags_p4_branch != 0) {
+  if (softtags_p4_loadedGen != entryGeneration) {
+    if (softtags_p4_flat.IsActive()) {
+      softtags_p4_ = softtags_p4_flat.Get(index);
+    } else if (softtags_p4_branch != 0) {
       softtags_p4_branch->GetEntry(index);
+    } else if (softtags_p4_split.IsActive()) {
+      softtags_p4_ = &softtags_p4_split.GetP4s(index);
     } else {
       printf("branch softtags_p4_branch does not exist!\n");
       exit(1);
     }
-    softtags_p4_isLoaded = true;
+    softtags_p4_loadedGen = entryGeneration;
   }
   return *softtags_p4_;
 }
 
+const PolarArrays &StopTree::softtags_p4_polar() {
+  if (softtags_p4_polarGen != entryGeneration) {
+    if (softtags_p4_branch == 0 && softtags_p4_split.IsActive()) softtags_p4_split.GetPolar(index, softtags_p4_polar_);
+    else softtags_p4_polar_.Fill(softtags_p4());
+    softtags_p4_polarGen = entryGeneration;
+  }
+  return softtags_p4_polar_;
+}
+
 const int &StopTree::nsoftbtags() {
-  if (not nsoftbtags_isLoaded) {
-    if (nsoftbtags_branch != 0) {
+  if (nsoftbtags_loadedGen != entryGeneration) {
+    if (nsoftbtags_flat.IsActive()) {
+      nsoftbtags_ = nsoftbtags_flat.Get(index);
+    } else if (nsoftbtags_bulk != 0) {
+      nsoftbtags_ = nsoftbtags_bulk->Get<int>(index);
+    } else if (nsoftbtags_branch != 0) {
       nsoftbtags_branch->GetEntry(index);
     } else {
       printf("branch nsoftbtags_branch does not exist!\n");
       exit(1);
     }
-    nsoftbtags_isLoaded = true;
+    nsoftbtags_loadedGen = entryGeneration;
   }
   return nsoftbtags_;
 }
 
 const int &StopTree::jup_nskimjets() {
-  if (not jup_nskimjets_isLoaded) {
-    if (jup_nskimjets_branch != 0) {
+  if (jup_nskimjets_loadedGen != entryGeneration) {
+    if (jup_nskimjets_flat.IsActive()) {
+      jup_nskimjets_ = jup_nskimjets_flat.Get(index);
+    } else if (jup_nskimjets_bulk != 0) {
+      jup_nskimjets_ = jup_nskimjets_bulk->Get<int>(index);
+    } else if (jup_nskimjets_branch != 0) {
       jup_nskimjets_branch->GetEntry(index);
     } else {
       printf("branch jup_nskimjets_branch does not exist!\n");
       exit(1);
     }
-    jup_nskimjets_isLoaded = true;
+    jup_nskimjets_loadedGen = entryGeneration;
   }
   return jup_nskimjets_;
 }
 
 const int &StopTree::jup_nskimbtagmed() {
-  if (not jup_nskimbtagmed_isLoaded) {
-    if (jup_nskimbtagmed_branch != 0) {
+  if (jup_nskimbtagmed_loadedGen != entryGeneration) {
+    if (jup_nskimbtagmed_flat.IsActive()) {
+      jup_nskimbtagmed_ = jup_nskimbtagmed_flat.Get(index);
+    } else if (jup_nskimbtagmed_bulk != 0) {
+      jup_nskimbtagmed_ = jup_nskimbtagmed_bulk->Get<int>(index);
+    } else if (jup_nskimbtagmed_branch != 0) {
       jup_nskimbtagmed_branch->GetEntry(index);
     } else {
       printf("branch jup_nskimbtagmed_branch does not exist!\n");
       exit(1);
     }
-    jup_nskimbtagmed_isLoaded = true;
+    jup_nskimbtagmed_loadedGen = entryGeneration;
   }
   return jup_nskimbtagmed_;
 }
 
 const int &StopTree::jup_nskimbtagloose() {
-  if (not jup_nskimbtagloose_isLoaded) {
-    if (jup_nskimbtagloose_branch != 0) {
+  if (jup_nskimbtagloose_loadedGen != entryGeneration) {
+    if (jup_nskimbtagloose_flat.IsActive()) {
+      jup_nskimbtagloose_ = jup_nskimbtagloose_flat.Get(index);
+    } else if (jup_nskimbtagloose_bulk != 0) {
+      jup_nskimbtagloose_ = jup_nskimbtagloose_bulk->Get<int>(index);
+    } else if (jup_nskimbtagloose_branch != 0) {
       jup_nskimbtagloose_branch->GetEntry(index);
     } else {
       printf("branch jup_nskimbtagloose_branch does not exist!\n");
       exit(1);
     }
-    jup_nskimbtagloose_isLoaded = true;
+    jup_nskimbtagloose_loadedGen = entryGeneration;
   }
   return jup_nskimbtagloose_;
 }
 
 const int &StopTree::jup_nskimbtagtight() {
-  if (not jup_nskimbtagtight_isLoaded) {
-    if (jup_nskimbtagtight_branch != 0) {
+  if (jup_nskimbtagtight_loadedGen != entryGeneration) {
+    if (jup_nskimbtagtight_flat.IsActive()) {
+      jup_nskimbtagtight_ = jup_nskimbtagtight_flat.Get(index);
+    } else if (jup_nskimbtagtight_bulk != 0) {
+      jup_nskimbtagtight_ = jup_nskimbtagtight_bulk->Get<int>(index);
+    } else if (jup_nskimbtagtight_branch != 0) {
       jup_nskimbtagtight_branch->GetEntry(index);
     } else {
       printf("branch jup_nskimbtagtight_branch does not exist!\n");
       exit(1);
     }
-    jup_nskimbtagtight_isLoaded = true;
+    jup_nskimbtagtight_loadedGen = entryGeneration;
   }
   return jup_nskimbtagtight_;
 }
 
 const int &StopTree::jup_ngoodjets() {
-  if (not jup_ngoodjets_isLoaded) {
-    if (jup_ngoodjets_branch != 0) {
+  if (jup_ngoodjets_loadedGen != entryGeneration) {
+    if (jup_ngoodjets_flat.IsActive()) {
+      jup_ngoodjets_ = jup_ngoodjets_flat.Get(index);
+    } else if (jup_ngoodjets_bulk != 0) {
+      jup_ngoodjets_ = jup_ngoodjets_bulk->Get<int>(index);
+    } else if (jup_ngoodjets_branch != 0) {
       jup_ngoodjets_branch->GetEntry(index);
     } else {
       printf("branch jup_ngoodjets_branch does not exist!\n");
       exit(1);
     }
-    jup_ngoodjets_isLoaded = true;
+    jup_ngoodjets_loadedGen = entryGeneration;
   }
   return jup_ngoodjets_;
 }
 
 const int &StopTree::jup_ngoodbtags() {
-  if (not jup_ngoodbtags_isLoaded) {
-    if (jup_ngoodbtags_branch != 0) {
+  if (jup_ngoodbtags_loadedGen != entryGeneration) {
+    if (jup_ngoodbtags_flat.IsActive()) {
+      jup_ngoodbtags_ = jup_ngoodbtags_flat.Get(index);
+    } else if (jup_ngoodbtags_bulk != 0) {
+      jup_ngoodbtags_ = jup_ngoodbtags_bulk->Get<int>(index);
+    } else if (jup_ngoodbtags_branch != 0) {
       jup_ngoodbtags_branch->GetEntry(index);
     } else {
       printf("branch jup_ngoodbtags_branch does not exist!\n");
       exit(1);
     }
-    jup_ngoodbtags_isLoaded = true;
+    jup_ngoodbtags_loadedGen = entryGeneration;
   }
   return jup_ngoodbtags_;
 }
 
 const int &StopTree::jup_nloosebtags() {
-  if (not jup_nloosebtags_isLoaded) {
-    if (jup_nloosebtags_branch != 0) {
+  if (jup_nloosebtags_loadedGen != entryGeneration) {
+    if (jup_nloosebtags_flat.IsActive()) {
+      jup_nloosebtags_ = jup_nloosebtags_flat.Get(index);
+    } else if (jup_nloosebtags_bulk != 0) {
+      jup_nloosebtags_ = jup_nloosebtags_bulk->Get<int>(index);
+    } else if (jup_nloosebtags_branch != 0) {
       jup_nloosebtags_branch->GetEntry(index);
     } else {
       printf("branch jup_nloosebtags_branch does not exist!\n");
       exit(1);
     }
-    jup_nloosebtags_isLoaded = true;
+    jup_nloosebtags_loadedGen = entryGeneration;
   }
   return jup_nloosebtags_;
 }
 
 const int &StopTree::jup_ntightbtags() {
-  if (not jup_ntightbtags_isLoaded) {
-    if (jup_ntightbtags_branch != 0) {
+  if (jup_ntightbtags_loadedGen != entryGeneration) {
+    if (jup_ntightbtags_flat.IsActive()) {
+      jup_ntightbtags_ = jup_ntightbtags_flat.Get(index);
+    } else if (jup_ntightbtags_bulk != 0) {
+      jup_ntightbtags_ = jup_ntightbtags_bulk->Get<int>(index);
+    } else if (jup_ntightbtags_branch != 0) {
       jup_ntightbtags_branch->GetEntry(index);
     } else {
       printf("branch jup_ntightbtags_branch does not exist!\n");
       exit(1);
     }
-    jup_ntightbtags_isLoaded = true;
+    jup_ntightbtags_loadedGen = entryGeneration;
   }
   return jup_ntightbtags_;
 }
 
 const int &StopTree::jup_nanalysisbtags() {
-  if (not jup_nanalysisbtags_isLoaded) {
-    if (jup_nanalysisbtags_branch != 0) {
+  if (jup_nanalysisbtags_loadedGen != entryGeneration) {
+    if (jup_nanalysisbtags_flat.IsActive()) {
+      jup_nanalysisbtags_ = jup_nanalysisbtags_flat.Get(index);
+    } else if (jup_nanalysisbtags_bulk != 0) {
+      jup_nanalysisbtags_ = jup_nanalysisbtags_bulk->Get<int>(index);
+    } else if (jup_nanalysisbtags_branch != 0) {
       jup_nanalysisbtags_branch->GetEntry(index);
     } else {
       printf("branch jup_nanalysisbtags_branch does not exist!\n");
       exit(1);
     }
-    jup_nanalysisbtags_isLoaded = true;
+    jup_nanalysisbtags_loadedGen = entryGeneration;
   }
   return jup_nanalysisbtags_;
 }
 
 const float &StopTree::jup_ak4_HT() {
-  if (not jup_ak4_HT_isLoaded) {
-    if (jup_ak4_HT_branch != 0) {
+  if (jup_ak4_HT_loadedGen != entryGeneration) {
+    if (jup_ak4_HT_flat.IsActive()) {
+      jup_ak4_HT_ = jup_ak4_HT_flat.Get(index);
+    } else if (jup_ak4_HT_bulk != 0) {
+      jup_ak4_HT_ = jup_ak4_HT_bulk->Get<float>(index);
+    } else if (jup_ak4_HT_branch != 0) {
       jup_ak4_HT_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4_HT_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4_HT_isLoaded = true;
+    jup_ak4_HT_loadedGen = entryGeneration;
   }
   return jup_ak4_HT_;
 }
 
 const float &StopTree::jup_ak4_htratiom() {
-  if (not jup_ak4_htratiom_isLoaded) {
-    if (jup_ak4_htratiom_branch != 0) {
+  if (jup_ak4_htratiom_loadedGen != entryGeneration) {
+    if (jup_ak4_htratiom_flat.IsActive()) {
+      jup_ak4_htratiom_ = jup_ak4_htratiom_flat.Get(index);
+    } else if (jup_ak4_htratiom_bulk != 0) {
+      jup_ak4_htratiom_ = jup_ak4_htratiom_bulk->Get<float>(index);
+    } else if (jup_ak4_htratiom_branch != 0) {
       jup_ak4_htratiom_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4_htratiom_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4_htratiom_isLoaded = true;
+    jup_ak4_htratiom_loadedGen = entryGeneration;
   }
   return jup_ak4_htratiom_;
 }
 
 const vector<float> &StopTree::jup_dphi_ak4pfjet_met() {
-  if (not jup_dphi_ak4pfjet_met_isLoaded) {
-    if (jup_dphi_ak4pfjet_met_branch != 0) {
+  if (jup_dphi_ak4pfjet_met_loadedGen != entryGeneration) {
+    if (jup_dphi_ak4pfjet_met_flat.IsActive()) {
+      jup_dphi_ak4pfjet_met_ = jup_dphi_ak4pfjet_met_flat.Get(index);
+    } else if (jup_dphi_ak4pfjet_met_branch != 0) {
       jup_dphi_ak4pfjet_met_branch->GetEntry(index);
     } else {
       printf("branch jup_dphi_ak4pfjet_met_branch does not exist!\n");
       exit(1);
     }
-    jup_dphi_ak4pfjet_met_isLoaded = true;
+    jup_dphi_ak4pfjet_met_loadedGen = entryGeneration;
   }
   return *jup_dphi_ak4pfjet_met_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jup_ak4pfjets_p4() {
-  if (not jup_ak4pfjets_p4_isLoaded) {
-    if (jup_ak4pfjets_p4_branch != 0) {
+  if (jup_ak4pfjets_p4_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_p4_flat.IsActive()) {
+      jup_ak4pfjets_p4_ = jup_ak4pfjets_p4_flat.Get(index);
+    } else if (jup_ak4pfjets_p4_branch != 0) {
       jup_ak4pfjets_p4_branch->GetEntry(index);
+    } else if (jup_ak4pfjets_p4_split.IsActive()) {
+      jup_ak4pfjets_p4_ = &jup_ak4pfjets_p4_split.GetP4s(index);
     } else {
       printf("branch jup_ak4pfjets_p4_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_p4_isLoaded = true;
+    jup_ak4pfjets_p4_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_p4_;
 }
 
+const PolarArrays &StopTree::jup_ak4pfjets_p4_polar() {
+  if (jup_ak4pfjets_p4_polarGen != entryGeneration) {
+    if (jup_ak4pfjets_p4_branch == 0 && jup_ak4pfjets_p4_split.IsActive()) jup_ak4pfjets_p4_split.GetPolar(index, jup_ak4pfjets_p4_polar_);
+    else jup_ak4pfjets_p4_polar_.Fill(jup_ak4pfjets_p4());
+    jup_ak4pfjets_p4_polarGen = entryGeneration;
+  }
+  return jup_ak4pfjets_p4_polar_;
+}
+
 const vector<bool> &StopTree::jup_ak4pfjets_passMEDbtag() {
-  if (not jup_ak4pfjets_passMEDbtag_isLoaded) {
-    if (jup_ak4pfjets_passMEDbtag_branch != 0) {
+  if (jup_ak4pfjets_passMEDbtag_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_passMEDbtag_flat.IsActive()) {
+      jup_ak4pfjets_passMEDbtag_ = jup_ak4pfjets_passMEDbtag_flat.Get(index);
+    } else if (jup_ak4pfjets_passMEDbtag_branch != 0) {
       jup_ak4pfjets_passMEDbtag_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_passMEDbtag_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_passMEDbtag_isLoaded = true;
+    jup_ak4pfjets_passMEDbtag_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_passMEDbtag_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_deepCSV() {
-  if (not jup_ak4pfjets_deepCSV_isLoaded) {
-    if (jup_ak4pfjets_deepCSV_branch != 0) {
+  if (jup_ak4pfjets_deepCSV_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_deepCSV_flat.IsActive()) {
+      jup_ak4pfjets_deepCSV_ = jup_ak4pfjets_deepCSV_flat.Get(index);
+    } else if (jup_ak4pfjets_deepCSV_branch != 0) {
       jup_ak4pfjets_deepCSV_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_deepCSV_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_deepCSV_isLoaded = true;
+    jup_ak4pfjets_deepCSV_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_deepCSV_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_CSV() {
-  if (not jup_ak4pfjets_CSV_isLoaded) {
-    if (jup_ak4pfjets_CSV_branch != 0) {
+  if (jup_ak4pfjets_CSV_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_CSV_flat.IsActive()) {
+      jup_ak4pfjets_CSV_ = jup_ak4pfjets_CSV_flat.Get(index);
+    } else if (jup_ak4pfjets_CSV_branch != 0) {
       jup_ak4pfjets_CSV_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_CSV_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_CSV_isLoaded = true;
+    jup_ak4pfjets_CSV_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_CSV_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_mva() {
-  if (not jup_ak4pfjets_mva_isLoaded) {
-    if (jup_ak4pfjets_mva_branch != 0) {
+  if (jup_ak4pfjets_mva_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_mva_flat.IsActive()) {
+      jup_ak4pfjets_mva_ = jup_ak4pfjets_mva_flat.Get(index);
+    } else if (jup_ak4pfjets_mva_branch != 0) {
       jup_ak4pfjets_mva_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_mva_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_mva_isLoaded = true;
+    jup_ak4pfjets_mva_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_mva_;
 }
 
 const vector<int> &StopTree::jup_ak4pfjets_parton_flavor() {
-  if (not jup_ak4pfjets_parton_flavor_isLoaded) {
-    if (jup_ak4pfjets_parton_flavor_branch != 0) {
+  if (jup_ak4pfjets_parton_flavor_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_parton_flavor_flat.IsActive()) {
+      jup_ak4pfjets_parton_flavor_ = jup_ak4pfjets_parton_flavor_flat.Get(index);
+    } else if (jup_ak4pfjets_parton_flavor_branch != 0) {
       jup_ak4pfjets_parton_flavor_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_parton_flavor_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_parton_flavor_isLoaded = true;
+    jup_ak4pfjets_parton_flavor_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_parton_flavor_;
 }
 
 const vector<int> &StopTree::jup_ak4pfjets_hadron_flavor() {
-  if (not jup_ak4pfjets_hadron_flavor_isLoaded) {
-    if (jup_ak4pfjets_hadron_flavor_branch != 0) {
+  if (jup_ak4pfjets_hadron_flavor_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_hadron_flavor_flat.IsActive()) {
+      jup_ak4pfjets_hadron_flavor_ = jup_ak4pfjets_hadron_flavor_flat.Get(index);
+    } else if (jup_ak4pfjets_hadron_flavor_branch != 0) {
       jup_ak4pfjets_hadron_flavor_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_hadron_flavor_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_hadron_flavor_isLoaded = true;
+    jup_ak4pfjets_hadron_flavor_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_hadron_flavor_;
 }
 
 const vector<bool> &StopTree::jup_ak4pfjets_loose_puid() {
-  if (not jup_ak4pfjets_loose_puid_isLoaded) {
-    if (jup_ak4pfjets_loose_puid_branch != 0) {
+  if (jup_ak4pfjets_loose_puid_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_loose_puid_flat.IsActive()) {
+      jup_ak4pfjets_loose_puid_ = jup_ak4pfjets_loose_puid_flat.Get(index);
+    } else if (jup_ak4pfjets_loose_puid_branch != 0) {
       jup_ak4pfjets_loose_puid_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_loose_puid_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_loose_puid_isLoaded = true;
+    jup_ak4pfjets_loose_puid_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_loose_puid_;
 }
 
 const vector<bool> &StopTree::jup_ak4pfjets_loose_pfid() {
-  if (not jup_ak4pfjets_loose_pfid_isLoaded) {
-    if (jup_ak4pfjets_loose_pfid_branch != 0) {
+  if (jup_ak4pfjets_loose_pfid_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_loose_pfid_flat.IsActive()) {
+      jup_ak4pfjets_loose_pfid_ = jup_ak4pfjets_loose_pfid_flat.Get(index);
+    } else if (jup_ak4pfjets_loose_pfid_branch != 0) {
       jup_ak4pfjets_loose_pfid_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_loose_pfid_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_loose_pfid_isLoaded = true;
+    jup_ak4pfjets_loose_pfid_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_loose_pfid_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &StopTree::jup_ak4pfjets_leadMEDbjet_p4() {
-  if (not jup_ak4pfjets_leadMEDbjet_p4_isLoaded) {
-    if (jup_ak4pfjets_leadMEDbjet_p4_branch != 0) {
+  if (jup_ak4pfjets_leadMEDbjet_p4_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_leadMEDbjet_p4_flat.IsActive()) {
+      jup_ak4pfjets_leadMEDbjet_p4_ = jup_ak4pfjets_leadMEDbjet_p4_flat.Get(index);
+    } else if (jup_ak4pfjets_leadMEDbjet_p4_branch != 0) {
       jup_ak4pfjets_leadMEDbjet_p4_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_leadMEDbjet_p4_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_leadMEDbjet_p4_isLoaded = true;
+    jup_ak4pfjets_leadMEDbjet_p4_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_leadMEDbjet_p4_;
 }
 
+const PolarP4 &StopTree::jup_ak4pfjets_leadMEDbjet_p4_polar() {
+  if (jup_ak4pfjets_leadMEDbjet_p4_polarGen != entryGeneration) {
+    jup_ak4pfjets_leadMEDbjet_p4_polar_.Fill(jup_ak4pfjets_leadMEDbjet_p4());
+    jup_ak4pfjets_leadMEDbjet_p4_polarGen = entryGeneration;
+  }
+  return jup_ak4pfjets_leadMEDbjet_p4_polar_;
+}
+
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &StopTree::jup_ak4pfjets_leadbtag_p4() {
-  if (not jup_ak4pfjets_leadbtag_p4_isLoaded) {
-    if (jup_ak4pfjets_leadbtag_p4_branch != 0) {
+  if (jup_ak4pfjets_leadbtag_p4_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_leadbtag_p4_flat.IsActive()) {
+      jup_ak4pfjets_leadbtag_p4_ = jup_ak4pfjets_leadbtag_p4_flat.Get(index);
+    } else if (jup_ak4pfjets_leadbtag_p4_branch != 0) {
       jup_ak4pfjets_leadbtag_p4_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_leadbtag_p4_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_leadbtag_p4_isLoaded = true;
+    jup_ak4pfjets_leadbtag_p4_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_leadbtag_p4_;
 }
 
+const PolarP4 &StopTree::jup_ak4pfjets_leadbtag_p4_polar() {
+  if (jup_ak4pfjets_leadbtag_p4_polarGen != entryGeneration) {
+    jup_ak4pfjets_leadbtag_p4_polar_.Fill(jup_ak4pfjets_leadbtag_p4());
+    jup_ak4pfjets_leadbtag_p4_polarGen = entryGeneration;
+  }
+  return jup_ak4pfjets_leadbtag_p4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jup_ak4genjets_p4() {
-  if (not jup_ak4genjets_p4_isLoaded) {
-    if (jup_ak4genjets_p4_branch != 0) {
+  if (jup_ak4genjets_p4_loadedGen != entryGeneration) {
+    if (jup_ak4genjets_p4_flat.IsActive()) {
+      jup_ak4genjets_p4_ = jup_ak4genjets_p4_flat.Get(index);
+    } else if (jup_ak4genjets_p4_branch != 0) {
       jup_ak4genjets_p4_branch->GetEntry(index);
+    } else if (jup_ak4genjets_p4_split.IsActive()) {
+      jup_ak4genjets_p4_ = &jup_ak4genjets_p4_split.GetP4s(index);
     } else {
       printf("branch jup_ak4genjets_p4_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4genjets_p4_isLoaded = true;
+    jup_ak4genjets_p4_loadedGen = entryGeneration;
   }
   return *jup_ak4genjets_p4_;
 }
 
+const PolarArrays &StopTree::jup_ak4genjets_p4_polar() {
+  if (jup_ak4genjets_p4_polarGen != entryGeneration) {
+    if (jup_ak4genjets_p4_branch == 0 && jup_ak4genjets_p4_split.IsActive()) jup_ak4genjets_p4_split.GetPolar(index, jup_ak4genjets_p4_polar_);
+    else jup_ak4genjets_p4_polar_.Fill(jup_ak4genjets_p4());
+    jup_ak4genjets_p4_polarGen = entryGeneration;
+  }
+  return jup_ak4genjets_p4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jup_softtags_p4() {
-  if (not jup_softtags_p4_isLoaded) {
-    if (jup_softtags_p4_branch != 0) {
+  if (jup_softtags_p4_loadedGen != entryGeneration) {
+    if (jup_softtags_p4_flat.IsActive()) {
+      jup_softtags_p4_ = jup_softtags_p4_flat.Get(index);
+    } else if (jup_softtags_p4_branch != 0) {
       jup_softtags_p4_branch->GetEntry(index);
+    } else if (jup_softtags_p4_split.IsActive()) {
+      jup_softtags_p4_ = &jup_softtags_p4_split.GetP4s(index);
     } else {
       printf("branch jup_softtags_p4_branch does not exist!\n");
       exit(1);
     }
-    jup_softtags_p4_isLoaded = true;
+    jup_softtags_p4_loadedGen = entryGeneration;
   }
   return *jup_softtags_p4_;
 }
 
+const PolarArrays &StopTree::jup_softtags_p4_polar() {
+  if (jup_softtags_p4_polarGen != entryGeneration) {
+    if (jup_softtags_p4_branch == 0 && jup_softtags_p4_split.IsActive()) jup_softtags_p4_split.GetPolar(index, jup_softtags_p4_polar_);
+    else jup_softtags_p4_polar_.Fill(jup_softtags_p4());
+    jup_softtags_p4_polarGen = entryGeneration;
+  }
+  return jup_softtags_p4_polar_;
+}
+
 const int &StopTree::jup_nsoftbtags() {
-  if (not jup_nsoftbtags_isLoaded) {
-    if (jup_nsoftbtags_branch != 0) {
+  if (jup_nsoftbtags_loadedGen != entryGeneration) {
+    if (jup_nsoftbtags_flat.IsActive()) {
+      jup_nsoftbtags_ = jup_nsoftbtags_flat.Get(index);
+    } else if (jup_nsoftbtags_bulk != 0) {
+      jup_nsoftbtags_ = jup_nsoftbtags_bulk->Get<int>(index);
+    } else if (jup_nsoftbtags_branch != 0) {
       jup_nsoftbtags_branch->GetEntry(index);
     } else {
       printf("branch jup_nsoftbtags_branch does not exist!\n");
       exit(1);
     }
-    jup_nsoftbtags_isLoaded = true;
+    jup_nsoftbtags_loadedGen = entryGeneration;
   }
   return jup_nsoftbtags_;
 }
 
 const int &StopTree::jdown_nskimjets() {
-  if (not jdown_nskimjets_isLoaded) {
-    if (jdown_nskimjets_branch != 0) {
+  if (jdown_nskimjets_loadedGen != entryGeneration) {
+    if (jdown_nskimjets_flat.IsActive()) {
+      jdown_nskimjets_ = jdown_nskimjets_flat.Get(index);
+    } else if (jdown_nskimjets_bulk != 0) {
+      jdown_nskimjets_ = jdown_nskimjets_bulk->Get<int>(index);
+    } else if (jdown_nskimjets_branch != 0) {
       jdown_nskimjets_branch->GetEntry(index);
     } else {
       printf("branch jdown_nskimjets_branch does not exist!\n");
       exit(1);
     }
-    jdown_nskimjets_isLoaded = true;
+    jdown_nskimjets_loadedGen = entryGeneration;
   }
   return jdown_nskimjets_;
 }
 
 const int &StopTree::jdown_nskimbtagmed() {
-  if (not jdown_nskimbtagmed_isLoaded) {
-    if (jdown_nskimbtagmed_branch != 0) {
+  if (jdown_nskimbtagmed_loadedGen != entryGeneration) {
+    if (jdown_nskimbtagmed_flat.IsActive()) {
+      jdown_nskimbtagmed_ = jdown_nskimbtagmed_flat.Get(index);
+    } else if (jdown_nskimbtagmed_bulk != 0) {
+      jdown_nskimbtagmed_ = jdown_nskimbtagmed_bulk->Get<int>(index);
+    } else if (jdown_nskimbtagmed_branch != 0) {
       jdown_nskimbtagmed_branch->GetEntry(index);
     } else {
       printf("branch jdown_nskimbtagmed_branch does not exist!\n");
       exit(1);
     }
-    jdown_nskimbtagmed_isLoaded = true;
+    jdown_nskimbtagmed_loadedGen = entryGeneration;
   }
   return jdown_nskimbtagmed_;
 }
 
 const int &StopTree::jdown_nskimbtagloose() {
-  if (not jdown_nskimbtagloose_isLoaded) {
-    if (jdown_nskimbtagloose_branch != 0) {
+  if (jdown_nskimbtagloose_loadedGen != entryGeneration) {
+    if (jdown_nskimbtagloose_flat.IsActive()) {
+      jdown_nskimbtagloose_ = jdown_nskimbtagloose_flat.Get(index);
+    } else if (jdown_nskimbtagloose_bulk != 0) {
+      jdown_nskimbtagloose_ = jdown_nskimbtagloose_bulk->Get<int>(index);
+    } else if (jdown_nskimbtagloose_branch != 0) {
       jdown_nskimbtagloose_branch->GetEntry(index);
     } else {
       printf("branch jdown_nskimbtagloose_branch does not exist!\n");
       exit(1);
     }
-    jdown_nskimbtagloose_isLoaded = true;
+    jdown_nskimbtagloose_loadedGen = entryGeneration;
   }
   return jdown_nskimbtagloose_;
 }
 
 const int &StopTree::jdown_nskimbtagtight() {
-  if (not jdown_nskimbtagtight_isLoaded) {
-    if (jdown_nskimbtagtight_branch != 0) {
+  if (jdown_nskimbtagtight_loadedGen != entryGeneration) {
+    if (jdown_nskimbtagtight_flat.IsActive()) {
+      jdown_nskimbtagtight_ = jdown_nskimbtagtight_flat.Get(index);
+    } else if (jdown_nskimbtagtight_bulk != 0) {
+      jdown_nskimbtagtight_ = jdown_nskimbtagtight_bulk->Get<int>(index);
+    } else if (jdown_nskimbtagtight_branch != 0) {
       jdown_nskimbtagtight_branch->GetEntry(index);
     } else {
       printf("branch jdown_nskimbtagtight_branch does not exist!\n");
       exit(1);
     }
-    jdown_nskimbtagtight_isLoaded = true;
+    jdown_nskimbtagtight_loadedGen = entryGeneration;
   }
   return jdown_nskimbtagtight_;
 }
 
 const int &StopTree::jdown_ngoodjets() {
-  if (not jdown_ngoodjets_isLoaded) {
-    if (jdown_ngoodjets_branch != 0) {
+  if (jdown_ngoodjets_loadedGen != entryGeneration) {
+    if (jdown_ngoodjets_flat.IsActive()) {
+      jdown_ngoodjets_ = jdown_ngoodjets_flat.Get(index);
+    } else if (jdown_ngoodjets_bulk != 0) {
+      jdown_ngoodjets_ = jdown_ngoodjets_bulk->Get<int>(index);
+    } else if (jdown_ngoodjets_branch != 0) {
       jdown_ngoodjets_branch->GetEntry(index);
     } else {
       printf("branch jdown_ngoodjets_branch does not exist!\n");
       exit(1);
     }
-    jdown_ngoodjets_isLoaded = true;
+    jdown_ngoodjets_loadedGen = entryGeneration;
   }
   return jdown_ngoodjets_;
 }
 
 const int &StopTree::jdown_ngoodbtags() {
-  if (not jdown_ngoodbtags_isLoaded) {
-    if (jdown_ngoodbtags_branch != 0) {
+  if (jdown_ngoodbtags_loadedGen != entryGeneration) {
+    if (jdown_ngoodbtags_flat.IsActive()) {
+      jdown_ngoodbtags_ = jdown_ngoodbtags_flat.Get(index);
+    } else if (jdown_ngoodbtags_bulk != 0) {
+      jdown_ngoodbtags_ = jdown_ngoodbtags_bulk->Get<int>(index);
+    } else if (jdown_ngoodbtags_branch != 0) {
       jdown_ngoodbtags_branch->GetEntry(index);
     } else {
       printf("branch jdown_ngoodbtags_branch does not exist!\n");
       exit(1);
     }
-    jdown_ngoodbtags_isLoaded = true;
+    jdown_ngoodbtags_loadedGen = entryGeneration;
   }
   return jdown_ngoodbtags_;
 }
 
 const int &StopTree::jdown_nloosebtags() {
-  if (not jdown_nloosebtags_isLoaded) {
-    if (jdown_nloosebtags_branch != 0) {
+  if (jdown_nloosebtags_loadedGen != entryGeneration) {
+    if (jdown_nloosebtags_flat.IsActive()) {
+      jdown_nloosebtags_ = jdown_nloosebtags_flat.Get(index);
+    } else if (jdown_nloosebtags_bulk != 0) {
+      jdown_nloosebtags_ = jdown_nloosebtags_bulk->Get<int>(index);
+    } else if (jdown_nloosebtags_branch != 0) {
       jdown_nloosebtags_branch->GetEntry(index);
     } else {
       printf("branch jdown_nloosebtags_branch does not exist!\n");
       exit(1);
     }
-    jdown_nloosebtags_isLoaded = true;
+    jdown_nloosebtags_loadedGen = entryGeneration;
   }
   return jdown_nloosebtags_;
 }
 
 const int &StopTree::jdown_ntightbtags() {
-  if (not jdown_ntightbtags_isLoaded) {
-    if (jdown_ntightbtags_branch != 0) {
+  if (jdown_ntightbtags_loadedGen != entryGeneration) {
+    if (jdown_ntightbtags_flat.IsActive()) {
+      jdown_ntightbtags_ = jdown_ntightbtags_flat.Get(index);
+    } else if (jdown_ntightbtags_bulk != 0) {
+      jdown_ntightbtags_ = jdown_ntightbtags_bulk->Get<int>(index);
+    } else if (jdown_ntightbtags_branch != 0) {
       jdown_ntightbtags_branch->GetEntry(index);
     } else {
       printf("branch jdown_ntightbtags_branch does not exist!\n");
       exit(1);
     }
-    jdown_ntightbtags_isLoaded = true;
+    jdown_ntightbtags_loadedGen = entryGeneration;
   }
   return jdown_ntightbtags_;
 }
 
 const int &StopTree::jdown_nanalysisbtags() {
-  if (not jdown_nanalysisbtags_isLoaded) {
-    if (jdown_nanalysisbtags_branch != 0) {
+  if (jdown_nanalysisbtags_loadedGen != entryGeneration) {
+    if (jdown_nanalysisbtags_flat.IsActive()) {
+      jdown_nanalysisbtags_ = jdown_nanalysisbtags_flat.Get(index);
+    } else if (jdown_nanalysisbtags_bulk != 0) {
+      jdown_nanalysisbtags_ = jdown_nanalysisbtags_bulk->Get<int>(index);
+    } else if (jdown_nanalysisbtags_branch != 0) {
       jdown_nanalysisbtags_branch->GetEntry(index);
     } else {
       printf("branch jdown_nanalysisbtags_branch does not exist!\n");
       exit(1);
     }
-    jdown_nanalysisbtags_isLoaded = true;
+    jdown_nanalysisbtags_loadedGen = entryGeneration;
   }
   return jdown_nanalysisbtags_;
 }
 
 const float &StopTree::jdown_ak4_HT() {
-  if (not jdown_ak4_HT_isLoaded) {
-    if (jdown_ak4_HT_branch != 0) {
+  if (jdown_ak4_HT_loadedGen != entryGeneration) {
+    if (jdown_ak4_HT_flat.IsActive()) {
+      jdown_ak4_HT_ = jdown_ak4_HT_flat.Get(index);
+    } else if (jdown_ak4_HT_bulk != 0) {
+      jdown_ak4_HT_ = jdown_ak4_HT_bulk->Get<float>(index);
+    } else if (jdown_ak4_HT_branch != 0) {
       jdown_ak4_HT_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4_HT_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4_HT_isLoaded = true;
+    jdown_ak4_HT_loadedGen = entryGeneration;
   }
   return jdown_ak4_HT_;
 }
 
 const float &StopTree::jdown_ak4_htratiom() {
-  if (not jdown_ak4_htratiom_isLoaded) {
-    if (jdown_ak4_htratiom_branch != 0) {
+  if (jdown_ak4_htratiom_loadedGen != entryGeneration) {
+    if (jdown_ak4_htratiom_flat.IsActive()) {
+      jdown_ak4_htratiom_ = jdown_ak4_htratiom_flat.Get(index);
+    } else if (jdown_ak4_htratiom_bulk != 0) {
+      jdown_ak4_htratiom_ = jdown_ak4_htratiom_bulk->Get<float>(index);
+    } else if (jdown_ak4_htratiom_branch != 0) {
       jdown_ak4_htratiom_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4_htratiom_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4_htratiom_isLoaded = true;
+    jdown_ak4_htratiom_loadedGen = entryGeneration;
   }
   return jdown_ak4_htratiom_;
 }
 
 const vector<float> &StopTree::jdown_dphi_ak4pfjet_met() {
-  if (not jdown_dphi_ak4pfjet_met_isLoaded) {
-    if (jdown_dphi_ak4pfjet_met_branch != 0) {
+  if (jdown_dphi_ak4pfjet_met_loadedGen != entryGeneration) {
+    if (jdown_dphi_ak4pfjet_met_flat.IsActive()) {
+      jdown_dphi_ak4pfjet_met_ = jdown_dphi_ak4pfjet_met_flat.Get(index);
+    } else if (jdown_dphi_ak4pfjet_met_branch != 0) {
       jdown_dphi_ak4pfjet_met_branch->GetEntry(index);
     } else {
       printf("branch jdown_dphi_ak4pfjet_met_branch does not exist!\n");
       exit(1);
     }
-    jdown_dphi_ak4pfjet_met_isLoaded = true;
+    jdown_dphi_ak4pfjet_met_loadedGen = entryGeneration;
   }
   return *jdown_dphi_ak4pfjet_met_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jdown_ak4pfjets_p4() {
-  if (not jdown_ak4pfjets_p4_isLoaded) {
-    if (jdown_ak4pfjets_p4_branch != 0) {
+  if (jdown_ak4pfjets_p4_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_p4_flat.IsActive()) {
+      jdown_ak4pfjets_p4_ = jdown_ak4pfjets_p4_flat.Get(index);
+    } else if (jdown_ak4pfjets_p4_branch != 0) {
       jdown_ak4pfjets_p4_branch->GetEntry(index);
+    } else if (jdown_ak4pfjets_p4_split.IsActive()) {
+      jdown_ak4pfjets_p4_ = &jdown_ak4pfjets_p4_split.GetP4s(index);
     } else {
       printf("branch jdown_ak4pfjets_p4_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_p4_isLoaded = true;
+    jdown_ak4pfjets_p4_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_p4_;
 }
 
+const PolarArrays &StopTree::jdown_ak4pfjets_p4_polar() {
+  if (jdown_ak4pfjets_p4_polarGen != entryGeneration) {
+    if (jdown_ak4pfjets_p4_branch == 0 && jdown_ak4pfjets_p4_split.IsActive()) jdown_ak4pfjets_p4_split.GetPolar(index, jdown_ak4pfjets_p4_polar_);
+    else jdown_ak4pfjets_p4_polar_.Fill(jdown_ak4pfjets_p4());
+    jdown_ak4pfjets_p4_polarGen = entryGeneration;
+  }
+  return jdown_ak4pfjets_p4_polar_;
+}
+
 const vector<bool> &StopTree::jdown_ak4pfjets_passMEDbtag() {
-  if (not jdown_ak4pfjets_passMEDbtag_isLoaded) {
-    if (jdown_ak4pfjets_passMEDbtag_branch != 0) {
+  if (jdown_ak4pfjets_passMEDbtag_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_passMEDbtag_flat.IsActive()) {
+      jdown_ak4pfjets_passMEDbtag_ = jdown_ak4pfjets_passMEDbtag_flat.Get(index);
+    } else if (jdown_ak4pfjets_passMEDbtag_branch != 0) {
       jdown_ak4pfjets_passMEDbtag_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_passMEDbtag_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_passMEDbtag_isLoaded = true;
+    jdown_ak4pfjets_passMEDbtag_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_passMEDbtag_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_deepCSV() {
-  if (not jdown_ak4pfjets_deepCSV_isLoaded) {
-    if (jdown_ak4pfjets_deepCSV_branch != 0) {
+  if (jdown_ak4pfjets_deepCSV_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_deepCSV_flat.IsActive()) {
+      jdown_ak4pfjets_deepCSV_ = jdown_ak4pfjets_deepCSV_flat.Get(index);
+    } else if (jdown_ak4pfjets_deepCSV_branch != 0) {
       jdown_ak4pfjets_deepCSV_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_deepCSV_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_deepCSV_isLoaded = true;
+    jdown_ak4pfjets_deepCSV_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_deepCSV_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_CSV() {
-  if (not jdown_ak4pfjets_CSV_isLoaded) {
-    if (jdown_ak4pfjets_CSV_branch != 0) {
+  if (jdown_ak4pfjets_CSV_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_CSV_flat.IsActive()) {
+      jdown_ak4pfjets_CSV_ = jdown_ak4pfjets_CSV_flat.Get(index);
+    } else if (jdown_ak4pfjets_CSV_branch != 0) {
       jdown_ak4pfjets_CSV_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_CSV_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_CSV_isLoaded = true;
+    jdown_ak4pfjets_CSV_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_CSV_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_mva() {
-  if (not jdown_ak4pfjets_mva_isLoaded) {
-    if (jdown_ak4pfjets_mva_branch != 0) {
+  if (jdown_ak4pfjets_mva_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_mva_flat.IsActive()) {
+      jdown_ak4pfjets_mva_ = jdown_ak4pfjets_mva_flat.Get(index);
+    } else if (jdown_ak4pfjets_mva_branch != 0) {
       jdown_ak4pfjets_mva_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_mva_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_mva_isLoaded = true;
+    jdown_ak4pfjets_mva_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_mva_;
 }
 
 const vector<int> &StopTree::jdown_ak4pfjets_parton_flavor() {
-  if (not jdown_ak4pfjets_parton_flavor_isLoaded) {
-    if (jdown_ak4pfjets_parton_flavor_branch != 0) {
+  if (jdown_ak4pfjets_parton_flavor_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_parton_flavor_flat.IsActive()) {
+      jdown_ak4pfjets_parton_flavor_ = jdown_ak4pfjets_parton_flavor_flat.Get(index);
+    } else if (jdown_ak4pfjets_parton_flavor_branch != 0) {
       jdown_ak4pfjets_parton_flavor_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_parton_flavor_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_parton_flavor_isLoaded = true;
+    jdown_ak4pfjets_parton_flavor_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_parton_flavor_;
 }
 
 const vector<int> &StopTree::jdown_ak4pfjets_hadron_flavor() {
-  if (not jdown_ak4pfjets_hadron_flavor_isLoaded) {
-    if (jdown_ak4pfjets_hadron_flavor_branch != 0) {
+  if (jdown_ak4pfjets_hadron_flavor_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_hadron_flavor_flat.IsActive()) {
+      jdown_ak4pfjets_hadron_flavor_ = jdown_ak4pfjets_hadron_flavor_flat.Get(index);
+    } else if (jdown_ak4pfjets_hadron_flavor_branch != 0) {
       jdown_ak4pfjets_hadron_flavor_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_hadron_flavor_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_hadron_flavor_isLoaded = true;
+    jdown_ak4pfjets_hadron_flavor_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_hadron_flavor_;
 }
 
 const vector<bool> &StopTree::jdown_ak4pfjets_loose_puid() {
-  if (not jdown_ak4pfjets_loose_puid_isLoaded) {
-    if (jdown_ak4pfjets_loose_puid_branch != 0) {
+  if (jdown_ak4pfjets_loose_puid_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_loose_puid_flat.IsActive()) {
+      jdown_ak4pfjets_loose_puid_ = jdown_ak4pfjets_loose_puid_flat.Get(index);
+    } else if (jdown_ak4pfjets_loose_puid_branch != 0) {
       jdown_ak4pfjets_loose_puid_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_loose_puid_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_loose_puid_isLoaded = true;
+    jdown_ak4pfjets_loose_puid_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_loose_puid_;
 }
 
 const vector<bool> &StopTree::jdown_ak4pfjets_loose_pfid() {
-  if (not jdown_ak4pfjets_loose_pfid_isLoaded) {
-    if (jdown_ak4pfjets_loose_pfid_branch != 0) {
+  if (jdown_ak4pfjets_loose_pfid_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_loose_pfid_flat.IsActive()) {
+      jdown_ak4pfjets_loose_pfid_ = jdown_ak4pfjets_loose_pfid_flat.Get(index);
+    } else if (jdown_ak4pfjets_loose_pfid_branch != 0) {
       jdown_ak4pfjets_loose_pfid_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_loose_pfid_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_loose_pfid_isLoaded = true;
+    jdown_ak4pfjets_loose_pfid_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_loose_pfid_;
 }
 
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &StopTree::jdown_ak4pfjets_leadMEDbjet_p4() {
-  if (not jdown_ak4pfjets_leadMEDbjet_p4_isLoaded) {
-    if (jdown_ak4pfjets_leadMEDbjet_p4_branch != 0) {
+  if (jdown_ak4pfjets_leadMEDbjet_p4_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_leadMEDbjet_p4_flat.IsActive()) {
+      jdown_ak4pfjets_leadMEDbjet_p4_ = jdown_ak4pfjets_leadMEDbjet_p4_flat.Get(index);
+    } else if (jdown_ak4pfjets_leadMEDbjet_p4_branch != 0) {
       jdown_ak4pfjets_leadMEDbjet_p4_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_leadMEDbjet_p4_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_leadMEDbjet_p4_isLoaded = true;
+    jdown_ak4pfjets_leadMEDbjet_p4_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_leadMEDbjet_p4_;
 }
 
+const PolarP4 &StopTree::jdown_ak4pfjets_leadMEDbjet_p4_polar() {
+  if (jdown_ak4pfjets_leadMEDbjet_p4_polarGen != entryGeneration) {
+    jdown_ak4pfjets_leadMEDbjet_p4_polar_.Fill(jdown_ak4pfjets_leadMEDbjet_p4());
+    jdown_ak4pfjets_leadMEDbjet_p4_polarGen = entryGeneration;
+  }
+  return jdown_ak4pfjets_leadMEDbjet_p4_polar_;
+}
+
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &StopTree::jdown_ak4pfjets_leadbtag_p4() {
-  if (not jdown_ak4pfjets_leadbtag_p4_isLoaded) {
-    if (jdown_ak4pfjets_leadbtag_p4_branch != 0) {
+  if (jdown_ak4pfjets_leadbtag_p4_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_leadbtag_p4_flat.IsActive()) {
+      jdown_ak4pfjets_leadbtag_p4_ = jdown_ak4pfjets_leadbtag_p4_flat.Get(index);
+    } else if (jdown_ak4pfjets_leadbtag_p4_branch != 0) {
       jdown_ak4pfjets_leadbtag_p4_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_leadbtag_p4_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_leadbtag_p4_isLoaded = true;
+    jdown_ak4pfjets_leadbtag_p4_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_leadbtag_p4_;
 }
 
+const PolarP4 &StopTree::jdown_ak4pfjets_leadbtag_p4_polar() {
+  if (jdown_ak4pfjets_leadbtag_p4_polarGen != entryGeneration) {
+    jdown_ak4pfjets_leadbtag_p4_polar_.Fill(jdown_ak4pfjets_leadbtag_p4());
+    jdown_ak4pfjets_leadbtag_p4_polarGen = entryGeneration;
+  }
+  return jdown_ak4pfjets_leadbtag_p4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jdown_ak4genjets_p4() {
-  if (not jdown_ak4genjets_p4_isLoaded) {
-    if (jdown_ak4genjets_p4_branch != 0) {
+  if (jdown_ak4genjets_p4_loadedGen != entryGeneration) {
+    if (jdown_ak4genjets_p4_flat.IsActive()) {
+      jdown_ak4genjets_p4_ = jdown_ak4genjets_p4_flat.Get(index);
+    } else if (jdown_ak4genjets_p4_branch != 0) {
       jdown_ak4genjets_p4_branch->GetEntry(index);
+    } else if (jdown_ak4genjets_p4_split.IsActive()) {
+      jdown_ak4genjets_p4_ = &jdown_ak4genjets_p4_split.GetP4s(index);
     } else {
       printf("branch jdown_ak4genjets_p4_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4genjets_p4_isLoaded = true;
+    jdown_ak4genjets_p4_loadedGen = entryGeneration;
   }
   return *jdown_ak4genjets_p4_;
 }
 
+const PolarArrays &StopTree::jdown_ak4genjets_p4_polar() {
+  if (jdown_ak4genjets_p4_polarGen != entryGeneration) {
+    if (jdown_ak4genjets_p4_branch == 0 && jdown_ak4genjets_p4_split.IsActive()) jdown_ak4genjets_p4_split.GetPolar(index, jdown_ak4genjets_p4_polar_);
+    else jdown_ak4genjets_p4_polar_.Fill(jdown_ak4genjets_p4());
+    jdown_ak4genjets_p4_polarGen = entryGeneration;
+  }
+  return jdown_ak4genjets_p4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jdown_softtags_p4() {
-  if (not jdown_softtags_p4_isLoaded) {
-    if (jdown_softtags_p4_branch != 0) {
+  if (jdown_softtags_p4_loadedGen != entryGeneration) {
+    if (jdown_softtags_p4_flat.IsActive()) {
+      jdown_softtags_p4_ = jdown_softtags_p4_flat.Get(index);
+    } else if (jdown_softtags_p4_branch != 0) {
       jdown_softtags_p4_branch->GetEntry(index);
+    } else if (jdown_softtags_p4_split.IsActive()) {
+      jdown_softtags_p4_ = &jdown_softtags_p4_split.GetP4s(index);
     } else {
       printf("branch jdown_softtags_p4_branch does not exist!\n");
       exit(1);
     }
-    jdown_softtags_p4_isLoaded = true;
+    jdown_softtags_p4_loadedGen = entryGeneration;
   }
   return *jdown_softtags_p4_;
 }
 
+const PolarArrays &StopTree::jdown_softtags_p4_polar() {
+  if (jdown_softtags_p4_polarGen != entryGeneration) {
+    if (jdown_softtags_p4_branch == 0 && jdown_softtags_p4_split.IsActive()) jdown_softtags_p4_split.GetPolar(index, jdown_softtags_p4_polar_);
+    else jdown_softtags_p4_polar_.Fill(jdown_softtags_p4());
+    jdown_softtags_p4_polarGen = entryGeneration;
+  }
+  return jdown_softtags_p4_polar_;
+}
+
 const int &StopTree::jdown_nsoftbtags() {
-  if (not jdown_nsoftbtags_isLoaded) {
-    if (jdown_nsoftbtags_branch != 0) {
+  if (jdown_nsoftbtags_loadedGen != entryGeneration) {
+    if (jdown_nsoftbtags_flat.IsActive()) {
+      jdown_nsoftbtags_ = jdown_nsoftbtags_flat.Get(index);
+    } else if (jdown_nsoftbtags_bulk != 0) {
+      jdown_nsoftbtags_ = jdown_nsoftbtags_bulk->Get<int>(index);
+    } else if (jdown_nsoftbtags_branch != 0) {
       jdown_nsoftbtags_branch->GetEntry(index);
     } else {
       printf("branch jdown_nsoftbtags_branch does not exist!\n");
       exit(1);
     }
-    jdown_nsoftbtags_isLoaded = true;
+    jdown_nsoftbtags_loadedGen = entryGeneration;
   }
   return jdown_nsoftbtags_;
 }
 
 const vector<bool> &StopTree::genleps_isfromt() {
-  if (not genleps_isfromt_isLoaded) {
-    if (genleps_isfromt_branch != 0) {
+  if (genleps_isfromt_loadedGen != entryGeneration) {
+    if (genleps_isfromt_flat.IsActive()) {
+      genleps_isfromt_ = genleps_isfromt_flat.Get(index);
+    } else if (genleps_isfromt_branch != 0) {
       genleps_isfromt_branch->GetEntry(index);
     } else {
       printf("branch genleps_isfromt_branch does not exist!\n");
       exit(1);
     }
-    genleps_isfromt_isLoaded = true;
+    genleps_isfromt_loadedGen = entryGeneration;
   }
   return *genleps_isfromt_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::genleps_p4() {
-  if (not genleps_p4_isLoaded) {
-    if (genleps_p4_branch != 0) {
+  if (genleps_p4_loadedGen != entryGeneration) {
+    if (genleps_p4_flat.IsActive()) {
+      genleps_p4_ = genleps_p4_flat.Get(index);
+    } else if (genleps_p4_branch != 0) {
       genleps_p4_branch->GetEntry(index);
+    } else if (genleps_p4_split.IsActive()) {
+      genleps_p4_ = &genleps_p4_split.GetP4s(index);
     } else {
       printf("branch genleps_p4_branch does not exist!\n");
       exit(1);
     }
-    genleps_p4_isLoaded = true;
+    genleps_p4_loadedGen = entryGeneration;
   }
   return *genleps_p4_;
 }
 
+const PolarArrays &StopTree::genleps_p4_polar() {
+  if (genleps_p4_polarGen != entryGeneration) {
+    if (genleps_p4_branch == 0 && genleps_p4_split.IsActive()) genleps_p4_split.GetPolar(index, genleps_p4_polar_);
+    else genleps_p4_polar_.Fill(genleps_p4());
+    genleps_p4_polarGen = entryGeneration;
+  }
+  return genleps_p4_polar_;
+}
+
 const vector<int> &StopTree::genleps_id() {
-  if (not genleps_id_isLoaded) {
-    if (genleps_id_branch != 0) {
+  if (genleps_id_loadedGen != entryGeneration) {
+    if (genleps_id_flat.IsActive()) {
+      genleps_id_ = genleps_id_flat.Get(index);
+    } else if (genleps_id_branch != 0) {
       genleps_id_branch->GetEntry(index);
     } else {
       printf("branch genleps_id_branch does not exist!\n");
       exit(1);
     }
-    genleps_id_isLoaded = true;
+    genleps_id_loadedGen = entryGeneration;
   }
   return *genleps_id_;
 }
 
 const vector<int> &StopTree::genleps__genpsidx() {
-  if (not genleps__genpsidx_isLoaded) {
-    if (genleps__genpsidx_branch != 0) {
+  if (genleps__genpsidx_loadedGen != entryGeneration) {
+    if (genleps__genpsidx_flat.IsActive()) {
+      genleps__genpsidx_ = genleps__genpsidx_flat.Get(index);
+    } else if (genleps__genpsidx_branch != 0) {
       genleps__genpsidx_branch->GetEntry(index);
     } else {
       printf("branch genleps__genpsidx_branch does not exist!\n");
       exit(1);
     }
-    genleps__genpsidx_isLoaded = true;
+    genleps__genpsidx_loadedGen = entryGeneration;
   }
   return *genleps__genpsidx_;
 }
 
 const vector<int> &StopTree::genleps_status() {
-  if (not genleps_status_isLoaded) {
-    if (genleps_status_branch != 0) {
+  if (genleps_status_loadedGen != entryGeneration) {
+    if (genleps_status_flat.IsActive()) {
+      genleps_status_ = genleps_status_flat.Get(index);
+    } else if (genleps_status_branch != 0) {
       genleps_status_branch->GetEntry(index);
     } else {
       printf("branch genleps_status_branch does not exist!\n");
       exit(1);
     }
-    genleps_status_isLoaded = true;
+    genleps_status_loadedGen = entryGeneration;
   }
   return *genleps_status_;
 }
 
 const vector<bool> &StopTree::genleps_fromHardProcessDecayed() {
-  if (not genleps_fromHardProcessDecayed_isLoaded) {
-    if (genleps_fromHardProcessDecayed_branch != 0) {
+  if (genleps_fromHardProcessDecayed_loadedGen != entryGeneration) {
+    if (genleps_fromHardProcessDecayed_flat.IsActive()) {
+      genleps_fromHardProcessDecayed_ = genleps_fromHardProcessDecayed_flat.Get(index);
+    } else if (genleps_fromHardProcessDecayed_branch != 0) {
       genleps_fromHardProcessDecayed_branch->GetEntry(index);
     } else {
       printf("branch genleps_fromHardProcessDecayed_branch does not exist!\n");
       exit(1);
     }
-    genleps_fromHardProcessDecayed_isLoaded = true;
+    genleps_fromHardProcessDecayed_loadedGen = entryGeneration;
   }
   return *genleps_fromHardProcessDecayed_;
 }
 
 const vector<bool> &StopTree::genleps_fromHardProcessFinalState() {
-  if (not genleps_fromHardProcessFinalState_isLoaded) {
-    if (genleps_fromHardProcessFinalState_branch != 0) {
+  if (genleps_fromHardProcessFinalState_loadedGen != entryGeneration) {
+    if (genleps_fromHardProcessFinalState_flat.IsActive()) {
+      genleps_fromHardProcessFinalState_ = genleps_fromHardProcessFinalState_flat.Get(index);
+    } else if (genleps_fromHardProcessFinalState_branch != 0) {
       genleps_fromHardProcessFinalState_branch->GetEntry(index);
     } else {
       printf("branch genleps_fromHardProcessFinalState_branch does not exist!\n");
       exit(1);
     }
-    genleps_fromHardProcessFinalState_isLoaded = true;
+    genleps_fromHardProcessFinalState_loadedGen = entryGeneration;
   }
   return *genleps_fromHardProcessFinalState_;
 }
 
 const vector<bool> &StopTree::genleps_isHardProcess() {
-  if (not genleps_isHardProcess_isLoaded) {
-    if (genleps_isHardProcess_branch != 0) {
+  if (genleps_isHardProcess_loadedGen != entryGeneration) {
+    if (genleps_isHardProcess_flat.IsActive()) {
+      genleps_isHardProcess_ = genleps_isHardProcess_flat.Get(index);
+    } else if (genleps_isHardProcess_branch != 0) {
       genleps_isHardProcess_branch->GetEntry(index);
     } else {
       printf("branch genleps_isHardProcess_branch does not exist!\n");
       exit(1);
     }
-    genleps_isHardProcess_isLoaded = true;
+    genleps_isHardProcess_loadedGen = entryGeneration;
   }
   return *genleps_isHardProcess_;
 }
 
 const vector<bool> &StopTree::genleps_isLastCopy() {
-  if (not genleps_isLastCopy_isLoaded) {
-    if (genleps_isLastCopy_branch != 0) {
+  if (genleps_isLastCopy_loadedGen != entryGeneration) {
+    if (genleps_isLastCopy_flat.IsActive()) {
+      genleps_isLastCopy_ = genleps_isLastCopy_flat.Get(index);
+    } else if (genleps_isLastCopy_branch != 0) {
       genleps_isLastCopy_branch->GetEntry(index);
     } else {
       printf("branch genleps_isLastCopy_branch does not exist!\n");
       exit(1);
     }
-    genleps_isLastCopy_isLoaded = true;
+    genleps_isLastCopy_loadedGen = entryGeneration;
   }
   return *genleps_isLastCopy_;
 }
 
 const vector<int> &StopTree::genleps_gentaudecay() {
-  if (not genleps_gentaudecay_isLoaded) {
-    if (genleps_gentaudecay_branch != 0) {
+  if (genleps_gentaudecay_loadedGen != entryGeneration) {
+    if (genleps_gentaudecay_flat.IsActive()) {
+      genleps_gentaudecay_ = genleps_gentaudecay_flat.Get(index);
+    } else if (genleps_gentaudecay_branch != 0) {
       genleps_gentaudecay_branch->GetEntry(index);
     } else {
       printf("branch genleps_gentaudecay_branch does not exist!\n");
       exit(1);
     }
-    genleps_gentaudecay_isLoaded = true;
+    genleps_gentaudecay_loadedGen = entryGeneration;
   }
   return *genleps_gentaudecay_;
 }
 
 const int &StopTree::gen_nfromtleps_() {
-  if (not gen_nfromtleps__isLoaded) {
-    if (gen_nfromtleps__branch != 0) {
+  if (gen_nfromtleps__loadedGen != entryGeneration) {
+    if (gen_nfromtleps__flat.IsActive()) {
+      gen_nfromtleps__ = gen_nfromtleps__flat.Get(index);
+    } else if (gen_nfromtleps__bulk != 0) {
+      gen_nfromtleps__ = gen_nfromtleps__bulk->Get<int>(index);
+    } else if (gen_nfromtleps__branch != 0) {
       gen_nfromtleps__branch->GetEntry(index);
     } else {
       printf("branch gen_nfromtleps__branch does not exist!\n");
       exit(1);
     }
-    gen_nfromtleps__isLoaded = true;
+    gen_nfromtleps__loadedGen = entryGeneration;
   }
   return gen_nfromtleps__;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::genleps_motherp4() {
-  if (not genleps_motherp4_isLoaded) {
-    if (genleps_motherp4_branch != 0) {
+  if (genleps_motherp4_loadedGen != entryGeneration) {
+    if (genleps_motherp4_flat.IsActive()) {
+      genleps_motherp4_ = genleps_motherp4_flat.Get(index);
+    } else if (genleps_motherp4_branch != 0) {
       genleps_motherp4_branch->GetEntry(index);
+    } else if (genleps_motherp4_split.IsActive()) {
+      genleps_motherp4_ = &genleps_motherp4_split.GetP4s(index);
     } else {
       printf("branch genleps_motherp4_branch does not exist!\n");
       exit(1);
     }
-    genleps_motherp4_isLoaded = true;
+    genleps_motherp4_loadedGen = entryGeneration;
   }
   return *genleps_motherp4_;
 }
 
+const PolarArrays &StopTree::genleps_motherp4_polar() {
+  if (genleps_motherp4_polarGen != entryGeneration) {
+    if (genleps_motherp4_branch == 0 && genleps_motherp4_split.IsActive()) genleps_motherp4_split.GetPolar(index, genleps_motherp4_polar_);
+    else genleps_motherp4_polar_.Fill(genleps_motherp4());
+    genleps_motherp4_polarGen = entryGeneration;
+  }
+  return genleps_motherp4_polar_;
+}
+
 const vector<int> &StopTree::genleps_motherid() {
-  if (not genleps_motherid_isLoaded) {
-    if (genleps_motherid_branch != 0) {
+  if (genleps_motherid_loadedGen != entryGeneration) {
+    if (genleps_motherid_flat.IsActive()) {
+      genleps_motherid_ = genleps_motherid_flat.Get(index);
+    } else if (genleps_motherid_branch != 0) {
       genleps_motherid_branch->GetEntry(index);
     } else {
       printf("branch genleps_motherid_branch does not exist!\n");
       exit(1);
     }
-    genleps_motherid_isLoaded = true;
+    genleps_motherid_loadedGen = entryGeneration;
   }
   return *genleps_motherid_;
 }
 
 const vector<int> &StopTree::genleps_motheridx() {
-  if (not genleps_motheridx_isLoaded) {
-    if (genleps_motheridx_branch != 0) {
+  if (genleps_motheridx_loadedGen != entryGeneration) {
+    if (genleps_motheridx_flat.IsActive()) {
+      genleps_motheridx_ = genleps_motheridx_flat.Get(index);
+    } else if (genleps_motheridx_branch != 0) {
       genleps_motheridx_branch->GetEntry(index);
     } else {
       printf("branch genleps_motheridx_branch does not exist!\n");
       exit(1);
     }
-    genleps_motheridx_isLoaded = true;
+    genleps_motheridx_loadedGen = entryGeneration;
   }
   return *genleps_motheridx_;
 }
 
 const vector<int> &StopTree::genleps_motherstatus() {
-  if (not genleps_motherstatus_isLoaded) {
-    if (genleps_motherstatus_branch != 0) {
+  if (genleps_motherstatus_loadedGen != entryGeneration) {
+    if (genleps_motherstatus_flat.IsActive()) {
+      genleps_motherstatus_ = genleps_motherstatus_flat.Get(index);
+    } else if (genleps_motherstatus_branch != 0) {
       genleps_motherstatus_branch->GetEntry(index);
     } else {
       printf("branch genleps_motherstatus_branch does not exist!\n");
       exit(1);
     }
-    genleps_motherstatus_isLoaded = true;
+    genleps_motherstatus_loadedGen = entryGeneration;
   }
   return *genleps_motherstatus_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::genleps_gmotherp4() {
-  if (not genleps_gmotherp4_isLoaded) {
-    if (genleps_gmotherp4_branch != 0) {
+  if (genleps_gmotherp4_loadedGen != entryGeneration) {
+    if (genleps_gmotherp4_flat.IsActive()) {
+      genleps_gmotherp4_ = genleps_gmotherp4_flat.Get(index);
+    } else if (genleps_gmotherp4_branch != 0) {
       genleps_gmotherp4_branch->GetEntry(index);
+    } else if (genleps_gmotherp4_split.IsActive()) {
+      genleps_gmotherp4_ = &genleps_gmotherp4_split.GetP4s(index);
     } else {
       printf("branch genleps_gmotherp4_branch does not exist!\n");
       exit(1);
     }
-    genleps_gmotherp4_isLoaded = true;
+    genleps_gmotherp4_loadedGen = entryGeneration;
   }
   return *genleps_gmotherp4_;
 }
 
+const PolarArrays &StopTree::genleps_gmotherp4_polar() {
+  if (genleps_gmotherp4_polarGen != entryGeneration) {
+    if (genleps_gmotherp4_branch == 0 && genleps_gmotherp4_split.IsActive()) genleps_gmotherp4_split.GetPolar(index, genleps_gmotherp4_polar_);
+    else genleps_gmotherp4_polar_.Fill(genleps_gmotherp4());
+    genleps_gmotherp4_polarGen = entryGeneration;
+  }
+  return genleps_gmotherp4_polar_;
+}
+
 const vector<int> &StopTree::genleps_gmotherid() {
-  if (not genleps_gmotherid_isLoaded) {
-    if (genleps_gmotherid_branch != 0) {
+  if (genleps_gmotherid_loadedGen != entryGeneration) {
+    if (genleps_gmotherid_flat.IsActive()) {
+      genleps_gmotherid_ = genleps_gmotherid_flat.Get(index);
+    } else if (genleps_gmotherid_branch != 0) {
       genleps_gmotherid_branch->GetEntry(index);
     } else {
       printf("branch genleps_gmotherid_branch does not exist!\n");
       exit(1);
     }
-    genleps_gmotherid_isLoaded = true;
+    genleps_gmotherid_loadedGen = entryGeneration;
   }
   return *genleps_gmotherid_;
 }
 
 const vector<int> &StopTree::genleps_gmotheridx() {
-  if (not genleps_gmotheridx_isLoaded) {
-    if (genleps_gmotheridx_branch != 0) {
+  if (genleps_gmotheridx_loadedGen != entryGeneration) {
+    if (genleps_gmotheridx_flat.IsActive()) {
+      genleps_gmotheridx_ = genleps_gmotheridx_flat.Get(index);
+    } else if (genleps_gmotheridx_branch != 0) {
       genleps_gmotheridx_branch->GetEntry(index);
     } else {
       printf("branch genleps_gmotheridx_branch does not exist!\n");
       exit(1);
     }
-    genleps_gmotheridx_isLoaded = true;
+    genleps_gmotheridx_loadedGen = entryGeneration;
   }
   return *genleps_gmotheridx_;
 }
 
 const vector<int> &StopTree::genleps_gmotherstatus() {
-  if (not genleps_gmotherstatus_isLoaded) {
-    if (genleps_gmotherstatus_branch != 0) {
+  if (genleps_gmotherstatus_loadedGen != entryGeneration) {
+    if (genleps_gmotherstatus_flat.IsActive()) {
+      genleps_gmotherstatus_ = genleps_gmotherstatus_flat.Get(index);
+    } else if (genleps_gmotherstatus_branch != 0) {
       genleps_gmotherstatus_branch->GetEntry(index);
     } else {
       printf("branch genleps_gmotherstatus_branch does not exist!\n");
       exit(1);
     }
-    genleps_gmotherstatus_isLoaded = true;
+    genleps_gmotherstatus_loadedGen = entryGeneration;
   }
   return *genleps_gmotherstatus_;
 }
 
 const vector<bool> &StopTree::gennus_isfromt() {
-  if (not gennus_isfromt_isLoaded) {
-    if (gennus_isfromt_branch != 0) {
+  if (gennus_isfromt_loadedGen != entryGeneration) {
+    if (gennus_isfromt_flat.IsActive()) {
+      gennus_isfromt_ = gennus_isfromt_flat.Get(index);
+    } else if (gennus_isfromt_branch != 0) {
       gennus_isfromt_branch->GetEntry(index);
     } else {
       printf("branch gennus_isfromt_branch does not exist!\n");
       exit(1);
     }
-    gennus_isfromt_isLoaded = true;
+    gennus_isfromt_loadedGen = entryGeneration;
   }
   return *gennus_isfromt_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::gennus_p4() {
-  if (not gennus_p4_isLoaded) {
-    if (gennus_p4_branch != 0) {
+  if (gennus_p4_loadedGen != entryGeneration) {
+    if (gennus_p4_flat.IsActive()) {
+      gennus_p4_ = gennus_p4_flat.Get(index);
+    } else if (gennus_p4_branch != 0) {
       gennus_p4_branch->GetEntry(index);
+    } else if (gennus_p4_split.IsActive()) {
+      gennus_p4_ = &gennus_p4_split.GetP4s(index);
     } else {
       printf("branch gennus_p4_branch does not exist!\n");
       exit(1);
     }
-    gennus_p4_isLoaded = true;
+    gennus_p4_loadedGen = entryGeneration;
   }
   return *gennus_p4_;
 }
 
+const PolarArrays &StopTree::gennus_p4_polar() {
+  if (gennus_p4_polarGen != entryGeneration) {
+    if (gennus_p4_branch == 0 && gennus_p4_split.IsActive()) gennus_p4_split.GetPolar(index, gennus_p4_polar_);
+    else gennus_p4_polar_.Fill(gennus_p4());
+    gennus_p4_polarGen = entryGeneration;
+  }
+  return gennus_p4_polar_;
+}
+
 const vector<int> &StopTree::gennus_id() {
-  if (not gennus_id_isLoaded) {
-    if (gennus_id_branch != 0) {
+  if (gennus_id_loadedGen != entryGeneration) {
+    if (gennus_id_flat.IsActive()) {
+      gennus_id_ = gennus_id_flat.Get(index);
+    } else if (gennus_id_branch != 0) {
       gennus_id_branch->GetEntry(index);
     } else {
       printf("branch gennus_id_branch does not exist!\n");
       exit(1);
     }
-    gennus_id_isLoaded = true;
+    gennus_id_loadedGen = entryGeneration;
   }
   return *gennus_id_;
 }
 
 const vector<int> &StopTree::gennus__genpsidx() {
-  if (not gennus__genpsidx_isLoaded) {
-    if (gennus__genpsidx_branch != 0) {
+  if (gennus__genpsidx_loadedGen != entryGeneration) {
+    if (gennus__genpsidx_flat.IsActive()) {
+      gennus__genpsidx_ = gennus__genpsidx_flat.Get(index);
+    } else if (gennus__genpsidx_branch != 0) {
       gennus__genpsidx_branch->GetEntry(index);
     } else {
       printf("branch gennus__genpsidx_branch does not exist!\n");
       exit(1);
     }
-    gennus__genpsidx_isLoaded = true;
+    gennus__genpsidx_loadedGen = entryGeneration;
   }
   return *gennus__genpsidx_;
 }
 
 const vector<int> &StopTree::gennus_status() {
-  if (not gennus_status_isLoaded) {
-    if (gennus_status_branch != 0) {
+  if (gennus_status_loadedGen != entryGeneration) {
+    if (gennus_status_flat.IsActive()) {
+      gennus_status_ = gennus_status_flat.Get(index);
+    } else if (gennus_status_branch != 0) {
       gennus_status_branch->GetEntry(index);
     } else {
       printf("branch gennus_status_branch does not exist!\n");
       exit(1);
     }
-    gennus_status_isLoaded = true;
+    gennus_status_loadedGen = entryGeneration;
   }
   return *gennus_status_;
 }
 
 const vector<bool> &StopTree::gennus_fromHardProcessDecayed() {
-  if (not gennus_fromHardProcessDecayed_isLoaded) {
-    if (gennus_fromHardProcessDecayed_branch != 0) {
+  if (gennus_fromHardProcessDecayed_loadedGen != entryGeneration) {
+    if (gennus_fromHardProcessDecayed_flat.IsActive()) {
+      gennus_fromHardProcessDecayed_ = gennus_fromHardProcessDecayed_flat.Get(index);
+    } else if (gennus_fromHardProcessDecayed_branch != 0) {
       gennus_fromHardProcessDecayed_branch->GetEntry(index);
     } else {
       printf("branch gennus_fromHardProcessDecayed_branch does not exist!\n");
       exit(1);
     }
-    gennus_fromHardProcessDecayed_isLoaded = true;
+    gennus_fromHardProcessDecayed_loadedGen = entryGeneration;
   }
   return *gennus_fromHardProcessDecayed_;
 }
 
 const vector<bool> &StopTree::gennus_fromHardProcessFinalState() {
-  if (not gennus_fromHardProcessFinalState_isLoaded) {
-    if (gennus_fromHardProcessFinalState_branch != 0) {
+  if (gennus_fromHardProcessFinalState_loadedGen != entryGeneration) {
+    if (gennus_fromHardProcessFinalState_flat.IsActive()) {
+      gennus_fromHardProcessFinalState_ = gennus_fromHardProcessFinalState_flat.Get(index);
+    } else if (gennus_fromHardProcessFinalState_branch != 0) {
       gennus_fromHardProcessFinalState_branch->GetEntry(index);
     } else {
       printf("branch gennus_fromHardProcessFinalState_branch does not exist!\n");
       exit(1);
     }
-    gennus_fromHardProcessFinalState_isLoaded = true;
+    gennus_fromHardProcessFinalState_loadedGen = entryGeneration;
   }
   return *gennus_fromHardProcessFinalState_;
 }
 
 const vector<bool> &StopTree::gennus_isHardProcess() {
-  if (not gennus_isHardProcess_isLoaded) {
-    if (gennus_isHardProcess_branch != 0) {
+  if (gennus_isHardProcess_loadedGen != entryGeneration) {
+    if (gennus_isHardProcess_flat.IsActive()) {
+      gennus_isHardProcess_ = gennus_isHardProcess_flat.Get(index);
+    } else if (gennus_isHardProcess_branch != 0) {
       gennus_isHardProcess_branch->GetEntry(index);
     } else {
       printf("branch gennus_isHardProcess_branch does not exist!\n");
       exit(1);
     }
-    gennus_isHardProcess_isLoaded = true;
+    gennus_isHardProcess_loadedGen = entryGeneration;
   }
   return *gennus_isHardProcess_;
 }
 
 const vector<bool> &StopTree::gennus_isLastCopy() {
-  if (not gennus_isLastCopy_isLoaded) {
-    if (gennus_isLastCopy_branch != 0) {
+  if (gennus_isLastCopy_loadedGen != entryGeneration) {
+    if (gennus_isLastCopy_flat.IsActive()) {
+      gennus_isLastCopy_ = gennus_isLastCopy_flat.Get(index);
+    } else if (gennus_isLastCopy_branch != 0) {
       gennus_isLastCopy_branch->GetEntry(index);
     } else {
       printf("branch gennus_isLastCopy_branch does not exist!\n");
       exit(1);
     }
-    gennus_isLastCopy_isLoaded = true;
+    gennus_isLastCopy_loadedGen = entryGeneration;
   }
   return *gennus_isLastCopy_;
 }
 
 const vector<int> &StopTree::gennus_gentaudecay() {
-  if (not gennus_gentaudecay_isLoaded) {
-    if (gennus_gentaudecay_branch != 0) {
+  if (gennus_gentaudecay_loadedGen != entryGeneration) {
+    if (gennus_gentaudecay_flat.IsActive()) {
+      gennus_gentaudecay_ = gennus_gentaudecay_flat.Get(index);
+    } else if (gennus_gentaudecay_branch != 0) {
       gennus_gentaudecay_branch->GetEntry(index);
     } else {
       printf("branch gennus_gentaudecay_branch does not exist!\n");
       exit(1);
     }
-    gennus_gentaudecay_isLoaded = true;
+    gennus_gentaudecay_loadedGen = entryGeneration;
   }
   return *gennus_gentaudecay_;
 }
 
 const int &StopTree::gen_nfromtnus_() {
-  if (not gen_nfromtnus__isLoaded) {
-    if (gen_nfromtnus__branch != 0) {
+  if (gen_nfromtnus__loadedGen != entryGeneration) {
+    if (gen_nfromtnus__flat.IsActive()) {
+      gen_nfromtnus__ = gen_nfromtnus__flat.Get(index);
+    } else if (gen_nfromtnus__bulk != 0) {
+      gen_nfromtnus__ = gen_nfromtnus__bulk->Get<int>(index);
+    } else if (gen_nfromtnus__branch != 0) {
       gen_nfromtnus__branch->GetEntry(index);
     } else {
       printf("branch gen_nfromtnus__branch does not exist!\n");
       exit(1);
     }
-    gen_nfromtnus__isLoaded = true;
+    gen_nfromtnus__loadedGen = entryGeneration;
   }
   return gen_nfromtnus__;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::gennus_motherp4() {
-  if (not gennus_motherp4_isLoaded) {
-    if (gennus_motherp4_branch != 0) {
+  if (gennus_motherp4_loadedGen != entryGeneration) {
+    if (gennus_motherp4_flat.IsActive()) {
+      gennus_motherp4_ = gennus_motherp4_flat.Get(index);
+    } else if (gennus_motherp4_branch != 0) {
       gennus_motherp4_branch->GetEntry(index);
+    } else if (gennus_motherp4_split.IsActive()) {
+      gennus_motherp4_ = &gennus_motherp4_split.GetP4s(index);
     } else {
       printf("branch gennus_motherp4_branch does not exist!\n");
       exit(1);
     }
-    gennus_motherp4_isLoaded = true;
+    gennus_motherp4_loadedGen = entryGeneration;
   }
   return *gennus_motherp4_;
 }
 
+const PolarArrays &StopTree::gennus_motherp4_polar() {
+  if (gennus_motherp4_polarGen != entryGeneration) {
+    if (gennus_motherp4_branch == 0 && gennus_motherp4_split.IsActive()) gennus_motherp4_split.GetPolar(index, gennus_motherp4_polar_);
+    else gennus_motherp4_polar_.Fill(gennus_motherp4());
+    gennus_motherp4_polarGen = entryGeneration;
+  }
+  return gennus_motherp4_polar_;
+}
+
 const vector<int> &StopTree::gennus_motherid() {
-  if (not gennus_motherid_isLoaded) {
-    if (gennus_motherid_branch != 0) {
+  if (gennus_motherid_loadedGen != entryGeneration) {
+    if (gennus_motherid_flat.IsActive()) {
+      gennus_motherid_ = gennus_motherid_flat.Get(index);
+    } else if (gennus_motherid_branch != 0) {
       gennus_motherid_branch->GetEntry(index);
     } else {
       printf("branch gennus_motherid_branch does not exist!\n");
       exit(1);
     }
-    gennus_motherid_isLoaded = true;
+    gennus_motherid_loadedGen = entryGeneration;
   }
   return *gennus_motherid_;
 }
 
 const vector<int> &StopTree::gennus_motheridx() {
-  if (not gennus_motheridx_isLoaded) {
-    if (gennus_motheridx_branch != 0) {
+  if (gennus_motheridx_loadedGen != entryGeneration) {
+    if (gennus_motheridx_flat.IsActive()) {
+      gennus_motheridx_ = gennus_motheridx_flat.Get(index);
+    } else if (gennus_motheridx_branch != 0) {
       gennus_motheridx_branch->GetEntry(index);
     } else {
       printf("branch gennus_motheridx_branch does not exist!\n");
       exit(1);
     }
-    gennus_motheridx_isLoaded = true;
+    gennus_motheridx_loadedGen = entryGeneration;
   }
   return *gennus_motheridx_;
 }
 
 const vector<int> &StopTree::gennus_motherstatus() {
-  if (not gennus_motherstatus_isLoaded) {
-    if (gennus_motherstatus_branch != 0) {
+  if (gennus_motherstatus_loadedGen != entryGeneration) {
+    if (gennus_motherstatus_flat.IsActive()) {
+      gennus_motherstatus_ = gennus_motherstatus_flat.Get(index);
+    } else if (gennus_motherstatus_branch != 0) {
       gennus_motherstatus_branch->GetEntry(index);
     } else {
       printf("branch gennus_motherstatus_branch does not exist!\n");
       exit(1);
     }
-    gennus_motherstatus_isLoaded = true;
+    gennus_motherstatus_loadedGen = entryGeneration;
   }
   return *gennus_motherstatus_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::gennus_gmotherp4() {
-  if (not gennus_gmotherp4_isLoaded) {
-    if (gennus_gmotherp4_branch != 0) {
+  if (gennus_gmotherp4_loadedGen != entryGeneration) {
+    if (gennus_gmotherp4_flat.IsActive()) {
+      gennus_gmotherp4_ = gennus_gmotherp4_flat.Get(index);
+    } else if (gennus_gmotherp4_branch != 0) {
       gennus_gmotherp4_branch->GetEntry(index);
+    } else if (gennus_gmotherp4_split.IsActive()) {
+      gennus_gmotherp4_ = &gennus_gmotherp4_split.GetP4s(index);
     } else {
       printf("branch gennus_gmotherp4_branch does not exist!\n");
       exit(1);
     }
-    gennus_gmotherp4_isLoaded = true;
+    gennus_gmotherp4_loadedGen = entryGeneration;
   }
   return *gennus_gmotherp4_;
 }
 
+const PolarArrays &StopTree::gennus_gmotherp4_polar() {
+  if (gennus_gmotherp4_polarGen != entryGeneration) {
+    if (gennus_gmotherp4_branch == 0 && gennus_gmotherp4_split.IsActive()) gennus_gmotherp4_split.GetPolar(index, gennus_gmotherp4_polar_);
+    else gennus_gmotherp4_polar_.Fill(gennus_gmotherp4());
+    gennus_gmotherp4_polarGen = entryGeneration;
+  }
+  return gennus_gmotherp4_polar_;
+}
+
 const vector<int> &StopTree::gennus_gmotherid() {
-  if (not gennus_gmotherid_isLoaded) {
-    if (gennus_gmotherid_branch != 0) {
+  if (gennus_gmotherid_loadedGen != entryGeneration) {
+    if (gennus_gmotherid_flat.IsActive()) {
+      gennus_gmotherid_ = gennus_gmotherid_flat.Get(index);
+    } else if (gennus_gmotherid_branch != 0) {
       gennus_gmotherid_branch->GetEntry(index);
     } else {
       printf("branch gennus_gmotherid_branch does not exist!\n");
       exit(1);
     }
-    gennus_gmotherid_isLoaded = true;
+    gennus_gmotherid_loadedGen = entryGeneration;
   }
   return *gennus_gmotherid_;
 }
 
 const vector<int> &StopTree::gennus_gmotheridx() {
-  if (not gennus_gmotheridx_isLoaded) {
-    if (gennus_gmotheridx_branch != 0) {
+  if (gennus_gmotheridx_loadedGen != entryGeneration) {
+    if (gennus_gmotheridx_flat.IsActive()) {
+      gennus_gmotheridx_ = gennus_gmotheridx_flat.Get(index);
+    } else if (gennus_gmotheridx_branch != 0) {
       gennus_gmotheridx_branch->GetEntry(index);
     } else {
       printf("branch gennus_gmotheridx_branch does not exist!\n");
       exit(1);
     }
-    gennus_gmotheridx_isLoaded = true;
+    gennus_gmotheridx_loadedGen = entryGeneration;
   }
   return *gennus_gmotheridx_;
 }
 
 const vector<int> &StopTree::gennus_gmotherstatus() {
-  if (not gennus_gmotherstatus_isLoaded) {
-    if (gennus_gmotherstatus_branch != 0) {
+  if (gennus_gmotherstatus_loadedGen != entryGeneration) {
+    if (gennus_gmotherstatus_flat.IsActive()) {
+      gennus_gmotherstatus_ = gennus_gmotherstatus_flat.Get(index);
+    } else if (gennus_gmotherstatus_branch != 0) {
       gennus_gmotherstatus_branch->GetEntry(index);
     } else {
       printf("branch gennus_gmotherstatus_branch does not exist!\n");
       exit(1);
     }
-    gennus_gmotherstatus_isLoaded = true;
+    gennus_gmotherstatus_loadedGen = entryGeneration;
   }
   return *gennus_gmotherstatus_;
 }
 
 const vector<bool> &StopTree::genqs_isfromt() {
-  if (not genqs_isfromt_isLoaded) {
-    if (genqs_isfromt_branch != 0) {
+  if (genqs_isfromt_loadedGen != entryGeneration) {
+    if (genqs_isfromt_flat.IsActive()) {
+      genqs_isfromt_ = genqs_isfromt_flat.Get(index);
+    } else if (genqs_isfromt_branch != 0) {
       genqs_isfromt_branch->GetEntry(index);
     } else {
       printf("branch genqs_isfromt_branch does not exist!\n");
       exit(1);
     }
-    genqs_isfromt_isLoaded = true;
+    genqs_isfromt_loadedGen = entryGeneration;
   }
   return *genqs_isfromt_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::genqs_p4() {
-  if (not genqs_p4_isLoaded) {
-    if (genqs_p4_branch != 0) {
+  if (genqs_p4_loadedGen != entryGeneration) {
+    if (genqs_p4_flat.IsActive()) {
+      genqs_p4_ = genqs_p4_flat.Get(index);
+    } else if (genqs_p4_branch != 0) {
       genqs_p4_branch->GetEntry(index);
+    } else if (genqs_p4_split.IsActive()) {
+      genqs_p4_ = &genqs_p4_split.GetP4s(index);
     } else {
       printf("branch genqs_p4_branch does not exist!\n");
       exit(1);
     }
-    genqs_p4_isLoaded = true;
+    genqs_p4_loadedGen = entryGeneration;
   }
   return *genqs_p4_;
 }
 
+const PolarArrays &StopTree::genqs_p4_polar() {
+  if (genqs_p4_polarGen != entryGeneration) {
+    if (genqs_p4_branch == 0 && genqs_p4_split.IsActive()) genqs_p4_split.GetPolar(index, genqs_p4_polar_);
+    else genqs_p4_polar_.Fill(genqs_p4());
+    genqs_p4_polarGen = entryGeneration;
+  }
+  return genqs_p4_polar_;
+}
+
 const vector<int> &StopTree::genqs_id() {
-  if (not genqs_id_isLoaded) {
-    if (genqs_id_branch != 0) {
+  if (genqs_id_loadedGen != entryGeneration) {
+    if (genqs_id_flat.IsActive()) {
+      genqs_id_ = genqs_id_flat.Get(index);
+    } else if (genqs_id_branch != 0) {
       genqs_id_branch->GetEntry(index);
     } else {
       printf("branch genqs_id_branch does not exist!\n");
       exit(1);
     }
-    genqs_id_isLoaded = true;
+    genqs_id_loadedGen = entryGeneration;
   }
   return *genqs_id_;
 }
 
 const vector<int> &StopTree::genqs__genpsidx() {
-  if (not genqs__genpsidx_isLoaded) {
-    if (genqs__genpsidx_branch != 0) {
+  if (genqs__genpsidx_loadedGen != entryGeneration) {
+    if (genqs__genpsidx_flat.IsActive()) {
+      genqs__genpsidx_ = genqs__genpsidx_flat.Get(index);
+    } else if (genqs__genpsidx_branch != 0) {
       genqs__genpsidx_branch->GetEntry(index);
     } else {
       printf("branch genqs__genpsidx_branch does not exist!\n");
       exit(1);
     }
-    genqs__genpsidx_isLoaded = true;
+    genqs__genpsidx_loadedGen = entryGeneration;
   }
   return *genqs__genpsidx_;
 }
 
 const vector<int> &StopTree::genqs_status() {
-  if (not genqs_status_isLoaded) {
-    if (genqs_status_branch != 0) {
+  if (genqs_status_loadedGen != entryGeneration) {
+    if (genqs_status_flat.IsActive()) {
+      genqs_status_ = genqs_status_flat.Get(index);
+    } else if (genqs_status_branch != 0) {
       genqs_status_branch->GetEntry(index);
     } else {
       printf("branch genqs_status_branch does not exist!\n");
       exit(1);
     }
-    genqs_status_isLoaded = true;
+    genqs_status_loadedGen = entryGeneration;
   }
   return *genqs_status_;
 }
 
 const vector<bool> &StopTree::genqs_fromHardProcessDecayed() {
-  if (not genqs_fromHardProcessDecayed_isLoaded) {
-    if (genqs_fromHardProcessDecayed_branch != 0) {
+  if (genqs_fromHardProcessDecayed_loadedGen != entryGeneration) {
+    if (genqs_fromHardProcessDecayed_flat.IsActive()) {
+      genqs_fromHardProcessDecayed_ = genqs_fromHardProcessDecayed_flat.Get(index);
+    } else if (genqs_fromHardProcessDecayed_branch != 0) {
       genqs_fromHardProcessDecayed_branch->GetEntry(index);
     } else {
       printf("branch genqs_fromHardProcessDecayed_branch does not exist!\n");
       exit(1);
     }
-    genqs_fromHardProcessDecayed_isLoaded = true;
+    genqs_fromHardProcessDecayed_loadedGen = entryGeneration;
   }
   return *genqs_fromHardProcessDecayed_;
 }
 
 const vector<bool> &StopTree::genqs_fromHardProcessFinalState() {
-  if (not genqs_fromHardProcessFinalState_isLoaded) {
-    if (genqs_fromHardProcessFinalState_branch != 0) {
+  if (genqs_fromHardProcessFinalState_loadedGen != entryGeneration) {
+    if (genqs_fromHardProcessFinalState_flat.IsActive()) {
+      genqs_fromHardProcessFinalState_ = genqs_fromHardProcessFinalState_flat.Get(index);
+    } else if (genqs_fromHardProcessFinalState_branch != 0) {
       genqs_fromHardProcessFinalState_branch->GetEntry(index);
     } else {
       printf("branch genqs_fromHardProcessFinalState_branch does not exist!\n");
       exit(1);
     }
-    genqs_fromHardProcessFinalState_isLoaded = true;
+    genqs_fromHardProcessFinalState_loadedGen = entryGeneration;
   }
   return *genqs_fromHardProcessFinalState_;
 }
 
 const vector<bool> &StopTree::genqs_isHardProcess() {
-  if (not genqs_isHardProcess_isLoaded) {
-    if (genqs_isHardProcess_branch != 0) {
+  if (genqs_isHardProcess_loadedGen != entryGeneration) {
+    if (genqs_isHardProcess_flat.IsActive()) {
+      genqs_isHardProcess_ = genqs_isHardProcess_flat.Get(index);
+    } else if (genqs_isHardProcess_branch != 0) {
       genqs_isHardProcess_branch->GetEntry(index);
     } else {
       printf("branch genqs_isHardProcess_branch does not exist!\n");
       exit(1);
     }
-    genqs_isHardProcess_isLoaded = true;
+    genqs_isHardProcess_loadedGen = entryGeneration;
   }
   return *genqs_isHardProcess_;
 }
 
 const vector<bool> &StopTree::genqs_isLastCopy() {
-  if (not genqs_isLastCopy_isLoaded) {
-    if (genqs_isLastCopy_branch != 0) {
+  if (genqs_isLastCopy_loadedGen != entryGeneration) {
+    if (genqs_isLastCopy_flat.IsActive()) {
+      genqs_isLastCopy_ = genqs_isLastCopy_flat.Get(index);
+    } else if (genqs_isLastCopy_branch != 0) {
       genqs_isLastCopy_branch->GetEntry(index);
     } else {
       printf("branch genqs_isLastCopy_branch does not exist!\n");
       exit(1);
     }
-    genqs_isLastCopy_isLoaded = true;
+    genqs_isLastCopy_loadedGen = entryGeneration;
   }
   return *genqs_isLastCopy_;
 }
 
 const vector<int> &StopTree::genqs_gentaudecay() {
-  if (not genqs_gentaudecay_isLoaded) {
-    if (genqs_gentaudecay_branch != 0) {
+  if (genqs_gentaudecay_loadedGen != entryGeneration) {
+    if (genqs_gentaudecay_flat.IsActive()) {
+      genqs_gentaudecay_ = genqs_gentaudecay_flat.Get(index);
+    } else if (genqs_gentaudecay_branch != 0) {
       genqs_gentaudecay_branch->GetEntry(index);
     } else {
       printf("branch genqs_gentaudecay_branch does not exist!\n");
       exit(1);
     }
-    genqs_gentaudecay_isLoaded = true;
+    genqs_gentaudecay_loadedGen = entryGeneration;
   }
   return *genqs_gentaudecay_;
 }
 
 const int &StopTree::gen_nfromtqs_() {
-  if (not gen_nfromtqs__isLoaded) {
-    if (gen_nfromtqs__branch != 0) {
+  if (gen_nfromtqs__loadedGen != entryGeneration) {
+    if (gen_nfromtqs__flat.IsActive()) {
+      gen_nfromtqs__ = gen_nfromtqs__flat.Get(index);
+    } else if (gen_nfromtqs__bulk != 0) {
+      gen_nfromtqs__ = gen_nfromtqs__bulk->Get<int>(index);
+    } else if (gen_nfromtqs__branch != 0) {
       gen_nfromtqs__branch->GetEntry(index);
     } else {
       printf("branch gen_nfromtqs__branch does not exist!\n");
       exit(1);
     }
-    gen_nfromtqs__isLoaded = true;
+    gen_nfromtqs__loadedGen = entryGeneration;
   }
   return gen_nfromtqs__;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::genqs_motherp4() {
-  if (not genqs_motherp4_isLoaded) {
-    if (genqs_motherp4_branch != 0) {
+  if (genqs_motherp4_loadedGen != entryGeneration) {
+    if (genqs_motherp4_flat.IsActive()) {
+      genqs_motherp4_ = genqs_motherp4_flat.Get(index);
+    } else if (genqs_motherp4_branch != 0) {
       genqs_motherp4_branch->GetEntry(index);
+    } else if (genqs_motherp4_split.IsActive()) {
+      genqs_motherp4_ = &genqs_motherp4_split.GetP4s(index);
     } else {
       printf("branch genqs_motherp4_branch does not exist!\n");
       exit(1);
     }
-    genqs_motherp4_isLoaded = true;
+    genqs_motherp4_loadedGen = entryGeneration;
   }
   return *genqs_motherp4_;
 }
 
+const PolarArrays &StopTree::genqs_motherp4_polar() {
+  if (genqs_motherp4_polarGen != entryGeneration) {
+    if (genqs_motherp4_branch == 0 && genqs_motherp4_split.IsActive()) genqs_motherp4_split.GetPolar(index, genqs_motherp4_polar_);
+    else genqs_motherp4_polar_.Fill(genqs_motherp4());
+    genqs_motherp4_polarGen = entryGeneration;
+  }
+  return genqs_motherp4_polar_;
+}
+
 const vector<int> &StopTree::genqs_motherid() {
-  if (not genqs_motherid_isLoaded) {
-    if (genqs_motherid_branch != 0) {
+  if (genqs_motherid_loadedGen != entryGeneration) {
+    if (genqs_motherid_flat.IsActive()) {
+      genqs_motherid_ = genqs_motherid_flat.Get(index);
+    } else if (genqs_motherid_branch != 0) {
       genqs_motherid_branch->GetEntry(index);
     } else {
       printf("branch genqs_motherid_branch does not exist!\n");
       exit(1);
     }
-    genqs_motherid_isLoaded = true;
+    genqs_motherid_loadedGen = entryGeneration;
   }
   return *genqs_motherid_;
 }
 
 const vector<int> &StopTree::genqs_motheridx() {
-  if (not genqs_motheridx_isLoaded) {
-    if (genqs_motheridx_branch != 0) {
+  if (genqs_motheridx_loadedGen != entryGeneration) {
+    if (genqs_motheridx_flat.IsActive()) {
+      genqs_motheridx_ = genqs_motheridx_flat.Get(index);
+    } else if (genqs_motheridx_branch != 0) {
       genqs_motheridx_branch->GetEntry(index);
     } else {
       printf("branch genqs_motheridx_branch does not exist!\n");
       exit(1);
     }
-    genqs_motheridx_isLoaded = true;
+    genqs_motheridx_loadedGen = entryGeneration;
   }
   return *genqs_motheridx_;
 }
 
 const vector<int> &StopTree::genqs_motherstatus() {
-  if (not genqs_motherstatus_isLoaded) {
-    if (genqs_motherstatus_branch != 0) {
+  if (genqs_motherstatus_loadedGen != entryGeneration) {
+    if (genqs_motherstatus_flat.IsActive()) {
+      genqs_motherstatus_ = genqs_motherstatus_flat.Get(index);
+    } else if (genqs_motherstatus_branch != 0) {
       genqs_motherstatus_branch->GetEntry(index);
     } else {
       printf("branch genqs_motherstatus_branch does not exist!\n");
       exit(1);
     }
-    genqs_motherstatus_isLoaded = true;
+    genqs_motherstatus_loadedGen = entryGeneration;
   }
   return *genqs_motherstatus_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::genqs_gmotherp4() {
-  if (not genqs_gmotherp4_isLoaded) {
-    if (genqs_gmotherp4_branch != 0) {
+  if (genqs_gmotherp4_loadedGen != entryGeneration) {
+    if (genqs_gmotherp4_flat.IsActive()) {
+      genqs_gmotherp4_ = genqs_gmotherp4_flat.Get(index);
+    } else if (genqs_gmotherp4_branch != 0) {
       genqs_gmotherp4_branch->GetEntry(index);
+    } else if (genqs_gmotherp4_split.IsActive()) {
+      genqs_gmotherp4_ = &genqs_gmotherp4_split.GetP4s(index);
     } else {
       printf("branch genqs_gmotherp4_branch does not exist!\n");
       exit(1);
     }
-    genqs_gmotherp4_isLoaded = true;
+    genqs_gmotherp4_loadedGen = entryGeneration;
   }
   return *genqs_gmotherp4_;
 }
 
+const PolarArrays &StopTree::genqs_gmotherp4_polar() {
+  if (genqs_gmotherp4_polarGen != entryGeneration) {
+    if (genqs_gmotherp4_branch == 0 && genqs_gmotherp4_split.IsActive()) genqs_gmotherp4_split.GetPolar(index, genqs_gmotherp4_polar_);
+    else genqs_gmotherp4_polar_.Fill(genqs_gmotherp4());
+    genqs_gmotherp4_polarGen = entryGeneration;
+  }
+  return genqs_gmotherp4_polar_;
+}
+
 const vector<int> &StopTree::genqs_gmotherid() {
-  if (not genqs_gmotherid_isLoaded) {
-    if (genqs_gmotherid_branch != 0) {
+  if (genqs_gmotherid_loadedGen != entryGeneration) {
+    if (genqs_gmotherid_flat.IsActive()) {
+      genqs_gmotherid_ = genqs_gmotherid_flat.Get(index);
+    } else if (genqs_gmotherid_branch != 0) {
       genqs_gmotherid_branch->GetEntry(index);
     } else {
       printf("branch genqs_gmotherid_branch does not exist!\n");
       exit(1);
     }
-    genqs_gmotherid_isLoaded = true;
+    genqs_gmotherid_loadedGen = entryGeneration;
   }
   return *genqs_gmotherid_;
 }
 
 const vector<int> &StopTree::genqs_gmotheridx() {
-  if (not genqs_gmotheridx_isLoaded) {
-    if (genqs_gmotheridx_branch != 0) {
+  if (genqs_gmotheridx_loadedGen != entryGeneration) {
+    if (genqs_gmotheridx_flat.IsActive()) {
+      genqs_gmotheridx_ = genqs_gmotheridx_flat.Get(index);
+    } else if (genqs_gmotheridx_branch != 0) {
       genqs_gmotheridx_branch->GetEntry(index);
     } else {
       printf("branch genqs_gmotheridx_branch does not exist!\n");
       exit(1);
     }
-    genqs_gmotheridx_isLoaded = true;
+    genqs_gmotheridx_loadedGen = entryGeneration;
   }
   return *genqs_gmotheridx_;
 }
 
 const vector<int> &StopTree::genqs_gmotherstatus() {
-  if (not genqs_gmotherstatus_isLoaded) {
-    if (genqs_gmotherstatus_branch != 0) {
+  if (genqs_gmotherstatus_loadedGen != entryGeneration) {
+    if (genqs_gmotherstatus_flat.IsActive()) {
+      genqs_gmotherstatus_ = genqs_gmotherstatus_flat.Get(index);
+    } else if (genqs_gmotherstatus_branch != 0) {
       genqs_gmotherstatus_branch->GetEntry(index);
     } else {
       printf("branch genqs_gmotherstatus_branch does not exist!\n");
       exit(1);
     }
-    genqs_gmotherstatus_isLoaded = true;
+    genqs_gmotherstatus_loadedGen = entryGeneration;
   }
   return *genqs_gmotherstatus_;
 }
 
 const vector<bool> &StopTree::genbosons_isfromt() {
-  if (not genbosons_isfromt_isLoaded) {
-    if (genbosons_isfromt_branch != 0) {
+  if (genbosons_isfromt_loadedGen != entryGeneration) {
+    if (genbosons_isfromt_flat.IsActive()) {
+      genbosons_isfromt_ = genbosons_isfromt_flat.Get(index);
+    } else if (genbosons_isfromt_branch != 0) {
       genbosons_isfromt_branch->GetEntry(index);
     } else {
       printf("branch genbosons_isfromt_branch does not exist!\n");
       exit(1);
     }
-    genbosons_isfromt_isLoaded = true;
+    genbosons_isfromt_loadedGen = entryGeneration;
   }
   return *genbosons_isfromt_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::genbosons_p4() {
-  if (not genbosons_p4_isLoaded) {
-    if (genbosons_p4_branch != 0) {
+  if (genbosons_p4_loadedGen != entryGeneration) {
+    if (genbosons_p4_flat.IsActive()) {
+      genbosons_p4_ = genbosons_p4_flat.Get(index);
+    } else if (genbosons_p4_branch != 0) {
       genbosons_p4_branch->GetEntry(index);
+    } else if (genbosons_p4_split.IsActive()) {
+      genbosons_p4_ = &genbosons_p4_split.GetP4s(index);
     } else {
       printf("branch genbosons_p4_branch does not exist!\n");
       exit(1);
     }
-    genbosons_p4_isLoaded = true;
+    genbosons_p4_loadedGen = entryGeneration;
   }
   return *genbosons_p4_;
 }
 
+const PolarArrays &StopTree::genbosons_p4_polar() {
+  if (genbosons_p4_polarGen != entryGeneration) {
+    if (genbosons_p4_branch == 0 && genbosons_p4_split.IsActive()) genbosons_p4_split.GetPolar(index, genbosons_p4_polar_);
+    else genbosons_p4_polar_.Fill(genbosons_p4());
+    genbosons_p4_polarGen = entryGeneration;
+  }
+  return genbosons_p4_polar_;
+}
+
 const vector<int> &StopTree::genbosons_id() {
-  if (not genbosons_id_isLoaded) {
-    if (genbosons_id_branch != 0) {
+  if (genbosons_id_loadedGen != entryGeneration) {
+    if (genbosons_id_flat.IsActive()) {
+      genbosons_id_ = genbosons_id_flat.Get(index);
+    } else if (genbosons_id_branch != 0) {
       genbosons_id_branch->GetEntry(index);
     } else {
       printf("branch genbosons_id_branch does not exist!\n");
       exit(1);
     }
-    genbosons_id_isLoaded = true;
+    genbosons_id_loadedGen = entryGeneration;
   }
   return *genbosons_id_;
 }
 
 const vector<int> &StopTree::genbosons__genpsidx() {
-  if (not genbosons__genpsidx_isLoaded) {
-    if (genbosons__genpsidx_branch != 0) {
+  if (genbosons__genpsidx_loadedGen != entryGeneration) {
+    if (genbosons__genpsidx_flat.IsActive()) {
+      genbosons__genpsidx_ = genbosons__genpsidx_flat.Get(index);
+    } else if (genbosons__genpsidx_branch != 0) {
       genbosons__genpsidx_branch->GetEntry(index);
     } else {
       printf("branch genbosons__genpsidx_branch does not exist!\n");
       exit(1);
     }
-    genbosons__genpsidx_isLoaded = true;
+    genbosons__genpsidx_loadedGen = entryGeneration;
   }
   return *genbosons__genpsidx_;
 }
 
 const vector<int> &StopTree::genbosons_status() {
-  if (not genbosons_status_isLoaded) {
-    if (genbosons_status_branch != 0) {
+  if (genbosons_status_loadedGen != entryGeneration) {
+    if (genbosons_status_flat.IsActive()) {
+      genbosons_status_ = genbosons_status_flat.Get(index);
+    } else if (genbosons_status_branch != 0) {
       genbosons_status_branch->GetEntry(index);
     } else {
       printf("branch genbosons_status_branch does not exist!\n");
       exit(1);
     }
-    genbosons_status_isLoaded = true;
+    genbosons_status_loadedGen = entryGeneration;
   }
   return *genbosons_status_;
 }
 
 const vector<bool> &StopTree::genbosons_fromHardProcessDecayed() {
-  if (not genbosons_fromHardProcessDecayed_isLoaded) {
-    if (genbosons_fromHardProcessDecayed_branch != 0) {
+  if (genbosons_fromHardProcessDecayed_loadedGen != entryGeneration) {
+    if (genbosons_fromHardProcessDecayed_flat.IsActive()) {
+      genbosons_fromHardProcessDecayed_ = genbosons_fromHardProcessDecayed_flat.Get(index);
+    } else if (genbosons_fromHardProcessDecayed_branch != 0) {
       genbosons_fromHardProcessDecayed_branch->GetEntry(index);
     } else {
       printf("branch genbosons_fromHardProcessDecayed_branch does not exist!\n");
       exit(1);
     }
-    genbosons_fromHardProcessDecayed_isLoaded = true;
+    genbosons_fromHardProcessDecayed_loadedGen = entryGeneration;
   }
   return *genbosons_fromHardProcessDecayed_;
 }
 
 const vector<bool> &StopTree::genbosons_fromHardProcessFinalState() {
-  if (not genbosons_fromHardProcessFinalState_isLoaded) {
-    if (genbosons_fromHardProcessFinalState_branch != 0) {
+  if (genbosons_fromHardProcessFinalState_loadedGen != entryGeneration) {
+    if (genbosons_fromHardProcessFinalState_flat.IsActive()) {
+      genbosons_fromHardProcessFinalState_ = genbosons_fromHardProcessFinalState_flat.Get(index);
+    } else if (genbosons_fromHardProcessFinalState_branch != 0) {
       genbosons_fromHardProcessFinalState_branch->GetEntry(index);
     } else {
       printf("branch genbosons_fromHardProcessFinalState_branch does not exist!\n");
       exit(1);
     }
-    genbosons_fromHardProcessFinalState_isLoaded = true;
+    genbosons_fromHardProcessFinalState_loadedGen = entryGeneration;
   }
   return *genbosons_fromHardProcessFinalState_;
 }
 
 const vector<bool> &StopTree::genbosons_isHardProcess() {
-  if (not genbosons_isHardProcess_isLoaded) {
-    if (genbosons_isHardProcess_branch != 0) {
+  if (genbosons_isHardProcess_loadedGen != entryGeneration) {
+    if (genbosons_isHardProcess_flat.IsActive()) {
+      genbosons_isHardProcess_ = genbosons_isHardProcess_flat.Get(index);
+    } else if (genbosons_isHardProcess_branch != 0) {
       genbosons_isHardProcess_branch->GetEntry(index);
     } else {
       printf("branch genbosons_isHardProcess_branch does not exist!\n");
       exit(1);
     }
-    genbosons_isHardProcess_isLoaded = true;
+    genbosons_isHardProcess_loadedGen = entryGeneration;
   }
   return *genbosons_isHardProcess_;
 }
 
 const vector<bool> &StopTree::genbosons_isLastCopy() {
-  if (not genbosons_isLastCopy_isLoaded) {
-    if (genbosons_isLastCopy_branch != 0) {
+  if (genbosons_isLastCopy_loadedGen != entryGeneration) {
+    if (genbosons_isLastCopy_flat.IsActive()) {
+      genbosons_isLastCopy_ = genbosons_isLastCopy_flat.Get(index);
+    } else if (genbosons_isLastCopy_branch != 0) {
       genbosons_isLastCopy_branch->GetEntry(index);
     } else {
       printf("branch genbosons_isLastCopy_branch does not exist!\n");
       exit(1);
     }
-    genbosons_isLastCopy_isLoaded = true;
+    genbosons_isLastCopy_loadedGen = entryGeneration;
   }
   return *genbosons_isLastCopy_;
 }
 
 const vector<int> &StopTree::genbosons_gentaudecay() {
-  if (not genbosons_gentaudecay_isLoaded) {
-    if (genbosons_gentaudecay_branch != 0) {
+  if (genbosons_gentaudecay_loadedGen != entryGeneration) {
+    if (genbosons_gentaudecay_flat.IsActive()) {
+      genbosons_gentaudecay_ = genbosons_gentaudecay_flat.Get(index);
+    } else if (genbosons_gentaudecay_branch != 0) {
       genbosons_gentaudecay_branch->GetEntry(index);
     } else {
       printf("branch genbosons_gentaudecay_branch does not exist!\n");
       exit(1);
     }
-    genbosons_gentaudecay_isLoaded = true;
+    genbosons_gentaudecay_loadedGen = entryGeneration;
   }
   return *genbosons_gentaudecay_;
 }
 
 const int &StopTree::gen_nfromtbosons_() {
-  if (not gen_nfromtbosons__isLoaded) {
-    if (gen_nfromtbosons__branch != 0) {
+  if (gen_nfromtbosons__loadedGen != entryGeneration) {
+    if (gen_nfromtbosons__flat.IsActive()) {
+      gen_nfromtbosons__ = gen_nfromtbosons__flat.Get(index);
+    } else if (gen_nfromtbosons__bulk != 0) {
+      gen_nfromtbosons__ = gen_nfromtbosons__bulk->Get<int>(index);
+    } else if (gen_nfromtbosons__branch != 0) {
       gen_nfromtbosons__branch->GetEntry(index);
     } else {
       printf("branch gen_nfromtbosons__branch does not exist!\n");
       exit(1);
     }
-    gen_nfromtbosons__isLoaded = true;
+    gen_nfromtbosons__loadedGen = entryGeneration;
   }
   return gen_nfromtbosons__;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::genbosons_motherp4() {
-  if (not genbosons_motherp4_isLoaded) {
-    if (genbosons_motherp4_branch != 0) {
+  if (genbosons_motherp4_loadedGen != entryGeneration) {
+    if (genbosons_motherp4_flat.IsActive()) {
+      genbosons_motherp4_ = genbosons_motherp4_flat.Get(index);
+    } else if (genbosons_motherp4_branch != 0) {
       genbosons_motherp4_branch->GetEntry(index);
+    } else if (genbosons_motherp4_split.IsActive()) {
+      genbosons_motherp4_ = &genbosons_motherp4_split.GetP4s(index);
     } else {
       printf("branch genbosons_motherp4_branch does not exist!\n");
       exit(1);
     }
-    genbosons_motherp4_isLoaded = true;
+    genbosons_motherp4_loadedGen = entryGeneration;
   }
   return *genbosons_motherp4_;
 }
 
+const PolarArrays &StopTree::genbosons_motherp4_polar() {
+  if (genbosons_motherp4_polarGen != entryGeneration) {
+    if (genbosons_motherp4_branch == 0 && genbosons_motherp4_split.IsActive()) genbosons_motherp4_split.GetPolar(index, genbosons_motherp4_polar_);
+    else genbosons_motherp4_polar_.Fill(genbosons_motherp4());
+    genbosons_motherp4_polarGen = entryGeneration;
+  }
+  return genbosons_motherp4_polar_;
+}
+
 const vector<int> &StopTree::genbosons_motherid() {
-  if (not genbosons_motherid_isLoaded) {
-    if (genbosons_motherid_branch != 0) {
+  if (genbosons_motherid_loadedGen != entryGeneration) {
+    if (genbosons_motherid_flat.IsActive()) {
+      genbosons_motherid_ = genbosons_motherid_flat.Get(index);
+    } else if (genbosons_motherid_branch != 0) {
       genbosons_motherid_branch->GetEntry(index);
     } else {
       printf("branch genbosons_motherid_branch does not exist!\n");
       exit(1);
     }
-    genbosons_motherid_isLoaded = true;
+    genbosons_motherid_loadedGen = entryGeneration;
   }
   return *genbosons_motherid_;
 }
 
 const vector<int> &StopTree::genbosons_motheridx() {
-  if (not genbosons_motheridx_isLoaded) {
-    if (genbosons_motheridx_branch != 0) {
+  if (genbosons_motheridx_loadedGen != entryGeneration) {
+    if (genbosons_motheridx_flat.IsActive()) {
+      genbosons_motheridx_ = genbosons_motheridx_flat.Get(index);
+    } else if (genbosons_motheridx_branch != 0) {
       genbosons_motheridx_branch->GetEntry(index);
     } else {
       printf("branch genbosons_motheridx_branch does not exist!\n");
       exit(1);
     }
-    genbosons_motheridx_isLoaded = true;
+    genbosons_motheridx_loadedGen = entryGeneration;
   }
   return *genbosons_motheridx_;
 }
 
 const vector<int> &StopTree::genbosons_motherstatus() {
-  if (not genbosons_motherstatus_isLoaded) {
-    if (genbosons_motherstatus_branch != 0) {
+  if (genbosons_motherstatus_loadedGen != entryGeneration) {
+    if (genbosons_motherstatus_flat.IsActive()) {
+      genbosons_motherstatus_ = genbosons_motherstatus_flat.Get(index);
+    } else if (genbosons_motherstatus_branch != 0) {
       genbosons_motherstatus_branch->GetEntry(index);
     } else {
       printf("branch genbosons_motherstatus_branch does not exist!\n");
       exit(1);
     }
-    genbosons_motherstatus_isLoaded = true;
+    genbosons_motherstatus_loadedGen = entryGeneration;
   }
   return *genbosons_motherstatus_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::genbosons_gmotherp4() {
-  if (not genbosons_gmotherp4_isLoaded) {
-    if (genbosons_gmotherp4_branch != 0) {
+  if (genbosons_gmotherp4_loadedGen != entryGeneration) {
+    if (genbosons_gmotherp4_flat.IsActive()) {
+      genbosons_gmotherp4_ = genbosons_gmotherp4_flat.Get(index);
+    } else if (genbosons_gmotherp4_branch != 0) {
       genbosons_gmotherp4_branch->GetEntry(index);
+    } else if (genbosons_gmotherp4_split.IsActive()) {
+      genbosons_gmotherp4_ = &genbosons_gmotherp4_split.GetP4s(index);
     } else {
       printf("branch genbosons_gmotherp4_branch does not exist!\n");
       exit(1);
     }
-    genbosons_gmotherp4_isLoaded = true;
+    genbosons_gmotherp4_loadedGen = entryGeneration;
   }
   return *genbosons_gmotherp4_;
 }
 
+const PolarArrays &StopTree::genbosons_gmotherp4_polar() {
+  if (genbosons_gmotherp4_polarGen != entryGeneration) {
+    if (genbosons_gmotherp4_branch == 0 && genbosons_gmotherp4_split.IsActive()) genbosons_gmotherp4_split.GetPolar(index, genbosons_gmotherp4_polar_);
+    else genbosons_gmotherp4_polar_.Fill(genbosons_gmotherp4());
+    genbosons_gmotherp4_polarGen = entryGeneration;
+  }
+  return genbosons_gmotherp4_polar_;
+}
+
 const vector<int> &StopTree::genbosons_gmotherid() {
-  if (not genbosons_gmotherid_isLoaded) {
-    if (genbosons_gmotherid_branch != 0) {
+  if (genbosons_gmotherid_loadedGen != entryGeneration) {
+    if (genbosons_gmotherid_flat.IsActive()) {
+      genbosons_gmotherid_ = genbosons_gmotherid_flat.Get(index);
+    } else if (genbosons_gmotherid_branch != 0) {
       genbosons_gmotherid_branch->GetEntry(index);
     } else {
       printf("branch genbosons_gmotherid_branch does not exist!\n");
       exit(1);
     }
-    genbosons_gmotherid_isLoaded = true;
+    genbosons_gmotherid_loadedGen = entryGeneration;
   }
   return *genbosons_gmotherid_;
 }
 
 const vector<int> &StopTree::genbosons_gmotheridx() {
-  if (not genbosons_gmotheridx_isLoaded) {
-    if (genbosons_gmotheridx_branch != 0) {
+  if (genbosons_gmotheridx_loadedGen != entryGeneration) {
+    if (genbosons_gmotheridx_flat.IsActive()) {
+      genbosons_gmotheridx_ = genbosons_gmotheridx_flat.Get(index);
+    } else if (genbosons_gmotheridx_branch != 0) {
       genbosons_gmotheridx_branch->GetEntry(index);
     } else {
       printf("branch genbosons_gmotheridx_branch does not exist!\n");
       exit(1);
     }
-    genbosons_gmotheridx_isLoaded = true;
+    genbosons_gmotheridx_loadedGen = entryGeneration;
   }
   return *genbosons_gmotheridx_;
 }
 
 const vector<int> &StopTree::genbosons_gmotherstatus() {
-  if (not genbosons_gmotherstatus_isLoaded) {
-    if (genbosons_gmotherstatus_branch != 0) {
+  if (genbosons_gmotherstatus_loadedGen != entryGeneration) {
+    if (genbosons_gmotherstatus_flat.IsActive()) {
+      genbosons_gmotherstatus_ = genbosons_gmotherstatus_flat.Get(index);
+    } else if (genbosons_gmotherstatus_branch != 0) {
       genbosons_gmotherstatus_branch->GetEntry(index);
     } else {
       printf("branch genbosons_gmotherstatus_branch does not exist!\n");
       exit(1);
     }
-    genbosons_gmotherstatus_isLoaded = true;
+    genbosons_gmotherstatus_loadedGen = entryGeneration;
   }
   return *genbosons_gmotherstatus_;
 }
 
 const vector<bool> &StopTree::gensusy_isfromt() {
-  if (not gensusy_isfromt_isLoaded) {
-    if (gensusy_isfromt_branch != 0) {
+  if (gensusy_isfromt_loadedGen != entryGeneration) {
+    if (gensusy_isfromt_flat.IsActive()) {
+      gensusy_isfromt_ = gensusy_isfromt_flat.Get(index);
+    } else if (gensusy_isfromt_branch != 0) {
       gensusy_isfromt_branch->GetEntry(index);
     } else {
       printf("branch gensusy_isfromt_branch does not exist!\n");
       exit(1);
     }
-    gensusy_isfromt_isLoaded = true;
+    gensusy_isfromt_loadedGen = entryGeneration;
   }
   return *gensusy_isfromt_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::gensusy_p4() {
-  if (not gensusy_p4_isLoaded) {
-    if (gensusy_p4_branch != 0) {
+  if (gensusy_p4_loadedGen != entryGeneration) {
+    if (gensusy_p4_flat.IsActive()) {
+      gensusy_p4_ = gensusy_p4_flat.Get(index);
+    } else if (gensusy_p4_branch != 0) {
       gensusy_p4_branch->GetEntry(index);
+    } else if (gensusy_p4_split.IsActive()) {
+      gensusy_p4_ = &gensusy_p4_split.GetP4s(index);
     } else {
       printf("branch gensusy_p4_branch does not exist!\n");
       exit(1);
     }
-    gensusy_p4_isLoaded = true;
+    gensusy_p4_loadedGen = entryGeneration;
   }
   return *gensusy_p4_;
 }
 
+const PolarArrays &StopTree::gensusy_p4_polar() {
+  if (gensusy_p4_polarGen != entryGeneration) {
+    if (gensusy_p4_branch == 0 && gensusy_p4_split.IsActive()) gensusy_p4_split.GetPolar(index, gensusy_p4_polar_);
+    else gensusy_p4_polar_.Fill(gensusy_p4());
+    gensusy_p4_polarGen = entryGeneration;
+  }
+  return gensusy_p4_polar_;
+}
+
 const vector<int> &StopTree::gensusy_id() {
-  if (not gensusy_id_isLoaded) {
-    if (gensusy_id_branch != 0) {
+  if (gensusy_id_loadedGen != entryGeneration) {
+    if (gensusy_id_flat.IsActive()) {
+      gensusy_id_ = gensusy_id_flat.Get(index);
+    } else if (gensusy_id_branch != 0) {
       gensusy_id_branch->GetEntry(index);
     } else {
       printf("branch gensusy_id_branch does not exist!\n");
       exit(1);
     }
-    gensusy_id_isLoaded = true;
+    gensusy_id_loadedGen = entryGeneration;
   }
   return *gensusy_id_;
 }
 
 const vector<int> &StopTree::gensusy__genpsidx() {
-  if (not gensusy__genpsidx_isLoaded) {
-    if (gensusy__genpsidx_branch != 0) {
+  if (gensusy__genpsidx_loadedGen != entryGeneration) {
+    if (gensusy__genpsidx_flat.IsActive()) {
+      gensusy__genpsidx_ = gensusy__genpsidx_flat.Get(index);
+    } else if (gensusy__genpsidx_branch != 0) {
       gensusy__genpsidx_branch->GetEntry(index);
     } else {
       printf("branch gensusy__genpsidx_branch does not exist!\n");
       exit(1);
     }
-    gensusy__genpsidx_isLoaded = true;
+    gensusy__genpsidx_loadedGen = entryGeneration;
   }
   return *gensusy__genpsidx_;
 }
 
 const vector<int> &StopTree::gensusy_status() {
-  if (not gensusy_status_isLoaded) {
-    if (gensusy_status_branch != 0) {
+  if (gensusy_status_loadedGen != entryGeneration) {
+    if (gensusy_status_flat.IsActive()) {
+      gensusy_status_ = gensusy_status_flat.Get(index);
+    } else if (gensusy_status_branch != 0) {
       gensusy_status_branch->GetEntry(index);
     } else {
       printf("branch gensusy_status_branch does not exist!\n");
       exit(1);
     }
-    gensusy_status_isLoaded = true;
+    gensusy_status_loadedGen = entryGeneration;
   }
   return *gensusy_status_;
 }
 
 const vector<bool> &StopTree::gensusy_fromHardProcessDecayed() {
-  if (not gensusy_fromHardProcessDecayed_isLoaded) {
-    if (gensusy_fromHardProcessDecayed_branch != 0) {
+  if (gensusy_fromHardProcessDecayed_loadedGen != entryGeneration) {
+    if (gensusy_fromHardProcessDecayed_flat.IsActive()) {
+      gensusy_fromHardProcessDecayed_ = gensusy_fromHardProcessDecayed_flat.Get(index);
+    } else if (gensusy_fromHardProcessDecayed_branch != 0) {
       gensusy_fromHardProcessDecayed_branch->GetEntry(index);
     } else {
       printf("branch gensusy_fromHardProcessDecayed_branch does not exist!\n");
       exit(1);
     }
-    gensusy_fromHardProcessDecayed_isLoaded = true;
+    gensusy_fromHardProcessDecayed_loadedGen = entryGeneration;
   }
   return *gensusy_fromHardProcessDecayed_;
 }
 
 const vector<bool> &StopTree::gensusy_fromHardProcessFinalState() {
-  if (not gensusy_fromHardProcessFinalState_isLoaded) {
-    if (gensusy_fromHardProcessFinalState_branch != 0) {
+  if (gensusy_fromHardProcessFinalState_loadedGen != entryGeneration) {
+    if (gensusy_fromHardProcessFinalState_flat.IsActive()) {
+      gensusy_fromHardProcessFinalState_ = gensusy_fromHardProcessFinalState_flat.Get(index);
+    } else if (gensusy_fromHardProcessFinalState_branch != 0) {
       gensusy_fromHardProcessFinalState_branch->GetEntry(index);
     } else {
       printf("branch gensusy_fromHardProcessFinalState_branch does not exist!\n");
       exit(1);
     }
-    gensusy_fromHardProcessFinalState_isLoaded = true;
+    gensusy_fromHardProcessFinalState_loadedGen = entryGeneration;
   }
   return *gensusy_fromHardProcessFinalState_;
 }
 
 const vector<bool> &StopTree::gensusy_isHardProcess() {
-  if (not gensusy_isHardProcess_isLoaded) {
-    if (gensusy_isHardProcess_branch != 0) {
+  if (gensusy_isHardProcess_loadedGen != entryGeneration) {
+    if (gensusy_isHardProcess_flat.IsActive()) {
+      gensusy_isHardProcess_ = gensusy_isHardProcess_flat.Get(index);
+    } else if (gensusy_isHardProcess_branch != 0) {
       gensusy_isHardProcess_branch->GetEntry(index);
     } else {
       printf("branch gensusy_isHardProcess_branch does not exist!\n");
       exit(1);
     }
-    gensusy_isHardProcess_isLoaded = true;
+    gensusy_isHardProcess_loadedGen = entryGeneration;
   }
   return *gensusy_isHardProcess_;
 }
 
 const vector<bool> &StopTree::gensusy_isLastCopy() {
-  if (not gensusy_isLastCopy_isLoaded) {
-    if (gensusy_isLastCopy_branch != 0) {
+  if (gensusy_isLastCopy_loadedGen != entryGeneration) {
+    if (gensusy_isLastCopy_flat.IsActive()) {
+      gensusy_isLastCopy_ = gensusy_isLastCopy_flat.Get(index);
+    } else if (gensusy_isLastCopy_branch != 0) {
       gensusy_isLastCopy_branch->GetEntry(index);
     } else {
       printf("branch gensusy_isLastCopy_branch does not exist!\n");
       exit(1);
     }
-    gensusy_isLastCopy_isLoaded = true;
+    gensusy_isLastCopy_loadedGen = entryGeneration;
   }
   return *gensusy_isLastCopy_;
 }
 
 const vector<int> &StopTree::gensusy_gentaudecay() {
-  if (not gensusy_gentaudecay_isLoaded) {
-    if (gensusy_gentaudecay_branch != 0) {
+  if (gensusy_gentaudecay_loadedGen != entryGeneration) {
+    if (gensusy_gentaudecay_flat.IsActive()) {
+      gensusy_gentaudecay_ = gensusy_gentaudecay_flat.Get(index);
+    } else if (gensusy_gentaudecay_branch != 0) {
       gensusy_gentaudecay_branch->GetEntry(index);
     } else {
       printf("branch gensusy_gentaudecay_branch does not exist!\n");
       exit(1);
     }
-    gensusy_gentaudecay_isLoaded = true;
+    gensusy_gentaudecay_loadedGen = entryGeneration;
   }
   return *gensusy_gentaudecay_;
 }
 
 const int &StopTree::gen_nfromtsusy_() {
-  if (not gen_nfromtsusy__isLoaded) {
-    if (gen_nfromtsusy__branch != 0) {
+  if (gen_nfromtsusy__loadedGen != entryGeneration) {
+    if (gen_nfromtsusy__flat.IsActive()) {
+      gen_nfromtsusy__ = gen_nfromtsusy__flat.Get(index);
+    } else if (gen_nfromtsusy__bulk != 0) {
+      gen_nfromtsusy__ = gen_nfromtsusy__bulk->Get<int>(index);
+    } else if (gen_nfromtsusy__branch != 0) {
       gen_nfromtsusy__branch->GetEntry(index);
     } else {
       printf("branch gen_nfromtsusy__branch does not exist!\n");
       exit(1);
     }
-    gen_nfromtsusy__isLoaded = true;
+    gen_nfromtsusy__loadedGen = entryGeneration;
   }
   return gen_nfromtsusy__;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::gensusy_motherp4() {
-  if (not gensusy_motherp4_isLoaded) {
-    if (gensusy_motherp4_branch != 0) {
+  if (gensusy_motherp4_loadedGen != entryGeneration) {
+    if (gensusy_motherp4_flat.IsActive()) {
+      gensusy_motherp4_ = gensusy_motherp4_flat.Get(index);
+    } else if (gensusy_motherp4_branch != 0) {
       gensusy_motherp4_branch->GetEntry(index);
+    } else if (gensusy_motherp4_split.IsActive()) {
+      gensusy_motherp4_ = &gensusy_motherp4_split.GetP4s(index);
     } else {
       printf("branch gensusy_motherp4_branch does not exist!\n");
       exit(1);
     }
-    gensusy_motherp4_isLoaded = true;
+    gensusy_motherp4_loadedGen = entryGeneration;
   }
   return *gensusy_motherp4_;
 }
 
+const PolarArrays &StopTree::gensusy_motherp4_polar() {
+  if (gensusy_motherp4_polarGen != entryGeneration) {
+    if (gensusy_motherp4_branch == 0 && gensusy_motherp4_split.IsActive()) gensusy_motherp4_split.GetPolar(index, gensusy_motherp4_polar_);
+    else gensusy_motherp4_polar_.Fill(gensusy_motherp4());
+    gensusy_motherp4_polarGen = entryGeneration;
+  }
+  return gensusy_motherp4_polar_;
+}
+
 const vector<int> &StopTree::gensusy_motherid() {
-  if (not gensusy_motherid_isLoaded) {
-    if (gensusy_motherid_branch != 0) {
+  if (gensusy_motherid_loadedGen != entryGeneration) {
+    if (gensusy_motherid_flat.IsActive()) {
+      gensusy_motherid_ = gensusy_motherid_flat.Get(index);
+    } else if (gensusy_motherid_branch != 0) {
       gensusy_motherid_branch->GetEntry(index);
     } else {
       printf("branch gensusy_motherid_branch does not exist!\n");
       exit(1);
     }
-    gensusy_motherid_isLoaded = true;
+    gensusy_motherid_loadedGen = entryGeneration;
   }
   return *gensusy_motherid_;
 }
 
 const vector<int> &StopTree::gensusy_motheridx() {
-  if (not gensusy_motheridx_isLoaded) {
-    if (gensusy_motheridx_branch != 0) {
+  if (gensusy_motheridx_loadedGen != entryGeneration) {
+    if (gensusy_motheridx_flat.IsActive()) {
+      gensusy_motheridx_ = gensusy_motheridx_flat.Get(index);
+    } else if (gensusy_motheridx_branch != 0) {
       gensusy_motheridx_branch->GetEntry(index);
     } else {
       printf("branch gensusy_motheridx_branch does not exist!\n");
       exit(1);
     }
-    gensusy_motheridx_isLoaded = true;
+    gensusy_motheridx_loadedGen = entryGeneration;
   }
   return *gensusy_motheridx_;
 }
 
 const vector<int> &StopTree::gensusy_motherstatus() {
-  if (not gensusy_motherstatus_isLoaded) {
-    if (gensusy_motherstatus_branch != 0) {
+  if (gensusy_motherstatus_loadedGen != entryGeneration) {
+    if (gensusy_motherstatus_flat.IsActive()) {
+      gensusy_motherstatus_ = gensusy_motherstatus_flat.Get(index);
+    } else if (gensusy_motherstatus_branch != 0) {
       gensusy_motherstatus_branch->GetEntry(index);
     } else {
       printf("branch gensusy_motherstatus_branch does not exist!\n");
       exit(1);
     }
-    gensusy_motherstatus_isLoaded = true;
+    gensusy_motherstatus_loadedGen = entryGeneration;
   }
   return *gensusy_motherstatus_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::gensusy_gmotherp4() {
-  if (not gensusy_gmotherp4_isLoaded) {
-    if (gensusy_gmotherp4_branch != 0) {
+  if (gensusy_gmotherp4_loadedGen != entryGeneration) {
+    if (gensusy_gmotherp4_flat.IsActive()) {
+      gensusy_gmotherp4_ = gensusy_gmotherp4_flat.Get(index);
+    } else if (gensusy_gmotherp4_branch != 0) {
       gensusy_gmotherp4_branch->GetEntry(index);
+    } else if (gensusy_gmotherp4_split.IsActive()) {
+      gensusy_gmotherp4_ = &gensusy_gmotherp4_split.GetP4s(index);
     } else {
       printf("branch gensusy_gmotherp4_branch does not exist!\n");
       exit(1);
     }
-    gensusy_gmotherp4_isLoaded = true;
+    gensusy_gmotherp4_loadedGen = entryGeneration;
   }
   return *gensusy_gmotherp4_;
 }
 
+const PolarArrays &StopTree::gensusy_gmotherp4_polar() {
+  if (gensusy_gmotherp4_polarGen != entryGeneration) {
+    if (gensusy_gmotherp4_branch == 0 && gensusy_gmotherp4_split.IsActive()) gensusy_gmotherp4_split.GetPolar(index, gensusy_gmotherp4_polar_);
+    else gensusy_gmotherp4_polar_.Fill(gensusy_gmotherp4());
+    gensusy_gmotherp4_polarGen = entryGeneration;
+  }
+  return gensusy_gmotherp4_polar_;
+}
+
 const vector<int> &StopTree::gensusy_gmotherid() {
-  if (not gensusy_gmotherid_isLoaded) {
-    if (gensusy_gmotherid_branch != 0) {
+  if (gensusy_gmotherid_loadedGen != entryGeneration) {
+    if (gensusy_gmotherid_flat.IsActive()) {
+      gensusy_gmotherid_ = gensusy_gmotherid_flat.Get(index);
+    } else if (gensusy_gmotherid_branch != 0) {
       gensusy_gmotherid_branch->GetEntry(index);
     } else {
       printf("branch gensusy_gmotherid_branch does not exist!\n");
       exit(1);
     }
-    gensusy_gmotherid_isLoaded = true;
+    gensusy_gmotherid_loadedGen = entryGeneration;
   }
   return *gensusy_gmotherid_;
 }
 
 const vector<int> &StopTree::gensusy_gmotheridx() {
-  if (not gensusy_gmotheridx_isLoaded) {
-    if (gensusy_gmotheridx_branch != 0) {
+  if (gensusy_gmotheridx_loadedGen != entryGeneration) {
+    if (gensusy_gmotheridx_flat.IsActive()) {
+      gensusy_gmotheridx_ = gensusy_gmotheridx_flat.Get(index);
+    } else if (gensusy_gmotheridx_branch != 0) {
       gensusy_gmotheridx_branch->GetEntry(index);
     } else {
       printf("branch gensusy_gmotheridx_branch does not exist!\n");
       exit(1);
     }
-    gensusy_gmotheridx_isLoaded = true;
+    gensusy_gmotheridx_loadedGen = entryGeneration;
   }
   return *gensusy_gmotheridx_;
 }
 
 const vector<int> &StopTree::gensusy_gmotherstatus() {
-  if (not gensusy_gmotherstatus_isLoaded) {
-    if (gensusy_gmotherstatus_branch != 0) {
+  if (gensusy_gmotherstatus_loadedGen != entryGeneration) {
+    if (gensusy_gmotherstatus_flat.IsActive()) {
+      gensusy_gmotherstatus_ = gensusy_gmotherstatus_flat.Get(index);
+    } else if (gensusy_gmotherstatus_branch != 0) {
       gensusy_gmotherstatus_branch->GetEntry(index);
     } else {
       printf("branch gensusy_gmotherstatus_branch does not exist!\n");
       exit(1);
     }
-    gensusy_gmotherstatus_isLoaded = true;
+    gensusy_gmotherstatus_loadedGen = entryGeneration;
   }
   return *gensusy_gmotherstatus_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::ak8pfjets_p4() {
-  if (not ak8pfjets_p4_isLoaded) {
-    if (ak8pfjets_p4_branch != 0) {
+  if (ak8pfjets_p4_loadedGen != entryGeneration) {
+    if (ak8pfjets_p4_flat.IsActive()) {
+      ak8pfjets_p4_ = ak8pfjets_p4_flat.Get(index);
+    } else if (ak8pfjets_p4_branch != 0) {
       ak8pfjets_p4_branch->GetEntry(index);
+    } else if (ak8pfjets_p4_split.IsActive()) {
+      ak8pfjets_p4_ = &ak8pfjets_p4_split.GetP4s(index);
     } else {
       printf("branch ak8pfjets_p4_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_p4_isLoaded = true;
+    ak8pfjets_p4_loadedGen = entryGeneration;
   }
   return *ak8pfjets_p4_;
 }
 
+const PolarArrays &StopTree::ak8pfjets_p4_polar() {
+  if (ak8pfjets_p4_polarGen != entryGeneration) {
+    if (ak8pfjets_p4_branch == 0 && ak8pfjets_p4_split.IsActive()) ak8pfjets_p4_split.GetPolar(index, ak8pfjets_p4_polar_);
+    else ak8pfjets_p4_polar_.Fill(ak8pfjets_p4());
+    ak8pfjets_p4_polarGen = entryGeneration;
+  }
+  return ak8pfjets_p4_polar_;
+}
+
 const vector<float> &StopTree::ak8pfjets_tau1() {
-  if (not ak8pfjets_tau1_isLoaded) {
-    if (ak8pfjets_tau1_branch != 0) {
+  if (ak8pfjets_tau1_loadedGen != entryGeneration) {
+    if (ak8pfjets_tau1_flat.IsActive()) {
+      ak8pfjets_tau1_ = ak8pfjets_tau1_flat.Get(index);
+    } else if (ak8pfjets_tau1_branch != 0) {
       ak8pfjets_tau1_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_tau1_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_tau1_isLoaded = true;
+    ak8pfjets_tau1_loadedGen = entryGeneration;
   }
   return *ak8pfjets_tau1_;
 }
 
 const vector<float> &StopTree::ak8pfjets_tau2() {
-  if (not ak8pfjets_tau2_isLoaded) {
-    if (ak8pfjets_tau2_branch != 0) {
+  if (ak8pfjets_tau2_loadedGen != entryGeneration) {
+    if (ak8pfjets_tau2_flat.IsActive()) {
+      ak8pfjets_tau2_ = ak8pfjets_tau2_flat.Get(index);
+    } else if (ak8pfjets_tau2_branch != 0) {
       ak8pfjets_tau2_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_tau2_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_tau2_isLoaded = true;
+    ak8pfjets_tau2_loadedGen = entryGeneration;
   }
   return *ak8pfjets_tau2_;
 }
 
 const vector<float> &StopTree::ak8pfjets_tau3() {
-  if (not ak8pfjets_tau3_isLoaded) {
-    if (ak8pfjets_tau3_branch != 0) {
+  if (ak8pfjets_tau3_loadedGen != entryGeneration) {
+    if (ak8pfjets_tau3_flat.IsActive()) {
+      ak8pfjets_tau3_ = ak8pfjets_tau3_flat.Get(index);
+    } else if (ak8pfjets_tau3_branch != 0) {
       ak8pfjets_tau3_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_tau3_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_tau3_isLoaded = true;
+    ak8pfjets_tau3_loadedGen = entryGeneration;
   }
   return *ak8pfjets_tau3_;
 }
 
 const vector<int> &StopTree::ak8pfjets_parton_flavor() {
-  if (not ak8pfjets_parton_flavor_isLoaded) {
-    if (ak8pfjets_parton_flavor_branch != 0) {
+  if (ak8pfjets_parton_flavor_loadedGen != entryGeneration) {
+    if (ak8pfjets_parton_flavor_flat.IsActive()) {
+      ak8pfjets_parton_flavor_ = ak8pfjets_parton_flavor_flat.Get(index);
+    } else if (ak8pfjets_parton_flavor_branch != 0) {
       ak8pfjets_parton_flavor_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_parton_flavor_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_parton_flavor_isLoaded = true;
+    ak8pfjets_parton_flavor_loadedGen = entryGeneration;
   }
   return *ak8pfjets_parton_flavor_;
 }
 
 const int &StopTree::nGoodAK8PFJets() {
-  if (not nGoodAK8PFJets_isLoaded) {
-    if (nGoodAK8PFJets_branch != 0) {
+  if (nGoodAK8PFJets_loadedGen != entryGeneration) {
+    if (nGoodAK8PFJets_flat.IsActive()) {
+      nGoodAK8PFJets_ = nGoodAK8PFJets_flat.Get(index);
+    } else if (nGoodAK8PFJets_bulk != 0) {
+      nGoodAK8PFJets_ = nGoodAK8PFJets_bulk->Get<int>(index);
+    } else if (nGoodAK8PFJets_branch != 0) {
       nGoodAK8PFJets_branch->GetEntry(index);
     } else {
       printf("branch nGoodAK8PFJets_branch does not exist!\n");
       exit(1);
     }
-    nGoodAK8PFJets_isLoaded = true;
+    nGoodAK8PFJets_loadedGen = entryGeneration;
   }
   return nGoodAK8PFJets_;
 }
 
 const vector<float> &StopTree::ak8pfjets_deepdisc_qcd() {
-  if (not ak8pfjets_deepdisc_qcd_isLoaded) {
-    if (ak8pfjets_deepdisc_qcd_branch != 0) {
+  if (ak8pfjets_deepdisc_qcd_loadedGen != entryGeneration) {
+    if (ak8pfjets_deepdisc_qcd_flat.IsActive()) {
+      ak8pfjets_deepdisc_qcd_ = ak8pfjets_deepdisc_qcd_flat.Get(index);
+    } else if (ak8pfjets_deepdisc_qcd_branch != 0) {
       ak8pfjets_deepdisc_qcd_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_deepdisc_qcd_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_deepdisc_qcd_isLoaded = true;
+    ak8pfjets_deepdisc_qcd_loadedGen = entryGeneration;
   }
   return *ak8pfjets_deepdisc_qcd_;
 }
 
 const vector<float> &StopTree::ak8pfjets_deepdisc_top() {
-  if (not ak8pfjets_deepdisc_top_isLoaded) {
-    if (ak8pfjets_deepdisc_top_branch != 0) {
+  if (ak8pfjets_deepdisc_top_loadedGen != entryGeneration) {
+    if (ak8pfjets_deepdisc_top_flat.IsActive()) {
+      ak8pfjets_deepdisc_top_ = ak8pfjets_deepdisc_top_flat.Get(index);
+    } else if (ak8pfjets_deepdisc_top_branch != 0) {
       ak8pfjets_deepdisc_top_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_deepdisc_top_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_deepdisc_top_isLoaded = true;
+    ak8pfjets_deepdisc_top_loadedGen = entryGeneration;
   }
   return *ak8pfjets_deepdisc_top_;
 }
 
 const vector<float> &StopTree::ak8pfjets_deepdisc_w() {
-  if (not ak8pfjets_deepdisc_w_isLoaded) {
-    if (ak8pfjets_deepdisc_w_branch != 0) {
+  if (ak8pfjets_deepdisc_w_loadedGen != entryGeneration) {
+    if (ak8pfjets_deepdisc_w_flat.IsActive()) {
+      ak8pfjets_deepdisc_w_ = ak8pfjets_deepdisc_w_flat.Get(index);
+    } else if (ak8pfjets_deepdisc_w_branch != 0) {
       ak8pfjets_deepdisc_w_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_deepdisc_w_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_deepdisc_w_isLoaded = true;
+    ak8pfjets_deepdisc_w_loadedGen = entryGeneration;
   }
   return *ak8pfjets_deepdisc_w_;
 }
 
 const vector<float> &StopTree::ak8pfjets_deepdisc_z() {
-  if (not ak8pfjets_deepdisc_z_isLoaded) {
-    if (ak8pfjets_deepdisc_z_branch != 0) {
+  if (ak8pfjets_deepdisc_z_loadedGen != entryGeneration) {
+    if (ak8pfjets_deepdisc_z_flat.IsActive()) {
+      ak8pfjets_deepdisc_z_ = ak8pfjets_deepdisc_z_flat.Get(index);
+    } else if (ak8pfjets_deepdisc_z_branch != 0) {
       ak8pfjets_deepdisc_z_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_deepdisc_z_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_deepdisc_z_isLoaded = true;
+    ak8pfjets_deepdisc_z_loadedGen = entryGeneration;
   }
   return *ak8pfjets_deepdisc_z_;
 }
 
 const vector<float> &StopTree::ak8pfjets_deepdisc_zbb() {
-  if (not ak8pfjets_deepdisc_zbb_isLoaded) {
-    if (ak8pfjets_deepdisc_zbb_branch != 0) {
+  if (ak8pfjets_deepdisc_zbb_loadedGen != entryGeneration) {
+    if (ak8pfjets_deepdisc_zbb_flat.IsActive()) {
+      ak8pfjets_deepdisc_zbb_ = ak8pfjets_deepdisc_zbb_flat.Get(index);
+    } else if (ak8pfjets_deepdisc_zbb_branch != 0) {
       ak8pfjets_deepdisc_zbb_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_deepdisc_zbb_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_deepdisc_zbb_isLoaded = true;
+    ak8pfjets_deepdisc_zbb_loadedGen = entryGeneration;
   }
   return *ak8pfjets_deepdisc_zbb_;
 }
 
 const vector<float> &StopTree::ak8pfjets_deepdisc_hbb() {
-  if (not ak8pfjets_deepdisc_hbb_isLoaded) {
-    if (ak8pfjets_deepdisc_hbb_branch != 0) {
+  if (ak8pfjets_deepdisc_hbb_loadedGen != entryGeneration) {
+    if (ak8pfjets_deepdisc_hbb_flat.IsActive()) {
+      ak8pfjets_deepdisc_hbb_ = ak8pfjets_deepdisc_hbb_flat.Get(index);
+    } else if (ak8pfjets_deepdisc_hbb_branch != 0) {
       ak8pfjets_deepdisc_hbb_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_deepdisc_hbb_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_deepdisc_hbb_isLoaded = true;
+    ak8pfjets_deepdisc_hbb_loadedGen = entryGeneration;
   }
   return *ak8pfjets_deepdisc_hbb_;
 }
 
 const vector<float> &StopTree::ak8pfjets_deepdisc_h4q() {
-  if (not ak8pfjets_deepdisc_h4q_isLoaded) {
-    if (ak8pfjets_deepdisc_h4q_branch != 0) {
+  if (ak8pfjets_deepdisc_h4q_loadedGen != entryGeneration) {
+    if (ak8pfjets_deepdisc_h4q_flat.IsActive()) {
+      ak8pfjets_deepdisc_h4q_ = ak8pfjets_deepdisc_h4q_flat.Get(index);
+    } else if (ak8pfjets_deepdisc_h4q_branch != 0) {
       ak8pfjets_deepdisc_h4q_branch->GetEntry(index);
     } else {
       printf("branch ak8pfjets_deepdisc_h4q_branch does not exist!\n");
       exit(1);
     }
-    ak8pfjets_deepdisc_h4q_isLoaded = true;
+    ak8pfjets_deepdisc_h4q_loadedGen = entryGeneration;
   }
   return *ak8pfjets_deepdisc_h4q_;
 }
 
 const float &StopTree::lead_ak8deepdisc_top() {
-  if (not lead_ak8deepdisc_top_isLoaded) {
-    if (lead_ak8deepdisc_top_branch != 0) {
+  if (lead_ak8deepdisc_top_loadedGen != entryGeneration) {
+    if (lead_ak8deepdisc_top_flat.IsActive()) {
+      lead_ak8deepdisc_top_ = lead_ak8deepdisc_top_flat.Get(index);
+    } else if (lead_ak8deepdisc_top_bulk != 0) {
+      lead_ak8deepdisc_top_ = lead_ak8deepdisc_top_bulk->Get<float>(index);
+    } else if (lead_ak8deepdisc_top_branch != 0) {
       lead_ak8deepdisc_top_branch->GetEntry(index);
     } else {
       printf("branch lead_ak8deepdisc_top_branch does not exist!\n");
       exit(1);
     }
-    lead_ak8deepdisc_top_isLoaded = true;
+    lead_ak8deepdisc_top_loadedGen = entryGeneration;
   }
   return lead_ak8deepdisc_top_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jup_ak8pfjets_p4() {
-  if (not jup_ak8pfjets_p4_isLoaded) {
-    if (jup_ak8pfjets_p4_branch != 0) {
+  if (jup_ak8pfjets_p4_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_p4_flat.IsActive()) {
+      jup_ak8pfjets_p4_ = jup_ak8pfjets_p4_flat.Get(index);
+    } else if (jup_ak8pfjets_p4_branch != 0) {
       jup_ak8pfjets_p4_branch->GetEntry(index);
+    } else if (jup_ak8pfjets_p4_split.IsActive()) {
+      jup_ak8pfjets_p4_ = &jup_ak8pfjets_p4_split.GetP4s(index);
     } else {
       printf("branch jup_ak8pfjets_p4_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_p4_isLoaded = true;
+    jup_ak8pfjets_p4_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_p4_;
 }
 
+const PolarArrays &StopTree::jup_ak8pfjets_p4_polar() {
+  if (jup_ak8pfjets_p4_polarGen != entryGeneration) {
+    if (jup_ak8pfjets_p4_branch == 0 && jup_ak8pfjets_p4_split.IsActive()) jup_ak8pfjets_p4_split.GetPolar(index, jup_ak8pfjets_p4_polar_);
+    else jup_ak8pfjets_p4_polar_.Fill(jup_ak8pfjets_p4());
+    jup_ak8pfjets_p4_polarGen = entryGeneration;
+  }
+  return jup_ak8pfjets_p4_polar_;
+}
+
 const vector<float> &StopTree::jup_ak8pfjets_tau1() {
-  if (not jup_ak8pfjets_tau1_isLoaded) {
-    if (jup_ak8pfjets_tau1_branch != 0) {
+  if (jup_ak8pfjets_tau1_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_tau1_flat.IsActive()) {
+      jup_ak8pfjets_tau1_ = jup_ak8pfjets_tau1_flat.Get(index);
+    } else if (jup_ak8pfjets_tau1_branch != 0) {
       jup_ak8pfjets_tau1_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_tau1_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_tau1_isLoaded = true;
+    jup_ak8pfjets_tau1_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_tau1_;
 }
 
 const vector<float> &StopTree::jup_ak8pfjets_tau2() {
-  if (not jup_ak8pfjets_tau2_isLoaded) {
-    if (jup_ak8pfjets_tau2_branch != 0) {
+  if (jup_ak8pfjets_tau2_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_tau2_flat.IsActive()) {
+      jup_ak8pfjets_tau2_ = jup_ak8pfjets_tau2_flat.Get(index);
+    } else if (jup_ak8pfjets_tau2_branch != 0) {
       jup_ak8pfjets_tau2_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_tau2_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_tau2_isLoaded = true;
+    jup_ak8pfjets_tau2_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_tau2_;
 }
 
 const vector<float> &StopTree::jup_ak8pfjets_tau3() {
-  if (not jup_ak8pfjets_tau3_isLoaded) {
-    if (jup_ak8pfjets_tau3_branch != 0) {
+  if (jup_ak8pfjets_tau3_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_tau3_flat.IsActive()) {
+      jup_ak8pfjets_tau3_ = jup_ak8pfjets_tau3_flat.Get(index);
+    } else if (jup_ak8pfjets_tau3_branch != 0) {
       jup_ak8pfjets_tau3_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_tau3_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_tau3_isLoaded = true;
+    jup_ak8pfjets_tau3_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_tau3_;
 }
 
 const vector<int> &StopTree::jup_ak8pfjets_parton_flavor() {
-  if (not jup_ak8pfjets_parton_flavor_isLoaded) {
-    if (jup_ak8pfjets_parton_flavor_branch != 0) {
+  if (jup_ak8pfjets_parton_flavor_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_parton_flavor_flat.IsActive()) {
+      jup_ak8pfjets_parton_flavor_ = jup_ak8pfjets_parton_flavor_flat.Get(index);
+    } else if (jup_ak8pfjets_parton_flavor_branch != 0) {
       jup_ak8pfjets_parton_flavor_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_parton_flavor_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_parton_flavor_isLoaded = true;
+    jup_ak8pfjets_parton_flavor_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_parton_flavor_;
 }
 
 const int &StopTree::jup_nGoodAK8PFJets() {
-  if (not jup_nGoodAK8PFJets_isLoaded) {
-    if (jup_nGoodAK8PFJets_branch != 0) {
+  if (jup_nGoodAK8PFJets_loadedGen != entryGeneration) {
+    if (jup_nGoodAK8PFJets_flat.IsActive()) {
+      jup_nGoodAK8PFJets_ = jup_nGoodAK8PFJets_flat.Get(index);
+    } else if (jup_nGoodAK8PFJets_bulk != 0) {
+      jup_nGoodAK8PFJets_ = jup_nGoodAK8PFJets_bulk->Get<int>(index);
+    } else if (jup_nGoodAK8PFJets_branch != 0) {
       jup_nGoodAK8PFJets_branch->GetEntry(index);
     } else {
       printf("branch jup_nGoodAK8PFJets_branch does not exist!\n");
       exit(1);
     }
-    jup_nGoodAK8PFJets_isLoaded = true;
+    jup_nGoodAK8PFJets_loadedGen = entryGeneration;
   }
   return jup_nGoodAK8PFJets_;
 }
 
 const vector<float> &StopTree::jup_ak8pfjets_deepdisc_qcd() {
-  if (not jup_ak8pfjets_deepdisc_qcd_isLoaded) {
-    if (jup_ak8pfjets_deepdisc_qcd_branch != 0) {
+  if (jup_ak8pfjets_deepdisc_qcd_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_deepdisc_qcd_flat.IsActive()) {
+      jup_ak8pfjets_deepdisc_qcd_ = jup_ak8pfjets_deepdisc_qcd_flat.Get(index);
+    } else if (jup_ak8pfjets_deepdisc_qcd_branch != 0) {
       jup_ak8pfjets_deepdisc_qcd_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_deepdisc_qcd_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_deepdisc_qcd_isLoaded = true;
+    jup_ak8pfjets_deepdisc_qcd_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_deepdisc_qcd_;
 }
 
 const vector<float> &StopTree::jup_ak8pfjets_deepdisc_top() {
-  if (not jup_ak8pfjets_deepdisc_top_isLoaded) {
-    if (jup_ak8pfjets_deepdisc_top_branch != 0) {
+  if (jup_ak8pfjets_deepdisc_top_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_deepdisc_top_flat.IsActive()) {
+      jup_ak8pfjets_deepdisc_top_ = jup_ak8pfjets_deepdisc_top_flat.Get(index);
+    } else if (jup_ak8pfjets_deepdisc_top_branch != 0) {
       jup_ak8pfjets_deepdisc_top_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_deepdisc_top_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_deepdisc_top_isLoaded = true;
+    jup_ak8pfjets_deepdisc_top_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_deepdisc_top_;
 }
 
 const vector<float> &StopTree::jup_ak8pfjets_deepdisc_w() {
-  if (not jup_ak8pfjets_deepdisc_w_isLoaded) {
-    if (jup_ak8pfjets_deepdisc_w_branch != 0) {
+  if (jup_ak8pfjets_deepdisc_w_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_deepdisc_w_flat.IsActive()) {
+      jup_ak8pfjets_deepdisc_w_ = jup_ak8pfjets_deepdisc_w_flat.Get(index);
+    } else if (jup_ak8pfjets_deepdisc_w_branch != 0) {
       jup_ak8pfjets_deepdisc_w_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_deepdisc_w_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_deepdisc_w_isLoaded = true;
+    jup_ak8pfjets_deepdisc_w_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_deepdisc_w_;
 }
 
 const vector<float> &StopTree::jup_ak8pfjets_deepdisc_z() {
-  if (not jup_ak8pfjets_deepdisc_z_isLoaded) {
-    if (jup_ak8pfjets_deepdisc_z_branch != 0) {
+  if (jup_ak8pfjets_deepdisc_z_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_deepdisc_z_flat.IsActive()) {
+      jup_ak8pfjets_deepdisc_z_ = jup_ak8pfjets_deepdisc_z_flat.Get(index);
+    } else if (jup_ak8pfjets_deepdisc_z_branch != 0) {
       jup_ak8pfjets_deepdisc_z_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_deepdisc_z_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_deepdisc_z_isLoaded = true;
+    jup_ak8pfjets_deepdisc_z_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_deepdisc_z_;
 }
 
 const vector<float> &StopTree::jup_ak8pfjets_deepdisc_zbb() {
-  if (not jup_ak8pfjets_deepdisc_zbb_isLoaded) {
-    if (jup_ak8pfjets_deepdisc_zbb_branch != 0) {
+  if (jup_ak8pfjets_deepdisc_zbb_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_deepdisc_zbb_flat.IsActive()) {
+      jup_ak8pfjets_deepdisc_zbb_ = jup_ak8pfjets_deepdisc_zbb_flat.Get(index);
+    } else if (jup_ak8pfjets_deepdisc_zbb_branch != 0) {
       jup_ak8pfjets_deepdisc_zbb_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_deepdisc_zbb_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_deepdisc_zbb_isLoaded = true;
+    jup_ak8pfjets_deepdisc_zbb_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_deepdisc_zbb_;
 }
 
 const vector<float> &StopTree::jup_ak8pfjets_deepdisc_hbb() {
-  if (not jup_ak8pfjets_deepdisc_hbb_isLoaded) {
-    if (jup_ak8pfjets_deepdisc_hbb_branch != 0) {
+  if (jup_ak8pfjets_deepdisc_hbb_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_deepdisc_hbb_flat.IsActive()) {
+      jup_ak8pfjets_deepdisc_hbb_ = jup_ak8pfjets_deepdisc_hbb_flat.Get(index);
+    } else if (jup_ak8pfjets_deepdisc_hbb_branch != 0) {
       jup_ak8pfjets_deepdisc_hbb_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_deepdisc_hbb_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_deepdisc_hbb_isLoaded = true;
+    jup_ak8pfjets_deepdisc_hbb_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_deepdisc_hbb_;
 }
 
 const vector<float> &StopTree::jup_ak8pfjets_deepdisc_h4q() {
-  if (not jup_ak8pfjets_deepdisc_h4q_isLoaded) {
-    if (jup_ak8pfjets_deepdisc_h4q_branch != 0) {
+  if (jup_ak8pfjets_deepdisc_h4q_loadedGen != entryGeneration) {
+    if (jup_ak8pfjets_deepdisc_h4q_flat.IsActive()) {
+      jup_ak8pfjets_deepdisc_h4q_ = jup_ak8pfjets_deepdisc_h4q_flat.Get(index);
+    } else if (jup_ak8pfjets_deepdisc_h4q_branch != 0) {
       jup_ak8pfjets_deepdisc_h4q_branch->GetEntry(index);
     } else {
       printf("branch jup_ak8pfjets_deepdisc_h4q_branch does not exist!\n");
       exit(1);
     }
-    jup_ak8pfjets_deepdisc_h4q_isLoaded = true;
+    jup_ak8pfjets_deepdisc_h4q_loadedGen = entryGeneration;
   }
   return *jup_ak8pfjets_deepdisc_h4q_;
 }
 
 const float &StopTree::jup_lead_ak8deepdisc_top() {
-  if (not jup_lead_ak8deepdisc_top_isLoaded) {
-    if (jup_lead_ak8deepdisc_top_branch != 0) {
+  if (jup_lead_ak8deepdisc_top_loadedGen != entryGeneration) {
+    if (jup_lead_ak8deepdisc_top_flat.IsActive()) {
+      jup_lead_ak8deepdisc_top_ = jup_lead_ak8deepdisc_top_flat.Get(index);
+    } else if (jup_lead_ak8deepdisc_top_bulk != 0) {
+      jup_lead_ak8deepdisc_top_ = jup_lead_ak8deepdisc_top_bulk->Get<float>(index);
+    } else if (jup_lead_ak8deepdisc_top_branch != 0) {
       jup_lead_ak8deepdisc_top_branch->GetEntry(index);
     } else {
       printf("branch jup_lead_ak8deepdisc_top_branch does not exist!\n");
       exit(1);
     }
-    jup_lead_ak8deepdisc_top_isLoaded = true;
+    jup_lead_ak8deepdisc_top_loadedGen = entryGeneration;
   }
   return jup_lead_ak8deepdisc_top_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jdown_ak8pfjets_p4() {
-  if (not jdown_ak8pfjets_p4_isLoaded) {
-    if (jdown_ak8pfjets_p4_branch != 0) {
+  if (jdown_ak8pfjets_p4_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_p4_flat.IsActive()) {
+      jdown_ak8pfjets_p4_ = jdown_ak8pfjets_p4_flat.Get(index);
+    } else if (jdown_ak8pfjets_p4_branch != 0) {
       jdown_ak8pfjets_p4_branch->GetEntry(index);
+    } else if (jdown_ak8pfjets_p4_split.IsActive()) {
+      jdown_ak8pfjets_p4_ = &jdown_ak8pfjets_p4_split.GetP4s(index);
     } else {
       printf("branch jdown_ak8pfjets_p4_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_p4_isLoaded = true;
+    jdown_ak8pfjets_p4_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_p4_;
 }
 
+const PolarArrays &StopTree::jdown_ak8pfjets_p4_polar() {
+  if (jdown_ak8pfjets_p4_polarGen != entryGeneration) {
+    if (jdown_ak8pfjets_p4_branch == 0 && jdown_ak8pfjets_p4_split.IsActive()) jdown_ak8pfjets_p4_split.GetPolar(index, jdown_ak8pfjets_p4_polar_);
+    else jdown_ak8pfjets_p4_polar_.Fill(jdown_ak8pfjets_p4());
+    jdown_ak8pfjets_p4_polarGen = entryGeneration;
+  }
+  return jdown_ak8pfjets_p4_polar_;
+}
+
 const vector<float> &StopTree::jdown_ak8pfjets_tau1() {
-  if (not jdown_ak8pfjets_tau1_isLoaded) {
-    if (jdown_ak8pfjets_tau1_branch != 0) {
+  if (jdown_ak8pfjets_tau1_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_tau1_flat.IsActive()) {
+      jdown_ak8pfjets_tau1_ = jdown_ak8pfjets_tau1_flat.Get(index);
+    } else if (jdown_ak8pfjets_tau1_branch != 0) {
       jdown_ak8pfjets_tau1_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_tau1_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_tau1_isLoaded = true;
+    jdown_ak8pfjets_tau1_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_tau1_;
 }
 
 const vector<float> &StopTree::jdown_ak8pfjets_tau2() {
-  if (not jdown_ak8pfjets_tau2_isLoaded) {
-    if (jdown_ak8pfjets_tau2_branch != 0) {
+  if (jdown_ak8pfjets_tau2_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_tau2_flat.IsActive()) {
+      jdown_ak8pfjets_tau2_ = jdown_ak8pfjets_tau2_flat.Get(index);
+    } else if (jdown_ak8pfjets_tau2_branch != 0) {
       jdown_ak8pfjets_tau2_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_tau2_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_tau2_isLoaded = true;
+    jdown_ak8pfjets_tau2_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_tau2_;
 }
 
 const vector<float> &StopTree::jdown_ak8pfjets_tau3() {
-  if (not jdown_ak8pfjets_tau3_isLoaded) {
-    if (jdown_ak8pfjets_tau3_branch != 0) {
+  if (jdown_ak8pfjets_tau3_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_tau3_flat.IsActive()) {
+      jdown_ak8pfjets_tau3_ = jdown_ak8pfjets_tau3_flat.Get(index);
+    } else if (jdown_ak8pfjets_tau3_branch != 0) {
       jdown_ak8pfjets_tau3_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_tau3_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_tau3_isLoaded = true;
+    jdown_ak8pfjets_tau3_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_tau3_;
 }
 
 const vector<int> &StopTree::jdown_ak8pfjets_parton_flavor() {
-  if (not jdown_ak8pfjets_parton_flavor_isLoaded) {
-    if (jdown_ak8pfjets_parton_flavor_branch != 0) {
+  if (jdown_ak8pfjets_parton_flavor_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_parton_flavor_flat.IsActive()) {
+      jdown_ak8pfjets_parton_flavor_ = jdown_ak8pfjets_parton_flavor_flat.Get(index);
+    } else if (jdown_ak8pfjets_parton_flavor_branch != 0) {
       jdown_ak8pfjets_parton_flavor_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_parton_flavor_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_parton_flavor_isLoaded = true;
+    jdown_ak8pfjets_parton_flavor_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_parton_flavor_;
 }
 
 const int &StopTree::jdown_nGoodAK8PFJets() {
-  if (not jdown_nGoodAK8PFJets_isLoaded) {
-    if (jdown_nGoodAK8PFJets_branch != 0) {
+  if (jdown_nGoodAK8PFJets_loadedGen != entryGeneration) {
+    if (jdown_nGoodAK8PFJets_flat.IsActive()) {
+      jdown_nGoodAK8PFJets_ = jdown_nGoodAK8PFJets_flat.Get(index);
+    } else if (jdown_nGoodAK8PFJets_bulk != 0) {
+      jdown_nGoodAK8PFJets_ = jdown_nGoodAK8PFJets_bulk->Get<int>(index);
+    } else if (jdown_nGoodAK8PFJets_branch != 0) {
       jdown_nGoodAK8PFJets_branch->GetEntry(index);
     } else {
       printf("branch jdown_nGoodAK8PFJets_branch does not exist!\n");
       exit(1);
     }
-    jdown_nGoodAK8PFJets_isLoaded = true;
+    jdown_nGoodAK8PFJets_loadedGen = entryGeneration;
   }
   return jdown_nGoodAK8PFJets_;
 }
 
 const vector<float> &StopTree::jdown_ak8pfjets_deepdisc_qcd() {
-  if (not jdown_ak8pfjets_deepdisc_qcd_isLoaded) {
-    if (jdown_ak8pfjets_deepdisc_qcd_branch != 0) {
+  if (jdown_ak8pfjets_deepdisc_qcd_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_deepdisc_qcd_flat.IsActive()) {
+      jdown_ak8pfjets_deepdisc_qcd_ = jdown_ak8pfjets_deepdisc_qcd_flat.Get(index);
+    } else if (jdown_ak8pfjets_deepdisc_qcd_branch != 0) {
       jdown_ak8pfjets_deepdisc_qcd_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_deepdisc_qcd_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_deepdisc_qcd_isLoaded = true;
+    jdown_ak8pfjets_deepdisc_qcd_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_deepdisc_qcd_;
 }
 
 const vector<float> &StopTree::jdown_ak8pfjets_deepdisc_top() {
-  if (not jdown_ak8pfjets_deepdisc_top_isLoaded) {
-    if (jdown_ak8pfjets_deepdisc_top_branch != 0) {
+  if (jdown_ak8pfjets_deepdisc_top_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_deepdisc_top_flat.IsActive()) {
+      jdown_ak8pfjets_deepdisc_top_ = jdown_ak8pfjets_deepdisc_top_flat.Get(index);
+    } else if (jdown_ak8pfjets_deepdisc_top_branch != 0) {
       jdown_ak8pfjets_deepdisc_top_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_deepdisc_top_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_deepdisc_top_isLoaded = true;
+    jdown_ak8pfjets_deepdisc_top_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_deepdisc_top_;
 }
 
 const vector<float> &StopTree::jdown_ak8pfjets_deepdisc_w() {
-  if (not jdown_ak8pfjets_deepdisc_w_isLoaded) {
-    if (jdown_ak8pfjets_deepdisc_w_branch != 0) {
+  if (jdown_ak8pfjets_deepdisc_w_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_deepdisc_w_flat.IsActive()) {
+      jdown_ak8pfjets_deepdisc_w_ = jdown_ak8pfjets_deepdisc_w_flat.Get(index);
+    } else if (jdown_ak8pfjets_deepdisc_w_branch != 0) {
       jdown_ak8pfjets_deepdisc_w_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_deepdisc_w_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_deepdisc_w_isLoaded = true;
+    jdown_ak8pfjets_deepdisc_w_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_deepdisc_w_;
 }
 
 const vector<float> &StopTree::jdown_ak8pfjets_deepdisc_z() {
-  if (not jdown_ak8pfjets_deepdisc_z_isLoaded) {
-    if (jdown_ak8pfjets_deepdisc_z_branch != 0) {
+  if (jdown_ak8pfjets_deepdisc_z_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_deepdisc_z_flat.IsActive()) {
+      jdown_ak8pfjets_deepdisc_z_ = jdown_ak8pfjets_deepdisc_z_flat.Get(index);
+    } else if (jdown_ak8pfjets_deepdisc_z_branch != 0) {
       jdown_ak8pfjets_deepdisc_z_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_deepdisc_z_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_deepdisc_z_isLoaded = true;
+    jdown_ak8pfjets_deepdisc_z_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_deepdisc_z_;
 }
 
 const vector<float> &StopTree::jdown_ak8pfjets_deepdisc_zbb() {
-  if (not jdown_ak8pfjets_deepdisc_zbb_isLoaded) {
-    if (jdown_ak8pfjets_deepdisc_zbb_branch != 0) {
+  if (jdown_ak8pfjets_deepdisc_zbb_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_deepdisc_zbb_flat.IsActive()) {
+      jdown_ak8pfjets_deepdisc_zbb_ = jdown_ak8pfjets_deepdisc_zbb_flat.Get(index);
+    } else if (jdown_ak8pfjets_deepdisc_zbb_branch != 0) {
       jdown_ak8pfjets_deepdisc_zbb_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_deepdisc_zbb_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_deepdisc_zbb_isLoaded = true;
+    jdown_ak8pfjets_deepdisc_zbb_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_deepdisc_zbb_;
 }
 
 const vector<float> &StopTree::jdown_ak8pfjets_deepdisc_hbb() {
-  if (not jdown_ak8pfjets_deepdisc_hbb_isLoaded) {
-    if (jdown_ak8pfjets_deepdisc_hbb_branch != 0) {
+  if (jdown_ak8pfjets_deepdisc_hbb_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_deepdisc_hbb_flat.IsActive()) {
+      jdown_ak8pfjets_deepdisc_hbb_ = jdown_ak8pfjets_deepdisc_hbb_flat.Get(index);
+    } else if (jdown_ak8pfjets_deepdisc_hbb_branch != 0) {
       jdown_ak8pfjets_deepdisc_hbb_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_deepdisc_hbb_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_deepdisc_hbb_isLoaded = true;
+    jdown_ak8pfjets_deepdisc_hbb_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_deepdisc_hbb_;
 }
 
 const vector<float> &StopTree::jdown_ak8pfjets_deepdisc_h4q() {
-  if (not jdown_ak8pfjets_deepdisc_h4q_isLoaded) {
-    if (jdown_ak8pfjets_deepdisc_h4q_branch != 0) {
+  if (jdown_ak8pfjets_deepdisc_h4q_loadedGen != entryGeneration) {
+    if (jdown_ak8pfjets_deepdisc_h4q_flat.IsActive()) {
+      jdown_ak8pfjets_deepdisc_h4q_ = jdown_ak8pfjets_deepdisc_h4q_flat.Get(index);
+    } else if (jdown_ak8pfjets_deepdisc_h4q_branch != 0) {
       jdown_ak8pfjets_deepdisc_h4q_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak8pfjets_deepdisc_h4q_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak8pfjets_deepdisc_h4q_isLoaded = true;
+    jdown_ak8pfjets_deepdisc_h4q_loadedGen = entryGeneration;
   }
   return *jdown_ak8pfjets_deepdisc_h4q_;
 }
 
 const float &StopTree::jdown_lead_ak8deepdisc_top() {
-  if (not jdown_lead_ak8deepdisc_top_isLoaded) {
-    if (jdown_lead_ak8deepdisc_top_branch != 0) {
+  if (jdown_lead_ak8deepdisc_top_loadedGen != entryGeneration) {
+    if (jdown_lead_ak8deepdisc_top_flat.IsActive()) {
+      jdown_lead_ak8deepdisc_top_ = jdown_lead_ak8deepdisc_top_flat.Get(index);
+    } else if (jdown_lead_ak8deepdisc_top_bulk != 0) {
+      jdown_lead_ak8deepdisc_top_ = jdown_lead_ak8deepdisc_top_bulk->Get<float>(index);
+    } else if (jdown_lead_ak8deepdisc_top_branch != 0) {
       jdown_lead_ak8deepdisc_top_branch->GetEntry(index);
     } else {
       printf("branch jdown_lead_ak8deepdisc_top_branch does not exist!\n");
       exit(1);
     }
-    jdown_lead_ak8deepdisc_top_isLoaded = true;
+    jdown_lead_ak8deepdisc_top_loadedGen = entryGeneration;
   }
   return jdown_lead_ak8deepdisc_top_;
 }
 
 const vector<float> &StopTree::ak4pfjets_cvsl() {
-  if (not ak4pfjets_cvsl_isLoaded) {
-    if (ak4pfjets_cvsl_branch != 0) {
+  if (ak4pfjets_cvsl_loadedGen != entryGeneration) {
+    if (ak4pfjets_cvsl_flat.IsActive()) {
+      ak4pfjets_cvsl_ = ak4pfjets_cvsl_flat.Get(index);
+    } else if (ak4pfjets_cvsl_branch != 0) {
       ak4pfjets_cvsl_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_cvsl_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_cvsl_isLoaded = true;
+    ak4pfjets_cvsl_loadedGen = entryGeneration;
   }
   return *ak4pfjets_cvsl_;
 }
 
 const vector<float> &StopTree::ak4pfjets_ptD() {
-  if (not ak4pfjets_ptD_isLoaded) {
-    if (ak4pfjets_ptD_branch != 0) {
+  if (ak4pfjets_ptD_loadedGen != entryGeneration) {
+    if (ak4pfjets_ptD_flat.IsActive()) {
+      ak4pfjets_ptD_ = ak4pfjets_ptD_flat.Get(index);
+    } else if (ak4pfjets_ptD_branch != 0) {
       ak4pfjets_ptD_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_ptD_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_ptD_isLoaded = true;
+    ak4pfjets_ptD_loadedGen = entryGeneration;
   }
   return *ak4pfjets_ptD_;
 }
 
 const vector<float> &StopTree::ak4pfjets_axis1() {
-  if (not ak4pfjets_axis1_isLoaded) {
-    if (ak4pfjets_axis1_branch != 0) {
+  if (ak4pfjets_axis1_loadedGen != entryGeneration) {
+    if (ak4pfjets_axis1_flat.IsActive()) {
+      ak4pfjets_axis1_ = ak4pfjets_axis1_flat.Get(index);
+    } else if (ak4pfjets_axis1_branch != 0) {
       ak4pfjets_axis1_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_axis1_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_axis1_isLoaded = true;
+    ak4pfjets_axis1_loadedGen = entryGeneration;
   }
   return *ak4pfjets_axis1_;
 }
 
 const vector<float> &StopTree::ak4pfjets_axis2() {
-  if (not ak4pfjets_axis2_isLoaded) {
-    if (ak4pfjets_axis2_branch != 0) {
+  if (ak4pfjets_axis2_loadedGen != entryGeneration) {
+    if (ak4pfjets_axis2_flat.IsActive()) {
+      ak4pfjets_axis2_ = ak4pfjets_axis2_flat.Get(index);
+    } else if (ak4pfjets_axis2_branch != 0) {
       ak4pfjets_axis2_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_axis2_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_axis2_isLoaded = true;
+    ak4pfjets_axis2_loadedGen = entryGeneration;
   }
   return *ak4pfjets_axis2_;
 }
 
 const vector<int> &StopTree::ak4pfjets_mult() {
-  if (not ak4pfjets_mult_isLoaded) {
-    if (ak4pfjets_mult_branch != 0) {
+  if (ak4pfjets_mult_loadedGen != entryGeneration) {
+    if (ak4pfjets_mult_flat.IsActive()) {
+      ak4pfjets_mult_ = ak4pfjets_mult_flat.Get(index);
+    } else if (ak4pfjets_mult_branch != 0) {
       ak4pfjets_mult_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_mult_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_mult_isLoaded = true;
+    ak4pfjets_mult_loadedGen = entryGeneration;
   }
   return *ak4pfjets_mult_;
 }
 
 const vector<float> &StopTree::ak4pfjets_deepCSVb() {
-  if (not ak4pfjets_deepCSVb_isLoaded) {
-    if (ak4pfjets_deepCSVb_branch != 0) {
+  if (ak4pfjets_deepCSVb_loadedGen != entryGeneration) {
+    if (ak4pfjets_deepCSVb_flat.IsActive()) {
+      ak4pfjets_deepCSVb_ = ak4pfjets_deepCSVb_flat.Get(index);
+    } else if (ak4pfjets_deepCSVb_branch != 0) {
       ak4pfjets_deepCSVb_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_deepCSVb_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_deepCSVb_isLoaded = true;
+    ak4pfjets_deepCSVb_loadedGen = entryGeneration;
   }
   return *ak4pfjets_deepCSVb_;
 }
 
 const vector<float> &StopTree::ak4pfjets_deepCSVbb() {
-  if (not ak4pfjets_deepCSVbb_isLoaded) {
-    if (ak4pfjets_deepCSVbb_branch != 0) {
+  if (ak4pfjets_deepCSVbb_loadedGen != entryGeneration) {
+    if (ak4pfjets_deepCSVbb_flat.IsActive()) {
+      ak4pfjets_deepCSVbb_ = ak4pfjets_deepCSVbb_flat.Get(index);
+    } else if (ak4pfjets_deepCSVbb_branch != 0) {
       ak4pfjets_deepCSVbb_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_deepCSVbb_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_deepCSVbb_isLoaded = true;
+    ak4pfjets_deepCSVbb_loadedGen = entryGeneration;
   }
   return *ak4pfjets_deepCSVbb_;
 }
 
 const vector<float> &StopTree::ak4pfjets_deepCSVc() {
-  if (not ak4pfjets_deepCSVc_isLoaded) {
-    if (ak4pfjets_deepCSVc_branch != 0) {
+  if (ak4pfjets_deepCSVc_loadedGen != entryGeneration) {
+    if (ak4pfjets_deepCSVc_flat.IsActive()) {
+      ak4pfjets_deepCSVc_ = ak4pfjets_deepCSVc_flat.Get(index);
+    } else if (ak4pfjets_deepCSVc_branch != 0) {
       ak4pfjets_deepCSVc_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_deepCSVc_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_deepCSVc_isLoaded = true;
+    ak4pfjets_deepCSVc_loadedGen = entryGeneration;
   }
   return *ak4pfjets_deepCSVc_;
 }
 
 const vector<float> &StopTree::ak4pfjets_deepCSVl() {
-  if (not ak4pfjets_deepCSVl_isLoaded) {
-    if (ak4pfjets_deepCSVl_branch != 0) {
+  if (ak4pfjets_deepCSVl_loadedGen != entryGeneration) {
+    if (ak4pfjets_deepCSVl_flat.IsActive()) {
+      ak4pfjets_deepCSVl_ = ak4pfjets_deepCSVl_flat.Get(index);
+    } else if (ak4pfjets_deepCSVl_branch != 0) {
       ak4pfjets_deepCSVl_branch->GetEntry(index);
     } else {
       printf("branch ak4pfjets_deepCSVl_branch does not exist!\n");
       exit(1);
     }
-    ak4pfjets_deepCSVl_isLoaded = true;
+    ak4pfjets_deepCSVl_loadedGen = entryGeneration;
   }
   return *ak4pfjets_deepCSVl_;
 }
 
 const vector<vector<int> > &StopTree::topcands_ak4idx() {
-  if (not topcands_ak4idx_isLoaded) {
+  if (topcands_ak4idx_loadedGen != entryGeneration) {
     if (topcands_ak4idx_branch != 0) {
       topcands_ak4idx_branch->GetEntry(index);
     } else {
       printf("branch topcands_ak4idx_branch does not exist!\n");
       exit(1);
     }
-    topcands_ak4idx_isLoaded = true;
+    topcands_ak4idx_loadedGen = entryGeneration;
   }
   return *topcands_ak4idx_;
 }
 
 const vector<float> &StopTree::topcands_disc() {
-  if (not topcands_disc_isLoaded) {
-    if (topcands_disc_branch != 0) {
+  if (topcands_disc_loadedGen != entryGeneration) {
+    if (topcands_disc_flat.IsActive()) {
+      topcands_disc_ = topcands_disc_flat.Get(index);
+    } else if (topcands_disc_branch != 0) {
       topcands_disc_branch->GetEntry(index);
     } else {
       printf("branch topcands_disc_branch does not exist!\n");
       exit(1);
     }
-    topcands_disc_isLoaded = true;
+    topcands_disc_loadedGen = entryGeneration;
   }
   return *topcands_disc_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::topcands_p4() {
-  if (not topcands_p4_isLoaded) {
-    if (topcands_p4_branch != 0) {
+  if (topcands_p4_loadedGen != entryGeneration) {
+    if (topcands_p4_flat.IsActive()) {
+      topcands_p4_ = topcands_p4_flat.Get(index);
+    } else if (topcands_p4_branch != 0) {
       topcands_p4_branch->GetEntry(index);
+    } else if (topcands_p4_split.IsActive()) {
+      topcands_p4_ = &topcands_p4_split.GetP4s(index);
     } else {
       printf("branch topcands_p4_branch does not exist!\n");
       exit(1);
     }
-    topcands_p4_isLoaded = true;
+    topcands_p4_loadedGen = entryGeneration;
   }
   return *topcands_p4_;
 }
 
+const PolarArrays &StopTree::topcands_p4_polar() {
+  if (topcands_p4_polarGen != entryGeneration) {
+    if (topcands_p4_branch == 0 && topcands_p4_split.IsActive()) topcands_p4_split.GetPolar(index, topcands_p4_polar_);
+    else topcands_p4_polar_.Fill(topcands_p4());
+    topcands_p4_polarGen = entryGeneration;
+  }
+  return topcands_p4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::topcands_Wp4() {
-  if (not topcands_Wp4_isLoaded) {
-    if (topcands_Wp4_branch != 0) {
+  if (topcands_Wp4_loadedGen != entryGeneration) {
+    if (topcands_Wp4_flat.IsActive()) {
+      topcands_Wp4_ = topcands_Wp4_flat.Get(index);
+    } else if (topcands_Wp4_branch != 0) {
       topcands_Wp4_branch->GetEntry(index);
+    } else if (topcands_Wp4_split.IsActive()) {
+      topcands_Wp4_ = &topcands_Wp4_split.GetP4s(index);
     } else {
       printf("branch topcands_Wp4_branch does not exist!\n");
       exit(1);
     }
-    topcands_Wp4_isLoaded = true;
+    topcands_Wp4_loadedGen = entryGeneration;
   }
   return *topcands_Wp4_;
 }
 
+const PolarArrays &StopTree::topcands_Wp4_polar() {
+  if (topcands_Wp4_polarGen != entryGeneration) {
+    if (topcands_Wp4_branch == 0 && topcands_Wp4_split.IsActive()) topcands_Wp4_split.GetPolar(index, topcands_Wp4_polar_);
+    else topcands_Wp4_polar_.Fill(topcands_Wp4());
+    topcands_Wp4_polarGen = entryGeneration;
+  }
+  return topcands_Wp4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::tftops_p4() {
-  if (not tftops_p4_isLoaded) {
-    if (tftops_p4_branch != 0) {
+  if (tftops_p4_loadedGen != entryGeneration) {
+    if (tftops_p4_flat.IsActive()) {
+      tftops_p4_ = tftops_p4_flat.Get(index);
+    } else if (tftops_p4_branch != 0) {
       tftops_p4_branch->GetEntry(index);
+    } else if (tftops_p4_split.IsActive()) {
+      tftops_p4_ = &tftops_p4_split.GetP4s(index);
     } else {
       printf("branch tftops_p4_branch does not exist!\n");
       exit(1);
     }
-    tftops_p4_isLoaded = true;
+    tftops_p4_loadedGen = entryGeneration;
   }
   return *tftops_p4_;
 }
 
+const PolarArrays &StopTree::tftops_p4_polar() {
+  if (tftops_p4_polarGen != entryGeneration) {
+    if (tftops_p4_branch == 0 && tftops_p4_split.IsActive()) tftops_p4_split.GetPolar(index, tftops_p4_polar_);
+    else tftops_p4_polar_.Fill(tftops_p4());
+    tftops_p4_polarGen = entryGeneration;
+  }
+  return tftops_p4_polar_;
+}
+
 const vector<float> &StopTree::tftops_disc() {
-  if (not tftops_disc_isLoaded) {
-    if (tftops_disc_branch != 0) {
+  if (tftops_disc_loadedGen != entryGeneration) {
+    if (tftops_disc_flat.IsActive()) {
+      tftops_disc_ = tftops_disc_flat.Get(index);
+    } else if (tftops_disc_branch != 0) {
       tftops_disc_branch->GetEntry(index);
     } else {
       printf("branch tftops_disc_branch does not exist!\n");
       exit(1);
     }
-    tftops_disc_isLoaded = true;
+    tftops_disc_loadedGen = entryGeneration;
   }
   return *tftops_disc_;
 }
 
 const vector<vector<float> > &StopTree::tftops_subjet_pt() {
-  if (not tftops_subjet_pt_isLoaded) {
+  if (tftops_subjet_pt_loadedGen != entryGeneration) {
     if (tftops_subjet_pt_branch != 0) {
       tftops_subjet_pt_branch->GetEntry(index);
     } else {
       printf("branch tftops_subjet_pt_branch does not exist!\n");
       exit(1);
     }
-    tftops_subjet_pt_isLoaded = true;
+    tftops_subjet_pt_loadedGen = entryGeneration;
   }
   return *tftops_subjet_pt_;
 }
 
 const vector<vector<float> > &StopTree::tftops_subjet_eta() {
-  if (not tftops_subjet_eta_isLoaded) {
+  if (tftops_subjet_eta_loadedGen != entryGeneration) {
     if (tftops_subjet_eta_branch != 0) {
       tftops_subjet_eta_branch->GetEntry(index);
     } else {
       printf("branch tftops_subjet_eta_branch does not exist!\n");
       exit(1);
     }
-    tftops_subjet_eta_isLoaded = true;
+    tftops_subjet_eta_loadedGen = entryGeneration;
   }
   return *tftops_subjet_eta_;
 }
 
 const vector<vector<float> > &StopTree::tftops_subjet_phi() {
-  if (not tftops_subjet_phi_isLoaded) {
+  if (tftops_subjet_phi_loadedGen != entryGeneration) {
     if (tftops_subjet_phi_branch != 0) {
       tftops_subjet_phi_branch->GetEntry(index);
     } else {
       printf("branch tftops_subjet_phi_branch does not exist!\n");
       exit(1);
     }
-    tftops_subjet_phi_isLoaded = true;
+    tftops_subjet_phi_loadedGen = entryGeneration;
   }
   return *tftops_subjet_phi_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_cvsl() {
-  if (not jup_ak4pfjets_cvsl_isLoaded) {
-    if (jup_ak4pfjets_cvsl_branch != 0) {
+  if (jup_ak4pfjets_cvsl_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_cvsl_flat.IsActive()) {
+      jup_ak4pfjets_cvsl_ = jup_ak4pfjets_cvsl_flat.Get(index);
+    } else if (jup_ak4pfjets_cvsl_branch != 0) {
       jup_ak4pfjets_cvsl_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_cvsl_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_cvsl_isLoaded = true;
+    jup_ak4pfjets_cvsl_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_cvsl_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_ptD() {
-  if (not jup_ak4pfjets_ptD_isLoaded) {
-    if (jup_ak4pfjets_ptD_branch != 0) {
+  if (jup_ak4pfjets_ptD_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_ptD_flat.IsActive()) {
+      jup_ak4pfjets_ptD_ = jup_ak4pfjets_ptD_flat.Get(index);
+    } else if (jup_ak4pfjets_ptD_branch != 0) {
       jup_ak4pfjets_ptD_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_ptD_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_ptD_isLoaded = true;
+    jup_ak4pfjets_ptD_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_ptD_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_axis1() {
-  if (not jup_ak4pfjets_axis1_isLoaded) {
-    if (jup_ak4pfjets_axis1_branch != 0) {
+  if (jup_ak4pfjets_axis1_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_axis1_flat.IsActive()) {
+      jup_ak4pfjets_axis1_ = jup_ak4pfjets_axis1_flat.Get(index);
+    } else if (jup_ak4pfjets_axis1_branch != 0) {
       jup_ak4pfjets_axis1_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_axis1_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_axis1_isLoaded = true;
+    jup_ak4pfjets_axis1_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_axis1_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_axis2() {
-  if (not jup_ak4pfjets_axis2_isLoaded) {
-    if (jup_ak4pfjets_axis2_branch != 0) {
+  if (jup_ak4pfjets_axis2_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_axis2_flat.IsActive()) {
+      jup_ak4pfjets_axis2_ = jup_ak4pfjets_axis2_flat.Get(index);
+    } else if (jup_ak4pfjets_axis2_branch != 0) {
       jup_ak4pfjets_axis2_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_axis2_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_axis2_isLoaded = true;
+    jup_ak4pfjets_axis2_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_axis2_;
 }
 
 const vector<int> &StopTree::jup_ak4pfjets_mult() {
-  if (not jup_ak4pfjets_mult_isLoaded) {
-    if (jup_ak4pfjets_mult_branch != 0) {
+  if (jup_ak4pfjets_mult_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_mult_flat.IsActive()) {
+      jup_ak4pfjets_mult_ = jup_ak4pfjets_mult_flat.Get(index);
+    } else if (jup_ak4pfjets_mult_branch != 0) {
       jup_ak4pfjets_mult_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_mult_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_mult_isLoaded = true;
+    jup_ak4pfjets_mult_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_mult_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_deepCSVb() {
-  if (not jup_ak4pfjets_deepCSVb_isLoaded) {
-    if (jup_ak4pfjets_deepCSVb_branch != 0) {
+  if (jup_ak4pfjets_deepCSVb_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_deepCSVb_flat.IsActive()) {
+      jup_ak4pfjets_deepCSVb_ = jup_ak4pfjets_deepCSVb_flat.Get(index);
+    } else if (jup_ak4pfjets_deepCSVb_branch != 0) {
       jup_ak4pfjets_deepCSVb_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_deepCSVb_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_deepCSVb_isLoaded = true;
+    jup_ak4pfjets_deepCSVb_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_deepCSVb_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_deepCSVbb() {
-  if (not jup_ak4pfjets_deepCSVbb_isLoaded) {
-    if (jup_ak4pfjets_deepCSVbb_branch != 0) {
+  if (jup_ak4pfjets_deepCSVbb_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_deepCSVbb_flat.IsActive()) {
+      jup_ak4pfjets_deepCSVbb_ = jup_ak4pfjets_deepCSVbb_flat.Get(index);
+    } else if (jup_ak4pfjets_deepCSVbb_branch != 0) {
       jup_ak4pfjets_deepCSVbb_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_deepCSVbb_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_deepCSVbb_isLoaded = true;
+    jup_ak4pfjets_deepCSVbb_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_deepCSVbb_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_deepCSVc() {
-  if (not jup_ak4pfjets_deepCSVc_isLoaded) {
-    if (jup_ak4pfjets_deepCSVc_branch != 0) {
+  if (jup_ak4pfjets_deepCSVc_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_deepCSVc_flat.IsActive()) {
+      jup_ak4pfjets_deepCSVc_ = jup_ak4pfjets_deepCSVc_flat.Get(index);
+    } else if (jup_ak4pfjets_deepCSVc_branch != 0) {
       jup_ak4pfjets_deepCSVc_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_deepCSVc_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_deepCSVc_isLoaded = true;
+    jup_ak4pfjets_deepCSVc_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_deepCSVc_;
 }
 
 const vector<float> &StopTree::jup_ak4pfjets_deepCSVl() {
-  if (not jup_ak4pfjets_deepCSVl_isLoaded) {
-    if (jup_ak4pfjets_deepCSVl_branch != 0) {
+  if (jup_ak4pfjets_deepCSVl_loadedGen != entryGeneration) {
+    if (jup_ak4pfjets_deepCSVl_flat.IsActive()) {
+      jup_ak4pfjets_deepCSVl_ = jup_ak4pfjets_deepCSVl_flat.Get(index);
+    } else if (jup_ak4pfjets_deepCSVl_branch != 0) {
       jup_ak4pfjets_deepCSVl_branch->GetEntry(index);
     } else {
       printf("branch jup_ak4pfjets_deepCSVl_branch does not exist!\n");
       exit(1);
     }
-    jup_ak4pfjets_deepCSVl_isLoaded = true;
+    jup_ak4pfjets_deepCSVl_loadedGen = entryGeneration;
   }
   return *jup_ak4pfjets_deepCSVl_;
 }
 
 const vector<vector<int> > &StopTree::jup_topcands_ak4idx() {
-  if (not jup_topcands_ak4idx_isLoaded) {
+  if (jup_topcands_ak4idx_loadedGen != entryGeneration) {
     if (jup_topcands_ak4idx_branch != 0) {
       jup_topcands_ak4idx_branch->GetEntry(index);
     } else {
       printf("branch jup_topcands_ak4idx_branch does not exist!\n");
       exit(1);
     }
-    jup_topcands_ak4idx_isLoaded = true;
+    jup_topcands_ak4idx_loadedGen = entryGeneration;
   }
   return *jup_topcands_ak4idx_;
 }
 
 const vector<float> &StopTree::jup_topcands_disc() {
-  if (not jup_topcands_disc_isLoaded) {
-    if (jup_topcands_disc_branch != 0) {
+  if (jup_topcands_disc_loadedGen != entryGeneration) {
+    if (jup_topcands_disc_flat.IsActive()) {
+      jup_topcands_disc_ = jup_topcands_disc_flat.Get(index);
+    } else if (jup_topcands_disc_branch != 0) {
       jup_topcands_disc_branch->GetEntry(index);
     } else {
       printf("branch jup_topcands_disc_branch does not exist!\n");
       exit(1);
     }
-    jup_topcands_disc_isLoaded = true;
+    jup_topcands_disc_loadedGen = entryGeneration;
   }
   return *jup_topcands_disc_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jup_topcands_p4() {
-  if (not jup_topcands_p4_isLoaded) {
-    if (jup_topcands_p4_branch != 0) {
+  if (jup_topcands_p4_loadedGen != entryGeneration) {
+    if (jup_topcands_p4_flat.IsActive()) {
+      jup_topcands_p4_ = jup_topcands_p4_flat.Get(index);
+    } else if (jup_topcands_p4_branch != 0) {
       jup_topcands_p4_branch->GetEntry(index);
+    } else if (jup_topcands_p4_split.IsActive()) {
+      jup_topcands_p4_ = &jup_topcands_p4_split.GetP4s(index);
     } else {
       printf("branch jup_topcands_p4_branch does not exist!\n");
       exit(1);
     }
-    jup_topcands_p4_isLoaded = true;
+    jup_topcands_p4_loadedGen = entryGeneration;
   }
   return *jup_topcands_p4_;
 }
 
+const PolarArrays &StopTree::jup_topcands_p4_polar() {
+  if (jup_topcands_p4_polarGen != entryGeneration) {
+    if (jup_topcands_p4_branch == 0 && jup_topcands_p4_split.IsActive()) jup_topcands_p4_split.GetPolar(index, jup_topcands_p4_polar_);
+    else jup_topcands_p4_polar_.Fill(jup_topcands_p4());
+    jup_topcands_p4_polarGen = entryGeneration;
+  }
+  return jup_topcands_p4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jup_topcands_Wp4() {
-  if (not jup_topcands_Wp4_isLoaded) {
-    if (jup_topcands_Wp4_branch != 0) {
+  if (jup_topcands_Wp4_loadedGen != entryGeneration) {
+    if (jup_topcands_Wp4_flat.IsActive()) {
+      jup_topcands_Wp4_ = jup_topcands_Wp4_flat.Get(index);
+    } else if (jup_topcands_Wp4_branch != 0) {
       jup_topcands_Wp4_branch->GetEntry(index);
+    } else if (jup_topcands_Wp4_split.IsActive()) {
+      jup_topcands_Wp4_ = &jup_topcands_Wp4_split.GetP4s(index);
     } else {
       printf("branch jup_topcands_Wp4_branch does not exist!\n");
       exit(1);
     }
-    jup_topcands_Wp4_isLoaded = true;
+    jup_topcands_Wp4_loadedGen = entryGeneration;
   }
   return *jup_topcands_Wp4_;
 }
 
+const PolarArrays &StopTree::jup_topcands_Wp4_polar() {
+  if (jup_topcands_Wp4_polarGen != entryGeneration) {
+    if (jup_topcands_Wp4_branch == 0 && jup_topcands_Wp4_split.IsActive()) jup_topcands_Wp4_split.GetPolar(index, jup_topcands_Wp4_polar_);
+    else jup_topcands_Wp4_polar_.Fill(jup_topcands_Wp4());
+    jup_topcands_Wp4_polarGen = entryGeneration;
+  }
+  return jup_topcands_Wp4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jup_tftops_p4() {
-  if (not jup_tftops_p4_isLoaded) {
-    if (jup_tftops_p4_branch != 0) {
+  if (jup_tftops_p4_loadedGen != entryGeneration) {
+    if (jup_tftops_p4_flat.IsActive()) {
+      jup_tftops_p4_ = jup_tftops_p4_flat.Get(index);
+    } else if (jup_tftops_p4_branch != 0) {
       jup_tftops_p4_branch->GetEntry(index);
+    } else if (jup_tftops_p4_split.IsActive()) {
+      jup_tftops_p4_ = &jup_tftops_p4_split.GetP4s(index);
     } else {
       printf("branch jup_tftops_p4_branch does not exist!\n");
       exit(1);
     }
-    jup_tftops_p4_isLoaded = true;
+    jup_tftops_p4_loadedGen = entryGeneration;
   }
   return *jup_tftops_p4_;
 }
 
+const PolarArrays &StopTree::jup_tftops_p4_polar() {
+  if (jup_tftops_p4_polarGen != entryGeneration) {
+    if (jup_tftops_p4_branch == 0 && jup_tftops_p4_split.IsActive()) jup_tftops_p4_split.GetPolar(index, jup_tftops_p4_polar_);
+    else jup_tftops_p4_polar_.Fill(jup_tftops_p4());
+    jup_tftops_p4_polarGen = entryGeneration;
+  }
+  return jup_tftops_p4_polar_;
+}
+
 const vector<float> &StopTree::jup_tftops_disc() {
-  if (not jup_tftops_disc_isLoaded) {
-    if (jup_tftops_disc_branch != 0) {
+  if (jup_tftops_disc_loadedGen != entryGeneration) {
+    if (jup_tftops_disc_flat.IsActive()) {
+      jup_tftops_disc_ = jup_tftops_disc_flat.Get(index);
+    } else if (jup_tftops_disc_branch != 0) {
       jup_tftops_disc_branch->GetEntry(index);
     } else {
       printf("branch jup_tftops_disc_branch does not exist!\n");
       exit(1);
     }
-    jup_tftops_disc_isLoaded = true;
+    jup_tftops_disc_loadedGen = entryGeneration;
   }
   return *jup_tftops_disc_;
 }
 
 const vector<vector<float> > &StopTree::jup_tftops_subjet_pt() {
-  if (not jup_tftops_subjet_pt_isLoaded) {
+  if (jup_tftops_subjet_pt_loadedGen != entryGeneration) {
     if (jup_tftops_subjet_pt_branch != 0) {
       jup_tftops_subjet_pt_branch->GetEntry(index);
     } else {
       printf("branch jup_tftops_subjet_pt_branch does not exist!\n");
       exit(1);
     }
-    jup_tftops_subjet_pt_isLoaded = true;
+    jup_tftops_subjet_pt_loadedGen = entryGeneration;
   }
   return *jup_tftops_subjet_pt_;
 }
 
 const vector<vector<float> > &StopTree::jup_tftops_subjet_eta() {
-  if (not jup_tftops_subjet_eta_isLoaded) {
+  if (jup_tftops_subjet_eta_loadedGen != entryGeneration) {
     if (jup_tftops_subjet_eta_branch != 0) {
       jup_tftops_subjet_eta_branch->GetEntry(index);
     } else {
       printf("branch jup_tftops_subjet_eta_branch does not exist!\n");
       exit(1);
     }
-    jup_tftops_subjet_eta_isLoaded = true;
+    jup_tftops_subjet_eta_loadedGen = entryGeneration;
   }
   return *jup_tftops_subjet_eta_;
 }
 
 const vector<vector<float> > &StopTree::jup_tftops_subjet_phi() {
-  if (not jup_tftops_subjet_phi_isLoaded) {
+  if (jup_tftops_subjet_phi_loadedGen != entryGeneration) {
     if (jup_tftops_subjet_phi_branch != 0) {
       jup_tftops_subjet_phi_branch->GetEntry(index);
     } else {
       printf("branch jup_tftops_subjet_phi_branch does not exist!\n");
       exit(1);
     }
-    jup_tftops_subjet_phi_isLoaded = true;
+    jup_tftops_subjet_phi_loadedGen = entryGeneration;
   }
   return *jup_tftops_subjet_phi_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_cvsl() {
-  if (not jdown_ak4pfjets_cvsl_isLoaded) {
-    if (jdown_ak4pfjets_cvsl_branch != 0) {
+  if (jdown_ak4pfjets_cvsl_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_cvsl_flat.IsActive()) {
+      jdown_ak4pfjets_cvsl_ = jdown_ak4pfjets_cvsl_flat.Get(index);
+    } else if (jdown_ak4pfjets_cvsl_branch != 0) {
       jdown_ak4pfjets_cvsl_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_cvsl_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_cvsl_isLoaded = true;
+    jdown_ak4pfjets_cvsl_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_cvsl_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_ptD() {
-  if (not jdown_ak4pfjets_ptD_isLoaded) {
-    if (jdown_ak4pfjets_ptD_branch != 0) {
+  if (jdown_ak4pfjets_ptD_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_ptD_flat.IsActive()) {
+      jdown_ak4pfjets_ptD_ = jdown_ak4pfjets_ptD_flat.Get(index);
+    } else if (jdown_ak4pfjets_ptD_branch != 0) {
       jdown_ak4pfjets_ptD_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_ptD_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_ptD_isLoaded = true;
+    jdown_ak4pfjets_ptD_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_ptD_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_axis1() {
-  if (not jdown_ak4pfjets_axis1_isLoaded) {
-    if (jdown_ak4pfjets_axis1_branch != 0) {
+  if (jdown_ak4pfjets_axis1_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_axis1_flat.IsActive()) {
+      jdown_ak4pfjets_axis1_ = jdown_ak4pfjets_axis1_flat.Get(index);
+    } else if (jdown_ak4pfjets_axis1_branch != 0) {
       jdown_ak4pfjets_axis1_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_axis1_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_axis1_isLoaded = true;
+    jdown_ak4pfjets_axis1_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_axis1_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_axis2() {
-  if (not jdown_ak4pfjets_axis2_isLoaded) {
-    if (jdown_ak4pfjets_axis2_branch != 0) {
+  if (jdown_ak4pfjets_axis2_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_axis2_flat.IsActive()) {
+      jdown_ak4pfjets_axis2_ = jdown_ak4pfjets_axis2_flat.Get(index);
+    } else if (jdown_ak4pfjets_axis2_branch != 0) {
       jdown_ak4pfjets_axis2_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_axis2_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_axis2_isLoaded = true;
+    jdown_ak4pfjets_axis2_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_axis2_;
 }
 
 const vector<int> &StopTree::jdown_ak4pfjets_mult() {
-  if (not jdown_ak4pfjets_mult_isLoaded) {
-    if (jdown_ak4pfjets_mult_branch != 0) {
+  if (jdown_ak4pfjets_mult_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_mult_flat.IsActive()) {
+      jdown_ak4pfjets_mult_ = jdown_ak4pfjets_mult_flat.Get(index);
+    } else if (jdown_ak4pfjets_mult_branch != 0) {
       jdown_ak4pfjets_mult_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_mult_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_mult_isLoaded = true;
+    jdown_ak4pfjets_mult_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_mult_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_deepCSVb() {
-  if (not jdown_ak4pfjets_deepCSVb_isLoaded) {
-    if (jdown_ak4pfjets_deepCSVb_branch != 0) {
+  if (jdown_ak4pfjets_deepCSVb_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_deepCSVb_flat.IsActive()) {
+      jdown_ak4pfjets_deepCSVb_ = jdown_ak4pfjets_deepCSVb_flat.Get(index);
+    } else if (jdown_ak4pfjets_deepCSVb_branch != 0) {
       jdown_ak4pfjets_deepCSVb_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_deepCSVb_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_deepCSVb_isLoaded = true;
+    jdown_ak4pfjets_deepCSVb_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_deepCSVb_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_deepCSVbb() {
-  if (not jdown_ak4pfjets_deepCSVbb_isLoaded) {
-    if (jdown_ak4pfjets_deepCSVbb_branch != 0) {
+  if (jdown_ak4pfjets_deepCSVbb_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_deepCSVbb_flat.IsActive()) {
+      jdown_ak4pfjets_deepCSVbb_ = jdown_ak4pfjets_deepCSVbb_flat.Get(index);
+    } else if (jdown_ak4pfjets_deepCSVbb_branch != 0) {
       jdown_ak4pfjets_deepCSVbb_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_deepCSVbb_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_deepCSVbb_isLoaded = true;
+    jdown_ak4pfjets_deepCSVbb_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_deepCSVbb_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_deepCSVc() {
-  if (not jdown_ak4pfjets_deepCSVc_isLoaded) {
-    if (jdown_ak4pfjets_deepCSVc_branch != 0) {
+  if (jdown_ak4pfjets_deepCSVc_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_deepCSVc_flat.IsActive()) {
+      jdown_ak4pfjets_deepCSVc_ = jdown_ak4pfjets_deepCSVc_flat.Get(index);
+    } else if (jdown_ak4pfjets_deepCSVc_branch != 0) {
       jdown_ak4pfjets_deepCSVc_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_deepCSVc_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_deepCSVc_isLoaded = true;
+    jdown_ak4pfjets_deepCSVc_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_deepCSVc_;
 }
 
 const vector<float> &StopTree::jdown_ak4pfjets_deepCSVl() {
-  if (not jdown_ak4pfjets_deepCSVl_isLoaded) {
-    if (jdown_ak4pfjets_deepCSVl_branch != 0) {
+  if (jdown_ak4pfjets_deepCSVl_loadedGen != entryGeneration) {
+    if (jdown_ak4pfjets_deepCSVl_flat.IsActive()) {
+      jdown_ak4pfjets_deepCSVl_ = jdown_ak4pfjets_deepCSVl_flat.Get(index);
+    } else if (jdown_ak4pfjets_deepCSVl_branch != 0) {
       jdown_ak4pfjets_deepCSVl_branch->GetEntry(index);
     } else {
       printf("branch jdown_ak4pfjets_deepCSVl_branch does not exist!\n");
       exit(1);
     }
-    jdown_ak4pfjets_deepCSVl_isLoaded = true;
+    jdown_ak4pfjets_deepCSVl_loadedGen = entryGeneration;
   }
   return *jdown_ak4pfjets_deepCSVl_;
 }
 
 const vector<vector<int> > &StopTree::jdown_topcands_ak4idx() {
-  if (not jdown_topcands_ak4idx_isLoaded) {
+  if (jdown_topcands_ak4idx_loadedGen != entryGeneration) {
     if (jdown_topcands_ak4idx_branch != 0) {
       jdown_topcands_ak4idx_branch->GetEntry(index);
     } else {
       printf("branch jdown_topcands_ak4idx_branch does not exist!\n");
       exit(1);
     }
-    jdown_topcands_ak4idx_isLoaded = true;
+    jdown_topcands_ak4idx_loadedGen = entryGeneration;
   }
   return *jdown_topcands_ak4idx_;
 }
 
 const vector<float> &StopTree::jdown_topcands_disc() {
-  if (not jdown_topcands_disc_isLoaded) {
-    if (jdown_topcands_disc_branch != 0) {
+  if (jdown_topcands_disc_loadedGen != entryGeneration) {
+    if (jdown_topcands_disc_flat.IsActive()) {
+      jdown_topcands_disc_ = jdown_topcands_disc_flat.Get(index);
+    } else if (jdown_topcands_disc_branch != 0) {
       jdown_topcands_disc_branch->GetEntry(index);
     } else {
       printf("branch jdown_topcands_disc_branch does not exist!\n");
       exit(1);
     }
-    jdown_topcands_disc_isLoaded = true;
+    jdown_topcands_disc_loadedGen = entryGeneration;
   }
   return *jdown_topcands_disc_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jdown_topcands_p4() {
-  if (not jdown_topcands_p4_isLoaded) {
-    if (jdown_topcands_p4_branch != 0) {
+  if (jdown_topcands_p4_loadedGen != entryGeneration) {
+    if (jdown_topcands_p4_flat.IsActive()) {
+      jdown_topcands_p4_ = jdown_topcands_p4_flat.Get(index);
+    } else if (jdown_topcands_p4_branch != 0) {
       jdown_topcands_p4_branch->GetEntry(index);
+    } else if (jdown_topcands_p4_split.IsActive()) {
+      jdown_topcands_p4_ = &jdown_topcands_p4_split.GetP4s(index);
     } else {
       printf("branch jdown_topcands_p4_branch does not exist!\n");
       exit(1);
     }
-    jdown_topcands_p4_isLoaded = true;
+    jdown_topcands_p4_loadedGen = entryGeneration;
   }
   return *jdown_topcands_p4_;
 }
 
+const PolarArrays &StopTree::jdown_topcands_p4_polar() {
+  if (jdown_topcands_p4_polarGen != entryGeneration) {
+    if (jdown_topcands_p4_branch == 0 && jdown_topcands_p4_split.IsActive()) jdown_topcands_p4_split.GetPolar(index, jdown_topcands_p4_polar_);
+    else jdown_topcands_p4_polar_.Fill(jdown_topcands_p4());
+    jdown_topcands_p4_polarGen = entryGeneration;
+  }
+  return jdown_topcands_p4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jdown_topcands_Wp4() {
-  if (not jdown_topcands_Wp4_isLoaded) {
-    if (jdown_topcands_Wp4_branch != 0) {
+  if (jdown_topcands_Wp4_loadedGen != entryGeneration) {
+    if (jdown_topcands_Wp4_flat.IsActive()) {
+      jdown_topcands_Wp4_ = jdown_topcands_Wp4_flat.Get(index);
+    } else if (jdown_topcands_Wp4_branch != 0) {
       jdown_topcands_Wp4_branch->GetEntry(index);
+    } else if (jdown_topcands_Wp4_split.IsActive()) {
+      jdown_topcands_Wp4_ = &jdown_topcands_Wp4_split.GetP4s(index);
     } else {
       printf("branch jdown_topcands_Wp4_branch does not exist!\n");
       exit(1);
     }
-    jdown_topcands_Wp4_isLoaded = true;
+    jdown_topcands_Wp4_loadedGen = entryGeneration;
   }
   return *jdown_topcands_Wp4_;
 }
 
+const PolarArrays &StopTree::jdown_topcands_Wp4_polar() {
+  if (jdown_topcands_Wp4_polarGen != entryGeneration) {
+    if (jdown_topcands_Wp4_branch == 0 && jdown_topcands_Wp4_split.IsActive()) jdown_topcands_Wp4_split.GetPolar(index, jdown_topcands_Wp4_polar_);
+    else jdown_topcands_Wp4_polar_.Fill(jdown_topcands_Wp4());
+    jdown_topcands_Wp4_polarGen = entryGeneration;
+  }
+  return jdown_topcands_Wp4_polar_;
+}
+
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::jdown_tftops_p4() {
-  if (not jdown_tftops_p4_isLoaded) {
-    if (jdown_tftops_p4_branch != 0) {
+  if (jdown_tftops_p4_loadedGen != entryGeneration) {
+    if (jdown_tftops_p4_flat.IsActive()) {
+      jdown_tftops_p4_ = jdown_tftops_p4_flat.Get(index);
+    } else if (jdown_tftops_p4_branch != 0) {
       jdown_tftops_p4_branch->GetEntry(index);
+    } else if (jdown_tftops_p4_split.IsActive()) {
+      jdown_tftops_p4_ = &jdown_tftops_p4_split.GetP4s(index);
     } else {
       printf("branch jdown_tftops_p4_branch does not exist!\n");
       exit(1);
     }
-    jdown_tftops_p4_isLoaded = true;
+    jdown_tftops_p4_loadedGen = entryGeneration;
   }
   return *jdown_tftops_p4_;
 }
 
+const PolarArrays &StopTree::jdown_tftops_p4_polar() {
+  if (jdown_tftops_p4_polarGen != entryGeneration) {
+    if (jdown_tftops_p4_branch == 0 && jdown_tftops_p4_split.IsActive()) jdown_tftops_p4_split.GetPolar(index, jdown_tftops_p4_polar_);
+    else jdown_tftops_p4_polar_.Fill(jdown_tftops_p4());
+    jdown_tftops_p4_polarGen = entryGeneration;
+  }
+  return jdown_tftops_p4_polar_;
+}
+
 const vector<float> &StopTree::jdown_tftops_disc() {
-  if (not jdown_tftops_disc_isLoaded) {
-    if (jdown_tftops_disc_branch != 0) {
+  if (jdown_tftops_disc_loadedGen != entryGeneration) {
+    if (jdown_tftops_disc_flat.IsActive()) {
+      jdown_tftops_disc_ = jdown_tftops_disc_flat.Get(index);
+    } else if (jdown_tftops_disc_branch != 0) {
       jdown_tftops_disc_branch->GetEntry(index);
     } else {
       printf("branch jdown_tftops_disc_branch does not exist!\n");
       exit(1);
     }
-    jdown_tftops_disc_isLoaded = true;
+    jdown_tftops_disc_loadedGen = entryGeneration;
   }
   return *jdown_tftops_disc_;
 }
 
 const vector<vector<float> > &StopTree::jdown_tftops_subjet_pt() {
-  if (not jdown_tftops_subjet_pt_isLoaded) {
+  if (jdown_tftops_subjet_pt_loadedGen != entryGeneration) {
     if (jdown_tftops_subjet_pt_branch != 0) {
       jdown_tftops_subjet_pt_branch->GetEntry(index);
     } else {
       printf("branch jdown_tftops_subjet_pt_branch does not exist!\n");
       exit(1);
     }
-    jdown_tftops_subjet_pt_isLoaded = true;
+    jdown_tftops_subjet_pt_loadedGen = entryGeneration;
   }
   return *jdown_tftops_subjet_pt_;
 }
 
 const vector<vector<float> > &StopTree::jdown_tftops_subjet_eta() {
-  if (not jdown_tftops_subjet_eta_isLoaded) {
+  if (jdown_tftops_subjet_eta_loadedGen != entryGeneration) {
     if (jdown_tftops_subjet_eta_branch != 0) {
       jdown_tftops_subjet_eta_branch->GetEntry(index);
     } else {
       printf("branch jdown_tftops_subjet_eta_branch does not exist!\n");
       exit(1);
     }
-    jdown_tftops_subjet_eta_isLoaded = true;
+    jdown_tftops_subjet_eta_loadedGen = entryGeneration;
   }
   return *jdown_tftops_subjet_eta_;
 }
 
 const vector<vector<float> > &StopTree::jdown_tftops_subjet_phi() {
-  if (not jdown_tftops_subjet_phi_isLoaded) {
+  if (jdown_tftops_subjet_phi_loadedGen != entryGeneration) {
     if (jdown_tftops_subjet_phi_branch != 0) {
       jdown_tftops_subjet_phi_branch->GetEntry(index);
     } else {
       printf("branch jdown_tftops_subjet_phi_branch does not exist!\n");
       exit(1);
     }
-    jdown_tftops_subjet_phi_isLoaded = true;
+    jdown_tftops_subjet_phi_loadedGen = entryGeneration;
   }
   return *jdown_tftops_subjet_phi_;
 }
 
 const vector<TString> &StopTree::tau_IDnames() {
-  if (not tau_IDnames_isLoaded) {
+  if (tau_IDnames_loadedGen != entryGeneration) {
     if (tau_IDnames_branch != 0) {
       tau_IDnames_branch->GetEntry(index);
     } else {
       printf("branch tau_IDnames_branch does not exist!\n");
       exit(1);
     }
-    tau_IDnames_isLoaded = true;
+    tau_IDnames_loadedGen = entryGeneration;
   }
   return *tau_IDnames_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::tau_p4() {
-  if (not tau_p4_isLoaded) {
-    if (tau_p4_branch != 0) {
+  if (tau_p4_loadedGen != entryGeneration) {
+    if (tau_p4_flat.IsActive()) {
+      tau_p4_ = tau_p4_flat.Get(index);
+    } else if (tau_p4_branch != 0) {
       tau_p4_branch->GetEntry(index);
+    } else if (tau_p4_split.IsActive()) {
+      tau_p4_ = &tau_p4_split.GetP4s(index);
     } else {
       printf("branch tau_p4_branch does not exist!\n");
       exit(1);
     }
-    tau_p4_isLoaded = true;
+    tau_p4_loadedGen = entryGeneration;
   }
   return *tau_p4_;
 }
 
+const PolarArrays &StopTree::tau_p4_polar() {
+  if (tau_p4_polarGen != entryGeneration) {
+    if (tau_p4_branch == 0 && tau_p4_split.IsActive()) tau_p4_split.GetPolar(index, tau_p4_polar_);
+    else tau_p4_polar_.Fill(tau_p4());
+    tau_p4_polarGen = entryGeneration;
+  }
+  return tau_p4_polar_;
+}
+
 const vector<vector<float> > &StopTree::tau_ID() {
-  if (not tau_ID_isLoaded) {
+  if (tau_ID_loadedGen != entryGeneration) {
     if (tau_ID_branch != 0) {
       tau_ID_branch->GetEntry(index);
     } else {
       printf("branch tau_ID_branch does not exist!\n");
       exit(1);
     }
-    tau_ID_isLoaded = true;
+    tau_ID_loadedGen = entryGeneration;
   }
   return *tau_ID_;
 }
 
 const vector<float> &StopTree::tau_passID() {
-  if (not tau_passID_isLoaded) {
-    if (tau_passID_branch != 0) {
+  if (tau_passID_loadedGen != entryGeneration) {
+    if (tau_passID_flat.IsActive()) {
+      tau_passID_ = tau_passID_flat.Get(index);
+    } else if (tau_passID_branch != 0) {
       tau_passID_branch->GetEntry(index);
     } else {
       printf("branch tau_passID_branch does not exist!\n");
       exit(1);
     }
-    tau_passID_isLoaded = true;
+    tau_passID_loadedGen = entryGeneration;
   }
   return *tau_passID_;
 }
 
 const int &StopTree::ngoodtaus() {
-  if (not ngoodtaus_isLoaded) {
-    if (ngoodtaus_branch != 0) {
+  if (ngoodtaus_loadedGen != entryGeneration) {
+    if (ngoodtaus_flat.IsActive()) {
+      ngoodtaus_ = ngoodtaus_flat.Get(index);
+    } else if (ngoodtaus_bulk != 0) {
+      ngoodtaus_ = ngoodtaus_bulk->Get<int>(index);
+    } else if (ngoodtaus_branch != 0) {
       ngoodtaus_branch->GetEntry(index);
     } else {
       printf("branch ngoodtaus_branch does not exist!\n");
       exit(1);
     }
-    ngoodtaus_isLoaded = true;
+    ngoodtaus_loadedGen = entryGeneration;
   }
   return ngoodtaus_;
 }
 
 const vector<bool> &StopTree::tau_isVetoTau() {
-  if (not tau_isVetoTau_isLoaded) {
-    if (tau_isVetoTau_branch != 0) {
+  if (tau_isVetoTau_loadedGen != entryGeneration) {
+    if (tau_isVetoTau_flat.IsActive()) {
+      tau_isVetoTau_ = tau_isVetoTau_flat.Get(index);
+    } else if (tau_isVetoTau_branch != 0) {
       tau_isVetoTau_branch->GetEntry(index);
     } else {
       printf("branch tau_isVetoTau_branch does not exist!\n");
       exit(1);
     }
-    tau_isVetoTau_isLoaded = true;
+    tau_isVetoTau_loadedGen = entryGeneration;
   }
   return *tau_isVetoTau_;
 }
 
 const vector<bool> &StopTree::tau_isVetoTau_v2() {
-  if (not tau_isVetoTau_v2_isLoaded) {
-    if (tau_isVetoTau_v2_branch != 0) {
+  if (tau_isVetoTau_v2_loadedGen != entryGeneration) {
+    if (tau_isVetoTau_v2_flat.IsActive()) {
+      tau_isVetoTau_v2_ = tau_isVetoTau_v2_flat.Get(index);
+    } else if (tau_isVetoTau_v2_branch != 0) {
       tau_isVetoTau_v2_branch->GetEntry(index);
     } else {
       printf("branch tau_isVetoTau_v2_branch does not exist!\n");
       exit(1);
     }
-    tau_isVetoTau_v2_isLoaded = true;
+    tau_isVetoTau_v2_loadedGen = entryGeneration;
   }
   return *tau_isVetoTau_v2_;
 }
 
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &StopTree::isoTracks_p4() {
-  if (not isoTracks_p4_isLoaded) {
-    if (isoTracks_p4_branch != 0) {
+  if (isoTracks_p4_loadedGen != entryGeneration) {
+    if (isoTracks_p4_flat.IsActive()) {
+      isoTracks_p4_ = isoTracks_p4_flat.Get(index);
+    } else if (isoTracks_p4_branch != 0) {
       isoTracks_p4_branch->GetEntry(index);
+    } else if (isoTracks_p4_split.IsActive()) {
+      isoTracks_p4_ = &isoTracks_p4_split.GetP4s(index);
     } else {
       printf("branch isoTracks_p4_branch does not exist!\n");
       exit(1);
     }
-    isoTracks_p4_isLoaded = true;
+    isoTracks_p4_loadedGen = entryGeneration;
   }
   return *isoTracks_p4_;
 }
 
+const PolarArrays &StopTree::isoTracks_p4_polar() {
+  if (isoTracks_p4_polarGen != entryGeneration) {
+    if (isoTracks_p4_branch == 0 && isoTracks_p4_split.IsActive()) isoTracks_p4_split.GetPolar(index, isoTracks_p4_polar_);
+    else isoTracks_p4_polar_.Fill(isoTracks_p4());
+    isoTracks_p4_polarGen = entryGeneration;
+  }
+  return isoTracks_p4_polar_;
+}
+
 const vector<int> &StopTree::isoTracks_charge() {
-  if (not isoTracks_charge_isLoaded) {
-    if (isoTracks_charge_branch != 0) {
+  if (isoTracks_charge_loadedGen != entryGeneration) {
+    if (isoTracks_charge_flat.IsActive()) {
+      isoTracks_charge_ = isoTracks_charge_flat.Get(index);
+    } else if (isoTracks_charge_branch != 0) {
       isoTracks_charge_branch->GetEntry(index);
     } else {
       printf("branch isoTracks_charge_branch does not exist!\n");
       exit(1);
     }
-    isoTracks_charge_isLoaded = true;
+    isoTracks_charge_loadedGen = entryGeneration;
   }
   return *isoTracks_charge_;
 }
 
 const vector<float> &StopTree::isoTracks_absIso() {
-  if (not isoTracks_absIso_isLoaded) {
-    if (isoTracks_absIso_branch != 0) {
+  if (isoTracks_absIso_loadedGen != entryGeneration) {
+    if (isoTracks_absIso_flat.IsActive()) {
+      isoTracks_absIso_ = isoTracks_absIso_flat.Get(index);
+    } else if (isoTracks_absIso_branch != 0) {
       isoTracks_absIso_branch->GetEntry(index);
     } else {
       printf("branch isoTracks_absIso_branch does not exist!\n");
       exit(1);
     }
-    isoTracks_absIso_isLoaded = true;
+    isoTracks_absIso_loadedGen = entryGeneration;
   }
   return *isoTracks_absIso_;
 }
 
 const vector<float> &StopTree::isoTracks_dz() {
-  if (not isoTracks_dz_isLoaded) {
-    if (isoTracks_dz_branch != 0) {
+  if (isoTracks_dz_loadedGen != entryGeneration) {
+    if (isoTracks_dz_flat.IsActive()) {
+      isoTracks_dz_ = isoTracks_dz_flat.Get(index);
+    } else if (isoTracks_dz_branch != 0) {
       isoTracks_dz_branch->GetEntry(index);
     } else {
       printf("branch isoTracks_dz_branch does not exist!\n");
       exit(1);
     }
-    isoTracks_dz_isLoaded = true;
+    isoTracks_dz_loadedGen = entryGeneration;
   }
   return *isoTracks_dz_;
 }
 
 const vector<int> &StopTree::isoTracks_pdgId() {
-  if (not isoTracks_pdgId_isLoaded) {
-    if (isoTracks_pdgId_branch != 0) {
+  if (isoTracks_pdgId_loadedGen != entryGeneration) {
+    if (isoTracks_pdgId_flat.IsActive()) {
+      isoTracks_pdgId_ = isoTracks_pdgId_flat.Get(index);
+    } else if (isoTracks_pdgId_branch != 0) {
       isoTracks_pdgId_branch->GetEntry(index);
     } else {
       printf("branch isoTracks_pdgId_branch does not exist!\n");
       exit(1);
     }
-    isoTracks_pdgId_isLoaded = true;
+    isoTracks_pdgId_loadedGen = entryGeneration;
   }
   return *isoTracks_pdgId_;
 }
 
 const vector<bool> &StopTree::isoTracks_isVetoTrack() {
-  if (not isoTracks_isVetoTrack_isLoaded) {
-    if (isoTracks_isVetoTrack_branch != 0) {
+  if (isoTracks_isVetoTrack_loadedGen != entryGeneration) {
+    if (isoTracks_isVetoTrack_flat.IsActive()) {
+      isoTracks_isVetoTrack_ = isoTracks_isVetoTrack_flat.Get(index);
+    } else if (isoTracks_isVetoTrack_branch != 0) {
       isoTracks_isVetoTrack_branch->GetEntry(index);
     } else {
       printf("branch isoTracks_isVetoTrack_branch does not exist!\n");
       exit(1);
     }
-    isoTracks_isVetoTrack_isLoaded = true;
+    isoTracks_isVetoTrack_loadedGen = entryGeneration;
   }
   return *isoTracks_isVetoTrack_;
 }
 
 const vector<bool> &StopTree::isoTracks_isVetoTrack_v2() {
-  if (not isoTracks_isVetoTrack_v2_isLoaded) {
-    if (isoTracks_isVetoTrack_v2_branch != 0) {
+  if (isoTracks_isVetoTrack_v2_loadedGen != entryGeneration) {
+    if (isoTracks_isVetoTrack_v2_flat.IsActive()) {
+      isoTracks_isVetoTrack_v2_ = isoTracks_isVetoTrack_v2_flat.Get(index);
+    } else if (isoTracks_isVetoTrack_v2_branch != 0) {
       isoTracks_isVetoTrack_v2_branch->GetEntry(index);
     } else {
       printf("branch isoTracks_isVetoTrack_v2_branch does not exist!\n");
       exit(1);
     }
-    isoTracks_isVetoTrack_v2_isLoaded = true;
+    isoTracks_isVetoTrack_v2_loadedGen = entryGeneration;
   }
   return *isoTracks_isVetoTrack_v2_;
 }
 
 const vector<bool> &StopTree::isoTracks_isVetoTrack_v3() {
-  if (not isoTracks_isVetoTrack_v3_isLoaded) {
-    if (isoTracks_isVetoTrack_v3_branch != 0) {
+  if (isoTracks_isVetoTrack_v3_loadedGen != entryGeneration) {
+    if (isoTracks_isVetoTrack_v3_flat.IsActive()) {
+      isoTracks_isVetoTrack_v3_ = isoTracks_isVetoTrack_v3_flat.Get(index);
+    } else if (isoTracks_isVetoTrack_v3_branch != 0) {
       isoTracks_isVetoTrack_v3_branch->GetEntry(index);
     } else {
       printf("branch isoTracks_isVetoTrack_v3_branch does not exist!\n");
       exit(1);
     }
-    isoTracks_isVetoTrack_v3_isLoaded = true;
+    isoTracks_isVetoTrack_v3_loadedGen = entryGeneration;
   }
   return *isoTracks_isVetoTrack_v3_;
 }
 
 const int &StopTree::ph_selectedidx() {
-  if (not ph_selectedidx_isLoaded) {
-    if (ph_selectedidx_branch != 0) {
+  if (ph_selectedidx_loadedGen != entryGeneration) {
+    if (ph_selectedidx_flat.IsActive()) {
+      ph_selectedidx_ = ph_selectedidx_flat.Get(index);
+    } else if (ph_selectedidx_bulk != 0) {
+      ph_selectedidx_ = ph_selectedidx_bulk->Get<int>(index);
+    } else if (ph_selectedidx_branch != 0) {
       ph_selectedidx_branch->GetEntry(index);
     } else {
       printf("branch ph_selectedidx_branch does not exist!\n");
       exit(1);
     }
-    ph_selectedidx_isLoaded = true;
+    ph_selectedidx_loadedGen = entryGeneration;
   }
   return ph_selectedidx_;
 }
 
 const float &StopTree::ph_met() {
-  if (not ph_met_isLoaded) {
-    if (ph_met_branch != 0) {
+  if (ph_met_loadedGen != entryGeneration) {
+    if (ph_met_flat.IsActive()) {
+      ph_met_ = ph_met_flat.Get(index);
+    } else if (ph_met_bulk != 0) {
+      ph_met_ = ph_met_bulk->Get<float>(index);
+    } else if (ph_met_branch != 0) {
       ph_met_branch->GetEntry(index);
     } else {
       printf("branch ph_met_branch does not exist!\n");
       exit(1);
     }
-    ph_met_isLoaded = true;
+    ph_met_loadedGen = entryGeneration;
   }
   return ph_met_;
 }
 
 const float &StopTree::ph_met_phi() {
-  if (not ph_met_phi_isLoaded) {
-    if (ph_met_phi_branch != 0) {
+  if (ph_met_phi_loadedGen != entryGeneration) {
+    if (ph_met_phi_flat.IsActive()) {
+      ph_met_phi_ = ph_met_phi_flat.Get(index);
+    } else if (ph_met_phi_bulk != 0) {
+      ph_met_phi_ = ph_met_phi_bulk->Get<float>(index);
+    } else if (ph_met_phi_branch != 0) {
       ph_met_phi_branch->GetEntry(index);
     } else {
       printf("branch ph_met_phi_branch does not exist!\n");
       exit(1);
     }
-    ph_met_phi_isLoaded = true;
+    ph_met_phi_loadedGen = entryGeneration;
   }
   return ph_met_phi_;
 }
 
 const float &StopTree::ph_HT() {
-  if (not ph_HT_isLoaded) {
-    if (ph_HT_branch != 0) {
+  if (ph_HT_loadedGen != entryGeneration) {
+    if (ph_HT_flat.IsActive()) {
+      ph_HT_ = ph_HT_flat.Get(index);
+    } else if (ph_HT_bulk != 0) {
+      ph_HT_ = ph_HT_bulk->Get<float>(index);
+    } else if (ph_HT_branch != 0) {
       ph_HT_branch->GetEntry(index);
     } else {
       printf("branch ph_HT_branch does not exist!\n");
       exit(1);
     }
-    ph_HT_isLoaded = true;
+    ph_HT_loadedGen = entryGeneration;
   }
   return ph_HT_;
 }
 
 const float &StopTree::ph_htssm() {
-  if (not ph_htssm_isLoaded) {
-    if (ph_htssm_branch != 0) {
+  if (ph_htssm_loadedGen != entryGeneration) {
+    if (ph_htssm_flat.IsActive()) {
+      ph_htssm_ = ph_htssm_flat.Get(index);
+    } else if (ph_htssm_bulk != 0) {
+      ph_htssm_ = ph_htssm_bulk->Get<float>(index);
+    } else if (ph_htssm_branch != 0) {
       ph_htssm_branch->GetEntry(index);
     } else {
       printf("branch ph_htssm_branch does not exist!\n");
       exit(1);
     }
-    ph_htssm_isLoaded = true;
+    ph_htssm_loadedGen = entryGeneration;
   }
   return ph_htssm_;
 }
 
 const float &StopTree::ph_htosm() {
-  if (not ph_htosm_isLoaded) {
-    if (ph_htosm_branch != 0) {
+  if (ph_htosm_loadedGen != entryGeneration) {
+    if (ph_htosm_flat.IsActive()) {
+      ph_htosm_ = ph_htosm_flat.Get(index);
+    } else if (ph_htosm_bulk != 0) {
+      ph_htosm_ = ph_htosm_bulk->Get<float>(index);
+    } else if (ph_htosm_branch != 0) {
       ph_htosm_branch->GetEntry(index);
     } else {
       printf("branch ph_htosm_branch does not exist!\n");
       exit(1);
     }
-    ph_htosm_isLoaded = true;
+    ph_htosm_loadedGen = entryGeneration;
   }
   return ph_htosm_;
 }
 
 const float &StopTree::ph_htratiom() {
-  if (not ph_htratiom_isLoaded) {
-    if (ph_htratiom_branch != 0) {
+  if (ph_htratiom_loadedGen != entryGeneration) {
+    if (ph_htratiom_flat.IsActive()) {
+      ph_htratiom_ = ph_htratiom_flat.Get(index);
+    } else if (ph_htratiom_bulk != 0) {
+      ph_htratiom_ = ph_htratiom_bulk->Get<float>(index);
+    } else if (ph_htratiom_branch != 0) {
       ph_htratiom_branch->GetEntry(index);
     } else {
       printf("branch ph_htratiom_branch does not exist!\n");
       exit(1);
     }
-    ph_htratiom_isLoaded = true;
+    ph_htratiom_loadedGen = entryGeneration;
   }
   return ph_htratiom_;
 }
 
 const float &StopTree::ph_mt_met_lep() {
-  if (not ph_mt_met_lep_isLoaded) {
-    if (ph_mt_met_lep_branch != 0) {
+  if (ph_mt_met_lep_loadedGen != entryGeneration) {
+    if (ph_mt_met_lep_flat.IsActive()) {
+      ph_mt_met_lep_ = ph_mt_met_lep_flat.Get(index);
+    } else if (ph_mt_met_lep_bulk != 0) {
+      ph_mt_met_lep_ = ph_mt_met_lep_bulk->Get<float>(index);
+    } else if (ph_mt_met_lep_branch != 0) {
       ph_mt_met_lep_branch->GetEntry(index);
     } else {
       printf("branch ph_mt_met_lep_branch does not exist!\n");
       exit(1);
     }
-    ph_mt_met_lep_isLoaded = true;
+    ph_mt_met_lep_loadedGen = entryGeneration;
   }
   return ph_mt_met_lep_;
 }
 
 const float &StopTree::ph_dphi_Wlep() {
-  if (not ph_dphi_Wlep_isLoaded) {
-    if (ph_dphi_Wlep_branch != 0) {
+  if (ph_dphi_Wlep_loadedGen != entryGeneration) {
+    if (ph_dphi_Wlep_flat.IsActive()) {
+      ph_dphi_Wlep_ = ph_dphi_Wlep_flat.Get(index);
+    } else if (ph_dphi_Wlep_bulk != 0) {
+      ph_dphi_Wlep_ = ph_dphi_Wlep_bulk->Get<float>(index);
+    } else if (ph_dphi_Wlep_branch != 0) {
       ph_dphi_Wlep_branch->GetEntry(index);
     } else {
       printf("branch ph_dphi_Wlep_branch does not exist!\n");
       exit(1);
     }
-    ph_dphi_Wlep_isLoaded = true;
+    ph_dphi_Wlep_loadedGen = entryGeneration;
   }
   return ph_dphi_Wlep_;
 }
 
 const float &StopTree::ph_MT2W() {
-  if (not ph_MT2W_isLoaded) {
-    if (ph_MT2W_branch != 0) {
+  if (ph_MT2W_loadedGen != entryGeneration) {
+    if (ph_MT2W_flat.IsActive()) {
+      ph_MT2W_ = ph_MT2W_flat.Get(index);
+    } else if (ph_MT2W_bulk != 0) {
+      ph_MT2W_ = ph_MT2W_bulk->Get<float>(index);
+    } else if (ph_MT2W_branch != 0) {
       ph_MT2W_branch->GetEntry(index);
     } else {
       printf("branch ph_MT2W_branch does not exist!\n");
       exit(1);
     }
-    ph_MT2W_isLoaded = true;
+    ph_MT2W_loadedGen = entryGeneration;
   }
   return ph_MT2W_;
 }
 
 const float &StopTree::ph_topness() {
-  if (not ph_topness_isLoaded) {
-    if (ph_topness_branch != 0) {
+  if (ph_topness_loadedGen != entryGeneration) {
+    if (ph_topness_flat.IsActive()) {
+      ph_topness_ = ph_topness_flat.Get(index);
+    } else if (ph_topness_bulk != 0) {
+      ph_topness_ = ph_topness_bulk->Get<float>(index);
+    } else if (ph_topness_branch != 0) {
       ph_topness_branch->GetEntry(index);
     } else {
       printf("branch ph_topness_branch does not exist!\n");
       exit(1);
     }
-    ph_topness_isLoaded = true;
+    ph_topness_loadedGen = entryGeneration;
   }
   return ph_topness_;
 }
 
 const float &StopTree::ph_topnessMod() {
-  if (not ph_topnessMod_isLoaded) {
-    if (ph_topnessMod_branch != 0) {
+  if (ph_topnessMod_loadedGen != entryGeneration) {
+    if (ph_topnessMod_flat.IsActive()) {
+      ph_topnessMod_ = ph_topnessMod_flat.Get(index);
+    } else if (ph_topnessMod_bulk != 0) {
+      ph_topnessMod_ = ph_topnessMod_bulk->Get<float>(index);
+    } else if (ph_topnessMod_branch != 0) {
       ph_topnessMod_branch->GetEntry(index);
     } else {
       printf("branch ph_topnessMod_branch does not exist!\n");
       exit(1);
     }
-    ph_topnessMod_isLoaded = true;
+    ph_topnessMod_loadedGen = entryGeneration;
   }
   return ph_topnessMod_;
 }
 
 const float &StopTree::ph_MT2_ll() {
-  if (not ph_MT2_ll_isLoaded) {
-    if (ph_MT2_ll_branch != 0) {
+  if (ph_MT2_ll_loadedGen != entryGeneration) {
+    if (ph_MT2_ll_flat.IsActive()) {
+      ph_MT2_ll_ = ph_MT2_ll_flat.Get(index);
+    } else if (ph_MT2_ll_bulk != 0) {
+      ph_MT2_ll_ = ph_MT2_ll_bulk->Get<float>(index);
+    } else if (ph_MT2_ll_branch != 0) {
       ph_MT2_ll_branch->GetEntry(index);
     } else {
       printf("branch ph_MT2_ll_branch does not exist!\n");
       exit(1);
     }
-    ph_MT2_ll_isLoaded = true;
+    ph_MT2_ll_loadedGen = entryGeneration;
   }
   return ph_MT2_ll_;
 }
 
 const float &StopTree::ph_MT2_lb_b_mass() {
-  if (not ph_MT2_lb_b_mass_isLoaded) {
-    if (ph_MT2_lb_b_mass_branch != 0) {
+  if (ph_MT2_lb_b_mass_loadedGen != entryGeneration) {
+    if (ph_MT2_lb_b_mass_flat.IsActive()) {
+      ph_MT2_lb_b_mass_ = ph_MT2_lb_b_mass_flat.Get(index);
+    } else if (ph_MT2_lb_b_mass_bulk != 0) {
+      ph_MT2_lb_b_mass_ = ph_MT2_lb_b_mass_bulk->Get<float>(index);
+    } else if (ph_MT2_lb_b_mass_branch != 0) {
       ph_MT2_lb_b_mass_branch->GetEntry(index);
     } else {
       printf("branch ph_MT2_lb_b_mass_branch does not exist!\n");
       exit(1);
     }
-    ph_MT2_lb_b_mass_isLoaded = true;
+    ph_MT2_lb_b_mass_loadedGen = entryGeneration;
   }
   return ph_MT2_lb_b_mass_;
 }
 
 const float &StopTree::ph_MT2_lb_b() {
-  if (not ph_MT2_lb_b_isLoaded) {
-    if (ph_MT2_lb_b_branch != 0) {
+  if (ph_MT2_lb_b_loadedGen != entryGeneration) {
+    if (ph_MT2_lb_b_flat.IsActive()) {
+      ph_MT2_lb_b_ = ph_MT2_lb_b_flat.Get(index);
+    } else if (ph_MT2_lb_b_bulk != 0) {
+      ph_MT2_lb_b_ = ph_MT2_lb_b_bulk->Get<float>(index);
+    } else if (ph_MT2_lb_b_branch != 0) {
       ph_MT2_lb_b_branch->GetEntry(index);
     } else {
       printf("branch ph_MT2_lb_b_branch does not exist!\n");
       exit(1);
     }
-    ph_MT2_lb_b_isLoaded = true;
+    ph_MT2_lb_b_loadedGen = entryGeneration;
   }
   return ph_MT2_lb_b_;
 }
 
 const float &StopTree::ph_MT2_lb_bqq_mass() {
-  if (not ph_MT2_lb_bqq_mass_isLoaded) {
-    if (ph_MT2_lb_bqq_mass_branch != 0) {
+  if (ph_MT2_lb_bqq_mass_loadedGen != entryGeneration) {
+    if (ph_MT2_lb_bqq_mass_flat.IsActive()) {
+      ph_MT2_lb_bqq_mass_ = ph_MT2_lb_bqq_mass_flat.Get(index);
+    } else if (ph_MT2_lb_bqq_mass_bulk != 0) {
+      ph_MT2_lb_bqq_mass_ = ph_MT2_lb_bqq_mass_bulk->Get<float>(index);
+    } else if (ph_MT2_lb_bqq_mass_branch != 0) {
       ph_MT2_lb_bqq_mass_branch->GetEntry(index);
     } else {
       printf("branch ph_MT2_lb_bqq_mass_branch does not exist!\n");
       exit(1);
     }
-    ph_MT2_lb_bqq_mass_isLoaded = true;
+    ph_MT2_lb_bqq_mass_loadedGen = entryGeneration;
   }
   return ph_MT2_lb_bqq_mass_;
 }
 
 const float &StopTree::ph_MT2_lb_bqq() {
-  if (not ph_MT2_lb_bqq_isLoaded) {
-    if (ph_MT2_lb_bqq_branch != 0) {
+  if (ph_MT2_lb_bqq_loadedGen != entryGeneration) {
+    if (ph_MT2_lb_bqq_flat.IsActive()) {
+      ph_MT2_lb_bqq_ = ph_MT2_lb_bqq_flat.Get(index);
+    } else if (ph_MT2_lb_bqq_bulk != 0) {
+      ph_MT2_lb_bqq_ = ph_MT2_lb_bqq_bulk->Get<float>(index);
+    } else if (ph_MT2_lb_bqq_branch != 0) {
       ph_MT2_lb_bqq_branch->GetEntry(index);
     } else {
       printf("branch ph_MT2_lb_bqq_branch does not exist!\n");
       exit(1);
     }
-    ph_MT2_lb_bqq_isLoaded = true;
+    ph_MT2_lb_bqq_loadedGen = entryGeneration;
   }
   return ph_MT2_lb_bqq_;
 }
 
 const float &StopTree::ph_hadronic_top_chi2() {
-  if (not ph_hadronic_top_chi2_isLoaded) {
-    if (ph_hadronic_top_chi2_branch != 0) {
+  if (ph_hadronic_top_chi2_loadedGen != entryGeneration) {
+    if (ph_hadronic_top_chi2_flat.IsActive()) {
+      ph_hadronic_top_chi2_ = ph_hadronic_top_chi2_flat.Get(index);
+    } else if (ph_hadronic_top_chi2_bulk != 0) {
+      ph_hadronic_top_chi2_ = ph_hadronic_top_chi2_bulk->Get<float>(index);
+    } else if (ph_hadronic_top_chi2_branch != 0) {
       ph_hadronic_top_chi2_branch->GetEntry(index);
     } else {
       printf("branch ph_hadronic_top_chi2_branch does not exist!\n");
       exit(1);
     }
-    ph_hadronic_top_chi2_isLoaded = true;
+    ph_hadronic_top_chi2_loadedGen = entryGeneration;
   }
   return ph_hadronic_top_chi2_;
 }
 
 const float &StopTree::ph_mindphi_met_j1_j2() {
-  if (not ph_mindphi_met_j1_j2_isLoaded) {
-    if (ph_mindphi_met_j1_j2_branch != 0) {
+  if (ph_mindphi_met_j1_j2_loadedGen != entryGeneration) {
+    if (ph_mindphi_met_j1_j2_flat.IsActive()) {
+      ph_mindphi_met_j1_j2_ = ph_mindphi_met_j1_j2_flat.Get(index);
+    } else if (ph_mindphi_met_j1_j2_bulk != 0) {
+      ph_mindphi_met_j1_j2_ = ph_mindphi_met_j1_j2_bulk->Get<float>(index);
+    } else if (ph_mindphi_met_j1_j2_branch != 0) {
       ph_mindphi_met_j1_j2_branch->GetEntry(index);
     } else {
       printf("branch ph_mindphi_met_j1_j2_branch does not exist!\n");
       exit(1);
     }
-    ph_mindphi_met_j1_j2_isLoaded = true;
+    ph_mindphi_met_j1_j2_loadedGen = entryGeneration;
   }
   return ph_mindphi_met_j1_j2_;
 }
 
 const float &StopTree::ph_Mlb_lead_bdiscr() {
-  if (not ph_Mlb_lead_bdiscr_isLoaded) {
-    if (ph_Mlb_lead_bdiscr_branch != 0) {
+  if (ph_Mlb_lead_bdiscr_loadedGen != entryGeneration) {
+    if (ph_Mlb_lead_bdiscr_flat.IsActive()) {
+      ph_Mlb_lead_bdiscr_ = ph_Mlb_lead_bdiscr_flat.Get(index);
+    } else if (ph_Mlb_lead_bdiscr_bulk != 0) {
+      ph_Mlb_lead_bdiscr_ = ph_Mlb_lead_bdiscr_bulk->Get<float>(index);
+    } else if (ph_Mlb_lead_bdiscr_branch != 0) {
       ph_Mlb_lead_bdiscr_branch->GetEntry(index);
     } else {
       printf("branch ph_Mlb_lead_bdiscr_branch does not exist!\n");
       exit(1);
     }
-    ph_Mlb_lead_bdiscr_isLoaded = true;
+    ph_Mlb_lead_bdiscr_loadedGen = entryGeneration;
   }
   return ph_Mlb_lead_bdiscr_;
 }
 
 const float &StopTree::ph_dR_lep_leadb() {
-  if (not ph_dR_lep_leadb_isLoaded) {
-    if (ph_dR_lep_leadb_branch != 0) {
+  if (ph_dR_lep_leadb_loadedGen != entryGeneration) {
+    if (ph_dR_lep_leadb_flat.IsActive()) {
+      ph_dR_lep_leadb_ = ph_dR_lep_leadb_flat.Get(index);
+    } else if (ph_dR_lep_leadb_bulk != 0) {
+      ph_dR_lep_leadb_ = ph_dR_lep_leadb_bulk->Get<float>(index);
+    } else if (ph_dR_lep_leadb_branch != 0) {
       ph_dR_lep_leadb_branch->GetEntry(index);
     } else {
       printf("branch ph_dR_lep_leadb_branch does not exist!\n");
       exit(1);
     }
-    ph_dR_lep_leadb_isLoaded = true;
+    ph_dR_lep_leadb_loadedGen = entryGeneration;
   }
   return ph_dR_lep_leadb_;
 }
 
 const float &StopTree::ph_Mlb_closestb() {
-  if (not ph_Mlb_closestb_isLoaded) {
-    if (ph_Mlb_closestb_branch != 0) {
+  if (ph_Mlb_closestb_loadedGen != entryGeneration) {
+    if (ph_Mlb_closestb_flat.IsActive()) {
+      ph_Mlb_closestb_ = ph_Mlb_closestb_flat.Get(index);
+    } else if (ph_Mlb_closestb_bulk != 0) {
+      ph_Mlb_closestb_ = ph_Mlb_closestb_bulk->Get<float>(index);
+    } else if (ph_Mlb_closestb_branch != 0) {
       ph_Mlb_closestb_branch->GetEntry(index);
     } else {
       printf("branch ph_Mlb_closestb_branch does not exist!\n");
       exit(1);
     }
-    ph_Mlb_closestb_isLoaded = true;
+    ph_Mlb_closestb_loadedGen = entryGeneration;
   }
   return ph_Mlb_closestb_;
 }
 
 const float &StopTree::ph_Mjjj() {
-  if (not ph_Mjjj_isLoaded) {
-    if (ph_Mjjj_branch != 0) {
+  if (ph_Mjjj_loadedGen != entryGeneration) {
+    if (ph_Mjjj_flat.IsActive()) {
+      ph_Mjjj_ = ph_Mjjj_flat.Get(index);
+    } else if (ph_Mjjj_bulk != 0) {
+      ph_Mjjj_ = ph_Mjjj_bulk->Get<float>(index);
+    } else if (ph_Mjjj_branch != 0) {
       ph_Mjjj_branch->GetEntry(index);
     } else {
       printf("branch ph_Mjjj_branch does not exist!\n");
       exit(1);
     }
-    ph_Mjjj_isLoaded = true;
+    ph_Mjjj_loadedGen = entryGeneration;
   }
   return ph_Mjjj_;
 }
 
 const float &StopTree::EA_fixgridfastjet_all_rho() {
-  if (not EA_fixgridfastjet_all_rho_isLoaded) {
-    if (EA_fixgridfastjet_all_rho_branch != 0) {
+  if (EA_fixgridfastjet_all_rho_loadedGen != entryGeneration) {
+    if (EA_fixgridfastjet_all_rho_flat.IsActive()) {
+      EA_fixgridfastjet_all_rho_ = EA_fixgridfastjet_all_rho_flat.Get(index);
+    } else if (EA_fixgridfastjet_all_rho_bulk != 0) {
+      EA_fixgridfastjet_all_rho_ = EA_fixgridfastjet_all_rho_bulk->Get<float>(index);
+    } else if (EA_fixgridfastjet_all_rho_branch != 0) {
       EA_fixgridfastjet_all_rho_branch->GetEntry(index);
     } else {
       printf("branch EA_fixgridfastjet_all_rho_branch does not exist!\n");
       exit(1);
     }
-    EA_fixgridfastjet_all_rho_isLoaded = true;
+    EA_fixgridfastjet_all_rho_loadedGen = entryGeneration;
   }
   return EA_fixgridfastjet_all_rho_;
 }
 
 const int &StopTree::HLT_Photon22_R9Id90_HE10_IsoM() {
-  if (not HLT_Photon22_R9Id90_HE10_IsoM_isLoaded) {
-    if (HLT_Photon22_R9Id90_HE10_IsoM_branch != 0) {
+  if (HLT_Photon22_R9Id90_HE10_IsoM_loadedGen != entryGeneration) {
+    if (HLT_Photon22_R9Id90_HE10_IsoM_flat.IsActive()) {
+      HLT_Photon22_R9Id90_HE10_IsoM_ = HLT_Photon22_R9Id90_HE10_IsoM_flat.Get(index);
+    } else if (HLT_Photon22_R9Id90_HE10_IsoM_bulk != 0) {
+      HLT_Photon22_R9Id90_HE10_IsoM_ = HLT_Photon22_R9Id90_HE10_IsoM_bulk->Get<int>(index);
+    } else if (HLT_Photon22_R9Id90_HE10_IsoM_branch != 0) {
       HLT_Photon22_R9Id90_HE10_IsoM_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon22_R9Id90_HE10_IsoM_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon22_R9Id90_HE10_IsoM_isLoaded = true;
+    HLT_Photon22_R9Id90_HE10_IsoM_loadedGen = entryGeneration;
   }
   return HLT_Photon22_R9Id90_HE10_IsoM_;
 }
 
 const int &StopTree::HLT_Photon30_R9Id90_HE10_IsoM() {
-  if (not HLT_Photon30_R9Id90_HE10_IsoM_isLoaded) {
-    if (HLT_Photon30_R9Id90_HE10_IsoM_branch != 0) {
+  if (HLT_Photon30_R9Id90_HE10_IsoM_loadedGen != entryGeneration) {
+    if (HLT_Photon30_R9Id90_HE10_IsoM_flat.IsActive()) {
+      HLT_Photon30_R9Id90_HE10_IsoM_ = HLT_Photon30_R9Id90_HE10_IsoM_flat.Get(index);
+    } else if (HLT_Photon30_R9Id90_HE10_IsoM_bulk != 0) {
+      HLT_Photon30_R9Id90_HE10_IsoM_ = HLT_Photon30_R9Id90_HE10_IsoM_bulk->Get<int>(index);
+    } else if (HLT_Photon30_R9Id90_HE10_IsoM_branch != 0) {
       HLT_Photon30_R9Id90_HE10_IsoM_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon30_R9Id90_HE10_IsoM_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon30_R9Id90_HE10_IsoM_isLoaded = true;
+    HLT_Photon30_R9Id90_HE10_IsoM_loadedGen = entryGeneration;
   }
   return HLT_Photon30_R9Id90_HE10_IsoM_;
 }
 
 const int &StopTree::HLT_Photon36_R9Id90_HE10_IsoM() {
-  if (not HLT_Photon36_R9Id90_HE10_IsoM_isLoaded) {
-    if (HLT_Photon36_R9Id90_HE10_IsoM_branch != 0) {
+  if (HLT_Photon36_R9Id90_HE10_IsoM_loadedGen != entryGeneration) {
+    if (HLT_Photon36_R9Id90_HE10_IsoM_flat.IsActive()) {
+      HLT_Photon36_R9Id90_HE10_IsoM_ = HLT_Photon36_R9Id90_HE10_IsoM_flat.Get(index);
+    } else if (HLT_Photon36_R9Id90_HE10_IsoM_bulk != 0) {
+      HLT_Photon36_R9Id90_HE10_IsoM_ = HLT_Photon36_R9Id90_HE10_IsoM_bulk->Get<int>(index);
+    } else if (HLT_Photon36_R9Id90_HE10_IsoM_branch != 0) {
       HLT_Photon36_R9Id90_HE10_IsoM_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon36_R9Id90_HE10_IsoM_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon36_R9Id90_HE10_IsoM_isLoaded = true;
+    HLT_Photon36_R9Id90_HE10_IsoM_loadedGen = entryGeneration;
   }
   return HLT_Photon36_R9Id90_HE10_IsoM_;
 }
 
 const int &StopTree::HLT_Photon50_R9Id90_HE10_IsoM() {
-  if (not HLT_Photon50_R9Id90_HE10_IsoM_isLoaded) {
-    if (HLT_Photon50_R9Id90_HE10_IsoM_branch != 0) {
+  if (HLT_Photon50_R9Id90_HE10_IsoM_loadedGen != entryGeneration) {
+    if (HLT_Photon50_R9Id90_HE10_IsoM_flat.IsActive()) {
+      HLT_Photon50_R9Id90_HE10_IsoM_ = HLT_Photon50_R9Id90_HE10_IsoM_flat.Get(index);
+    } else if (HLT_Photon50_R9Id90_HE10_IsoM_bulk != 0) {
+      HLT_Photon50_R9Id90_HE10_IsoM_ = HLT_Photon50_R9Id90_HE10_IsoM_bulk->Get<int>(index);
+    } else if (HLT_Photon50_R9Id90_HE10_IsoM_branch != 0) {
       HLT_Photon50_R9Id90_HE10_IsoM_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon50_R9Id90_HE10_IsoM_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon50_R9Id90_HE10_IsoM_isLoaded = true;
+    HLT_Photon50_R9Id90_HE10_IsoM_loadedGen = entryGeneration;
   }
   return HLT_Photon50_R9Id90_HE10_IsoM_;
 }
 
 const int &StopTree::HLT_Photon75_R9Id90_HE10_IsoM() {
-  if (not HLT_Photon75_R9Id90_HE10_IsoM_isLoaded) {
-    if (HLT_Photon75_R9Id90_HE10_IsoM_branch != 0) {
+  if (HLT_Photon75_R9Id90_HE10_IsoM_loadedGen != entryGeneration) {
+    if (HLT_Photon75_R9Id90_HE10_IsoM_flat.IsActive()) {
+      HLT_Photon75_R9Id90_HE10_IsoM_ = HLT_Photon75_R9Id90_HE10_IsoM_flat.Get(index);
+    } else if (HLT_Photon75_R9Id90_HE10_IsoM_bulk != 0) {
+      HLT_Photon75_R9Id90_HE10_IsoM_ = HLT_Photon75_R9Id90_HE10_IsoM_bulk->Get<int>(index);
+    } else if (HLT_Photon75_R9Id90_HE10_IsoM_branch != 0) {
       HLT_Photon75_R9Id90_HE10_IsoM_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon75_R9Id90_HE10_IsoM_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon75_R9Id90_HE10_IsoM_isLoaded = true;
+    HLT_Photon75_R9Id90_HE10_IsoM_loadedGen = entryGeneration;
   }
   return HLT_Photon75_R9Id90_HE10_IsoM_;
 }
 
 const int &StopTree::HLT_Photon90_R9Id90_HE10_IsoM() {
-  if (not HLT_Photon90_R9Id90_HE10_IsoM_isLoaded) {
-    if (HLT_Photon90_R9Id90_HE10_IsoM_branch != 0) {
+  if (HLT_Photon90_R9Id90_HE10_IsoM_loadedGen != entryGeneration) {
+    if (HLT_Photon90_R9Id90_HE10_IsoM_flat.IsActive()) {
+      HLT_Photon90_R9Id90_HE10_IsoM_ = HLT_Photon90_R9Id90_HE10_IsoM_flat.Get(index);
+    } else if (HLT_Photon90_R9Id90_HE10_IsoM_bulk != 0) {
+      HLT_Photon90_R9Id90_HE10_IsoM_ = HLT_Photon90_R9Id90_HE10_IsoM_bulk->Get<int>(index);
+    } else if (HLT_Photon90_R9Id90_HE10_IsoM_branch != 0) {
       HLT_Photon90_R9Id90_HE10_IsoM_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon90_R9Id90_HE10_IsoM_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon90_R9Id90_HE10_IsoM_isLoaded = true;
+    HLT_Photon90_R9Id90_HE10_IsoM_loadedGen = entryGeneration;
   }
   return HLT_Photon90_R9Id90_HE10_IsoM_;
 }
 
 const int &StopTree::HLT_Photon120_R9Id90_HE10_IsoM() {
-  if (not HLT_Photon120_R9Id90_HE10_IsoM_isLoaded) {
-    if (HLT_Photon120_R9Id90_HE10_IsoM_branch != 0) {
+  if (HLT_Photon120_R9Id90_HE10_IsoM_loadedGen != entryGeneration) {
+    if (HLT_Photon120_R9Id90_HE10_IsoM_flat.IsActive()) {
+      HLT_Photon120_R9Id90_HE10_IsoM_ = HLT_Photon120_R9Id90_HE10_IsoM_flat.Get(index);
+    } else if (HLT_Photon120_R9Id90_HE10_IsoM_bulk != 0) {
+      HLT_Photon120_R9Id90_HE10_IsoM_ = HLT_Photon120_R9Id90_HE10_IsoM_bulk->Get<int>(index);
+    } else if (HLT_Photon120_R9Id90_HE10_IsoM_branch != 0) {
       HLT_Photon120_R9Id90_HE10_IsoM_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon120_R9Id90_HE10_IsoM_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon120_R9Id90_HE10_IsoM_isLoaded = true;
+    HLT_Photon120_R9Id90_HE10_IsoM_loadedGen = entryGeneration;
   }
   return HLT_Photon120_R9Id90_HE10_IsoM_;
 }
 
 const int &StopTree::HLT_Photon165_R9Id90_HE10_IsoM() {
-  if (not HLT_Photon165_R9Id90_HE10_IsoM_isLoaded) {
-    if (HLT_Photon165_R9Id90_HE10_IsoM_branch != 0) {
+  if (HLT_Photon165_R9Id90_HE10_IsoM_loadedGen != entryGeneration) {
+    if (HLT_Photon165_R9Id90_HE10_IsoM_flat.IsActive()) {
+      HLT_Photon165_R9Id90_HE10_IsoM_ = HLT_Photon165_R9Id90_HE10_IsoM_flat.Get(index);
+    } else if (HLT_Photon165_R9Id90_HE10_IsoM_bulk != 0) {
+      HLT_Photon165_R9Id90_HE10_IsoM_ = HLT_Photon165_R9Id90_HE10_IsoM_bulk->Get<int>(index);
+    } else if (HLT_Photon165_R9Id90_HE10_IsoM_branch != 0) {
       HLT_Photon165_R9Id90_HE10_IsoM_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon165_R9Id90_HE10_IsoM_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon165_R9Id90_HE10_IsoM_isLoaded = true;
+    HLT_Photon165_R9Id90_HE10_IsoM_loadedGen = entryGeneration;
   }
   return HLT_Photon165_R9Id90_HE10_IsoM_;
 }
 
 const int &StopTree::HLT_Photon175() {
-  if (not HLT_Photon175_isLoaded) {
-    if (HLT_Photon175_branch != 0) {
+  if (HLT_Photon175_loadedGen != entryGeneration) {
+    if (HLT_Photon175_flat.IsActive()) {
+      HLT_Photon175_ = HLT_Photon175_flat.Get(index);
+    } else if (HLT_Photon175_bulk != 0) {
+      HLT_Photon175_ = HLT_Photon175_bulk->Get<int>(index);
+    } else if (HLT_Photon175_branch != 0) {
       HLT_Photon175_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon175_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon175_isLoaded = true;
+    HLT_Photon175_loadedGen = entryGeneration;
   }
   return HLT_Photon175_;
 }
 
 const int &StopTree::HLT_Photon165_HE10() {
-  if (not HLT_Photon165_HE10_isLoaded) {
-    if (HLT_Photon165_HE10_branch != 0) {
+  if (HLT_Photon165_HE10_loadedGen != entryGeneration) {
+    if (HLT_Photon165_HE10_flat.IsActive()) {
+      HLT_Photon165_HE10_ = HLT_Photon165_HE10_flat.Get(index);
+    } else if (HLT_Photon165_HE10_bulk != 0) {
+      HLT_Photon165_HE10_ = HLT_Photon165_HE10_bulk->Get<int>(index);
+    } else if (HLT_Photon165_HE10_branch != 0) {
       HLT_Photon165_HE10_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon165_HE10_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon165_HE10_isLoaded = true;
+    HLT_Photon165_HE10_loadedGen = entryGeneration;
   }
   return HLT_Photon165_HE10_;
 }
 
 const int &StopTree::HLT_Photon120() {
-  if (not HLT_Photon120_isLoaded) {
-    if (HLT_Photon120_branch != 0) {
+  if (HLT_Photon120_loadedGen != entryGeneration) {
+    if (HLT_Photon120_flat.IsActive()) {
+      HLT_Photon120_ = HLT_Photon120_flat.Get(index);
+    } else if (HLT_Photon120_bulk != 0) {
+      HLT_Photon120_ = HLT_Photon120_bulk->Get<int>(index);
+    } else if (HLT_Photon120_branch != 0) {
       HLT_Photon120_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon120_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon120_isLoaded = true;
+    HLT_Photon120_loadedGen = entryGeneration;
   }
   return HLT_Photon120_;
 }
 
 const int &StopTree::HLT_Photon200() {
-  if (not HLT_Photon200_isLoaded) {
-    if (HLT_Photon200_branch != 0) {
+  if (HLT_Photon200_loadedGen != entryGeneration) {
+    if (HLT_Photon200_flat.IsActive()) {
+      HLT_Photon200_ = HLT_Photon200_flat.Get(index);
+    } else if (HLT_Photon200_bulk != 0) {
+      HLT_Photon200_ = HLT_Photon200_bulk->Get<int>(index);
+    } else if (HLT_Photon200_branch != 0) {
       HLT_Photon200_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon200_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon200_isLoaded = true;
+    HLT_Photon200_loadedGen = entryGeneration;
   }
   return HLT_Photon200_;
 }
 
 const int &StopTree::HLT_Photon250_NoHE() {
-  if (not HLT_Photon250_NoHE_isLoaded) {
-    if (HLT_Photon250_NoHE_branch != 0) {
+  if (HLT_Photon250_NoHE_loadedGen != entryGeneration) {
+    if (HLT_Photon250_NoHE_flat.IsActive()) {
+      HLT_Photon250_NoHE_ = HLT_Photon250_NoHE_flat.Get(index);
+    } else if (HLT_Photon250_NoHE_bulk != 0) {
+      HLT_Photon250_NoHE_ = HLT_Photon250_NoHE_bulk->Get<int>(index);
+    } else if (HLT_Photon250_NoHE_branch != 0) {
       HLT_Photon250_NoHE_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon250_NoHE_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon250_NoHE_isLoaded = true;
+    HLT_Photon250_NoHE_loadedGen = entryGeneration;
   }
   return HLT_Photon250_NoHE_;
 }
 
 const int &StopTree::HLT_Photon300_NoHE() {
-  if (not HLT_Photon300_NoHE_isLoaded) {
-    if (HLT_Photon300_NoHE_branch != 0) {
+  if (HLT_Photon300_NoHE_loadedGen != entryGeneration) {
+    if (HLT_Photon300_NoHE_flat.IsActive()) {
+      HLT_Photon300_NoHE_ = HLT_Photon300_NoHE_flat.Get(index);
+    } else if (HLT_Photon300_NoHE_bulk != 0) {
+      HLT_Photon300_NoHE_ = HLT_Photon300_NoHE_bulk->Get<int>(index);
+    } else if (HLT_Photon300_NoHE_branch != 0) {
       HLT_Photon300_NoHE_branch->GetEntry(index);
     } else {
       printf("branch HLT_Photon300_NoHE_branch does not exist!\n");
       exit(1);
     }
-    HLT_Photon300_NoHE_isLoaded = true;
+    HLT_Photon300_NoHE_loadedGen = entryGeneration;
   }
   return HLT_Photon300_NoHE_;
 }
 
+const unsigned int &StopTree::HLT_bits() {
+  if (HLT_bits_loadedGen != entryGeneration) {
+    if (HLT_bits_flat.IsActive()) {
+      HLT_bits_ = HLT_bits_flat.Get(index);
+    } else if (HLT_bits_bulk != 0) {
+      HLT_bits_ = HLT_bits_bulk->Get<unsigned int>(index);
+    } else if (HLT_bits_branch != 0) {
+      HLT_bits_branch->GetEntry(index);
+    } else {
+      printf("branch HLT_bits_branch does not exist!\n");
+      exit(1);
+    }
+    HLT_bits_loadedGen = entryGeneration;
+  }
+  return HLT_bits_;
+}
+
 const bool &StopTree::filt_cscbeamhalo() {
-  if (not filt_cscbeamhalo_isLoaded) {
-    if (filt_cscbeamhalo_branch != 0) {
+  if (filt_cscbeamhalo_loadedGen != entryGeneration) {
+    if (filt_cscbeamhalo_flat.IsActive()) {
+      filt_cscbeamhalo_ = filt_cscbeamhalo_flat.Get(index);
+    } else if (filt_cscbeamhalo_bulk != 0) {
+      filt_cscbeamhalo_ = filt_cscbeamhalo_bulk->Get<bool>(index);
+    } else if (filt_cscbeamhalo_branch != 0) {
       filt_cscbeamhalo_branch->GetEntry(index);
     } else {
       printf("branch filt_cscbeamhalo_branch does not exist!\n");
       exit(1);
     }
-    filt_cscbeamhalo_isLoaded = true;
+    filt_cscbeamhalo_loadedGen = entryGeneration;
   }
   return filt_cscbeamhalo_;
 }
 
 const bool &StopTree::filt_cscbeamhalo2015() {
-  if (not filt_cscbeamhalo2015_isLoaded) {
-    if (filt_cscbeamhalo2015_branch != 0) {
+  if (filt_cscbeamhalo2015_loadedGen != entryGeneration) {
+    if (filt_cscbeamhalo2015_flat.IsActive()) {
+      filt_cscbeamhalo2015_ = filt_cscbeamhalo2015_flat.Get(index);
+    } else if (filt_cscbeamhalo2015_bulk != 0) {
+      filt_cscbeamhalo2015_ = filt_cscbeamhalo2015_bulk->Get<bool>(index);
+    } else if (filt_cscbeamhalo2015_branch != 0) {
       filt_cscbeamhalo2015_branch->GetEntry(index);
     } else {
       printf("branch filt_cscbeamhalo2015_branch does not exist!\n");
       exit(1);
     }
-    filt_cscbeamhalo2015_isLoaded = true;
+    filt_cscbeamhalo2015_loadedGen = entryGeneration;
   }
   return filt_cscbeamhalo2015_;
 }
 
 const bool &StopTree::filt_globaltighthalo2016() {
-  if (not filt_globaltighthalo2016_isLoaded) {
-    if (filt_globaltighthalo2016_branch != 0) {
+  if (filt_globaltighthalo2016_loadedGen != entryGeneration) {
+    if (filt_globaltighthalo2016_flat.IsActive()) {
+      filt_globaltighthalo2016_ = filt_globaltighthalo2016_flat.Get(index);
+    } else if (filt_globaltighthalo2016_bulk != 0) {
+      filt_globaltighthalo2016_ = filt_globaltighthalo2016_bulk->Get<bool>(index);
+    } else if (filt_globaltighthalo2016_branch != 0) {
       filt_globaltighthalo2016_branch->GetEntry(index);
     } else {
       printf("branch filt_globaltighthalo2016_branch does not exist!\n");
       exit(1);
     }
-    filt_globaltighthalo2016_isLoaded = true;
+    filt_globaltighthalo2016_loadedGen = entryGeneration;
   }
   return filt_globaltighthalo2016_;
 }
 
 const bool &StopTree::filt_globalsupertighthalo2016() {
-  if (not filt_globalsupertighthalo2016_isLoaded) {
-    if (filt_globalsupertighthalo2016_branch != 0) {
+  if (filt_globalsupertighthalo2016_loadedGen != entryGeneration) {
+    if (filt_globalsupertighthalo2016_flat.IsActive()) {
+      filt_globalsupertighthalo2016_ = filt_globalsupertighthalo2016_flat.Get(index);
+    } else if (filt_globalsupertighthalo2016_bulk != 0) {
+      filt_globalsupertighthalo2016_ = filt_globalsupertighthalo2016_bulk->Get<bool>(index);
+    } else if (filt_globalsupertighthalo2016_branch != 0) {
       filt_globalsupertighthalo2016_branch->GetEntry(index);
     } else {
       printf("branch filt_globalsupertighthalo2016_branch does not exist!\n");
       exit(1);
     }
-    filt_globalsupertighthalo2016_isLoaded = true;
+    filt_globalsupertighthalo2016_loadedGen = entryGeneration;
   }
   return filt_globalsupertighthalo2016_;
 }
 
 const bool &StopTree::filt_ecallaser() {
-  if (not filt_ecallaser_isLoaded) {
-    if (filt_ecallaser_branch != 0) {
+  if (filt_ecallaser_loadedGen != entryGeneration) {
+    if (filt_ecallaser_flat.IsActive()) {
+      filt_ecallaser_ = filt_ecallaser_flat.Get(index);
+    } else if (filt_ecallaser_bulk != 0) {
+      filt_ecallaser_ = filt_ecallaser_bulk->Get<bool>(index);
+    } else if (filt_ecallaser_branch != 0) {
       filt_ecallaser_branch->GetEntry(index);
     } else {
       printf("branch filt_ecallaser_branch does not exist!\n");
       exit(1);
     }
-    filt_ecallaser_isLoaded = true;
+    filt_ecallaser_loadedGen = entryGeneration;
   }
   return filt_ecallaser_;
 }
 
 const bool &StopTree::filt_ecaltp() {
-  if (not filt_ecaltp_isLoaded) {
-    if (filt_ecaltp_branch != 0) {
+  if (filt_ecaltp_loadedGen != entryGeneration) {
+    if (filt_ecaltp_flat.IsActive()) {
+      filt_ecaltp_ = filt_ecaltp_flat.Get(index);
+    } else if (filt_ecaltp_bulk != 0) {
+      filt_ecaltp_ = filt_ecaltp_bulk->Get<bool>(index);
+    } else if (filt_ecaltp_branch != 0) {
       filt_ecaltp_branch->GetEntry(index);
     } else {
       printf("branch filt_ecaltp_branch does not exist!\n");
       exit(1);
     }
-    filt_ecaltp_isLoaded = true;
+    filt_ecaltp_loadedGen = entryGeneration;
   }
   return filt_ecaltp_;
 }
 
 const bool &StopTree::filt_ecalbadcalib() {
-  if (not filt_ecalbadcalib_isLoaded) {
-    if (filt_ecalbadcalib_branch != 0) {
+  if (filt_ecalbadcalib_loadedGen != entryGeneration) {
+    if (filt_ecalbadcalib_flat.IsActive()) {
+      filt_ecalbadcalib_ = filt_ecalbadcalib_flat.Get(index);
+    } else if (filt_ecalbadcalib_bulk != 0) {
+      filt_ecalbadcalib_ = filt_ecalbadcalib_bulk->Get<bool>(index);
+    } else if (filt_ecalbadcalib_branch != 0) {
       filt_ecalbadcalib_branch->GetEntry(index);
     } else {
       printf("branch filt_ecalbadcalib_branch does not exist!\n");
       exit(1);
     }
-    filt_ecalbadcalib_isLoaded = true;
+    filt_ecalbadcalib_loadedGen = entryGeneration;
   }
   return filt_ecalbadcalib_;
 }
 
 const bool &StopTree::filt_eebadsc() {
-  if (not filt_eebadsc_isLoaded) {
-    if (filt_eebadsc_branch != 0) {
+  if (filt_eebadsc_loadedGen != entryGeneration) {
+    if (filt_eebadsc_flat.IsActive()) {
+      filt_eebadsc_ = filt_eebadsc_flat.Get(index);
+    } else if (filt_eebadsc_bulk != 0) {
+      filt_eebadsc_ = filt_eebadsc_bulk->Get<bool>(index);
+    } else if (filt_eebadsc_branch != 0) {
       filt_eebadsc_branch->GetEntry(index);
     } else {
       printf("branch filt_eebadsc_branch does not exist!\n");
       exit(1);
     }
-    filt_eebadsc_isLoaded = true;
+    filt_eebadsc_loadedGen = entryGeneration;
   }
   return filt_eebadsc_;
 }
 
 const bool &StopTree::filt_goodvtx() {
-  if (not filt_goodvtx_isLoaded) {
-    if (filt_goodvtx_branch != 0) {
+  if (filt_goodvtx_loadedGen != entryGeneration) {
+    if (filt_goodvtx_flat.IsActive()) {
+      filt_goodvtx_ = filt_goodvtx_flat.Get(index);
+    } else if (filt_goodvtx_bulk != 0) {
+      filt_goodvtx_ = filt_goodvtx_bulk->Get<bool>(index);
+    } else if (filt_goodvtx_branch != 0) {
       filt_goodvtx_branch->GetEntry(index);
     } else {
       printf("branch filt_goodvtx_branch does not exist!\n");
       exit(1);
     }
-    filt_goodvtx_isLoaded = true;
+    filt_goodvtx_loadedGen = entryGeneration;
   }
   return filt_goodvtx_;
 }
 
 const bool &StopTree::filt_badevents() {
-  if (not filt_badevents_isLoaded) {
-    if (filt_badevents_branch != 0) {
+  if (filt_badevents_loadedGen != entryGeneration) {
+    if (filt_badevents_flat.IsActive()) {
+      filt_badevents_ = filt_badevents_flat.Get(index);
+    } else if (filt_badevents_bulk != 0) {
+      filt_badevents_ = filt_badevents_bulk->Get<bool>(index);
+    } else if (filt_badevents_branch != 0) {
       filt_badevents_branch->GetEntry(index);
     } else {
       printf("branch filt_badevents_branch does not exist!\n");
       exit(1);
     }
-    filt_badevents_isLoaded = true;
+    filt_badevents_loadedGen = entryGeneration;
   }
   return filt_badevents_;
 }
 
 const bool &StopTree::filt_hbhenoise() {
-  if (not filt_hbhenoise_isLoaded) {
-    if (filt_hbhenoise_branch != 0) {
+  if (filt_hbhenoise_loadedGen != entryGeneration) {
+    if (filt_hbhenoise_flat.IsActive()) {
+      filt_hbhenoise_ = filt_hbhenoise_flat.Get(index);
+    } else if (filt_hbhenoise_bulk != 0) {
+      filt_hbhenoise_ = filt_hbhenoise_bulk->Get<bool>(index);
+    } else if (filt_hbhenoise_branch != 0) {
       filt_hbhenoise_branch->GetEntry(index);
     } else {
       printf("branch filt_hbhenoise_branch does not exist!\n");
       exit(1);
     }
-    filt_hbhenoise_isLoaded = true;
+    filt_hbhenoise_loadedGen = entryGeneration;
   }
   return filt_hbhenoise_;
 }
 
 const bool &StopTree::filt_hbheisonoise() {
-  if (not filt_hbheisonoise_isLoaded) {
-    if (filt_hbheisonoise_branch != 0) {
+  if (filt_hbheisonoise_loadedGen != entryGeneration) {
+    if (filt_hbheisonoise_flat.IsActive()) {
+      filt_hbheisonoise_ = filt_hbheisonoise_flat.Get(index);
+    } else if (filt_hbheisonoise_bulk != 0) {
+      filt_hbheisonoise_ = filt_hbheisonoise_bulk->Get<bool>(index);
+    } else if (filt_hbheisonoise_branch != 0) {
       filt_hbheisonoise_branch->GetEntry(index);
     } else {
       printf("branch filt_hbheisonoise_branch does not exist!\n");
       exit(1);
     }
-    filt_hbheisonoise_isLoaded = true;
+    filt_hbheisonoise_loadedGen = entryGeneration;
   }
   return filt_hbheisonoise_;
 }
 
 const bool &StopTree::filt_hcallaser() {
-  if (not filt_hcallaser_isLoaded) {
-    if (filt_hcallaser_branch != 0) {
+  if (filt_hcallaser_loadedGen != entryGeneration) {
+    if (filt_hcallaser_flat.IsActive()) {
+      filt_hcallaser_ = filt_hcallaser_flat.Get(index);
+    } else if (filt_hcallaser_bulk != 0) {
+      filt_hcallaser_ = filt_hcallaser_bulk->Get<bool>(index);
+    } else if (filt_hcallaser_branch != 0) {
       filt_hcallaser_branch->GetEntry(index);
     } else {
       printf("branch filt_hcallaser_branch does not exist!\n");
       exit(1);
     }
-    filt_hcallaser_isLoaded = true;
+    filt_hcallaser_loadedGen = entryGeneration;
   }
   return filt_hcallaser_;
 }
 
 const bool &StopTree::filt_trkfail() {
-  if (not filt_trkfail_isLoaded) {
-    if (filt_trkfail_branch != 0) {
+  if (filt_trkfail_loadedGen != entryGeneration) {
+    if (filt_trkfail_flat.IsActive()) {
+      filt_trkfail_ = filt_trkfail_flat.Get(index);
+    } else if (filt_trkfail_bulk != 0) {
+      filt_trkfail_ = filt_trkfail_bulk->Get<bool>(index);
+    } else if (filt_trkfail_branch != 0) {
       filt_trkfail_branch->GetEntry(index);
     } else {
       printf("branch filt_trkfail_branch does not exist!\n");
       exit(1);
     }
-    filt_trkfail_isLoaded = true;
+    filt_trkfail_loadedGen = entryGeneration;
   }
   return filt_trkfail_;
 }
 
 const bool &StopTree::filt_trkPOG() {
-  if (not filt_trkPOG_isLoaded) {
-    if (filt_trkPOG_branch != 0) {
+  if (filt_trkPOG_loadedGen != entryGeneration) {
+    if (filt_trkPOG_flat.IsActive()) {
+      filt_trkPOG_ = filt_trkPOG_flat.Get(index);
+    } else if (filt_trkPOG_bulk != 0) {
+      filt_trkPOG_ = filt_trkPOG_bulk->Get<bool>(index);
+    } else if (filt_trkPOG_branch != 0) {
       filt_trkPOG_branch->GetEntry(index);
     } else {
       printf("branch filt_trkPOG_branch does not exist!\n");
       exit(1);
     }
-    filt_trkPOG_isLoaded = true;
+    filt_trkPOG_loadedGen = entryGeneration;
   }
   return filt_trkPOG_;
 }
 
 const bool &StopTree::filt_trkPOG_logerr_tmc() {
-  if (not filt_trkPOG_logerr_tmc_isLoaded) {
-    if (filt_trkPOG_logerr_tmc_branch != 0) {
+  if (filt_trkPOG_logerr_tmc_loadedGen != entryGeneration) {
+    if (filt_trkPOG_logerr_tmc_flat.IsActive()) {
+      filt_trkPOG_logerr_tmc_ = filt_trkPOG_logerr_tmc_flat.Get(index);
+    } else if (filt_trkPOG_logerr_tmc_bulk != 0) {
+      filt_trkPOG_logerr_tmc_ = filt_trkPOG_logerr_tmc_bulk->Get<bool>(index);
+    } else if (filt_trkPOG_logerr_tmc_branch != 0) {
       filt_trkPOG_logerr_tmc_branch->GetEntry(index);
     } else {
       printf("branch filt_trkPOG_logerr_tmc_branch does not exist!\n");
       exit(1);
     }
-    filt_trkPOG_logerr_tmc_isLoaded = true;
+    filt_trkPOG_logerr_tmc_loadedGen = entryGeneration;
   }
   return filt_trkPOG_logerr_tmc_;
 }
 
 const bool &StopTree::filt_trkPOG_tmc() {
-  if (not filt_trkPOG_tmc_isLoaded) {
-    if (filt_trkPOG_tmc_branch != 0) {
+  if (filt_trkPOG_tmc_loadedGen != entryGeneration) {
+    if (filt_trkPOG_tmc_flat.IsActive()) {
+      filt_trkPOG_tmc_ = filt_trkPOG_tmc_flat.Get(index);
+    } else if (filt_trkPOG_tmc_bulk != 0) {
+      filt_trkPOG_tmc_ = filt_trkPOG_tmc_bulk->Get<bool>(index);
+    } else if (filt_trkPOG_tmc_branch != 0) {
       filt_trkPOG_tmc_branch->GetEntry(index);
     } else {
       printf("branch filt_trkPOG_tmc_branch does not exist!\n");
       exit(1);
     }
-    filt_trkPOG_tmc_isLoaded = true;
+    filt_trkPOG_tmc_loadedGen = entryGeneration;
   }
   return filt_trkPOG_tmc_;
 }
 
 const bool &StopTree::filt_trkPOG_tms() {
-  if (not filt_trkPOG_tms_isLoaded) {
-    if (filt_trkPOG_tms_branch != 0) {
+  if (filt_trkPOG_tms_loadedGen != entryGeneration) {
+    if (filt_trkPOG_tms_flat.IsActive()) {
+      filt_trkPOG_tms_ = filt_trkPOG_tms_flat.Get(index);
+    } else if (filt_trkPOG_tms_bulk != 0) {
+      filt_trkPOG_tms_ = filt_trkPOG_tms_bulk->Get<bool>(index);
+    } else if (filt_trkPOG_tms_branch != 0) {
       filt_trkPOG_tms_branch->GetEntry(index);
     } else {
       printf("branch filt_trkPOG_tms_branch does not exist!\n");
       exit(1);
     }
-    filt_trkPOG_tms_isLoaded = true;
+    filt_trkPOG_tms_loadedGen = entryGeneration;
   }
   return filt_trkPOG_tms_;
 }
 
 const int &StopTree::firstGoodVtxIdx() {
-  if (not firstGoodVtxIdx_isLoaded) {
-    if (firstGoodVtxIdx_branch != 0) {
+  if (firstGoodVtxIdx_loadedGen != entryGeneration) {
+    if (firstGoodVtxIdx_flat.IsActive()) {
+      firstGoodVtxIdx_ = firstGoodVtxIdx_flat.Get(index);
+    } else if (firstGoodVtxIdx_bulk != 0) {
+      firstGoodVtxIdx_ = firstGoodVtxIdx_bulk->Get<int>(index);
+    } else if (firstGoodVtxIdx_branch != 0) {
       firstGoodVtxIdx_branch->GetEntry(index);
     } else {
       printf("branch firstGoodVtxIdx_branch does not exist!\n");
       exit(1);
     }
-    firstGoodVtxIdx_isLoaded = true;
+    firstGoodVtxIdx_loadedGen = entryGeneration;
   }
   return firstGoodVtxIdx_;
 }
 
 const bool &StopTree::filt_badChargedCandidateFilter() {
-  if (not filt_badChargedCandidateFilter_isLoaded) {
-    if (filt_badChargedCandidateFilter_branch != 0) {
+  if (filt_badChargedCandidateFilter_loadedGen != entryGeneration) {
+    if (filt_badChargedCandidateFilter_flat.IsActive()) {
+      filt_badChargedCandidateFilter_ = filt_badChargedCandidateFilter_flat.Get(index);
+    } else if (filt_badChargedCandidateFilter_bulk != 0) {
+      filt_badChargedCandidateFilter_ = filt_badChargedCandidateFilter_bulk->Get<bool>(index);
+    } else if (filt_badChargedCandidateFilter_branch != 0) {
       filt_badChargedCandidateFilter_branch->GetEntry(index);
     } else {
       printf("branch filt_badChargedCandidateFilter_branch does not exist!\n");
       exit(1);
     }
-    filt_badChargedCandidateFilter_isLoaded = true;
+    filt_badChargedCandidateFilter_loadedGen = entryGeneration;
   }
   return filt_badChargedCandidateFilter_;
 }
 
 const bool &StopTree::filt_badMuonFilter() {
-  if (not filt_badMuonFilter_isLoaded) {
-    if (filt_badMuonFilter_branch != 0) {
+  if (filt_badMuonFilter_loadedGen != entryGeneration) {
+    if (filt_badMuonFilter_flat.IsActive()) {
+      filt_badMuonFilter_ = filt_badMuonFilter_flat.Get(index);
+    } else if (filt_badMuonFilter_bulk != 0) {
+      filt_badMuonFilter_ = filt_badMuonFilter_bulk->Get<bool>(index);
+    } else if (filt_badMuonFilter_branch != 0) {
       filt_badMuonFilter_branch->GetEntry(index);
     } else {
       printf("branch filt_badMuonFilter_branch does not exist!\n");
       exit(1);
     }
-    filt_badMuonFilter_isLoaded = true;
+    filt_badMuonFilter_loadedGen = entryGeneration;
   }
   return filt_badMuonFilter_;
 }
 
 const bool &StopTree::filt_met() {
-  if (not filt_met_isLoaded) {
-    if (filt_met_branch != 0) {
+  if (filt_met_loadedGen != entryGeneration) {
+    if (filt_met_flat.IsActive()) {
+      filt_met_ = filt_met_flat.Get(index);
+    } else if (filt_met_bulk != 0) {
+      filt_met_ = filt_met_bulk->Get<bool>(index);
+    } else if (filt_met_branch != 0) {
       filt_met_branch->GetEntry(index);
     } else {
       printf("branch filt_met_branch does not exist!\n");
       exit(1);
     }
-    filt_met_isLoaded = true;
+    filt_met_loadedGen = entryGeneration;
   }
   return filt_met_;
 }
 
 const bool &StopTree::filt_fastsimjets() {
-  if (not filt_fastsimjets_isLoaded) {
-    if (filt_fastsimjets_branch != 0) {
+  if (filt_fastsimjets_loadedGen != entryGeneration) {
+    if (filt_fastsimjets_flat.IsActive()) {
+      filt_fastsimjets_ = filt_fastsimjets_flat.Get(index);
+    } else if (filt_fastsimjets_bulk != 0) {
+      filt_fastsimjets_ = filt_fastsimjets_bulk->Get<bool>(index);
+    } else if (filt_fastsimjets_branch != 0) {
       filt_fastsimjets_branch->GetEntry(index);
     } else {
       printf("branch filt_fastsimjets_branch does not exist!\n");
       exit(1);
     }
-    filt_fastsimjets_isLoaded = true;
+    filt_fastsimjets_loadedGen = entryGeneration;
   }
   return filt_fastsimjets_;
 }
 
 const bool &StopTree::filt_fastsimjets_jup() {
-  if (not filt_fastsimjets_jup_isLoaded) {
-    if (filt_fastsimjets_jup_branch != 0) {
+  if (filt_fastsimjets_jup_loadedGen != entryGeneration) {
+    if (filt_fastsimjets_jup_flat.IsActive()) {
+      filt_fastsimjets_jup_ = filt_fastsimjets_jup_flat.Get(index);
+    } else if (filt_fastsimjets_jup_bulk != 0) {
+      filt_fastsimjets_jup_ = filt_fastsimjets_jup_bulk->Get<bool>(index);
+    } else if (filt_fastsimjets_jup_branch != 0) {
       filt_fastsimjets_jup_branch->GetEntry(index);
     } else {
       printf("branch filt_fastsimjets_jup_branch does not exist!\n");
       exit(1);
     }
-    filt_fastsimjets_jup_isLoaded = true;
+    filt_fastsimjets_jup_loadedGen = entryGeneration;
   }
   return filt_fastsimjets_jup_;
 }
 
 const bool &StopTree::filt_fastsimjets_jdown() {
-  if (not filt_fastsimjets_jdown_isLoaded) {
-    if (filt_fastsimjets_jdown_branch != 0) {
+  if (filt_fastsimjets_jdown_loadedGen != entryGeneration) {
+    if (filt_fastsimjets_jdown_flat.IsActive()) {
+      filt_fastsimjets_jdown_ = filt_fastsimjets_jdown_flat.Get(index);
+    } else if (filt_fastsimjets_jdown_bulk != 0) {
+      filt_fastsimjets_jdown_ = filt_fastsimjets_jdown_bulk->Get<bool>(index);
+    } else if (filt_fastsimjets_jdown_branch != 0) {
       filt_fastsimjets_jdown_branch->GetEntry(index);
     } else {
       printf("branch filt_fastsimjets_jdown_branch does not exist!\n");
       exit(1);
     }
-    filt_fastsimjets_jdown_isLoaded = true;
+    filt_fastsimjets_jdown_loadedGen = entryGeneration;
   }
   return filt_fastsimjets_jdown_;
 }
 
 const bool &StopTree::filt_jetWithBadMuon() {
-  if (not filt_jetWithBadMuon_isLoaded) {
-    if (filt_jetWithBadMuon_branch != 0) {
+  if (filt_jetWithBadMuon_loadedGen != entryGeneration) {
+    if (filt_jetWithBadMuon_flat.IsActive()) {
+      filt_jetWithBadMuon_ = filt_jetWithBadMuon_flat.Get(index);
+    } else if (filt_jetWithBadMuon_bulk != 0) {
+      filt_jetWithBadMuon_ = filt_jetWithBadMuon_bulk->Get<bool>(index);
+    } else if (filt_jetWithBadMuon_branch != 0) {
       filt_jetWithBadMuon_branch->GetEntry(index);
     } else {
       printf("branch filt_jetWithBadMuon_branch does not exist!\n");
       exit(1);
     }
-    filt_jetWithBadMuon_isLoaded = true;
+    filt_jetWithBadMuon_loadedGen = entryGeneration;
   }
   return filt_jetWithBadMuon_;
 }
 
 const bool &StopTree::filt_jetWithBadMuon_jup() {
-  if (not filt_jetWithBadMuon_jup_isLoaded) {
-    if (filt_jetWithBadMuon_jup_branch != 0) {
+  if (filt_jetWithBadMuon_jup_loadedGen != entryGeneration) {
+    if (filt_jetWithBadMuon_jup_flat.IsActive()) {
+      filt_jetWithBadMuon_jup_ = filt_jetWithBadMuon_jup_flat.Get(index);
+    } else if (filt_jetWithBadMuon_jup_bulk != 0) {
+      filt_jetWithBadMuon_jup_ = filt_jetWithBadMuon_jup_bulk->Get<bool>(index);
+    } else if (filt_jetWithBadMuon_jup_branch != 0) {
       filt_jetWithBadMuon_jup_branch->GetEntry(index);
     } else {
       printf("branch filt_jetWithBadMuon_jup_branch does not exist!\n");
       exit(1);
     }
-    filt_jetWithBadMuon_jup_isLoaded = true;
+    filt_jetWithBadMuon_jup_loadedGen = entryGeneration;
   }
   return filt_jetWithBadMuon_jup_;
 }
 
 const bool &StopTree::filt_jetWithBadMuon_jdown() {
-  if (not filt_jetWithBadMuon_jdown_isLoaded) {
-    if (filt_jetWithBadMuon_jdown_branch != 0) {
+  if (filt_jetWithBadMuon_jdown_loadedGen != entryGeneration) {
+    if (filt_jetWithBadMuon_jdown_flat.IsActive()) {
+      filt_jetWithBadMuon_jdown_ = filt_jetWithBadMuon_jdown_flat.Get(index);
+    } else if (filt_jetWithBadMuon_jdown_bulk != 0) {
+      filt_jetWithBadMuon_jdown_ = filt_jetWithBadMuon_jdown_bulk->Get<bool>(index);
+    } else if (filt_jetWithBadMuon_jdown_branch != 0) {
       filt_jetWithBadMuon_jdown_branch->GetEntry(index);
     } else {
       printf("branch filt_jetWithBadMuon_jdown_branch does not exist!\n");
       exit(1);
     }
-    filt_jetWithBadMuon_jdown_isLoaded = true;
+    filt_jetWithBadMuon_jdown_loadedGen = entryGeneration;
   }
   return filt_jetWithBadMuon_jdown_;
 }
 
 const bool &StopTree::filt_pfovercalomet() {
-  if (not filt_pfovercalomet_isLoaded) {
-    if (filt_pfovercalomet_branch != 0) {
+  if (filt_pfovercalomet_loadedGen != entryGeneration) {
+    if (filt_pfovercalomet_flat.IsActive()) {
+      filt_pfovercalomet_ = filt_pfovercalomet_flat.Get(index);
+    } else if (filt_pfovercalomet_bulk != 0) {
+      filt_pfovercalomet_ = filt_pfovercalomet_bulk->Get<bool>(index);
+    } else if (filt_pfovercalomet_branch != 0) {
       filt_pfovercalomet_branch->GetEntry(index);
     } else {
       printf("branch filt_pfovercalomet_branch does not exist!\n");
       exit(1);
     }
-    filt_pfovercalomet_isLoaded = true;
+    filt_pfovercalomet_loadedGen = entryGeneration;
   }
   return filt_pfovercalomet_;
 }
 
 const bool &StopTree::filt_badmuons() {
-  if (not filt_badmuons_isLoaded) {
-    if (filt_badmuons_branch != 0) {
+  if (filt_badmuons_loadedGen != entryGeneration) {
+    if (filt_badmuons_flat.IsActive()) {
+      filt_badmuons_ = filt_badmuons_flat.Get(index);
+    } else if (filt_badmuons_bulk != 0) {
+      filt_badmuons_ = filt_badmuons_bulk->Get<bool>(index);
+    } else if (filt_badmuons_branch != 0) {
       filt_badmuons_branch->GetEntry(index);
     } else {
       printf("branch filt_badmuons_branch does not exist!\n");
       exit(1);
     }
-    filt_badmuons_isLoaded = true;
+    filt_badmuons_loadedGen = entryGeneration;
   }
   return filt_badmuons_;
 }
 
 const bool &StopTree::filt_duplicatemuons() {
-  if (not filt_duplicatemuons_isLoaded) {
-    if (filt_duplicatemuons_branch != 0) {
+  if (filt_duplicatemuons_loadedGen != entryGeneration) {
+    if (filt_duplicatemuons_flat.IsActive()) {
+      filt_duplicatemuons_ = filt_duplicatemuons_flat.Get(index);
+    } else if (filt_duplicatemuons_bulk != 0) {
+      filt_duplicatemuons_ = filt_duplicatemuons_bulk->Get<bool>(index);
+    } else if (filt_duplicatemuons_branch != 0) {
       filt_duplicatemuons_branch->GetEntry(index);
     } else {
       printf("branch filt_duplicatemuons_branch does not exist!\n");
       exit(1);
     }
-    filt_duplicatemuons_isLoaded = true;
+    filt_duplicatemuons_loadedGen = entryGeneration;
   }
   return filt_duplicatemuons_;
 }
 
 const bool &StopTree::filt_nobadmuons() {
-  if (not filt_nobadmuons_isLoaded) {
-    if (filt_nobadmuons_branch != 0) {
+  if (filt_nobadmuons_loadedGen != entryGeneration) {
+    if (filt_nobadmuons_flat.IsActive()) {
+      filt_nobadmuons_ = filt_nobadmuons_flat.Get(index);
+    } else if (filt_nobadmuons_bulk != 0) {
+      filt_nobadmuons_ = filt_nobadmuons_bulk->Get<bool>(index);
+    } else if (filt_nobadmuons_branch != 0) {
       filt_nobadmuons_branch->GetEntry(index);
     } else {
       printf("branch filt_nobadmuons_branch does not exist!\n");
       exit(1);
     }
-    filt_nobadmuons_isLoaded = true;
+    filt_nobadmuons_loadedGen = entryGeneration;
   }
   return filt_nobadmuons_;
 }
@@ -10229,7 +13553,9 @@ const bool &lep1_passMediumID() { return babyAnalyzer.lep1_passMediumID(); }
 const bool &lep1_passTightID() { return babyAnalyzer.lep1_passTightID(); }
 const bool &lep1_passVeto() { return babyAnalyzer.lep1_passVeto(); }
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep1_p4() { return babyAnalyzer.lep1_p4(); }
+const PolarP4 &lep1_p4_polar() { return babyAnalyzer.lep1_p4_polar(); }
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep1_mcp4() { return babyAnalyzer.lep1_mcp4(); }
+const PolarP4 &lep1_mcp4_polar() { return babyAnalyzer.lep1_mcp4_polar(); }
 const int &lep1_mc_motherid() { return babyAnalyzer.lep1_mc_motherid(); }
 const float &lep1_etaSC() { return babyAnalyzer.lep1_etaSC(); }
 const float &lep1_dphiMET() { return babyAnalyzer.lep1_dphiMET(); }
@@ -10247,7 +13573,9 @@ const bool &lep2_passMediumID() { return babyAnalyzer.lep2_passMediumID(); }
 const bool &lep2_passTightID() { return babyAnalyzer.lep2_passTightID(); }
 const bool &lep2_passVeto() { return babyAnalyzer.lep2_passVeto(); }
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep2_p4() { return babyAnalyzer.lep2_p4(); }
+const PolarP4 &lep2_p4_polar() { return babyAnalyzer.lep2_p4_polar(); }
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep2_mcp4() { return babyAnalyzer.lep2_mcp4(); }
+const PolarP4 &lep2_mcp4_polar() { return babyAnalyzer.lep2_mcp4_polar(); }
 const int &lep2_mc_motherid() { return babyAnalyzer.lep2_mc_motherid(); }
 const float &lep2_etaSC() { return babyAnalyzer.lep2_etaSC(); }
 const float &lep2_dphiMET() { return babyAnalyzer.lep2_dphiMET(); }
@@ -10267,7 +13595,9 @@ const vector<bool> &ph_passMediumID() { return babyAnalyzer.ph_passMediumID(); }
 const vector<bool> &ph_passTightID() { return babyAnalyzer.ph_passTightID(); }
 const vector<int> &ph_overlapJetId() { return babyAnalyzer.ph_overlapJetId(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ph_p4() { return babyAnalyzer.ph_p4(); }
+const PolarArrays &ph_p4_polar() { return babyAnalyzer.ph_p4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ph_mcp4() { return babyAnalyzer.ph_mcp4(); }
+const PolarArrays &ph_mcp4_polar() { return babyAnalyzer.ph_mcp4_polar(); }
 const vector<int> &ph_mcMatchId() { return babyAnalyzer.ph_mcMatchId(); }
 const vector<float> &ph_genIso04() { return babyAnalyzer.ph_genIso04(); }
 const vector<float> &ph_drMinParton() { return babyAnalyzer.ph_drMinParton(); }
@@ -10284,6 +13614,7 @@ const float &ak4_HT() { return babyAnalyzer.ak4_HT(); }
 const float &ak4_htratiom() { return babyAnalyzer.ak4_htratiom(); }
 const vector<float> &dphi_ak4pfjet_met() { return babyAnalyzer.dphi_ak4pfjet_met(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ak4pfjets_p4() { return babyAnalyzer.ak4pfjets_p4(); }
+const PolarArrays &ak4pfjets_p4_polar() { return babyAnalyzer.ak4pfjets_p4_polar(); }
 const vector<bool> &ak4pfjets_passMEDbtag() { return babyAnalyzer.ak4pfjets_passMEDbtag(); }
 const vector<float> &ak4pfjets_deepCSV() { return babyAnalyzer.ak4pfjets_deepCSV(); }
 const vector<float> &ak4pfjets_CSV() { return babyAnalyzer.ak4pfjets_CSV(); }
@@ -10293,9 +13624,13 @@ const vector<int> &ak4pfjets_hadron_flavor() { return babyAnalyzer.ak4pfjets_had
 const vector<bool> &ak4pfjets_loose_puid() { return babyAnalyzer.ak4pfjets_loose_puid(); }
 const vector<bool> &ak4pfjets_loose_pfid() { return babyAnalyzer.ak4pfjets_loose_pfid(); }
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &ak4pfjets_leadMEDbjet_p4() { return babyAnalyzer.ak4pfjets_leadMEDbjet_p4(); }
+const PolarP4 &ak4pfjets_leadMEDbjet_p4_polar() { return babyAnalyzer.ak4pfjets_leadMEDbjet_p4_polar(); }
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &ak4pfjets_leadbtag_p4() { return babyAnalyzer.ak4pfjets_leadbtag_p4(); }
+const PolarP4 &ak4pfjets_leadbtag_p4_polar() { return babyAnalyzer.ak4pfjets_leadbtag_p4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ak4genjets_p4() { return babyAnalyzer.ak4genjets_p4(); }
+const PolarArrays &ak4genjets_p4_polar() { return babyAnalyzer.ak4genjets_p4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &softtags_p4() { return babyAnalyzer.softtags_p4(); }
+const PolarArrays &softtags_p4_polar() { return babyAnalyzer.softtags_p4_polar(); }
 const int &nsoftbtags() { return babyAnalyzer.nsoftbtags(); }
 const int &jup_nskimjets() { return babyAnalyzer.jup_nskimjets(); }
 const int &jup_nskimbtagmed() { return babyAnalyzer.jup_nskimbtagmed(); }
@@ -10310,6 +13645,7 @@ const float &jup_ak4_HT() { return babyAnalyzer.jup_ak4_HT(); }
 const float &jup_ak4_htratiom() { return babyAnalyzer.jup_ak4_htratiom(); }
 const vector<float> &jup_dphi_ak4pfjet_met() { return babyAnalyzer.jup_dphi_ak4pfjet_met(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_ak4pfjets_p4() { return babyAnalyzer.jup_ak4pfjets_p4(); }
+const PolarArrays &jup_ak4pfjets_p4_polar() { return babyAnalyzer.jup_ak4pfjets_p4_polar(); }
 const vector<bool> &jup_ak4pfjets_passMEDbtag() { return babyAnalyzer.jup_ak4pfjets_passMEDbtag(); }
 const vector<float> &jup_ak4pfjets_deepCSV() { return babyAnalyzer.jup_ak4pfjets_deepCSV(); }
 const vector<float> &jup_ak4pfjets_CSV() { return babyAnalyzer.jup_ak4pfjets_CSV(); }
@@ -10319,9 +13655,13 @@ const vector<int> &jup_ak4pfjets_hadron_flavor() { return babyAnalyzer.jup_ak4pf
 const vector<bool> &jup_ak4pfjets_loose_puid() { return babyAnalyzer.jup_ak4pfjets_loose_puid(); }
 const vector<bool> &jup_ak4pfjets_loose_pfid() { return babyAnalyzer.jup_ak4pfjets_loose_pfid(); }
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jup_ak4pfjets_leadMEDbjet_p4() { return babyAnalyzer.jup_ak4pfjets_leadMEDbjet_p4(); }
+const PolarP4 &jup_ak4pfjets_leadMEDbjet_p4_polar() { return babyAnalyzer.jup_ak4pfjets_leadMEDbjet_p4_polar(); }
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jup_ak4pfjets_leadbtag_p4() { return babyAnalyzer.jup_ak4pfjets_leadbtag_p4(); }
+const PolarP4 &jup_ak4pfjets_leadbtag_p4_polar() { return babyAnalyzer.jup_ak4pfjets_leadbtag_p4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_ak4genjets_p4() { return babyAnalyzer.jup_ak4genjets_p4(); }
+const PolarArrays &jup_ak4genjets_p4_polar() { return babyAnalyzer.jup_ak4genjets_p4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_softtags_p4() { return babyAnalyzer.jup_softtags_p4(); }
+const PolarArrays &jup_softtags_p4_polar() { return babyAnalyzer.jup_softtags_p4_polar(); }
 const int &jup_nsoftbtags() { return babyAnalyzer.jup_nsoftbtags(); }
 const int &jdown_nskimjets() { return babyAnalyzer.jdown_nskimjets(); }
 const int &jdown_nskimbtagmed() { return babyAnalyzer.jdown_nskimbtagmed(); }
@@ -10336,6 +13676,7 @@ const float &jdown_ak4_HT() { return babyAnalyzer.jdown_ak4_HT(); }
 const float &jdown_ak4_htratiom() { return babyAnalyzer.jdown_ak4_htratiom(); }
 const vector<float> &jdown_dphi_ak4pfjet_met() { return babyAnalyzer.jdown_dphi_ak4pfjet_met(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_ak4pfjets_p4() { return babyAnalyzer.jdown_ak4pfjets_p4(); }
+const PolarArrays &jdown_ak4pfjets_p4_polar() { return babyAnalyzer.jdown_ak4pfjets_p4_polar(); }
 const vector<bool> &jdown_ak4pfjets_passMEDbtag() { return babyAnalyzer.jdown_ak4pfjets_passMEDbtag(); }
 const vector<float> &jdown_ak4pfjets_deepCSV() { return babyAnalyzer.jdown_ak4pfjets_deepCSV(); }
 const vector<float> &jdown_ak4pfjets_CSV() { return babyAnalyzer.jdown_ak4pfjets_CSV(); }
@@ -10345,12 +13686,17 @@ const vector<int> &jdown_ak4pfjets_hadron_flavor() { return babyAnalyzer.jdown_a
 const vector<bool> &jdown_ak4pfjets_loose_puid() { return babyAnalyzer.jdown_ak4pfjets_loose_puid(); }
 const vector<bool> &jdown_ak4pfjets_loose_pfid() { return babyAnalyzer.jdown_ak4pfjets_loose_pfid(); }
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jdown_ak4pfjets_leadMEDbjet_p4() { return babyAnalyzer.jdown_ak4pfjets_leadMEDbjet_p4(); }
+const PolarP4 &jdown_ak4pfjets_leadMEDbjet_p4_polar() { return babyAnalyzer.jdown_ak4pfjets_leadMEDbjet_p4_polar(); }
 const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jdown_ak4pfjets_leadbtag_p4() { return babyAnalyzer.jdown_ak4pfjets_leadbtag_p4(); }
+const PolarP4 &jdown_ak4pfjets_leadbtag_p4_polar() { return babyAnalyzer.jdown_ak4pfjets_leadbtag_p4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_ak4genjets_p4() { return babyAnalyzer.jdown_ak4genjets_p4(); }
+const PolarArrays &jdown_ak4genjets_p4_polar() { return babyAnalyzer.jdown_ak4genjets_p4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_softtags_p4() { return babyAnalyzer.jdown_softtags_p4(); }
+const PolarArrays &jdown_softtags_p4_polar() { return babyAnalyzer.jdown_softtags_p4_polar(); }
 const int &jdown_nsoftbtags() { return babyAnalyzer.jdown_nsoftbtags(); }
 const vector<bool> &genleps_isfromt() { return babyAnalyzer.genleps_isfromt(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genleps_p4() { return babyAnalyzer.genleps_p4(); }
+const PolarArrays &genleps_p4_polar() { return babyAnalyzer.genleps_p4_polar(); }
 const vector<int> &genleps_id() { return babyAnalyzer.genleps_id(); }
 const vector<int> &genleps__genpsidx() { return babyAnalyzer.genleps__genpsidx(); }
 const vector<int> &genleps_status() { return babyAnalyzer.genleps_status(); }
@@ -10361,15 +13707,18 @@ const vector<bool> &genleps_isLastCopy() { return babyAnalyzer.genleps_isLastCop
 const vector<int> &genleps_gentaudecay() { return babyAnalyzer.genleps_gentaudecay(); }
 const int &gen_nfromtleps_() { return babyAnalyzer.gen_nfromtleps_(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genleps_motherp4() { return babyAnalyzer.genleps_motherp4(); }
+const PolarArrays &genleps_motherp4_polar() { return babyAnalyzer.genleps_motherp4_polar(); }
 const vector<int> &genleps_motherid() { return babyAnalyzer.genleps_motherid(); }
 const vector<int> &genleps_motheridx() { return babyAnalyzer.genleps_motheridx(); }
 const vector<int> &genleps_motherstatus() { return babyAnalyzer.genleps_motherstatus(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genleps_gmotherp4() { return babyAnalyzer.genleps_gmotherp4(); }
+const PolarArrays &genleps_gmotherp4_polar() { return babyAnalyzer.genleps_gmotherp4_polar(); }
 const vector<int> &genleps_gmotherid() { return babyAnalyzer.genleps_gmotherid(); }
 const vector<int> &genleps_gmotheridx() { return babyAnalyzer.genleps_gmotheridx(); }
 const vector<int> &genleps_gmotherstatus() { return babyAnalyzer.genleps_gmotherstatus(); }
 const vector<bool> &gennus_isfromt() { return babyAnalyzer.gennus_isfromt(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gennus_p4() { return babyAnalyzer.gennus_p4(); }
+const PolarArrays &gennus_p4_polar() { return babyAnalyzer.gennus_p4_polar(); }
 const vector<int> &gennus_id() { return babyAnalyzer.gennus_id(); }
 const vector<int> &gennus__genpsidx() { return babyAnalyzer.gennus__genpsidx(); }
 const vector<int> &gennus_status() { return babyAnalyzer.gennus_status(); }
@@ -10380,15 +13729,18 @@ const vector<bool> &gennus_isLastCopy() { return babyAnalyzer.gennus_isLastCopy(
 const vector<int> &gennus_gentaudecay() { return babyAnalyzer.gennus_gentaudecay(); }
 const int &gen_nfromtnus_() { return babyAnalyzer.gen_nfromtnus_(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gennus_motherp4() { return babyAnalyzer.gennus_motherp4(); }
+const PolarArrays &gennus_motherp4_polar() { return babyAnalyzer.gennus_motherp4_polar(); }
 const vector<int> &gennus_motherid() { return babyAnalyzer.gennus_motherid(); }
 const vector<int> &gennus_motheridx() { return babyAnalyzer.gennus_motheridx(); }
 const vector<int> &gennus_motherstatus() { return babyAnalyzer.gennus_motherstatus(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gennus_gmotherp4() { return babyAnalyzer.gennus_gmotherp4(); }
+const PolarArrays &gennus_gmotherp4_polar() { return babyAnalyzer.gennus_gmotherp4_polar(); }
 const vector<int> &gennus_gmotherid() { return babyAnalyzer.gennus_gmotherid(); }
 const vector<int> &gennus_gmotheridx() { return babyAnalyzer.gennus_gmotheridx(); }
 const vector<int> &gennus_gmotherstatus() { return babyAnalyzer.gennus_gmotherstatus(); }
 const vector<bool> &genqs_isfromt() { return babyAnalyzer.genqs_isfromt(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genqs_p4() { return babyAnalyzer.genqs_p4(); }
+const PolarArrays &genqs_p4_polar() { return babyAnalyzer.genqs_p4_polar(); }
 const vector<int> &genqs_id() { return babyAnalyzer.genqs_id(); }
 const vector<int> &genqs__genpsidx() { return babyAnalyzer.genqs__genpsidx(); }
 const vector<int> &genqs_status() { return babyAnalyzer.genqs_status(); }
@@ -10399,15 +13751,18 @@ const vector<bool> &genqs_isLastCopy() { return babyAnalyzer.genqs_isLastCopy();
 const vector<int> &genqs_gentaudecay() { return babyAnalyzer.genqs_gentaudecay(); }
 const int &gen_nfromtqs_() { return babyAnalyzer.gen_nfromtqs_(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genqs_motherp4() { return babyAnalyzer.genqs_motherp4(); }
+const PolarArrays &genqs_motherp4_polar() { return babyAnalyzer.genqs_motherp4_polar(); }
 const vector<int> &genqs_motherid() { return babyAnalyzer.genqs_motherid(); }
 const vector<int> &genqs_motheridx() { return babyAnalyzer.genqs_motheridx(); }
 const vector<int> &genqs_motherstatus() { return babyAnalyzer.genqs_motherstatus(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genqs_gmotherp4() { return babyAnalyzer.genqs_gmotherp4(); }
+const PolarArrays &genqs_gmotherp4_polar() { return babyAnalyzer.genqs_gmotherp4_polar(); }
 const vector<int> &genqs_gmotherid() { return babyAnalyzer.genqs_gmotherid(); }
 const vector<int> &genqs_gmotheridx() { return babyAnalyzer.genqs_gmotheridx(); }
 const vector<int> &genqs_gmotherstatus() { return babyAnalyzer.genqs_gmotherstatus(); }
 const vector<bool> &genbosons_isfromt() { return babyAnalyzer.genbosons_isfromt(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genbosons_p4() { return babyAnalyzer.genbosons_p4(); }
+const PolarArrays &genbosons_p4_polar() { return babyAnalyzer.genbosons_p4_polar(); }
 const vector<int> &genbosons_id() { return babyAnalyzer.genbosons_id(); }
 const vector<int> &genbosons__genpsidx() { return babyAnalyzer.genbosons__genpsidx(); }
 const vector<int> &genbosons_status() { return babyAnalyzer.genbosons_status(); }
@@ -10418,15 +13773,18 @@ const vector<bool> &genbosons_isLastCopy() { return babyAnalyzer.genbosons_isLas
 const vector<int> &genbosons_gentaudecay() { return babyAnalyzer.genbosons_gentaudecay(); }
 const int &gen_nfromtbosons_() { return babyAnalyzer.gen_nfromtbosons_(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genbosons_motherp4() { return babyAnalyzer.genbosons_motherp4(); }
+const PolarArrays &genbosons_motherp4_polar() { return babyAnalyzer.genbosons_motherp4_polar(); }
 const vector<int> &genbosons_motherid() { return babyAnalyzer.genbosons_motherid(); }
 const vector<int> &genbosons_motheridx() { return babyAnalyzer.genbosons_motheridx(); }
 const vector<int> &genbosons_motherstatus() { return babyAnalyzer.genbosons_motherstatus(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genbosons_gmotherp4() { return babyAnalyzer.genbosons_gmotherp4(); }
+const PolarArrays &genbosons_gmotherp4_polar() { return babyAnalyzer.genbosons_gmotherp4_polar(); }
 const vector<int> &genbosons_gmotherid() { return babyAnalyzer.genbosons_gmotherid(); }
 const vector<int> &genbosons_gmotheridx() { return babyAnalyzer.genbosons_gmotheridx(); }
 const vector<int> &genbosons_gmotherstatus() { return babyAnalyzer.genbosons_gmotherstatus(); }
 const vector<bool> &gensusy_isfromt() { return babyAnalyzer.gensusy_isfromt(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gensusy_p4() { return babyAnalyzer.gensusy_p4(); }
+const PolarArrays &gensusy_p4_polar() { return babyAnalyzer.gensusy_p4_polar(); }
 const vector<int> &gensusy_id() { return babyAnalyzer.gensusy_id(); }
 const vector<int> &gensusy__genpsidx() { return babyAnalyzer.gensusy__genpsidx(); }
 const vector<int> &gensusy_status() { return babyAnalyzer.gensusy_status(); }
@@ -10437,14 +13795,17 @@ const vector<bool> &gensusy_isLastCopy() { return babyAnalyzer.gensusy_isLastCop
 const vector<int> &gensusy_gentaudecay() { return babyAnalyzer.gensusy_gentaudecay(); }
 const int &gen_nfromtsusy_() { return babyAnalyzer.gen_nfromtsusy_(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gensusy_motherp4() { return babyAnalyzer.gensusy_motherp4(); }
+const PolarArrays &gensusy_motherp4_polar() { return babyAnalyzer.gensusy_motherp4_polar(); }
 const vector<int> &gensusy_motherid() { return babyAnalyzer.gensusy_motherid(); }
 const vector<int> &gensusy_motheridx() { return babyAnalyzer.gensusy_motheridx(); }
 const vector<int> &gensusy_motherstatus() { return babyAnalyzer.gensusy_motherstatus(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gensusy_gmotherp4() { return babyAnalyzer.gensusy_gmotherp4(); }
+const PolarArrays &gensusy_gmotherp4_polar() { return babyAnalyzer.gensusy_gmotherp4_polar(); }
 const vector<int> &gensusy_gmotherid() { return babyAnalyzer.gensusy_gmotherid(); }
 const vector<int> &gensusy_gmotheridx() { return babyAnalyzer.gensusy_gmotheridx(); }
 const vector<int> &gensusy_gmotherstatus() { return babyAnalyzer.gensusy_gmotherstatus(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ak8pfjets_p4() { return babyAnalyzer.ak8pfjets_p4(); }
+const PolarArrays &ak8pfjets_p4_polar() { return babyAnalyzer.ak8pfjets_p4_polar(); }
 const vector<float> &ak8pfjets_tau1() { return babyAnalyzer.ak8pfjets_tau1(); }
 const vector<float> &ak8pfjets_tau2() { return babyAnalyzer.ak8pfjets_tau2(); }
 const vector<float> &ak8pfjets_tau3() { return babyAnalyzer.ak8pfjets_tau3(); }
@@ -10459,6 +13820,7 @@ const vector<float> &ak8pfjets_deepdisc_hbb() { return babyAnalyzer.ak8pfjets_de
 const vector<float> &ak8pfjets_deepdisc_h4q() { return babyAnalyzer.ak8pfjets_deepdisc_h4q(); }
 const float &lead_ak8deepdisc_top() { return babyAnalyzer.lead_ak8deepdisc_top(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_ak8pfjets_p4() { return babyAnalyzer.jup_ak8pfjets_p4(); }
+const PolarArrays &jup_ak8pfjets_p4_polar() { return babyAnalyzer.jup_ak8pfjets_p4_polar(); }
 const vector<float> &jup_ak8pfjets_tau1() { return babyAnalyzer.jup_ak8pfjets_tau1(); }
 const vector<float> &jup_ak8pfjets_tau2() { return babyAnalyzer.jup_ak8pfjets_tau2(); }
 const vector<float> &jup_ak8pfjets_tau3() { return babyAnalyzer.jup_ak8pfjets_tau3(); }
@@ -10473,6 +13835,7 @@ const vector<float> &jup_ak8pfjets_deepdisc_hbb() { return babyAnalyzer.jup_ak8p
 const vector<float> &jup_ak8pfjets_deepdisc_h4q() { return babyAnalyzer.jup_ak8pfjets_deepdisc_h4q(); }
 const float &jup_lead_ak8deepdisc_top() { return babyAnalyzer.jup_lead_ak8deepdisc_top(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_ak8pfjets_p4() { return babyAnalyzer.jdown_ak8pfjets_p4(); }
+const PolarArrays &jdown_ak8pfjets_p4_polar() { return babyAnalyzer.jdown_ak8pfjets_p4_polar(); }
 const vector<float> &jdown_ak8pfjets_tau1() { return babyAnalyzer.jdown_ak8pfjets_tau1(); }
 const vector<float> &jdown_ak8pfjets_tau2() { return babyAnalyzer.jdown_ak8pfjets_tau2(); }
 const vector<float> &jdown_ak8pfjets_tau3() { return babyAnalyzer.jdown_ak8pfjets_tau3(); }
@@ -10498,8 +13861,11 @@ const vector<float> &ak4pfjets_deepCSVl() { return babyAnalyzer.ak4pfjets_deepCS
 const vector<vector<int> > &topcands_ak4idx() { return babyAnalyzer.topcands_ak4idx(); }
 const vector<float> &topcands_disc() { return babyAnalyzer.topcands_disc(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &topcands_p4() { return babyAnalyzer.topcands_p4(); }
+const PolarArrays &topcands_p4_polar() { return babyAnalyzer.topcands_p4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &topcands_Wp4() { return babyAnalyzer.topcands_Wp4(); }
+const PolarArrays &topcands_Wp4_polar() { return babyAnalyzer.topcands_Wp4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &tftops_p4() { return babyAnalyzer.tftops_p4(); }
+const PolarArrays &tftops_p4_polar() { return babyAnalyzer.tftops_p4_polar(); }
 const vector<float> &tftops_disc() { return babyAnalyzer.tftops_disc(); }
 const vector<vector<float> > &tftops_subjet_pt() { return babyAnalyzer.tftops_subjet_pt(); }
 const vector<vector<float> > &tftops_subjet_eta() { return babyAnalyzer.tftops_subjet_eta(); }
@@ -10516,8 +13882,11 @@ const vector<float> &jup_ak4pfjets_deepCSVl() { return babyAnalyzer.jup_ak4pfjet
 const vector<vector<int> > &jup_topcands_ak4idx() { return babyAnalyzer.jup_topcands_ak4idx(); }
 const vector<float> &jup_topcands_disc() { return babyAnalyzer.jup_topcands_disc(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_topcands_p4() { return babyAnalyzer.jup_topcands_p4(); }
+const PolarArrays &jup_topcands_p4_polar() { return babyAnalyzer.jup_topcands_p4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_topcands_Wp4() { return babyAnalyzer.jup_topcands_Wp4(); }
+const PolarArrays &jup_topcands_Wp4_polar() { return babyAnalyzer.jup_topcands_Wp4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_tftops_p4() { return babyAnalyzer.jup_tftops_p4(); }
+const PolarArrays &jup_tftops_p4_polar() { return babyAnalyzer.jup_tftops_p4_polar(); }
 const vector<float> &jup_tftops_disc() { return babyAnalyzer.jup_tftops_disc(); }
 const vector<vector<float> > &jup_tftops_subjet_pt() { return babyAnalyzer.jup_tftops_subjet_pt(); }
 const vector<vector<float> > &jup_tftops_subjet_eta() { return babyAnalyzer.jup_tftops_subjet_eta(); }
@@ -10534,20 +13903,25 @@ const vector<float> &jdown_ak4pfjets_deepCSVl() { return babyAnalyzer.jdown_ak4p
 const vector<vector<int> > &jdown_topcands_ak4idx() { return babyAnalyzer.jdown_topcands_ak4idx(); }
 const vector<float> &jdown_topcands_disc() { return babyAnalyzer.jdown_topcands_disc(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_topcands_p4() { return babyAnalyzer.jdown_topcands_p4(); }
+const PolarArrays &jdown_topcands_p4_polar() { return babyAnalyzer.jdown_topcands_p4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_topcands_Wp4() { return babyAnalyzer.jdown_topcands_Wp4(); }
+const PolarArrays &jdown_topcands_Wp4_polar() { return babyAnalyzer.jdown_topcands_Wp4_polar(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_tftops_p4() { return babyAnalyzer.jdown_tftops_p4(); }
+const PolarArrays &jdown_tftops_p4_polar() { return babyAnalyzer.jdown_tftops_p4_polar(); }
 const vector<float> &jdown_tftops_disc() { return babyAnalyzer.jdown_tftops_disc(); }
 const vector<vector<float> > &jdown_tftops_subjet_pt() { return babyAnalyzer.jdown_tftops_subjet_pt(); }
 const vector<vector<float> > &jdown_tftops_subjet_eta() { return babyAnalyzer.jdown_tftops_subjet_eta(); }
 const vector<vector<float> > &jdown_tftops_subjet_phi() { return babyAnalyzer.jdown_tftops_subjet_phi(); }
 const vector<TString> &tau_IDnames() { return babyAnalyzer.tau_IDnames(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &tau_p4() { return babyAnalyzer.tau_p4(); }
+const PolarArrays &tau_p4_polar() { return babyAnalyzer.tau_p4_polar(); }
 const vector<vector<float> > &tau_ID() { return babyAnalyzer.tau_ID(); }
 const vector<float> &tau_passID() { return babyAnalyzer.tau_passID(); }
 const int &ngoodtaus() { return babyAnalyzer.ngoodtaus(); }
 const vector<bool> &tau_isVetoTau() { return babyAnalyzer.tau_isVetoTau(); }
 const vector<bool> &tau_isVetoTau_v2() { return babyAnalyzer.tau_isVetoTau_v2(); }
 const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &isoTracks_p4() { return babyAnalyzer.isoTracks_p4(); }
+const PolarArrays &isoTracks_p4_polar() { return babyAnalyzer.isoTracks_p4_polar(); }
 const vector<int> &isoTracks_charge() { return babyAnalyzer.isoTracks_charge(); }
 const vector<float> &isoTracks_absIso() { return babyAnalyzer.isoTracks_absIso(); }
 const vector<float> &isoTracks_dz() { return babyAnalyzer.isoTracks_dz(); }
@@ -10593,6 +13967,7 @@ const int &HLT_Photon120() { return babyAnalyzer.HLT_Photon120(); }
 const int &HLT_Photon200() { return babyAnalyzer.HLT_Photon200(); }
 const int &HLT_Photon250_NoHE() { return babyAnalyzer.HLT_Photon250_NoHE(); }
 const int &HLT_Photon300_NoHE() { return babyAnalyzer.HLT_Photon300_NoHE(); }
+const unsigned int &HLT_bits() { return babyAnalyzer.HLT_bits(); }
 const bool &filt_cscbeamhalo() { return babyAnalyzer.filt_cscbeamhalo(); }
 const bool &filt_cscbeamhalo2015() { return babyAnalyzer.filt_cscbeamhalo2015(); }
 const bool &filt_globaltighthalo2016() { return babyAnalyzer.filt_globaltighthalo2016(); }
@@ -13,6 +13,10 @@
 #include "TH1F.h"
 #include "TFile.h"
 #include "TBits.h"
+#include "BulkBranch.h"
+#include "PolarCache.h"
+#include "SplitP4.h"
+#include "FlatSkim.h"
 #include <vector> 
 #include <unistd.h> 
 typedef ROOT::Math::LorentzVector< ROOT::Math::PxPyPzE4D<float> > LorentzVector;
@@ -22,1773 +26,2820 @@ class StopTree {
  private: 
  protected: 
   unsigned int index;
+  unsigned long long entryGeneration = 1;
+  BulkBranchSet bulkRead;
   unsigned int run_;
   TBranch *run_branch;
-  bool     run_isLoaded;
+  unsigned long long run_loadedGen;
+  FlatScalar<unsigned int> run_flat;
+  BulkBranch *run_bulk;
   unsigned int ls_;
   TBranch *ls_branch;
-  bool     ls_isLoaded;
+  unsigned long long ls_loadedGen;
+  FlatScalar<unsigned int> ls_flat;
+  BulkBranch *ls_bulk;
   unsigned int evt_;
   TBranch *evt_branch;
-  bool     evt_isLoaded;
+  unsigned long long evt_loadedGen;
+  FlatScalar<unsigned int> evt_flat;
+  BulkBranch *evt_bulk;
   int      nvtxs_;
   TBranch *nvtxs_branch;
-  bool     nvtxs_isLoaded;
+  unsigned long long nvtxs_loadedGen;
+  FlatScalar<int> nvtxs_flat;
+  BulkBranch *nvtxs_bulk;
   int      year_;
   TBranch *year_branch;
-  bool     year_isLoaded;
+  unsigned long long year_loadedGen;
+  FlatScalar<int> year_flat;
+  BulkBranch *year_bulk;
   int      sampver_;
   TBranch *sampver_branch;
-  bool     sampver_isLoaded;
+  unsigned long long sampver_loadedGen;
+  FlatScalar<int> sampver_flat;
+  BulkBranch *sampver_bulk;
   int      pu_nvtxs_;
   TBranch *pu_nvtxs_branch;
-  bool     pu_nvtxs_isLoaded;
+  unsigned long long pu_nvtxs_loadedGen;
+  FlatScalar<int> pu_nvtxs_flat;
+  BulkBranch *pu_nvtxs_bulk;
   float    pfmet_;
   TBranch *pfmet_branch;
-  bool     pfmet_isLoaded;
+  unsigned long long pfmet_loadedGen;
+  FlatScalar<float> pfmet_flat;
+  BulkBranch *pfmet_bulk;
   float    pfmet_phi_;
   TBranch *pfmet_phi_branch;
-  bool     pfmet_phi_isLoaded;
+  unsigned long long pfmet_phi_loadedGen;
+  FlatScalar<float> pfmet_phi_flat;
+  BulkBranch *pfmet_phi_bulk;
   float    pfmet_jup_;
   TBranch *pfmet_jup_branch;
-  bool     pfmet_jup_isLoaded;
+  unsigned long long pfmet_jup_loadedGen;
+  FlatScalar<float> pfmet_jup_flat;
+  BulkBranch *pfmet_jup_bulk;
   float    pfmet_phi_jup_;
   TBranch *pfmet_phi_jup_branch;
-  bool     pfmet_phi_jup_isLoaded;
+  unsigned long long pfmet_phi_jup_loadedGen;
+  FlatScalar<float> pfmet_phi_jup_flat;
+  BulkBranch *pfmet_phi_jup_bulk;
   float    pfmet_jdown_;
   TBranch *pfmet_jdown_branch;
-  bool     pfmet_jdown_isLoaded;
+  unsigned long long pfmet_jdown_loadedGen;
+  FlatScalar<float> pfmet_jdown_flat;
+  BulkBranch *pfmet_jdown_bulk;
   float    pfmet_phi_jdown_;
   TBranch *pfmet_phi_jdown_branch;
-  bool     pfmet_phi_jdown_isLoaded;
+  unsigned long long pfmet_phi_jdown_loadedGen;
+  FlatScalar<float> pfmet_phi_jdown_flat;
+  BulkBranch *pfmet_phi_jdown_bulk;
   float    pfmet_rl_;
   TBranch *pfmet_rl_branch;
-  bool     pfmet_rl_isLoaded;
+  unsigned long long pfmet_rl_loadedGen;
+  FlatScalar<float> pfmet_rl_flat;
+  BulkBranch *pfmet_rl_bulk;
   float    pfmet_phi_rl_;
   TBranch *pfmet_phi_rl_branch;
-  bool     pfmet_phi_rl_isLoaded;
+  unsigned long long pfmet_phi_rl_loadedGen;
+  FlatScalar<float> pfmet_phi_rl_flat;
+  BulkBranch *pfmet_phi_rl_bulk;
   float    pfmet_rl_jup_;
   TBranch *pfmet_rl_jup_branch;
-  bool     pfmet_rl_jup_isLoaded;
+  unsigned long long pfmet_rl_jup_loadedGen;
+  FlatScalar<float> pfmet_rl_jup_flat;
+  BulkBranch *pfmet_rl_jup_bulk;
   float    pfmet_phi_rl_jup_;
   TBranch *pfmet_phi_rl_jup_branch;
-  bool     pfmet_phi_rl_jup_isLoaded;
+  unsigned long long pfmet_phi_rl_jup_loadedGen;
+  FlatScalar<float> pfmet_phi_rl_jup_flat;
+  BulkBranch *pfmet_phi_rl_jup_bulk;
   float    pfmet_rl_jdown_;
   TBranch *pfmet_rl_jdown_branch;
-  bool     pfmet_rl_jdown_isLoaded;
+  unsigned long long pfmet_rl_jdown_loadedGen;
+  FlatScalar<float> pfmet_rl_jdown_flat;
+  BulkBranch *pfmet_rl_jdown_bulk;
   float    pfmet_phi_rl_jdown_;
   TBranch *pfmet_phi_rl_jdown_branch;
-  bool     pfmet_phi_rl_jdown_isLoaded;
+  unsigned long long pfmet_phi_rl_jdown_loadedGen;
+  FlatScalar<float> pfmet_phi_rl_jdown_flat;
+  BulkBranch *pfmet_phi_rl_jdown_bulk;
   float    pfmet_egclean_;
   TBranch *pfmet_egclean_branch;
-  bool     pfmet_egclean_isLoaded;
+  unsigned long long pfmet_egclean_loadedGen;
+  FlatScalar<float> pfmet_egclean_flat;
+  BulkBranch *pfmet_egclean_bulk;
   float    pfmet_egclean_phi_;
   TBranch *pfmet_egclean_phi_branch;
-  bool     pfmet_egclean_phi_isLoaded;
+  unsigned long long pfmet_egclean_phi_loadedGen;
+  FlatScalar<float> pfmet_egclean_phi_flat;
+  BulkBranch *pfmet_egclean_phi_bulk;
   float    pfmet_muegclean_;
   TBranch *pfmet_muegclean_branch;
-  bool     pfmet_muegclean_isLoaded;
+  unsigned long long pfmet_muegclean_loadedGen;
+  FlatScalar<float> pfmet_muegclean_flat;
+  BulkBranch *pfmet_muegclean_bulk;
   float    pfmet_muegclean_phi_;
   TBranch *pfmet_muegclean_phi_branch;
-  bool     pfmet_muegclean_phi_isLoaded;
+  unsigned long long pfmet_muegclean_phi_loadedGen;
+  FlatScalar<float> pfmet_muegclean_phi_flat;
+  BulkBranch *pfmet_muegclean_phi_bulk;
   float    pfmet_muegcleanfix_;
   TBranch *pfmet_muegcleanfix_branch;
-  bool     pfmet_muegcleanfix_isLoaded;
+  unsigned long long pfmet_muegcleanfix_loadedGen;
+  FlatScalar<float> pfmet_muegcleanfix_flat;
+  BulkBranch *pfmet_muegcleanfix_bulk;
   float    pfmet_muegcleanfix_phi_;
   TBranch *pfmet_muegcleanfix_phi_branch;
-  bool     pfmet_muegcleanfix_phi_isLoaded;
+  unsigned long long pfmet_muegcleanfix_phi_loadedGen;
+  FlatScalar<float> pfmet_muegcleanfix_phi_flat;
+  BulkBranch *pfmet_muegcleanfix_phi_bulk;
   float    pfmet_uncorr_;
   TBranch *pfmet_uncorr_branch;
-  bool     pfmet_uncorr_isLoaded;
+  unsigned long long pfmet_uncorr_loadedGen;
+  FlatScalar<float> pfmet_uncorr_flat;
+  BulkBranch *pfmet_uncorr_bulk;
   float    pfmet_uncorr_phi_;
   TBranch *pfmet_uncorr_phi_branch;
-  bool     pfmet_uncorr_phi_isLoaded;
+  unsigned long long pfmet_uncorr_phi_loadedGen;
+  FlatScalar<float> pfmet_uncorr_phi_flat;
+  BulkBranch *pfmet_uncorr_phi_bulk;
   float    pfmet_original_;
   TBranch *pfmet_original_branch;
-  bool     pfmet_original_isLoaded;
+  unsigned long long pfmet_original_loadedGen;
+  FlatScalar<float> pfmet_original_flat;
+  BulkBranch *pfmet_original_bulk;
   float    pfmet_original_phi_;
   TBranch *pfmet_original_phi_branch;
-  bool     pfmet_original_phi_isLoaded;
+  unsigned long long pfmet_original_phi_loadedGen;
+  FlatScalar<float> pfmet_original_phi_flat;
+  BulkBranch *pfmet_original_phi_bulk;
   float    scale1fb_;
   TBranch *scale1fb_branch;
-  bool     scale1fb_isLoaded;
+  unsigned long long scale1fb_loadedGen;
+  FlatScalar<float> scale1fb_flat;
+  BulkBranch *scale1fb_bulk;
   float    xsec_;
   TBranch *xsec_branch;
-  bool     xsec_isLoaded;
+  unsigned long long xsec_loadedGen;
+  FlatScalar<float> xsec_flat;
+  BulkBranch *xsec_bulk;
   float    xsec_uncert_;
   TBranch *xsec_uncert_branch;
-  bool     xsec_uncert_isLoaded;
+  unsigned long long xsec_uncert_loadedGen;
+  FlatScalar<float> xsec_uncert_flat;
+  BulkBranch *xsec_uncert_bulk;
   float    kfactor_;
   TBranch *kfactor_branch;
-  bool     kfactor_isLoaded;
+  unsigned long long kfactor_loadedGen;
+  FlatScalar<float> kfactor_flat;
+  BulkBranch *kfactor_bulk;
   float    pu_ntrue_;
   TBranch *pu_ntrue_branch;
-  bool     pu_ntrue_isLoaded;
+  unsigned long long pu_ntrue_loadedGen;
+  FlatScalar<float> pu_ntrue_flat;
+  BulkBranch *pu_ntrue_bulk;
   int      ngoodleps_;
   TBranch *ngoodleps_branch;
-  bool     ngoodleps_isLoaded;
+  unsigned long long ngoodleps_loadedGen;
+  FlatScalar<int> ngoodleps_flat;
+  BulkBranch *ngoodleps_bulk;
   int      nlooseleps_;
   TBranch *nlooseleps_branch;
-  bool     nlooseleps_isLoaded;
+  unsigned long long nlooseleps_loadedGen;
+  FlatScalar<int> nlooseleps_flat;
+  BulkBranch *nlooseleps_bulk;
   int      nvetoleps_;
   TBranch *nvetoleps_branch;
-  bool     nvetoleps_isLoaded;
+  unsigned long long nvetoleps_loadedGen;
+  FlatScalar<int> nvetoleps_flat;
+  BulkBranch *nvetoleps_bulk;
   bool     is_data_;
   TBranch *is_data_branch;
-  bool     is_data_isLoaded;
+  unsigned long long is_data_loadedGen;
+  FlatScalar<bool> is_data_flat;
+  BulkBranch *is_data_bulk;
   string *dataset_;
   TBranch *dataset_branch;
-  bool     dataset_isLoaded;
+  unsigned long long dataset_loadedGen;
   string *filename_;
   TBranch *filename_branch;
-  bool     filename_isLoaded;
+  unsigned long long filename_loadedGen;
   string *cms3tag_;
   TBranch *cms3tag_branch;
-  bool     cms3tag_isLoaded;
+  unsigned long long cms3tag_loadedGen;
   unsigned int nEvents_;
   TBranch *nEvents_branch;
-  bool     nEvents_isLoaded;
+  unsigned long long nEvents_loadedGen;
+  FlatScalar<unsigned int> nEvents_flat;
+  BulkBranch *nEvents_bulk;
   unsigned int nEvents_goodvtx_;
   TBranch *nEvents_goodvtx_branch;
-  bool     nEvents_goodvtx_isLoaded;
+  unsigned long long nEvents_goodvtx_loadedGen;
+  FlatScalar<unsigned int> nEvents_goodvtx_flat;
+  BulkBranch *nEvents_goodvtx_bulk;
   unsigned int nEvents_MET30_;
   TBranch *nEvents_MET30_branch;
-  bool     nEvents_MET30_isLoaded;
+  unsigned long long nEvents_MET30_loadedGen;
+  FlatScalar<unsigned int> nEvents_MET30_flat;
+  BulkBranch *nEvents_MET30_bulk;
   unsigned int nEvents_1goodlep_;
   TBranch *nEvents_1goodlep_branch;
-  bool     nEvents_1goodlep_isLoaded;
+  unsigned long long nEvents_1goodlep_loadedGen;
+  FlatScalar<unsigned int> nEvents_1goodlep_flat;
+  BulkBranch *nEvents_1goodlep_bulk;
   unsigned int nEvents_2goodjets_;
   TBranch *nEvents_2goodjets_branch;
-  bool     nEvents_2goodjets_isLoaded;
+  unsigned long long nEvents_2goodjets_loadedGen;
+  FlatScalar<unsigned int> nEvents_2goodjets_flat;
+  BulkBranch *nEvents_2goodjets_bulk;
   int      is0lep_;
   TBranch *is0lep_branch;
-  bool     is0lep_isLoaded;
+  unsigned long long is0lep_loadedGen;
+  FlatScalar<int> is0lep_flat;
+  BulkBranch *is0lep_bulk;
   int      is1lep_;
   TBranch *is1lep_branch;
-  bool     is1lep_isLoaded;
+  unsigned long long is1lep_loadedGen;
+  FlatScalar<int> is1lep_flat;
+  BulkBranch *is1lep_bulk;
   int      is2lep_;
   TBranch *is2lep_branch;
-  bool     is2lep_isLoaded;
+  unsigned long long is2lep_loadedGen;
+  FlatScalar<int> is2lep_flat;
+  BulkBranch *is2lep_bulk;
   int      isZtoNuNu_;
   TBranch *isZtoNuNu_branch;
-  bool     isZtoNuNu_isLoaded;
+  unsigned long long isZtoNuNu_loadedGen;
+  FlatScalar<int> isZtoNuNu_flat;
+  BulkBranch *isZtoNuNu_bulk;
   int      is1lepFromW_;
   TBranch *is1lepFromW_branch;
-  bool     is1lepFromW_isLoaded;
+  unsigned long long is1lepFromW_loadedGen;
+  FlatScalar<int> is1lepFromW_flat;
+  BulkBranch *is1lepFromW_bulk;
   int      is1lepFromTop_;
   TBranch *is1lepFromTop_branch;
-  bool     is1lepFromTop_isLoaded;
+  unsigned long long is1lepFromTop_loadedGen;
+  FlatScalar<int> is1lepFromTop_flat;
+  BulkBranch *is1lepFromTop_bulk;
   float    MT2W_;
   TBranch *MT2W_branch;
-  bool     MT2W_isLoaded;
+  unsigned long long MT2W_loadedGen;
+  FlatScalar<float> MT2W_flat;
+  BulkBranch *MT2W_bulk;
   float    MT2W_rl_;
   TBranch *MT2W_rl_branch;
-  bool     MT2W_rl_isLoaded;
+  unsigned long long MT2W_rl_loadedGen;
+  FlatScalar<float> MT2W_rl_flat;
+  BulkBranch *MT2W_rl_bulk;
   float    MT2_ll_;
   TBranch *MT2_ll_branch;
-  bool     MT2_ll_isLoaded;
+  unsigned long long MT2_ll_loadedGen;
+  FlatScalar<float> MT2_ll_flat;
+  BulkBranch *MT2_ll_bulk;
   float    mindphi_met_j1_j2_;
   TBranch *mindphi_met_j1_j2_branch;
-  bool     mindphi_met_j1_j2_isLoaded;
+  unsigned long long mindphi_met_j1_j2_loadedGen;
+  FlatScalar<float> mindphi_met_j1_j2_flat;
+  BulkBranch *mindphi_met_j1_j2_bulk;
   float    mindphi_met_j1_j2_rl_;
   TBranch *mindphi_met_j1_j2_rl_branch;
-  bool     mindphi_met_j1_j2_rl_isLoaded;
+  unsigned long long mindphi_met_j1_j2_rl_loadedGen;
+  FlatScalar<float> mindphi_met_j1_j2_rl_flat;
+  BulkBranch *mindphi_met_j1_j2_rl_bulk;
   float    mt_met_lep_;
   TBranch *mt_met_lep_branch;
-  bool     mt_met_lep_isLoaded;
+  unsigned long long mt_met_lep_loadedGen;
+  FlatScalar<float> mt_met_lep_flat;
+  BulkBranch *mt_met_lep_bulk;
   float    mt_met_lep_rl_;
   TBranch *mt_met_lep_rl_branch;
-  bool     mt_met_lep_rl_isLoaded;
+  unsigned long long mt_met_lep_rl_loadedGen;
+  FlatScalar<float> mt_met_lep_rl_flat;
+  BulkBranch *mt_met_lep_rl_bulk;
   float    MT2W_jup_;
   TBranch *MT2W_jup_branch;
-  bool     MT2W_jup_isLoaded;
+  unsigned long long MT2W_jup_loadedGen;
+  FlatScalar<float> MT2W_jup_flat;
+  BulkBranch *MT2W_jup_bulk;
   float    MT2W_rl_jup_;
   TBranch *MT2W_rl_jup_branch;
-  bool     MT2W_rl_jup_isLoaded;
+  unsigned long long MT2W_rl_jup_loadedGen;
+  FlatScalar<float> MT2W_rl_jup_flat;
+  BulkBranch *MT2W_rl_jup_bulk;
   float    MT2_ll_jup_;
   TBranch *MT2_ll_jup_branch;
-  bool     MT2_ll_jup_isLoaded;
+  unsigned long long MT2_ll_jup_loadedGen;
+  FlatScalar<float> MT2_ll_jup_flat;
+  BulkBranch *MT2_ll_jup_bulk;
   float    mindphi_met_j1_j2_jup_;
   TBranch *mindphi_met_j1_j2_jup_branch;
-  bool     mindphi_met_j1_j2_jup_isLoaded;
+  unsigned long long mindphi_met_j1_j2_jup_loadedGen;
+  FlatScalar<float> mindphi_met_j1_j2_jup_flat;
+  BulkBranch *mindphi_met_j1_j2_jup_bulk;
   float    mindphi_met_j1_j2_rl_jup_;
   TBranch *mindphi_met_j1_j2_rl_jup_branch;
-  bool     mindphi_met_j1_j2_rl_jup_isLoaded;
+  unsigned long long mindphi_met_j1_j2_rl_jup_loadedGen;
+  FlatScalar<float> mindphi_met_j1_j2_rl_jup_flat;
+  BulkBranch *mindphi_met_j1_j2_rl_jup_bulk;
   float    mt_met_lep_jup_;
   TBranch *mt_met_lep_jup_branch;
-  bool     mt_met_lep_jup_isLoaded;
+  unsigned long long mt_met_lep_jup_loadedGen;
+  FlatScalar<float> mt_met_lep_jup_flat;
+  BulkBranch *mt_met_lep_jup_bulk;
   float    mt_met_lep_rl_jup_;
   TBranch *mt_met_lep_rl_jup_branch;
-  bool     mt_met_lep_rl_jup_isLoaded;
+  unsigned long long mt_met_lep_rl_jup_loadedGen;
+  FlatScalar<float> mt_met_lep_rl_jup_flat;
+  BulkBranch *mt_met_lep_rl_jup_bulk;
   float    MT2W_jdown_;
   TBranch *MT2W_jdown_branch;
-  bool     MT2W_jdown_isLoaded;
+  unsigned long long MT2W_jdown_loadedGen;
+  FlatScalar<float> MT2W_jdown_flat;
+  BulkBranch *MT2W_jdown_bulk;
   float    MT2W_rl_jdown_;
   TBranch *MT2W_rl_jdown_branch;
-  bool     MT2W_rl_jdown_isLoaded;
+  unsigned long long MT2W_rl_jdown_loadedGen;
+  FlatScalar<float> MT2W_rl_jdown_flat;
+  BulkBranch *MT2W_rl_jdown_bulk;
   float    MT2_ll_jdown_;
   TBranch *MT2_ll_jdown_branch;
-  bool     MT2_ll_jdown_isLoaded;
+  unsigned long long MT2_ll_jdown_loadedGen;
+  FlatScalar<float> MT2_ll_jdown_flat;
+  BulkBranch *MT2_ll_jdown_bulk;
   float    mindphi_met_j1_j2_jdown_;
   TBranch *mindphi_met_j1_j2_jdown_branch;
-  bool     mindphi_met_j1_j2_jdown_isLoaded;
+  unsigned long long mindphi_met_j1_j2_jdown_loadedGen;
+  FlatScalar<float> mindphi_met_j1_j2_jdown_flat;
+  BulkBranch *mindphi_met_j1_j2_jdown_bulk;
   float    mindphi_met_j1_j2_rl_jdown_;
   TBranch *mindphi_met_j1_j2_rl_jdown_branch;
-  bool     mindphi_met_j1_j2_rl_jdown_isLoaded;
+  unsigned long long mindphi_met_j1_j2_rl_jdown_loadedGen;
+  FlatScalar<float> mindphi_met_j1_j2_rl_jdown_flat;
+  BulkBranch *mindphi_met_j1_j2_rl_jdown_bulk;
   float    mt_met_lep_jdown_;
   TBranch *mt_met_lep_jdown_branch;
-  bool     mt_met_lep_jdown_isLoaded;
+  unsigned long long mt_met_lep_jdown_loadedGen;
+  FlatScalar<float> mt_met_lep_jdown_flat;
+  BulkBranch *mt_met_lep_jdown_bulk;
   float    mt_met_lep_rl_jdown_;
   TBranch *mt_met_lep_rl_jdown_branch;
-  bool     mt_met_lep_rl_jdown_isLoaded;
+  unsigned long long mt_met_lep_rl_jdown_loadedGen;
+  FlatScalar<float> mt_met_lep_rl_jdown_flat;
+  BulkBranch *mt_met_lep_rl_jdown_bulk;
   float    hadronic_top_chi2_;
   TBranch *hadronic_top_chi2_branch;
-  bool     hadronic_top_chi2_isLoaded;
+  unsigned long long hadronic_top_chi2_loadedGen;
+  FlatScalar<float> hadronic_top_chi2_flat;
+  BulkBranch *hadronic_top_chi2_bulk;
   float    ak4pfjets_rho_;
   TBranch *ak4pfjets_rho_branch;
-  bool     ak4pfjets_rho_isLoaded;
+  unsigned long long ak4pfjets_rho_loadedGen;
+  FlatScalar<float> ak4pfjets_rho_flat;
+  BulkBranch *ak4pfjets_rho_bulk;
   float    pdf_up_weight_;
   TBranch *pdf_up_weight_branch;
-  bool     pdf_up_weight_isLoaded;
+  unsigned long long pdf_up_weight_loadedGen;
+  FlatScalar<float> pdf_up_weight_flat;
+  BulkBranch *pdf_up_weight_bulk;
   float    pdf_down_weight_;
   TBranch *pdf_down_weight_branch;
-  bool     pdf_down_weight_isLoaded;
+  unsigned long long pdf_down_weight_loadedGen;
+  FlatScalar<float> pdf_down_weight_flat;
+  BulkBranch *pdf_down_weight_bulk;
   vector<string> *genweightsID_;
   TBranch *genweightsID_branch;
-  bool     genweightsID_isLoaded;
+  unsigned long long genweightsID_loadedGen;
   int      ngenweights_;
   TBranch *ngenweights_branch;
-  bool     ngenweights_isLoaded;
+  unsigned long long ngenweights_loadedGen;
+  FlatScalar<int> ngenweights_flat;
+  BulkBranch *ngenweights_bulk;
   vector<float> *genweights_;
   TBranch *genweights_branch;
-  bool     genweights_isLoaded;
+  unsigned long long genweights_loadedGen;
+  FlatObject<vector<float> > genweights_flat;
   float    weight_Q2_up_;
   TBranch *weight_Q2_up_branch;
-  bool     weight_Q2_up_isLoaded;
+  unsigned long long weight_Q2_up_loadedGen;
+  FlatScalar<float> weight_Q2_up_flat;
+  BulkBranch *weight_Q2_up_bulk;
   float    weight_Q2_down_;
   TBranch *weight_Q2_down_branch;
-  bool     weight_Q2_down_isLoaded;
+  unsigned long long weight_Q2_down_loadedGen;
+  FlatScalar<float> weight_Q2_down_flat;
+  BulkBranch *weight_Q2_down_bulk;
   float    weight_alphas_up_;
   TBranch *weight_alphas_up_branch;
-  bool     weight_alphas_up_isLoaded;
+  unsigned long long weight_alphas_up_loadedGen;
+  FlatScalar<float> weight_alphas_up_flat;
+  BulkBranch *weight_alphas_up_bulk;
   float    weight_alphas_down_;
   TBranch *weight_alphas_down_branch;
-  bool     weight_alphas_down_isLoaded;
+  unsigned long long weight_alphas_down_loadedGen;
+  FlatScalar<float> weight_alphas_down_flat;
+  BulkBranch *weight_alphas_down_bulk;
   float    weight_btagsf_;
   TBranch *weight_btagsf_branch;
-  bool     weight_btagsf_isLoaded;
+  unsigned long long weight_btagsf_loadedGen;
+  FlatScalar<float> weight_btagsf_flat;
+  BulkBranch *weight_btagsf_bulk;
   float    weight_btagsf_heavy_UP_;
   TBranch *weight_btagsf_heavy_UP_branch;
-  bool     weight_btagsf_heavy_UP_isLoaded;
+  unsigned long long weight_btagsf_heavy_UP_loadedGen;
+  FlatScalar<float> weight_btagsf_heavy_UP_flat;
+  BulkBranch *weight_btagsf_heavy_UP_bulk;
   float    weight_btagsf_light_UP_;
   TBranch *weight_btagsf_light_UP_branch;
-  bool     weight_btagsf_light_UP_isLoaded;
+  unsigned long long weight_btagsf_light_UP_loadedGen;
+  FlatScalar<float> weight_btagsf_light_UP_flat;
+  BulkBranch *weight_btagsf_light_UP_bulk;
   float    weight_btagsf_heavy_DN_;
   TBranch *weight_btagsf_heavy_DN_branch;
-  bool     weight_btagsf_heavy_DN_isLoaded;
+  unsigned long long weight_btagsf_heavy_DN_loadedGen;
+  FlatScalar<float> weight_btagsf_heavy_DN_flat;
+  BulkBranch *weight_btagsf_heavy_DN_bulk;
   float    weight_btagsf_light_DN_;
   TBranch *weight_btagsf_light_DN_branch;
-  bool     weight_btagsf_light_DN_isLoaded;
+  unsigned long long weight_btagsf_light_DN_loadedGen;
+  FlatScalar<float> weight_btagsf_light_DN_flat;
+  BulkBranch *weight_btagsf_light_DN_bulk;
   float    weight_btagsf_fastsim_UP_;
   TBranch *weight_btagsf_fastsim_UP_branch;
-  bool     weight_btagsf_fastsim_UP_isLoaded;
+  unsigned long long weight_btagsf_fastsim_UP_loadedGen;
+  FlatScalar<float> weight_btagsf_fastsim_UP_flat;
+  BulkBranch *weight_btagsf_fastsim_UP_bulk;
   float    weight_btagsf_fastsim_DN_;
   TBranch *weight_btagsf_fastsim_DN_branch;
-  bool     weight_btagsf_fastsim_DN_isLoaded;
+  unsigned long long weight_btagsf_fastsim_DN_loadedGen;
+  FlatScalar<float> weight_btagsf_fastsim_DN_flat;
+  BulkBranch *weight_btagsf_fastsim_DN_bulk;
   float    weight_analysisbtagsf_;
   TBranch *weight_analysisbtagsf_branch;
-  bool     weight_analysisbtagsf_isLoaded;
+  unsigned long long weight_analysisbtagsf_loadedGen;
+  FlatScalar<float> weight_analysisbtagsf_flat;
+  BulkBranch *weight_analysisbtagsf_bulk;
   float    weight_analysisbtagsf_heavy_UP_;
   TBranch *weight_analysisbtagsf_heavy_UP_branch;
-  bool     weight_analysisbtagsf_heavy_UP_isLoaded;
+  unsigned long long weight_analysisbtagsf_heavy_UP_loadedGen;
+  FlatScalar<float> weight_analysisbtagsf_heavy_UP_flat;
+  BulkBranch *weight_analysisbtagsf_heavy_UP_bulk;
   float    weight_analysisbtagsf_light_UP_;
   TBranch *weight_analysisbtagsf_light_UP_branch;
-  bool     weight_analysisbtagsf_light_UP_isLoaded;
+  unsigned long long weight_analysisbtagsf_light_UP_loadedGen;
+  FlatScalar<float> weight_analysisbtagsf_light_UP_flat;
+  BulkBranch *weight_analysisbtagsf_light_UP_bulk;
   float    weight_analysisbtagsf_heavy_DN_;
   TBranch *weight_analysisbtagsf_heavy_DN_branch;
-  bool     weight_analysisbtagsf_heavy_DN_isLoaded;
+  unsigned long long weight_analysisbtagsf_heavy_DN_loadedGen;
+  FlatScalar<float> weight_analysisbtagsf_heavy_DN_flat;
+  BulkBranch *weight_analysisbtagsf_heavy_DN_bulk;
   float    weight_analysisbtagsf_light_DN_;
   TBranch *weight_analysisbtagsf_light_DN_branch;
-  bool     weight_analysisbtagsf_light_DN_isLoaded;
+  unsigned long long weight_analysisbtagsf_light_DN_loadedGen;
+  FlatScalar<float> weight_analysisbtagsf_light_DN_flat;
+  BulkBranch *weight_analysisbtagsf_light_DN_bulk;
   float    weight_analysisbtagsf_fastsim_UP_;
   TBranch *weight_analysisbtagsf_fastsim_UP_branch;
-  bool     weight_analysisbtagsf_fastsim_UP_isLoaded;
+  unsigned long long weight_analysisbtagsf_fastsim_UP_loadedGen;
+  FlatScalar<float> weight_analysisbtagsf_fastsim_UP_flat;
+  BulkBranch *weight_analysisbtagsf_fastsim_UP_bulk;
   float    weight_analysisbtagsf_fastsim_DN_;
   TBranch *weight_analysisbtagsf_fastsim_DN_branch;
-  bool     weight_analysisbtagsf_fastsim_DN_isLoaded;
+  unsigned long long weight_analysisbtagsf_fastsim_DN_loadedGen;
+  FlatScalar<float> weight_analysisbtagsf_fastsim_DN_flat;
+  BulkBranch *weight_analysisbtagsf_fastsim_DN_bulk;
   float    weight_tightbtagsf_;
   TBranch *weight_tightbtagsf_branch;
-  bool     weight_tightbtagsf_isLoaded;
+  unsigned long long weight_tightbtagsf_loadedGen;
+  FlatScalar<float> weight_tightbtagsf_flat;
+  BulkBranch *weight_tightbtagsf_bulk;
   float    weight_tightbtagsf_heavy_UP_;
   TBranch *weight_tightbtagsf_heavy_UP_branch;
-  bool     weight_tightbtagsf_heavy_UP_isLoaded;
+  unsigned long long weight_tightbtagsf_heavy_UP_loadedGen;
+  FlatScalar<float> weight_tightbtagsf_heavy_UP_flat;
+  BulkBranch *weight_tightbtagsf_heavy_UP_bulk;
   float    weight_tightbtagsf_light_UP_;
   TBranch *weight_tightbtagsf_light_UP_branch;
-  bool     weight_tightbtagsf_light_UP_isLoaded;
+  unsigned long long weight_tightbtagsf_light_UP_loadedGen;
+  FlatScalar<float> weight_tightbtagsf_light_UP_flat;
+  BulkBranch *weight_tightbtagsf_light_UP_bulk;
   float    weight_tightbtagsf_heavy_DN_;
   TBranch *weight_tightbtagsf_heavy_DN_branch;
-  bool     weight_tightbtagsf_heavy_DN_isLoaded;
+  unsigned long long weight_tightbtagsf_heavy_DN_loadedGen;
+  FlatScalar<float> weight_tightbtagsf_heavy_DN_flat;
+  BulkBranch *weight_tightbtagsf_heavy_DN_bulk;
   float    weight_tightbtagsf_light_DN_;
   TBranch *weight_tightbtagsf_light_DN_branch;
-  bool     weight_tightbtagsf_light_DN_isLoaded;
+  unsigned long long weight_tightbtagsf_light_DN_loadedGen;
+  FlatScalar<float> weight_tightbtagsf_light_DN_flat;
+  BulkBranch *weight_tightbtagsf_light_DN_bulk;
   float    weight_tightbtagsf_fastsim_UP_;
   TBranch *weight_tightbtagsf_fastsim_UP_branch;
-  bool     weight_tightbtagsf_fastsim_UP_isLoaded;
+  unsigned long long weight_tightbtagsf_fastsim_UP_loadedGen;
+  FlatScalar<float> weight_tightbtagsf_fastsim_UP_flat;
+  BulkBranch *weight_tightbtagsf_fastsim_UP_bulk;
   float    weight_tightbtagsf_fastsim_DN_;
   TBranch *weight_tightbtagsf_fastsim_DN_branch;
-  bool     weight_tightbtagsf_fastsim_DN_isLoaded;
+  unsigned long long weight_tightbtagsf_fastsim_DN_loadedGen;
+  FlatScalar<float> weight_tightbtagsf_fastsim_DN_flat;
+  BulkBranch *weight_tightbtagsf_fastsim_DN_bulk;
   float    weight_loosebtagsf_;
   TBranch *weight_loosebtagsf_branch;
-  bool     weight_loosebtagsf_isLoaded;
+  unsigned long long weight_loosebtagsf_loadedGen;
+  FlatScalar<float> weight_loosebtagsf_flat;
+  BulkBranch *weight_loosebtagsf_bulk;
   float    weight_loosebtagsf_heavy_UP_;
   TBranch *weight_loosebtagsf_heavy_UP_branch;
-  bool     weight_loosebtagsf_heavy_UP_isLoaded;
+  unsigned long long weight_loosebtagsf_heavy_UP_loadedGen;
+  FlatScalar<float> weight_loosebtagsf_heavy_UP_flat;
+  BulkBranch *weight_loosebtagsf_heavy_UP_bulk;
   float    weight_loosebtagsf_light_UP_;
   TBranch *weight_loosebtagsf_light_UP_branch;
-  bool     weight_loosebtagsf_light_UP_isLoaded;
+  unsigned long long weight_loosebtagsf_light_UP_loadedGen;
+  FlatScalar<float> weight_loosebtagsf_light_UP_flat;
+  BulkBranch *weight_loosebtagsf_light_UP_bulk;
   float    weight_loosebtagsf_heavy_DN_;
   TBranch *weight_loosebtagsf_heavy_DN_branch;
-  bool     weight_loosebtagsf_heavy_DN_isLoaded;
+  unsigned long long weight_loosebtagsf_heavy_DN_loadedGen;
+  FlatScalar<float> weight_loosebtagsf_heavy_DN_flat;
+  BulkBranch *weight_loosebtagsf_heavy_DN_bulk;
   float    weight_loosebtagsf_light_DN_;
   TBranch *weight_loosebtagsf_light_DN_branch;
-  bool     weight_loosebtagsf_light_DN_isLoaded;
+  unsigned long long weight_loosebtagsf_light_DN_loadedGen;
+  FlatScalar<float> weight_loosebtagsf_light_DN_flat;
+  BulkBranch *weight_loosebtagsf_light_DN_bulk;
   float    weight_loosebtagsf_fastsim_UP_;
   TBranch *weight_loosebtagsf_fastsim_UP_branch;
-  bool     weight_loosebtagsf_fastsim_UP_isLoaded;
+  unsigned long long weight_loosebtagsf_fastsim_UP_loadedGen;
+  FlatScalar<float> weight_loosebtagsf_fastsim_UP_flat;
+  BulkBranch *weight_loosebtagsf_fastsim_UP_bulk;
   float    weight_loosebtagsf_fastsim_DN_;
   TBranch *weight_loosebtagsf_fastsim_DN_branch;
-  bool     weight_loosebtagsf_fastsim_DN_isLoaded;
+  unsigned long long weight_loosebtagsf_fastsim_DN_loadedGen;
+  FlatScalar<float> weight_loosebtagsf_fastsim_DN_flat;
+  BulkBranch *weight_loosebtagsf_fastsim_DN_bulk;
   float    weight_lepSF_;
   TBranch *weight_lepSF_branch;
-  bool     weight_lepSF_isLoaded;
+  unsigned long long weight_lepSF_loadedGen;
+  FlatScalar<float> weight_lepSF_flat;
+  BulkBranch *weight_lepSF_bulk;
   float    weight_lepSF_up_;
   TBranch *weight_lepSF_up_branch;
-  bool     weight_lepSF_up_isLoaded;
+  unsigned long long weight_lepSF_up_loadedGen;
+  FlatScalar<float> weight_lepSF_up_flat;
+  BulkBranch *weight_lepSF_up_bulk;
   float    weight_lepSF_down_;
   TBranch *weight_lepSF_down_branch;
-  bool     weight_lepSF_down_isLoaded;
+  unsigned long long weight_lepSF_down_loadedGen;
+  FlatScalar<float> weight_lepSF_down_flat;
+  BulkBranch *weight_lepSF_down_bulk;
   float    weight_vetoLepSF_;
   TBranch *weight_vetoLepSF_branch;
-  bool     weight_vetoLepSF_isLoaded;
+  unsigned long long weight_vetoLepSF_loadedGen;
+  FlatScalar<float> weight_vetoLepSF_flat;
+  BulkBranch *weight_vetoLepSF_bulk;
   float    weight_vetoLepSF_up_;
   TBranch *weight_vetoLepSF_up_branch;
-  bool     weight_vetoLepSF_up_isLoaded;
+  unsigned long long weight_vetoLepSF_up_loadedGen;
+  FlatScalar<float> weight_vetoLepSF_up_flat;
+  BulkBranch *weight_vetoLepSF_up_bulk;
   float    weight_vetoLepSF_down_;
   TBranch *weight_vetoLepSF_down_branch;
-  bool     weight_vetoLepSF_down_isLoaded;
+  unsigned long long weight_vetoLepSF_down_loadedGen;
+  FlatScalar<float> weight_vetoLepSF_down_flat;
+  BulkBranch *weight_vetoLepSF_down_bulk;
   float    weight_lepSF_fastSim_;
   TBranch *weight_lepSF_fastSim_branch;
-  bool     weight_lepSF_fastSim_isLoaded;
+  unsigned long long weight_lepSF_fastSim_loadedGen;
+  FlatScalar<float> weight_lepSF_fastSim_flat;
+  BulkBranch *weight_lepSF_fastSim_bulk;
   float    weight_lepSF_fastSim_up_;
   TBranch *weight_lepSF_fastSim_up_branch;
-  bool     weight_lepSF_fastSim_up_isLoaded;
+  unsigned long long weight_lepSF_fastSim_up_loadedGen;
+  FlatScalar<float> weight_lepSF_fastSim_up_flat;
+  BulkBranch *weight_lepSF_fastSim_up_bulk;
   float    weight_lepSF_fastSim_down_;
   TBranch *weight_lepSF_fastSim_down_branch;
-  bool     weight_lepSF_fastSim_down_isLoaded;
+  unsigned long long weight_lepSF_fastSim_down_loadedGen;
+  FlatScalar<float> weight_lepSF_fastSim_down_flat;
+  BulkBranch *weight_lepSF_fastSim_down_bulk;
   float    weight_ISR_;
   TBranch *weight_ISR_branch;
-  bool     weight_ISR_isLoaded;
+  unsigned long long weight_ISR_loadedGen;
+  FlatScalar<float> weight_ISR_flat;
+  BulkBranch *weight_ISR_bulk;
   float    weight_ISRup_;
   TBranch *weight_ISRup_branch;
-  bool     weight_ISRup_isLoaded;
+  unsigned long long weight_ISRup_loadedGen;
+  FlatScalar<float> weight_ISRup_flat;
+  BulkBranch *weight_ISRup_bulk;
   float    weight_ISRdown_;
   TBranch *weight_ISRdown_branch;
-  bool     weight_ISRdown_isLoaded;
+  unsigned long long weight_ISRdown_loadedGen;
+  FlatScalar<float> weight_ISRdown_flat;
+  BulkBranch *weight_ISRdown_bulk;
   float    weight_PU_;
   TBranch *weight_PU_branch;
-  bool     weight_PU_isLoaded;
+  unsigned long long weight_PU_loadedGen;
+  FlatScalar<float> weight_PU_flat;
+  BulkBranch *weight_PU_bulk;
   float    weight_PUup_;
   TBranch *weight_PUup_branch;
-  bool     weight_PUup_isLoaded;
+  unsigned long long weight_PUup_loadedGen;
+  FlatScalar<float> weight_PUup_flat;
+  BulkBranch *weight_PUup_bulk;
   float    weight_PUdown_;
   TBranch *weight_PUdown_branch;
-  bool     weight_PUdown_isLoaded;
+  unsigned long long weight_PUdown_loadedGen;
+  FlatScalar<float> weight_PUdown_flat;
+  BulkBranch *weight_PUdown_bulk;
   float    weight_ISRnjets_;
   TBranch *weight_ISRnjets_branch;
-  bool     weight_ISRnjets_isLoaded;
+  unsigned long long weight_ISRnjets_loadedGen;
+  FlatScalar<float> weight_ISRnjets_flat;
+  BulkBranch *weight_ISRnjets_bulk;
   float    weight_ISRnjets_UP_;
   TBranch *weight_ISRnjets_UP_branch;
-  bool     weight_ISRnjets_UP_isLoaded;
+  unsigned long long weight_ISRnjets_UP_loadedGen;
+  FlatScalar<float> weight_ISRnjets_UP_flat;
+  BulkBranch *weight_ISRnjets_UP_bulk;
   float    weight_ISRnjets_DN_;
   TBranch *weight_ISRnjets_DN_branch;
-  bool     weight_ISRnjets_DN_isLoaded;
+  unsigned long long weight_ISRnjets_DN_loadedGen;
+  FlatScalar<float> weight_ISRnjets_DN_flat;
+  BulkBranch *weight_ISRnjets_DN_bulk;
   float    weight_L1prefire_;
   TBranch *weight_L1prefire_branch;
-  bool     weight_L1prefire_isLoaded;
+  unsigned long long weight_L1prefire_loadedGen;
+  FlatScalar<float> weight_L1prefire_flat;
+  BulkBranch *weight_L1prefire_bulk;
   float    weight_L1prefire_UP_;
   TBranch *weight_L1prefire_UP_branch;
-  bool     weight_L1prefire_UP_isLoaded;
+  unsigned long long weight_L1prefire_UP_loadedGen;
+  FlatScalar<float> weight_L1prefire_UP_flat;
+  BulkBranch *weight_L1prefire_UP_bulk;
   float    weight_L1prefire_DN_;
   TBranch *weight_L1prefire_DN_branch;
-  bool     weight_L1prefire_DN_isLoaded;
+  unsigned long long weight_L1prefire_DN_loadedGen;
+  FlatScalar<float> weight_L1prefire_DN_flat;
+  BulkBranch *weight_L1prefire_DN_bulk;
   int      NISRjets_;
   TBranch *NISRjets_branch;
-  bool     NISRjets_isLoaded;
+  unsigned long long NISRjets_loadedGen;
+  FlatScalar<int> NISRjets_flat;
+  BulkBranch *NISRjets_bulk;
   int      NnonISRjets_;
   TBranch *NnonISRjets_branch;
-  bool     NnonISRjets_isLoaded;
+  unsigned long long NnonISRjets_loadedGen;
+  FlatScalar<int> NnonISRjets_flat;
+  BulkBranch *NnonISRjets_bulk;
   vector<string> *sparms_names_;
   TBranch *sparms_names_branch;
-  bool     sparms_names_isLoaded;
+  unsigned long long sparms_names_loadedGen;
   vector<float> *sparms_values_;
   TBranch *sparms_values_branch;
-  bool     sparms_values_isLoaded;
+  unsigned long long sparms_values_loadedGen;
+  FlatObject<vector<float> > sparms_values_flat;
   int      sparms_subProcessId_;
   TBranch *sparms_subProcessId_branch;
-  bool     sparms_subProcessId_isLoaded;
+  unsigned long long sparms_subProcessId_loadedGen;
+  FlatScalar<int> sparms_subProcessId_flat;
+  BulkBranch *sparms_subProcessId_bulk;
   float    mass_lsp_;
   TBranch *mass_lsp_branch;
-  bool     mass_lsp_isLoaded;
+  unsigned long long mass_lsp_loadedGen;
+  FlatScalar<float> mass_lsp_flat;
+  BulkBranch *mass_lsp_bulk;
   float    mass_chargino_;
   TBranch *mass_chargino_branch;
-  bool     mass_chargino_isLoaded;
+  unsigned long long mass_chargino_loadedGen;
+  FlatScalar<float> mass_chargino_flat;
+  BulkBranch *mass_chargino_bulk;
   float    mass_stop_;
   TBranch *mass_stop_branch;
-  bool     mass_stop_isLoaded;
+  unsigned long long mass_stop_loadedGen;
+  FlatScalar<float> mass_stop_flat;
+  BulkBranch *mass_stop_bulk;
   float    mass_gluino_;
   TBranch *mass_gluino_branch;
-  bool     mass_gluino_isLoaded;
+  unsigned long long mass_gluino_loadedGen;
+  FlatScalar<float> mass_gluino_flat;
+  BulkBranch *mass_gluino_bulk;
   float    genmet_;
   TBranch *genmet_branch;
-  bool     genmet_isLoaded;
+  unsigned long long genmet_loadedGen;
+  FlatScalar<float> genmet_flat;
+  BulkBranch *genmet_bulk;
   float    genmet_phi_;
   TBranch *genmet_phi_branch;
-  bool     genmet_phi_isLoaded;
+  unsigned long long genmet_phi_loadedGen;
+  FlatScalar<float> genmet_phi_flat;
+  BulkBranch *genmet_phi_bulk;
   float    nupt_;
   TBranch *nupt_branch;
-  bool     nupt_isLoaded;
+  unsigned long long nupt_loadedGen;
+  FlatScalar<float> nupt_flat;
+  BulkBranch *nupt_bulk;
   float    genht_;
   TBranch *genht_branch;
-  bool     genht_isLoaded;
+  unsigned long long genht_loadedGen;
+  FlatScalar<float> genht_flat;
+  BulkBranch *genht_bulk;
   bool     PassTrackVeto_;
   TBranch *PassTrackVeto_branch;
-  bool     PassTrackVeto_isLoaded;
+  unsigned long long PassTrackVeto_loadedGen;
+  FlatScalar<bool> PassTrackVeto_flat;
+  BulkBranch *PassTrackVeto_bulk;
   bool     PassTauVeto_;
   TBranch *PassTauVeto_branch;
-  bool     PassTauVeto_isLoaded;
+  unsigned long long PassTauVeto_loadedGen;
+  FlatScalar<bool> PassTauVeto_flat;
+  BulkBranch *PassTauVeto_bulk;
   float    topness_;
   TBranch *topness_branch;
-  bool     topness_isLoaded;
+  unsigned long long topness_loadedGen;
+  FlatScalar<float> topness_flat;
+  BulkBranch *topness_bulk;
   float    topnessMod_;
   TBranch *topnessMod_branch;
-  bool     topnessMod_isLoaded;
+  unsigned long long topnessMod_loadedGen;
+  FlatScalar<float> topnessMod_flat;
+  BulkBranch *topnessMod_bulk;
   float    topnessMod_rl_;
   TBranch *topnessMod_rl_branch;
-  bool     topnessMod_rl_isLoaded;
+  unsigned long long topnessMod_rl_loadedGen;
+  FlatScalar<float> topnessMod_rl_flat;
+  BulkBranch *topnessMod_rl_bulk;
   float    topnessMod_jup_;
   TBranch *topnessMod_jup_branch;
-  bool     topnessMod_jup_isLoaded;
+  unsigned long long topnessMod_jup_loadedGen;
+  FlatScalar<float> topnessMod_jup_flat;
+  BulkBranch *topnessMod_jup_bulk;
   float    topnessMod_rl_jup_;
   TBranch *topnessMod_rl_jup_branch;
-  bool     topnessMod_rl_jup_isLoaded;
+  unsigned long long topnessMod_rl_jup_loadedGen;
+  FlatScalar<float> topnessMod_rl_jup_flat;
+  BulkBranch *topnessMod_rl_jup_bulk;
   float    topnessMod_jdown_;
   TBranch *topnessMod_jdown_branch;
-  bool     topnessMod_jdown_isLoaded;
+  unsigned long long topnessMod_jdown_loadedGen;
+  FlatScalar<float> topnessMod_jdown_flat;
+  BulkBranch *topnessMod_jdown_bulk;
   float    topnessMod_rl_jdown_;
   TBranch *topnessMod_rl_jdown_branch;
-  bool     topnessMod_rl_jdown_isLoaded;
+  unsigned long long topnessMod_rl_jdown_loadedGen;
+  FlatScalar<float> topnessMod_rl_jdown_flat;
+  BulkBranch *topnessMod_rl_jdown_bulk;
   float    Mlb_closestb_;
   TBranch *Mlb_closestb_branch;
-  bool     Mlb_closestb_isLoaded;
+  unsigned long long Mlb_closestb_loadedGen;
+  FlatScalar<float> Mlb_closestb_flat;
+  BulkBranch *Mlb_closestb_bulk;
   float    Mlb_lead_bdiscr_;
   TBranch *Mlb_lead_bdiscr_branch;
-  bool     Mlb_lead_bdiscr_isLoaded;
+  unsigned long long Mlb_lead_bdiscr_loadedGen;
+  FlatScalar<float> Mlb_lead_bdiscr_flat;
+  BulkBranch *Mlb_lead_bdiscr_bulk;
   float    Mlb_closestb_jup_;
   TBranch *Mlb_closestb_jup_branch;
-  bool     Mlb_closestb_jup_isLoaded;
+  unsigned long long Mlb_closestb_jup_loadedGen;
+  FlatScalar<float> Mlb_closestb_jup_flat;
+  BulkBranch *Mlb_closestb_jup_bulk;
   float    Mlb_lead_bdiscr_jup_;
   TBranch *Mlb_lead_bdiscr_jup_branch;
-  bool     Mlb_lead_bdiscr_jup_isLoaded;
+  unsigned long long Mlb_lead_bdiscr_jup_loadedGen;
+  FlatScalar<float> Mlb_lead_bdiscr_jup_flat;
+  BulkBranch *Mlb_lead_bdiscr_jup_bulk;
   float    Mlb_closestb_jdown_;
   TBranch *Mlb_closestb_jdown_branch;
-  bool     Mlb_closestb_jdown_isLoaded;
+  unsigned long long Mlb_closestb_jdown_loadedGen;
+  FlatScalar<float> Mlb_closestb_jdown_flat;
+  BulkBranch *Mlb_closestb_jdown_bulk;
   float    Mlb_lead_bdiscr_jdown_;
   TBranch *Mlb_lead_bdiscr_jdown_branch;
-  bool     Mlb_lead_bdiscr_jdown_isLoaded;
+  unsigned long long Mlb_lead_bdiscr_jdown_loadedGen;
+  FlatScalar<float> Mlb_lead_bdiscr_jdown_flat;
+  BulkBranch *Mlb_lead_bdiscr_jdown_bulk;
   int      HLT_SingleEl_;
   TBranch *HLT_SingleEl_branch;
-  bool     HLT_SingleEl_isLoaded;
+  unsigned long long HLT_SingleEl_loadedGen;
+  FlatScalar<int> HLT_SingleEl_flat;
+  BulkBranch *HLT_SingleEl_bulk;
   int      HLT_SingleMu_;
   TBranch *HLT_SingleMu_branch;
-  bool     HLT_SingleMu_isLoaded;
+  unsigned long long HLT_SingleMu_loadedGen;
+  FlatScalar<int> HLT_SingleMu_flat;
+  BulkBranch *HLT_SingleMu_bulk;
   int      HLT_MET_;
   TBranch *HLT_MET_branch;
-  bool     HLT_MET_isLoaded;
+  unsigned long long HLT_MET_loadedGen;
+  FlatScalar<int> HLT_MET_flat;
+  BulkBranch *HLT_MET_bulk;
   int      HLT_MET_MHT_;
   TBranch *HLT_MET_MHT_branch;
-  bool     HLT_MET_MHT_isLoaded;
+  unsigned long long HLT_MET_MHT_loadedGen;
+  FlatScalar<int> HLT_MET_MHT_flat;
+  BulkBranch *HLT_MET_MHT_bulk;
   int      HLT_MET100_MHT100_;
   TBranch *HLT_MET100_MHT100_branch;
-  bool     HLT_MET100_MHT100_isLoaded;
+  unsigned long long HLT_MET100_MHT100_loadedGen;
+  FlatScalar<int> HLT_MET100_MHT100_flat;
+  BulkBranch *HLT_MET100_MHT100_bulk;
   int      HLT_MET110_MHT110_;
   TBranch *HLT_MET110_MHT110_branch;
-  bool     HLT_MET110_MHT110_isLoaded;
+  unsigned long long HLT_MET110_MHT110_loadedGen;
+  FlatScalar<int> HLT_MET110_MHT110_flat;
+  BulkBranch *HLT_MET110_MHT110_bulk;
   int      HLT_MET120_MHT120_;
   TBranch *HLT_MET120_MHT120_branch;
-  bool     HLT_MET120_MHT120_isLoaded;
+  unsigned long long HLT_MET120_MHT120_loadedGen;
+  FlatScalar<int> HLT_MET120_MHT120_flat;
+  BulkBranch *HLT_MET120_MHT120_bulk;
   int      HLT_MET130_MHT130_;
   TBranch *HLT_MET130_MHT130_branch;
-  bool     HLT_MET130_MHT130_isLoaded;
+  unsigned long long HLT_MET130_MHT130_loadedGen;
+  FlatScalar<int> HLT_MET130_MHT130_flat;
+  BulkBranch *HLT_MET130_MHT130_bulk;
   int      HLT_PFHT_unprescaled_;
   TBranch *HLT_PFHT_unprescaled_branch;
-  bool     HLT_PFHT_unprescaled_isLoaded;
+  unsigned long long HLT_PFHT_unprescaled_loadedGen;
+  FlatScalar<int> HLT_PFHT_unprescaled_flat;
+  BulkBranch *HLT_PFHT_unprescaled_bulk;
   int      HLT_PFHT_prescaled_;
   TBranch *HLT_PFHT_prescaled_branch;
-  bool     HLT_PFHT_prescaled_isLoaded;
+  unsigned long long HLT_PFHT_prescaled_loadedGen;
+  FlatScalar<int> HLT_PFHT_prescaled_flat;
+  BulkBranch *HLT_PFHT_prescaled_bulk;
   int      HLT_AK8Jet_unprescaled_;
   TBranch *HLT_AK8Jet_unprescaled_branch;
-  bool     HLT_AK8Jet_unprescaled_isLoaded;
+  unsigned long long HLT_AK8Jet_unprescaled_loadedGen;
+  FlatScalar<int> HLT_AK8Jet_unprescaled_flat;
+  BulkBranch *HLT_AK8Jet_unprescaled_bulk;
   int      HLT_AK8Jet_prescaled_;
   TBranch *HLT_AK8Jet_prescaled_branch;
-  bool     HLT_AK8Jet_prescaled_isLoaded;
+  unsigned long long HLT_AK8Jet_prescaled_loadedGen;
+  FlatScalar<int> HLT_AK8Jet_prescaled_flat;
+  BulkBranch *HLT_AK8Jet_prescaled_bulk;
   int      HLT_CaloJet500_NoJetID_;
   TBranch *HLT_CaloJet500_NoJetID_branch;
-  bool     HLT_CaloJet500_NoJetID_isLoaded;
+  unsigned long long HLT_CaloJet500_NoJetID_loadedGen;
+  FlatScalar<int> HLT_CaloJet500_NoJetID_flat;
+  BulkBranch *HLT_CaloJet500_NoJetID_bulk;
   int      HLT_DiEl_;
   TBranch *HLT_DiEl_branch;
-  bool     HLT_DiEl_isLoaded;
+  unsigned long long HLT_DiEl_loadedGen;
+  FlatScalar<int> HLT_DiEl_flat;
+  BulkBranch *HLT_DiEl_bulk;
   int      HLT_DiMu_;
   TBranch *HLT_DiMu_branch;
-  bool     HLT_DiMu_isLoaded;
+  unsigned long long HLT_DiMu_loadedGen;
+  FlatScalar<int> HLT_DiMu_flat;
+  BulkBranch *HLT_DiMu_bulk;
   int      HLT_MuE_;
   TBranch *HLT_MuE_branch;
-  bool     HLT_MuE_isLoaded;
+  unsigned long long HLT_MuE_loadedGen;
+  FlatScalar<int> HLT_MuE_flat;
+  BulkBranch *HLT_MuE_bulk;
   int      nPhotons_;
   TBranch *nPhotons_branch;
-  bool     nPhotons_isLoaded;
+  unsigned long long nPhotons_loadedGen;
+  FlatScalar<int> nPhotons_flat;
+  BulkBranch *nPhotons_bulk;
   int      ph_ngoodjets_;
   TBranch *ph_ngoodjets_branch;
-  bool     ph_ngoodjets_isLoaded;
+  unsigned long long ph_ngoodjets_loadedGen;
+  FlatScalar<int> ph_ngoodjets_flat;
+  BulkBranch *ph_ngoodjets_bulk;
   int      ph_ngoodbtags_;
   TBranch *ph_ngoodbtags_branch;
-  bool     ph_ngoodbtags_isLoaded;
+  unsigned long long ph_ngoodbtags_loadedGen;
+  FlatScalar<int> ph_ngoodbtags_flat;
+  BulkBranch *ph_ngoodbtags_bulk;
   float    hardgenpt_;
   TBranch *hardgenpt_branch;
-  bool     hardgenpt_isLoaded;
+  unsigned long long hardgenpt_loadedGen;
+  FlatScalar<float> hardgenpt_flat;
+  BulkBranch *hardgenpt_bulk;
   float    calomet_;
   TBranch *calomet_branch;
-  bool     calomet_isLoaded;
+  unsigned long long calomet_loadedGen;
+  FlatScalar<float> calomet_flat;
+  BulkBranch *calomet_bulk;
   float    calomet_phi_;
   TBranch *calomet_phi_branch;
-  bool     calomet_phi_isLoaded;
+  unsigned long long calomet_phi_loadedGen;
+  FlatScalar<float> calomet_phi_flat;
+  BulkBranch *calomet_phi_bulk;
   int      lep1_pdgid_;
   TBranch *lep1_pdgid_branch;
-  bool     lep1_pdgid_isLoaded;
+  unsigned long long lep1_pdgid_loadedGen;
+  FlatScalar<int> lep1_pdgid_flat;
+  BulkBranch *lep1_pdgid_bulk;
   int      lep1_production_type_;
   TBranch *lep1_production_type_branch;
-  bool     lep1_production_type_isLoaded;
+  unsigned long long lep1_production_type_loadedGen;
+  FlatScalar<int> lep1_production_type_flat;
+  BulkBranch *lep1_production_type_bulk;
   float    lep1_MiniIso_;
   TBranch *lep1_MiniIso_branch;
-  bool     lep1_MiniIso_isLoaded;
+  unsigned long long lep1_MiniIso_loadedGen;
+  FlatScalar<float> lep1_MiniIso_flat;
+  BulkBranch *lep1_MiniIso_bulk;
   float    lep1_relIso_;
   TBranch *lep1_relIso_branch;
-  bool     lep1_relIso_isLoaded;
+  unsigned long long lep1_relIso_loadedGen;
+  FlatScalar<float> lep1_relIso_flat;
+  BulkBranch *lep1_relIso_bulk;
   bool     lep1_passLooseID_;
   TBranch *lep1_passLooseID_branch;
-  bool     lep1_passLooseID_isLoaded;
+  unsigned long long lep1_passLooseID_loadedGen;
+  FlatScalar<bool> lep1_passLooseID_flat;
+  BulkBranch *lep1_passLooseID_bulk;
   bool     lep1_passMediumID_;
   TBranch *lep1_passMediumID_branch;
-  bool     lep1_passMediumID_isLoaded;
+  unsigned long long lep1_passMediumID_loadedGen;
+  FlatScalar<bool> lep1_passMediumID_flat;
+  BulkBranch *lep1_passMediumID_bulk;
   bool     lep1_passTightID_;
   TBranch *lep1_passTightID_branch;
-  bool     lep1_passTightID_isLoaded;
+  unsigned long long lep1_passTightID_loadedGen;
+  FlatScalar<bool> lep1_passTightID_flat;
+  BulkBranch *lep1_passTightID_bulk;
   bool     lep1_passVeto_;
   TBranch *lep1_passVeto_branch;
-  bool     lep1_passVeto_isLoaded;
+  unsigned long long lep1_passVeto_loadedGen;
+  FlatScalar<bool> lep1_passVeto_flat;
+  BulkBranch *lep1_passVeto_bulk;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *lep1_p4_;
   TBranch *lep1_p4_branch;
-  bool     lep1_p4_isLoaded;
+  unsigned long long lep1_p4_loadedGen;
+  FlatObject<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > lep1_p4_flat;
+  PolarP4 lep1_p4_polar_;
+  unsigned long long lep1_p4_polarGen;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *lep1_mcp4_;
   TBranch *lep1_mcp4_branch;
-  bool     lep1_mcp4_isLoaded;
+  unsigned long long lep1_mcp4_loadedGen;
+  FlatObject<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > lep1_mcp4_flat;
+  PolarP4 lep1_mcp4_polar_;
+  unsigned long long lep1_mcp4_polarGen;
   int      lep1_mc_motherid_;
   TBranch *lep1_mc_motherid_branch;
-  bool     lep1_mc_motherid_isLoaded;
+  unsigned long long lep1_mc_motherid_loadedGen;
+  FlatScalar<int> lep1_mc_motherid_flat;
+  BulkBranch *lep1_mc_motherid_bulk;
   float    lep1_etaSC_;
   TBranch *lep1_etaSC_branch;
-  bool     lep1_etaSC_isLoaded;
+  unsigned long long lep1_etaSC_loadedGen;
+  FlatScalar<float> lep1_etaSC_flat;
+  BulkBranch *lep1_etaSC_bulk;
   float    lep1_dphiMET_;
   TBranch *lep1_dphiMET_branch;
-  bool     lep1_dphiMET_isLoaded;
+  unsigned long long lep1_dphiMET_loadedGen;
+  FlatScalar<float> lep1_dphiMET_flat;
+  BulkBranch *lep1_dphiMET_bulk;
   float    lep1_dphiMET_jup_;
   TBranch *lep1_dphiMET_jup_branch;
-  bool     lep1_dphiMET_jup_isLoaded;
+  unsigned long long lep1_dphiMET_jup_loadedGen;
+  FlatScalar<float> lep1_dphiMET_jup_flat;
+  BulkBranch *lep1_dphiMET_jup_bulk;
   float    lep1_dphiMET_jdown_;
   TBranch *lep1_dphiMET_jdown_branch;
-  bool     lep1_dphiMET_jdown_isLoaded;
+  unsigned long long lep1_dphiMET_jdown_loadedGen;
+  FlatScalar<float> lep1_dphiMET_jdown_flat;
+  BulkBranch *lep1_dphiMET_jdown_bulk;
   float    lep1_dphiMET_rl_;
   TBranch *lep1_dphiMET_rl_branch;
-  bool     lep1_dphiMET_rl_isLoaded;
+  unsigned long long lep1_dphiMET_rl_loadedGen;
+  FlatScalar<float> lep1_dphiMET_rl_flat;
+  BulkBranch *lep1_dphiMET_rl_bulk;
   float    lep1_dphiMET_rl_jup_;
   TBranch *lep1_dphiMET_rl_jup_branch;
-  bool     lep1_dphiMET_rl_jup_isLoaded;
+  unsigned long long lep1_dphiMET_rl_jup_loadedGen;
+  FlatScalar<float> lep1_dphiMET_rl_jup_flat;
+  BulkBranch *lep1_dphiMET_rl_jup_bulk;
   float    lep1_dphiMET_rl_jdown_;
   TBranch *lep1_dphiMET_rl_jdown_branch;
-  bool     lep1_dphiMET_rl_jdown_isLoaded;
+  unsigned long long lep1_dphiMET_rl_jdown_loadedGen;
+  FlatScalar<float> lep1_dphiMET_rl_jdown_flat;
+  BulkBranch *lep1_dphiMET_rl_jdown_bulk;
   int      lep2_pdgid_;
   TBranch *lep2_pdgid_branch;
-  bool     lep2_pdgid_isLoaded;
+  unsigned long long lep2_pdgid_loadedGen;
+  FlatScalar<int> lep2_pdgid_flat;
+  BulkBranch *lep2_pdgid_bulk;
   int      lep2_production_type_;
   TBranch *lep2_production_type_branch;
-  bool     lep2_production_type_isLoaded;
+  unsigned long long lep2_production_type_loadedGen;
+  FlatScalar<int> lep2_production_type_flat;
+  BulkBranch *lep2_production_type_bulk;
   float    lep2_MiniIso_;
   TBranch *lep2_MiniIso_branch;
-  bool     lep2_MiniIso_isLoaded;
+  unsigned long long lep2_MiniIso_loadedGen;
+  FlatScalar<float> lep2_MiniIso_flat;
+  BulkBranch *lep2_MiniIso_bulk;
   float    lep2_relIso_;
   TBranch *lep2_relIso_branch;
-  bool     lep2_relIso_isLoaded;
+  unsigned long long lep2_relIso_loadedGen;
+  FlatScalar<float> lep2_relIso_flat;
+  BulkBranch *lep2_relIso_bulk;
   bool     lep2_passLooseID_;
   TBranch *lep2_passLooseID_branch;
-  bool     lep2_passLooseID_isLoaded;
+  unsigned long long lep2_passLooseID_loadedGen;
+  FlatScalar<bool> lep2_passLooseID_flat;
+  BulkBranch *lep2_passLooseID_bulk;
   bool     lep2_passMediumID_;
   TBranch *lep2_passMediumID_branch;
-  bool     lep2_passMediumID_isLoaded;
+  unsigned long long lep2_passMediumID_loadedGen;
+  FlatScalar<bool> lep2_passMediumID_flat;
+  BulkBranch *lep2_passMediumID_bulk;
   bool     lep2_passTightID_;
   TBranch *lep2_passTightID_branch;
-  bool     lep2_passTightID_isLoaded;
+  unsigned long long lep2_passTightID_loadedGen;
+  FlatScalar<bool> lep2_passTightID_flat;
+  BulkBranch *lep2_passTightID_bulk;
   bool     lep2_passVeto_;
   TBranch *lep2_passVeto_branch;
-  bool     lep2_passVeto_isLoaded;
+  unsigned long long lep2_passVeto_loadedGen;
+  FlatScalar<bool> lep2_passVeto_flat;
+  BulkBranch *lep2_passVeto_bulk;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *lep2_p4_;
   TBranch *lep2_p4_branch;
-  bool     lep2_p4_isLoaded;
+  unsigned long long lep2_p4_loadedGen;
+  FlatObject<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > lep2_p4_flat;
+  PolarP4 lep2_p4_polar_;
+  unsigned long long lep2_p4_polarGen;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *lep2_mcp4_;
   TBranch *lep2_mcp4_branch;
-  bool     lep2_mcp4_isLoaded;
+  unsigned long long lep2_mcp4_loadedGen;
+  FlatObject<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > lep2_mcp4_flat;
+  PolarP4 lep2_mcp4_polar_;
+  unsigned long long lep2_mcp4_polarGen;
   int      lep2_mc_motherid_;
   TBranch *lep2_mc_motherid_branch;
-  bool     lep2_mc_motherid_isLoaded;
+  unsigned long long lep2_mc_motherid_loadedGen;
+  FlatScalar<int> lep2_mc_motherid_flat;
+  BulkBranch *lep2_mc_motherid_bulk;
   float    lep2_etaSC_;
   TBranch *lep2_etaSC_branch;
-  bool     lep2_etaSC_isLoaded;
+  unsigned long long lep2_etaSC_loadedGen;
+  FlatScalar<float> lep2_etaSC_flat;
+  BulkBranch *lep2_etaSC_bulk;
   float    lep2_dphiMET_;
   TBranch *lep2_dphiMET_branch;
-  bool     lep2_dphiMET_isLoaded;
+  unsigned long long lep2_dphiMET_loadedGen;
+  FlatScalar<float> lep2_dphiMET_flat;
+  BulkBranch *lep2_dphiMET_bulk;
   float    lep2_dphiMET_jup_;
   TBranch *lep2_dphiMET_jup_branch;
-  bool     lep2_dphiMET_jup_isLoaded;
+  unsigned long long lep2_dphiMET_jup_loadedGen;
+  FlatScalar<float> lep2_dphiMET_jup_flat;
+  BulkBranch *lep2_dphiMET_jup_bulk;
   float    lep2_dphiMET_jdown_;
   TBranch *lep2_dphiMET_jdown_branch;
-  bool     lep2_dphiMET_jdown_isLoaded;
+  unsigned long long lep2_dphiMET_jdown_loadedGen;
+  FlatScalar<float> lep2_dphiMET_jdown_flat;
+  BulkBranch *lep2_dphiMET_jdown_bulk;
   float    lep2_dphiMET_rl_;
   TBranch *lep2_dphiMET_rl_branch;
-  bool     lep2_dphiMET_rl_isLoaded;
+  unsigned long long lep2_dphiMET_rl_loadedGen;
+  FlatScalar<float> lep2_dphiMET_rl_flat;
+  BulkBranch *lep2_dphiMET_rl_bulk;
   float    lep2_dphiMET_rl_jup_;
   TBranch *lep2_dphiMET_rl_jup_branch;
-  bool     lep2_dphiMET_rl_jup_isLoaded;
+  unsigned long long lep2_dphiMET_rl_jup_loadedGen;
+  FlatScalar<float> lep2_dphiMET_rl_jup_flat;
+  BulkBranch *lep2_dphiMET_rl_jup_bulk;
   float    lep2_dphiMET_rl_jdown_;
   TBranch *lep2_dphiMET_rl_jdown_branch;
-  bool     lep2_dphiMET_rl_jdown_isLoaded;
+  unsigned long long lep2_dphiMET_rl_jdown_loadedGen;
+  FlatScalar<float> lep2_dphiMET_rl_jdown_flat;
+  BulkBranch *lep2_dphiMET_rl_jdown_bulk;
   vector<float> *ph_sigmaIEtaEta_fill5x5_;
   TBranch *ph_sigmaIEtaEta_fill5x5_branch;
-  bool     ph_sigmaIEtaEta_fill5x5_isLoaded;
+  unsigned long long ph_sigmaIEtaEta_fill5x5_loadedGen;
+  FlatObject<vector<float> > ph_sigmaIEtaEta_fill5x5_flat;
   vector<float> *ph_hOverE_;
   TBranch *ph_hOverE_branch;
-  bool     ph_hOverE_isLoaded;
+  unsigned long long ph_hOverE_loadedGen;
+  FlatObject<vector<float> > ph_hOverE_flat;
   vector<float> *ph_r9_;
   TBranch *ph_r9_branch;
-  bool     ph_r9_isLoaded;
+  unsigned long long ph_r9_loadedGen;
+  FlatObject<vector<float> > ph_r9_flat;
   vector<float> *ph_chiso_;
   TBranch *ph_chiso_branch;
-  bool     ph_chiso_isLoaded;
+  unsigned long long ph_chiso_loadedGen;
+  FlatObject<vector<float> > ph_chiso_flat;
   vector<float> *ph_nhiso_;
   TBranch *ph_nhiso_branch;
-  bool     ph_nhiso_isLoaded;
+  unsigned long long ph_nhiso_loadedGen;
+  FlatObject<vector<float> > ph_nhiso_flat;
   vector<float> *ph_phiso_;
   TBranch *ph_phiso_branch;
-  bool     ph_phiso_isLoaded;
+  unsigned long long ph_phiso_loadedGen;
+  FlatObject<vector<float> > ph_phiso_flat;
   vector<bool> *ph_passLooseID_;
   TBranch *ph_passLooseID_branch;
-  bool     ph_passLooseID_isLoaded;
+  unsigned long long ph_passLooseID_loadedGen;
+  FlatObject<vector<bool> > ph_passLooseID_flat;
   vector<bool> *ph_passMediumID_;
   TBranch *ph_passMediumID_branch;
-  bool     ph_passMediumID_isLoaded;
+  unsigned long long ph_passMediumID_loadedGen;
+  FlatObject<vector<bool> > ph_passMediumID_flat;
   vector<bool> *ph_passTightID_;
   TBranch *ph_passTightID_branch;
-  bool     ph_passTightID_isLoaded;
+  unsigned long long ph_passTightID_loadedGen;
+  FlatObject<vector<bool> > ph_passTightID_flat;
   vector<int> *ph_overlapJetId_;
   TBranch *ph_overlapJetId_branch;
-  bool     ph_overlapJetId_isLoaded;
+  unsigned long long ph_overlapJetId_loadedGen;
+  FlatObject<vector<int> > ph_overlapJetId_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *ph_p4_;
   TBranch *ph_p4_branch;
-  bool     ph_p4_isLoaded;
+  unsigned long long ph_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > ph_p4_flat;
+  PolarArrays ph_p4_polar_;
+  unsigned long long ph_p4_polarGen;
+  SplitP4Reader ph_p4_split;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *ph_mcp4_;
   TBranch *ph_mcp4_branch;
-  bool     ph_mcp4_isLoaded;
+  unsigned long long ph_mcp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > ph_mcp4_flat;
+  PolarArrays ph_mcp4_polar_;
+  unsigned long long ph_mcp4_polarGen;
+  SplitP4Reader ph_mcp4_split;
   vector<int> *ph_mcMatchId_;
   TBranch *ph_mcMatchId_branch;
-  bool     ph_mcMatchId_isLoaded;
+  unsigned long long ph_mcMatchId_loadedGen;
+  FlatObject<vector<int> > ph_mcMatchId_flat;
   vector<float> *ph_genIso04_;
   TBranch *ph_genIso04_branch;
-  bool     ph_genIso04_isLoaded;
+  unsigned long long ph_genIso04_loadedGen;
+  FlatObject<vector<float> > ph_genIso04_flat;
   vector<float> *ph_drMinParton_;
   TBranch *ph_drMinParton_branch;
-  bool     ph_drMinParton_isLoaded;
+  unsigned long long ph_drMinParton_loadedGen;
+  FlatObject<vector<float> > ph_drMinParton_flat;
   int      nskimjets_;
   TBranch *nskimjets_branch;
-  bool     nskimjets_isLoaded;
+  unsigned long long nskimjets_loadedGen;
+  FlatScalar<int> nskimjets_flat;
+  BulkBranch *nskimjets_bulk;
   int      nskimbtagmed_;
   TBranch *nskimbtagmed_branch;
-  bool     nskimbtagmed_isLoaded;
+  unsigned long long nskimbtagmed_loadedGen;
+  FlatScalar<int> nskimbtagmed_flat;
+  BulkBranch *nskimbtagmed_bulk;
   int      nskimbtagloose_;
   TBranch *nskimbtagloose_branch;
-  bool     nskimbtagloose_isLoaded;
+  unsigned long long nskimbtagloose_loadedGen;
+  FlatScalar<int> nskimbtagloose_flat;
+  BulkBranch *nskimbtagloose_bulk;
   int      nskimbtagtight_;
   TBranch *nskimbtagtight_branch;
-  bool     nskimbtagtight_isLoaded;
+  unsigned long long nskimbtagtight_loadedGen;
+  FlatScalar<int> nskimbtagtight_flat;
+  BulkBranch *nskimbtagtight_bulk;
   int      ngoodjets_;
   TBranch *ngoodjets_branch;
-  bool     ngoodjets_isLoaded;
+  unsigned long long ngoodjets_loadedGen;
+  FlatScalar<int> ngoodjets_flat;
+  BulkBranch *ngoodjets_bulk;
   int      ngoodbtags_;
   TBranch *ngoodbtags_branch;
-  bool     ngoodbtags_isLoaded;
+  unsigned long long ngoodbtags_loadedGen;
+  FlatScalar<int> ngoodbtags_flat;
+  BulkBranch *ngoodbtags_bulk;
   int      nloosebtags_;
   TBranch *nloosebtags_branch;
-  bool     nloosebtags_isLoaded;
+  unsigned long long nloosebtags_loadedGen;
+  FlatScalar<int> nloosebtags_flat;
+  BulkBranch *nloosebtags_bulk;
   int      ntightbtags_;
   TBranch *ntightbtags_branch;
-  bool     ntightbtags_isLoaded;
+  unsigned long long ntightbtags_loadedGen;
+  FlatScalar<int> ntightbtags_flat;
+  BulkBranch *ntightbtags_bulk;
   int      nanalysisbtags_;
   TBranch *nanalysisbtags_branch;
-  bool     nanalysisbtags_isLoaded;
+  unsigned long long nanalysisbtags_loadedGen;
+  FlatScalar<int> nanalysisbtags_flat;
+  BulkBranch *nanalysisbtags_bulk;
   float    ak4_HT_;
   TBranch *ak4_HT_branch;
-  bool     ak4_HT_isLoaded;
+  unsigned long long ak4_HT_loadedGen;
+  FlatScalar<float> ak4_HT_flat;
+  BulkBranch *ak4_HT_bulk;
   float    ak4_htratiom_;
   TBranch *ak4_htratiom_branch;
-  bool     ak4_htratiom_isLoaded;
+  unsigned long long ak4_htratiom_loadedGen;
+  FlatScalar<float> ak4_htratiom_flat;
+  BulkBranch *ak4_htratiom_bulk;
   vector<float> *dphi_ak4pfjet_met_;
   TBranch *dphi_ak4pfjet_met_branch;
-  bool     dphi_ak4pfjet_met_isLoaded;
+  unsigned long long dphi_ak4pfjet_met_loadedGen;
+  FlatObject<vector<float> > dphi_ak4pfjet_met_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *ak4pfjets_p4_;
   TBranch *ak4pfjets_p4_branch;
-  bool     ak4pfjets_p4_isLoaded;
+  unsigned long long ak4pfjets_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > ak4pfjets_p4_flat;
+  PolarArrays ak4pfjets_p4_polar_;
+  unsigned long long ak4pfjets_p4_polarGen;
+  SplitP4Reader ak4pfjets_p4_split;
   vector<bool> *ak4pfjets_passMEDbtag_;
   TBranch *ak4pfjets_passMEDbtag_branch;
-  bool     ak4pfjets_passMEDbtag_isLoaded;
+  unsigned long long ak4pfjets_passMEDbtag_loadedGen;
+  FlatObject<vector<bool> > ak4pfjets_passMEDbtag_flat;
   vector<float> *ak4pfjets_deepCSV_;
   TBranch *ak4pfjets_deepCSV_branch;
-  bool     ak4pfjets_deepCSV_isLoaded;
+  unsigned long long ak4pfjets_deepCSV_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_deepCSV_flat;
   vector<float> *ak4pfjets_CSV_;
   TBranch *ak4pfjets_CSV_branch;
-  bool     ak4pfjets_CSV_isLoaded;
+  unsigned long long ak4pfjets_CSV_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_CSV_flat;
   vector<float> *ak4pfjets_mva_;
   TBranch *ak4pfjets_mva_branch;
-  bool     ak4pfjets_mva_isLoaded;
+  unsigned long long ak4pfjets_mva_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_mva_flat;
   vector<int> *ak4pfjets_parton_flavor_;
   TBranch *ak4pfjets_parton_flavor_branch;
-  bool     ak4pfjets_parton_flavor_isLoaded;
+  unsigned long long ak4pfjets_parton_flavor_loadedGen;
+  FlatObject<vector<int> > ak4pfjets_parton_flavor_flat;
   vector<int> *ak4pfjets_hadron_flavor_;
   TBranch *ak4pfjets_hadron_flavor_branch;
-  bool     ak4pfjets_hadron_flavor_isLoaded;
+  unsigned long long ak4pfjets_hadron_flavor_loadedGen;
+  FlatObject<vector<int> > ak4pfjets_hadron_flavor_flat;
   vector<bool> *ak4pfjets_loose_puid_;
   TBranch *ak4pfjets_loose_puid_branch;
-  bool     ak4pfjets_loose_puid_isLoaded;
+  unsigned long long ak4pfjets_loose_puid_loadedGen;
+  FlatObject<vector<bool> > ak4pfjets_loose_puid_flat;
   vector<bool> *ak4pfjets_loose_pfid_;
   TBranch *ak4pfjets_loose_pfid_branch;
-  bool     ak4pfjets_loose_pfid_isLoaded;
+  unsigned long long ak4pfjets_loose_pfid_loadedGen;
+  FlatObject<vector<bool> > ak4pfjets_loose_pfid_flat;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *ak4pfjets_leadMEDbjet_p4_;
   TBranch *ak4pfjets_leadMEDbjet_p4_branch;
-  bool     ak4pfjets_leadMEDbjet_p4_isLoaded;
+  unsigned long long ak4pfjets_leadMEDbjet_p4_loadedGen;
+  FlatObject<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > ak4pfjets_leadMEDbjet_p4_flat;
+  PolarP4 ak4pfjets_leadMEDbjet_p4_polar_;
+  unsigned long long ak4pfjets_leadMEDbjet_p4_polarGen;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *ak4pfjets_leadbtag_p4_;
   TBranch *ak4pfjets_leadbtag_p4_branch;
-  bool     ak4pfjets_leadbtag_p4_isLoaded;
+  unsigned long long ak4pfjets_leadbtag_p4_loadedGen;
+  FlatObject<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > ak4pfjets_leadbtag_p4_flat;
+  PolarP4 ak4pfjets_leadbtag_p4_polar_;
+  unsigned long long ak4pfjets_leadbtag_p4_polarGen;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *ak4genjets_p4_;
   TBranch *ak4genjets_p4_branch;
-  bool     ak4genjets_p4_isLoaded;
+  unsigned long long ak4genjets_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > ak4genjets_p4_flat;
+  PolarArrays ak4genjets_p4_polar_;
+  unsigned long long ak4genjets_p4_polarGen;
+  SplitP4Reader ak4genjets_p4_split;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *softtags_p4_;
   TBranch *softtags_p4_branch;
-  bool     softtags_p4_isLoaded;
+  unsigned long long softtags_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > softtags_p4_flat;
+  PolarArrays softtags_p4_polar_;
+  unsigned long long softtags_p4_polarGen;
+  SplitP4Reader softtags_p4_split;
   int      nsoftbtags_;
   TBranch *nsoftbtags_branch;
-  bool     nsoftbtags_isLoaded;
+  unsigned long long nsoftbtags_loadedGen;
+  FlatScalar<int> nsoftbtags_flat;
+  BulkBranch *nsoftbtags_bulk;
   int      jup_nskimjets_;
   TBranch *jup_nskimjets_branch;
-  bool     jup_nskimjets_isLoaded;
+  unsigned long long jup_nskimjets_loadedGen;
+  FlatScalar<int> jup_nskimjets_flat;
+  BulkBranch *jup_nskimjets_bulk;
   int      jup_nskimbtagmed_;
   TBranch *jup_nskimbtagmed_branch;
-  bool     jup_nskimbtagmed_isLoaded;
+  unsigned long long jup_nskimbtagmed_loadedGen;
+  FlatScalar<int> jup_nskimbtagmed_flat;
+  BulkBranch *jup_nskimbtagmed_bulk;
   int      jup_nskimbtagloose_;
   TBranch *jup_nskimbtagloose_branch;
-  bool     jup_nskimbtagloose_isLoaded;
+  unsigned long long jup_nskimbtagloose_loadedGen;
+  FlatScalar<int> jup_nskimbtagloose_flat;
+  BulkBranch *jup_nskimbtagloose_bulk;
   int      jup_nskimbtagtight_;
   TBranch *jup_nskimbtagtight_branch;
-  bool     jup_nskimbtagtight_isLoaded;
+  unsigned long long jup_nskimbtagtight_loadedGen;
+  FlatScalar<int> jup_nskimbtagtight_flat;
+  BulkBranch *jup_nskimbtagtight_bulk;
   int      jup_ngoodjets_;
   TBranch *jup_ngoodjets_branch;
-  bool     jup_ngoodjets_isLoaded;
+  unsigned long long jup_ngoodjets_loadedGen;
+  FlatScalar<int> jup_ngoodjets_flat;
+  BulkBranch *jup_ngoodjets_bulk;
   int      jup_ngoodbtags_;
   TBranch *jup_ngoodbtags_branch;
-  bool     jup_ngoodbtags_isLoaded;
+  unsigned long long jup_ngoodbtags_loadedGen;
+  FlatScalar<int> jup_ngoodbtags_flat;
+  BulkBranch *jup_ngoodbtags_bulk;
   int      jup_nloosebtags_;
   TBranch *jup_nloosebtags_branch;
-  bool     jup_nloosebtags_isLoaded;
+  unsigned long long jup_nloosebtags_loadedGen;
+  FlatScalar<int> jup_nloosebtags_flat;
+  BulkBranch *jup_nloosebtags_bulk;
   int      jup_ntightbtags_;
   TBranch *jup_ntightbtags_branch;
-  bool     jup_ntightbtags_isLoaded;
+  unsigned long long jup_ntightbtags_loadedGen;
+  FlatScalar<int> jup_ntightbtags_flat;
+  BulkBranch *jup_ntightbtags_bulk;
   int      jup_nanalysisbtags_;
   TBranch *jup_nanalysisbtags_branch;
-  bool     jup_nanalysisbtags_isLoaded;
+  unsigned long long jup_nanalysisbtags_loadedGen;
+  FlatScalar<int> jup_nanalysisbtags_flat;
+  BulkBranch *jup_nanalysisbtags_bulk;
   float    jup_ak4_HT_;
   TBranch *jup_ak4_HT_branch;
-  bool     jup_ak4_HT_isLoaded;
+  unsigned long long jup_ak4_HT_loadedGen;
+  FlatScalar<float> jup_ak4_HT_flat;
+  BulkBranch *jup_ak4_HT_bulk;
   float    jup_ak4_htratiom_;
   TBranch *jup_ak4_htratiom_branch;
-  bool     jup_ak4_htratiom_isLoaded;
+  unsigned long long jup_ak4_htratiom_loadedGen;
+  FlatScalar<float> jup_ak4_htratiom_flat;
+  BulkBranch *jup_ak4_htratiom_bulk;
   vector<float> *jup_dphi_ak4pfjet_met_;
   TBranch *jup_dphi_ak4pfjet_met_branch;
-  bool     jup_dphi_ak4pfjet_met_isLoaded;
+  unsigned long long jup_dphi_ak4pfjet_met_loadedGen;
+  FlatObject<vector<float> > jup_dphi_ak4pfjet_met_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jup_ak4pfjets_p4_;
   TBranch *jup_ak4pfjets_p4_branch;
-  bool     jup_ak4pfjets_p4_isLoaded;
+  unsigned long long jup_ak4pfjets_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jup_ak4pfjets_p4_flat;
+  PolarArrays jup_ak4pfjets_p4_polar_;
+  unsigned long long jup_ak4pfjets_p4_polarGen;
+  SplitP4Reader jup_ak4pfjets_p4_split;
   vector<bool> *jup_ak4pfjets_passMEDbtag_;
   TBranch *jup_ak4pfjets_passMEDbtag_branch;
-  bool     jup_ak4pfjets_passMEDbtag_isLoaded;
+  unsigned long long jup_ak4pfjets_passMEDbtag_loadedGen;
+  FlatObject<vector<bool> > jup_ak4pfjets_passMEDbtag_flat;
   vector<float> *jup_ak4pfjets_deepCSV_;
   TBranch *jup_ak4pfjets_deepCSV_branch;
-  bool     jup_ak4pfjets_deepCSV_isLoaded;
+  unsigned long long jup_ak4pfjets_deepCSV_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_deepCSV_flat;
   vector<float> *jup_ak4pfjets_CSV_;
   TBranch *jup_ak4pfjets_CSV_branch;
-  bool     jup_ak4pfjets_CSV_isLoaded;
+  unsigned long long jup_ak4pfjets_CSV_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_CSV_flat;
   vector<float> *jup_ak4pfjets_mva_;
   TBranch *jup_ak4pfjets_mva_branch;
-  bool     jup_ak4pfjets_mva_isLoaded;
+  unsigned long long jup_ak4pfjets_mva_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_mva_flat;
   vector<int> *jup_ak4pfjets_parton_flavor_;
   TBranch *jup_ak4pfjets_parton_flavor_branch;
-  bool     jup_ak4pfjets_parton_flavor_isLoaded;
+  unsigned long long jup_ak4pfjets_parton_flavor_loadedGen;
+  FlatObject<vector<int> > jup_ak4pfjets_parton_flavor_flat;
   vector<int> *jup_ak4pfjets_hadron_flavor_;
   TBranch *jup_ak4pfjets_hadron_flavor_branch;
-  bool     jup_ak4pfjets_hadron_flavor_isLoaded;
+  unsigned long long jup_ak4pfjets_hadron_flavor_loadedGen;
+  FlatObject<vector<int> > jup_ak4pfjets_hadron_flavor_flat;
   vector<bool> *jup_ak4pfjets_loose_puid_;
   TBranch *jup_ak4pfjets_loose_puid_branch;
-  bool     jup_ak4pfjets_loose_puid_isLoaded;
+  unsigned long long jup_ak4pfjets_loose_puid_loadedGen;
+  FlatObject<vector<bool> > jup_ak4pfjets_loose_puid_flat;
   vector<bool> *jup_ak4pfjets_loose_pfid_;
   TBranch *jup_ak4pfjets_loose_pfid_branch;
-  bool     jup_ak4pfjets_loose_pfid_isLoaded;
+  unsigned long long jup_ak4pfjets_loose_pfid_loadedGen;
+  FlatObject<vector<bool> > jup_ak4pfjets_loose_pfid_flat;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jup_ak4pfjets_leadMEDbjet_p4_;
   TBranch *jup_ak4pfjets_leadMEDbjet_p4_branch;
-  bool     jup_ak4pfjets_leadMEDbjet_p4_isLoaded;
+  unsigned long long jup_ak4pfjets_leadMEDbjet_p4_loadedGen;
+  FlatObject<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > jup_ak4pfjets_leadMEDbjet_p4_flat;
+  PolarP4 jup_ak4pfjets_leadMEDbjet_p4_polar_;
+  unsigned long long jup_ak4pfjets_leadMEDbjet_p4_polarGen;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jup_ak4pfjets_leadbtag_p4_;
   TBranch *jup_ak4pfjets_leadbtag_p4_branch;
-  bool     jup_ak4pfjets_leadbtag_p4_isLoaded;
+  unsigned long long jup_ak4pfjets_leadbtag_p4_loadedGen;
+  FlatObject<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > jup_ak4pfjets_leadbtag_p4_flat;
+  PolarP4 jup_ak4pfjets_leadbtag_p4_polar_;
+  unsigned long long jup_ak4pfjets_leadbtag_p4_polarGen;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jup_ak4genjets_p4_;
   TBranch *jup_ak4genjets_p4_branch;
-  bool     jup_ak4genjets_p4_isLoaded;
+  unsigned long long jup_ak4genjets_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jup_ak4genjets_p4_flat;
+  PolarArrays jup_ak4genjets_p4_polar_;
+  unsigned long long jup_ak4genjets_p4_polarGen;
+  SplitP4Reader jup_ak4genjets_p4_split;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jup_softtags_p4_;
   TBranch *jup_softtags_p4_branch;
-  bool     jup_softtags_p4_isLoaded;
+  unsigned long long jup_softtags_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jup_softtags_p4_flat;
+  PolarArrays jup_softtags_p4_polar_;
+  unsigned long long jup_softtags_p4_polarGen;
+  SplitP4Reader jup_softtags_p4_split;
   int      jup_nsoftbtags_;
   TBranch *jup_nsoftbtags_branch;
-  bool     jup_nsoftbtags_isLoaded;
+  unsigned long long jup_nsoftbtags_loadedGen;
+  FlatScalar<int> jup_nsoftbtags_flat;
+  BulkBranch *jup_nsoftbtags_bulk;
   int      jdown_nskimjets_;
   TBranch *jdown_nskimjets_branch;
-  bool     jdown_nskimjets_isLoaded;
+  unsigned long long jdown_nskimjets_loadedGen;
+  FlatScalar<int> jdown_nskimjets_flat;
+  BulkBranch *jdown_nskimjets_bulk;
   int      jdown_nskimbtagmed_;
   TBranch *jdown_nskimbtagmed_branch;
-  bool     jdown_nskimbtagmed_isLoaded;
+  unsigned long long jdown_nskimbtagmed_loadedGen;
+  FlatScalar<int> jdown_nskimbtagmed_flat;
+  BulkBranch *jdown_nskimbtagmed_bulk;
   int      jdown_nskimbtagloose_;
   TBranch *jdown_nskimbtagloose_branch;
-  bool     jdown_nskimbtagloose_isLoaded;
+  unsigned long long jdown_nskimbtagloose_loadedGen;
+  FlatScalar<int> jdown_nskimbtagloose_flat;
+  BulkBranch *jdown_nskimbtagloose_bulk;
   int      jdown_nskimbtagtight_;
   TBranch *jdown_nskimbtagtight_branch;
-  bool     jdown_nskimbtagtight_isLoaded;
+  unsigned long long jdown_nskimbtagtight_loadedGen;
+  FlatScalar<int> jdown_nskimbtagtight_flat;
+  BulkBranch *jdown_nskimbtagtight_bulk;
   int      jdown_ngoodjets_;
   TBranch *jdown_ngoodjets_branch;
-  bool     jdown_ngoodjets_isLoaded;
+  unsigned long long jdown_ngoodjets_loadedGen;
+  FlatScalar<int> jdown_ngoodjets_flat;
+  BulkBranch *jdown_ngoodjets_bulk;
   int      jdown_ngoodbtags_;
   TBranch *jdown_ngoodbtags_branch;
-  bool     jdown_ngoodbtags_isLoaded;
+  unsigned long long jdown_ngoodbtags_loadedGen;
+  FlatScalar<int> jdown_ngoodbtags_flat;
+  BulkBranch *jdown_ngoodbtags_bulk;
   int      jdown_nloosebtags_;
   TBranch *jdown_nloosebtags_branch;
-  bool     jdown_nloosebtags_isLoaded;
+  unsigned long long jdown_nloosebtags_loadedGen;
+  FlatScalar<int> jdown_nloosebtags_flat;
+  BulkBranch *jdown_nloosebtags_bulk;
   int      jdown_ntightbtags_;
   TBranch *jdown_ntightbtags_branch;
-  bool     jdown_ntightbtags_isLoaded;
+  unsigned long long jdown_ntightbtags_loadedGen;
+  FlatScalar<int> jdown_ntightbtags_flat;
+  BulkBranch *jdown_ntightbtags_bulk;
   int      jdown_nanalysisbtags_;
   TBranch *jdown_nanalysisbtags_branch;
-  bool     jdown_nanalysisbtags_isLoaded;
+  unsigned long long jdown_nanalysisbtags_loadedGen;
+  FlatScalar<int> jdown_nanalysisbtags_flat;
+  BulkBranch *jdown_nanalysisbtags_bulk;
   float    jdown_ak4_HT_;
   TBranch *jdown_ak4_HT_branch;
-  bool     jdown_ak4_HT_isLoaded;
+  unsigned long long jdown_ak4_HT_loadedGen;
+  FlatScalar<float> jdown_ak4_HT_flat;
+  BulkBranch *jdown_ak4_HT_bulk;
   float    jdown_ak4_htratiom_;
   TBranch *jdown_ak4_htratiom_branch;
-  bool     jdown_ak4_htratiom_isLoaded;
+  unsigned long long jdown_ak4_htratiom_loadedGen;
+  FlatScalar<float> jdown_ak4_htratiom_flat;
+  BulkBranch *jdown_ak4_htratiom_bulk;
   vector<float> *jdown_dphi_ak4pfjet_met_;
   TBranch *jdown_dphi_ak4pfjet_met_branch;
-  bool     jdown_dphi_ak4pfjet_met_isLoaded;
+  unsigned long long jdown_dphi_ak4pfjet_met_loadedGen;
+  FlatObject<vector<float> > jdown_dphi_ak4pfjet_met_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jdown_ak4pfjets_p4_;
   TBranch *jdown_ak4pfjets_p4_branch;
-  bool     jdown_ak4pfjets_p4_isLoaded;
+  unsigned long long jdown_ak4pfjets_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jdown_ak4pfjets_p4_flat;
+  PolarArrays jdown_ak4pfjets_p4_polar_;
+  unsigned long long jdown_ak4pfjets_p4_polarGen;
+  SplitP4Reader jdown_ak4pfjets_p4_split;
   vector<bool> *jdown_ak4pfjets_passMEDbtag_;
   TBranch *jdown_ak4pfjets_passMEDbtag_branch;
-  bool     jdown_ak4pfjets_passMEDbtag_isLoaded;
+  unsigned long long jdown_ak4pfjets_passMEDbtag_loadedGen;
+  FlatObject<vector<bool> > jdown_ak4pfjets_passMEDbtag_flat;
   vector<float> *jdown_ak4pfjets_deepCSV_;
   TBranch *jdown_ak4pfjets_deepCSV_branch;
-  bool     jdown_ak4pfjets_deepCSV_isLoaded;
+  unsigned long long jdown_ak4pfjets_deepCSV_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_deepCSV_flat;
   vector<float> *jdown_ak4pfjets_CSV_;
   TBranch *jdown_ak4pfjets_CSV_branch;
-  bool     jdown_ak4pfjets_CSV_isLoaded;
+  unsigned long long jdown_ak4pfjets_CSV_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_CSV_flat;
   vector<float> *jdown_ak4pfjets_mva_;
   TBranch *jdown_ak4pfjets_mva_branch;
-  bool     jdown_ak4pfjets_mva_isLoaded;
+  unsigned long long jdown_ak4pfjets_mva_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_mva_flat;
   vector<int> *jdown_ak4pfjets_parton_flavor_;
   TBranch *jdown_ak4pfjets_parton_flavor_branch;
-  bool     jdown_ak4pfjets_parton_flavor_isLoaded;
+  unsigned long long jdown_ak4pfjets_parton_flavor_loadedGen;
+  FlatObject<vector<int> > jdown_ak4pfjets_parton_flavor_flat;
   vector<int> *jdown_ak4pfjets_hadron_flavor_;
   TBranch *jdown_ak4pfjets_hadron_flavor_branch;
-  bool     jdown_ak4pfjets_hadron_flavor_isLoaded;
+  unsigned long long jdown_ak4pfjets_hadron_flavor_loadedGen;
+  FlatObject<vector<int> > jdown_ak4pfjets_hadron_flavor_flat;
   vector<bool> *jdown_ak4pfjets_loose_puid_;
   TBranch *jdown_ak4pfjets_loose_puid_branch;
-  bool     jdown_ak4pfjets_loose_puid_isLoaded;
+  unsigned long long jdown_ak4pfjets_loose_puid_loadedGen;
+  FlatObject<vector<bool> > jdown_ak4pfjets_loose_puid_flat;
   vector<bool> *jdown_ak4pfjets_loose_pfid_;
   TBranch *jdown_ak4pfjets_loose_pfid_branch;
-  bool     jdown_ak4pfjets_loose_pfid_isLoaded;
+  unsigned long long jdown_ak4pfjets_loose_pfid_loadedGen;
+  FlatObject<vector<bool> > jdown_ak4pfjets_loose_pfid_flat;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jdown_ak4pfjets_leadMEDbjet_p4_;
   TBranch *jdown_ak4pfjets_leadMEDbjet_p4_branch;
-  bool     jdown_ak4pfjets_leadMEDbjet_p4_isLoaded;
+  unsigned long long jdown_ak4pfjets_leadMEDbjet_p4_loadedGen;
+  FlatObject<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > jdown_ak4pfjets_leadMEDbjet_p4_flat;
+  PolarP4 jdown_ak4pfjets_leadMEDbjet_p4_polar_;
+  unsigned long long jdown_ak4pfjets_leadMEDbjet_p4_polarGen;
   ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > *jdown_ak4pfjets_leadbtag_p4_;
   TBranch *jdown_ak4pfjets_leadbtag_p4_branch;
-  bool     jdown_ak4pfjets_leadbtag_p4_isLoaded;
+  unsigned long long jdown_ak4pfjets_leadbtag_p4_loadedGen;
+  FlatObject<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > jdown_ak4pfjets_leadbtag_p4_flat;
+  PolarP4 jdown_ak4pfjets_leadbtag_p4_polar_;
+  unsigned long long jdown_ak4pfjets_leadbtag_p4_polarGen;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jdown_ak4genjets_p4_;
   TBranch *jdown_ak4genjets_p4_branch;
-  bool     jdown_ak4genjets_p4_isLoaded;
+  unsigned long long jdown_ak4genjets_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jdown_ak4genjets_p4_flat;
+  PolarArrays jdown_ak4genjets_p4_polar_;
+  unsigned long long jdown_ak4genjets_p4_polarGen;
+  SplitP4Reader jdown_ak4genjets_p4_split;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jdown_softtags_p4_;
   TBranch *jdown_softtags_p4_branch;
-  bool     jdown_softtags_p4_isLoaded;
+  unsigned long long jdown_softtags_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jdown_softtags_p4_flat;
+  PolarArrays jdown_softtags_p4_polar_;
+  unsigned long long jdown_softtags_p4_polarGen;
+  SplitP4Reader jdown_softtags_p4_split;
   int      jdown_nsoftbtags_;
   TBranch *jdown_nsoftbtags_branch;
-  bool     jdown_nsoftbtags_isLoaded;
+  unsigned long long jdown_nsoftbtags_loadedGen;
+  FlatScalar<int> jdown_nsoftbtags_flat;
+  BulkBranch *jdown_nsoftbtags_bulk;
   vector<bool> *genleps_isfromt_;
   TBranch *genleps_isfromt_branch;
-  bool     genleps_isfromt_isLoaded;
+  unsigned long long genleps_isfromt_loadedGen;
+  FlatObject<vector<bool> > genleps_isfromt_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genleps_p4_;
   TBranch *genleps_p4_branch;
-  bool     genleps_p4_isLoaded;
+  unsigned long long genleps_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > genleps_p4_flat;
+  PolarArrays genleps_p4_polar_;
+  unsigned long long genleps_p4_polarGen;
+  SplitP4Reader genleps_p4_split;
   vector<int> *genleps_id_;
   TBranch *genleps_id_branch;
-  bool     genleps_id_isLoaded;
+  unsigned long long genleps_id_loadedGen;
+  FlatObject<vector<int> > genleps_id_flat;
   vector<int> *genleps__genpsidx_;
   TBranch *genleps__genpsidx_branch;
-  bool     genleps__genpsidx_isLoaded;
+  unsigned long long genleps__genpsidx_loadedGen;
+  FlatObject<vector<int> > genleps__genpsidx_flat;
   vector<int> *genleps_status_;
   TBranch *genleps_status_branch;
-  bool     genleps_status_isLoaded;
+  unsigned long long genleps_status_loadedGen;
+  FlatObject<vector<int> > genleps_status_flat;
   vector<bool> *genleps_fromHardProcessDecayed_;
   TBranch *genleps_fromHardProcessDecayed_branch;
-  bool     genleps_fromHardProcessDecayed_isLoaded;
+  unsigned long long genleps_fromHardProcessDecayed_loadedGen;
+  FlatObject<vector<bool> > genleps_fromHardProcessDecayed_flat;
   vector<bool> *genleps_fromHardProcessFinalState_;
   TBranch *genleps_fromHardProcessFinalState_branch;
-  bool     genleps_fromHardProcessFinalState_isLoaded;
+  unsigned long long genleps_fromHardProcessFinalState_loadedGen;
+  FlatObject<vector<bool> > genleps_fromHardProcessFinalState_flat;
   vector<bool> *genleps_isHardProcess_;
   TBranch *genleps_isHardProcess_branch;
-  bool     genleps_isHardProcess_isLoaded;
+  unsigned long long genleps_isHardProcess_loadedGen;
+  FlatObject<vector<bool> > genleps_isHardProcess_flat;
   vector<bool> *genleps_isLastCopy_;
   TBranch *genleps_isLastCopy_branch;
-  bool     genleps_isLastCopy_isLoaded;
+  unsigned long long genleps_isLastCopy_loadedGen;
+  FlatObject<vector<bool> > genleps_isLastCopy_flat;
   vector<int> *genleps_gentaudecay_;
   TBranch *genleps_gentaudecay_branch;
-  bool     genleps_gentaudecay_isLoaded;
+  unsigned long long genleps_gentaudecay_loadedGen;
+  FlatObject<vector<int> > genleps_gentaudecay_flat;
   int      gen_nfromtleps__;
   TBranch *gen_nfromtleps__branch;
-  bool     gen_nfromtleps__isLoaded;
+  unsigned long long gen_nfromtleps__loadedGen;
+  FlatScalar<int> gen_nfromtleps__flat;
+  BulkBranch *gen_nfromtleps__bulk;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genleps_motherp4_;
   TBranch *genleps_motherp4_branch;
-  bool     genleps_motherp4_isLoaded;
+  unsigned long long genleps_motherp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > genleps_motherp4_flat;
+  PolarArrays genleps_motherp4_polar_;
+  unsigned long long genleps_motherp4_polarGen;
+  SplitP4Reader genleps_motherp4_split;
   vector<int> *genleps_motherid_;
   TBranch *genleps_motherid_branch;
-  bool     genleps_motherid_isLoaded;
+  unsigned long long genleps_motherid_loadedGen;
+  FlatObject<vector<int> > genleps_motherid_flat;
   vector<int> *genleps_motheridx_;
   TBranch *genleps_motheridx_branch;
-  bool     genleps_motheridx_isLoaded;
+  unsigned long long genleps_motheridx_loadedGen;
+  FlatObject<vector<int> > genleps_motheridx_flat;
   vector<int> *genleps_motherstatus_;
   TBranch *genleps_motherstatus_branch;
-  bool     genleps_motherstatus_isLoaded;
+  unsigned long long genleps_motherstatus_loadedGen;
+  FlatObject<vector<int> > genleps_motherstatus_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genleps_gmotherp4_;
   TBranch *genleps_gmotherp4_branch;
-  bool     genleps_gmotherp4_isLoaded;
+  unsigned long long genleps_gmotherp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > genleps_gmotherp4_flat;
+  PolarArrays genleps_gmotherp4_polar_;
+  unsigned long long genleps_gmotherp4_polarGen;
+  SplitP4Reader genleps_gmotherp4_split;
   vector<int> *genleps_gmotherid_;
   TBranch *genleps_gmotherid_branch;
-  bool     genleps_gmotherid_isLoaded;
+  unsigned long long genleps_gmotherid_loadedGen;
+  FlatObject<vector<int> > genleps_gmotherid_flat;
   vector<int> *genleps_gmotheridx_;
   TBranch *genleps_gmotheridx_branch;
-  bool     genleps_gmotheridx_isLoaded;
+  unsigned long long genleps_gmotheridx_loadedGen;
+  FlatObject<vector<int> > genleps_gmotheridx_flat;
   vector<int> *genleps_gmotherstatus_;
   TBranch *genleps_gmotherstatus_branch;
-  bool     genleps_gmotherstatus_isLoaded;
+  unsigned long long genleps_gmotherstatus_loadedGen;
+  FlatObject<vector<int> > genleps_gmotherstatus_flat;
   vector<bool> *gennus_isfromt_;
   TBranch *gennus_isfromt_branch;
-  bool     gennus_isfromt_isLoaded;
+  unsigned long long gennus_isfromt_loadedGen;
+  FlatObject<vector<bool> > gennus_isfromt_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *gennus_p4_;
   TBranch *gennus_p4_branch;
-  bool     gennus_p4_isLoaded;
+  unsigned long long gennus_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > gennus_p4_flat;
+  PolarArrays gennus_p4_polar_;
+  unsigned long long gennus_p4_polarGen;
+  SplitP4Reader gennus_p4_split;
   vector<int> *gennus_id_;
   TBranch *gennus_id_branch;
-  bool     gennus_id_isLoaded;
+  unsigned long long gennus_id_loadedGen;
+  FlatObject<vector<int> > gennus_id_flat;
   vector<int> *gennus__genpsidx_;
   TBranch *gennus__genpsidx_branch;
-  bool     gennus__genpsidx_isLoaded;
+  unsigned long long gennus__genpsidx_loadedGen;
+  FlatObject<vector<int> > gennus__genpsidx_flat;
   vector<int> *gennus_status_;
   TBranch *gennus_status_branch;
-  bool     gennus_status_isLoaded;
+  unsigned long long gennus_status_loadedGen;
+  FlatObject<vector<int> > gennus_status_flat;
   vector<bool> *gennus_fromHardProcessDecayed_;
   TBranch *gennus_fromHardProcessDecayed_branch;
-  bool     gennus_fromHardProcessDecayed_isLoaded;
+  unsigned long long gennus_fromHardProcessDecayed_loadedGen;
+  FlatObject<vector<bool> > gennus_fromHardProcessDecayed_flat;
   vector<bool> *gennus_fromHardProcessFinalState_;
   TBranch *gennus_fromHardProcessFinalState_branch;
-  bool     gennus_fromHardProcessFinalState_isLoaded;
+  unsigned long long gennus_fromHardProcessFinalState_loadedGen;
+  FlatObject<vector<bool> > gennus_fromHardProcessFinalState_flat;
   vector<bool> *gennus_isHardProcess_;
   TBranch *gennus_isHardProcess_branch;
-  bool     gennus_isHardProcess_isLoaded;
+  unsigned long long gennus_isHardProcess_loadedGen;
+  FlatObject<vector<bool> > gennus_isHardProcess_flat;
   vector<bool> *gennus_isLastCopy_;
   TBranch *gennus_isLastCopy_branch;
-  bool     gennus_isLastCopy_isLoaded;
+  unsigned long long gennus_isLastCopy_loadedGen;
+  FlatObject<vector<bool> > gennus_isLastCopy_flat;
   vector<int> *gennus_gentaudecay_;
   TBranch *gennus_gentaudecay_branch;
-  bool     gennus_gentaudecay_isLoaded;
+  unsigned long long gennus_gentaudecay_loadedGen;
+  FlatObject<vector<int> > gennus_gentaudecay_flat;
   int      gen_nfromtnus__;
   TBranch *gen_nfromtnus__branch;
-  bool     gen_nfromtnus__isLoaded;
+  unsigned long long gen_nfromtnus__loadedGen;
+  FlatScalar<int> gen_nfromtnus__flat;
+  BulkBranch *gen_nfromtnus__bulk;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *gennus_motherp4_;
   TBranch *gennus_motherp4_branch;
-  bool     gennus_motherp4_isLoaded;
+  unsigned long long gennus_motherp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > gennus_motherp4_flat;
+  PolarArrays gennus_motherp4_polar_;
+  unsigned long long gennus_motherp4_polarGen;
+  SplitP4Reader gennus_motherp4_split;
   vector<int> *gennus_motherid_;
   TBranch *gennus_motherid_branch;
-  bool     gennus_motherid_isLoaded;
+  unsigned long long gennus_motherid_loadedGen;
+  FlatObject<vector<int> > gennus_motherid_flat;
   vector<int> *gennus_motheridx_;
   TBranch *gennus_motheridx_branch;
-  bool     gennus_motheridx_isLoaded;
+  unsigned long long gennus_motheridx_loadedGen;
+  FlatObject<vector<int> > gennus_motheridx_flat;
   vector<int> *gennus_motherstatus_;
   TBranch *gennus_motherstatus_branch;
-  bool     gennus_motherstatus_isLoaded;
+  unsigned long long gennus_motherstatus_loadedGen;
+  FlatObject<vector<int> > gennus_motherstatus_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *gennus_gmotherp4_;
   TBranch *gennus_gmotherp4_branch;
-  bool     gennus_gmotherp4_isLoaded;
+  unsigned long long gennus_gmotherp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > gennus_gmotherp4_flat;
+  PolarArrays gennus_gmotherp4_polar_;
+  unsigned long long gennus_gmotherp4_polarGen;
+  SplitP4Reader gennus_gmotherp4_split;
   vector<int> *gennus_gmotherid_;
   TBranch *gennus_gmotherid_branch;
-  bool     gennus_gmotherid_isLoaded;
+  unsigned long long gennus_gmotherid_loadedGen;
+  FlatObject<vector<int> > gennus_gmotherid_flat;
   vector<int> *gennus_gmotheridx_;
   TBranch *gennus_gmotheridx_branch;
-  bool     gennus_gmotheridx_isLoaded;
+  unsigned long long gennus_gmotheridx_loadedGen;
+  FlatObject<vector<int> > gennus_gmotheridx_flat;
   vector<int> *gennus_gmotherstatus_;
   TBranch *gennus_gmotherstatus_branch;
-  bool     gennus_gmotherstatus_isLoaded;
+  unsigned long long gennus_gmotherstatus_loadedGen;
+  FlatObject<vector<int> > gennus_gmotherstatus_flat;
   vector<bool> *genqs_isfromt_;
   TBranch *genqs_isfromt_branch;
-  bool     genqs_isfromt_isLoaded;
+  unsigned long long genqs_isfromt_loadedGen;
+  FlatObject<vector<bool> > genqs_isfromt_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genqs_p4_;
   TBranch *genqs_p4_branch;
-  bool     genqs_p4_isLoaded;
+  unsigned long long genqs_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > genqs_p4_flat;
+  PolarArrays genqs_p4_polar_;
+  unsigned long long genqs_p4_polarGen;
+  SplitP4Reader genqs_p4_split;
   vector<int> *genqs_id_;
   TBranch *genqs_id_branch;
-  bool     genqs_id_isLoaded;
+  unsigned long long genqs_id_loadedGen;
+  FlatObject<vector<int> > genqs_id_flat;
   vector<int> *genqs__genpsidx_;
   TBranch *genqs__genpsidx_branch;
-  bool     genqs__genpsidx_isLoaded;
+  unsigned long long genqs__genpsidx_loadedGen;
+  FlatObject<vector<int> > genqs__genpsidx_flat;
   vector<int> *genqs_status_;
   TBranch *genqs_status_branch;
-  bool     genqs_status_isLoaded;
+  unsigned long long genqs_status_loadedGen;
+  FlatObject<vector<int> > genqs_status_flat;
   vector<bool> *genqs_fromHardProcessDecayed_;
   TBranch *genqs_fromHardProcessDecayed_branch;
-  bool     genqs_fromHardProcessDecayed_isLoaded;
+  unsigned long long genqs_fromHardProcessDecayed_loadedGen;
+  FlatObject<vector<bool> > genqs_fromHardProcessDecayed_flat;
   vector<bool> *genqs_fromHardProcessFinalState_;
   TBranch *genqs_fromHardProcessFinalState_branch;
-  bool     genqs_fromHardProcessFinalState_isLoaded;
+  unsigned long long genqs_fromHardProcessFinalState_loadedGen;
+  FlatObject<vector<bool> > genqs_fromHardProcessFinalState_flat;
   vector<bool> *genqs_isHardProcess_;
   TBranch *genqs_isHardProcess_branch;
-  bool     genqs_isHardProcess_isLoaded;
+  unsigned long long genqs_isHardProcess_loadedGen;
+  FlatObject<vector<bool> > genqs_isHardProcess_flat;
   vector<bool> *genqs_isLastCopy_;
   TBranch *genqs_isLastCopy_branch;
-  bool     genqs_isLastCopy_isLoaded;
+  unsigned long long genqs_isLastCopy_loadedGen;
+  FlatObject<vector<bool> > genqs_isLastCopy_flat;
   vector<int> *genqs_gentaudecay_;
   TBranch *genqs_gentaudecay_branch;
-  bool     genqs_gentaudecay_isLoaded;
+  unsigned long long genqs_gentaudecay_loadedGen;
+  FlatObject<vector<int> > genqs_gentaudecay_flat;
   int      gen_nfromtqs__;
   TBranch *gen_nfromtqs__branch;
-  bool     gen_nfromtqs__isLoaded;
+  unsigned long long gen_nfromtqs__loadedGen;
+  FlatScalar<int> gen_nfromtqs__flat;
+  BulkBranch *gen_nfromtqs__bulk;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genqs_motherp4_;
   TBranch *genqs_motherp4_branch;
-  bool     genqs_motherp4_isLoaded;
+  unsigned long long genqs_motherp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > genqs_motherp4_flat;
+  PolarArrays genqs_motherp4_polar_;
+  unsigned long long genqs_motherp4_polarGen;
+  SplitP4Reader genqs_motherp4_split;
   vector<int> *genqs_motherid_;
   TBranch *genqs_motherid_branch;
-  bool     genqs_motherid_isLoaded;
+  unsigned long long genqs_motherid_loadedGen;
+  FlatObject<vector<int> > genqs_motherid_flat;
   vector<int> *genqs_motheridx_;
   TBranch *genqs_motheridx_branch;
-  bool     genqs_motheridx_isLoaded;
+  unsigned long long genqs_motheridx_loadedGen;
+  FlatObject<vector<int> > genqs_motheridx_flat;
   vector<int> *genqs_motherstatus_;
   TBranch *genqs_motherstatus_branch;
-  bool     genqs_motherstatus_isLoaded;
+  unsigned long long genqs_motherstatus_loadedGen;
+  FlatObject<vector<int> > genqs_motherstatus_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genqs_gmotherp4_;
   TBranch *genqs_gmotherp4_branch;
-  bool     genqs_gmotherp4_isLoaded;
+  unsigned long long genqs_gmotherp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > genqs_gmotherp4_flat;
+  PolarArrays genqs_gmotherp4_polar_;
+  unsigned long long genqs_gmotherp4_polarGen;
+  SplitP4Reader genqs_gmotherp4_split;
   vector<int> *genqs_gmotherid_;
   TBranch *genqs_gmotherid_branch;
-  bool     genqs_gmotherid_isLoaded;
+  unsigned long long genqs_gmotherid_loadedGen;
+  FlatObject<vector<int> > genqs_gmotherid_flat;
   vector<int> *genqs_gmotheridx_;
   TBranch *genqs_gmotheridx_branch;
-  bool     genqs_gmotheridx_isLoaded;
+  unsigned long long genqs_gmotheridx_loadedGen;
+  FlatObject<vector<int> > genqs_gmotheridx_flat;
   vector<int> *genqs_gmotherstatus_;
   TBranch *genqs_gmotherstatus_branch;
-  bool     genqs_gmotherstatus_isLoaded;
+  unsigned long long genqs_gmotherstatus_loadedGen;
+  FlatObject<vector<int> > genqs_gmotherstatus_flat;
   vector<bool> *genbosons_isfromt_;
   TBranch *genbosons_isfromt_branch;
-  bool     genbosons_isfromt_isLoaded;
+  unsigned long long genbosons_isfromt_loadedGen;
+  FlatObject<vector<bool> > genbosons_isfromt_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genbosons_p4_;
   TBranch *genbosons_p4_branch;
-  bool     genbosons_p4_isLoaded;
+  unsigned long long genbosons_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > genbosons_p4_flat;
+  PolarArrays genbosons_p4_polar_;
+  unsigned long long genbosons_p4_polarGen;
+  SplitP4Reader genbosons_p4_split;
   vector<int> *genbosons_id_;
   TBranch *genbosons_id_branch;
-  bool     genbosons_id_isLoaded;
+  unsigned long long genbosons_id_loadedGen;
+  FlatObject<vector<int> > genbosons_id_flat;
   vector<int> *genbosons__genpsidx_;
   TBranch *genbosons__genpsidx_branch;
-  bool     genbosons__genpsidx_isLoaded;
+  unsigned long long genbosons__genpsidx_loadedGen;
+  FlatObject<vector<int> > genbosons__genpsidx_flat;
   vector<int> *genbosons_status_;
   TBranch *genbosons_status_branch;
-  bool     genbosons_status_isLoaded;
+  unsigned long long genbosons_status_loadedGen;
+  FlatObject<vector<int> > genbosons_status_flat;
   vector<bool> *genbosons_fromHardProcessDecayed_;
   TBranch *genbosons_fromHardProcessDecayed_branch;
-  bool     genbosons_fromHardProcessDecayed_isLoaded;
+  unsigned long long genbosons_fromHardProcessDecayed_loadedGen;
+  FlatObject<vector<bool> > genbosons_fromHardProcessDecayed_flat;
   vector<bool> *genbosons_fromHardProcessFinalState_;
   TBranch *genbosons_fromHardProcessFinalState_branch;
-  bool     genbosons_fromHardProcessFinalState_isLoaded;
+  unsigned long long genbosons_fromHardProcessFinalState_loadedGen;
+  FlatObject<vector<bool> > genbosons_fromHardProcessFinalState_flat;
   vector<bool> *genbosons_isHardProcess_;
   TBranch *genbosons_isHardProcess_branch;
-  bool     genbosons_isHardProcess_isLoaded;
+  unsigned long long genbosons_isHardProcess_loadedGen;
+  FlatObject<vector<bool> > genbosons_isHardProcess_flat;
   vector<bool> *genbosons_isLastCopy_;
   TBranch *genbosons_isLastCopy_branch;
-  bool     genbosons_isLastCopy_isLoaded;
+  unsigned long long genbosons_isLastCopy_loadedGen;
+  FlatObject<vector<bool> > genbosons_isLastCopy_flat;
   vector<int> *genbosons_gentaudecay_;
   TBranch *genbosons_gentaudecay_branch;
-  bool     genbosons_gentaudecay_isLoaded;
+  unsigned long long genbosons_gentaudecay_loadedGen;
+  FlatObject<vector<int> > genbosons_gentaudecay_flat;
   int      gen_nfromtbosons__;
   TBranch *gen_nfromtbosons__branch;
-  bool     gen_nfromtbosons__isLoaded;
+  unsigned long long gen_nfromtbosons__loadedGen;
+  FlatScalar<int> gen_nfromtbosons__flat;
+  BulkBranch *gen_nfromtbosons__bulk;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genbosons_motherp4_;
   TBranch *genbosons_motherp4_branch;
-  bool     genbosons_motherp4_isLoaded;
+  unsigned long long genbosons_motherp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > genbosons_motherp4_flat;
+  PolarArrays genbosons_motherp4_polar_;
+  unsigned long long genbosons_motherp4_polarGen;
+  SplitP4Reader genbosons_motherp4_split;
   vector<int> *genbosons_motherid_;
   TBranch *genbosons_motherid_branch;
-  bool     genbosons_motherid_isLoaded;
+  unsigned long long genbosons_motherid_loadedGen;
+  FlatObject<vector<int> > genbosons_motherid_flat;
   vector<int> *genbosons_motheridx_;
   TBranch *genbosons_motheridx_branch;
-  bool     genbosons_motheridx_isLoaded;
+  unsigned long long genbosons_motheridx_loadedGen;
+  FlatObject<vector<int> > genbosons_motheridx_flat;
   vector<int> *genbosons_motherstatus_;
   TBranch *genbosons_motherstatus_branch;
-  bool     genbosons_motherstatus_isLoaded;
+  unsigned long long genbosons_motherstatus_loadedGen;
+  FlatObject<vector<int> > genbosons_motherstatus_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *genbosons_gmotherp4_;
   TBranch *genbosons_gmotherp4_branch;
-  bool     genbosons_gmotherp4_isLoaded;
+  unsigned long long genbosons_gmotherp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > genbosons_gmotherp4_flat;
+  PolarArrays genbosons_gmotherp4_polar_;
+  unsigned long long genbosons_gmotherp4_polarGen;
+  SplitP4Reader genbosons_gmotherp4_split;
   vector<int> *genbosons_gmotherid_;
   TBranch *genbosons_gmotherid_branch;
-  bool     genbosons_gmotherid_isLoaded;
+  unsigned long long genbosons_gmotherid_loadedGen;
+  FlatObject<vector<int> > genbosons_gmotherid_flat;
   vector<int> *genbosons_gmotheridx_;
   TBranch *genbosons_gmotheridx_branch;
-  bool     genbosons_gmotheridx_isLoaded;
+  unsigned long long genbosons_gmotheridx_loadedGen;
+  FlatObject<vector<int> > genbosons_gmotheridx_flat;
   vector<int> *genbosons_gmotherstatus_;
   TBranch *genbosons_gmotherstatus_branch;
-  bool     genbosons_gmotherstatus_isLoaded;
+  unsigned long long genbosons_gmotherstatus_loadedGen;
+  FlatObject<vector<int> > genbosons_gmotherstatus_flat;
   vector<bool> *gensusy_isfromt_;
   TBranch *gensusy_isfromt_branch;
-  bool     gensusy_isfromt_isLoaded;
+  unsigned long long gensusy_isfromt_loadedGen;
+  FlatObject<vector<bool> > gensusy_isfromt_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *gensusy_p4_;
   TBranch *gensusy_p4_branch;
-  bool     gensusy_p4_isLoaded;
+  unsigned long long gensusy_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > gensusy_p4_flat;
+  PolarArrays gensusy_p4_polar_;
+  unsigned long long gensusy_p4_polarGen;
+  SplitP4Reader gensusy_p4_split;
   vector<int> *gensusy_id_;
   TBranch *gensusy_id_branch;
-  bool     gensusy_id_isLoaded;
+  unsigned long long gensusy_id_loadedGen;
+  FlatObject<vector<int> > gensusy_id_flat;
   vector<int> *gensusy__genpsidx_;
   TBranch *gensusy__genpsidx_branch;
-  bool     gensusy__genpsidx_isLoaded;
+  unsigned long long gensusy__genpsidx_loadedGen;
+  FlatObject<vector<int> > gensusy__genpsidx_flat;
   vector<int> *gensusy_status_;
   TBranch *gensusy_status_branch;
-  bool     gensusy_status_isLoaded;
+  unsigned long long gensusy_status_loadedGen;
+  FlatObject<vector<int> > gensusy_status_flat;
   vector<bool> *gensusy_fromHardProcessDecayed_;
   TBranch *gensusy_fromHardProcessDecayed_branch;
-  bool     gensusy_fromHardProcessDecayed_isLoaded;
+  unsigned long long gensusy_fromHardProcessDecayed_loadedGen;
+  FlatObject<vector<bool> > gensusy_fromHardProcessDecayed_flat;
   vector<bool> *gensusy_fromHardProcessFinalState_;
   TBranch *gensusy_fromHardProcessFinalState_branch;
-  bool     gensusy_fromHardProcessFinalState_isLoaded;
+  unsigned long long gensusy_fromHardProcessFinalState_loadedGen;
+  FlatObject<vector<bool> > gensusy_fromHardProcessFinalState_flat;
   vector<bool> *gensusy_isHardProcess_;
   TBranch *gensusy_isHardProcess_branch;
-  bool     gensusy_isHardProcess_isLoaded;
+  unsigned long long gensusy_isHardProcess_loadedGen;
+  FlatObject<vector<bool> > gensusy_isHardProcess_flat;
   vector<bool> *gensusy_isLastCopy_;
   TBranch *gensusy_isLastCopy_branch;
-  bool     gensusy_isLastCopy_isLoaded;
+  unsigned long long gensusy_isLastCopy_loadedGen;
+  FlatObject<vector<bool> > gensusy_isLastCopy_flat;
   vector<int> *gensusy_gentaudecay_;
   TBranch *gensusy_gentaudecay_branch;
-  bool     gensusy_gentaudecay_isLoaded;
+  unsigned long long gensusy_gentaudecay_loadedGen;
+  FlatObject<vector<int> > gensusy_gentaudecay_flat;
   int      gen_nfromtsusy__;
   TBranch *gen_nfromtsusy__branch;
-  bool     gen_nfromtsusy__isLoaded;
+  unsigned long long gen_nfromtsusy__loadedGen;
+  FlatScalar<int> gen_nfromtsusy__flat;
+  BulkBranch *gen_nfromtsusy__bulk;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *gensusy_motherp4_;
   TBranch *gensusy_motherp4_branch;
-  bool     gensusy_motherp4_isLoaded;
+  unsigned long long gensusy_motherp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > gensusy_motherp4_flat;
+  PolarArrays gensusy_motherp4_polar_;
+  unsigned long long gensusy_motherp4_polarGen;
+  SplitP4Reader gensusy_motherp4_split;
   vector<int> *gensusy_motherid_;
   TBranch *gensusy_motherid_branch;
-  bool     gensusy_motherid_isLoaded;
+  unsigned long long gensusy_motherid_loadedGen;
+  FlatObject<vector<int> > gensusy_motherid_flat;
   vector<int> *gensusy_motheridx_;
   TBranch *gensusy_motheridx_branch;
-  bool     gensusy_motheridx_isLoaded;
+  unsigned long long gensusy_motheridx_loadedGen;
+  FlatObject<vector<int> > gensusy_motheridx_flat;
   vector<int> *gensusy_motherstatus_;
   TBranch *gensusy_motherstatus_branch;
-  bool     gensusy_motherstatus_isLoaded;
+  unsigned long long gensusy_motherstatus_loadedGen;
+  FlatObject<vector<int> > gensusy_motherstatus_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *gensusy_gmotherp4_;
   TBranch *gensusy_gmotherp4_branch;
-  bool     gensusy_gmotherp4_isLoaded;
+  unsigned long long gensusy_gmotherp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > gensusy_gmotherp4_flat;
+  PolarArrays gensusy_gmotherp4_polar_;
+  unsigned long long gensusy_gmotherp4_polarGen;
+  SplitP4Reader gensusy_gmotherp4_split;
   vector<int> *gensusy_gmotherid_;
   TBranch *gensusy_gmotherid_branch;
-  bool     gensusy_gmotherid_isLoaded;
+  unsigned long long gensusy_gmotherid_loadedGen;
+  FlatObject<vector<int> > gensusy_gmotherid_flat;
   vector<int> *gensusy_gmotheridx_;
   TBranch *gensusy_gmotheridx_branch;
-  bool     gensusy_gmotheridx_isLoaded;
+  unsigned long long gensusy_gmotheridx_loadedGen;
+  FlatObject<vector<int> > gensusy_gmotheridx_flat;
   vector<int> *gensusy_gmotherstatus_;
   TBranch *gensusy_gmotherstatus_branch;
-  bool     gensusy_gmotherstatus_isLoaded;
+  unsigned long long gensusy_gmotherstatus_loadedGen;
+  FlatObject<vector<int> > gensusy_gmotherstatus_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *ak8pfjets_p4_;
   TBranch *ak8pfjets_p4_branch;
-  bool     ak8pfjets_p4_isLoaded;
+  unsigned long long ak8pfjets_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > ak8pfjets_p4_flat;
+  PolarArrays ak8pfjets_p4_polar_;
+  unsigned long long ak8pfjets_p4_polarGen;
+  SplitP4Reader ak8pfjets_p4_split;
   vector<float> *ak8pfjets_tau1_;
   TBranch *ak8pfjets_tau1_branch;
-  bool     ak8pfjets_tau1_isLoaded;
+  unsigned long long ak8pfjets_tau1_loadedGen;
+  FlatObject<vector<float> > ak8pfjets_tau1_flat;
   vector<float> *ak8pfjets_tau2_;
   TBranch *ak8pfjets_tau2_branch;
-  bool     ak8pfjets_tau2_isLoaded;
+  unsigned long long ak8pfjets_tau2_loadedGen;
+  FlatObject<vector<float> > ak8pfjets_tau2_flat;
   vector<float> *ak8pfjets_tau3_;
   TBranch *ak8pfjets_tau3_branch;
-  bool     ak8pfjets_tau3_isLoaded;
+  unsigned long long ak8pfjets_tau3_loadedGen;
+  FlatObject<vector<float> > ak8pfjets_tau3_flat;
   vector<int> *ak8pfjets_parton_flavor_;
   TBranch *ak8pfjets_parton_flavor_branch;
-  bool     ak8pfjets_parton_flavor_isLoaded;
+  unsigned long long ak8pfjets_parton_flavor_loadedGen;
+  FlatObject<vector<int> > ak8pfjets_parton_flavor_flat;
   int      nGoodAK8PFJets_;
   TBranch *nGoodAK8PFJets_branch;
-  bool     nGoodAK8PFJets_isLoaded;
+  unsigned long long nGoodAK8PFJets_loadedGen;
+  FlatScalar<int> nGoodAK8PFJets_flat;
+  BulkBranch *nGoodAK8PFJets_bulk;
   vector<float> *ak8pfjets_deepdisc_qcd_;
   TBranch *ak8pfjets_deepdisc_qcd_branch;
-  bool     ak8pfjets_deepdisc_qcd_isLoaded;
+  unsigned long long ak8pfjets_deepdisc_qcd_loadedGen;
+  FlatObject<vector<float> > ak8pfjets_deepdisc_qcd_flat;
   vector<float> *ak8pfjets_deepdisc_top_;
   TBranch *ak8pfjets_deepdisc_top_branch;
-  bool     ak8pfjets_deepdisc_top_isLoaded;
+  unsigned long long ak8pfjets_deepdisc_top_loadedGen;
+  FlatObject<vector<float> > ak8pfjets_deepdisc_top_flat;
   vector<float> *ak8pfjets_deepdisc_w_;
   TBranch *ak8pfjets_deepdisc_w_branch;
-  bool     ak8pfjets_deepdisc_w_isLoaded;
+  unsigned long long ak8pfjets_deepdisc_w_loadedGen;
+  FlatObject<vector<float> > ak8pfjets_deepdisc_w_flat;
   vector<float> *ak8pfjets_deepdisc_z_;
   TBranch *ak8pfjets_deepdisc_z_branch;
-  bool     ak8pfjets_deepdisc_z_isLoaded;
+  unsigned long long ak8pfjets_deepdisc_z_loadedGen;
+  FlatObject<vector<float> > ak8pfjets_deepdisc_z_flat;
   vector<float> *ak8pfjets_deepdisc_zbb_;
   TBranch *ak8pfjets_deepdisc_zbb_branch;
-  bool     ak8pfjets_deepdisc_zbb_isLoaded;
+  unsigned long long ak8pfjets_deepdisc_zbb_loadedGen;
+  FlatObject<vector<float> > ak8pfjets_deepdisc_zbb_flat;
   vector<float> *ak8pfjets_deepdisc_hbb_;
   TBranch *ak8pfjets_deepdisc_hbb_branch;
-  bool     ak8pfjets_deepdisc_hbb_isLoaded;
+  unsigned long long ak8pfjets_deepdisc_hbb_loadedGen;
+  FlatObject<vector<float> > ak8pfjets_deepdisc_hbb_flat;
   vector<float> *ak8pfjets_deepdisc_h4q_;
   TBranch *ak8pfjets_deepdisc_h4q_branch;
-  bool     ak8pfjets_deepdisc_h4q_isLoaded;
+  unsigned long long ak8pfjets_deepdisc_h4q_loadedGen;
+  FlatObject<vector<float> > ak8pfjets_deepdisc_h4q_flat;
   float    lead_ak8deepdisc_top_;
   TBranch *lead_ak8deepdisc_top_branch;
-  bool     lead_ak8deepdisc_top_isLoaded;
+  unsigned long long lead_ak8deepdisc_top_loadedGen;
+  FlatScalar<float> lead_ak8deepdisc_top_flat;
+  BulkBranch *lead_ak8deepdisc_top_bulk;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jup_ak8pfjets_p4_;
   TBranch *jup_ak8pfjets_p4_branch;
-  bool     jup_ak8pfjets_p4_isLoaded;
+  unsigned long long jup_ak8pfjets_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jup_ak8pfjets_p4_flat;
+  PolarArrays jup_ak8pfjets_p4_polar_;
+  unsigned long long jup_ak8pfjets_p4_polarGen;
+  SplitP4Reader jup_ak8pfjets_p4_split;
   vector<float> *jup_ak8pfjets_tau1_;
   TBranch *jup_ak8pfjets_tau1_branch;
-  bool     jup_ak8pfjets_tau1_isLoaded;
+  unsigned long long jup_ak8pfjets_tau1_loadedGen;
+  FlatObject<vector<float> > jup_ak8pfjets_tau1_flat;
   vector<float> *jup_ak8pfjets_tau2_;
   TBranch *jup_ak8pfjets_tau2_branch;
-  bool     jup_ak8pfjets_tau2_isLoaded;
+  unsigned long long jup_ak8pfjets_tau2_loadedGen;
+  FlatObject<vector<float> > jup_ak8pfjets_tau2_flat;
   vector<float> *jup_ak8pfjets_tau3_;
   TBranch *jup_ak8pfjets_tau3_branch;
-  bool     jup_ak8pfjets_tau3_isLoaded;
+  unsigned long long jup_ak8pfjets_tau3_loadedGen;
+  FlatObject<vector<float> > jup_ak8pfjets_tau3_flat;
   vector<int> *jup_ak8pfjets_parton_flavor_;
   TBranch *jup_ak8pfjets_parton_flavor_branch;
-  bool     jup_ak8pfjets_parton_flavor_isLoaded;
+  unsigned long long jup_ak8pfjets_parton_flavor_loadedGen;
+  FlatObject<vector<int> > jup_ak8pfjets_parton_flavor_flat;
   int      jup_nGoodAK8PFJets_;
   TBranch *jup_nGoodAK8PFJets_branch;
-  bool     jup_nGoodAK8PFJets_isLoaded;
+  unsigned long long jup_nGoodAK8PFJets_loadedGen;
+  FlatScalar<int> jup_nGoodAK8PFJets_flat;
+  BulkBranch *jup_nGoodAK8PFJets_bulk;
   vector<float> *jup_ak8pfjets_deepdisc_qcd_;
   TBranch *jup_ak8pfjets_deepdisc_qcd_branch;
-  bool     jup_ak8pfjets_deepdisc_qcd_isLoaded;
+  unsigned long long jup_ak8pfjets_deepdisc_qcd_loadedGen;
+  FlatObject<vector<float> > jup_ak8pfjets_deepdisc_qcd_flat;
   vector<float> *jup_ak8pfjets_deepdisc_top_;
   TBranch *jup_ak8pfjets_deepdisc_top_branch;
-  bool     jup_ak8pfjets_deepdisc_top_isLoaded;
+  unsigned long long jup_ak8pfjets_deepdisc_top_loadedGen;
+  FlatObject<vector<float> > jup_ak8pfjets_deepdisc_top_flat;
   vector<float> *jup_ak8pfjets_deepdisc_w_;
   TBranch *jup_ak8pfjets_deepdisc_w_branch;
-  bool     jup_ak8pfjets_deepdisc_w_isLoaded;
+  unsigned long long jup_ak8pfjets_deepdisc_w_loadedGen;
+  FlatObject<vector<float> > jup_ak8pfjets_deepdisc_w_flat;
   vector<float> *jup_ak8pfjets_deepdisc_z_;
   TBranch *jup_ak8pfjets_deepdisc_z_branch;
-  bool     jup_ak8pfjets_deepdisc_z_isLoaded;
+  unsigned long long jup_ak8pfjets_deepdisc_z_loadedGen;
+  FlatObject<vector<float> > jup_ak8pfjets_deepdisc_z_flat;
   vector<float> *jup_ak8pfjets_deepdisc_zbb_;
   TBranch *jup_ak8pfjets_deepdisc_zbb_branch;
-  bool     jup_ak8pfjets_deepdisc_zbb_isLoaded;
+  unsigned long long jup_ak8pfjets_deepdisc_zbb_loadedGen;
+  FlatObject<vector<float> > jup_ak8pfjets_deepdisc_zbb_flat;
   vector<float> *jup_ak8pfjets_deepdisc_hbb_;
   TBranch *jup_ak8pfjets_deepdisc_hbb_branch;
-  bool     jup_ak8pfjets_deepdisc_hbb_isLoaded;
+  unsigned long long jup_ak8pfjets_deepdisc_hbb_loadedGen;
+  FlatObject<vector<float> > jup_ak8pfjets_deepdisc_hbb_flat;
   vector<float> *jup_ak8pfjets_deepdisc_h4q_;
   TBranch *jup_ak8pfjets_deepdisc_h4q_branch;
-  bool     jup_ak8pfjets_deepdisc_h4q_isLoaded;
+  unsigned long long jup_ak8pfjets_deepdisc_h4q_loadedGen;
+  FlatObject<vector<float> > jup_ak8pfjets_deepdisc_h4q_flat;
   float    jup_lead_ak8deepdisc_top_;
   TBranch *jup_lead_ak8deepdisc_top_branch;
-  bool     jup_lead_ak8deepdisc_top_isLoaded;
+  unsigned long long jup_lead_ak8deepdisc_top_loadedGen;
+  FlatScalar<float> jup_lead_ak8deepdisc_top_flat;
+  BulkBranch *jup_lead_ak8deepdisc_top_bulk;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jdown_ak8pfjets_p4_;
   TBranch *jdown_ak8pfjets_p4_branch;
-  bool     jdown_ak8pfjets_p4_isLoaded;
+  unsigned long long jdown_ak8pfjets_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jdown_ak8pfjets_p4_flat;
+  PolarArrays jdown_ak8pfjets_p4_polar_;
+  unsigned long long jdown_ak8pfjets_p4_polarGen;
+  SplitP4Reader jdown_ak8pfjets_p4_split;
   vector<float> *jdown_ak8pfjets_tau1_;
   TBranch *jdown_ak8pfjets_tau1_branch;
-  bool     jdown_ak8pfjets_tau1_isLoaded;
+  unsigned long long jdown_ak8pfjets_tau1_loadedGen;
+  FlatObject<vector<float> > jdown_ak8pfjets_tau1_flat;
   vector<float> *jdown_ak8pfjets_tau2_;
   TBranch *jdown_ak8pfjets_tau2_branch;
-  bool     jdown_ak8pfjets_tau2_isLoaded;
+  unsigned long long jdown_ak8pfjets_tau2_loadedGen;
+  FlatObject<vector<float> > jdown_ak8pfjets_tau2_flat;
   vector<float> *jdown_ak8pfjets_tau3_;
   TBranch *jdown_ak8pfjets_tau3_branch;
-  bool     jdown_ak8pfjets_tau3_isLoaded;
+  unsigned long long jdown_ak8pfjets_tau3_loadedGen;
+  FlatObject<vector<float> > jdown_ak8pfjets_tau3_flat;
   vector<int> *jdown_ak8pfjets_parton_flavor_;
   TBranch *jdown_ak8pfjets_parton_flavor_branch;
-  bool     jdown_ak8pfjets_parton_flavor_isLoaded;
+  unsigned long long jdown_ak8pfjets_parton_flavor_loadedGen;
+  FlatObject<vector<int> > jdown_ak8pfjets_parton_flavor_flat;
   int      jdown_nGoodAK8PFJets_;
   TBranch *jdown_nGoodAK8PFJets_branch;
-  bool     jdown_nGoodAK8PFJets_isLoaded;
+  unsigned long long jdown_nGoodAK8PFJets_loadedGen;
+  FlatScalar<int> jdown_nGoodAK8PFJets_flat;
+  BulkBranch *jdown_nGoodAK8PFJets_bulk;
   vector<float> *jdown_ak8pfjets_deepdisc_qcd_;
   TBranch *jdown_ak8pfjets_deepdisc_qcd_branch;
-  bool     jdown_ak8pfjets_deepdisc_qcd_isLoaded;
+  unsigned long long jdown_ak8pfjets_deepdisc_qcd_loadedGen;
+  FlatObject<vector<float> > jdown_ak8pfjets_deepdisc_qcd_flat;
   vector<float> *jdown_ak8pfjets_deepdisc_top_;
   TBranch *jdown_ak8pfjets_deepdisc_top_branch;
-  bool     jdown_ak8pfjets_deepdisc_top_isLoaded;
+  unsigned long long jdown_ak8pfjets_deepdisc_top_loadedGen;
+  FlatObject<vector<float> > jdown_ak8pfjets_deepdisc_top_flat;
   vector<float> *jdown_ak8pfjets_deepdisc_w_;
   TBranch *jdown_ak8pfjets_deepdisc_w_branch;
-  bool     jdown_ak8pfjets_deepdisc_w_isLoaded;
+  unsigned long long jdown_ak8pfjets_deepdisc_w_loadedGen;
+  FlatObject<vector<float> > jdown_ak8pfjets_deepdisc_w_flat;
   vector<float> *jdown_ak8pfjets_deepdisc_z_;
   TBranch *jdown_ak8pfjets_deepdisc_z_branch;
-  bool     jdown_ak8pfjets_deepdisc_z_isLoaded;
+  unsigned long long jdown_ak8pfjets_deepdisc_z_loadedGen;
+  FlatObject<vector<float> > jdown_ak8pfjets_deepdisc_z_flat;
   vector<float> *jdown_ak8pfjets_deepdisc_zbb_;
   TBranch *jdown_ak8pfjets_deepdisc_zbb_branch;
-  bool     jdown_ak8pfjets_deepdisc_zbb_isLoaded;
+  unsigned long long jdown_ak8pfjets_deepdisc_zbb_loadedGen;
+  FlatObject<vector<float> > jdown_ak8pfjets_deepdisc_zbb_flat;
   vector<float> *jdown_ak8pfjets_deepdisc_hbb_;
   TBranch *jdown_ak8pfjets_deepdisc_hbb_branch;
-  bool     jdown_ak8pfjets_deepdisc_hbb_isLoaded;
+  unsigned long long jdown_ak8pfjets_deepdisc_hbb_loadedGen;
+  FlatObject<vector<float> > jdown_ak8pfjets_deepdisc_hbb_flat;
   vector<float> *jdown_ak8pfjets_deepdisc_h4q_;
   TBranch *jdown_ak8pfjets_deepdisc_h4q_branch;
-  bool     jdown_ak8pfjets_deepdisc_h4q_isLoaded;
+  unsigned long long jdown_ak8pfjets_deepdisc_h4q_loadedGen;
+  FlatObject<vector<float> > jdown_ak8pfjets_deepdisc_h4q_flat;
   float    jdown_lead_ak8deepdisc_top_;
   TBranch *jdown_lead_ak8deepdisc_top_branch;
-  bool     jdown_lead_ak8deepdisc_top_isLoaded;
+  unsigned long long jdown_lead_ak8deepdisc_top_loadedGen;
+  FlatScalar<float> jdown_lead_ak8deepdisc_top_flat;
+  BulkBranch *jdown_lead_ak8deepdisc_top_bulk;
   vector<float> *ak4pfjets_cvsl_;
   TBranch *ak4pfjets_cvsl_branch;
-  bool     ak4pfjets_cvsl_isLoaded;
+  unsigned long long ak4pfjets_cvsl_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_cvsl_flat;
   vector<float> *ak4pfjets_ptD_;
   TBranch *ak4pfjets_ptD_branch;
-  bool     ak4pfjets_ptD_isLoaded;
+  unsigned long long ak4pfjets_ptD_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_ptD_flat;
   vector<float> *ak4pfjets_axis1_;
   TBranch *ak4pfjets_axis1_branch;
-  bool     ak4pfjets_axis1_isLoaded;
+  unsigned long long ak4pfjets_axis1_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_axis1_flat;
   vector<float> *ak4pfjets_axis2_;
   TBranch *ak4pfjets_axis2_branch;
-  bool     ak4pfjets_axis2_isLoaded;
+  unsigned long long ak4pfjets_axis2_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_axis2_flat;
   vector<int> *ak4pfjets_mult_;
   TBranch *ak4pfjets_mult_branch;
-  bool     ak4pfjets_mult_isLoaded;
+  unsigned long long ak4pfjets_mult_loadedGen;
+  FlatObject<vector<int> > ak4pfjets_mult_flat;
   vector<float> *ak4pfjets_deepCSVb_;
   TBranch *ak4pfjets_deepCSVb_branch;
-  bool     ak4pfjets_deepCSVb_isLoaded;
+  unsigned long long ak4pfjets_deepCSVb_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_deepCSVb_flat;
   vector<float> *ak4pfjets_deepCSVbb_;
   TBranch *ak4pfjets_deepCSVbb_branch;
-  bool     ak4pfjets_deepCSVbb_isLoaded;
+  unsigned long long ak4pfjets_deepCSVbb_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_deepCSVbb_flat;
   vector<float> *ak4pfjets_deepCSVc_;
   TBranch *ak4pfjets_deepCSVc_branch;
-  bool     ak4pfjets_deepCSVc_isLoaded;
+  unsigned long long ak4pfjets_deepCSVc_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_deepCSVc_flat;
   vector<float> *ak4pfjets_deepCSVl_;
   TBranch *ak4pfjets_deepCSVl_branch;
-  bool     ak4pfjets_deepCSVl_isLoaded;
+  unsigned long long ak4pfjets_deepCSVl_loadedGen;
+  FlatObject<vector<float> > ak4pfjets_deepCSVl_flat;
   vector<vector<int> > *topcands_ak4idx_;
   TBranch *topcands_ak4idx_branch;
-  bool     topcands_ak4idx_isLoaded;
+  unsigned long long topcands_ak4idx_loadedGen;
   vector<float> *topcands_disc_;
   TBranch *topcands_disc_branch;
-  bool     topcands_disc_isLoaded;
+  unsigned long long topcands_disc_loadedGen;
+  FlatObject<vector<float> > topcands_disc_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *topcands_p4_;
   TBranch *topcands_p4_branch;
-  bool     topcands_p4_isLoaded;
+  unsigned long long topcands_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > topcands_p4_flat;
+  PolarArrays topcands_p4_polar_;
+  unsigned long long topcands_p4_polarGen;
+  SplitP4Reader topcands_p4_split;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *topcands_Wp4_;
   TBranch *topcands_Wp4_branch;
-  bool     topcands_Wp4_isLoaded;
+  unsigned long long topcands_Wp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > topcands_Wp4_flat;
+  PolarArrays topcands_Wp4_polar_;
+  unsigned long long topcands_Wp4_polarGen;
+  SplitP4Reader topcands_Wp4_split;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *tftops_p4_;
   TBranch *tftops_p4_branch;
-  bool     tftops_p4_isLoaded;
+  unsigned long long tftops_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > tftops_p4_flat;
+  PolarArrays tftops_p4_polar_;
+  unsigned long long tftops_p4_polarGen;
+  SplitP4Reader tftops_p4_split;
   vector<float> *tftops_disc_;
   TBranch *tftops_disc_branch;
-  bool     tftops_disc_isLoaded;
+  unsigned long long tftops_disc_loadedGen;
+  FlatObject<vector<float> > tftops_disc_flat;
   vector<vector<float> > *tftops_subjet_pt_;
   TBranch *tftops_subjet_pt_branch;
-  bool     tftops_subjet_pt_isLoaded;
+  unsigned long long tftops_subjet_pt_loadedGen;
   vector<vector<float> > *tftops_subjet_eta_;
   TBranch *tftops_subjet_eta_branch;
-  bool     tftops_subjet_eta_isLoaded;
+  unsigned long long tftops_subjet_eta_loadedGen;
   vector<vector<float> > *tftops_subjet_phi_;
   TBranch *tftops_subjet_phi_branch;
-  bool     tftops_subjet_phi_isLoaded;
+  unsigned long long tftops_subjet_phi_loadedGen;
   vector<float> *jup_ak4pfjets_cvsl_;
   TBranch *jup_ak4pfjets_cvsl_branch;
-  bool     jup_ak4pfjets_cvsl_isLoaded;
+  unsigned long long jup_ak4pfjets_cvsl_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_cvsl_flat;
   vector<float> *jup_ak4pfjets_ptD_;
   TBranch *jup_ak4pfjets_ptD_branch;
-  bool     jup_ak4pfjets_ptD_isLoaded;
+  unsigned long long jup_ak4pfjets_ptD_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_ptD_flat;
   vector<float> *jup_ak4pfjets_axis1_;
   TBranch *jup_ak4pfjets_axis1_branch;
-  bool     jup_ak4pfjets_axis1_isLoaded;
+  unsigned long long jup_ak4pfjets_axis1_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_axis1_flat;
   vector<float> *jup_ak4pfjets_axis2_;
   TBranch *jup_ak4pfjets_axis2_branch;
-  bool     jup_ak4pfjets_axis2_isLoaded;
+  unsigned long long jup_ak4pfjets_axis2_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_axis2_flat;
   vector<int> *jup_ak4pfjets_mult_;
   TBranch *jup_ak4pfjets_mult_branch;
-  bool     jup_ak4pfjets_mult_isLoaded;
+  unsigned long long jup_ak4pfjets_mult_loadedGen;
+  FlatObject<vector<int> > jup_ak4pfjets_mult_flat;
   vector<float> *jup_ak4pfjets_deepCSVb_;
   TBranch *jup_ak4pfjets_deepCSVb_branch;
-  bool     jup_ak4pfjets_deepCSVb_isLoaded;
+  unsigned long long jup_ak4pfjets_deepCSVb_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_deepCSVb_flat;
   vector<float> *jup_ak4pfjets_deepCSVbb_;
   TBranch *jup_ak4pfjets_deepCSVbb_branch;
-  bool     jup_ak4pfjets_deepCSVbb_isLoaded;
+  unsigned long long jup_ak4pfjets_deepCSVbb_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_deepCSVbb_flat;
   vector<float> *jup_ak4pfjets_deepCSVc_;
   TBranch *jup_ak4pfjets_deepCSVc_branch;
-  bool     jup_ak4pfjets_deepCSVc_isLoaded;
+  unsigned long long jup_ak4pfjets_deepCSVc_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_deepCSVc_flat;
   vector<float> *jup_ak4pfjets_deepCSVl_;
   TBranch *jup_ak4pfjets_deepCSVl_branch;
-  bool     jup_ak4pfjets_deepCSVl_isLoaded;
+  unsigned long long jup_ak4pfjets_deepCSVl_loadedGen;
+  FlatObject<vector<float> > jup_ak4pfjets_deepCSVl_flat;
   vector<vector<int> > *jup_topcands_ak4idx_;
   TBranch *jup_topcands_ak4idx_branch;
-  bool     jup_topcands_ak4idx_isLoaded;
+  unsigned long long jup_topcands_ak4idx_loadedGen;
   vector<float> *jup_topcands_disc_;
   TBranch *jup_topcands_disc_branch;
-  bool     jup_topcands_disc_isLoaded;
+  unsigned long long jup_topcands_disc_loadedGen;
+  FlatObject<vector<float> > jup_topcands_disc_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jup_topcands_p4_;
   TBranch *jup_topcands_p4_branch;
-  bool     jup_topcands_p4_isLoaded;
+  unsigned long long jup_topcands_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jup_topcands_p4_flat;
+  PolarArrays jup_topcands_p4_polar_;
+  unsigned long long jup_topcands_p4_polarGen;
+  SplitP4Reader jup_topcands_p4_split;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jup_topcands_Wp4_;
   TBranch *jup_topcands_Wp4_branch;
-  bool     jup_topcands_Wp4_isLoaded;
+  unsigned long long jup_topcands_Wp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jup_topcands_Wp4_flat;
+  PolarArrays jup_topcands_Wp4_polar_;
+  unsigned long long jup_topcands_Wp4_polarGen;
+  SplitP4Reader jup_topcands_Wp4_split;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jup_tftops_p4_;
   TBranch *jup_tftops_p4_branch;
-  bool     jup_tftops_p4_isLoaded;
+  unsigned long long jup_tftops_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jup_tftops_p4_flat;
+  PolarArrays jup_tftops_p4_polar_;
+  unsigned long long jup_tftops_p4_polarGen;
+  SplitP4Reader jup_tftops_p4_split;
   vector<float> *jup_tftops_disc_;
   TBranch *jup_tftops_disc_branch;
-  bool     jup_tftops_disc_isLoaded;
+  unsigned long long jup_tftops_disc_loadedGen;
+  FlatObject<vector<float> > jup_tftops_disc_flat;
   vector<vector<float> > *jup_tftops_subjet_pt_;
   TBranch *jup_tftops_subjet_pt_branch;
-  bool     jup_tftops_subjet_pt_isLoaded;
+  unsigned long long jup_tftops_subjet_pt_loadedGen;
   vector<vector<float> > *jup_tftops_subjet_eta_;
   TBranch *jup_tftops_subjet_eta_branch;
-  bool     jup_tftops_subjet_eta_isLoaded;
+  unsigned long long jup_tftops_subjet_eta_loadedGen;
   vector<vector<float> > *jup_tftops_subjet_phi_;
   TBranch *jup_tftops_subjet_phi_branch;
-  bool     jup_tftops_subjet_phi_isLoaded;
+  unsigned long long jup_tftops_subjet_phi_loadedGen;
   vector<float> *jdown_ak4pfjets_cvsl_;
   TBranch *jdown_ak4pfjets_cvsl_branch;
-  bool     jdown_ak4pfjets_cvsl_isLoaded;
+  unsigned long long jdown_ak4pfjets_cvsl_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_cvsl_flat;
   vector<float> *jdown_ak4pfjets_ptD_;
   TBranch *jdown_ak4pfjets_ptD_branch;
-  bool     jdown_ak4pfjets_ptD_isLoaded;
+  unsigned long long jdown_ak4pfjets_ptD_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_ptD_flat;
   vector<float> *jdown_ak4pfjets_axis1_;
   TBranch *jdown_ak4pfjets_axis1_branch;
-  bool     jdown_ak4pfjets_axis1_isLoaded;
+  unsigned long long jdown_ak4pfjets_axis1_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_axis1_flat;
   vector<float> *jdown_ak4pfjets_axis2_;
   TBranch *jdown_ak4pfjets_axis2_branch;
-  bool     jdown_ak4pfjets_axis2_isLoaded;
+  unsigned long long jdown_ak4pfjets_axis2_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_axis2_flat;
   vector<int> *jdown_ak4pfjets_mult_;
   TBranch *jdown_ak4pfjets_mult_branch;
-  bool     jdown_ak4pfjets_mult_isLoaded;
+  unsigned long long jdown_ak4pfjets_mult_loadedGen;
+  FlatObject<vector<int> > jdown_ak4pfjets_mult_flat;
   vector<float> *jdown_ak4pfjets_deepCSVb_;
   TBranch *jdown_ak4pfjets_deepCSVb_branch;
-  bool     jdown_ak4pfjets_deepCSVb_isLoaded;
+  unsigned long long jdown_ak4pfjets_deepCSVb_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_deepCSVb_flat;
   vector<float> *jdown_ak4pfjets_deepCSVbb_;
   TBranch *jdown_ak4pfjets_deepCSVbb_branch;
-  bool     jdown_ak4pfjets_deepCSVbb_isLoaded;
+  unsigned long long jdown_ak4pfjets_deepCSVbb_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_deepCSVbb_flat;
   vector<float> *jdown_ak4pfjets_deepCSVc_;
   TBranch *jdown_ak4pfjets_deepCSVc_branch;
-  bool     jdown_ak4pfjets_deepCSVc_isLoaded;
+  unsigned long long jdown_ak4pfjets_deepCSVc_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_deepCSVc_flat;
   vector<float> *jdown_ak4pfjets_deepCSVl_;
   TBranch *jdown_ak4pfjets_deepCSVl_branch;
-  bool     jdown_ak4pfjets_deepCSVl_isLoaded;
+  unsigned long long jdown_ak4pfjets_deepCSVl_loadedGen;
+  FlatObject<vector<float> > jdown_ak4pfjets_deepCSVl_flat;
   vector<vector<int> > *jdown_topcands_ak4idx_;
   TBranch *jdown_topcands_ak4idx_branch;
-  bool     jdown_topcands_ak4idx_isLoaded;
+  unsigned long long jdown_topcands_ak4idx_loadedGen;
   vector<float> *jdown_topcands_disc_;
   TBranch *jdown_topcands_disc_branch;
-  bool     jdown_topcands_disc_isLoaded;
+  unsigned long long jdown_topcands_disc_loadedGen;
+  FlatObject<vector<float> > jdown_topcands_disc_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jdown_topcands_p4_;
   TBranch *jdown_topcands_p4_branch;
-  bool     jdown_topcands_p4_isLoaded;
+  unsigned long long jdown_topcands_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jdown_topcands_p4_flat;
+  PolarArrays jdown_topcands_p4_polar_;
+  unsigned long long jdown_topcands_p4_polarGen;
+  SplitP4Reader jdown_topcands_p4_split;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jdown_topcands_Wp4_;
   TBranch *jdown_topcands_Wp4_branch;
-  bool     jdown_topcands_Wp4_isLoaded;
+  unsigned long long jdown_topcands_Wp4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jdown_topcands_Wp4_flat;
+  PolarArrays jdown_topcands_Wp4_polar_;
+  unsigned long long jdown_topcands_Wp4_polarGen;
+  SplitP4Reader jdown_topcands_Wp4_split;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *jdown_tftops_p4_;
   TBranch *jdown_tftops_p4_branch;
-  bool     jdown_tftops_p4_isLoaded;
+  unsigned long long jdown_tftops_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > jdown_tftops_p4_flat;
+  PolarArrays jdown_tftops_p4_polar_;
+  unsigned long long jdown_tftops_p4_polarGen;
+  SplitP4Reader jdown_tftops_p4_split;
   vector<float> *jdown_tftops_disc_;
   TBranch *jdown_tftops_disc_branch;
-  bool     jdown_tftops_disc_isLoaded;
+  unsigned long long jdown_tftops_disc_loadedGen;
+  FlatObject<vector<float> > jdown_tftops_disc_flat;
   vector<vector<float> > *jdown_tftops_subjet_pt_;
   TBranch *jdown_tftops_subjet_pt_branch;
-  bool     jdown_tftops_subjet_pt_isLoaded;
+  unsigned long long jdown_tftops_subjet_pt_loadedGen;
   vector<vector<float> > *jdown_tftops_subjet_eta_;
   TBranch *jdown_tftops_subjet_eta_branch;
-  bool     jdown_tftops_subjet_eta_isLoaded;
+  unsigned long long jdown_tftops_subjet_eta_loadedGen;
   vector<vector<float> > *jdown_tftops_subjet_phi_;
   TBranch *jdown_tftops_subjet_phi_branch;
-  bool     jdown_tftops_subjet_phi_isLoaded;
+  unsigned long long jdown_tftops_subjet_phi_loadedGen;
   vector<TString> *tau_IDnames_;
   TBranch *tau_IDnames_branch;
-  bool     tau_IDnames_isLoaded;
+  unsigned long long tau_IDnames_loadedGen;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *tau_p4_;
   TBranch *tau_p4_branch;
-  bool     tau_p4_isLoaded;
+  unsigned long long tau_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > tau_p4_flat;
+  PolarArrays tau_p4_polar_;
+  unsigned long long tau_p4_polarGen;
+  SplitP4Reader tau_p4_split;
   vector<vector<float> > *tau_ID_;
   TBranch *tau_ID_branch;
-  bool     tau_ID_isLoaded;
+  unsigned long long tau_ID_loadedGen;
   vector<float> *tau_passID_;
   TBranch *tau_passID_branch;
-  bool     tau_passID_isLoaded;
+  unsigned long long tau_passID_loadedGen;
+  FlatObject<vector<float> > tau_passID_flat;
   int      ngoodtaus_;
   TBranch *ngoodtaus_branch;
-  bool     ngoodtaus_isLoaded;
+  unsigned long long ngoodtaus_loadedGen;
+  FlatScalar<int> ngoodtaus_flat;
+  BulkBranch *ngoodtaus_bulk;
   vector<bool> *tau_isVetoTau_;
   TBranch *tau_isVetoTau_branch;
-  bool     tau_isVetoTau_isLoaded;
+  unsigned long long tau_isVetoTau_loadedGen;
+  FlatObject<vector<bool> > tau_isVetoTau_flat;
   vector<bool> *tau_isVetoTau_v2_;
   TBranch *tau_isVetoTau_v2_branch;
-  bool     tau_isVetoTau_v2_isLoaded;
+  unsigned long long tau_isVetoTau_v2_loadedGen;
+  FlatObject<vector<bool> > tau_isVetoTau_v2_flat;
   vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > *isoTracks_p4_;
   TBranch *isoTracks_p4_branch;
-  bool     isoTracks_p4_isLoaded;
+  unsigned long long isoTracks_p4_loadedGen;
+  FlatObject<vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > > isoTracks_p4_flat;
+  PolarArrays isoTracks_p4_polar_;
+  unsigned long long isoTracks_p4_polarGen;
+  SplitP4Reader isoTracks_p4_split;
   vector<int> *isoTracks_charge_;
   TBranch *isoTracks_charge_branch;
-  bool     isoTracks_charge_isLoaded;
+  unsigned long long isoTracks_charge_loadedGen;
+  FlatObject<vector<int> > isoTracks_charge_flat;
   vector<float> *isoTracks_absIso_;
   TBranch *isoTracks_absIso_branch;
-  bool     isoTracks_absIso_isLoaded;
+  unsigned long long isoTracks_absIso_loadedGen;
+  FlatObject<vector<float> > isoTracks_absIso_flat;
   vector<float> *isoTracks_dz_;
   TBranch *isoTracks_dz_branch;
-  bool     isoTracks_dz_isLoaded;
+  unsigned long long isoTracks_dz_loadedGen;
+  FlatObject<vector<float> > isoTracks_dz_flat;
   vector<int> *isoTracks_pdgId_;
   TBranch *isoTracks_pdgId_branch;
-  bool     isoTracks_pdgId_isLoaded;
+  unsigned long long isoTracks_pdgId_loadedGen;
+  FlatObject<vector<int> > isoTracks_pdgId_flat;
   vector<bool> *isoTracks_isVetoTrack_;
   TBranch *isoTracks_isVetoTrack_branch;
-  bool     isoTracks_isVetoTrack_isLoaded;
+  unsigned long long isoTracks_isVetoTrack_loadedGen;
+  FlatObject<vector<bool> > isoTracks_isVetoTrack_flat;
   vector<bool> *isoTracks_isVetoTrack_v2_;
   TBranch *isoTracks_isVetoTrack_v2_branch;
-  bool     isoTracks_isVetoTrack_v2_isLoaded;
+  unsigned long long isoTracks_isVetoTrack_v2_loadedGen;
+  FlatObject<vector<bool> > isoTracks_isVetoTrack_v2_flat;
   vector<bool> *isoTracks_isVetoTrack_v3_;
   TBranch *isoTracks_isVetoTrack_v3_branch;
-  bool     isoTracks_isVetoTrack_v3_isLoaded;
+  unsigned long long isoTracks_isVetoTrack_v3_loadedGen;
+  FlatObject<vector<bool> > isoTracks_isVetoTrack_v3_flat;
   int      ph_selectedidx_;
   TBranch *ph_selectedidx_branch;
-  bool     ph_selectedidx_isLoaded;
+  unsigned long long ph_selectedidx_loadedGen;
+  FlatScalar<int> ph_selectedidx_flat;
+  BulkBranch *ph_selectedidx_bulk;
   float    ph_met_;
   TBranch *ph_met_branch;
-  bool     ph_met_isLoaded;
+  unsigned long long ph_met_loadedGen;
+  FlatScalar<float> ph_met_flat;
+  BulkBranch *ph_met_bulk;
   float    ph_met_phi_;
   TBranch *ph_met_phi_branch;
-  bool     ph_met_phi_isLoaded;
+  unsigned long long ph_met_phi_loadedGen;
+  FlatScalar<float> ph_met_phi_flat;
+  BulkBranch *ph_met_phi_bulk;
   float    ph_HT_;
   TBranch *ph_HT_branch;
-  bool     ph_HT_isLoaded;
+  unsigned long long ph_HT_loadedGen;
+  FlatScalar<float> ph_HT_flat;
+  BulkBranch *ph_HT_bulk;
   float    ph_htssm_;
   TBranch *ph_htssm_branch;
-  bool     ph_htssm_isLoaded;
+  unsigned long long ph_htssm_loadedGen;
+  FlatScalar<float> ph_htssm_flat;
+  BulkBranch *ph_htssm_bulk;
   float    ph_htosm_;
   TBranch *ph_htosm_branch;
-  bool     ph_htosm_isLoaded;
+  unsigned long long ph_htosm_loadedGen;
+  FlatScalar<float> ph_htosm_flat;
+  BulkBranch *ph_htosm_bulk;
   float    ph_htratiom_;
   TBranch *ph_htratiom_branch;
-  bool     ph_htratiom_isLoaded;
+  unsigned long long ph_htratiom_loadedGen;
+  FlatScalar<float> ph_htratiom_flat;
+  BulkBranch *ph_htratiom_bulk;
   float    ph_mt_met_lep_;
   TBranch *ph_mt_met_lep_branch;
-  bool     ph_mt_met_lep_isLoaded;
+  unsigned long long ph_mt_met_lep_loadedGen;
+  FlatScalar<float> ph_mt_met_lep_flat;
+  BulkBranch *ph_mt_met_lep_bulk;
   float    ph_dphi_Wlep_;
   TBranch *ph_dphi_Wlep_branch;
-  bool     ph_dphi_Wlep_isLoaded;
+  unsigned long long ph_dphi_Wlep_loadedGen;
+  FlatScalar<float> ph_dphi_Wlep_flat;
+  BulkBranch *ph_dphi_Wlep_bulk;
   float    ph_MT2W_;
   TBranch *ph_MT2W_branch;
-  bool     ph_MT2W_isLoaded;
+  unsigned long long ph_MT2W_loadedGen;
+  FlatScalar<float> ph_MT2W_flat;
+  BulkBranch *ph_MT2W_bulk;
   float    ph_topness_;
   TBranch *ph_topness_branch;
-  bool     ph_topness_isLoaded;
+  unsigned long long ph_topness_loadedGen;
+  FlatScalar<float> ph_topness_flat;
+  BulkBranch *ph_topness_bulk;
   float    ph_topnessMod_;
   TBranch *ph_topnessMod_branch;
-  bool     ph_topnessMod_isLoaded;
+  unsigned long long ph_topnessMod_loadedGen;
+  FlatScalar<float> ph_topnessMod_flat;
+  BulkBranch *ph_topnessMod_bulk;
   float    ph_MT2_ll_;
   TBranch *ph_MT2_ll_branch;
-  bool     ph_MT2_ll_isLoaded;
+  unsigned long long ph_MT2_ll_loadedGen;
+  FlatScalar<float> ph_MT2_ll_flat;
+  BulkBranch *ph_MT2_ll_bulk;
   float    ph_MT2_lb_b_mass_;
   TBranch *ph_MT2_lb_b_mass_branch;
-  bool     ph_MT2_lb_b_mass_isLoaded;
+  unsigned long long ph_MT2_lb_b_mass_loadedGen;
+  FlatScalar<float> ph_MT2_lb_b_mass_flat;
+  BulkBranch *ph_MT2_lb_b_mass_bulk;
   float    ph_MT2_lb_b_;
   TBranch *ph_MT2_lb_b_branch;
-  bool     ph_MT2_lb_b_isLoaded;
+  unsigned long long ph_MT2_lb_b_loadedGen;
+  FlatScalar<float> ph_MT2_lb_b_flat;
+  BulkBranch *ph_MT2_lb_b_bulk;
   float    ph_MT2_lb_bqq_mass_;
   TBranch *ph_MT2_lb_bqq_mass_branch;
-  bool     ph_MT2_lb_bqq_mass_isLoaded;
+  unsigned long long ph_MT2_lb_bqq_mass_loadedGen;
+  FlatScalar<float> ph_MT2_lb_bqq_mass_flat;
+  BulkBranch *ph_MT2_lb_bqq_mass_bulk;
   float    ph_MT2_lb_bqq_;
   TBranch *ph_MT2_lb_bqq_branch;
-  bool     ph_MT2_lb_bqq_isLoaded;
+  unsigned long long ph_MT2_lb_bqq_loadedGen;
+  FlatScalar<float> ph_MT2_lb_bqq_flat;
+  BulkBranch *ph_MT2_lb_bqq_bulk;
   float    ph_hadronic_top_chi2_;
   TBranch *ph_hadronic_top_chi2_branch;
-  bool     ph_hadronic_top_chi2_isLoaded;
+  unsigned long long ph_hadronic_top_chi2_loadedGen;
+  FlatScalar<float> ph_hadronic_top_chi2_flat;
+  BulkBranch *ph_hadronic_top_chi2_bulk;
   float    ph_mindphi_met_j1_j2_;
   TBranch *ph_mindphi_met_j1_j2_branch;
-  bool     ph_mindphi_met_j1_j2_isLoaded;
+  unsigned long long ph_mindphi_met_j1_j2_loadedGen;
+  FlatScalar<float> ph_mindphi_met_j1_j2_flat;
+  BulkBranch *ph_mindphi_met_j1_j2_bulk;
   float    ph_Mlb_lead_bdiscr_;
   TBranch *ph_Mlb_lead_bdiscr_branch;
-  bool     ph_Mlb_lead_bdiscr_isLoaded;
+  unsigned long long ph_Mlb_lead_bdiscr_loadedGen;
+  FlatScalar<float> ph_Mlb_lead_bdiscr_flat;
+  BulkBranch *ph_Mlb_lead_bdiscr_bulk;
   float    ph_dR_lep_leadb_;
   TBranch *ph_dR_lep_leadb_branch;
-  bool     ph_dR_lep_leadb_isLoaded;
+  unsigned long long ph_dR_lep_leadb_loadedGen;
+  FlatScalar<float> ph_dR_lep_leadb_flat;
+  BulkBranch *ph_dR_lep_leadb_bulk;
   float    ph_Mlb_closestb_;
   TBranch *ph_Mlb_closestb_branch;
-  bool     ph_Mlb_closestb_isLoaded;
+  unsigned long long ph_Mlb_closestb_loadedGen;
+  FlatScalar<float> ph_Mlb_closestb_flat;
+  BulkBranch *ph_Mlb_closestb_bulk;
   float    ph_Mjjj_;
   TBranch *ph_Mjjj_branch;
-  bool     ph_Mjjj_isLoaded;
+  unsigned long long ph_Mjjj_loadedGen;
+  FlatScalar<float> ph_Mjjj_flat;
+  BulkBranch *ph_Mjjj_bulk;
   float    EA_fixgridfastjet_all_rho_;
   TBranch *EA_fixgridfastjet_all_rho_branch;
-  bool     EA_fixgridfastjet_all_rho_isLoaded;
+  unsigned long long EA_fixgridfastjet_all_rho_loadedGen;
+  FlatScalar<float> EA_fixgridfastjet_all_rho_flat;
+  BulkBranch *EA_fixgridfastjet_all_rho_bulk;
   int      HLT_Photon22_R9Id90_HE10_IsoM_;
   TBranch *HLT_Photon22_R9Id90_HE10_IsoM_branch;
-  bool     HLT_Photon22_R9Id90_HE10_IsoM_isLoaded;
+  unsigned long long HLT_Photon22_R9Id90_HE10_IsoM_loadedGen;
+  FlatScalar<int> HLT_Photon22_R9Id90_HE10_IsoM_flat;
+  BulkBranch *HLT_Photon22_R9Id90_HE10_IsoM_bulk;
   int      HLT_Photon30_R9Id90_HE10_IsoM_;
   TBranch *HLT_Photon30_R9Id90_HE10_IsoM_branch;
-  bool     HLT_Photon30_R9Id90_HE10_IsoM_isLoaded;
+  unsigned long long HLT_Photon30_R9Id90_HE10_IsoM_loadedGen;
+  FlatScalar<int> HLT_Photon30_R9Id90_HE10_IsoM_flat;
+  BulkBranch *HLT_Photon30_R9Id90_HE10_IsoM_bulk;
   int      HLT_Photon36_R9Id90_HE10_IsoM_;
   TBranch *HLT_Photon36_R9Id90_HE10_IsoM_branch;
-  bool     HLT_Photon36_R9Id90_HE10_IsoM_isLoaded;
+  unsigned long long HLT_Photon36_R9Id90_HE10_IsoM_loadedGen;
+  FlatScalar<int> HLT_Photon36_R9Id90_HE10_IsoM_flat;
+  BulkBranch *HLT_Photon36_R9Id90_HE10_IsoM_bulk;
   int      HLT_Photon50_R9Id90_HE10_IsoM_;
   TBranch *HLT_Photon50_R9Id90_HE10_IsoM_branch;
-  bool     HLT_Photon50_R9Id90_HE10_IsoM_isLoaded;
+  unsigned long long HLT_Photon50_R9Id90_HE10_IsoM_loadedGen;
+  FlatScalar<int> HLT_Photon50_R9Id90_HE10_IsoM_flat;
+  BulkBranch *HLT_Photon50_R9Id90_HE10_IsoM_bulk;
   int      HLT_Photon75_R9Id90_HE10_IsoM_;
   TBranch *HLT_Photon75_R9Id90_HE10_IsoM_branch;
-  bool     HLT_Photon75_R9Id90_HE10_IsoM_isLoaded;
+  unsigned long long HLT_Photon75_R9Id90_HE10_IsoM_loadedGen;
+  FlatScalar<int> HLT_Photon75_R9Id90_HE10_IsoM_flat;
+  BulkBranch *HLT_Photon75_R9Id90_HE10_IsoM_bulk;
   int      HLT_Photon90_R9Id90_HE10_IsoM_;
   TBranch *HLT_Photon90_R9Id90_HE10_IsoM_branch;
-  bool     HLT_Photon90_R9Id90_HE10_IsoM_isLoaded;
+  unsigned long long HLT_Photon90_R9Id90_HE10_IsoM_loadedGen;
+  FlatScalar<int> HLT_Photon90_R9Id90_HE10_IsoM_flat;
+  BulkBranch *HLT_Photon90_R9Id90_HE10_IsoM_bulk;
   int      HLT_Photon120_R9Id90_HE10_IsoM_;
   TBranch *HLT_Photon120_R9Id90_HE10_IsoM_branch;
-  bool     HLT_Photon120_R9Id90_HE10_IsoM_isLoaded;
+  unsigned long long HLT_Photon120_R9Id90_HE10_IsoM_loadedGen;
+  FlatScalar<int> HLT_Photon120_R9Id90_HE10_IsoM_flat;
+  BulkBranch *HLT_Photon120_R9Id90_HE10_IsoM_bulk;
   int      HLT_Photon165_R9Id90_HE10_IsoM_;
   TBranch *HLT_Photon165_R9Id90_HE10_IsoM_branch;
-  bool     HLT_Photon165_R9Id90_HE10_IsoM_isLoaded;
+  unsigned long long HLT_Photon165_R9Id90_HE10_IsoM_loadedGen;
+  FlatScalar<int> HLT_Photon165_R9Id90_HE10_IsoM_flat;
+  BulkBranch *HLT_Photon165_R9Id90_HE10_IsoM_bulk;
   int      HLT_Photon175_;
   TBranch *HLT_Photon175_branch;
-  bool     HLT_Photon175_isLoaded;
+  unsigned long long HLT_Photon175_loadedGen;
+  FlatScalar<int> HLT_Photon175_flat;
+  BulkBranch *HLT_Photon175_bulk;
   int      HLT_Photon165_HE10_;
   TBranch *HLT_Photon165_HE10_branch;
-  bool     HLT_Photon165_HE10_isLoaded;
+  unsigned long long HLT_Photon165_HE10_loadedGen;
+  FlatScalar<int> HLT_Photon165_HE10_flat;
+  BulkBranch *HLT_Photon165_HE10_bulk;
   int      HLT_Photon120_;
   TBranch *HLT_Photon120_branch;
-  bool     HLT_Photon120_isLoaded;
+  unsigned long long HLT_Photon120_loadedGen;
+  FlatScalar<int> HLT_Photon120_flat;
+  BulkBranch *HLT_Photon120_bulk;
   int      HLT_Photon200_;
   TBranch *HLT_Photon200_branch;
-  bool     HLT_Photon200_isLoaded;
+  unsigned long long HLT_Photon200_loadedGen;
+  FlatScalar<int> HLT_Photon200_flat;
+  BulkBranch *HLT_Photon200_bulk;
   int      HLT_Photon250_NoHE_;
   TBranch *HLT_Photon250_NoHE_branch;
-  bool     HLT_Photon250_NoHE_isLoaded;
+  unsigned long long HLT_Photon250_NoHE_loadedGen;
+  FlatScalar<int> HLT_Photon250_NoHE_flat;
+  BulkBranch *HLT_Photon250_NoHE_bulk;
   int      HLT_Photon300_NoHE_;
   TBranch *HLT_Photon300_NoHE_branch;
-  bool     HLT_Photon300_NoHE_isLoaded;
+  unsigned long long HLT_Photon300_NoHE_loadedGen;
+  FlatScalar<int> HLT_Photon300_NoHE_flat;
+  BulkBranch *HLT_Photon300_NoHE_bulk;
+  unsigned int HLT_bits_;
+  TBranch *HLT_bits_branch;
+  unsigned long long HLT_bits_loadedGen;
+  FlatScalar<unsigned int> HLT_bits_flat;
+  BulkBranch *HLT_bits_bulk;
   bool     filt_cscbeamhalo_;
   TBranch *filt_cscbeamhalo_branch;
-  bool     filt_cscbeamhalo_isLoaded;
+  unsigned long long filt_cscbeamhalo_loadedGen;
+  FlatScalar<bool> filt_cscbeamhalo_flat;
+  BulkBranch *filt_cscbeamhalo_bulk;
   bool     filt_cscbeamhalo2015_;
   TBranch *filt_cscbeamhalo2015_branch;
-  bool     filt_cscbeamhalo2015_isLoaded;
+  unsigned long long filt_cscbeamhalo2015_loadedGen;
+  FlatScalar<bool> filt_cscbeamhalo2015_flat;
+  BulkBranch *filt_cscbeamhalo2015_bulk;
   bool     filt_globaltighthalo2016_;
   TBranch *filt_globaltighthalo2016_branch;
-  bool     filt_globaltighthalo2016_isLoaded;
+  unsigned long long filt_globaltighthalo2016_loadedGen;
+  FlatScalar<bool> filt_globaltighthalo2016_flat;
+  BulkBranch *filt_globaltighthalo2016_bulk;
   bool     filt_globalsupertighthalo2016_;
   TBranch *filt_globalsupertighthalo2016_branch;
-  bool     filt_globalsupertighthalo2016_isLoaded;
+  unsigned long long filt_globalsupertighthalo2016_loadedGen;
+  FlatScalar<bool> filt_globalsupertighthalo2016_flat;
+  BulkBranch *filt_globalsupertighthalo2016_bulk;
   bool     filt_ecallaser_;
   TBranch *filt_ecallaser_branch;
-  bool     filt_ecallaser_isLoaded;
+  unsigned long long filt_ecallaser_loadedGen;
+  FlatScalar<bool> filt_ecallaser_flat;
+  BulkBranch *filt_ecallaser_bulk;
   bool     filt_ecaltp_;
   TBranch *filt_ecaltp_branch;
-  bool     filt_ecaltp_isLoaded;
+  unsigned long long filt_ecaltp_loadedGen;
+  FlatScalar<bool> filt_ecaltp_flat;
+  BulkBranch *filt_ecaltp_bulk;
   bool     filt_ecalbadcalib_;
   TBranch *filt_ecalbadcalib_branch;
-  bool     filt_ecalbadcalib_isLoaded;
+  unsigned long long filt_ecalbadcalib_loadedGen;
+  FlatScalar<bool> filt_ecalbadcalib_flat;
+  BulkBranch *filt_ecalbadcalib_bulk;
   bool     filt_eebadsc_;
   TBranch *filt_eebadsc_branch;
-  bool     filt_eebadsc_isLoaded;
+  unsigned long long filt_eebadsc_loadedGen;
+  FlatScalar<bool> filt_eebadsc_flat;
+  BulkBranch *filt_eebadsc_bulk;
   bool     filt_goodvtx_;
   TBranch *filt_goodvtx_branch;
-  bool     filt_goodvtx_isLoaded;
+  unsigned long long filt_goodvtx_loadedGen;
+  FlatScalar<bool> filt_goodvtx_flat;
+  BulkBranch *filt_goodvtx_bulk;
   bool     filt_badevents_;
   TBranch *filt_badevents_branch;
-  bool     filt_badevents_isLoaded;
+  unsigned long long filt_badevents_loadedGen;
+  FlatScalar<bool> filt_badevents_flat;
+  BulkBranch *filt_badevents_bulk;
   bool     filt_hbhenoise_;
   TBranch *filt_hbhenoise_branch;
-  bool     filt_hbhenoise_isLoaded;
+  unsigned long long filt_hbhenoise_loadedGen;
+  FlatScalar<bool> filt_hbhenoise_flat;
+  BulkBranch *filt_hbhenoise_bulk;
   bool     filt_hbheisonoise_;
   TBranch *filt_hbheisonoise_branch;
-  bool     filt_hbheisonoise_isLoaded;
+  unsigned long long filt_hbheisonoise_loadedGen;
+  FlatScalar<bool> filt_hbheisonoise_flat;
+  BulkBranch *filt_hbheisonoise_bulk;
   bool     filt_hcallaser_;
   TBranch *filt_hcallaser_branch;
-  bool     filt_hcallaser_isLoaded;
+  unsigned long long filt_hcallaser_loadedGen;
+  FlatScalar<bool> filt_hcallaser_flat;
+  BulkBranch *filt_hcallaser_bulk;
   bool     filt_trkfail_;
   TBranch *filt_trkfail_branch;
-  bool     filt_trkfail_isLoaded;
+  unsigned long long filt_trkfail_loadedGen;
+  FlatScalar<bool> filt_trkfail_flat;
+  BulkBranch *filt_trkfail_bulk;
   bool     filt_trkPOG_;
   TBranch *filt_trkPOG_branch;
-  bool     filt_trkPOG_isLoaded;
+  unsigned long long filt_trkPOG_loadedGen;
+  FlatScalar<bool> filt_trkPOG_flat;
+  BulkBranch *filt_trkPOG_bulk;
   bool     filt_trkPOG_logerr_tmc_;
   TBranch *filt_trkPOG_logerr_tmc_branch;
-  bool     filt_trkPOG_logerr_tmc_isLoaded;
+  unsigned long long filt_trkPOG_logerr_tmc_loadedGen;
+  FlatScalar<bool> filt_trkPOG_logerr_tmc_flat;
+  BulkBranch *filt_trkPOG_logerr_tmc_bulk;
   bool     filt_trkPOG_tmc_;
   TBranch *filt_trkPOG_tmc_branch;
-  bool     filt_trkPOG_tmc_isLoaded;
+  unsigned long long filt_trkPOG_tmc_loadedGen;
+  FlatScalar<bool> filt_trkPOG_tmc_flat;
+  BulkBranch *filt_trkPOG_tmc_bulk;
   bool     filt_trkPOG_tms_;
   TBranch *filt_trkPOG_tms_branch;
-  bool     filt_trkPOG_tms_isLoaded;
+  unsigned long long filt_trkPOG_tms_loadedGen;
+  FlatScalar<bool> filt_trkPOG_tms_flat;
+  BulkBranch *filt_trkPOG_tms_bulk;
   int      firstGoodVtxIdx_;
   TBranch *firstGoodVtxIdx_branch;
-  bool     firstGoodVtxIdx_isLoaded;
+  unsigned long long firstGoodVtxIdx_loadedGen;
+  FlatScalar<int> firstGoodVtxIdx_flat;
+  BulkBranch *firstGoodVtxIdx_bulk;
   bool     filt_badChargedCandidateFilter_;
   TBranch *filt_badChargedCandidateFilter_branch;
-  bool     filt_badChargedCandidateFilter_isLoaded;
+  unsigned long long filt_badChargedCandidateFilter_loadedGen;
+  FlatScalar<bool> filt_badChargedCandidateFilter_flat;
+  BulkBranch *filt_badChargedCandidateFilter_bulk;
   bool     filt_badMuonFilter_;
   TBranch *filt_badMuonFilter_branch;
-  bool     filt_badMuonFilter_isLoaded;
+  unsigned long long filt_badMuonFilter_loadedGen;
+  FlatScalar<bool> filt_badMuonFilter_flat;
+  BulkBranch *filt_badMuonFilter_bulk;
   bool     filt_met_;
   TBranch *filt_met_branch;
-  bool     filt_met_isLoaded;
+  unsigned long long filt_met_loadedGen;
+  FlatScalar<bool> filt_met_flat;
+  BulkBranch *filt_met_bulk;
   bool     filt_fastsimjets_;
   TBranch *filt_fastsimjets_branch;
-  bool     filt_fastsimjets_isLoaded;
+  unsigned long long filt_fastsimjets_loadedGen;
+  FlatScalar<bool> filt_fastsimjets_flat;
+  BulkBranch *filt_fastsimjets_bulk;
   bool     filt_fastsimjets_jup_;
   TBranch *filt_fastsimjets_jup_branch;
-  bool     filt_fastsimjets_jup_isLoaded;
+  unsigned long long filt_fastsimjets_jup_loadedGen;
+  FlatScalar<bool> filt_fastsimjets_jup_flat;
+  BulkBranch *filt_fastsimjets_jup_bulk;
   bool     filt_fastsimjets_jdown_;
   TBranch *filt_fastsimjets_jdown_branch;
-  bool     filt_fastsimjets_jdown_isLoaded;
+  unsigned long long filt_fastsimjets_jdown_loadedGen;
+  FlatScalar<bool> filt_fastsimjets_jdown_flat;
+  BulkBranch *filt_fastsimjets_jdown_bulk;
   bool     filt_jetWithBadMuon_;
   TBranch *filt_jetWithBadMuon_branch;
-  bool     filt_jetWithBadMuon_isLoaded;
+  unsigned long long filt_jetWithBadMuon_loadedGen;
+  FlatScalar<bool> filt_jetWithBadMuon_flat;
+  BulkBranch *filt_jetWithBadMuon_bulk;
   bool     filt_jetWithBadMuon_jup_;
   TBranch *filt_jetWithBadMuon_jup_branch;
-  bool     filt_jetWithBadMuon_jup_isLoaded;
+  unsigned long long filt_jetWithBadMuon_jup_loadedGen;
+  FlatScalar<bool> filt_jetWithBadMuon_jup_flat;
+  BulkBranch *filt_jetWithBadMuon_jup_bulk;
   bool     filt_jetWithBadMuon_jdown_;
   TBranch *filt_jetWithBadMuon_jdown_branch;
-  bool     filt_jetWithBadMuon_jdown_isLoaded;
+  unsigned long long filt_jetWithBadMuon_jdown_loadedGen;
+  FlatScalar<bool> filt_jetWithBadMuon_jdown_flat;
+  BulkBranch *filt_jetWithBadMuon_jdown_bulk;
   bool     filt_pfovercalomet_;
   TBranch *filt_pfovercalomet_branch;
-  bool     filt_pfovercalomet_isLoaded;
+  unsigned long long filt_pfovercalomet_loadedGen;
+  FlatScalar<bool> filt_pfovercalomet_flat;
+  BulkBranch *filt_pfovercalomet_bulk;
   bool     filt_badmuons_;
   TBranch *filt_badmuons_branch;
-  bool     filt_badmuons_isLoaded;
+  unsigned long long filt_badmuons_loadedGen;
+  FlatScalar<bool> filt_badmuons_flat;
+  BulkBranch *filt_badmuons_bulk;
   bool     filt_duplicatemuons_;
   TBranch *filt_duplicatemuons_branch;
-  bool     filt_duplicatemuons_isLoaded;
+  unsigned long long filt_duplicatemuons_loadedGen;
+  FlatScalar<bool> filt_duplicatemuons_flat;
+  BulkBranch *filt_duplicatemuons_bulk;
   bool     filt_nobadmuons_;
   TBranch *filt_nobadmuons_branch;
-  bool     filt_nobadmuons_isLoaded;
+  unsigned long long filt_nobadmuons_loadedGen;
+  FlatScalar<bool> filt_nobadmuons_flat;
+  BulkBranch *filt_nobadmuons_bulk;
 public: 
 void Init(TTree *tree);
 void GetEntry(unsigned int idx); 
+unsigned long long GetGeneration() const { return entryGeneration; }
+// Read these scalar branches a basket at a time, takes effect from the next Init
+void SetBulkRead(const vector<string>& branches) { bulkRead.SetBranches(branches); }
+// Read the branches with a column in the flat skim of the tree from it, until the next Init
+void SetFlatSkim(FlatSkim* skim);
 void LoadAllBranches(); 
   const unsigned int &run();
   const unsigned int &ls();
@@ -1982,7 +3033,9 @@ void LoadAllBranches();
   const bool &lep1_passTightID();
   const bool &lep1_passVeto();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep1_p4();
+  const PolarP4 &lep1_p4_polar();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep1_mcp4();
+  const PolarP4 &lep1_mcp4_polar();
   const int &lep1_mc_motherid();
   const float &lep1_etaSC();
   const float &lep1_dphiMET();
@@ -2000,7 +3053,9 @@ void LoadAllBranches();
   const bool &lep2_passTightID();
   const bool &lep2_passVeto();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep2_p4();
+  const PolarP4 &lep2_p4_polar();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep2_mcp4();
+  const PolarP4 &lep2_mcp4_polar();
   const int &lep2_mc_motherid();
   const float &lep2_etaSC();
   const float &lep2_dphiMET();
@@ -2020,7 +3075,9 @@ void LoadAllBranches();
   const vector<bool> &ph_passTightID();
   const vector<int> &ph_overlapJetId();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ph_p4();
+  const PolarArrays &ph_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ph_mcp4();
+  const PolarArrays &ph_mcp4_polar();
   const vector<int> &ph_mcMatchId();
   const vector<float> &ph_genIso04();
   const vector<float> &ph_drMinParton();
@@ -2037,6 +3094,7 @@ void LoadAllBranches();
   const float &ak4_htratiom();
   const vector<float> &dphi_ak4pfjet_met();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ak4pfjets_p4();
+  const PolarArrays &ak4pfjets_p4_polar();
   const vector<bool> &ak4pfjets_passMEDbtag();
   const vector<float> &ak4pfjets_deepCSV();
   const vector<float> &ak4pfjets_CSV();
@@ -2046,9 +3104,13 @@ void LoadAllBranches();
   const vector<bool> &ak4pfjets_loose_puid();
   const vector<bool> &ak4pfjets_loose_pfid();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &ak4pfjets_leadMEDbjet_p4();
+  const PolarP4 &ak4pfjets_leadMEDbjet_p4_polar();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &ak4pfjets_leadbtag_p4();
+  const PolarP4 &ak4pfjets_leadbtag_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ak4genjets_p4();
+  const PolarArrays &ak4genjets_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &softtags_p4();
+  const PolarArrays &softtags_p4_polar();
   const int &nsoftbtags();
   const int &jup_nskimjets();
   const int &jup_nskimbtagmed();
@@ -2063,6 +3125,7 @@ void LoadAllBranches();
   const float &jup_ak4_htratiom();
   const vector<float> &jup_dphi_ak4pfjet_met();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_ak4pfjets_p4();
+  const PolarArrays &jup_ak4pfjets_p4_polar();
   const vector<bool> &jup_ak4pfjets_passMEDbtag();
   const vector<float> &jup_ak4pfjets_deepCSV();
   const vector<float> &jup_ak4pfjets_CSV();
@@ -2072,9 +3135,13 @@ void LoadAllBranches();
   const vector<bool> &jup_ak4pfjets_loose_puid();
   const vector<bool> &jup_ak4pfjets_loose_pfid();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jup_ak4pfjets_leadMEDbjet_p4();
+  const PolarP4 &jup_ak4pfjets_leadMEDbjet_p4_polar();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jup_ak4pfjets_leadbtag_p4();
+  const PolarP4 &jup_ak4pfjets_leadbtag_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_ak4genjets_p4();
+  const PolarArrays &jup_ak4genjets_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_softtags_p4();
+  const PolarArrays &jup_softtags_p4_polar();
   const int &jup_nsoftbtags();
   const int &jdown_nskimjets();
   const int &jdown_nskimbtagmed();
@@ -2089,6 +3156,7 @@ void LoadAllBranches();
   const float &jdown_ak4_htratiom();
   const vector<float> &jdown_dphi_ak4pfjet_met();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_ak4pfjets_p4();
+  const PolarArrays &jdown_ak4pfjets_p4_polar();
   const vector<bool> &jdown_ak4pfjets_passMEDbtag();
   const vector<float> &jdown_ak4pfjets_deepCSV();
   const vector<float> &jdown_ak4pfjets_CSV();
@@ -2098,12 +3166,17 @@ void LoadAllBranches();
   const vector<bool> &jdown_ak4pfjets_loose_puid();
   const vector<bool> &jdown_ak4pfjets_loose_pfid();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jdown_ak4pfjets_leadMEDbjet_p4();
+  const PolarP4 &jdown_ak4pfjets_leadMEDbjet_p4_polar();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jdown_ak4pfjets_leadbtag_p4();
+  const PolarP4 &jdown_ak4pfjets_leadbtag_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_ak4genjets_p4();
+  const PolarArrays &jdown_ak4genjets_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_softtags_p4();
+  const PolarArrays &jdown_softtags_p4_polar();
   const int &jdown_nsoftbtags();
   const vector<bool> &genleps_isfromt();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genleps_p4();
+  const PolarArrays &genleps_p4_polar();
   const vector<int> &genleps_id();
   const vector<int> &genleps__genpsidx();
   const vector<int> &genleps_status();
@@ -2114,15 +3187,18 @@ void LoadAllBranches();
   const vector<int> &genleps_gentaudecay();
   const int &gen_nfromtleps_();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genleps_motherp4();
+  const PolarArrays &genleps_motherp4_polar();
   const vector<int> &genleps_motherid();
   const vector<int> &genleps_motheridx();
   const vector<int> &genleps_motherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genleps_gmotherp4();
+  const PolarArrays &genleps_gmotherp4_polar();
   const vector<int> &genleps_gmotherid();
   const vector<int> &genleps_gmotheridx();
   const vector<int> &genleps_gmotherstatus();
   const vector<bool> &gennus_isfromt();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gennus_p4();
+  const PolarArrays &gennus_p4_polar();
   const vector<int> &gennus_id();
   const vector<int> &gennus__genpsidx();
   const vector<int> &gennus_status();
@@ -2133,15 +3209,18 @@ void LoadAllBranches();
   const vector<int> &gennus_gentaudecay();
   const int &gen_nfromtnus_();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gennus_motherp4();
+  const PolarArrays &gennus_motherp4_polar();
   const vector<int> &gennus_motherid();
   const vector<int> &gennus_motheridx();
   const vector<int> &gennus_motherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gennus_gmotherp4();
+  const PolarArrays &gennus_gmotherp4_polar();
   const vector<int> &gennus_gmotherid();
   const vector<int> &gennus_gmotheridx();
   const vector<int> &gennus_gmotherstatus();
   const vector<bool> &genqs_isfromt();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genqs_p4();
+  const PolarArrays &genqs_p4_polar();
   const vector<int> &genqs_id();
   const vector<int> &genqs__genpsidx();
   const vector<int> &genqs_status();
@@ -2152,15 +3231,18 @@ void LoadAllBranches();
   const vector<int> &genqs_gentaudecay();
   const int &gen_nfromtqs_();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genqs_motherp4();
+  const PolarArrays &genqs_motherp4_polar();
   const vector<int> &genqs_motherid();
   const vector<int> &genqs_motheridx();
   const vector<int> &genqs_motherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genqs_gmotherp4();
+  const PolarArrays &genqs_gmotherp4_polar();
   const vector<int> &genqs_gmotherid();
   const vector<int> &genqs_gmotheridx();
   const vector<int> &genqs_gmotherstatus();
   const vector<bool> &genbosons_isfromt();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genbosons_p4();
+  const PolarArrays &genbosons_p4_polar();
   const vector<int> &genbosons_id();
   const vector<int> &genbosons__genpsidx();
   const vector<int> &genbosons_status();
@@ -2171,15 +3253,18 @@ void LoadAllBranches();
   const vector<int> &genbosons_gentaudecay();
   const int &gen_nfromtbosons_();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genbosons_motherp4();
+  const PolarArrays &genbosons_motherp4_polar();
   const vector<int> &genbosons_motherid();
   const vector<int> &genbosons_motheridx();
   const vector<int> &genbosons_motherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genbosons_gmotherp4();
+  const PolarArrays &genbosons_gmotherp4_polar();
   const vector<int> &genbosons_gmotherid();
   const vector<int> &genbosons_gmotheridx();
   const vector<int> &genbosons_gmotherstatus();
   const vector<bool> &gensusy_isfromt();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gensusy_p4();
+  const PolarArrays &gensusy_p4_polar();
   const vector<int> &gensusy_id();
   const vector<int> &gensusy__genpsidx();
   const vector<int> &gensusy_status();
@@ -2190,14 +3275,17 @@ void LoadAllBranches();
   const vector<int> &gensusy_gentaudecay();
   const int &gen_nfromtsusy_();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gensusy_motherp4();
+  const PolarArrays &gensusy_motherp4_polar();
   const vector<int> &gensusy_motherid();
   const vector<int> &gensusy_motheridx();
   const vector<int> &gensusy_motherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gensusy_gmotherp4();
+  const PolarArrays &gensusy_gmotherp4_polar();
   const vector<int> &gensusy_gmotherid();
   const vector<int> &gensusy_gmotheridx();
   const vector<int> &gensusy_gmotherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ak8pfjets_p4();
+  const PolarArrays &ak8pfjets_p4_polar();
   const vector<float> &ak8pfjets_tau1();
   const vector<float> &ak8pfjets_tau2();
   const vector<float> &ak8pfjets_tau3();
@@ -2212,6 +3300,7 @@ void LoadAllBranches();
   const vector<float> &ak8pfjets_deepdisc_h4q();
   const float &lead_ak8deepdisc_top();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_ak8pfjets_p4();
+  const PolarArrays &jup_ak8pfjets_p4_polar();
   const vector<float> &jup_ak8pfjets_tau1();
   const vector<float> &jup_ak8pfjets_tau2();
   const vector<float> &jup_ak8pfjets_tau3();
@@ -2226,6 +3315,7 @@ void LoadAllBranches();
   const vector<float> &jup_ak8pfjets_deepdisc_h4q();
   const float &jup_lead_ak8deepdisc_top();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_ak8pfjets_p4();
+  const PolarArrays &jdown_ak8pfjets_p4_polar();
   const vector<float> &jdown_ak8pfjets_tau1();
   const vector<float> &jdown_ak8pfjets_tau2();
   const vector<float> &jdown_ak8pfjets_tau3();
@@ -2251,8 +3341,11 @@ void LoadAllBranches();
   const vector<vector<int> > &topcands_ak4idx();
   const vector<float> &topcands_disc();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &topcands_p4();
+  const PolarArrays &topcands_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &topcands_Wp4();
+  const PolarArrays &topcands_Wp4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &tftops_p4();
+  const PolarArrays &tftops_p4_polar();
   const vector<float> &tftops_disc();
   const vector<vector<float> > &tftops_subjet_pt();
   const vector<vector<float> > &tftops_subjet_eta();
@@ -2269,8 +3362,11 @@ void LoadAllBranches();
   const vector<vector<int> > &jup_topcands_ak4idx();
   const vector<float> &jup_topcands_disc();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_topcands_p4();
+  const PolarArrays &jup_topcands_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_topcands_Wp4();
+  const PolarArrays &jup_topcands_Wp4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_tftops_p4();
+  const PolarArrays &jup_tftops_p4_polar();
   const vector<float> &jup_tftops_disc();
   const vector<vector<float> > &jup_tftops_subjet_pt();
   const vector<vector<float> > &jup_tftops_subjet_eta();
@@ -2287,20 +3383,25 @@ void LoadAllBranches();
   const vector<vector<int> > &jdown_topcands_ak4idx();
   const vector<float> &jdown_topcands_disc();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_topcands_p4();
+  const PolarArrays &jdown_topcands_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_topcands_Wp4();
+  const PolarArrays &jdown_topcands_Wp4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_tftops_p4();
+  const PolarArrays &jdown_tftops_p4_polar();
   const vector<float> &jdown_tftops_disc();
   const vector<vector<float> > &jdown_tftops_subjet_pt();
   const vector<vector<float> > &jdown_tftops_subjet_eta();
   const vector<vector<float> > &jdown_tftops_subjet_phi();
   const vector<TString> &tau_IDnames();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &tau_p4();
+  const PolarArrays &tau_p4_polar();
   const vector<vector<float> > &tau_ID();
   const vector<float> &tau_passID();
   const int &ngoodtaus();
   const vector<bool> &tau_isVetoTau();
   const vector<bool> &tau_isVetoTau_v2();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &isoTracks_p4();
+  const PolarArrays &isoTracks_p4_polar();
   const vector<int> &isoTracks_charge();
   const vector<float> &isoTracks_absIso();
   const vector<float> &isoTracks_dz();
@@ -2346,6 +3447,7 @@ void LoadAllBranches();
   const int &HLT_Photon200();
   const int &HLT_Photon250_NoHE();
   const int &HLT_Photon300_NoHE();
+  const unsigned int &HLT_bits();
   const bool &filt_cscbeamhalo();
   const bool &filt_cscbeamhalo2015();
   const bool &filt_globaltighthalo2016();
@@ -2579,7 +3681,9 @@ namespace stop1l {
   const bool &lep1_passTightID();
   const bool &lep1_passVeto();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep1_p4();
+  const PolarP4 &lep1_p4_polar();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep1_mcp4();
+  const PolarP4 &lep1_mcp4_polar();
   const int &lep1_mc_motherid();
   const float &lep1_etaSC();
   const float &lep1_dphiMET();
@@ -2597,7 +3701,9 @@ namespace stop1l {
   const bool &lep2_passTightID();
   const bool &lep2_passVeto();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep2_p4();
+  const PolarP4 &lep2_p4_polar();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &lep2_mcp4();
+  const PolarP4 &lep2_mcp4_polar();
   const int &lep2_mc_motherid();
   const float &lep2_etaSC();
   const float &lep2_dphiMET();
@@ -2617,7 +3723,9 @@ namespace stop1l {
   const vector<bool> &ph_passTightID();
   const vector<int> &ph_overlapJetId();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ph_p4();
+  const PolarArrays &ph_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ph_mcp4();
+  const PolarArrays &ph_mcp4_polar();
   const vector<int> &ph_mcMatchId();
   const vector<float> &ph_genIso04();
   const vector<float> &ph_drMinParton();
@@ -2634,6 +3742,7 @@ namespace stop1l {
   const float &ak4_htratiom();
   const vector<float> &dphi_ak4pfjet_met();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ak4pfjets_p4();
+  const PolarArrays &ak4pfjets_p4_polar();
   const vector<bool> &ak4pfjets_passMEDbtag();
   const vector<float> &ak4pfjets_deepCSV();
   const vector<float> &ak4pfjets_CSV();
@@ -2643,9 +3752,13 @@ namespace stop1l {
   const vector<bool> &ak4pfjets_loose_puid();
   const vector<bool> &ak4pfjets_loose_pfid();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &ak4pfjets_leadMEDbjet_p4();
+  const PolarP4 &ak4pfjets_leadMEDbjet_p4_polar();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &ak4pfjets_leadbtag_p4();
+  const PolarP4 &ak4pfjets_leadbtag_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ak4genjets_p4();
+  const PolarArrays &ak4genjets_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &softtags_p4();
+  const PolarArrays &softtags_p4_polar();
   const int &nsoftbtags();
   const int &jup_nskimjets();
   const int &jup_nskimbtagmed();
@@ -2660,6 +3773,7 @@ namespace stop1l {
   const float &jup_ak4_htratiom();
   const vector<float> &jup_dphi_ak4pfjet_met();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_ak4pfjets_p4();
+  const PolarArrays &jup_ak4pfjets_p4_polar();
   const vector<bool> &jup_ak4pfjets_passMEDbtag();
   const vector<float> &jup_ak4pfjets_deepCSV();
   const vector<float> &jup_ak4pfjets_CSV();
@@ -2669,9 +3783,13 @@ namespace stop1l {
   const vector<bool> &jup_ak4pfjets_loose_puid();
   const vector<bool> &jup_ak4pfjets_loose_pfid();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jup_ak4pfjets_leadMEDbjet_p4();
+  const PolarP4 &jup_ak4pfjets_leadMEDbjet_p4_polar();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jup_ak4pfjets_leadbtag_p4();
+  const PolarP4 &jup_ak4pfjets_leadbtag_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_ak4genjets_p4();
+  const PolarArrays &jup_ak4genjets_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_softtags_p4();
+  const PolarArrays &jup_softtags_p4_polar();
   const int &jup_nsoftbtags();
   const int &jdown_nskimjets();
   const int &jdown_nskimbtagmed();
@@ -2686,6 +3804,7 @@ namespace stop1l {
   const float &jdown_ak4_htratiom();
   const vector<float> &jdown_dphi_ak4pfjet_met();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_ak4pfjets_p4();
+  const PolarArrays &jdown_ak4pfjets_p4_polar();
   const vector<bool> &jdown_ak4pfjets_passMEDbtag();
   const vector<float> &jdown_ak4pfjets_deepCSV();
   const vector<float> &jdown_ak4pfjets_CSV();
@@ -2695,12 +3814,17 @@ namespace stop1l {
   const vector<bool> &jdown_ak4pfjets_loose_puid();
   const vector<bool> &jdown_ak4pfjets_loose_pfid();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jdown_ak4pfjets_leadMEDbjet_p4();
+  const PolarP4 &jdown_ak4pfjets_leadMEDbjet_p4_polar();
   const ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > &jdown_ak4pfjets_leadbtag_p4();
+  const PolarP4 &jdown_ak4pfjets_leadbtag_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_ak4genjets_p4();
+  const PolarArrays &jdown_ak4genjets_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_softtags_p4();
+  const PolarArrays &jdown_softtags_p4_polar();
   const int &jdown_nsoftbtags();
   const vector<bool> &genleps_isfromt();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genleps_p4();
+  const PolarArrays &genleps_p4_polar();
   const vector<int> &genleps_id();
   const vector<int> &genleps__genpsidx();
   const vector<int> &genleps_status();
@@ -2711,15 +3835,18 @@ namespace stop1l {
   const vector<int> &genleps_gentaudecay();
   const int &gen_nfromtleps_();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genleps_motherp4();
+  const PolarArrays &genleps_motherp4_polar();
   const vector<int> &genleps_motherid();
   const vector<int> &genleps_motheridx();
   const vector<int> &genleps_motherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genleps_gmotherp4();
+  const PolarArrays &genleps_gmotherp4_polar();
   const vector<int> &genleps_gmotherid();
   const vector<int> &genleps_gmotheridx();
   const vector<int> &genleps_gmotherstatus();
   const vector<bool> &gennus_isfromt();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gennus_p4();
+  const PolarArrays &gennus_p4_polar();
   const vector<int> &gennus_id();
   const vector<int> &gennus__genpsidx();
   const vector<int> &gennus_status();
@@ -2730,15 +3857,18 @@ namespace stop1l {
   const vector<int> &gennus_gentaudecay();
   const int &gen_nfromtnus_();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gennus_motherp4();
+  const PolarArrays &gennus_motherp4_polar();
   const vector<int> &gennus_motherid();
   const vector<int> &gennus_motheridx();
   const vector<int> &gennus_motherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gennus_gmotherp4();
+  const PolarArrays &gennus_gmotherp4_polar();
   const vector<int> &gennus_gmotherid();
   const vector<int> &gennus_gmotheridx();
   const vector<int> &gennus_gmotherstatus();
   const vector<bool> &genqs_isfromt();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genqs_p4();
+  const PolarArrays &genqs_p4_polar();
   const vector<int> &genqs_id();
   const vector<int> &genqs__genpsidx();
   const vector<int> &genqs_status();
@@ -2749,15 +3879,18 @@ namespace stop1l {
   const vector<int> &genqs_gentaudecay();
   const int &gen_nfromtqs_();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genqs_motherp4();
+  const PolarArrays &genqs_motherp4_polar();
   const vector<int> &genqs_motherid();
   const vector<int> &genqs_motheridx();
   const vector<int> &genqs_motherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genqs_gmotherp4();
+  const PolarArrays &genqs_gmotherp4_polar();
   const vector<int> &genqs_gmotherid();
   const vector<int> &genqs_gmotheridx();
   const vector<int> &genqs_gmotherstatus();
   const vector<bool> &genbosons_isfromt();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genbosons_p4();
+  const PolarArrays &genbosons_p4_polar();
   const vector<int> &genbosons_id();
   const vector<int> &genbosons__genpsidx();
   const vector<int> &genbosons_status();
@@ -2768,15 +3901,18 @@ namespace stop1l {
   const vector<int> &genbosons_gentaudecay();
   const int &gen_nfromtbosons_();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genbosons_motherp4();
+  const PolarArrays &genbosons_motherp4_polar();
   const vector<int> &genbosons_motherid();
   const vector<int> &genbosons_motheridx();
   const vector<int> &genbosons_motherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &genbosons_gmotherp4();
+  const PolarArrays &genbosons_gmotherp4_polar();
   const vector<int> &genbosons_gmotherid();
   const vector<int> &genbosons_gmotheridx();
   const vector<int> &genbosons_gmotherstatus();
   const vector<bool> &gensusy_isfromt();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gensusy_p4();
+  const PolarArrays &gensusy_p4_polar();
   const vector<int> &gensusy_id();
   const vector<int> &gensusy__genpsidx();
   const vector<int> &gensusy_status();
@@ -2787,14 +3923,17 @@ namespace stop1l {
   const vector<int> &gensusy_gentaudecay();
   const int &gen_nfromtsusy_();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gensusy_motherp4();
+  const PolarArrays &gensusy_motherp4_polar();
   const vector<int> &gensusy_motherid();
   const vector<int> &gensusy_motheridx();
   const vector<int> &gensusy_motherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &gensusy_gmotherp4();
+  const PolarArrays &gensusy_gmotherp4_polar();
   const vector<int> &gensusy_gmotherid();
   const vector<int> &gensusy_gmotheridx();
   const vector<int> &gensusy_gmotherstatus();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &ak8pfjets_p4();
+  const PolarArrays &ak8pfjets_p4_polar();
   const vector<float> &ak8pfjets_tau1();
   const vector<float> &ak8pfjets_tau2();
   const vector<float> &ak8pfjets_tau3();
@@ -2809,6 +3948,7 @@ namespace stop1l {
   const vector<float> &ak8pfjets_deepdisc_h4q();
   const float &lead_ak8deepdisc_top();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_ak8pfjets_p4();
+  const PolarArrays &jup_ak8pfjets_p4_polar();
   const vector<float> &jup_ak8pfjets_tau1();
   const vector<float> &jup_ak8pfjets_tau2();
   const vector<float> &jup_ak8pfjets_tau3();
@@ -2823,6 +3963,7 @@ namespace stop1l {
   const vector<float> &jup_ak8pfjets_deepdisc_h4q();
   const float &jup_lead_ak8deepdisc_top();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_ak8pfjets_p4();
+  const PolarArrays &jdown_ak8pfjets_p4_polar();
   const vector<float> &jdown_ak8pfjets_tau1();
   const vector<float> &jdown_ak8pfjets_tau2();
   const vector<float> &jdown_ak8pfjets_tau3();
@@ -2848,8 +3989,11 @@ namespace stop1l {
   const vector<vector<int> > &topcands_ak4idx();
   const vector<float> &topcands_disc();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &topcands_p4();
+  const PolarArrays &topcands_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &topcands_Wp4();
+  const PolarArrays &topcands_Wp4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &tftops_p4();
+  const PolarArrays &tftops_p4_polar();
   const vector<float> &tftops_disc();
   const vector<vector<float> > &tftops_subjet_pt();
   const vector<vector<float> > &tftops_subjet_eta();
@@ -2866,8 +4010,11 @@ namespace stop1l {
   const vector<vector<int> > &jup_topcands_ak4idx();
   const vector<float> &jup_topcands_disc();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_topcands_p4();
+  const PolarArrays &jup_topcands_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_topcands_Wp4();
+  const PolarArrays &jup_topcands_Wp4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jup_tftops_p4();
+  const PolarArrays &jup_tftops_p4_polar();
   const vector<float> &jup_tftops_disc();
   const vector<vector<float> > &jup_tftops_subjet_pt();
   const vector<vector<float> > &jup_tftops_subjet_eta();
@@ -2884,20 +4031,25 @@ namespace stop1l {
   const vector<vector<int> > &jdown_topcands_ak4idx();
   const vector<float> &jdown_topcands_disc();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_topcands_p4();
+  const PolarArrays &jdown_topcands_p4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_topcands_Wp4();
+  const PolarArrays &jdown_topcands_Wp4_polar();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &jdown_tftops_p4();
+  const PolarArrays &jdown_tftops_p4_polar();
   const vector<float> &jdown_tftops_disc();
   const vector<vector<float> > &jdown_tftops_subjet_pt();
   const vector<vector<float> > &jdown_tftops_subjet_eta();
   const vector<vector<float> > &jdown_tftops_subjet_phi();
   const vector<TString> &tau_IDnames();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &tau_p4();
+  const PolarArrays &tau_p4_polar();
   const vector<vector<float> > &tau_ID();
   const vector<float> &tau_passID();
   const int &ngoodtaus();
   const vector<bool> &tau_isVetoTau();
   const vector<bool> &tau_isVetoTau_v2();
   const vector<ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > > &isoTracks_p4();
+  const PolarArrays &isoTracks_p4_polar();
   const vector<int> &isoTracks_charge();
   const vector<float> &isoTracks_absIso();
   const vector<float> &isoTracks_dz();
@@ -2943,6 +4095,7 @@ namespace stop1l {
   const int &HLT_Photon200();
   const int &HLT_Photon250_NoHE();
   const int &HLT_Photon300_NoHE();
+  const unsigned int &HLT_bits();
   const bool &filt_cscbeamhalo();
   const bool &filt_cscbeamhalo2015();
   const bool &filt_globaltighthalo2016();
@@ -0,0 +1,61 @@
+#ifndef TriggerWord_H
+#define TriggerWord_H
+
+#include <cstdlib>
+
+//
+// Per-event trigger decisions packed into one word. The lower bits hold the raw HLT
+// decisions as stored in the baby (also written by the babymaker as the HLT_bits branch),
+// the upper bits hold the analysis level decisions of StopLooper::PassingHLTriggers.
+//
+namespace trigword {
+
+  enum TriggerBit {
+    // Raw HLT bits, same meaning as the HLT_* branches of the baby
+    k_MET = 0,
+    k_MET_MHT,
+    k_MET110_MHT110,
+    k_MET120_MHT120,
+    k_SingleEl,
+    k_SingleMu,
+    k_DiEl,
+    k_DiMu,
+    k_MuE,
+    k_PFHT_unprescaled,
+    k_PFHT_prescaled,
+    k_AK8Jet_unprescaled,
+    k_AK8Jet_prescaled,
+    k_CaloJet500_NoJetID,
+    k_nRawBits,
+    // Analysis level decisions, type 1 (SR), 2 (CR2l) and 3 (CR2l with dilepton triggers)
+    k_passType1 = 16,
+    k_passType2,
+    k_passType3,
+  };
+
+  const unsigned int kRawBitsMask = (1u << k_nRawBits) - 1;
+
+  inline void setBit(unsigned int& word, TriggerBit bit, int pass) { if (pass) word |= (1u << bit); }
+  inline bool testBit(unsigned int word, TriggerBit bit) { return word & (1u << bit); }
+
+  // The decisions of the 3 trigger types, from the raw bits, year and lepton flavours
+  inline unsigned int typeBits(unsigned int raw, int year, int lep1_pdgid, int lep2_pdgid) {
+    auto pass = [raw](TriggerBit bit) { return testBit(raw, bit); };
+
+    int l1id = abs(lep1_pdgid), l2id = abs(lep2_pdgid);
+    int dilepid = l1id * l2id;
+    bool metTrig = (year == 2016)? (pass(k_MET110_MHT110) || pass(k_MET120_MHT120) || pass(k_MET)) : pass(k_MET_MHT);
+    bool lep1Trig = (l1id == 11 && pass(k_SingleEl)) || (l1id == 13 && pass(k_SingleMu));
+    bool lep12Trig = (pass(k_SingleEl) && (l1id == 11 || l2id == 11)) || (pass(k_SingleMu) && (l1id == 13 || l2id == 13));
+    bool dilepTrig = (dilepid == 121 && pass(k_DiEl)) || (dilepid == 169 && pass(k_DiMu)) || (dilepid == 143 && pass(k_MuE));
+
+    unsigned int word = 0;
+    setBit(word, k_passType1, metTrig || lep1Trig);
+    setBit(word, k_passType2, metTrig || lep12Trig);
+    setBit(word, k_passType3, metTrig || dilepTrig || lep12Trig);
+    return word;
+  }
+
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef VecView_H
+#define VecView_H
+
+// C++
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+//
+// CLASS
+//
+// Read-only view of a contiguous array, to pass the vector branches of the babies around without
+// copying them. The StopTree accessors return references to the vectors ROOT reads into, which keep
+// their storage from one entry to the next, so a view made from an accessor is valid until the next
+// GetEntry of that branch. Converts implicitly from a std::vector, so functions taking a VecView can
+// be called with the accessors directly.
+//
+template<class T> class VecView {
+
+ public:
+
+  typedef T value_type;
+  typedef const T* const_iterator;
+
+  VecView() : data_(nullptr), size_(0) {}
+  VecView(const std::vector<T>& vec) : data_(vec.data()), size_(vec.size()) {}
+  VecView(const T* data, size_t size) : data_(data), size_(size) {}
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  const T* data() const { return data_; }
+
+  const T& operator[](size_t i) const { return data_[i]; }
+  const T& at(size_t i) const {
+    if (i >= size_) throw std::out_of_range("[VecView::at] Index out of range!");
+    return data_[i];
+  }
+  const T& front() const { return data_[0]; }
+  const T& back() const { return data_[size_-1]; }
+
+  const_iterator begin() const { return data_; }
+  const_iterator end() const { return data_ + size_; }
+
+  // The first n elements, or all of them if there are fewer
+  VecView head(size_t n) const { return VecView(data_, (n < size_)? n : size_); }
+
+ private:
+
+  const T* data_;
+  size_t size_;
+};
+
+#endif
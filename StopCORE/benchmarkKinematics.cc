@@ -0,0 +1,123 @@
+// Microbenchmark of the deltaR matching in KinematicsCache.h against the pairwise helpers
+// used so far (isCloseObject and ROOT::Math::VectorUtil::DeltaR on the baby four-vectors).
+//
+// Usage: ./benchmarkKinematics [nevents] [njets] [ngen]
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+
+#include "Math/LorentzVector.h"
+#include "Math/VectorUtil.h"
+
+#include "KinematicsCache.h"
+
+using namespace std;
+
+typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> > LorentzVector;
+
+// Same as isCloseObject in StopLooper/Utilities.h
+bool isCloseObject(const LorentzVector p1, const LorentzVector p2, const float conesize, float* deltaR = nullptr) {
+  float deltaEta = fabs(p1.eta() - p2.eta());
+  if (deltaEta > conesize) return false;
+  float deltaPhi = fabs(p1.phi() - p2.phi());
+  if (deltaPhi > kinem::kPi) deltaPhi = kinem::kTwoPi - deltaPhi;
+  if (deltaPhi > conesize) return false;
+  float deltaR2 = deltaEta*deltaEta + deltaPhi*deltaPhi;
+  if (deltaR2 > conesize*conesize) return false;
+  if (deltaR) *deltaR = sqrt(deltaR2);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  const int nevents = (argc > 1)? atoi(argv[1]) : 20000;
+  const int njets = (argc > 2)? atoi(argv[2]) : 12;
+  const int ngen = (argc > 3)? atoi(argv[3]) : 40;
+  const float cone = 0.4;
+
+  // Random objects in the detector acceptance
+  mt19937 rng(12345);
+  uniform_real_distribution<float> ptdist(20, 500), etadist(-2.5, 2.5), phidist(-kinem::kPi, kinem::kPi);
+  auto makeP4s = [&](int n) {
+    vector<LorentzVector> p4s;
+    for (int i = 0; i < n; ++i) {
+      ROOT::Math::PtEtaPhiMVector v(ptdist(rng), etadist(rng), phidist(rng), 0);
+      p4s.emplace_back(v.px(), v.py(), v.pz(), v.e());
+    }
+    return p4s;
+  };
+  vector<vector<LorentzVector>> jets, gens;
+  for (int i = 0; i < nevents; ++i) {
+    jets.push_back(makeP4s(njets));
+    gens.push_back(makeP4s(ngen));
+  }
+
+  // Closest gen object to each jet, the sums of indices make sure all methods agree
+  auto run = [&](const char* name, auto matchEvent) {
+    auto start = chrono::steady_clock::now();
+    long sum = 0;
+    for (int i = 0; i < nevents; ++i) sum += matchEvent(jets[i], gens[i]);
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout << "  " << name << ": " << elapsed * 1e9 / (double(nevents) * njets * ngen) << " ns/pair, checksum " << sum << endl;
+  };
+
+  cout << "Matching " << njets << " jets to " << ngen << " gen objects in " << nevents << " events" << endl;
+
+  run("VectorUtil::DeltaR     ", [&](const vector<LorentzVector>& js, const vector<LorentzVector>& gs) {
+    long sum = 0;
+    for (const auto& j : js) {
+      int imin = -1;
+      float drmin = cone;
+      for (size_t g = 0; g < gs.size(); ++g) {
+        float dr = ROOT::Math::VectorUtil::DeltaR(j, gs[g]);
+        if (dr < drmin) { drmin = dr; imin = g; }
+      }
+      sum += imin;
+    }
+    return sum;
+  });
+
+  run("isCloseObject          ", [&](const vector<LorentzVector>& js, const vector<LorentzVector>& gs) {
+    long sum = 0;
+    for (const auto& j : js) {
+      int imin = -1;
+      float drmin = cone;
+      for (size_t g = 0; g < gs.size(); ++g) {
+        float dr = cone;
+        if (isCloseObject(j, gs[g], cone, &dr) && dr < drmin) { drmin = dr; imin = g; }
+      }
+      sum += imin;
+    }
+    return sum;
+  });
+
+  kinem::EtaPhiCache jetcache, gencache;
+  run("EtaPhiCache::Closest   ", [&](const vector<LorentzVector>& js, const vector<LorentzVector>& gs) {
+    long sum = 0;
+    gencache.Fill(gs);
+    for (const auto& j : js) sum += gencache.Closest(j, cone);
+    return sum;
+  });
+
+  vector<float> dr2;
+  run("kinem::deltaR2Matrix   ", [&](const vector<LorentzVector>& js, const vector<LorentzVector>& gs) {
+    long sum = 0;
+    jetcache.Fill(js);
+    gencache.Fill(gs);
+    kinem::deltaR2Matrix(jetcache, gencache, dr2);
+    for (size_t i = 0; i < js.size(); ++i) {
+      int imin = -1;
+      float dr2min = cone*cone;
+      for (size_t g = 0; g < gs.size(); ++g) {
+        float d = dr2[i*gs.size() + g];
+        if (d < dr2min) { dr2min = d; imin = g; }
+      }
+      sum += imin;
+    }
+    return sum;
+  });
+
+  return 0;
+}
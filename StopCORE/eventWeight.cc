@@ -1,4 +1,5 @@
 #include "eventWeight.h"
+#include "SharedResources.h"
 
 // SNT CORE function
 /// topPtWeight() copied from MCSelections.cc
@@ -302,28 +303,30 @@ void evtWgtInfo::Setup(string samplestr, int inyear, bool applyUnc, bool useBTag
     useLepSFUtils = useBTagUtils = false;
   }
 
+  // The input files and SF tools are loaded once per process and shared between samples
+  SharedResources& resources = SharedResources::instance();
+
   // Get Signal XSection File
   if ( is_fastsim_ ) {
-    f_sig_xsec = new TFile("../StopCORE/inputs/signal_xsec/xsec_stop_13TeV.root","read");
-    h_sig_xsec = (TH1D*) f_sig_xsec->Get("stop");
+    h_sig_xsec = resources.Get<TH1D>("../StopCORE/inputs/signal_xsec/xsec_stop_13TeV.root", "stop");
   }
 
   // Get SR trigger histos
   if ( !is_data_ && apply_cr2lTrigger_sf) {
-    f_cr2lTrigger_sf = new TFile("../StopCORE/inputs/trigger/TrigEfficiencies_all.root","read");
+    const string trigeff_file = "../StopCORE/inputs/trigger/TrigEfficiencies_all.root";
     if (sync16) {
-      h_cr2lTrigger_sf_el = (TEfficiency*) f_cr2lTrigger_sf->Get("Efficiency_ge2l_metrl_el");
-      h_cr2lTrigger_sf_mu = (TEfficiency*) f_cr2lTrigger_sf->Get("Efficiency_ge2l_metrl_mu");
+      h_cr2lTrigger_sf_el = resources.Get<TEfficiency>(trigeff_file, "Efficiency_ge2l_metrl_el");
+      h_cr2lTrigger_sf_mu = resources.Get<TEfficiency>(trigeff_file, "Efficiency_ge2l_metrl_mu");
     } else if (year == 2016) {
-        h_cr2lTrigger_sf_el = (TEfficiency*) f_cr2lTrigger_sf->Get("heff16_extb_trigeff_metrl_lep1pt_el");
-        h_cr2lTrigger_sf_mu = (TEfficiency*) f_cr2lTrigger_sf->Get("heff16_extb_trigeff_metrl_lep1pt_mu");
+        h_cr2lTrigger_sf_el = resources.Get<TEfficiency>(trigeff_file, "heff16_extb_trigeff_metrl_lep1pt_el");
+        h_cr2lTrigger_sf_mu = resources.Get<TEfficiency>(trigeff_file, "heff16_extb_trigeff_metrl_lep1pt_mu");
     } else if (year == 2017) {
-      h_cr2lTrigger_sf_el = (TEfficiency*) f_cr2lTrigger_sf->Get("heff17_extb_trigeff_metrl_lep1pt_el");
-      h_cr2lTrigger_sf_mu = (TEfficiency*) f_cr2lTrigger_sf->Get("heff17_extb_trigeff_metrl_lep1pt_mu");
+      h_cr2lTrigger_sf_el = resources.Get<TEfficiency>(trigeff_file, "heff17_extb_trigeff_metrl_lep1pt_el");
+      h_cr2lTrigger_sf_mu = resources.Get<TEfficiency>(trigeff_file, "heff17_extb_trigeff_metrl_lep1pt_mu");
     } else if (year == 2018) {
       // TODO: to update this when 2018 JetHT data is available
-      h_cr2lTrigger_sf_el = (TEfficiency*) f_cr2lTrigger_sf->Get("heff17_trigeff_metrl_lep1pt_el");
-      h_cr2lTrigger_sf_mu = (TEfficiency*) f_cr2lTrigger_sf->Get("heff17_trigeff_metrl_lep1pt_mu");
+      h_cr2lTrigger_sf_el = resources.Get<TEfficiency>(trigeff_file, "heff17_trigeff_metrl_lep1pt_el");
+      h_cr2lTrigger_sf_mu = resources.Get<TEfficiency>(trigeff_file, "heff17_trigeff_metrl_lep1pt_mu");
     }
     if (!h_cr2lTrigger_sf_mu || !h_cr2lTrigger_sf_el) {
       cout << "[eventWeight::Setup] >> Cannot find histogram for cr2lTrigger!! Turning it off!!" << endl;
@@ -336,21 +339,20 @@ void evtWgtInfo::Setup(string samplestr, int inyear, bool applyUnc, bool useBTag
 
   // Initialize bTag SF machinery
   if ( !is_data_ && useBTagSFs_fromFiles ) {
-    bTagSFUtil = new eventWeight_bTagSF( is_fastsim_ );
+    bTagSFUtil = resources.GetBTagSFUtil( is_fastsim_ );
   }
 
   // Initialize Lepton Scale Factors
   if ( !is_data_ && useLepSFs_fromFiles ) {
-    lepSFUtil  = new eventWeight_lepSF();
-    lepSFUtil->setup(is_fastsim_, year, "../StopCORE/inputs/lepsf");
+    lepSFUtil  = resources.GetLepSFUtil(is_fastsim_, year, "../StopCORE/inputs/lepsf");
   }
 
   // Get pileup wgt histo
   if ( !is_data_ && apply_pu_sf_fromFile) {
-    f_pu = new TFile("../StopCORE/inputs/pileup/puWeights_Run2.root", "read");
-    h_pu_wgt    = (TH1D*) f_pu->Get(Form("puWeight%d", year));
-    h_pu_wgt_up = (TH1D*) f_pu->Get(Form("puWeight%dUp", year));
-    h_pu_wgt_dn = (TH1D*) f_pu->Get(Form("puWeight%dDown", year));
+    const string pu_file = "../StopCORE/inputs/pileup/puWeights_Run2.root";
+    h_pu_wgt    = resources.Get<TH1D>(pu_file, Form("puWeight%d", year));
+    h_pu_wgt_up = resources.Get<TH1D>(pu_file, Form("puWeight%dUp", year));
+    h_pu_wgt_dn = resources.Get<TH1D>(pu_file, Form("puWeight%dDown", year));
     if (!h_pu_wgt || !h_pu_wgt_up || !h_pu_wgt_dn) {
       cout << "[eventWeight::Setup] >> Cannot find histogram for puWeights!! Turning it off!!" << endl;
       apply_pu_sf_fromFile = false;
@@ -361,8 +363,7 @@ void evtWgtInfo::Setup(string samplestr, int inyear, bool applyUnc, bool useBTag
   // Get lep reco histo
   if ( !is_data_ && apply_tau_sf) {
     TString lepeff_file = "Moriond17/lepeff__moriond17__ttbar_powheg_pythia8_25ns.root";
-    f_lepEff = new TFile("../StopCORE/inputs/lepsf/"+lepeff_file, "read");
-    h_recoEff_tau = (TH2D*) f_lepEff->Get("h2_lepEff_vetoSel_Eff_tau");
+    h_recoEff_tau = resources.Get<TH2D>(("../StopCORE/inputs/lepsf/"+lepeff_file).Data(), "h2_lepEff_vetoSel_Eff_tau");
   }
 
 }
@@ -371,17 +372,14 @@ void evtWgtInfo::Setup(string samplestr, int inyear, bool applyUnc, bool useBTag
 
 void evtWgtInfo::Cleanup() {
 
-  if ( is_data_ ) {
-    f_cr2lTrigger_sf->Close();
-    delete f_cr2lTrigger_sf;
-
-    if (useBTagSFs_fromFiles) delete bTagSFUtil;
-    if (useLepSFs_fromFiles) delete lepSFUtil;
-  }
-  if ( is_fastsim_ ) {
-    f_sig_xsec->Close();
-    delete f_sig_xsec;
-  }
+  // The input hists and SF tools are owned by SharedResources, only drop the references here
+  h_sig_xsec = nullptr;
+  h_cr2lTrigger_sf_el = nullptr;
+  h_cr2lTrigger_sf_mu = nullptr;
+  bTagSFUtil = nullptr;
+  lepSFUtil = nullptr;
+  h_pu_wgt = h_pu_wgt_up = h_pu_wgt_dn = nullptr;
+  h_recoEff_tau = nullptr;
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -1079,19 +1077,7 @@ void evtWgtInfo::getBTagWeight( int WP, double &wgt_btagsf, double &wgt_btagsf_h
 
 void evtWgtInfo::getBTagWeight_fromFiles( int WP, double &wgt_btagsf, double &wgt_btagsf_hf_up, double &wgt_btagsf_hf_dn, double &wgt_btagsf_lf_up, double &wgt_btagsf_lf_dn, double &wgt_btagsf_fs_up, double &wgt_btagsf_fs_dn ) {
 
-  vector< double > jet_pt;
-  vector< double > jet_eta;
-  vector< double > jet_deepCSV;
-  vector< int >    jet_flavour;
-
-  for (int iJet=0; iJet<(int)babyAnalyzer.ak4pfjets_p4().size(); iJet++) {
-    jet_pt.push_back( (double)babyAnalyzer.ak4pfjets_p4().at(iJet).Pt() );
-    jet_eta.push_back( (double)babyAnalyzer.ak4pfjets_p4().at(iJet).Eta() );
-    jet_deepCSV.push_back( (double)babyAnalyzer.ak4pfjets_deepCSV().at(iJet) );
-    jet_flavour.push_back( (int)abs(babyAnalyzer.ak4pfjets_hadron_flavor().at(iJet)) );
-  }
-
-  bTagSFUtil->getBTagWeight( WP, jet_pt, jet_eta, jet_deepCSV, jet_flavour, wgt_btagsf, wgt_btagsf_hf_up, wgt_btagsf_hf_dn, wgt_btagsf_lf_up, wgt_btagsf_lf_dn, wgt_btagsf_fs_up, wgt_btagsf_fs_dn );
+  bTagSFUtil->getBTagWeight( WP, babyAnalyzer.ak4pfjets_p4(), babyAnalyzer.ak4pfjets_deepCSV(), babyAnalyzer.ak4pfjets_hadron_flavor(), wgt_btagsf, wgt_btagsf_hf_up, wgt_btagsf_hf_dn, wgt_btagsf_lf_up, wgt_btagsf_lf_dn, wgt_btagsf_fs_up, wgt_btagsf_fs_dn );
 
 }
 
@@ -96,11 +96,10 @@ class evtWgtInfo {
   TH2D *h_sig_counter_nEvents;
   TH3D *h_sig_counter;
 
-  TFile *f_sig_xsec;
+  // Input hists below are owned by SharedResources
   TH1D *h_sig_xsec;
 
   // SR trigger efficiency histos
-  TFile *f_cr2lTrigger_sf;
   TEfficiency *h_cr2lTrigger_sf_el;
   TEfficiency *h_cr2lTrigger_sf_mu;
   double max_metrl;
@@ -115,13 +114,11 @@ class evtWgtInfo {
   eventWeight_lepSF *lepSFUtil;
 
   // Pileup weight machinery;
-  TFile *f_pu;
   TH1D *h_pu_wgt;
   TH1D *h_pu_wgt_up;
   TH1D *h_pu_wgt_dn;
 
   // Tau Wgt Machinery
-  TFile *f_lepEff;
   TH2D *h_recoEff_tau;
 
   // Event weights for each systematic
@@ -82,7 +82,7 @@ eventWeight_bTagSF::~eventWeight_bTagSF(){
 
 //////////////////////////////////////////////////////////////////////
 
-void eventWeight_bTagSF::getBTagWeight( int WP, std::vector< double > jet_pt, std::vector< double > jet_eta, std::vector< double > jet_CSV, std::vector< int > jet_flavour, double &weight_btagsf, double &weight_btagsf_heavy_UP, double &weight_btagsf_heavy_DN, double &weight_btagsf_light_UP, double &weight_btagsf_light_DN, double &weight_btagsf_FS_UP, double &weight_btagsf_FS_DN ){
+void eventWeight_bTagSF::getBTagWeight( int WP, VecView< LorentzVector > jet_p4, VecView< float > jet_CSV, VecView< int > jet_flavour, double &weight_btagsf, double &weight_btagsf_heavy_UP, double &weight_btagsf_heavy_DN, double &weight_btagsf_light_UP, double &weight_btagsf_light_DN, double &weight_btagsf_FS_UP, double &weight_btagsf_FS_DN ){
 
   // Initialize output variables
   weight_btagsf          = 1.0;
@@ -98,12 +98,8 @@ void eventWeight_bTagSF::getBTagWeight( int WP, std::vector< double > jet_pt, st
     std::cout << "btag sf WP needs an argument of 0, 1, or 2, for loose, medium, or tight ID" << std::endl;
   }
 
-  if( jet_pt.size()!=jet_eta.size() ){
-    std::cout << "btag sf vectors for jet pt, eta are different sizes, exiting..." << std::endl;
-    return;
-  }
-  if( jet_eta.size()!=jet_flavour.size() ){
-    std::cout << "btag sf vectors for jet eta, flavour are different sizes, exiting..." << std::endl;
+  if( jet_p4.size()!=jet_flavour.size() ){
+    std::cout << "btag sf vectors for jet p4, flavour are different sizes, exiting..." << std::endl;
     return;
   }
   if( jet_flavour.size()!=jet_CSV.size() ){
@@ -130,7 +126,10 @@ void eventWeight_bTagSF::getBTagWeight( int WP, std::vector< double > jet_pt, st
   double weight_FS_DN = 1.0;
 
   // Loop over jet vectors
-  for(int iJet=0; iJet<(int)jet_pt.size(); iJet++){
+  for(int iJet=0; iJet<(int)jet_p4.size(); iJet++){
+
+    const double jet_pt  = jet_p4[iJet].Pt();
+    const double jet_eta = jet_p4[iJet].Eta();
 
     BTagEntry::JetFlavor flavor = BTagEntry::FLAV_UDSG;
 
@@ -139,16 +138,16 @@ void eventWeight_bTagSF::getBTagWeight( int WP, std::vector< double > jet_pt, st
     int biny=-99;
     TH2D* h_eff = NULL;
 
-    double pt_eff  = std::max(20.0, std::min(399.0, jet_pt[iJet])); // min 20 GeV in the eff hist
-    double eta_eff = std::min(2.39, fabs(jet_eta[iJet]) );
+    double pt_eff  = std::max(20.0, std::min(399.0, jet_pt)); // min 20 GeV in the eff hist
+    double eta_eff = std::min(2.39, fabs(jet_eta) );
 
-    // double pt_reader  = std::max(30.0, std::min(669.0, jet_pt[iJet]));
-    // double eta_reader = std::min(2.39, fabs(jet_eta[iJet]) );
+    // double pt_reader  = std::max(30.0, std::min(669.0, jet_pt));
+    // double eta_reader = std::min(2.39, fabs(jet_eta) );
 
     // bJets
     if( abs(jet_flavour[iJet])==5 ){
       flavor = BTagEntry::FLAV_B;
-      pt_eff = std::max(20.0,std::min(599.0, jet_pt[iJet])); // max pt of 600.0 GeV for b
+      pt_eff = std::max(20.0,std::min(599.0, jet_pt)); // max pt of 600.0 GeV for b
 
       if( WP==BTagEntry::OP_LOOSE  ) h_eff = h_loose_btag_eff_b;
       if( WP==BTagEntry::OP_MEDIUM ) h_eff = h_btag_eff_b;
@@ -176,45 +175,45 @@ void eventWeight_bTagSF::getBTagWeight( int WP, std::vector< double > jet_pt, st
     btagprob_eff = h_eff->GetBinContent(binx,biny);
 
     if( WP==BTagEntry::OP_LOOSE ){
-      weight_cent = reader_loose->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);
-      weight_UP   = reader_loose->eval_auto_bounds("up",      flavor, jet_eta[iJet], jet_pt[iJet]);
-      weight_DN   = reader_loose->eval_auto_bounds("down",    flavor, jet_eta[iJet], jet_pt[iJet]);
+      weight_cent = reader_loose->eval_auto_bounds("central", flavor, jet_eta, jet_pt);
+      weight_UP   = reader_loose->eval_auto_bounds("up",      flavor, jet_eta, jet_pt);
+      weight_DN   = reader_loose->eval_auto_bounds("down",    flavor, jet_eta, jet_pt);
     }
     else if( WP==BTagEntry::OP_MEDIUM ){
-      weight_cent = reader_medium->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);
-      weight_UP   = reader_medium->eval_auto_bounds("up",      flavor, jet_eta[iJet], jet_pt[iJet]);
-      weight_DN   = reader_medium->eval_auto_bounds("down",    flavor, jet_eta[iJet], jet_pt[iJet]);
+      weight_cent = reader_medium->eval_auto_bounds("central", flavor, jet_eta, jet_pt);
+      weight_UP   = reader_medium->eval_auto_bounds("up",      flavor, jet_eta, jet_pt);
+      weight_DN   = reader_medium->eval_auto_bounds("down",    flavor, jet_eta, jet_pt);
     }
     else if( WP==BTagEntry::OP_TIGHT ){
-      weight_cent = reader_tight->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);
-      weight_UP   = reader_tight->eval_auto_bounds("up",      flavor, jet_eta[iJet], jet_pt[iJet]);
-      weight_DN   = reader_tight->eval_auto_bounds("down",    flavor, jet_eta[iJet], jet_pt[iJet]);
+      weight_cent = reader_tight->eval_auto_bounds("central", flavor, jet_eta, jet_pt);
+      weight_UP   = reader_tight->eval_auto_bounds("up",      flavor, jet_eta, jet_pt);
+      weight_DN   = reader_tight->eval_auto_bounds("down",    flavor, jet_eta, jet_pt);
     }
 
     // extra SF for fastsim
     if(sampleIsFastsim) {
 
       if( WP==BTagEntry::OP_LOOSE ){
-        weight_FS_UP = reader_loose_FS->eval_auto_bounds("up",      flavor, jet_eta[iJet], jet_pt[iJet]) * weight_cent;
-        weight_FS_DN = reader_loose_FS->eval_auto_bounds("down",    flavor, jet_eta[iJet], jet_pt[iJet]) * weight_cent;
-        weight_cent *= reader_loose_FS->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);
-        weight_UP   *= reader_loose_FS->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);//this is still just btagSF
-        weight_DN   *= reader_loose_FS->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);//this is still just btagSF
+        weight_FS_UP = reader_loose_FS->eval_auto_bounds("up",      flavor, jet_eta, jet_pt) * weight_cent;
+        weight_FS_DN = reader_loose_FS->eval_auto_bounds("down",    flavor, jet_eta, jet_pt) * weight_cent;
+        weight_cent *= reader_loose_FS->eval_auto_bounds("central", flavor, jet_eta, jet_pt);
+        weight_UP   *= reader_loose_FS->eval_auto_bounds("central", flavor, jet_eta, jet_pt);//this is still just btagSF
+        weight_DN   *= reader_loose_FS->eval_auto_bounds("central", flavor, jet_eta, jet_pt);//this is still just btagSF
       }
       else if( WP==BTagEntry::OP_MEDIUM ){
-        weight_FS_UP = reader_medium_FS->eval_auto_bounds("up",      flavor, jet_eta[iJet], jet_pt[iJet]) * weight_cent;
-        weight_FS_DN = reader_medium_FS->eval_auto_bounds("down",    flavor, jet_eta[iJet], jet_pt[iJet]) * weight_cent;
-        weight_cent *= reader_medium_FS->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);
-        weight_UP   *= reader_medium_FS->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);//this is still just btagSF
-        weight_DN   *= reader_medium_FS->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);//this is still just btagSF
+        weight_FS_UP = reader_medium_FS->eval_auto_bounds("up",      flavor, jet_eta, jet_pt) * weight_cent;
+        weight_FS_DN = reader_medium_FS->eval_auto_bounds("down",    flavor, jet_eta, jet_pt) * weight_cent;
+        weight_cent *= reader_medium_FS->eval_auto_bounds("central", flavor, jet_eta, jet_pt);
+        weight_UP   *= reader_medium_FS->eval_auto_bounds("central", flavor, jet_eta, jet_pt);//this is still just btagSF
+        weight_DN   *= reader_medium_FS->eval_auto_bounds("central", flavor, jet_eta, jet_pt);//this is still just btagSF
 
       }
       else if( WP==BTagEntry::OP_TIGHT ){
-        weight_FS_UP = reader_tight_FS->eval_auto_bounds("up",      flavor, jet_eta[iJet], jet_pt[iJet]) * weight_cent;
-        weight_FS_DN = reader_tight_FS->eval_auto_bounds("down",    flavor, jet_eta[iJet], jet_pt[iJet]) * weight_cent;
-        weight_cent *= reader_tight_FS->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);
-        weight_UP   *= reader_tight_FS->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);//this is still just btagSF
-        weight_DN   *= reader_tight_FS->eval_auto_bounds("central", flavor, jet_eta[iJet], jet_pt[iJet]);//this is still just btagSF
+        weight_FS_UP = reader_tight_FS->eval_auto_bounds("up",      flavor, jet_eta, jet_pt) * weight_cent;
+        weight_FS_DN = reader_tight_FS->eval_auto_bounds("down",    flavor, jet_eta, jet_pt) * weight_cent;
+        weight_cent *= reader_tight_FS->eval_auto_bounds("central", flavor, jet_eta, jet_pt);
+        weight_UP   *= reader_tight_FS->eval_auto_bounds("central", flavor, jet_eta, jet_pt);//this is still just btagSF
+        weight_DN   *= reader_tight_FS->eval_auto_bounds("central", flavor, jet_eta, jet_pt);//this is still just btagSF
       }
 
     }
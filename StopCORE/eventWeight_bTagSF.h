@@ -11,11 +11,16 @@
 // ROOT
 #include "TFile.h"
 #include "TH2.h"
+#include "Math/LorentzVector.h"
 
 // C++
 #include <string>
 #include <vector>
 
+#include "VecView.h"
+
+typedef ROOT::Math::LorentzVector< ROOT::Math::PxPyPzE4D<float> > LorentzVector;
+
 //
 // CLASS
 //
@@ -54,7 +59,8 @@ class eventWeight_bTagSF{
   eventWeight_bTagSF( bool isFastsim );
   ~eventWeight_bTagSF();
 
-  void getBTagWeight( int WP, std::vector< double > jet_pt, std::vector< double > jet_eta, std::vector< double > jet_CSV, std::vector< int > jet_flavour, double &weight_btagsf, double &weight_btagsf_heavy_UP, double &weight_btagsf_heavy_DN, double &weight_btagsf_light_UP, double &weight_btagsf_light_DN, double &weight_btagsf_fastsim_UP, double &weight_btagsf_fastsim_DN );
+  // Views of the jet branches of the babies, no copies are made
+  void getBTagWeight( int WP, VecView< LorentzVector > jet_p4, VecView< float > jet_CSV, VecView< int > jet_flavour, double &weight_btagsf, double &weight_btagsf_heavy_UP, double &weight_btagsf_heavy_DN, double &weight_btagsf_light_UP, double &weight_btagsf_light_DN, double &weight_btagsf_fastsim_UP, double &weight_btagsf_fastsim_DN );
   
 }; // end class def
 
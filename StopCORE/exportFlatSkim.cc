@@ -0,0 +1,184 @@
+// Export skimmed babies to the flat binary format read by FlatSkim, see FlatSkim.h.
+//
+// All the branches of the supported types are exported, or only those given with --branches.
+// The vector<vector<int> >, TBits and string branches are skipped.
+//
+// Usage: ./exportFlatSkim outdir input1.root [input2.root ...] [--branches=<b1,b2,...>]
+
+// C++
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdio>
+#include <stdexcept>
+#include <type_traits>
+#include <sys/stat.h>
+
+// ROOT
+#include "TChain.h"
+#include "TBranch.h"
+#include "TClass.h"
+#include "TDataType.h"
+
+#include "FlatSkim.h"
+
+using namespace std;
+
+class ColumnWriter {
+ public:
+  ColumnWriter(const string& name, const string& type) : name_(name), type_(type), data_(nullptr) {}
+  virtual ~ColumnWriter() { if (data_) fclose(data_); }
+  const string& GetName() const { return name_; }
+  const string& GetType() const { return type_; }
+
+  virtual void Open(const string& dir) {
+    data_ = fopen((dir + "/" + name_ + ".col").c_str(), "wb");
+    if (!data_) throw runtime_error("[exportFlatSkim] Cannot create the file of column " + name_ + "!");
+  }
+  virtual void Connect(TChain* chain) = 0;
+  virtual void Write() = 0;
+
+ protected:
+  string name_;
+  string type_;
+  FILE* data_;
+};
+
+// Bools are stored as one byte, as in memory
+template<class T> class ScalarWriter : public ColumnWriter {
+ public:
+  ScalarWriter(const string& name) : ColumnWriter(name, FlatType<T>::code()), value_(), ptr_(&value_) {}
+  void Connect(TChain* chain) override {
+    // The LorentzVector branches are objects, which ROOT sets through a pointer to their pointer
+    if (is_fundamental<T>::value) chain->SetBranchAddress(name_.c_str(), ptr_);
+    else chain->SetBranchAddress(name_.c_str(), &ptr_);
+  }
+  void Write() override { fwrite(ptr_, sizeof(T), 1, data_); }
+ private:
+  T value_;
+  T* ptr_;
+};
+
+template<class T> class JaggedWriter : public ColumnWriter {
+ public:
+  JaggedWriter(const string& name) : ColumnWriter(name, string("v") + FlatType<T>::code()), values_(nullptr), offsets_(nullptr), offset_(0) {}
+  ~JaggedWriter() { if (offsets_) fclose(offsets_); }
+
+  void Open(const string& dir) override {
+    ColumnWriter::Open(dir);
+    offsets_ = fopen((dir + "/" + name_ + ".off").c_str(), "wb");
+    if (!offsets_) throw runtime_error("[exportFlatSkim] Cannot create the offsets of column " + name_ + "!");
+    fwrite(&offset_, sizeof(uint64_t), 1, offsets_);
+  }
+  void Connect(TChain* chain) override { chain->SetBranchAddress(name_.c_str(), &values_); }
+  void Write() override {
+    // vector<bool> has no contiguous storage to write at once
+    for (const T value : *values_) fwrite(&value, sizeof(T), 1, data_);
+    offset_ += values_->size();
+    fwrite(&offset_, sizeof(uint64_t), 1, offsets_);
+  }
+
+ private:
+  vector<T>* values_;
+  FILE* offsets_;
+  uint64_t offset_;
+};
+
+const string kLorentzVectorName = "ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> >";
+
+// The writer for the type of the branch, null if the type is not supported
+ColumnWriter* makeWriter(TBranch* branch) {
+  const string name = branch->GetName();
+  TClass* cl = nullptr;
+  EDataType type = kOther_t;
+  branch->GetExpectedType(cl, type);
+  if (!cl) {
+    switch (type) {
+      case kBool_t:   return new ScalarWriter<bool>(name);
+      case kInt_t:    return new ScalarWriter<int>(name);
+      case kUInt_t:   return new ScalarWriter<unsigned int>(name);
+      case kFloat_t:  return new ScalarWriter<float>(name);
+      case kDouble_t: return new ScalarWriter<double>(name);
+      default:        return nullptr;
+    }
+  }
+  const string clname = cl->GetName();
+  if (clname == kLorentzVectorName) return new ScalarWriter<FlatLorentzVector>(name);
+  if (clname == "vector<bool>") return new JaggedWriter<bool>(name);
+  if (clname == "vector<int>") return new JaggedWriter<int>(name);
+  if (clname == "vector<unsigned int>") return new JaggedWriter<unsigned int>(name);
+  if (clname == "vector<float>") return new JaggedWriter<float>(name);
+  if (clname == "vector<double>") return new JaggedWriter<double>(name);
+  if (clname == "vector<" + kLorentzVectorName + " >") return new JaggedWriter<FlatLorentzVector>(name);
+  return nullptr;
+}
+
+vector<string> splitList(const string& list) {
+  vector<string> items;
+  istringstream iss(list);
+  string item;
+  while (getline(iss, item, ',')) if (!item.empty()) items.push_back(item);
+  return items;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    cout << "Usage: ./exportFlatSkim outdir input1.root [input2.root ...] [--branches=<b1,b2,...>]" << endl;
+    return 1;
+  }
+
+  string outdir = argv[1];
+  vector<string> branchnames;
+  TChain chain("t");
+  for (int i = 2; i < argc; ++i) {
+    string arg = argv[i];
+    if (arg.find("--branches=") == 0) branchnames = splitList(arg.substr(11));
+    else chain.Add(arg.c_str());
+  }
+
+  vector<unique_ptr<ColumnWriter>> writers;
+  chain.SetBranchStatus("*", 0);
+  if (branchnames.empty()) {
+    TObjArray* branches = chain.GetListOfBranches();
+    for (int i = 0; i < branches->GetEntriesFast(); ++i) {
+      TBranch* branch = (TBranch*) branches->At(i);
+      ColumnWriter* writer = makeWriter(branch);
+      if (writer) writers.emplace_back(writer);
+      else cout << "[exportFlatSkim] >> Skipping branch " << branch->GetName() << " of unsupported type" << endl;
+    }
+  } else {
+    for (const string& name : branchnames) {
+      TBranch* branch = chain.GetBranch(name.c_str());
+      if (!branch) throw invalid_argument("[exportFlatSkim] No branch " + name + " in the input!");
+      ColumnWriter* writer = makeWriter(branch);
+      if (!writer) throw invalid_argument("[exportFlatSkim] Branch " + name + " is of a type not supported by the flat skims!");
+      writers.emplace_back(writer);
+    }
+  }
+
+  mkdir(outdir.c_str(), 0755);
+  remove((outdir + "/columns.txt").c_str());
+  for (auto& writer : writers) {
+    chain.SetBranchStatus(writer->GetName().c_str(), 1);
+    writer->Open(outdir);
+    writer->Connect(&chain);
+  }
+
+  const Long64_t nentries = chain.GetEntries();
+  for (Long64_t i = 0; i < nentries; ++i) {
+    chain.GetEntry(i);
+    for (auto& writer : writers) writer->Write();
+  }
+
+  // The index goes last, a directory without it is an unfinished export
+  ofstream index(outdir + "/columns.txt");
+  index << "entries " << nentries << endl;
+  for (auto& writer : writers) index << writer->GetName() << " " << writer->GetType() << endl;
+  index.close();
+
+  cout << "[exportFlatSkim] >> Exported " << writers.size() << " columns of " << nentries << " entries to " << outdir << endl;
+  return 0;
+}
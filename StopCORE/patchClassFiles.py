@@ -0,0 +1,199 @@
+#! /usr/bin/python
+# coding: utf-8
+
+# Post-process the class files made by makeCMS3ClassFiles.C:
+#  - mark the loaded branches with generation counters instead of flags. GetEntry then only bumps the
+#    entry generation, rather than resetting the _isLoaded flag of every branch, and an accessor reads
+#    its branch when the generation it was last loaded in differs from the current one.
+#  - let the scalar accessors read from a BulkBranch, for the branches selected with SetBulkRead.
+#  - add a <branch>_polar() accessor to the p4 branches, with pt/eta/phi/mass cached per entry.
+#  - read the p4 collections from their split float columns (see SplitP4.h) in babies that have those
+#    instead of the vector<LorentzVector> branch.
+#  - read the branches from the columns of a flat skim (see FlatSkim.h) when one is set with SetFlatSkim.
+# The accessors themselves keep their signatures. Steps already applied to the files are skipped.
+#
+# Usage: python patchClassFiles.py <ClassName>.h <ClassName>.cc
+
+import re
+import sys
+
+def scalarBranches(header):
+    return set(re.findall(r'^\s*const (?:bool|int|unsigned int|float|double) &(\w+)\(\);', header, flags=re.M))
+
+LV = r'ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<float> >'
+
+def p4Branches(header):
+    # name -> whether it is a vector of four-vectors
+    branches = re.findall(r'^\s*const (vector<)?%s (?:> )?&(\w+)\(\);' % re.escape(LV), header, flags=re.M)
+    return dict((name, bool(vec)) for vec, name in branches)
+
+def polarType(isvec):
+    return 'PolarArrays' if isvec else 'PolarP4'
+
+FLATSCALARS = ['bool', 'int', 'unsigned int', 'float', 'double']
+
+def flatBranches(header):
+    # name -> type of the column reader, for the branches of the types the flat skims support
+    flats = {}
+    for cls, name in re.findall(r'^\s*const (.+?) &(\w+)\(\);', header, flags=re.M):
+        if cls in FLATSCALARS:
+            flats[name] = 'FlatScalar<%s>' % cls
+        elif cls == LV or cls in ['vector<%s>' % t for t in FLATSCALARS] or cls == 'vector<%s >' % LV:
+            flats[name] = 'FlatObject<%s >' % cls
+    return flats
+
+def patchHeader(text):
+    # Generation counters
+    if '_isLoaded;' in text:
+        text = re.sub(r'^(\s*)bool(\s+)(\w+)_isLoaded;', r'\1unsigned long long \3_loadedGen;', text, flags=re.M)
+        text = re.sub(r'^(\s*)unsigned int index;\n', r'\1unsigned int index;\n\1unsigned long long entryGeneration = 1;\n', text, count=1, flags=re.M)
+        text = re.sub(r'^(void GetEntry\(unsigned int idx\);\s*\n)', r'\1unsigned long long GetGeneration() const { return entryGeneration; }\n', text, count=1, flags=re.M)
+
+    # Bulk read of the selected scalar branches
+    if 'BulkBranchSet' not in text:
+        scalars = scalarBranches(text)
+        text = text.replace('#include "TBits.h"\n', '#include "TBits.h"\n#include "BulkBranch.h"\n', 1)
+        text = re.sub(r'^(\s*)unsigned long long entryGeneration = 1;\n', r'\g<0>\1BulkBranchSet bulkRead;\n', text, count=1, flags=re.M)
+        text = re.sub(r'^(\s*)unsigned long long (\w+)_loadedGen;\n',
+                      lambda m: m.group(0) + ('%sBulkBranch *%s_bulk;\n' % (m.group(1), m.group(2)) if m.group(2) in scalars else ''), text, flags=re.M)
+        text = re.sub(r'^(unsigned long long GetGeneration\(\) const .*\n)',
+                      r'\1// Read these scalar branches a basket at a time, takes effect from the next Init\n'
+                      r'void SetBulkRead(const vector<string>& branches) { bulkRead.SetBranches(branches); }\n', text, count=1, flags=re.M)
+
+    # Cached polar coordinates of the p4 branches
+    if 'PolarArrays' not in text:
+        p4s = p4Branches(text)
+        text = text.replace('#include "BulkBranch.h"\n', '#include "BulkBranch.h"\n#include "PolarCache.h"\n', 1)
+        text = re.sub(r'^(\s*)unsigned long long (\w+)_loadedGen;\n',
+                      lambda m: m.group(0) + ('%s%s %s_polar_;\n%sunsigned long long %s_polarGen;\n' %
+                                              (m.group(1), polarType(p4s[m.group(2)]), m.group(2), m.group(1), m.group(2)) if m.group(2) in p4s else ''),
+                      text, flags=re.M)
+        text = re.sub(r'^(\s*)const (?:vector<)?%s (?:> )?&(\w+)\(\);\n' % re.escape(LV),
+                      lambda m: m.group(0) + '%sconst %s &%s_polar();\n' % (m.group(1), polarType(p4s[m.group(2)]), m.group(2)), text, flags=re.M)
+
+    # Split columns of the p4 collections
+    if 'SplitP4Reader' not in text:
+        p4s = p4Branches(text)
+        text = text.replace('#include "PolarCache.h"\n', '#include "PolarCache.h"\n#include "SplitP4.h"\n', 1)
+        text = re.sub(r'^(\s*)unsigned long long (\w+)_polarGen;\n',
+                      lambda m: m.group(0) + ('%sSplitP4Reader %s_split;\n' % (m.group(1), m.group(2)) if p4s[m.group(2)] else ''), text, flags=re.M)
+
+    # Columns of a flat skim
+    if 'SetFlatSkim' not in text:
+        flats = flatBranches(text)
+        text = text.replace('#include "SplitP4.h"\n', '#include "SplitP4.h"\n#include "FlatSkim.h"\n', 1)
+        text = re.sub(r'^(\s*)unsigned long long (\w+)_loadedGen;\n',
+                      lambda m: m.group(0) + ('%s%s %s_flat;\n' % (m.group(1), flats[m.group(2)], m.group(2)) if m.group(2) in flats else ''), text, flags=re.M)
+        text = re.sub(r'^(void SetBulkRead\(.*\n)',
+                      r'\1// Read the branches with a column in the flat skim of the tree from it, until the next Init\n'
+                      r'void SetFlatSkim(FlatSkim* skim);\n', text, count=1, flags=re.M)
+    return text
+
+def patchSource(text, header):
+    # Generation counters
+    names = re.findall(r'^\s*(\w+)_isLoaded = false;', text, flags=re.M)
+    if names:
+        # GetEntry: drop the flag resets and bump the generation instead
+        text = re.sub(r'^\s*\w+_isLoaded = false;\n', '', text, flags=re.M)
+        text = text.replace('  // this only marks branches as not loaded, saving a lot of time\n  index = idx;\n',
+                            '  // this only moves on to a new generation, the branches loaded in previous ones get reloaded on access\n'
+                            '  index = idx;\n  ++entryGeneration;\n')
+
+        # Init: start every branch as not loaded, also when switching to the tree of a new file. The generation
+        # itself only ever increases, so that caches keyed on it never see the same value for two entries
+        resets = ''.join('  %s_loadedGen = 0;\n' % name for name in names)
+        text = re.sub(r'^(void \w+::Init\(TTree \*tree\) \{\n)', lambda m: m.group(1) + resets, text, count=1, flags=re.M)
+
+        # Accessors
+        text = re.sub(r'if \(not (\w+)_isLoaded\) \{', r'if (\1_loadedGen != entryGeneration) {', text)
+        text = re.sub(r'(\w+)_isLoaded = true;', r'\1_loadedGen = entryGeneration;', text)
+
+    # Bulk read of the selected scalar branches
+    if 'bulkRead.Clear()' not in text:
+        scalars = sorted(scalarBranches(header), key=lambda name: text.find(' %s_branch = tree->GetBranch' % name))
+        makes = '  bulkRead.Clear();\n' + ''.join('  %s_bulk = bulkRead.Make(%s_branch);\n' % (name, name) for name in scalars)
+        text = re.sub(r'^(  tree->SetMakeClass\(0\);\n\}\n)', lambda m: makes + m.group(1), text, count=1, flags=re.M)
+
+        def bulkAccessor(m):
+            if m.group(3) not in scalars:
+                return m.group(0)
+            return (m.group(1) +
+                    '  if (%s_loadedGen != entryGeneration) {\n'
+                    '    if (%s_bulk != 0) {\n'
+                    '      %s_ = %s_bulk->Get<%s>(index);\n'
+                    '    } else if (%s_branch != 0) {\n' % ((m.group(3),)*4 + (m.group(2), m.group(3))))
+        text = re.sub(r'^(const (bool|int|unsigned int|float|double) &\w+::(\w+)\(\) \{\n)  if \(\3_loadedGen != entryGeneration\) \{\n    if \(\3_branch != 0\) \{\n',
+                      bulkAccessor, text, flags=re.M)
+
+    # Cached polar coordinates of the p4 branches
+    if '_polarGen' not in text:
+        p4s = p4Branches(header)
+        resets = ''.join('  %s_polarGen = 0;\n' % name for name in p4s)
+        text = re.sub(r'^(void \w+::Init\(TTree \*tree\) \{\n)', lambda m: m.group(1) + resets, text, count=1, flags=re.M)
+
+        def polarAccessor(m):
+            cls, name = m.group(2), m.group(3)
+            return (m.group(1) + '\n'
+                    'const %s &%s::%s_polar() {\n'
+                    '  if (%s_polarGen != entryGeneration) {\n'
+                    '    %s_polar_.Fill(%s());\n'
+                    '    %s_polarGen = entryGeneration;\n'
+                    '  }\n'
+                    '  return %s_polar_;\n'
+                    '}\n' % (polarType(p4s[name]), cls, name, name, name, name, name, name))
+        text = re.sub(r'^(const (?:vector<)?%s (?:> )?&(\w+)::(\w+)\(\) \{\n.*?\n\}\n)' % re.escape(LV), polarAccessor, text, flags=re.M|re.S)
+        text = re.sub(r'^const (?:vector<)?%s (?:> )?&(\w+)\(\) \{ return (\w+)\.\1\(\); \}\n' % re.escape(LV),
+                      lambda m: m.group(0) + 'const %s &%s_polar() { return %s.%s_polar(); }\n' % (polarType(p4s[m.group(1)]), m.group(1), m.group(2), m.group(1)),
+                      text, flags=re.M)
+
+    # Split columns of the p4 collections
+    if '_split.Init' not in text:
+        collections = [name for name, isvec in p4Branches(header).items() if isvec]
+        for name in collections:
+            text = text.replace('  if (%s_branch) %s_branch->SetAddress(&%s_);\n' % (name, name, name),
+                                '  if (%s_branch) %s_branch->SetAddress(&%s_);\n  %s_split.Init(tree, "%s");\n' % (name, name, name, name, name), 1)
+            text = text.replace('  if (%s_branch != 0) %s();\n' % (name, name),
+                                '  if (%s_branch != 0 || %s_split.IsActive()) %s();\n' % (name, name, name), 1)
+            text = re.sub(r'(\n    if \(%s_branch != 0\) \{\n      %s_branch->GetEntry\(index\);\n    \} )else \{' % (name, name),
+                          lambda m: m.group(1) + 'else if (%s_split.IsActive()) {\n      %s_ = &%s_split.GetP4s(index);\n    } else {' % (name, name, name), text, count=1)
+            text = text.replace('    %s_polar_.Fill(%s());\n' % (name, name),
+                                '    if (%s_branch == 0 && %s_split.IsActive()) %s_split.GetPolar(index, %s_polar_);\n'
+                                '    else %s_polar_.Fill(%s());\n' % ((name,)*6), 1)
+
+    # Columns of a flat skim, taking precedence over the tree and its bulk readers
+    if 'SetFlatSkim' not in text:
+        flats = flatBranches(header)
+        names = sorted(flats, key=lambda name: text.find(' %s_branch = tree->GetBranch' % name))
+        text = text.replace('  bulkRead.Clear();\n', '  SetFlatSkim(0);\n  bulkRead.Clear();\n', 1)
+        text = re.sub(r'^void (\w+)::LoadAllBranches\(\) \{\n',
+                      lambda m: ('void %s::SetFlatSkim(FlatSkim* skim) {\n' % m.group(1) +
+                                 ''.join('  %s_flat.Init(skim, "%s");\n' % (name, name) for name in names) + '}\n\n' + m.group(0)),
+                      text, count=1, flags=re.M)
+
+        def flatAccessor(m):
+            name = m.group(2)
+            if name not in flats:
+                return m.group(0)
+            return (m.group(1) +
+                    '    if (%s_flat.IsActive()) {\n'
+                    '      %s_ = %s_flat.Get(index);\n'
+                    '    } else if (%s_%s != 0) {\n' % (name, name, name, name, m.group(3)))
+        text = re.sub(r'^(const .+? &\w+::(\w+)\(\) \{\n  if \(\2_loadedGen != entryGeneration\) \{\n)    if \(\2_(bulk|branch) != 0\) \{\n',
+                      flatAccessor, text, flags=re.M)
+    return text
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        print('Usage: python patchClassFiles.py <ClassName>.h <ClassName>.cc')
+        sys.exit(1)
+
+    with open(sys.argv[1]) as f:
+        header = f.read()
+    with open(sys.argv[2]) as f:
+        source = f.read()
+    source = patchSource(source, header)
+    header = patchHeader(header)
+    for fname, text in [(sys.argv[1], header), (sys.argv[2], source)]:
+        with open(fname, 'w') as f:
+            f.write(text)
+        print('Patched ' + fname)
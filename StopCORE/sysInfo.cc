@@ -1551,20 +1551,7 @@ void sysInfo::evtWgtInfo::getBTagWeight_tightWP( double &wgt_btagsf_tight, doubl
 
 void sysInfo::evtWgtInfo::getBTagWeight_fromFiles( int WP, double &wgt_btagsf, double &wgt_btagsf_hf_up, double &wgt_btagsf_hf_dn, double &wgt_btagsf_lf_up, double &wgt_btagsf_lf_dn, double &wgt_btagsf_fs_up, double &wgt_btagsf_fs_dn ){
 
-  vector< double > jet_pt;
-  vector< double > jet_eta;
-  vector< double > jet_CSV;
-  vector< int >    jet_flavour;
-
-
-  for(int iJet=0; iJet<(int)babyAnalyzer.ak4pfjets_p4().size(); iJet++){
-    jet_pt.push_back( (double)babyAnalyzer.ak4pfjets_p4().at(iJet).Pt() );
-    jet_eta.push_back( (double)babyAnalyzer.ak4pfjets_p4().at(iJet).Eta() );
-    jet_CSV.push_back( (double)babyAnalyzer.ak4pfjets_CSV().at(iJet) );
-    jet_flavour.push_back( (int)abs(babyAnalyzer.ak4pfjets_hadron_flavor().at(iJet)) );
-  }
-
-  bTagSFUtil->getBTagWeight( WP, jet_pt, jet_eta, jet_CSV, jet_flavour, wgt_btagsf, wgt_btagsf_hf_up, wgt_btagsf_hf_dn, wgt_btagsf_lf_up, wgt_btagsf_lf_dn, wgt_btagsf_fs_up, wgt_btagsf_fs_dn );
+  bTagSFUtil->getBTagWeight( WP, babyAnalyzer.ak4pfjets_p4(), babyAnalyzer.ak4pfjets_CSV(), babyAnalyzer.ak4pfjets_hadron_flavor(), wgt_btagsf, wgt_btagsf_hf_up, wgt_btagsf_hf_dn, wgt_btagsf_lf_up, wgt_btagsf_lf_dn, wgt_btagsf_fs_up, wgt_btagsf_fs_dn );
 
   return;
 
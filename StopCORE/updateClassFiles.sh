@@ -17,4 +17,7 @@ OBJECT=babyAnalyzer
 
 root -l -b -q makeCMS3ClassFiles.C++'("'$UPDATED_BABY_FILE'","'$TREE'","'$CLASS_NAME'","'$NAMESPACE'","'$OBJECT'")'
 rm ScanChain.C
-rm doAll.C
\ No newline at end of file
+rm doAll.C
+
+# Track the loaded branches with generation counters, so that GetEntry doesn't reset every branch flag
+python patchClassFiles.py $CLASS_NAME.h $CLASS_NAME.cc
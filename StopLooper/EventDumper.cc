@@ -0,0 +1,205 @@
+#include <iostream>
+#include <stdexcept>
+#include <cstdint>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "EventDumper.h"
+
+using namespace std;
+
+// Size of the text buffer and number of records in a binary block before handing them to the writer
+const size_t kTextBufferSize = 1 << 20;
+const size_t kBlockRows = 4096;
+
+template<class T> static void appendRaw(string& buf, const T& val) {
+  buf.append(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+template<class T> static void appendArray(string& buf, const vector<T>& vals) {
+  buf.append(reinterpret_cast<const char*>(vals.data()), vals.size() * sizeof(T));
+}
+
+static void appendName(string& buf, const string& name) {
+  appendRaw(buf, (uint16_t) name.size());
+  buf.append(name);
+}
+
+EventDumper::EventDumper() : isopen_(false), format_(k_text), done_(false), writing_(false), nrecords_(0) {}
+
+EventDumper::~EventDumper() {
+  Close();
+}
+
+EventDumper::Format EventDumper::FormatFromName(const string& fname) {
+  return (fname.size() > 4 && fname.compare(fname.size()-4, 4, ".bin") == 0)? k_binary : k_text;
+}
+
+void EventDumper::Open(const string& fname, Format format, const vector<string>& regions, const vector<string>& columns,
+                       long long resumeOffset) {
+  if (isopen_) Close();
+
+  ios::openmode mode = (format == k_binary)? ios::out | ios::binary : ios::out;
+  if (resumeOffset > 0) {
+    // Drop the records written after the checkpoint, and append from there
+    struct stat st;
+    if (stat(fname.c_str(), &st) != 0)
+      throw invalid_argument("[EventDumper::Open] Cannot find " + fname + " to resume the event dump from!");
+    if (st.st_size < resumeOffset)
+      throw invalid_argument("[EventDumper::Open] " + fname + " is shorter than at the checkpoint, cannot resume the event dump!");
+    if (truncate(fname.c_str(), resumeOffset) != 0)
+      throw invalid_argument("[EventDumper::Open] Cannot truncate " + fname + " to resume the event dump!");
+    mode |= ios::app;
+  }
+  ofile_.open(fname, mode);
+  if (!ofile_) throw invalid_argument("[EventDumper::Open] Cannot open " + fname + " for writing!");
+
+  fname_ = fname;
+  format_ = format;
+  regions_ = set<string>(regions.begin(), regions.end());
+  columns_ = columns;
+  colvals_.assign(columns_.size(), vector<float>());
+  nrecords_ = 0;
+  done_ = false;
+  isopen_ = true;
+
+  if (format_ == k_binary && resumeOffset == 0) {
+    string header("STOPDUMP");
+    appendRaw(header, (uint32_t) 1);
+    appendRaw(header, (uint32_t) columns_.size());
+    for (const auto& col : columns_) appendName(header, col);
+    ofile_.write(header.data(), header.size());
+  } else if (format_ == k_text) {
+    textbuf_.reserve(kTextBufferSize);
+  }
+
+  writer_ = thread(&EventDumper::WriteLoop, this);
+}
+
+void EventDumper::Close() {
+  if (!isopen_) return;
+
+  if (format_ == k_binary) FlushBlock();
+  else if (!textbuf_.empty()) Submit(move(textbuf_));
+  textbuf_.clear();
+
+  {
+    lock_guard<mutex> lock(mutex_);
+    done_ = true;
+  }
+  cond_.notify_all();
+  writer_.join();
+  ofile_.close();
+  isopen_ = false;
+
+  cout << "[EventDumper::Close] >> " << nrecords_ << " records written" << endl;
+}
+
+long long EventDumper::Flush() {
+  if (!isopen_) return 0;
+
+  if (format_ == k_binary) FlushBlock();
+  else if (!textbuf_.empty()) Submit(move(textbuf_));
+  textbuf_.clear();
+
+  unique_lock<mutex> lock(mutex_);
+  cond_.wait(lock, [this]() { return queue_.empty() && !writing_; });
+  ofile_.flush();
+  struct stat st;
+  if (stat(fname_.c_str(), &st) != 0)
+    throw invalid_argument("[EventDumper::Flush] Cannot get the size of " + fname_ + "!");
+  return st.st_size;
+}
+
+void EventDumper::Fill(unsigned int run, unsigned int ls, unsigned long long evt, const string& region,
+                       const map<string,float>& values, float weight) {
+  if (!isopen_ || !IsSelectedRegion(region)) return;
+  ++nrecords_;
+
+  auto getValue = [&](const string& col) {
+    if (col == "weight") return weight;
+    auto it = values.find(col);
+    return (it == values.end())? -9999.f : it->second;
+  };
+
+  if (format_ == k_binary) {
+    auto ireg = blockregions_.emplace(region, blockregions_.size()).first;
+    runs_.push_back(run);
+    lss_.push_back(ls);
+    evts_.push_back(evt);
+    regionidx_.push_back(ireg->second);
+    for (size_t icol = 0; icol < columns_.size(); ++icol)
+      colvals_[icol].push_back(getValue(columns_[icol]));
+    if (runs_.size() >= kBlockRows) FlushBlock();
+  } else {
+    char num[32];
+    textbuf_ += to_string(run); textbuf_ += ' ';
+    textbuf_ += to_string(ls);  textbuf_ += ' ';
+    textbuf_ += to_string(evt); textbuf_ += ' ';
+    textbuf_ += region;
+    for (const auto& col : columns_) {
+      snprintf(num, sizeof(num), "%g", getValue(col));
+      textbuf_ += ' '; textbuf_ += col; textbuf_ += '='; textbuf_ += num;
+    }
+    textbuf_ += '\n';
+    if (textbuf_.size() >= kTextBufferSize) {
+      Submit(move(textbuf_));
+      textbuf_.clear();
+      textbuf_.reserve(kTextBufferSize);
+    }
+  }
+}
+
+void EventDumper::FlushBlock() {
+  if (runs_.empty()) return;
+
+  vector<string> names(blockregions_.size());
+  for (const auto& reg : blockregions_) names[reg.second] = reg.first;
+
+  string block;
+  appendRaw(block, (uint32_t) runs_.size());
+  appendRaw(block, (uint16_t) names.size());
+  for (const auto& name : names) appendName(block, name);
+  appendArray(block, runs_);
+  appendArray(block, lss_);
+  appendArray(block, evts_);
+  appendArray(block, regionidx_);
+  for (auto& vals : colvals_) {
+    appendArray(block, vals);
+    vals.clear();
+  }
+  Submit(move(block));
+
+  runs_.clear();
+  lss_.clear();
+  evts_.clear();
+  regionidx_.clear();
+  blockregions_.clear();
+}
+
+void EventDumper::Submit(string&& buffer) {
+  {
+    lock_guard<mutex> lock(mutex_);
+    queue_.push_back(move(buffer));
+  }
+  cond_.notify_all();
+}
+
+void EventDumper::WriteLoop() {
+  unique_lock<mutex> lock(mutex_);
+  while (true) {
+    cond_.wait(lock, [this]() { return done_ || !queue_.empty(); });
+    if (queue_.empty() && done_) break;
+    string buffer = move(queue_.front());
+    queue_.pop_front();
+    // Don't hold the lock while writing, so that the looper can keep on queueing buffers
+    writing_ = true;
+    lock.unlock();
+    ofile_.write(buffer.data(), buffer.size());
+    lock.lock();
+    writing_ = false;
+    cond_.notify_all();
+  }
+  ofile_.flush();
+}
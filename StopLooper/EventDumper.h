@@ -0,0 +1,91 @@
+#ifndef EVENTDUMPER_h
+#define EVENTDUMPER_h
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <deque>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// class: EventDumper
+// Event list for sync exercises and debugging. Records are formatted into an in-memory
+// buffer by the looper and the full buffers are handed to a background thread that does the
+// actual writing, so the event loop never waits on the disk.
+//
+// Two formats are supported:
+//  - text:   one line per record, "run ls evt region col1=val1 col2=val2 ..."
+//  - binary: blocks of records stored column by column, each block is self-contained:
+//              uint32 nrows, uint16 nregions, nregions x (uint16 length + chars),
+//              uint32 run[nrows], uint32 ls[nrows], uint64 evt[nrows], uint16 region[nrows],
+//              then one float[nrows] array per column
+//            after a file header of "STOPDUMP", uint32 version, uint32 ncolumns, ncolumns x (uint16 length + chars).
+//            Everything is little endian as written by the machine running the looper.
+
+class EventDumper {
+
+public:
+
+  enum Format { k_text, k_binary };
+
+  EventDumper();
+  ~EventDumper();
+
+  // The regions and columns are selected by name, an empty list of regions dumps every region.
+  // Columns are keys of the looper values_ map, or "weight" for the event weight.
+  // A non-zero resumeOffset continues a file from a checkpoint, dropping what was written after it.
+  void Open(const std::string& fname, Format format, const std::vector<std::string>& regions, const std::vector<std::string>& columns,
+            long long resumeOffset = 0);
+
+  // Flush what is left in the buffer and wait for the writer thread to finish
+  void Close();
+
+  // Write out everything filled so far and return the size of the file, used for checkpoints
+  long long Flush();
+
+  bool IsOpen() const { return isopen_; }
+  bool IsSelectedRegion(const std::string& region) const { return regions_.empty() || regions_.count(region); }
+
+  void Fill(unsigned int run, unsigned int ls, unsigned long long evt, const std::string& region,
+            const std::map<std::string,float>& values, float weight);
+
+  // Guess the format from the file name, ".bin" for binary and text otherwise
+  static Format FormatFromName(const std::string& fname);
+
+private:
+
+  void WriteLoop();
+  void FlushBlock();
+  void Submit(std::string&& buffer);
+
+  bool isopen_;
+  std::string fname_;
+  Format format_;
+  std::set<std::string> regions_;
+  std::vector<std::string> columns_;
+
+  // Producer side buffers, only touched by the looper thread
+  std::string textbuf_;
+  std::vector<unsigned int> runs_;
+  std::vector<unsigned int> lss_;
+  std::vector<unsigned long long> evts_;
+  std::vector<unsigned short> regionidx_;
+  std::vector<std::vector<float>> colvals_;
+  std::map<std::string, unsigned short> blockregions_;
+
+  // Hand-over queue to the writer thread
+  std::ofstream ofile_;
+  std::thread writer_;
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::deque<std::string> queue_;
+  bool done_;
+  bool writing_;
+
+  unsigned long long nrecords_;
+};
+
+#endif
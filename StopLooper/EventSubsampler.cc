@@ -0,0 +1,84 @@
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+
+#include "TBranch.h"
+#include "TString.h"
+
+#include "EventSubsampler.h"
+
+// splitmix64 finalizer, gives well mixed bits for the consecutive event numbers
+static uint64_t mixBits(uint64_t x) {
+  x += 0x9e3779b97f4a7c15ULL;
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+void EventSubsampler::SetFraction(float fraction) {
+  if (!(fraction > 0 && fraction <= 1))
+    throw std::invalid_argument(Form("[EventSubsampler::SetFraction] The fraction must be in (0, 1], got %g!", fraction));
+  fraction_ = fraction;
+  // Compare the top 53 bits of the hash, exact in double precision
+  threshold_ = (unsigned long long) (fraction_ * 9007199254740992.);  // 2^53
+}
+
+bool EventSubsampler::Accept(unsigned long long run, unsigned long long ls, unsigned long long evt) const {
+  if (!IsActive()) return true;
+  uint64_t hash = mixBits(mixBits(mixBits(run) ^ ls) ^ evt);
+  return (hash >> 11) < threshold_;
+}
+
+void EventSubsampler::ResetCluster() {
+  tree_ = nullptr;
+  leaf_run_ = leaf_ls_ = leaf_evt_ = nullptr;
+  cluster_begin_ = cluster_end_ = 0;
+  selected_.clear();
+}
+
+void EventSubsampler::LoadCluster(TTree* tree, Long64_t entry) {
+  if (tree != tree_) {
+    ResetCluster();
+    tree_ = tree;
+    leaf_run_ = tree->GetLeaf("run");
+    leaf_ls_ = tree->GetLeaf("ls");
+    leaf_evt_ = tree->GetLeaf("evt");
+    if (!leaf_run_ || !leaf_ls_ || !leaf_evt_)
+      throw std::invalid_argument("[EventSubsampler::LoadCluster] Cannot find the run/ls/evt branches in the tree!");
+  }
+
+  TTree::TClusterIterator clusterIter = tree->GetClusterIterator(entry);
+  cluster_begin_ = clusterIter();
+  cluster_end_ = clusterIter.GetNextEntry();
+  if (cluster_end_ > tree->GetEntries()) cluster_end_ = tree->GetEntries();
+
+  // Only the baskets of the id branches are read here, the address of the branches is left untouched
+  selected_.assign(cluster_end_ - cluster_begin_, false);
+  for (Long64_t ientry = cluster_begin_; ientry < cluster_end_; ++ientry) {
+    leaf_run_->GetBranch()->GetEntry(ientry);
+    leaf_ls_->GetBranch()->GetEntry(ientry);
+    leaf_evt_->GetBranch()->GetEntry(ientry);
+    selected_[ientry - cluster_begin_] = Accept(leaf_run_->GetValueLong64(), leaf_ls_->GetValueLong64(), leaf_evt_->GetValueLong64());
+  }
+}
+
+bool EventSubsampler::Accept(TTree* tree, Long64_t entry) {
+  if (!IsActive()) return true;
+  if (tree != tree_ || entry < cluster_begin_ || entry >= cluster_end_)
+    LoadCluster(tree, entry);
+
+  ++nentries_;
+  bool pass = selected_[entry - cluster_begin_];
+  if (pass) ++nselected_;
+  return pass;
+}
+
+TH1D* EventSubsampler::MakeSummaryHist() const {
+  TH1D* h = new TH1D("h_subsample", Form("Subsampling with fraction %g;;Entries", fraction_), 2, 0, 2);
+  h->SetDirectory(nullptr);
+  h->GetXaxis()->SetBinLabel(1, "considered");
+  h->GetXaxis()->SetBinLabel(2, "selected");
+  h->SetBinContent(1, nentries_);
+  h->SetBinContent(2, nselected_);
+  return h;
+}
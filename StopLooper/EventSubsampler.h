@@ -0,0 +1,67 @@
+#ifndef EVENTSUBSAMPLER_h
+#define EVENTSUBSAMPLER_h
+
+#include <vector>
+
+#include "TTree.h"
+#include "TLeaf.h"
+#include "TH1D.h"
+
+// class: EventSubsampler
+// Deterministic selection of a fraction of the events for quick shape checks. The decision
+// only depends on run/ls/evt, so the same events are kept in every sample, year and rerun.
+// The ids are read for a whole cluster of the tree at once, and the other branches of the
+// rejected entries are never read.
+
+class EventSubsampler {
+
+public:
+
+  EventSubsampler() : fraction_(1), nentries_(0), nselected_(0) { ResetCluster(); }
+  ~EventSubsampler() {}
+
+  // A fraction of 1 turns the subsampling off
+  void SetFraction(float fraction);
+  float GetFraction() const { return fraction_; }
+  bool IsActive() const { return fraction_ < 1; }
+
+  // Weight to apply to the selected events for unbiased yields
+  double GetWeight() const { return 1. / fraction_; }
+
+  // Hash based decision for the event, independent of the position in the file
+  bool Accept(unsigned long long run, unsigned long long ls, unsigned long long evt) const;
+
+  // Decision for the entry of the tree, only reads the run/ls/evt branches
+  bool Accept(TTree* tree, Long64_t entry);
+
+  // New tree, to be called when opening each file
+  void ResetCluster();
+
+  // Counters of the entries considered and selected, kept when resuming from a checkpoint
+  Long64_t GetNEntries() const { return nentries_; }
+  Long64_t GetNSelected() const { return nselected_; }
+  void SetCounts(Long64_t nentries, Long64_t nselected) { nentries_ = nentries; nselected_ = nselected; }
+
+  // Same counters in bin 1 and 2 respectively, safe to hadd
+  TH1D* MakeSummaryHist() const;
+
+private:
+
+  void LoadCluster(TTree* tree, Long64_t entry);
+
+  float fraction_;
+  unsigned long long threshold_;  // accept when the hash is below this value
+
+  const TTree* tree_;
+  TLeaf* leaf_run_;
+  TLeaf* leaf_ls_;
+  TLeaf* leaf_evt_;
+  Long64_t cluster_begin_;
+  Long64_t cluster_end_;
+  std::vector<bool> selected_;  // decisions for the entries of the current cluster
+
+  Long64_t nentries_;
+  Long64_t nselected_;
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "TSystem.h"
+#include "TObjString.h"
+
+#include "FileManifest.h"
+
+using namespace std;
+
+bool FileManifest::Read(TDirectory* dir) {
+  files_.clear();
+  TObjString* text = (TObjString*) dir->Get("manifest");
+  if (!text) return false;
+
+  istringstream sin(text->GetString().Data());
+  string line;
+  while (getline(sin, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    istringstream ss(line);
+    string path;
+    FileInfo info;
+    if (!(ss >> path >> info.size >> info.mtime >> info.entries))
+      throw invalid_argument("[FileManifest::Read] Cannot parse line of the manifest: " + line);
+    files_[path] = info;
+  }
+  delete text;
+  return true;
+}
+
+void FileManifest::Write(TDirectory* dir) const {
+  ostringstream sout;
+  sout << "# path size mtime entries" << endl;
+  for (const auto& file : files_)
+    sout << file.first << ' ' << file.second.size << ' ' << file.second.mtime << ' ' << file.second.entries << '\n';
+  TObjString text(sout.str().c_str());
+  dir->WriteTObject(&text, "manifest");
+}
+
+FileManifest::FileInfo FileManifest::Stat(const string& path) {
+  FileStat_t stat;
+  if (gSystem->GetPathInfo(path.c_str(), stat) != 0)
+    throw invalid_argument("[FileManifest::Stat] Cannot stat " + path + "!");
+  return FileInfo{stat.fSize, stat.fMtime, -1};
+}
+
+bool FileManifest::Contains(const string& path, const FileInfo& info) const {
+  auto iter = files_.find(path);
+  if (iter == files_.end()) return false;
+  if (iter->second.size != info.size || iter->second.mtime != info.mtime)
+    throw invalid_argument("[FileManifest::Contains] " + path + " has changed since it was added to the output, "
+                           "the output needs to be remade without --incremental!");
+  return true;
+}
@@ -0,0 +1,47 @@
+#ifndef FILEMANIFEST_h
+#define FILEMANIFEST_h
+
+#include <string>
+#include <map>
+
+#include "TDirectory.h"
+
+// class: FileManifest
+// List of the input files already folded into an output of the looper, for the incremental mode.
+// Stored in the output file itself as a text object, with one line per input: path, size,
+// modification time and number of entries. Being in the same file as the histograms, the list
+// can never get out of sync with them.
+
+class FileManifest {
+
+public:
+
+  struct FileInfo {
+    long long size;
+    long long mtime;
+    long long entries;
+  };
+
+  FileManifest() {}
+  ~FileManifest() {}
+
+  // Returns false if there is no manifest in dir
+  bool Read(TDirectory* dir);
+  void Write(TDirectory* dir) const;
+
+  // Size and modification time of the file on disk (or through the ROOT plugins for remote files)
+  static FileInfo Stat(const std::string& path);
+
+  // Whether the file is already in the manifest, throws if it changed since it was processed
+  bool Contains(const std::string& path, const FileInfo& info) const;
+  const FileInfo& Get(const std::string& path) const { return files_.at(path); }
+
+  void Add(const std::string& path, const FileInfo& info) { files_[path] = info; }
+  size_t Size() const { return files_.size(); }
+
+private:
+
+  std::map<std::string, FileInfo> files_;
+};
+
+#endif
@@ -0,0 +1,77 @@
+#include <vector>
+#include <algorithm>
+
+#include "TArrayD.h"
+#include "TArrayF.h"
+#include "TString.h"
+
+#include "HistMemory.h"
+
+using namespace std;
+
+HistMemoryBudget histMemBudget;
+
+void HistMemoryBudget::Reset() {
+  total_ = 0;
+  nhists_ = 0;
+  warnlevel_ = 0;
+  regionnames_.clear();
+  byregion_.clear();
+  byfamily_.clear();
+}
+
+void HistMemoryBudget::RegisterRegion(const map<string, TH1*>* histmap, const string& name) {
+  regionnames_[histmap] = name;
+}
+
+bool HistMemoryBudget::IsYieldHist(const string& hname) {
+  return (hname.find("metbins") != string::npos || hname.find("hnum") == 0 || hname.find("hden") == 0);
+}
+
+string HistMemoryBudget::GetFamily(const string& hname) {
+  size_t pos = hname.find('_');
+  if (pos != string::npos) pos = hname.find('_', pos+1);
+  return hname.substr(0, pos);
+}
+
+size_t HistMemoryBudget::GetHistMemory(const TH1* hist) {
+  size_t ncells = hist->GetNcells();
+  size_t cellsize = sizeof(double);
+  if (dynamic_cast<const TArrayF*>(hist)) cellsize = sizeof(float);
+  else if (!dynamic_cast<const TArrayD*>(hist)) cellsize = sizeof(int);  // TH1I and alike
+  return sizeof(*hist) + ncells * cellsize + hist->GetSumw2N() * sizeof(double);
+}
+
+void HistMemoryBudget::Book(const map<string, TH1*>* histmap, const TH1* hist) {
+  double mem = GetHistMemory(hist);
+  total_ += mem;
+  ++nhists_;
+
+  auto iter = regionnames_.find(histmap);
+  byregion_[(iter == regionnames_.end())? "(other)" : iter->second] += mem;
+  byfamily_[GetFamily(hist->GetName())] += mem;
+
+  // Warn once when getting close to the ceiling and once again when going over it
+  if (ceiling_ > 0 && warnlevel_ < 2 && total_ > (0.9 + 0.1*warnlevel_) * ceiling_) {
+    ++warnlevel_;
+    cout << "[HistMemoryBudget::Book] WARNING: histograms take " << Form("%.1f", GetTotalMB()) << " MB, "
+         << ((warnlevel_ == 1)? "approaching" : "above") << " the ceiling of " << Form("%.0f", ceiling_/1024/1024) << " MB!" << endl;
+    Report(cout, "at the ceiling warning", 5);
+  }
+}
+
+void HistMemoryBudget::Report(ostream& os, const string& when, unsigned int ntop) const {
+  auto printTop = [&](const map<string, double>& mems, const string& label) {
+    vector<pair<string, double>> sorted(mems.begin(), mems.end());
+    sort(sorted.begin(), sorted.end(), [](const pair<string, double>& a, const pair<string, double>& b) { return a.second > b.second; });
+    os << "    Top " << label << ":" << endl;
+    for (size_t i = 0; i < sorted.size() && i < ntop; ++i)
+      os << Form("      %-32s %10.2f MB", sorted[i].first.c_str(), sorted[i].second/1024/1024) << endl;
+  };
+
+  os << "[HistMemoryBudget] Memory of " << nhists_ << " histograms " << when << ": " << Form("%.1f", GetTotalMB()) << " MB"
+     << ((compact_)? " (compact mode)" : "") << endl;
+  if (nhists_ == 0) return;
+  printTop(byregion_, "regions");
+  printTop(byfamily_, "histogram families");
+}
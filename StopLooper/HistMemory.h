@@ -0,0 +1,62 @@
+#ifndef HISTMEMORY_h
+#define HISTMEMORY_h
+
+#include <string>
+#include <map>
+#include <iostream>
+
+#include "TH1.h"
+
+// class: HistMemoryBudget
+// Book keeping of the memory taken by the histograms booked through the plotXd functions,
+// accounted per region (histMap) and per histogram family (name up to the 2nd underscore).
+// Also holds the switch of the compact booking mode, where the kinematic histograms are
+// booked with float storage and without Sumw2, while the yield histograms are kept as is.
+
+class HistMemoryBudget {
+
+public:
+
+  HistMemoryBudget() : compact_(false), ceiling_(0), total_(0), nhists_(0), warnlevel_(0) {}
+  ~HistMemoryBudget() {}
+
+  void Reset();
+
+  // Configuration
+  void SetCompactMode(bool compact) { compact_ = compact; }
+  void SetCeilingMB(double ceiling) { ceiling_ = ceiling * 1024 * 1024; }
+  bool IsCompactMode() const { return compact_; }
+
+  // Give a name to a histMap, so that the histograms booked into it are accounted to that region
+  void RegisterRegion(const std::map<std::string, TH1*>* histmap, const std::string& name);
+
+  // Whether the histogram need double precision and Sumw2 in compact mode: yields and efficiency hists
+  static bool IsYieldHist(const std::string& hname);
+  bool UseCompactStorage(const std::string& hname) const { return compact_ && !IsYieldHist(hname); }
+
+  // Account a newly booked histogram
+  void Book(const std::map<std::string, TH1*>* histmap, const TH1* hist);
+
+  static size_t GetHistMemory(const TH1* hist);
+  double GetTotalMB() const { return total_ / 1024. / 1024.; }
+
+  void Report(std::ostream& os, const std::string& when, unsigned int ntop = 10) const;
+
+private:
+
+  static std::string GetFamily(const std::string& hname);
+
+  bool compact_;
+  double ceiling_;
+  double total_;
+  unsigned int nhists_;
+  int warnlevel_;
+
+  std::map<const std::map<std::string, TH1*>*, std::string> regionnames_;
+  std::map<std::string, double> byregion_;
+  std::map<std::string, double> byfamily_;
+};
+
+extern HistMemoryBudget histMemBudget;
+
+#endif
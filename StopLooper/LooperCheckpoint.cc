@@ -0,0 +1,273 @@
+#include <iostream>
+#include <cstdio>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include "TFile.h"
+#include "TKey.h"
+#include "TClass.h"
+#include "TTree.h"
+#include "TParameter.h"
+#include "TNamed.h"
+#include "TH1.h"
+#include "TString.h"
+
+#include "HistMemory.h"
+#include "LooperCheckpoint.h"
+
+using namespace std;
+
+// One record of the ids file of the checkpoint
+struct EventIdRecord {
+  unsigned int run;
+  unsigned int ls;
+  unsigned long long evt;
+};
+static_assert(sizeof(EventIdRecord) == 16, "The records of the ids file must not be padded");
+
+static bool isRestorableHist(const string& key, const TH1* hist) {
+  if (key.find("HI") != string::npos || key.find("LOW") != string::npos) return false;
+  if (key.find("ratio") == 0) return false;
+  return key == hist->GetName();  // linked entries get linked again on the next linkHist call
+}
+
+void writeHistMaps(TDirectory* dir, const vector<SR>& srvec) {
+  for (const auto& sr : srvec) {
+    TDirectory* srdir = dir->GetDirectory(sr.GetName().c_str());
+    if (!srdir) srdir = dir->mkdir(sr.GetName().c_str());
+    for (const auto& h : sr.histMap) {
+      if (!isRestorableHist(h.first, h.second)) continue;
+      srdir->WriteTObject(h.second);
+    }
+  }
+}
+
+void loadHistMaps(TDirectory* dir, vector<SR>& srvec, TDirectory* bookdir) {
+  for (auto& sr : srvec) {
+    TDirectory* srdir = dir->GetDirectory(sr.GetName().c_str());
+    if (!srdir) continue;
+    for (TObject* obj : *srdir->GetListOfKeys()) {
+      TKey* key = (TKey*) obj;
+      string hname = key->GetName();
+      if (!TClass::GetClass(key->GetClassName())->InheritsFrom(TH1::Class())) continue;
+      TH1* hist = (TH1*) key->ReadObj();
+      if (!isRestorableHist(hname, hist)) {
+        delete hist;
+        continue;
+      }
+      auto iter = sr.histMap.find(hname);
+      if (iter != sr.histMap.end()) {
+        iter->second->Add(hist);
+        delete hist;
+      } else {
+        hist->SetDirectory(bookdir);
+        sr.histMap[hname] = hist;
+        histMemBudget.Book(&sr.histMap, hist);
+      }
+    }
+  }
+}
+
+void writeHistMaps(TDirectory* dir, const RegionList& regions) {
+  for (const auto& region : regions) {
+    TDirectory* subdir = dir;
+    if (!region.first.empty()) {
+      if (!dir->GetDirectory(region.first.c_str())) dir->mkdir(region.first.c_str());
+      subdir = dir->GetDirectory(region.first.c_str());  // mkdir returns the top of a nested path
+    }
+    writeHistMaps(subdir, *region.second);
+  }
+}
+
+void loadHistMaps(TDirectory* dir, const RegionList& regions, TDirectory* bookdir) {
+  for (const auto& region : regions) {
+    TDirectory* subdir = (region.first.empty())? dir : dir->GetDirectory(region.first.c_str());
+    if (subdir) loadHistMaps(subdir, *region.second, bookdir);
+  }
+}
+
+void writeEventIds(TDirectory* dir, const LooperState& state) {
+  TDirectory::TContext ctx(dir);
+  unsigned int run, ls;
+  unsigned long long evt;
+  TTree* tree = new TTree("dedup", "Event ids seen by the duplicate removal");
+  tree->Branch("run", &run);
+  tree->Branch("ls", &ls);
+  tree->Branch("evt", &evt);
+  for (size_t i = 0; i < state.dup_run.size(); ++i) {
+    run = state.dup_run[i];
+    ls = state.dup_ls[i];
+    evt = state.dup_evt[i];
+    tree->Fill();
+  }
+  tree->Write();
+}
+
+void readEventIds(TDirectory* dir, LooperState& state) {
+  TTree* tree = (TTree*) dir->Get("dedup");
+  if (!tree) return;
+  unsigned int run, ls;
+  unsigned long long evt;
+  tree->SetBranchAddress("run", &run);
+  tree->SetBranchAddress("ls", &ls);
+  tree->SetBranchAddress("evt", &evt);
+  for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+    tree->GetEntry(i);
+    state.dup_run.push_back(run);
+    state.dup_ls.push_back(ls);
+    state.dup_evt.push_back(evt);
+  }
+  delete tree;
+}
+
+void LooperState::Reset() {
+  ifile = 0;
+  entry = 0;
+  nEventsTotal = nPassedTotal = 0;
+  nDuplicates = nSubsampleSkipped = 0;
+  nSubsampleEntries = nSubsampleSelected = 0;
+  dumpOffset = 0;
+  filename.clear();
+  dup_run.clear();
+  dup_ls.clear();
+  dup_evt.clear();
+}
+
+void LooperCheckpoint::Configure(const string& fname, unsigned int everyNEvents, float everyNMinutes) {
+  fname_ = fname;
+  idsname_ = fname + ".ids";
+  everyNEvents_ = everyNEvents;
+  everyNMinutes_ = everyNMinutes;
+}
+
+void LooperCheckpoint::Start(unsigned int nEventsTotal) {
+  lastEvents_ = nEventsTotal;
+  timer_.Start(true);
+}
+
+bool LooperCheckpoint::IsDue(unsigned int nEventsTotal) {
+  if (!IsEnabled()) return false;
+  if (everyNEvents_ > 0 && nEventsTotal - lastEvents_ >= everyNEvents_) return true;
+  // Only look at the clock once in a while, it's not free
+  if (everyNMinutes_ > 0 && (nEventsTotal & 0x3ff) == 0) {
+    double elapsed = timer_.RealTime();
+    timer_.Continue();
+    if (elapsed > everyNMinutes_ * 60) return true;
+  }
+  return false;
+}
+
+void LooperCheckpoint::AppendEventIds(const LooperState& state) {
+  FILE* fout = fopen(idsname_.c_str(), (idsStarted_)? "ab" : "wb");
+  if (!fout) throw invalid_argument("[LooperCheckpoint::AppendEventIds] Cannot open " + idsname_ + "!");
+  idsStarted_ = true;
+  EventIdRecord rec;
+  for (size_t i = nIdsSaved_; i < state.dup_run.size(); ++i) {
+    rec.run = state.dup_run[i];
+    rec.ls = state.dup_ls[i];
+    rec.evt = state.dup_evt[i];
+    fwrite(&rec, sizeof(rec), 1, fout);
+  }
+  // The checkpoint refers to these ids, so they must be on disk before it
+  bool ok = (fflush(fout) == 0 && fsync(fileno(fout)) == 0);
+  ok = (fclose(fout) == 0) && ok;
+  if (!ok) throw runtime_error("[LooperCheckpoint::AppendEventIds] Cannot write to " + idsname_ + "!");
+  nIdsSaved_ = state.dup_run.size();
+}
+
+void LooperCheckpoint::ReadEventIds(LooperState& state, long long nids) {
+  FILE* fin = fopen(idsname_.c_str(), "rb");
+  if (!fin && nids > 0) throw invalid_argument("[LooperCheckpoint::ReadEventIds] Cannot open " + idsname_ + "!");
+  EventIdRecord rec;
+  for (long long i = 0; i < nids; ++i) {
+    if (fread(&rec, sizeof(rec), 1, fin) != 1) {
+      fclose(fin);
+      throw invalid_argument(Form("[LooperCheckpoint::ReadEventIds] %s has less than the %lld ids of the checkpoint!", idsname_.c_str(), nids));
+    }
+    state.dup_run.push_back(rec.run);
+    state.dup_ls.push_back(rec.ls);
+    state.dup_evt.push_back(rec.evt);
+  }
+  if (fin) fclose(fin);
+
+  // Drop the ids appended by a save that did not complete
+  if (nids > 0 && truncate(idsname_.c_str(), nids * sizeof(EventIdRecord)) != 0)
+    throw runtime_error("[LooperCheckpoint::ReadEventIds] Cannot truncate " + idsname_ + "!");
+  nIdsSaved_ = nids;
+  idsStarted_ = true;
+}
+
+void LooperCheckpoint::Save(const LooperState& state, const RegionList& regions) {
+  // Don't let the checkpoint file change the directory the looper is booking histograms in
+  TDirectory::TContext ctx;
+
+  AppendEventIds(state);
+
+  string tmpname = fname_ + ".tmp";
+  TFile file(tmpname.c_str(), "RECREATE");
+  if (file.IsZombie()) throw invalid_argument("[LooperCheckpoint::Save] Cannot create " + tmpname + "!");
+
+  writeHistMaps(&file, regions);
+
+  file.cd();
+  TParameter<Long64_t>("ifile", state.ifile).Write();
+  TParameter<Long64_t>("entry", state.entry).Write();
+  TParameter<Long64_t>("nEventsTotal", state.nEventsTotal).Write();
+  TParameter<Long64_t>("nPassedTotal", state.nPassedTotal).Write();
+  TParameter<Long64_t>("nDuplicates", state.nDuplicates).Write();
+  TParameter<Long64_t>("nSubsampleSkipped", state.nSubsampleSkipped).Write();
+  TParameter<Long64_t>("nSubsampleEntries", state.nSubsampleEntries).Write();
+  TParameter<Long64_t>("nSubsampleSelected", state.nSubsampleSelected).Write();
+  TParameter<Long64_t>("dumpOffset", state.dumpOffset).Write();
+  TParameter<Long64_t>("nEventIds", nIdsSaved_).Write();
+  TNamed("filename", state.filename.c_str()).Write();
+  file.Close();
+
+  if (rename(tmpname.c_str(), fname_.c_str()) != 0)
+    throw runtime_error("[LooperCheckpoint::Save] Cannot move " + tmpname + " to " + fname_ + "!");
+
+  cout << "[LooperCheckpoint::Save] >> Checkpoint at file " << state.ifile << ", entry " << state.entry << " after "
+       << state.nEventsTotal << " events written to " << fname_ << endl;
+
+  Start(state.nEventsTotal);
+}
+
+bool LooperCheckpoint::Load(LooperState& state, const RegionList& regions, TDirectory* bookdir) {
+  TDirectory::TContext ctx;
+
+  TFile file(fname_.c_str(), "READ");
+  if (file.IsZombie()) return false;
+
+  auto getParameter = [&](const char* name) -> Long64_t {
+    auto par = (TParameter<Long64_t>*) file.Get(name);
+    if (!par) throw invalid_argument(string("[LooperCheckpoint::Load] Cannot find ") + name + " in " + fname_ + "!");
+    return par->GetVal();
+  };
+
+  state.Reset();
+  state.ifile = getParameter("ifile");
+  state.entry = getParameter("entry");
+  state.nEventsTotal = getParameter("nEventsTotal");
+  state.nPassedTotal = getParameter("nPassedTotal");
+  state.nDuplicates = getParameter("nDuplicates");
+  state.nSubsampleSkipped = getParameter("nSubsampleSkipped");
+  state.nSubsampleEntries = getParameter("nSubsampleEntries");
+  state.nSubsampleSelected = getParameter("nSubsampleSelected");
+  state.dumpOffset = getParameter("dumpOffset");
+  TNamed* filename = (TNamed*) file.Get("filename");
+  if (filename) state.filename = filename->GetTitle();
+
+  ReadEventIds(state, getParameter("nEventIds"));
+
+  loadHistMaps(&file, regions, bookdir);
+
+  cout << "[LooperCheckpoint::Load] >> Resuming from file " << state.ifile << ", entry " << state.entry << " after "
+       << state.nEventsTotal << " events, with " << state.dup_run.size() << " event ids for the duplicate removal" << endl;
+  return true;
+}
+
+void LooperCheckpoint::Remove() const {
+  remove(fname_.c_str());
+  remove(idsname_.c_str());
+}
@@ -0,0 +1,100 @@
+#ifndef LOOPERCHECKPOINT_h
+#define LOOPERCHECKPOINT_h
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "TDirectory.h"
+#include "TStopwatch.h"
+
+#include "SR.h"
+
+// Helpers to save and restore the histograms of the regions, one directory per region.
+// The LOW/HI range hists are skipped as they are booked from the region definitions, and
+// so are the ratio hists and the entries that only link to a histogram booked under another name.
+void writeHistMaps(TDirectory* dir, const std::vector<SR>& srvec);
+// Add the histograms found in dir to the histMaps, new ones are booked into bookdir
+void loadHistMaps(TDirectory* dir, std::vector<SR>& srvec, TDirectory* bookdir);
+
+// Region vectors with the directory they are kept under, empty for the top level
+typedef std::vector<std::pair<std::string, std::vector<SR>*>> RegionList;
+void writeHistMaps(TDirectory* dir, const RegionList& regions);
+void loadHistMaps(TDirectory* dir, const RegionList& regions, TDirectory* bookdir);
+
+// Event loop position and counters of StopLooper::looper
+struct LooperState {
+  int ifile;                     // index of the file in the chain
+  long long entry;               // next entry to process in that file
+  unsigned int nEventsTotal;
+  unsigned int nPassedTotal;
+  int nDuplicates;
+  int nSubsampleSkipped;
+  long long nSubsampleEntries;
+  long long nSubsampleSelected;
+  long long dumpOffset;          // size of the event dump file at the checkpoint
+  std::string filename;          // to make sure the chain is the same when resuming
+
+  // Ids already seen by the duplicate removal, replayed into is_duplicate() on resume
+  std::vector<unsigned int> dup_run;
+  std::vector<unsigned int> dup_ls;
+  std::vector<unsigned long long> dup_evt;
+
+  LooperState() { Reset(); }
+  void Reset();
+};
+
+// Save and read back the ids of the duplicate removal as a "dedup" tree in dir, the ids are appended to the state
+void writeEventIds(TDirectory* dir, const LooperState& state);
+void readEventIds(TDirectory* dir, LooperState& state);
+
+// class: LooperCheckpoint
+// Periodic snapshot of the looper, to continue a preempted job with the --resume option.
+// The snapshot is written to a temporary file and renamed, so the checkpoint file on disk
+// is always complete, also if the job is killed while writing. The ids of the duplicate
+// removal grow with the events processed, so they go to a separate file, <checkpoint>.ids,
+// where each save only appends the ids seen since the previous one. The snapshot records
+// how many ids it covers, and the ids appended after it are dropped when resuming.
+
+class LooperCheckpoint {
+
+public:
+
+  LooperCheckpoint() : everyNEvents_(0), everyNMinutes_(0), lastEvents_(0), nIdsSaved_(0), idsStarted_(false) {}
+  ~LooperCheckpoint() {}
+
+  void Configure(const std::string& fname, unsigned int everyNEvents, float everyNMinutes);
+  bool IsEnabled() const { return !fname_.empty() && (everyNEvents_ > 0 || everyNMinutes_ > 0); }
+  const std::string& GetFileName() const { return fname_; }
+
+  // Start the clock of the time based checkpoints
+  void Start(unsigned int nEventsTotal);
+
+  // Whether a checkpoint is due, from the events processed and time spent since the last one
+  bool IsDue(unsigned int nEventsTotal);
+
+  void Save(const LooperState& state, const RegionList& regions);
+
+  // Returns false if there is no checkpoint file to resume from
+  bool Load(LooperState& state, const RegionList& regions, TDirectory* bookdir);
+
+  // Delete the checkpoint files once the job is complete
+  void Remove() const;
+
+private:
+
+  std::string fname_;
+  unsigned int everyNEvents_;
+  float everyNMinutes_;
+  unsigned int lastEvents_;
+  TStopwatch timer_;
+
+  void AppendEventIds(const LooperState& state);
+  void ReadEventIds(LooperState& state, long long nids);
+
+  std::string idsname_;
+  long long nIdsSaved_;  // ids in the ids file at the last checkpoint
+  bool idsStarted_;      // the ids file has been started by this job or loaded, else it is recreated
+};
+
+#endif
@@ -0,0 +1,87 @@
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "SampleContext.h"
+
+void SampleContext::Reset() {
+  model = k_notSignal;
+  is_fastsim = false;
+  is_inclusiveWJets = false;
+  use_moriond17filters = false;
+  has_HLT_bits = false;
+  HLT_branches = 0;
+
+  nbinsx_ = nbinsy_ = 0;
+  xmin_ = xmax_ = ymin_ = ymax_ = 0;
+  lumi_ = 0;
+  nevents_.clear();
+  weights_.clear();
+}
+
+void SampleContext::Setup(const TString& fname, const TString& dsname, const std::string& samplever) {
+  Reset();
+
+  is_fastsim = fname.Contains("SMS") || fname.Contains("Signal");
+  if (is_fastsim) {
+    if (dsname.Contains("T2tt")) model = k_T2tt;
+    else if (dsname.Contains("T2bW")) model = k_T2bW;
+    else if (dsname.Contains("T2bt")) model = k_T2bt;
+    else model = k_otherSignal;
+  }
+
+  // Only consider events with nupt < 200 for the inclusive WNJetsToLNu samples
+  is_inclusiveWJets = dsname.BeginsWith("/W") && dsname.Contains("JetsToLNu") && !dsname.Contains("NuPt-200");
+
+  use_moriond17filters = (samplever.find("v24") == 0);
+}
+
+void SampleContext::SetupSignalNormalization(const TH2* h_nEvents, float lumi) {
+  if (!h_nEvents) throw std::invalid_argument("[SampleContext::SetupSignalNormalization] No histNEvts found for the signal sample!");
+
+  const TAxis* xaxis = h_nEvents->GetXaxis();
+  const TAxis* yaxis = h_nEvents->GetYaxis();
+  if (xaxis->IsVariableBinSize() || yaxis->IsVariableBinSize())
+    throw std::invalid_argument("[SampleContext::SetupSignalNormalization] Expect fixed bin width for histNEvts!");
+
+  nbinsx_ = xaxis->GetNbins();
+  nbinsy_ = yaxis->GetNbins();
+  xmin_ = xaxis->GetXmin();
+  xmax_ = xaxis->GetXmax();
+  ymin_ = yaxis->GetXmin();
+  ymax_ = yaxis->GetXmax();
+  lumi_ = lumi;
+
+  // Keep the global bin numbering of the histogram, so that the cell index is the same as from FindBin
+  int ncells = (nbinsx_+2) * (nbinsy_+2);
+  nevents_.assign(ncells, 0);
+  weights_.assign(ncells, std::numeric_limits<double>::quiet_NaN());
+  for (int iy = 0; iy <= nbinsy_+1; ++iy) {
+    for (int ix = 0; ix <= nbinsx_+1; ++ix) {
+      int icell = ix + (nbinsx_+2) * iy;
+      nevents_[icell] = h_nEvents->GetBinContent(ix, iy);
+    }
+  }
+}
+
+int SampleContext::FindCell(float mstop, float mlsp) const {
+  // Same as TAxis::FindFixBin, without touching the histogram
+  int ix = (mstop < xmin_)? 0 : (mstop >= xmax_)? nbinsx_+1 : 1 + int(nbinsx_ * (mstop - xmin_) / (xmax_ - xmin_));
+  int iy = (mlsp  < ymin_)? 0 : (mlsp  >= ymax_)? nbinsy_+1 : 1 + int(nbinsy_ * (mlsp  - ymin_) / (ymax_ - ymin_));
+  return ix + (nbinsx_+2) * iy;
+}
+
+int SampleContext::GetNEventsForMassPoint(float mstop, float mlsp) const {
+  if (nevents_.empty()) return 0;
+  return nevents_[FindCell(mstop, mlsp)];
+}
+
+double SampleContext::GetSignalWeight(float mstop, float mlsp, float xsec) {
+  if (nevents_.empty())
+    throw std::logic_error("[SampleContext::GetSignalWeight] The signal normalization table is not set up!");
+
+  int icell = FindCell(mstop, mlsp);
+  if (std::isnan(weights_[icell]))
+    weights_[icell] = lumi_ * xsec * 1000 / nevents_[icell];
+  return weights_[icell];
+}
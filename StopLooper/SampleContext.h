@@ -0,0 +1,58 @@
+#ifndef SAMPLECONTEXT_h
+#define SAMPLECONTEXT_h
+
+#include <string>
+#include <vector>
+
+#include "TString.h"
+#include "TH2.h"
+
+// class: SampleContext
+// Sample dependent constants, resolved once when a file is opened so that the event loop
+// only needs to check enums, flags and array lookups instead of string matching.
+
+class SampleContext {
+
+public:
+
+  enum SignalModel { k_notSignal, k_T2tt, k_T2bW, k_T2bt, k_otherSignal };
+
+  SampleContext() { Reset(); }
+  ~SampleContext() {}
+
+  void Reset();
+
+  // Fill the flags from the file name, the dataset name and the stopbaby version
+  void Setup(const TString& fname, const TString& dsname, const std::string& samplever);
+
+  // Build the dense (mStop, mLSP) normalization table from the histNEvts counter of the baby
+  void SetupSignalNormalization(const TH2* h_nEvents, float lumi);
+
+  // Returns lumi * xsec * 1000 / nEvents for the mass point, the xsec of each point is only read once
+  double GetSignalWeight(float mstop, float mlsp, float xsec);
+
+  int GetNEventsForMassPoint(float mstop, float mlsp) const;
+
+  SignalModel model;
+  bool is_fastsim;
+  bool is_inclusiveWJets;     // inclusive W+jets samples that need the nupt < 200 cut
+  bool use_moriond17filters;  // v24 babies, filters used in the Moriond17 study
+  bool has_HLT_bits;          // the baby has the packed HLT_bits branch, otherwise read the individual HLT branches
+  unsigned int HLT_branches;  // trigword raw bits of the individual HLT branches present in the baby
+
+private:
+
+  int FindCell(float mstop, float mlsp) const;
+
+  // Binning of the mass table, same as histNEvts including the under/overflow bins
+  int nbinsx_;
+  int nbinsy_;
+  double xmin_, xmax_;
+  double ymin_, ymax_;
+  float lumi_;
+
+  std::vector<int> nevents_;
+  std::vector<double> weights_;  // cached lumi * xsec * 1000 / nEvents, NaN if not yet computed
+};
+
+#endif
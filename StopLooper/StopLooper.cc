@@ -6,9 +6,12 @@
 #include <cmath>
 #include <sstream>
 #include <stdexcept>
+#include <cstdio>
 
 // ROOT
 #include "TDirectory.h"
+#include "TSystem.h"
+#include "TChainElement.h"
 #include "TTreeCache.h"
 #include "Math/VectorUtil.h"
 #include "TVector2.h"
@@ -27,12 +30,16 @@
 // Stop baby class
 #include "../StopCORE/StopTree.h"
 #include "../StopCORE/TopTagger/ResolvedTopMVA.h"
+#include "../StopCORE/SharedResources.h"
+#include "../StopCORE/TriggerWord.h"
+#include "../StopCORE/KinematicsCache.h"
 // #include "../StopCORE/stop_variables/metratio.cc"
 
 #include "SR.h"
 #include "StopRegions.h"
 #include "StopLooper.h"
 #include "Utilities.h"
+#include "FileManifest.h"
 
 using namespace std;
 using namespace stop1l;
@@ -60,7 +67,7 @@ const bool runResTopMVA = false;
 const bool runYieldsOnly = false;
 // only running selected signal points to speed up
 const bool runFullSignalScan = false;
-// debug symbol, for printing exact event kinematics that passes
+// debug symbol, for printing exact event kinematics that passes, same as --dumpEvents=passEventList.txt --dumpRegions=srbase
 const bool printPassedEvents = false;
 
 // some global helper variables to be used in member functions
@@ -73,23 +80,50 @@ const float kSMSMassStep = 25;
 const vector<float> mStopBins = []() { vector<float> bins; for (float i = 150; i < 1350; i += kSMSMassStep) bins.push_back(i); return bins; } ();
 const vector<float> mLSPBins  = []() { vector<float> bins; for (float i =   0; i <  750; i += kSMSMassStep) bins.push_back(i); return bins; } ();
 
-std::ofstream ofile;
+// Scalars read for every entry by the event filtering and the region variables, these get read a
+// basket at a time instead of through one TBranch::GetEntry per entry
+const vector<string> kBulkReadBranches = {
+  "run", "ls", "evt", "nvtxs", "year", "is_data",
+  "filt_met", "filt_goodvtx", "filt_globalsupertighthalo2016", "filt_hbhenoise", "filt_hbheisonoise", "filt_ecaltp",
+  "filt_ecalbadcalib", "filt_eebadsc", "filt_badMuonFilter", "filt_badChargedCandidateFilter", "filt_jetWithBadMuon",
+  "filt_pfovercalomet", "filt_fastsimjets", "filt_duplicatemuons", "filt_badmuons", "filt_nobadmuons",
+  "pfmet", "pfmet_phi", "mt_met_lep", "ngoodjets", "ngoodbtags", "nvetoleps", "ngoodleps", "mindphi_met_j1_j2",
+  "scale1fb", "mass_stop", "mass_lsp",
+};
+
+void StopLooper::SetRegionSchemes(vector<string> schemes) {
+  // The extra schemes are written and filled by their name, a repeated one would shadow the first
+  set<string> names;
+  for (const string& name : schemes) {
+    if (!names.insert(name).second)
+      throw invalid_argument("[StopLooper::SetRegionSchemes] Region scheme " + name + " given twice!");
+  }
+  schemeNames_ = schemes;
+}
 
 void StopLooper::SetSignalRegions() {
 
-  // SRVec = getStopSignalRegionsTopological();
-  // CR0bVec = getStopControlRegionsNoBTagsTopological();
-  // CR2lVec = getStopControlRegionsDileptonTopological();
+  // The region schemes are defined in StopRegions.cc, the default is the NewMETBinning
+  string primaryScheme = (schemeNames_.empty())? "NewMETBinning" : schemeNames_[0];
+  getStopRegionScheme(primaryScheme, SRVec, CR0bVec, CR2lVec);
 
-  SRVec = getStopSignalRegionsNewMETBinning();
-  CR0bVec = getStopControlRegionsNoBTagsNewMETBinning();
-  CR2lVec = getStopControlRegionsDileptonNewMETBinning();
+  CRemuVec = getStopCrosscheckRegionsEMu();
 
-  // SRVec = getStopInclusiveRegionsTopological();
-  // CR0bVec = getStopInclusiveControlRegionsNoBTags();
-  // CR2lVec = getStopInclusiveControlRegionsDilepton();
+  // Get all the schemes in place before booking, the memory book keeping keeps pointers to the histMaps
+  extraSchemes_.clear();
+  if (schemeNames_.size() > 1) extraSchemes_.resize(schemeNames_.size() - 1);
+  for (size_t i = 0; i < extraSchemes_.size(); ++i) {
+    RegionScheme& scheme = extraSchemes_[i];
+    scheme.name = schemeNames_[i+1];
+    getStopRegionScheme(scheme.name, scheme.SRVec, scheme.CR0bVec, scheme.CR2lVec);
+  }
 
-  CRemuVec = getStopCrosscheckRegionsEMu();
+  // Slices of the regions cutting on a scanned variable, need to be in place before booking too
+  if (scan_.IsActive()) {
+    scan_.AddRegions(SRVec, false);
+    scan_.AddRegions(CR0bVec, false);
+    scan_.AddRegions(CR2lVec, true);
+  }
 
   if (verbose) {
     cout << "SRVec.size = " << SRVec.size() << ", including the following:" << endl;
@@ -98,12 +132,13 @@ void StopLooper::SetSignalRegions() {
     }
   }
 
-  auto createRangesHists = [&] (vector<SR>& srvec) {
+  auto createRangesHists = [&] (vector<SR>& srvec, string prefix) {
     for (auto& sr : srvec) {
+      histMemBudget.RegisterRegion(&sr.histMap, prefix + sr.GetName());
       vector<string> vars = sr.GetListOfVariables();
-      TDirectory * dir = (TDirectory*) outfile_->Get((sr.GetName() + "/ranges").c_str());
-      if (dir == 0) dir = outfile_->mkdir((sr.GetName() + "/ranges").c_str());
-      dir->cd("ranges");
+      string rangedir = prefix + sr.GetName() + "/ranges";
+      if (outfile_->GetDirectory(rangedir.c_str()) == 0) outfile_->mkdir(rangedir.c_str());
+      outfile_->cd(rangedir.c_str());
       for (auto& var : vars) {
         plot1d("h_"+var+"_"+"LOW",  1, sr.GetLowerBound(var), sr.histMap, "", 1, 0, 2);
         plot1d("h_"+var+"_"+"HI",   1, sr.GetUpperBound(var), sr.histMap, "", 1, 0, 2);
@@ -114,17 +149,40 @@ void StopLooper::SetSignalRegions() {
     }
   };
 
-  createRangesHists(SRVec);
-  createRangesHists(CR0bVec);
-  createRangesHists(CR2lVec);
-  createRangesHists(CRemuVec);
+  createRangesHists(SRVec, "");
+  createRangesHists(CR0bVec, "");
+  createRangesHists(CR2lVec, "");
+  createRangesHists(CRemuVec, "");
+  for (auto& scheme : extraSchemes_) {
+    createRangesHists(scheme.SRVec, scheme.name + "/");
+    createRangesHists(scheme.CR0bVec, scheme.name + "/");
+    createRangesHists(scheme.CR2lVec, scheme.name + "/");
+  }
+  for (size_t islice = 0; islice < scan_.GetNSlices(); ++islice)
+    createRangesHists(scan_.GetSlice(islice), Form("scanslices/s%zu/", islice));
 
   testVec.emplace_back("testGeneral");
   testVec.emplace_back("testTopTagging");
   testVec.emplace_back("testCutflow");
+  for (auto& sr : testVec)
+    histMemBudget.RegisterRegion(&sr.histMap, sr.GetName());
+
+  histMemBudget.Report(cout, "booked in SetSignalRegions");
 }
 
 
+RegionList StopLooper::allRegions() {
+  RegionList regions = {{"", &testVec}, {"", &SRVec}, {"", &CR0bVec}, {"", &CR2lVec}, {"", &CRemuVec}};
+  for (auto& scheme : extraSchemes_) {
+    regions.emplace_back(scheme.name, &scheme.SRVec);
+    regions.emplace_back(scheme.name, &scheme.CR0bVec);
+    regions.emplace_back(scheme.name, &scheme.CR2lVec);
+  }
+  for (size_t islice = 0; islice < scan_.GetNSlices(); ++islice)
+    regions.emplace_back(Form("scanslices/s%zu", islice), &scan_.GetSlice(islice));
+  return regions;
+}
+
 void StopLooper::GenerateAllSRptrSets() {
   allSRptrSets.clear();
 
@@ -137,47 +195,63 @@ void StopLooper::GenerateAllSRptrSets() {
   // allSRptrSets = generateSRptrSet(all_SRptrs);
 }
 
+// The individual HLT branches, for the babies made before the HLT_bits branch was added
+struct RawTrigger {
+  trigword::TriggerBit bit;
+  const char* branch;
+  const int& (*decision)();
+};
+
+static const RawTrigger kRawTriggers[] = {
+  {trigword::k_MET,                "HLT_MET",                HLT_MET},
+  {trigword::k_MET_MHT,            "HLT_MET_MHT",            HLT_MET_MHT},
+  {trigword::k_MET110_MHT110,      "HLT_MET110_MHT110",      HLT_MET110_MHT110},
+  {trigword::k_MET120_MHT120,      "HLT_MET120_MHT120",      HLT_MET120_MHT120},
+  {trigword::k_SingleEl,           "HLT_SingleEl",           HLT_SingleEl},
+  {trigword::k_SingleMu,           "HLT_SingleMu",           HLT_SingleMu},
+  {trigword::k_DiEl,               "HLT_DiEl",               HLT_DiEl},
+  {trigword::k_DiMu,               "HLT_DiMu",               HLT_DiMu},
+  {trigword::k_MuE,                "HLT_MuE",                HLT_MuE},
+  {trigword::k_PFHT_unprescaled,   "HLT_PFHT_unprescaled",   HLT_PFHT_unprescaled},
+  {trigword::k_PFHT_prescaled,     "HLT_PFHT_prescaled",     HLT_PFHT_prescaled},
+  {trigword::k_AK8Jet_unprescaled, "HLT_AK8Jet_unprescaled", HLT_AK8Jet_unprescaled},
+  {trigword::k_AK8Jet_prescaled,   "HLT_AK8Jet_prescaled",   HLT_AK8Jet_prescaled},
+  {trigword::k_CaloJet500_NoJetID, "HLT_CaloJet500_NoJetID", HLT_CaloJet500_NoJetID},
+};
+
+// The raw trigger bits whose HLT branch is in the tree, the missing ones are left unset
+static unsigned int findRawTriggerBranches(TTree* tree) {
+  unsigned int mask = 0;
+  for (const RawTrigger& trig : kRawTriggers)
+    if (tree->GetBranch(trig.branch)) trigword::setBit(mask, trig.bit, true);
+  return mask;
+}
+
+// Pack the individual HLT branches present in the baby
+static unsigned int packRawTriggerBits(unsigned int branchMask) {
+  unsigned int word = 0;
+  for (const RawTrigger& trig : kRawTriggers)
+    if (trigword::testBit(branchMask, trig.bit)) trigword::setBit(word, trig.bit, trig.decision());
+  return word;
+}
+
 bool StopLooper::PassingHLTriggers(const int type) {
-  if (type == 1) {
-    switch (year_) {
-      case 2016:
-        return ( (HLT_MET110_MHT110() || HLT_MET120_MHT120() || HLT_MET()) ||
-                 (abs(lep1_pdgid()) == 11 && HLT_SingleEl()) || (abs(lep1_pdgid()) == 13 && HLT_SingleMu()) );
-      case 2017:
-      case 2018:
-      default:
-        return ( HLT_MET_MHT() || (abs(lep1_pdgid()) == 11 && HLT_SingleEl()) || (abs(lep1_pdgid()) == 13 && HLT_SingleMu()) );
-    }
-  } else if (type == 2) {
-    switch (year_) {
-      case 2016:
-        return ( (HLT_MET() || HLT_MET110_MHT110() || HLT_MET120_MHT120()) || (HLT_SingleEl() && (abs(lep1_pdgid())==11 || abs(lep2_pdgid())==11)) ||
-                 (HLT_SingleMu() && (abs(lep1_pdgid())==13 || abs(lep2_pdgid())==13)) );
-      case 2017:
-      case 2018:
-      default:
-        return ( HLT_MET_MHT() || (HLT_SingleEl() && (abs(lep1_pdgid())==11 || abs(lep2_pdgid())==11)) ||
-                  (HLT_SingleMu() && (abs(lep1_pdgid())==13 || abs(lep2_pdgid())==13)) );
-    }
-  } else if (type == 3) {
-    int dilepid = abs(lep1_pdgid()*lep2_pdgid());
-    switch (year_) {
-      case 2016:
-        return ( (HLT_MET() || HLT_MET110_MHT110() || HLT_MET120_MHT120()) ||
-                 (dilepid == 121 && HLT_DiEl()) || (dilepid == 169 && HLT_DiMu()) || (dilepid == 143 && HLT_MuE()) ||
-                 (HLT_SingleEl() && (abs(lep1_pdgid())==11 || abs(lep2_pdgid())==11)) ||
-                 (HLT_SingleMu() && (abs(lep1_pdgid())==13 || abs(lep2_pdgid())==13)) );
-      case 2017:
-      case 2018:
-      default:
-        return ( HLT_MET_MHT() || (dilepid == 121 && HLT_DiEl()) || (dilepid == 169 && HLT_DiMu()) || (dilepid == 143 && HLT_MuE()) ||
-                 (HLT_SingleEl() && (abs(lep1_pdgid())==11 || abs(lep2_pdgid())==11)) ||
-                 (HLT_SingleMu() && (abs(lep1_pdgid())==13 || abs(lep2_pdgid())==13)) );
-    }
+  // The decisions are packed per event in trigword_, see TriggerWord.h for the logic of each type
+  switch (type) {
+    case 1: return trigword::testBit(trigword_, trigword::k_passType1);
+    case 2: return trigword::testBit(trigword_, trigword::k_passType2);
+    case 3: return trigword::testBit(trigword_, trigword::k_passType3);
   }
   return false;
 }
 
+// An output of the incremental mode is complete once it has been closed with its manifest
+static bool isCompleteIncrementalOutput(const string& fname) {
+  TDirectory::TContext ctx;
+  TFile file(fname.c_str(), "READ");
+  return (!file.IsZombie() && !file.TestBit(TFile::kRecovered) && file.Get("incremental/manifest"));
+}
+
 void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int jes_type) {
 
   // Benchmark
@@ -185,13 +259,47 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
   bmark->Start("benchmark");
 
   TString output_name = Form("%s/%s.root",output_dir.c_str(),samplestr.c_str());
+
+  // In the incremental mode the previous output is moved aside before being recreated, its histograms are
+  // added back after booking, and only the files missing from its manifest are processed
+  string prev_output = string(output_name.Data()) + ".prev";
+  bool use_prev_output = false;
+  if (incremental_) {
+    bool has_output = !gSystem->AccessPathName(output_name);
+    bool has_prev = !gSystem->AccessPathName(prev_output.c_str());
+    // If an earlier increment was stopped, keep whichever of the two outputs is complete
+    if (has_output && has_prev) {
+      if (isCompleteIncrementalOutput(output_name.Data())) remove(prev_output.c_str());
+      else remove(output_name.Data());
+    }
+    if (!gSystem->AccessPathName(output_name))
+      rename(output_name.Data(), prev_output.c_str());
+    use_prev_output = isCompleteIncrementalOutput(prev_output);
+    if (!use_prev_output)
+      cout << "[StopLooper::looper] No previous incremental output found at " << output_name << ", processing all files" << endl;
+  }
+
   cout << "[StopLooper::looper] creating output file: " << output_name << endl;  outfile_ = new TFile(output_name.Data(),"RECREATE") ;
   cout << "Complied with C++ standard: " << __cplusplus << endl;
 
-  if (printPassedEvents) ofile.open("passEventList.txt");
+  // Histogram booking mode and memory book keeping
+  histMemBudget.Reset();
+  histMemBudget.SetCompactMode(compactHists_);
+  histMemBudget.SetCeilingMB(histMemCeilingMB_);
+
+  // Stages for the telemetry record, no-op unless a telemetry file is given
+  if (!telemetryfile_.empty()) telemetry_.Open(telemetryfile_, samplestr);
+  const int kStageSetup = telemetry_.AddStage("setup");
+  const int kStageSelect = telemetry_.AddStage("select");
+  const int kStageAnalysis = telemetry_.AddStage("analysis");
+  const int kStageWrite = telemetry_.AddStage("write");
+  telemetry_.SwitchStage(kStageSetup);
+
+  // Input files, SF tools and MVA readers are shared between the loopers of the process
+  SharedResources& resources = SharedResources::instance();
 
   if (runResTopMVA)
-    resTopMVA = new ResolvedTopMVA("../StopCORE/TopTagger/resTop_xGBoost_v2.weights.xml", "BDT");
+    resTopMVA = resources.GetResTopMVA("../StopCORE/TopTagger/resTop_xGBoost_v2.weights.xml", "BDT");
 
   outfile_ = new TFile(output_name.Data(), "RECREATE") ;
 
@@ -208,11 +316,10 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
 
   // Setup pileup re-weighting for comparing data of different years
   if (doNvtxReweight) {
-    TFile f_purw("../AnalyzeScripts/pu_reweighting_hists/nvtx_reweighting_alldata.root");
     TString scaletype = "18to17";
     if (datayear == 2018) scaletype = "18to17";
     else if (datayear == 2016) scaletype = "16to17";
-    TH1F* h_nvtxscale = (TH1F*) f_purw.Get("h_nvtxscale_"+scaletype);
+    TH1F* h_nvtxscale = resources.Get<TH1F>("../AnalyzeScripts/pu_reweighting_hists/nvtx_reweighting_alldata.root", ("h_nvtxscale_"+scaletype).Data());
     if (!h_nvtxscale) throw invalid_argument("No nvtx reweighting hist found for " + scaletype);
     if (verbose) cout << "Doing nvtx reweighting! Scaling " << scaletype << ". The scale factors are:" << endl;
     for (int i = 1; i < 100; ++i) {
@@ -221,41 +328,122 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
     }
   }
 
-  if (applyGoodRunList) {
-    cout << "Loading json file: " << json_file << endl;
-    set_goodrun_file(json_file);
-  }
+  if (applyGoodRunList) resources.LoadGoodRunList(json_file);
 
   TFile dummy( (output_dir+"/dummy.root").c_str(), "RECREATE" );
   SetSignalRegions();
   // GenerateAllSRptrSets();
 
-  int nDuplicates = 0;
+  // Periodic checkpoints of the histograms and the loop position, and resume from the last one if asked
+  LooperState ckstate;
+  checkpoint_.Configure(Form("%s/%s.ckpt.root", output_dir.c_str(), samplestr.c_str()), checkpointEvents_, checkpointMinutes_);
+  bool resumed = false;
+  if (resume_) {
+    resumed = checkpoint_.Load(ckstate, allRegions(), &dummy);
+    if (!resumed) cout << "[StopLooper::looper] No checkpoint found at " << checkpoint_.GetFileName() << ", starting from the beginning" << endl;
+  }
+
+  // Histograms and duplicate removal ids of the previous increment, already part of the checkpoint if resuming
+  FileManifest manifest;
+  if (use_prev_output) {
+    TDirectory::TContext ctx;
+    TFile prevfile(prev_output.c_str(), "READ");
+    TDirectory* incdir = prevfile.GetDirectory("incremental");
+    manifest.Read(incdir);
+    if (!resumed) {
+      loadHistMaps(&prevfile, allRegions(), &dummy);
+      readEventIds(incdir, ckstate);
+    }
+    cout << "[StopLooper::looper] Adding to the previous output with " << manifest.Size() << " files already processed" << endl;
+  }
+
+  for (size_t i = 0; i < ckstate.dup_run.size(); ++i) {
+    duplicate_removal::DorkyEventIdentifier id(ckstate.dup_run[i], ckstate.dup_evt[i], ckstate.dup_ls[i]);
+    is_duplicate(id);
+  }
+  subsampler_.SetCounts(ckstate.nSubsampleEntries, ckstate.nSubsampleSelected);
+
+  if (printPassedEvents && dumpfile_.empty())
+    SetEventDump("passEventList.txt", {"srbase"}, {"met", "njet", "jet2pt"});
+  if (!dumpfile_.empty())
+    dumper_.Open(dumpfile_, EventDumper::FormatFromName(dumpfile_), dumpregions_, dumpcolumns_, (resumed)? ckstate.dumpOffset : 0);
+
+  int nDuplicates = ckstate.nDuplicates;
+  int nSubsampleSkipped = ckstate.nSubsampleSkipped;
   int nEvents = chain->GetEntries();
   unsigned int nEventsChain = nEvents;
   cout << "[StopLooper::looper] running on " << nEventsChain << " events" << endl;
-  unsigned int nEventsTotal = 0;
-  unsigned int nPassedTotal = 0;
+  unsigned int nEventsTotal = ckstate.nEventsTotal;
+  unsigned int nPassedTotal = ckstate.nPassedTotal;
+  checkpoint_.Start(nEventsTotal);
+
+  babyAnalyzer.SetBulkRead(kBulkReadBranches);
 
   TObjArray *listOfFiles = chain->GetListOfFiles();
   TIter fileIter(listOfFiles);
   TFile *currentFile = 0;
+  int ifile = -1;
   while ( (currentFile = (TFile*)fileIter.Next()) ) {
 
     TString fname = currentFile->GetTitle();
+    ++ifile;
+    if (incremental_) {
+      // Skip the files already folded into the output by an earlier increment
+      FileManifest::FileInfo finfo = FileManifest::Stat(fname.Data());
+      finfo.entries = ((TChainElement*) currentFile)->GetEntries();
+      if (manifest.Contains(fname.Data(), finfo)) {
+        nEventsChain -= finfo.entries;
+        continue;
+      }
+      manifest.Add(fname.Data(), finfo);  // only saved with the output
+    }
+    if (ifile < ckstate.ifile) continue;  // already processed before the checkpoint
+    if (resumed && ifile == ckstate.ifile && ckstate.filename != fname.Data())
+      throw invalid_argument("[StopLooper::looper] The checkpoint was made on " + ckstate.filename + ", but the chain has " + fname.Data() + " in its place!");
+
+    telemetry_.SwitchStage(kStageSetup);
+    telemetry_.SetCurrentFile(fname.Data());
     TFile file( fname, "READ" );
     TTree *tree = (TTree*) file.Get("t");
     TTreeCache::SetLearnEntries(10);
     tree->SetCacheSize(128*1024*1024);
+    // Babies made with splitJES have the JES variations in a friend tree, only attached when they are used
+    if (doSystVariations && file.Get("t_jes")) tree->AddFriend("t_jes");
+    // Patch files with new variables, checked against the baby before its branch addresses get set
+    if (friends_.IsActive()) friends_.Attach(tree, fname.Data());
     babyAnalyzer.Init(tree);
 
-    // Use the first event to get dsname
-    tree->LoadTree(0);
-    babyAnalyzer.GetEntry(0);
+    // Read the columns of the flat skim of the baby instead of its tree, when there is one
+    flatSkim_.reset();
+    if (!flatSkimDir_.empty()) {
+      TString flatdir = flatSkimDir_ + "/" + gSystem->BaseName(fname);
+      if (flatdir.EndsWith(".root")) flatdir.Resize(flatdir.Length() - 5);
+      if (!gSystem->AccessPathName(flatdir + "/columns.txt")) {
+        flatSkim_.reset(new FlatSkim(flatdir.Data()));
+        if ((Long64_t) flatSkim_->GetEntries() != tree->GetEntries())
+          throw invalid_argument(Form("[StopLooper::looper] The flat skim %s has %llu entries, while the baby has %lld!",
+                                      flatdir.Data(), (unsigned long long) flatSkim_->GetEntries(), tree->GetEntries()));
+        babyAnalyzer.SetFlatSkim(flatSkim_.get());
+        cout << "[looper] >> Reading " << flatSkim_->GetColumnNames().size() << " columns from the flat skim " << flatdir << endl;
+      }
+    }
 
-    // Setup configs for sample dependent processes
-    year_ = (doTopTagging)? year() : 2016;
-    TString dsname = dataset();
+    // Take the year and dataset from the catalog of the babies, or from the first event when not in it
+    const BabyCatalog::FileEntry* catalogEntry = catalog_.Find(fname.Data());
+    // The chain was given the entries of the catalog, which are wrong for a baby remade after the catalog was written
+    if (catalogEntry && catalogEntry->entries != tree->GetEntries())
+      throw invalid_argument(Form("[StopLooper::looper] The catalog gives %lld entries for %s, while it has %lld! Rerun the merge step to update the catalog.",
+                                  catalogEntry->entries, fname.Data(), tree->GetEntries()));
+    TString dsname;
+    if (catalogEntry && catalogEntry->year > 0) {
+      year_ = (doTopTagging)? catalogEntry->year : 2016;
+      dsname = catalogEntry->dataset;
+    } else {
+      tree->LoadTree(0);
+      babyAnalyzer.GetEntry(0);
+      year_ = (doTopTagging)? year() : 2016;
+      dsname = dataset();
+    }
 
     // Find the stopbaby versions automatically from file path
     if (int i = fname.Index("_v"); i >= 0) samplever = fname(i+1, 3); // ignore subversions
@@ -271,15 +459,10 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
     cout << "[looper] >> Running on sample: " << dsname << endl;
     cout << "[looper] >> Sample detected with year = " << year_ << " and version = " << samplever << endl;
 
-    is_fastsim_ = fname.Contains("SMS") || fname.Contains("Signal");
-
-    // Get event weight histogram from baby
-    TH3D* h_sig_counter = nullptr;
-    TH2D* h_sig_counter_nEvents = nullptr;
-    if (is_fastsim_) {
-      h_sig_counter = (TH3D*) file.Get("h_counterSMS");
-      h_sig_counter_nEvents = (TH2D*) file.Get("histNEvts");
-    }
+    sampleCtx_.Setup(fname, dsname, samplever);
+    sampleCtx_.has_HLT_bits = (tree->GetBranch("HLT_bits") != nullptr);
+    if (!sampleCtx_.has_HLT_bits) sampleCtx_.HLT_branches = findRawTriggerBranches(tree);
+    is_fastsim_ = sampleCtx_.is_fastsim;
 
     // Setup the event weight calculator
     evtWgt.verbose = true;
@@ -304,16 +487,44 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
     else if (year_ == 2017) kLumi = 41.96;
     else if (year_ == 2018) kLumi = 70;
 
+    // Get the number of events per mass point from the baby for the signal normalization
+    if (is_fastsim_)
+      sampleCtx_.SetupSignalNormalization((TH2*) file.Get("histNEvts"), kLumi);
+
     dummy.cd();
     // Loop over Events in current file
     if (nEventsTotal >= nEventsChain) continue;
     unsigned int nEventsTree = tree->GetEntriesFast();
-    for (unsigned int event = 0; event < nEventsTree; ++event) {
+    subsampler_.ResetCluster();
+    unsigned int firstEvent = (ifile == ckstate.ifile)? ckstate.entry : 0;
+    for (unsigned int event = firstEvent; event < nEventsTree; ++event) {
       // Read Tree
       if (nEventsTotal >= nEventsChain) continue;
+      if (checkpoint_.IsDue(nEventsTotal)) {
+        ckstate.ifile = ifile;
+        ckstate.entry = event;
+        ckstate.filename = fname.Data();
+        ckstate.nEventsTotal = nEventsTotal;
+        ckstate.nPassedTotal = nPassedTotal;
+        ckstate.nDuplicates = nDuplicates;
+        ckstate.nSubsampleSkipped = nSubsampleSkipped;
+        ckstate.nSubsampleEntries = subsampler_.GetNEntries();
+        ckstate.nSubsampleSelected = subsampler_.GetNSelected();
+        ckstate.dumpOffset = dumper_.Flush();
+        checkpoint_.Save(ckstate, allRegions());
+      }
+      // Rejected entries are decided from the ids only, none of the other branches get loaded
+      if (subsampler_.IsActive() && !subsampler_.Accept(tree, event)) {
+        ++nEventsTotal;
+        ++nSubsampleSkipped;
+        continue;
+      }
       tree->LoadTree(event);
       babyAnalyzer.GetEntry(event);
+      friends_.GetEntry(event);
       ++nEventsTotal;
+      telemetry_.SwitchStage(kStageSelect);
+      telemetry_.Update(nEventsTotal);
 
       if ( is_data() ) {
         if ( applyGoodRunList && !goodrun(run(), ls()) ) continue;
@@ -322,6 +533,12 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
           ++nDuplicates;
           continue;
         }
+        if (checkpoint_.IsEnabled() || incremental_) {
+          // Keep a copy of the ids for the checkpoint and the next increment, the duplicate removal doesn't expose its list
+          ckstate.dup_run.push_back(run());
+          ckstate.dup_ls.push_back(ls());
+          ckstate.dup_evt.push_back(evt());
+        }
       }
 
       // fillEfficiencyHistos(testVec[0], "filters");
@@ -343,7 +560,7 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
             if ( !filt_badChargedCandidateFilter() ) continue;
             if ( is_data() && !filt_eebadsc() ) continue;
         }
-      } else if (samplever.find("v24") == 0) {
+      } else if (sampleCtx_.use_moriond17filters) {
         // Filters used in Moriond17 study, keep for sync check
         if ( !filt_met() ) continue;
         if ( !filt_goodvtx() ) continue;
@@ -376,20 +593,20 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
         // auto checkMassPt = [&](double mstop, double mlsp) { return (mass_stop() == mstop) && (mass_lsp() == mlsp); };
         // if (!checkMassPt(800,400)  && !checkMassPt(1200,50)  && !checkMassPt(400,100) &&
         //     !checkMassPt(1100,300) && !checkMassPt(1100,500) && !checkMassPt(900,600)) continue;
-        if (dsname.Contains("T2tt")) {
+        if (sampleCtx_.model == SampleContext::k_T2tt) {
           float massdiff = mass_stop() - mass_lsp();
           // if (mass_lsp() < 400 && mass_stop() < 1000) continue;
           // if (massdiff < 200 || massdiff > 400) continue;
           // if (massdiff < 200 || massdiff > 400 || mass_lsp() < 400) continue;
           if (massdiff < 600 || mass_stop() < 1000) continue;
           plot2d("h2d_T2tt_masspts", mass_stop(), mass_lsp(), 1, SRVec.at(0).histMap, ";M_{stop} [GeV]; M_{lsp} [GeV]", 100, 300, 1300, 80, 0, 800);
-        } else if (dsname.Contains("T2bW")) {
+        } else if (sampleCtx_.model == SampleContext::k_T2bW) {
           float massdiff = mass_stop() - mass_lsp();
           if (mass_lsp() < 300 && mass_stop() < 800) continue;
           if (massdiff < 300) continue;
           // if (massdiff < 900 || mass_stop() < 1000) continue;
           plot2d("h2d_T2bW_masspts", mass_stop(), mass_lsp(), 1, SRVec.at(0).histMap, ";M_{stop} [GeV]; M_{lsp} [GeV]", 100, 300, 1300, 80, 0, 800);
-        } else if (dsname.Contains("T2bt")) {
+        } else if (sampleCtx_.model == SampleContext::k_T2bt) {
           float massdiff = mass_stop() - mass_lsp();
           if (mass_lsp() < 300 && mass_stop() < 800) continue;
           if (massdiff < 300) continue;
@@ -400,7 +617,7 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
       }
 
       // Only consider events with nupt < 200 for the inclusive WNJetsToLNu samples
-      if (dsname.BeginsWith("/W") && dsname.Contains("JetsToLNu") && !dsname.Contains("NuPt-200") && nupt() > 200) continue;
+      if (sampleCtx_.is_inclusiveWJets && nupt() > 200) continue;
 
       if (is_fastsim_) {
         if (fmod(mass_stop(), kSMSMassStep) > 2 || fmod(mass_lsp(), kSMSMassStep) > 2) continue;  // skip points in between the binning
@@ -408,27 +625,38 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
       }
 
       ++nPassedTotal;
+      telemetry_.SwitchStage(kStageAnalysis);
 
       is_bkg_ = (!is_data() && !is_fastsim_);
 
       // Calculate event weight
       evtWgt.resetEvent(); // full event weights only get calculated if the event get selected for a SR
 
+      // Trigger decisions of the event, evaluated once for all the regions and efficiency studies,
+      // only used for data so the MC doesn't read the trigger branches
+      trigword_ = 0;
+      if (is_data()) {
+        trigword_ = (sampleCtx_.has_HLT_bits)? HLT_bits() : packRawTriggerBits(sampleCtx_.HLT_branches);
+        trigword_ |= trigword::typeBits(trigword_, year_, lep1_pdgid(), lep2_pdgid());
+      }
+
       // Simple weight with scale1fb only
       if (!is_data()) {
         if (is_fastsim_) {
-          int nEventsSample = h_sig_counter_nEvents->GetBinContent(h_sig_counter->FindBin(mass_stop(), mass_lsp()));
-          evtweight_ = kLumi * xsec() * 1000 / nEventsSample;
+          evtweight_ = sampleCtx_.GetSignalWeight(mass_stop(), mass_lsp(), xsec());
         } else {
           evtweight_ = kLumi * scale1fb();
         }
+        evtweight_ *= subsampler_.GetWeight();
+      } else {
+        evtweight_ = subsampler_.GetWeight();
       }
 
       // Plot nvtxs on the base selection of stopbaby for reweighting purpose
       plot1d("h_nvtxs", nvtxs(), 1, testVec[0].histMap, ";Number of vertices", 100, 1, 101);
 
       if (doNvtxReweight && (datayear == 2016 || datayear == 2018)) {
-        if (nvtxs() < 100) evtweight_ = nvtxscale_[nvtxs()];  // only scale for data
+        if (nvtxs() < 100) evtweight_ = nvtxscale_[nvtxs()] * subsampler_.GetWeight();  // only scale for data
         plot1d("h_nvtxs_rwtd", nvtxs(), evtweight_, testVec[0].histMap, ";Number of vertices", 100, 1, 101);
       }
 
@@ -469,8 +697,10 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
       /// Common variables for all JES type
       values_["nlep"] = ngoodleps();
       values_["nvlep"] = nvetoleps();
-      values_["lep1pt"] = lep1_p4().pt();
+      values_["lep1pt"] = lep1_p4_polar().pt;
       values_["passvetos"] = PassTrackVeto() && PassTauVeto();
+      for (auto& fv : friendVars_)
+        values_[fv.first] = (*fv.second)();
 
       // For toptagging, add correct switch later
       // values_["resttag"] = lead_restopdisc;
@@ -482,11 +712,11 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
 
       if (runResTopMVA) {
         // Prepare deep_cvsl vector
-        vector<float> ak4pfjets_dcvsl;
+        ak4pfjets_dcvsl_.clear();
         for (size_t j = 0; j < ak4pfjets_deepCSV().size(); ++j) {
-          ak4pfjets_dcvsl.push_back(ak4pfjets_deepCSVc().at(j) / (ak4pfjets_deepCSVc().at(j) + ak4pfjets_deepCSVl().at(j)));
+          ak4pfjets_dcvsl_.push_back(ak4pfjets_deepCSVc().at(j) / (ak4pfjets_deepCSVc().at(j) + ak4pfjets_deepCSVl().at(j)));
         }
-        resTopMVA->setJetVecPtrs(&ak4pfjets_p4(), &ak4pfjets_deepCSV(), &ak4pfjets_dcvsl, &ak4pfjets_ptD(), &ak4pfjets_axis1(), &ak4pfjets_mult());
+        resTopMVA->setJetVecPtrs(&ak4pfjets_p4(), &ak4pfjets_deepCSV(), &ak4pfjets_dcvsl_, &ak4pfjets_ptD(), &ak4pfjets_axis1(), &ak4pfjets_mult());
         std::vector<TopCand> topcands = resTopMVA->getTopCandidates(-1);
         values_["resttag"] = (topcands.size() > 0)? topcands[0].disc : -1.1;
       }
@@ -496,8 +726,8 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
 
       /// Values only for hist filling or testing
       values_["chi2"] = hadronic_top_chi2();
-      values_["lep1eta"] = lep1_p4().eta();
-      values_["passlep1pt"] = (abs(lep1_pdgid()) == 13 && lep1_p4().pt() > 40) || (abs(lep1_pdgid()) == 11 && lep1_p4().pt() > 45);
+      values_["lep1eta"] = lep1_p4_polar().eta;
+      values_["passlep1pt"] = (abs(lep1_pdgid()) == 13 && lep1_p4_polar().pt > 40) || (abs(lep1_pdgid()) == 11 && lep1_p4_polar().pt > 45);
 
       for (int jestype = 0; jestype < ((doSystVariations && !is_data())? 3 : 1); ++jestype) {
         if (doSystVariations) jestype_ = jestype;
@@ -516,15 +746,15 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
           values_["dphilmet"] = lep1_dphiMET();
           values_["j1passbtag"] = (ngoodjets() > 0)? ak4pfjets_passMEDbtag().at(0) : 0;
 
-          values_["jet1pt"] = (ngoodjets() > 0)? ak4pfjets_p4().at(0).pt() : 0;
-          values_["jet2pt"] = (ngoodjets() > 1)? ak4pfjets_p4().at(1).pt() : 0;
-          values_["jet1eta"] = (ngoodjets() > 0)? ak4pfjets_p4().at(0).eta() : -9;
-          values_["jet2eta"] = (ngoodjets() > 1)? ak4pfjets_p4().at(1).eta() : -9;
+          values_["jet1pt"] = (ngoodjets() > 0)? ak4pfjets_p4_polar().pt.at(0) : 0;
+          values_["jet2pt"] = (ngoodjets() > 1)? ak4pfjets_p4_polar().pt.at(1) : 0;
+          values_["jet1eta"] = (ngoodjets() > 0)? ak4pfjets_p4_polar().eta.at(0) : -9;
+          values_["jet2eta"] = (ngoodjets() > 1)? ak4pfjets_p4_polar().eta.at(1) : -9;
 
           values_["ht"] = ak4_HT();
           values_["metphi"] = pfmet_phi();
           values_["ntbtag"] = ntightbtags();
-          values_["leadbpt"] = ak4pfjets_leadbtag_p4().pt();
+          values_["leadbpt"] = ak4pfjets_leadbtag_p4_polar().pt;
           values_["mlb_0b"] = (ak4pfjets_leadbtag_p4() + lep1_p4()).M();
           // values_["htratio"] = ak4_htratiom();
 
@@ -538,18 +768,18 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
           values_["nbjet"] = jup_ngoodbtags();  // nbtag30();
           values_["nbtag"]  = jup_nanalysisbtags();
           values_["dphijmet"] = mindphi_met_j1_j2_jup();
-          values_["dphilmet"] = fabs(lep1_p4().phi() - pfmet_phi_jup());
+          values_["dphilmet"] = fabs(lep1_p4_polar().phi - pfmet_phi_jup());
           values_["j1passbtag"] = (jup_ngoodjets() > 0)? jup_ak4pfjets_passMEDbtag().at(0) : 0;
 
-          values_["jet1pt"] = (jup_ngoodjets() > 0)? jup_ak4pfjets_p4().at(0).pt() : 0;
-          values_["jet2pt"] = (jup_ngoodjets() > 1)? jup_ak4pfjets_p4().at(1).pt() : 0;
-          values_["jet1eta"] = (jup_ngoodjets() > 0)? jup_ak4pfjets_p4().at(0).eta() : -9;
-          values_["jet2eta"] = (jup_ngoodjets() > 1)? jup_ak4pfjets_p4().at(1).eta() : -9;
+          values_["jet1pt"] = (jup_ngoodjets() > 0)? jup_ak4pfjets_p4_polar().pt.at(0) : 0;
+          values_["jet2pt"] = (jup_ngoodjets() > 1)? jup_ak4pfjets_p4_polar().pt.at(1) : 0;
+          values_["jet1eta"] = (jup_ngoodjets() > 0)? jup_ak4pfjets_p4_polar().eta.at(0) : -9;
+          values_["jet2eta"] = (jup_ngoodjets() > 1)? jup_ak4pfjets_p4_polar().eta.at(1) : -9;
 
           values_["ht"] = jup_ak4_HT();
           values_["metphi"] = pfmet_phi_jup();
           values_["ntbtag"] = jup_ntightbtags();
-          values_["leadbpt"] = jup_ak4pfjets_leadbtag_p4().pt();
+          values_["leadbpt"] = jup_ak4pfjets_leadbtag_p4_polar().pt;
           values_["mlb_0b"] = (jup_ak4pfjets_leadbtag_p4() + lep1_p4()).M();
           // values_["htratio"] = jup_ak4_htratiom();
 
@@ -563,18 +793,18 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
           values_["nbjet"] = jdown_ngoodbtags();  // nbtag30();
           values_["ntbtag"] = jdown_ntightbtags();
           values_["dphijmet"] = mindphi_met_j1_j2_jdown();
-          values_["dphilmet"] = fabs(lep1_p4().phi() - pfmet_phi_jdown());
+          values_["dphilmet"] = fabs(lep1_p4_polar().phi - pfmet_phi_jdown());
           values_["j1passbtag"] = (jdown_ngoodjets() > 0)? jdown_ak4pfjets_passMEDbtag().at(0) : 0;
 
-          values_["jet1pt"] = (jdown_ngoodjets() > 0)? jdown_ak4pfjets_p4().at(0).pt() : 0;
-          values_["jet2pt"] = (jdown_ngoodjets() > 1)? jdown_ak4pfjets_p4().at(1).pt() : 0;
-          values_["jet1eta"] = (jdown_ngoodjets() > 0)? jdown_ak4pfjets_p4().at(0).eta() : -9;
-          values_["jet2eta"] = (jdown_ngoodjets() > 1)? jdown_ak4pfjets_p4().at(1).eta() : -9;
+          values_["jet1pt"] = (jdown_ngoodjets() > 0)? jdown_ak4pfjets_p4_polar().pt.at(0) : 0;
+          values_["jet2pt"] = (jdown_ngoodjets() > 1)? jdown_ak4pfjets_p4_polar().pt.at(1) : 0;
+          values_["jet1eta"] = (jdown_ngoodjets() > 0)? jdown_ak4pfjets_p4_polar().eta.at(0) : -9;
+          values_["jet2eta"] = (jdown_ngoodjets() > 1)? jdown_ak4pfjets_p4_polar().eta.at(1) : -9;
 
           values_["ht"] = jdown_ak4_HT();
           values_["metphi"] = pfmet_phi_jdown();
           values_["nbtag"]  = jdown_nanalysisbtags();
-          values_["leadbpt"] = jdown_ak4pfjets_leadbtag_p4().pt();
+          values_["leadbpt"] = jdown_ak4pfjets_leadbtag_p4_polar().pt;
           values_["mlb_0b"] = (jdown_ak4pfjets_leadbtag_p4() + lep1_p4()).M();
           // values_["htratio"] = jdown_ak4_htratiom();
 
@@ -589,12 +819,12 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
         // values_["ntbtag"] = ntbtagCSV;
 
         // Filling histograms for SR
-        fillHistosForSR(suffix);
+        fillHistosForSR(SRVec, suffix);
 
-        fillHistosForCR0b(suffix);
+        fillHistosForCR0b(CR0bVec, suffix);
 
         // Filling analysis variables with removed leptons, for CR2l
-        values_["nlep_rl"] = (ngoodleps() == 1 && nvetoleps() >= 2 && lep2_p4().Pt() > 10)? 2 : ngoodleps();
+        values_["nlep_rl"] = (ngoodleps() == 1 && nvetoleps() >= 2 && lep2_p4_polar().pt > 10)? 2 : ngoodleps();
         values_["mll"] = (lep1_p4() + lep2_p4()).M();
 
         if (jestype_ == 0) {
@@ -619,8 +849,18 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
           values_["dphilmet_rl"] = lep1_dphiMET_rl_jdown();
           values_["tmod_rl"] = topnessMod_rl_jdown();
         }
-        fillHistosForCR2l(suffix);
+        fillHistosForCR2l(CR2lVec, suffix);
         fillHistosForCRemu(suffix);
+        if (scan_.IsActive()) fillScanHistos(suffix);
+
+        // The other region schemes share the values and weights above, only the region matching is repeated
+        fillingExtraScheme_ = true;
+        for (auto& scheme : extraSchemes_) {
+          fillHistosForSR(scheme.SRVec, suffix);
+          fillHistosForCR0b(scheme.CR0bVec, suffix);
+          fillHistosForCR2l(scheme.CR2lVec, suffix);
+        }
+        fillingExtraScheme_ = false;
 
         // testCutFlowHistos(testVec[2]);
         fillTopTaggingHistos(suffix);
@@ -647,15 +887,20 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
   } // end of file loop
 
   cout << "[StopLooper::looper] processed  " << nEventsTotal << " events" << endl;
+  if (subsampler_.IsActive())
+    cout << "[StopLooper::looper] subsampling with fraction " << subsampler_.GetFraction() << ", "
+         << nSubsampleSkipped << " events skipped" << endl;
   if ( nEventsChain != nEventsTotal )
     cout << "WARNING: Number of events from files is not equal to total number of events" << endl;
 
+  telemetry_.SwitchStage(kStageWrite);
+  histMemBudget.Report(cout, "at the end of the job");
   outfile_->cd();
 
-  auto writeHistsToFile = [&] (vector<SR>& srvec) {
+  auto writeHistsToFile = [&] (vector<SR>& srvec, TDirectory* basedir) {
     for (auto& sr : srvec) {
-      TDirectory* dir = (TDirectory*) outfile_->Get(sr.GetName().c_str());
-      if (dir == 0) dir = outfile_->mkdir(sr.GetName().c_str()); // shouldn't happen
+      TDirectory* dir = (TDirectory*) basedir->Get(sr.GetName().c_str());
+      if (dir == 0) dir = basedir->mkdir(sr.GetName().c_str()); // shouldn't happen
       dir->cd();
       for (auto& h : sr.histMap) {
         if (h.first.find("HI") != string::npos || h.first.find("LOW") != string::npos) continue;
@@ -669,11 +914,21 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
     }
   };
 
-  writeHistsToFile(testVec);
-  writeHistsToFile(SRVec);
-  writeHistsToFile(CR0bVec);
-  writeHistsToFile(CR2lVec);
-  writeHistsToFile(CRemuVec);
+  writeHistsToFile(testVec, outfile_);
+  writeHistsToFile(SRVec, outfile_);
+  writeHistsToFile(CR0bVec, outfile_);
+  writeHistsToFile(CR2lVec, outfile_);
+  writeHistsToFile(CRemuVec, outfile_);
+  for (auto& scheme : extraSchemes_) {
+    TDirectory* schemedir = outfile_->GetDirectory(scheme.name.c_str());
+    writeHistsToFile(scheme.SRVec, schemedir);
+    writeHistsToFile(scheme.CR0bVec, schemedir);
+    writeHistsToFile(scheme.CR2lVec, schemedir);
+  }
+  // The raw slices of the threshold scan, kept for the checkpoints and the incremental mode, then the yields of each point
+  for (size_t islice = 0; islice < scan_.GetNSlices(); ++islice)
+    writeHistsToFile(scan_.GetSlice(islice), outfile_->GetDirectory(Form("scanslices/s%zu", islice)));
+  if (scan_.IsActive()) scan_.WriteCumulative(outfile_);
 
   auto writeRatioHists = [&] (const SR& sr) {
     for (const auto& h : sr.histMap) {
@@ -693,9 +948,27 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
   writeRatioHists(testVec[0]);
   writeRatioHists(testVec[1]);
 
+  // Record the sampling, the effective fraction is the ratio of the 2 bins, also after hadd
+  if (subsampler_.IsActive()) {
+    outfile_->cd();
+    subsampler_.MakeSummaryHist()->Write();
+  }
+
+  // Everything needed to add the next increment on top of this output
+  if (incremental_) {
+    TDirectory* incdir = outfile_->mkdir("incremental");
+    manifest.Write(incdir);
+    writeEventIds(incdir, ckstate);
+  }
+
   outfile_->Write();
   outfile_->Close();
-  if (printPassedEvents) ofile.close();
+  if (incremental_) remove(prev_output.c_str());
+  dumper_.Close();
+  // The job is complete, the checkpoint is not needed anymore
+  if (checkpoint_.IsEnabled() || resumed) checkpoint_.Remove();
+  telemetry_.Close();
+  resources.PrintSummary();
 
   bmark->Stop("benchmark");
   cout << endl;
@@ -712,7 +985,9 @@ void StopLooper::looper(TChain* chain, string samplestr, string output_dir, int
 
 void StopLooper::fillYieldHistos(SR& sr, float met, string suf, bool is_cr2l) {
 
-  evtweight_ = evtWgt.getWeight(evtWgtInfo::systID(jestype_), is_cr2l);
+  // The inverse of the subsampling fraction keeps the yields unbiased, is 1 when not subsampling
+  const double subsampleWeight = subsampler_.GetWeight();
+  evtweight_ = evtWgt.getWeight(evtWgtInfo::systID(jestype_), is_cr2l) * subsampleWeight;
 
   if (doNvtxReweight && (datayear == 2016 || datayear == 2018)) {
     if (nvtxs() < 100) evtweight_ *= nvtxscale_[nvtxs()];  // only scale for data
@@ -734,7 +1009,7 @@ void StopLooper::fillYieldHistos(SR& sr, float met, string suf, bool is_cr2l) {
             plot3d("hSMS_metbins"+s+"_"+evtWgt.getLabel(syst), met, mass_stop(), mass_lsp(), evtweight_, sr.histMap, ";E^{miss}_{T} [GeV];M_{stop};M_{LSP}",
                    sr.GetNMETBins(), sr.GetMETBinsPtr(), mStopBins.size()-1, mStopBins.data(), mLSPBins.size()-1, mLSPBins.data());
           else
-            plot1d("h_metbins"+s+"_"+evtWgt.getLabel(syst), met, evtWgt.getWeight(syst, is_cr2l), sr.histMap, ";E^{miss}_{T} [GeV]", sr.GetNMETBins(), sr.GetMETBinsPtr());
+            plot1d("h_metbins"+s+"_"+evtWgt.getLabel(syst), met, evtWgt.getWeight(syst, is_cr2l) * subsampleWeight, sr.histMap, ";E^{miss}_{T} [GeV]", sr.GetNMETBins(), sr.GetMETBinsPtr());
         }
       }
     }
@@ -750,20 +1025,26 @@ void StopLooper::fillYieldHistos(SR& sr, float met, string suf, bool is_cr2l) {
     else fillhists("_unclass");  // either unclassified 1lep or 0lep, or something else unknown, shouldn't have (m)any
   }
 
-  // Block for debugging, active when setting printPassedEvents = true
-  if (printPassedEvents && sr.GetName() == "srbase" && suf == "") {
-    // static bool printOnce1 = false;
-    // if (!printOnce1) { for (auto& v : values_) ofile << ' ' << v.first; ofile << endl; printOnce1 = true; }
-    ofile << run() << ' ' << ls() << ' ' << evt() << ' ' << sr.GetName();
-    // if (run() == 277168) for (auto& v : values_) ofile << ' ' << v.second;
-    ofile << ": pfmet()= " << pfmet() << ", ngoodjets()= " << ngoodjets() << ", ak4pfjets_p4()[1].pt()= " << ak4pfjets_p4()[1].pt() << endl;
-    // ofile << ' ' << evtweight_ << ' ' << evtWgt.getWeight(evtWgtInfo::systID::k_bTagEffHFUp) << ' ' << evtWgt.getLabel(evtWgtInfo::systID::k_bTagEffHFUp);
-    // ofile << ' ' << evtweight_ << ' ' << pfmet() << ' ' << mt_met_lep() << ' ' << Mlb_closestb() << ' ' << topnessMod() << ' ' << ngoodjets() << ' ' << ngoodbtags() << ' ' << mindphi_met_j1_j2() << ' ' << pfmet_rl();
-    ofile << endl;
+  // Event list for sync and debugging, active with --dumpEvents or when setting printPassedEvents = true
+  if (dumper_.IsOpen() && suf == "" && !fillingExtraScheme_ && dumper_.IsSelectedRegion(sr.GetName()))
+    dumper_.Fill(run(), ls(), evt(), sr.GetName(), values_, evtweight_);
+}
+
+void StopLooper::fillScanHistos(string suf) {
+
+  fillingExtraScheme_ = true;
+  for (size_t ireg = 0; ireg < scan_.GetNRegions(); ++ireg) {
+    bool is_cr2l = scan_.IsCR2l(ireg);
+    // Same trigger requirements as in fillHistosForSR/CR0b/CR2l
+    if (is_data() && !PassingHLTriggers(is_cr2l? 2 : 1)) continue;
+    int islice = scan_.FindSlice(ireg, values_);
+    if (islice < 0) continue;
+    fillYieldHistos(scan_.GetRegion(islice, ireg), values_[is_cr2l? "met_rl" : "met"], suf, is_cr2l);
   }
+  fillingExtraScheme_ = false;
 }
 
-void StopLooper::fillHistosForSR(string suf) {
+void StopLooper::fillHistosForSR(vector<SR>& srvec, string suf) {
 
   // Trigger requirements
   if (is_data() && !PassingHLTriggers()) return;
@@ -771,7 +1052,7 @@ void StopLooper::fillHistosForSR(string suf) {
   // // For getting into full trigger efficiency in 2017 data
   // if ( (abs(lep1_pdgid()) == 11 && values_["lep1pt"] < 40) || (abs(lep1_pdgid()) == 13 && values_["lep1pt"] < 30) ) return;
 
-  for (auto& sr : SRVec) {
+  for (auto& sr : srvec) {
     if (!sr.PassesSelection(values_)) continue;
     fillYieldHistos(sr, values_["met"], suf);
 
@@ -855,7 +1136,7 @@ void StopLooper::fillHistosForSR(string suf) {
   // SRVec[0].PassesSelectionPrintFirstFail(values_);
 }
 
-void StopLooper::fillHistosForCR2l(string suf) {
+void StopLooper::fillHistosForCR2l(vector<SR>& crvec, string suf) {
 
   // Trigger requirements
   if (is_data() && !PassingHLTriggers(2)) return;
@@ -864,7 +1145,7 @@ void StopLooper::fillHistosForCR2l(string suf) {
   // if (not( (HLT_SingleEl() && abs(lep1_pdgid()) == 11 && values_["lep1pt"] < 45) ||
   //          (HLT_SingleMu() && abs(lep1_pdgid()) == 13 && values_["lep1pt"] < 40) || (HLT_MET_MHT() && pfmet() > 250) )) return;
 
-  for (auto& cr : CR2lVec) {
+  for (auto& cr : crvec) {
     if (!cr.PassesSelection(values_)) continue;
     fillYieldHistos(cr, values_["met_rl"], suf, true);
 
@@ -932,12 +1213,12 @@ void StopLooper::fillHistosForCR2l(string suf) {
   }
 }
 
-void StopLooper::fillHistosForCR0b(string suf) {
+void StopLooper::fillHistosForCR0b(vector<SR>& crvec, string suf) {
 
   // Trigger requirements
   if (is_data() && !PassingHLTriggers()) return;
 
-  for (auto& cr : CR0bVec) {
+  for (auto& cr : crvec) {
     if (!cr.PassesSelection(values_)) continue;
     fillYieldHistos(cr, values_["met"], suf);
 
@@ -970,7 +1251,7 @@ void StopLooper::fillHistosForCR0b(string suf) {
       plot1d("h_jet1eta"+s, values_["jet1eta"], evtweight_, cr.histMap, ";#eta(jet1) [GeV]"   , 30,  -3,  3);
       plot1d("h_jet2eta"+s, values_["jet2eta"], evtweight_, cr.histMap, ";#eta(jet2) [GeV]"   , 60,  -3,  3);
       // Temporary test for low dphijmet excess
-      plot1d("h_dphij1j2"+s, fabs(ak4pfjets_p4().at(0).phi()-ak4pfjets_p4().at(1).phi()), evtweight_, cr.histMap, ";#Delta#phi(j1,j2)" , 33,  0, 3.3);
+      plot1d("h_dphij1j2"+s, fabs(ak4pfjets_p4_polar().phi.at(0)-ak4pfjets_p4_polar().phi.at(1)), evtweight_, cr.histMap, ";#Delta#phi(j1,j2)" , 33,  0, 3.3);
     };
     fillKineHists(suf);
 
@@ -1023,20 +1304,20 @@ void StopLooper::fillHistosForCRemu(string suf) {
   if ( !(lep1_pdgid() * lep2_pdgid() == -143) ) return;
 
   // Basic cuts that are not supposed to change frequently
-  if ( lep1_p4().pt() < 30 || fabs(lep1_p4().eta()) > 2.1 ||
+  if ( lep1_p4_polar().pt < 30 || fabs(lep1_p4_polar().eta) > 2.1 ||
        (abs(lep1_pdgid()) == 13 && !lep1_passTightID()) ||
        (abs(lep1_pdgid()) == 11 && !lep1_passMediumID()) ||
        lep1_MiniIso() > 0.1 ) return;
 
-  if ( lep2_p4().pt() < 15 || fabs(lep2_p4().eta()) > 2.1 ||
+  if ( lep2_p4_polar().pt < 15 || fabs(lep2_p4_polar().eta) > 2.1 ||
        (abs(lep2_pdgid()) == 13 && !lep2_passTightID()) ||
        (abs(lep2_pdgid()) == 11 && !lep2_passMediumID()) ||
        lep2_MiniIso() > 0.1 ) return;
 
   if ( (lep1_p4() + lep2_p4()).M() < 20 ) return;
 
-  values_["lep2pt"] = lep2_p4().pt();
-  values_["lep2eta"] = lep2_p4().eta();
+  values_["lep2pt"] = lep2_p4_polar().pt;
+  values_["lep2eta"] = lep2_p4_polar().eta;
 
   for (auto& cr : CRemuVec) {
     if ( cr.PassesSelection(values_) ) {
@@ -1098,51 +1379,53 @@ void StopLooper::fillEfficiencyHistos(SR& sr, const string type, string suffix)
   }
 
   if (is_data() && (type == "" || type == "triggers")) {
+    auto hlt = [this](trigword::TriggerBit bit) { return trigword::testBit(trigword_, bit); };
+
     // Study the efficiency of the MET trigger
-    if (HLT_SingleMu() && abs(lep1_pdgid()) == 13 && nvetoleps() == 1 && lep1_p4().pt() > 40) {
+    if (hlt(trigword::k_SingleMu) && abs(lep1_pdgid()) == 13 && nvetoleps() == 1 && lep1_p4_polar().pt > 40) {
       plot1d("hden_met_hltmet"+suffix, pfmet(), 1, sr.histMap, ";#slash{E}_{T} [GeV]"  , 60,  50, 650);
       plot1d("hden_met_hltmetmht120"+suffix, pfmet(), 1, sr.histMap, ";#slash{E}_{T} [GeV]"  , 60,  50, 650);
       plot1d("hden_ht_hltht_unprescaled"+suffix, ak4_HT(), 1, sr.histMap, ";H_{T} [GeV]", 30, 800, 1400);
-      if (HLT_MET_MHT())
+      if (hlt(trigword::k_MET_MHT))
         plot1d("hnum_met_hltmet"+suffix, pfmet(), 1, sr.histMap, ";#slash{E}_{T} [GeV]"  , 60,  50, 650);
-      if (HLT_MET120_MHT120())
+      if (hlt(trigword::k_MET120_MHT120))
         plot1d("hnum_met_hltmetmht120"+suffix, pfmet(), 1, sr.histMap, ";#slash{E}_{T} [GeV]"  , 60,  50, 650);
-      if (HLT_PFHT_unprescaled())
+      if (hlt(trigword::k_PFHT_unprescaled))
         plot1d("hnum_ht_hltht_unprescaled"+suffix, ak4_HT(), 1, sr.histMap, ";H_{T} [GeV]", 30, 800, 1400);
-    } else if (HLT_SingleEl() && abs(lep1_pdgid()) == 11 && nvetoleps() == 1 && lep1_p4().pt() > 45) {
+    } else if (hlt(trigword::k_SingleEl) && abs(lep1_pdgid()) == 11 && nvetoleps() == 1 && lep1_p4_polar().pt > 45) {
       plot1d("hden_met_hltmet_eden"+suffix, pfmet(), 1, sr.histMap, ";#slash{E}_{T} [GeV]"  , 60,  50, 650);
-      if (HLT_MET_MHT())
+      if (hlt(trigword::k_MET_MHT))
         plot1d("hnum_met_hltmet_eden"+suffix, pfmet(), 1, sr.histMap, ";#slash{E}_{T} [GeV]"  , 60,  50, 650);
     }
 
     // Study the efficiency of the single lepton triggers
-    if (HLT_MET_MHT() && pfmet() > 250) {
-      float lep1pt = lep1_p4().pt();
+    if (hlt(trigword::k_MET_MHT) && pfmet() > 250) {
+      float lep1pt = lep1_p4_polar().pt;
       lep1pt = (lep1pt < 400)? lep1pt : 399;
       if (abs(lep1_pdgid()) == 13) {
         plot1d("hden_lep1pt_hltmu"+suffix, lep1pt, 1, sr.histMap, ";p_{T}(lep1) [GeV]", 50,  0, 400);
-        if (HLT_SingleMu())
+        if (hlt(trigword::k_SingleMu))
           plot1d("hnum_lep1pt_hltmu"+suffix, lep1pt, 1, sr.histMap, ";p_{T}(#mu) [GeV]", 50,  0, 400);
       }
       else if (abs(lep1_pdgid()) == 11) {
         plot1d("hden_lep1pt_hltel"+suffix, lep1pt, 1, sr.histMap, ";p_{T}(lep1) [GeV]", 50,  0, 400);
-        if (HLT_SingleEl())
+        if (hlt(trigword::k_SingleEl))
           plot1d("hnum_lep1pt_hltel"+suffix, lep1pt, 1, sr.histMap, ";p_{T}(e) [GeV]", 50,  0, 400);
       }
     }
 
     // Study the OR of the 3 triggers, uses jetht dataset
-    if (HLT_PFHT_unprescaled())
+    if (hlt(trigword::k_PFHT_unprescaled))
       plot1d("h_ht"+suffix, ak4_HT(), 1, sr.histMap, ";H_{T} [GeV];#slash{E}_{T} [GeV]", 30, 800, 1400);
 
     // Measure the efficiencies of all 3 trigger combined in a JetHT dataset
     // if ((HLT_PFHT_unprescaled() || HLT_PFHT_prescaled())) {
-    if ((HLT_PFHT_unprescaled() || HLT_PFHT_prescaled()) || HLT_AK8Jet_unprescaled() || HLT_AK8Jet_prescaled() || HLT_CaloJet500_NoJetID()) {
+    if ((hlt(trigword::k_PFHT_unprescaled) || hlt(trigword::k_PFHT_prescaled)) || hlt(trigword::k_AK8Jet_unprescaled) || hlt(trigword::k_AK8Jet_prescaled) || hlt(trigword::k_CaloJet500_NoJetID)) {
     // if (true) {
       const float TEbins_met[] = {150, 200, 225, 250, 275, 300, 350, 400, 550};
       const float TEbins_lep[] = {20, 22.5, 25, 30, 40, 55, 100, 200};
       float met = (pfmet() > 550)? 549.9 : pfmet();
-      float lep1pt = lep1_p4().pt();
+      float lep1pt = lep1_p4_polar().pt;
       int lep1id = abs(lep1_pdgid());
       lep1pt = (lep1pt > 200)? 199 : lep1pt;
       plot2d("hden2d_trigeff_met_lep1pt"+suffix, lep1pt, met, 1, sr.histMap, ";p_{T}(lep1) [GeV];#slash{E}_{T} [GeV]", 7, TEbins_lep, 8, TEbins_met);
@@ -1196,7 +1479,7 @@ void StopLooper::fillTopTaggingHistos(string suffix) {
       lead_deepdisc_top = disc;
       iak8_top = iak8;
     }
-    if (disc > 0.7 || (ak8pfjets_p4().at(iak8).pt() > 500 && disc > 0.3))
+    if (disc > 0.7 || (ak8pfjets_p4_polar().pt.at(iak8) > 500 && disc > 0.3))
       pass_deeptop_tag = true;
 
     float bindisc = disc / (disc + ak8pfjets_deepdisc_qcd().at(iak8));
@@ -1214,8 +1497,8 @@ void StopLooper::fillTopTaggingHistos(string suffix) {
   values_["deepWtag"] = lead_deepdisc_W;
   values_["binttag"] = lead_bindisc_top;
   values_["binWtag"] = lead_bindisc_W;
-  values_["topak8pt"] = (iak8_top < 0)? 0 : ak8pfjets_p4().at(iak8_top).pt();
-  values_["Wak8pt"] = (iak8_W < 0)? 0 : ak8pfjets_p4().at(iak8_W).pt();
+  values_["topak8pt"] = (iak8_top < 0)? 0 : ak8pfjets_p4_polar().pt.at(iak8_top);
+  values_["Wak8pt"] = (iak8_W < 0)? 0 : ak8pfjets_p4_polar().pt.at(iak8_W);
   values_["passdeepttag"] = pass_deeptop_tag;
   // values_["passresttag"] = lead_restopdisc > 0.9;
   // values_["ntftops"] = 0;
@@ -1343,7 +1626,7 @@ void StopLooper::testTopTaggingEffficiency(SR& sr) {
   float lead_tridisc_W = -0.1;
 
   for (size_t iak8 = 0; iak8 < ak8pfjets_p4().size(); ++iak8) {
-    float pt = ak8pfjets_p4()[iak8].pt();
+    float pt = ak8pfjets_p4_polar().pt[iak8];
     float disc_top = ak8pfjets_deepdisc_top().at(iak8);
     float disc_W = ak8pfjets_deepdisc_w().at(iak8);
     float disc_qcd = ak8pfjets_deepdisc_qcd().at(iak8);
@@ -1385,20 +1668,16 @@ void StopLooper::testTopTaggingEffficiency(SR& sr) {
     float gentop_pt = 0.;
     int bjetidx = -1;
     int topak8idx = -1;
+    // eta/phi of the jets computed once for all the gen quarks to match
+    kinem::EtaPhiCache ak8cache(ak8pfjets_p4());
+    kinem::EtaPhiCache ak4cache(ak4pfjets_p4());
     for (size_t q = 0; q < genqs_id().size(); ++q) {
       if (!genqs_isLastCopy().at(q)) continue;
       if (abs(genqs_id()[q]) == 6 && genqs__genpsidx().at(q) != leptonictopidx && abs(genqs__genpsidx().at(q)-leptonictopidx) == 1) {
         // Found the gen top that decay hadronically
         hadronictopidx = genqs__genpsidx().at(q);
         gentop_pt = genqs_p4().at(q).pt();
-        float minDR = 0.8;
-        for (size_t j = 0; j < ak8pfjets_p4().size(); ++j) {
-          float dr = ROOT::Math::VectorUtil::DeltaR(ak8pfjets_p4().at(j), genqs_p4().at(q));
-          if (dr < minDR) {
-            minDR = dr;
-            topak8idx = j;
-          }
-        }
+        topak8idx = ak8cache.Closest(genqs_p4().at(q), 0.8);
       }
       if (!genqs_isfromt().at(q)) continue;
       if ((abs(genqs_motherid().at(q)) == 6 && genqs_motheridx().at(q) == hadronictopidx) ||
@@ -1432,15 +1711,9 @@ void StopLooper::testTopTaggingEffficiency(SR& sr) {
     long matchedjetidx = 0;                // for fast duplicate check
     for (int q : genq_fromhadtop) {
       int genqid = genqs_id().at(q);
-      int jetidx = -1;
       float minDR = 0.6;
-      for (size_t j = 0; j < ak4pfjets_p4().size(); ++j) {
-        if (ak4pfjets_parton_flavor().at(j) != genqid) continue;
-        if (float dr = 1; isCloseObject(ak4pfjets_p4().at(j), genqs_p4().at(q), minDR, &dr)) {
-          minDR = dr;
-          jetidx = j;
-        }
-      }
+      int jetidx = ak4cache.Closest(genqs_p4().at(q).eta(), genqs_p4().at(q).phi(), minDR, &minDR,
+                                    [&](size_t j) { return ak4pfjets_parton_flavor().at(j) == genqid; });
       if (minDR < 0.6 && !(matchedjetidx & 1<<jetidx)) {
         matchedjetidx |= 1<<jetidx;
         jets_fromhadtop.push_back(jetidx);
@@ -1532,7 +1805,7 @@ void StopLooper::testTopTaggingEffficiency(SR& sr) {
       plot1d("h_truetop_tridisc_top", truetop_tridisc, evtweight_, sr.histMap, ";truth-matched AK8 tridisc top", 120, -0.1, 1.1);
 
       plot1d("hnum_gentop_pt", gentop_pt, evtweight_, sr.histMap, ";p_{T}(gen top)", 100, 0, 1500);
-      plot2d("h2d_ak8_vs_gentop_pt", gentop_pt, ak8pfjets_p4().at(topak8idx).pt(), evtweight_, sr.histMap, ";p_{T}(gen top);p_{T}(ak8jet matched)", 100, 0, 1500, 100, 0, 1500);
+      plot2d("h2d_ak8_vs_gentop_pt", gentop_pt, ak8pfjets_p4_polar().pt.at(topak8idx), evtweight_, sr.histMap, ";p_{T}(gen top);p_{T}(ak8jet matched)", 100, 0, 1500, 100, 0, 1500);
       if (truetop_deepdisc > 0.6)
         plot1d("h_truetop_genpt", gentop_pt, evtweight_, sr.histMap, ";p_{T}(gen top)", 100, 0, 1500);
 
@@ -1604,7 +1877,7 @@ void StopLooper::testTopTaggingEffficiency(SR& sr) {
       }
       plot1d("h_allaccepted_disc", topcands_disc().at(0), evtweight_, sr.histMap, ";lead topcand discriminator", 110, -1.1, 1.1);
 
-      vector<int> jidxs = topcands_ak4idx().at(0);
+      const vector<int>& jidxs = topcands_ak4idx().at(0);
       bool isRealTop = std::is_permutation(jidxs.begin(), jidxs.end(), jets_fromhadtop.begin());
       if (lead_disc < 0.98) {
         if (jidxs.at(0) != bjetidx)
@@ -1624,7 +1897,7 @@ void StopLooper::testTopTaggingEffficiency(SR& sr) {
     if (ntopcands >= 1) {
       bool isActualTopJet = true;
       float gentoppt = 0.;
-      vector<int> jidxs = topcands_ak4idx().at(0);
+      const vector<int>& jidxs = topcands_ak4idx().at(0);
       vector<int> midxs;
       for (int j = 0; j < 3; ++j) {
         int nMatchedGenqs = 0;
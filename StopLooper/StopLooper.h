@@ -1,19 +1,46 @@
 #ifndef STOPLOOPER_h
 #define STOPLOOPER_h
 
+#include <memory>
+
 #include "TFile.h"
 #include "TChain.h"
 #include "SR.h"
+#include "SampleContext.h"
+#include "EventSubsampler.h"
+#include "EventDumper.h"
+#include "LooperCheckpoint.h"
+#include "ThresholdScan.h"
+#include "../StopCORE/FriendTrees.h"
+#include "../StopCORE/BabyCatalog.h"
+#include "../StopCORE/FlatSkim.h"
 #include "../StopCORE/eventWeight.h"
+#include "../StopCORE/JobTelemetry.h"
 #include "../StopCORE/TopTagger/ResolvedTopMVA.h"
 
 class StopLooper {
  public:
-  StopLooper() : evtweight_(1.), jestype_(0) {}
+  StopLooper() : fillingExtraScheme_(false), compactHists_(false), histMemCeilingMB_(0), checkpointEvents_(0), checkpointMinutes_(0),
+                 resume_(false), incremental_(false), evtweight_(1.), jestype_(0) {}
   ~StopLooper() {}
 
   void SetSignalRegions();
   void SetJetEnergyScaleType(int jestype) { jestype_ = jestype; }
+  void SetTelemetryFile(std::string fname) { telemetryfile_ = fname; }
+  void SetCompactHistos(bool compact) { compactHists_ = compact; }
+  void SetHistMemoryCeiling(float ceilingMB) { histMemCeilingMB_ = ceilingMB; }
+  void SetSubsampleFraction(float fraction) { subsampler_.SetFraction(fraction); }
+  void SetEventDump(std::string fname, std::vector<std::string> regions, std::vector<std::string> columns) {
+    dumpfile_ = fname; dumpregions_ = regions; dumpcolumns_ = columns;
+  }
+  void SetCheckpoint(unsigned int everyNEvents, float everyNMinutes) { checkpointEvents_ = everyNEvents; checkpointMinutes_ = everyNMinutes; }
+  void SetResume(bool resume) { resume_ = resume; }
+  void SetIncremental(bool incremental) { incremental_ = incremental; }
+  void SetRegionSchemes(std::vector<std::string> schemes);
+  void AddScanVariable(std::string var, float nominal, std::vector<float> thresholds) { scan_.AddVariable(var, nominal, thresholds); }
+  void AddFriendDirectory(std::string dir) { friends_.AddDirectory(dir); }
+  void AddFriendVariable(std::string name) { friendVars_.emplace_back(name, &friends_.Register<float>(name)); }
+  void SetFlatSkimDirectory(std::string dir) { flatSkimDir_ = dir; }
   void GenerateAllSRptrSets();
 
   void looper(TChain* chain, std::string sample, std::string outputdir, int jestype = 0);
@@ -28,12 +55,29 @@ class StopLooper {
 
   std::vector<SR> testVec;
 
+  // Other region schemes filled in the same pass, each written under a top level directory of its name
+  struct RegionScheme {
+    std::string name;
+    std::vector<SR> SRVec;
+    std::vector<SR> CR2lVec;
+    std::vector<SR> CR0bVec;
+  };
+  std::vector<RegionScheme> extraSchemes_;
+  bool fillingExtraScheme_;  // also set for the threshold scan, the event dump only follows the primary regions
+
+  // Yields over a list of thresholds on up to 2 cut variables, see ThresholdScan.h
+  ThresholdScan scan_;
+
+  // All the regions with their directory in the output, for the checkpoints and the incremental mode
+  RegionList allRegions();
+
   // Analysis
   void fillYieldHistos(SR& sr, float met, std::string suffix = "", bool is_cr2l = false);
-  void fillHistosForSR(std::string suffix = "");
-  void fillHistosForCR2l(std::string suffix = "");
-  void fillHistosForCR0b(std::string suffix = "");
+  void fillHistosForSR(std::vector<SR>& srvec, std::string suffix = "");
+  void fillHistosForCR2l(std::vector<SR>& crvec, std::string suffix = "");
+  void fillHistosForCR0b(std::vector<SR>& crvec, std::string suffix = "");
   void fillHistosForCRemu(std::string suffix = "");
+  void fillScanHistos(std::string suffix = "");
 
   // Helper functions
   bool PassingHLTriggers(const int type = 1);
@@ -51,17 +95,62 @@ class StopLooper {
 
   evtWgtInfo evtWgt;
   ResolvedTopMVA* resTopMVA;
+  std::vector<float> ak4pfjets_dcvsl_;  // input of resTopMVA, keeps its storage across events
 
  private:
   // Global variable
   TFile* outfile_;
 
+  // Optional progress record for batch jobs
+  std::string telemetryfile_;
+  JobTelemetry telemetry_;
+
+  // Histogram booking options, see HistMemory.h
+  bool compactHists_;
+  float histMemCeilingMB_;
+
+  // Sample specific constants, set when opening each file
+  SampleContext sampleCtx_;
+
+  // Hash based selection of a fraction of the events, off by default
+  EventSubsampler subsampler_;
+
+  // Event list for sync and debugging, see EventDumper.h
+  std::string dumpfile_;
+  std::vector<std::string> dumpregions_;
+  std::vector<std::string> dumpcolumns_;
+  EventDumper dumper_;
+
+  // Checkpoint and resume of long jobs, see LooperCheckpoint.h
+  unsigned int checkpointEvents_;
+  float checkpointMinutes_;
+  bool resume_;
+  LooperCheckpoint checkpoint_;
+
+  // Only process the input files not yet in the output, see FileManifest.h
+  bool incremental_;
+
+  // Entry-aligned friend trees of the babies, see FriendTrees.h. The registered float branches are copied into values_
+  FriendTrees friends_;
+  std::vector<std::pair<std::string,FriendBranch<float>*>> friendVars_;
+
+  // Metadata of the babies written by the merge step, see BabyCatalog.h
+  BabyCatalog catalog_;
+
+  // Flat skims of the babies, read instead of their trees when there is one, see FlatSkim.h
+  std::string flatSkimDir_;
+  std::unique_ptr<FlatSkim> flatSkim_;
+
+  // Names of the region schemes in StopRegions.h, the first one is written at the top level
+  std::vector<std::string> schemeNames_;
+
   // Event specific variables
   bool is_fastsim_;
   bool is_bkg_;
   double evtweight_;
   int jestype_;
   int year_;
+  unsigned int trigword_;  // packed trigger decisions of the event, see TriggerWord.h
   std::map<std::string,float> values_;
 
   // For nvtx reweighting
@@ -1,3 +1,6 @@
+#include <map>
+#include <stdexcept>
+
 #include "StopRegions.h"
 
 const float fInf = std::numeric_limits<float>::max();
@@ -1380,3 +1383,35 @@ std::vector<SR> getStopControlRegionsNoBTagsBooleanTopTags() {
 std::vector<SR> getStopControlRegionsDileptonBooleanTopTags() {
   return getStopControlRegionsDilepton( getStopSignalRegionsBooleanTopTags() );
 }
+
+struct StopRegionScheme {
+  std::vector<SR> (*getSR)();
+  std::vector<SR> (*getCR0b)();
+  std::vector<SR> (*getCR2l)();
+};
+
+static const std::map<std::string,StopRegionScheme> stopRegionSchemes = {
+  {"Topological",      {getStopSignalRegionsTopological,      getStopControlRegionsNoBTagsTopological,      getStopControlRegionsDileptonTopological}},
+  {"NewMETBinning",    {getStopSignalRegionsNewMETBinning,    getStopControlRegionsNoBTagsNewMETBinning,    getStopControlRegionsDileptonNewMETBinning}},
+  {"AddResTagBin",     {getStopSignalRegionsAddResTagBin,     getStopControlRegionsNoBTagsAddResTagBin,     getStopControlRegionsDileptonAddResTagBin}},
+  {"AddTopTagBins",    {getStopSignalRegionsAddTopTagBins,    getStopControlRegionsNoBTagsAddTopTagBins,    getStopControlRegionsDileptonAddTopTagBins}},
+  {"BinInResolvedTag", {getStopSignalRegionsBinInResolvedTag, getStopControlRegionsNoBTagsBinInResolvedTag, getStopControlRegionsDileptonBinInResolvedTag}},
+  {"BinInMergedTag",   {getStopSignalRegionsBinInMergedTag,   getStopControlRegionsNoBTagsBinInMergedTag,   getStopControlRegionsDileptonBinInMergedTag}},
+  {"BooleanTopTags",   {getStopSignalRegionsBooleanTopTags,   getStopControlRegionsNoBTagsBooleanTopTags,   getStopControlRegionsDileptonBooleanTopTags}},
+  {"Inclusive",        {getStopInclusiveRegionsTopological,   getStopInclusiveControlRegionsNoBTags,        getStopInclusiveControlRegionsDilepton}},
+};
+
+std::vector<std::string> getStopRegionSchemeNames() {
+  std::vector<std::string> names;
+  for (const auto& scheme : stopRegionSchemes) names.push_back(scheme.first);
+  return names;
+}
+
+void getStopRegionScheme(const std::string& scheme, std::vector<SR>& SRvec, std::vector<SR>& CR0bvec, std::vector<SR>& CR2lvec) {
+  auto iter = stopRegionSchemes.find(scheme);
+  if (iter == stopRegionSchemes.end())
+    throw std::invalid_argument("[getStopRegionScheme] Unknown region scheme " + scheme + "!");
+  SRvec = iter->second.getSR();
+  CR0bvec = iter->second.getCR0b();
+  CR2lvec = iter->second.getCR2l();
+}
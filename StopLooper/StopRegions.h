@@ -42,4 +42,8 @@ std::vector<SR> getStopInclusiveRegionsTopological();
 std::vector<SR> getStopInclusiveControlRegionsNoBTags();
 std::vector<SR> getStopInclusiveControlRegionsDilepton();
 
+// Region schemes by name, each gives the SR with the matching CR0b and CR2l
+std::vector<std::string> getStopRegionSchemeNames();
+void getStopRegionScheme(const std::string& scheme, std::vector<SR>& SRvec, std::vector<SR>& CR0bvec, std::vector<SR>& CR2lvec);
+
 #endif // STOPREGIONS_H
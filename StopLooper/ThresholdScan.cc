@@ -0,0 +1,173 @@
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+#include <set>
+
+#include "TH1.h"
+#include "TString.h"
+
+#include "ThresholdScan.h"
+
+using namespace std;
+
+static bool isYieldHist(const string& hname) {
+  return (hname.find("h_metbins") == 0 || hname.find("hSMS_metbins") == 0);
+}
+
+void ThresholdScan::AddVariable(const string& var, float nominal, vector<float> thresholds) {
+  if (vars_.size() >= 2)
+    throw invalid_argument("[ThresholdScan::AddVariable] At most 2 variables can be scanned at the same time!");
+  if (thresholds.empty())
+    throw invalid_argument("[ThresholdScan::AddVariable] No thresholds given for " + var + "!");
+  if (!regions_.empty())
+    throw logic_error("[ThresholdScan::AddVariable] The variables need to be added before the regions!");
+  sort(thresholds.begin(), thresholds.end());
+  thresholds.erase(unique(thresholds.begin(), thresholds.end()), thresholds.end());
+  vars_.push_back({var, nominal, thresholds});
+}
+
+size_t ThresholdScan::SliceIndex(const vector<int>& idx) const {
+  size_t islice = 0;
+  for (size_t d = vars_.size(); d-- > 0; )
+    islice = islice * vars_[d].thresholds.size() + idx[d];
+  return islice;
+}
+
+vector<int> ThresholdScan::SliceIndices(size_t islice) const {
+  vector<int> idx;
+  for (const auto& var : vars_) {
+    idx.push_back(islice % var.thresholds.size());
+    islice /= var.thresholds.size();
+  }
+  return idx;
+}
+
+void ThresholdScan::AddRegions(const vector<SR>& srvec, bool is_cr2l) {
+  size_t nslices = 1;
+  for (const auto& var : vars_) nslices *= var.thresholds.size();
+  slices_.resize(nslices);
+
+  const float ep = 0.000001;
+  for (const auto& sr : srvec) {
+    ScanRegion region{sr, vector<ScanMode>(vars_.size(), k_notCut), is_cr2l};
+    region.relaxed.histMap.clear();
+    bool scanned = false;
+    for (size_t d = 0; d < vars_.size(); ++d) {
+      const ScanVar& var = vars_[d];
+      if (!sr.VarExists(var.name)) continue;
+      if (fabs(sr.GetLowerBound(var.name) - var.nominal) < ep) {
+        region.modes[d] = k_lowerBound;
+        region.relaxed.SetVar(var.name, var.thresholds.front(), sr.GetUpperBound(var.name));
+        scanned = true;
+      } else if (fabs(sr.GetUpperBound(var.name) - var.nominal) < ep) {
+        region.modes[d] = k_upperBound;
+        region.relaxed.SetVar(var.name, sr.GetLowerBound(var.name), var.thresholds.back());
+        scanned = true;
+      }
+    }
+    if (!scanned) {
+      unscanned_.push_back(&sr);
+      continue;
+    }
+
+    // The slice windows, an event passing the relaxed selection falls into exactly one of them
+    for (size_t islice = 0; islice < nslices; ++islice) {
+      vector<int> idx = SliceIndices(islice);
+      SR slice(sr);
+      slice.histMap.clear();
+      for (size_t d = 0; d < vars_.size(); ++d) {
+        const vector<float>& thr = vars_[d].thresholds;
+        const string& name = vars_[d].name;
+        size_t k = idx[d];
+        if (region.modes[d] == k_lowerBound)
+          slice.SetVar(name, thr[k], (k+1 < thr.size())? thr[k+1] : sr.GetUpperBound(name));
+        else if (region.modes[d] == k_upperBound)
+          slice.SetVar(name, (k > 0)? thr[k-1] : sr.GetLowerBound(name), thr[k]);
+      }
+      slices_[islice].push_back(slice);
+    }
+    regions_.push_back(region);
+  }
+
+  cout << "[ThresholdScan::AddRegions] >> " << regions_.size() << " regions scanned over " << nslices << " threshold points" << endl;
+}
+
+int ThresholdScan::FindSlice(size_t ireg, const map<string,float>& values) {
+  ScanRegion& region = regions_[ireg];
+  if (!region.relaxed.PassesSelection(values)) return -1;
+
+  vector<int> idx(vars_.size(), 0);
+  for (size_t d = 0; d < vars_.size(); ++d) {
+    if (region.modes[d] == k_notCut) continue;
+    const vector<float>& thr = vars_[d].thresholds;
+    int nbelow = upper_bound(thr.begin(), thr.end(), values.at(vars_[d].name)) - thr.begin();
+    // The tightest threshold passed, lowest one above the value for an upper bound
+    idx[d] = (region.modes[d] == k_lowerBound)? nbelow - 1 : nbelow;
+  }
+  return SliceIndex(idx);
+}
+
+string ThresholdScan::GetPointName(size_t ipoint) const {
+  vector<int> idx = SliceIndices(ipoint);
+  string name = "scan";
+  for (size_t d = 0; d < vars_.size(); ++d) {
+    TString thr = Form("%g", vars_[d].thresholds[idx[d]]);
+    thr.ReplaceAll(".", "p").ReplaceAll("-", "m");
+    name += "_" + vars_[d].name + thr.Data();
+  }
+  return name;
+}
+
+void ThresholdScan::WriteCumulative(TDirectory* outdir) const {
+  for (size_t ipoint = 0; ipoint < slices_.size(); ++ipoint) {
+    vector<int> pidx = SliceIndices(ipoint);
+    string pname = GetPointName(ipoint);
+    TDirectory* pdir = outdir->mkdir(pname.c_str());
+
+    for (const SR* sr : unscanned_) {
+      TDirectory* rdir = pdir->mkdir(sr->GetName().c_str());
+      for (const auto& h : sr->histMap)
+        if (isYieldHist(h.first)) rdir->WriteTObject(h.second);
+    }
+
+    for (size_t ireg = 0; ireg < regions_.size(); ++ireg) {
+      const ScanRegion& region = regions_[ireg];
+      // The slices passing the thresholds of the point
+      vector<size_t> included;
+      for (size_t islice = 0; islice < slices_.size(); ++islice) {
+        vector<int> idx = SliceIndices(islice);
+        bool pass = true;
+        for (size_t d = 0; d < vars_.size(); ++d) {
+          if (region.modes[d] == k_lowerBound) pass &= (idx[d] >= pidx[d]);
+          else if (region.modes[d] == k_upperBound) pass &= (idx[d] <= pidx[d]);
+          else pass &= (idx[d] == 0);
+        }
+        if (pass) included.push_back(islice);
+      }
+
+      const string& srname = slices_[0][ireg].GetName();
+      TDirectory* rdir = pdir->mkdir(srname.c_str());
+      set<string> hnames;
+      for (size_t islice : included) {
+        for (const auto& h : slices_[islice][ireg].histMap)
+          if (isYieldHist(h.first)) hnames.insert(h.first);
+      }
+      for (const string& hname : hnames) {
+        TH1* hsum = nullptr;
+        for (size_t islice : included) {
+          auto iter = slices_[islice][ireg].histMap.find(hname);
+          if (iter == slices_[islice][ireg].histMap.end()) continue;
+          if (!hsum) {
+            hsum = (TH1*) iter->second->Clone(hname.c_str());
+            hsum->SetDirectory(nullptr);
+          } else {
+            hsum->Add(iter->second);
+          }
+        }
+        rdir->WriteTObject(hsum);
+        delete hsum;
+      }
+    }
+  }
+}
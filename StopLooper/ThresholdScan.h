@@ -0,0 +1,78 @@
+#ifndef THRESHOLDSCAN_h
+#define THRESHOLDSCAN_h
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "TDirectory.h"
+
+#include "SR.h"
+
+// class: ThresholdScan
+// Yields of the regions for a list of thresholds on one or two of their cut variables, in a single pass.
+// The regions that cut on a scanned variable at its nominal working point are copied with that cut
+// relaxed to the loosest threshold. An event passing the relaxed selection is filled once, into the
+// slice of the tightest thresholds it passes, each slice being a copy of the region with the cut
+// replaced by the window between two thresholds. The slices are summed up cumulatively when writing,
+// giving the h_metbins/hSMS_metbins of every threshold (pair) in the usual layout of the output,
+// under a top level directory per threshold point, e.g. scan_deepttag0p3/srA0/h_metbins. The regions
+// not cutting on the scanned variables are copied as they are, so each point has the full set of regions.
+
+class ThresholdScan {
+
+public:
+
+  ThresholdScan() {}
+  ~ThresholdScan() {}
+
+  // At most 2 variables, the thresholds get sorted
+  void AddVariable(const std::string& var, float nominal, std::vector<float> thresholds);
+  bool IsActive() const { return !vars_.empty(); }
+
+  // Set up the slices of the regions in srvec that cut on a scanned variable at its nominal value,
+  // srvec needs to stay in place as the other regions are kept by pointer
+  void AddRegions(const std::vector<SR>& srvec, bool is_cr2l);
+
+  size_t GetNRegions() const { return regions_.size(); }
+  size_t GetNSlices() const { return slices_.size(); }
+  bool IsCR2l(size_t ireg) const { return regions_[ireg].is_cr2l; }
+  std::vector<SR>& GetSlice(size_t islice) { return slices_[islice]; }
+  SR& GetRegion(size_t islice, size_t ireg) { return slices_[islice][ireg]; }
+
+  // Slice of the event for the scanned region, -1 if it doesn't pass the relaxed selection
+  int FindSlice(size_t ireg, const std::map<std::string,float>& values);
+
+  // Name of the top level directory of a threshold point, points are indexed like the slices
+  std::string GetPointName(size_t ipoint) const;
+
+  // Write the cumulative yield hists of every threshold point to <point>/<region>/ in outdir
+  void WriteCumulative(TDirectory* outdir) const;
+
+private:
+
+  struct ScanVar {
+    std::string name;
+    float nominal;
+    std::vector<float> thresholds;
+  };
+
+  // Which bound of the region is scanned
+  enum ScanMode { k_notCut = 0, k_lowerBound = 1, k_upperBound = -1 };
+
+  struct ScanRegion {
+    SR relaxed;
+    std::vector<ScanMode> modes;  // one per scanned variable
+    bool is_cr2l;
+  };
+
+  size_t SliceIndex(const std::vector<int>& idx) const;
+  std::vector<int> SliceIndices(size_t islice) const;
+
+  std::vector<ScanVar> vars_;
+  std::vector<ScanRegion> regions_;
+  std::vector<std::vector<SR>> slices_;  // [slice][region]
+  std::vector<const SR*> unscanned_;
+};
+
+#endif
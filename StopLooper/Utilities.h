@@ -12,6 +12,8 @@
 #include <map>
 #include <string>
 
+#include "HistMemory.h"
+
 // Histogram manipulation
 inline void moveOverFlowToLastBin1D(TH1* hist) {
   int nbin = hist->GetNbinsX();
@@ -39,14 +41,29 @@ inline void moveXOverFlowToLastBin3D(TH3* hist) {
   }
 }
 
+// Create a histogram for the plotXd functions, with float storage and no Sumw2 for non-yield hists in compact mode
+template<class THF, class THD, typename... TArgs>
+TH1* bookHist(std::map<std::string, TH1*> &allhistos, const std::string& name, TArgs... args)
+{
+  TH1* hist = nullptr;
+  if (histMemBudget.UseCompactStorage(name)) {
+    hist = new THF(name.c_str(), args...);
+    hist->SetBit(TH1::kIsNotW);  // stop ROOT from creating the Sumw2 on the first weighted fill
+  } else {
+    hist = new THD(name.c_str(), args...);
+    hist->Sumw2();
+  }
+  histMemBudget.Book(&allhistos, hist);
+  return hist;
+}
+
 // Old functions that enforce float for ranges to be consistent with xval for floating point errors
 void plot1D(string name, float xval, double weight, std::map<string, TH1*> &allhistos, string title, int numbinsx, float xmin, float xmax)
 {
   if (title=="") title=name;
   std::map<string, TH1*>::iterator iter= allhistos.find(name);
   if (iter == allhistos.end()) { //no histo for this yet, so make a new one
-    TH1D* currentHisto= new TH1D(name.c_str(), title.c_str(), numbinsx, xmin, xmax);
-    currentHisto->Sumw2();
+    TH1* currentHisto = bookHist<TH1F,TH1D>(allhistos, name, title.c_str(), numbinsx, xmin, xmax);
     currentHisto->Fill(xval, weight);
     allhistos.insert(std::pair<string, TH1*>(name, currentHisto) );
   } else {
@@ -85,8 +102,7 @@ void plot1d(std::string name, double xval, double weight, std::map<std::string,
 {
   auto iter = allhistos.find(name);
   if (iter == allhistos.end()) {
-    TH1D* currentHisto= new TH1D(name.c_str(), args...);
-    currentHisto->Sumw2();
+    TH1* currentHisto = bookHist<TH1F,TH1D>(allhistos, name, args...);
     currentHisto->Fill(xval, weight);
     allhistos.insert( std::pair<std::string, TH1*>(name, currentHisto) );
   } else {
@@ -99,12 +115,11 @@ void plot2d(std::string name, double xval, double yval, double weight, std::map<
 {
   auto iter = allhistos.find(name);
   if (iter == allhistos.end()) {
-    TH2D* currentHisto= new TH2D(name.c_str(), args...);
-    currentHisto->Sumw2();
+    TH2* currentHisto = (TH2*) bookHist<TH2F,TH2D>(allhistos, name, args...);
     currentHisto->Fill(xval, yval, weight);
     allhistos.insert( std::pair<std::string, TH1*>(name, currentHisto) );
   } else {
-    ((TH2D*) iter->second)->Fill(xval, yval, weight);
+    ((TH2*) iter->second)->Fill(xval, yval, weight);
   }
 }
 
@@ -113,12 +128,11 @@ void plot3d(std::string name, double xval, double yval, double zval, double weig
 {
   auto iter = allhistos.find(name);
   if (iter == allhistos.end()) {
-    TH3D* currentHisto= new TH3D(name.c_str(), args...);
-    currentHisto->Sumw2();
+    TH3* currentHisto = (TH3*) bookHist<TH3F,TH3D>(allhistos, name, args...);
     currentHisto->Fill(xval, yval, zval, weight);
     allhistos.insert( std::pair<std::string, TH1*>(name, currentHisto) );
   } else {
-    ((TH3D*) iter->second)->Fill(xval, yval, zval, weight);
+    ((TH3*) iter->second)->Fill(xval, yval, zval, weight);
   }
 }
 
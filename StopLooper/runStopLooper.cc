@@ -1,25 +1,112 @@
 #include <iostream>
 #include <string>
+#include <map>
+#include <vector>
+#include <stdexcept>
 #include "TChain.h"
 #include "TString.h"
 
 #include "StopLooper.h"
 #include "../StopCORE/sampleInfo.h"
+#include "../StopCORE/BabyCatalog.h"
 
 using namespace std;
 
+// Parse the optional arguments after the positional ones, in the form of --key=value or --flag
+map<string,string> parseOptions(int argc, char** argv, int first) {
+  map<string,string> opts;
+  for (int i = first; i < argc; ++i) {
+    string arg(argv[i]);
+    if (arg.find("--") != 0) {
+      cout << "[runStopLooper] >> Ignoring unknown argument: " << arg << endl;
+      continue;
+    }
+    size_t eq = arg.find('=');
+    if (eq == string::npos) opts[arg.substr(2)] = "true";
+    else opts[arg.substr(2, eq-2)] = arg.substr(eq+1);
+  }
+  return opts;
+}
+
+// Split a comma separated list of option values
+vector<string> splitList(const string& list) {
+  vector<string> items;
+  size_t begin = 0;
+  while (begin < list.size()) {
+    size_t end = list.find(',', begin);
+    if (end == string::npos) end = list.size();
+    if (end > begin) items.push_back(list.substr(begin, end-begin));
+    begin = end + 1;
+  }
+  return items;
+}
+
+// Parse "<var>:<nominal>:<t1>,<t2>,..." of the --scan options
+void addScanVariable(StopLooper& looper, const string& spec) {
+  size_t p1 = spec.find(':');
+  size_t p2 = spec.find(':', p1+1);
+  if (p1 == string::npos || p2 == string::npos)
+    throw invalid_argument("Cannot parse the scan " + spec + ", expecting <var>:<nominal>:<t1>,<t2>,...");
+  vector<float> thresholds;
+  for (const string& thr : splitList(spec.substr(p2+1))) thresholds.push_back(stof(thr));
+  looper.AddScanVariable(spec.substr(0, p1), stof(spec.substr(p1+1, p2-p1-1)), thresholds);
+}
+
 int main(int argc, char** argv)
 {
 
   if (argc < 4) {
-    cout << "USAGE: runStopLooper <input_dir> <sample> <output_dir>" << endl;
+    cout << "USAGE: runStopLooper <input_dir> <sample> <output_dir> [options]" << endl;
+    cout << "  --telemetry=<file>   append a JSON-lines progress record to <file> during the run" << endl;
+    cout << "  --compactHists       book the kinematic histograms as float without Sumw2, yields are kept as is" << endl;
+    cout << "  --histMemLimit=<MB>  warn when the booked histograms get close to <MB> of memory" << endl;
+    cout << "  --subsample=<f>      run on a hash based fraction <f> of the events, weighted by 1/<f>" << endl;
+    cout << "  --dumpEvents=<file>  write the list of selected events to <file>, binary if it ends with .bin" << endl;
+    cout << "  --dumpRegions=<r1,r2,...>  regions to dump, all regions if not given" << endl;
+    cout << "  --dumpColumns=<c1,c2,...>  values to dump for each event, keys of values_ or weight" << endl;
+    cout << "  --checkpointEvents=<N>     save a checkpoint every <N> events" << endl;
+    cout << "  --checkpointMinutes=<T>    save a checkpoint every <T> minutes" << endl;
+    cout << "  --resume             continue from the checkpoint of a previous job of the same sample" << endl;
+    cout << "  --incremental        add only the new input files to the existing output" << endl;
+    cout << "  --schemes=<s1,s2,...>      region schemes to fill in the same pass, the first one at the top level" << endl;
+    cout << "  --scan=<var>:<wp>:<t1>,<t2>,...  yields of the regions cutting on <var> at <wp> for each threshold, --scan2 for a 2nd one" << endl;
+    cout << "  --friends=<d1,d2,...>      directories of friend files named like the babies, with new branches" << endl;
+    cout << "  --friendVars=<v1,v2,...>   float branches of the friends to add to the values of each event" << endl;
+    cout << "  --flatSkims=<dir>    read the babies from their flat skims in <dir>/<baby name>, see FlatSkim.h" << endl;
     return 1;
   }
 
   string input_dir(argv[1]);
   string sample(argv[2]);
   string output_dir(argv[3]);
+  map<string,string> opts = parseOptions(argc, argv, 4);
 
+  // Apply the options common to every looper instance
+  auto configLooper = [&](StopLooper& looper) {
+    if (opts.count("telemetry")) looper.SetTelemetryFile(opts["telemetry"]);
+    if (opts.count("compactHists")) looper.SetCompactHistos(opts["compactHists"] != "false");
+    if (opts.count("histMemLimit")) looper.SetHistMemoryCeiling(stof(opts["histMemLimit"]));
+    if (opts.count("subsample")) looper.SetSubsampleFraction(stof(opts["subsample"]));
+    if (opts.count("dumpEvents")) {
+      vector<string> columns = {"met", "mt", "njet", "nbtag", "tmod", "mlb", "dphijmet", "weight"};
+      if (opts.count("dumpColumns")) columns = splitList(opts["dumpColumns"]);
+      looper.SetEventDump(opts["dumpEvents"], splitList(opts["dumpRegions"]), columns);
+    }
+    if (opts.count("checkpointEvents") || opts.count("checkpointMinutes"))
+      looper.SetCheckpoint(opts.count("checkpointEvents")? stoul(opts["checkpointEvents"]) : 0,
+                           opts.count("checkpointMinutes")? stof(opts["checkpointMinutes"]) : 0);
+    if (opts.count("resume")) looper.SetResume(opts["resume"] != "false");
+    if (opts.count("incremental")) looper.SetIncremental(opts["incremental"] != "false");
+    if (opts.count("schemes")) looper.SetRegionSchemes(splitList(opts["schemes"]));
+    if (opts.count("scan")) addScanVariable(looper, opts["scan"]);
+    if (opts.count("scan2")) addScanVariable(looper, opts["scan2"]);
+    for (string dir : splitList(opts["friends"])) looper.AddFriendDirectory(dir);
+    for (string var : splitList(opts["friendVars"])) looper.AddFriendVariable(var);
+    if (opts.count("flatSkims")) looper.SetFlatSkimDirectory(opts["flatSkims"]);
+  };
+
+  // The babies in the catalogs of their directory are added with their entries, without opening them
+  BabyCatalog catalog;
   TChain *ch = new TChain("t");
   TString infile = Form("%s/%s*.root", input_dir.c_str(), sample.c_str());
 
@@ -29,7 +116,7 @@ int main(int argc, char** argv)
       string filepath = inputdir + fname;
       if (input_dir.find("/output") != string::npos)
         filepath.replace(filepath.find("skim"), 4, "output");
-      chain->Add(filepath.c_str());
+      catalog.AddToChain(chain, filepath);
     }
   };
 
@@ -44,6 +131,7 @@ int main(int argc, char** argv)
       TChain *chain = new TChain("t");
       fillChain(sample, chain);
       StopLooper stop;
+      configLooper(stop);
       stop.looper(chain, samplestr, output_dir);
       delete chain;
     }
@@ -73,117 +161,117 @@ int main(int argc, char** argv)
     doData2016dilep = true;
   } else {
     cout << "[runStopLooper]: infile = " << infile << endl;
-    ch->Add(infile);
+    catalog.AddToChain(ch, infile.Data());
   }
 
   if (doData2017B) {
-    ch->Add(Form("%s/data_met_run2017B_v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_met_run2017B_v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_singleel_run2017B_v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_singleel_run2017B_v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_singlemu_run2017B_v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_singlemu_run2017B_v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_met_run2017B_v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_met_run2017B_v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_singleel_run2017B_v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_singleel_run2017B_v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_singlemu_run2017B_v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_singlemu_run2017B_v2.root", input_dir.c_str()));
   }
   if (doData2017C) {
-    ch->Add(Form("%s/data_singlemu_run2017C_v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_singlemu_run2017C_v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_singlemu_run2017C_v3.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_singleel_run2017C_v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_singleel_run2017C_v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_singleel_run2017C_v3.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_met_run2017C_v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_met_run2017C_v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_met_run2017C_v3.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_singlemu_run2017C_v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_singlemu_run2017C_v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_singlemu_run2017C_v3.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_singleel_run2017C_v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_singleel_run2017C_v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_singleel_run2017C_v3.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_met_run2017C_v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_met_run2017C_v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_met_run2017C_v3.root", input_dir.c_str()));
   }
   if (doData2017dilep) {
-    ch->Add(Form("%s/data_double_eg_Run2017B_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2017B_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2017C_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2017C_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2017C_MINIAOD_PromptReco-v3.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2017B_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2017B_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2017B_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2017B_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2017C_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2017C_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2017C_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2017C_MINIAOD_PromptReco-v3.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2017C_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2017C_MINIAOD_PromptReco-v3.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2017B_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2017B_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2017C_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2017C_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2017C_MINIAOD_PromptReco-v3.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2017B_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2017B_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2017B_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2017B_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2017C_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2017C_MINIAOD_PromptReco-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2017C_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2017C_MINIAOD_PromptReco-v3.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2017C_MINIAOD_PromptReco-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2017C_MINIAOD_PromptReco-v3.root", input_dir.c_str()));
   }
 
   if (doData2016Sync) {
-    ch->Add("/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016B-03Feb2017_ver2-v2/skim/*.root");
-    ch->Add("/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016C-03Feb2017-v1/skim/*.root");
-    ch->Add("/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016D-03Feb2017-v1/skim/*.root");
-    ch->Add("/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016E-03Feb2017-v1/skim/*.root");
-    ch->Add("/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016F-03Feb2017-v1/skim/*.root");
-    ch->Add("/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016G-03Feb2017-v1/skim/*.root");
-    ch->Add("/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016H-03Feb2017_ver2-v1/skim/*.root");
-    ch->Add("/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016H-03Feb2017_ver3-v1/skim/*.root");
-    ch->Add("/nfs-7/userdata//haweber/tupler_babies/merged/Stop_1l/v24_trulyunmerged/skim/data_single_electron_*.root");
-    ch->Add("/nfs-7/userdata//haweber/tupler_babies/merged/Stop_1l/v24_trulyunmerged/skim/data_single_muon_*.root");
+    catalog.AddToChain(ch, "/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016B-03Feb2017_ver2-v2/skim/*.root");
+    catalog.AddToChain(ch, "/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016C-03Feb2017-v1/skim/*.root");
+    catalog.AddToChain(ch, "/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016D-03Feb2017-v1/skim/*.root");
+    catalog.AddToChain(ch, "/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016E-03Feb2017-v1/skim/*.root");
+    catalog.AddToChain(ch, "/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016F-03Feb2017-v1/skim/*.root");
+    catalog.AddToChain(ch, "/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016G-03Feb2017-v1/skim/*.root");
+    catalog.AddToChain(ch, "/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016H-03Feb2017_ver2-v1/skim/*.root");
+    catalog.AddToChain(ch, "/hadoop/cms/store/user/haweber/AutoTwopler_babies/Stop_1l_v24/MET_Run2016H-03Feb2017_ver3-v1/skim/*.root");
+    catalog.AddToChain(ch, "/nfs-7/userdata//haweber/tupler_babies/merged/Stop_1l/v24_trulyunmerged/skim/data_single_electron_*.root");
+    catalog.AddToChain(ch, "/nfs-7/userdata//haweber/tupler_babies/merged/Stop_1l/v24_trulyunmerged/skim/data_single_muon_*.root");
   }
 
   if (doData2016) {
-    ch->Add(Form("%s/data_met_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_muon_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_electron_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
-
-    ch->Add(Form("%s/data_single_muon_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_electron_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_met_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-
-    ch->Add(Form("%s/data_single_muon_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_electron_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_met_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-
-    ch->Add(Form("%s/data_met_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_electron_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_muon_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-
-    ch->Add(Form("%s/data_met_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_electron_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_muon_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-
-    ch->Add(Form("%s/data_met_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_electron_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_muon_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-
-    ch->Add(Form("%s/data_single_electron_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_electron_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_muon_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_single_muon_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_met_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_met_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_met_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_muon_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_electron_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
+
+    catalog.AddToChain(ch, Form("%s/data_single_muon_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_electron_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_met_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+
+    catalog.AddToChain(ch, Form("%s/data_single_muon_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_electron_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_met_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+
+    catalog.AddToChain(ch, Form("%s/data_met_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_electron_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_muon_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+
+    catalog.AddToChain(ch, Form("%s/data_met_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_electron_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_muon_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+
+    catalog.AddToChain(ch, Form("%s/data_met_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_electron_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_muon_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+
+    catalog.AddToChain(ch, Form("%s/data_single_electron_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_electron_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_muon_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_single_muon_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_met_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_met_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
   }
 
   if (doData2016dilep) {
-    ch->Add(Form("%s/data_double_eg_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_eg_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_double_mu_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
-    ch->Add(Form("%s/data_muon_eg_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_eg_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_double_mu_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2016B_MINIAOD_03Feb2017_ver2-v2.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2016C_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2016E_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2016F_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2016G_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2016H_MINIAOD_03Feb2017_ver3-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2016D_MINIAOD_03Feb2017-v1.root", input_dir.c_str()));
+    catalog.AddToChain(ch, Form("%s/data_muon_eg_Run2016H_MINIAOD_03Feb2017_ver2-v1.root", input_dir.c_str()));
   }
 
   if (ch->GetEntries() == 0) {
@@ -192,6 +280,7 @@ int main(int argc, char** argv)
   }
 
   StopLooper stop;
+  configLooper(stop);
   stop.looper(ch, sample, output_dir);
 
   return 0;